@@ -25,9 +25,11 @@
 #include <array>
 #include <deque>
 #include <iterator>
+#include <exception>
 
 #include "av1_scd.h"
 #include "aenc.h"
+#include "mfx_stripe_workers.h"
 
 #if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
 
@@ -123,11 +125,12 @@ namespace aenc {
         ASCTSCstat ScdStat;
 
         uint8_t PMap[ASC_MAP_SIZE] = {};
-        operator ExternalFrame();
+        uint8_t LookbackPMap[ASC_MAP_SIZE] = {}; //m_ScdPersistenceMap after SCD of this frame, published when it's decided
+        operator ExternalFrame() &;
+        operator ExternalFrame() &&;
     };
 
 
-
     class AEnc
     {
     public:
@@ -135,6 +138,7 @@ namespace aenc {
         void Close();
 
         mfxStatus ProcessFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch, AEncFrame* OutFrame);
+        mfxStatus ProcessFrames(uint32_t NumFrames, const uint32_t* POC, const uint8_t* const* InFrames, int32_t pitch, AEncFrame* OutFrames, uint32_t* NumOutFrames);
         void   UpdateFrame(uint32_t displayOrder, uint32_t bits, uint32_t QpY, uint32_t Type);
         mfxU16 GetIntraDecision(mfxU32 displayOrder);
         mfxU16 GetPersistenceMap(mfxU32 displayOrder, mfxU8 PMap[ASC_MAP_SIZE]);
@@ -142,6 +146,11 @@ namespace aenc {
         mfxI8 APQPredict(mfxU32 SC, mfxU32 TSC, mfxU32 MVSize, mfxU32 Contrast, mfxU32 PyramidLayer, mfxU32 BaseQp);
 
     protected:
+        //pipeline stages, AnalyzeFrame() touches only Scd, m_ScdPersistenceMap and "f" and may run on ScdWorkers
+        void AnalyzeFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch, InternalFrame& f);
+        InternalFrame& StartFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch);
+        mfxStatus DecideFrame(InternalFrame& f, AEncFrame* OutFrame);
+
         //stat computation
         void RunScd(const uint8_t* InFrame, int32_t pitch, InternalFrame& f);
         void SaveStat(InternalFrame& f);
@@ -196,6 +205,8 @@ namespace aenc {
         void SetFrameQP(InternalFrame& f, std::array<int32_t, size> QpTable);
         InternalFrame* FindInternalFrame(mfxU32 displayOrder);
         ExternalFrame* FindExternalFrame(mfxU32 displayOrder);
+        void ReuseLists(InternalFrame& f);
+        void RecycleLists(ExternalFrame& f);
 
         //general
         ASC Scd;
@@ -206,6 +217,14 @@ namespace aenc {
         std::vector<InternalFrame> DpbBuffer;
         std::vector<uint32_t> RemoveFromDPBDelayed;
 
+        //preallocated records for SCD stage, two to overlap SCD with decisions in ProcessFrames()
+        InternalFrame ScdFrames[2];
+        uint32_t ScdSlot = 0; //record of the next frame to decide
+        bool ScdAhead = false; //ScdFrames[ScdSlot] was analysed by a ProcessFrames() call which failed
+        mfx::StripeWorkers ScdWorkers;
+        //DPB lists of output frames, reused by new frames
+        std::vector<std::vector<uint32_t>> SpareLists;
+
         //ALTR specific
         ASC LtrScd;
         uint32_t LtrPoc = 0;
@@ -235,6 +254,7 @@ namespace aenc {
         int32_t DeltaQpOffsetForAref = 0;
 
         mfxU8 m_PersistenceMap[ASC_MAP_SIZE] = {};  // Lookback Persistence
+        mfxU8 m_ScdPersistenceMap[ASC_MAP_SIZE] = {};  // accumulated by SCD, may be a frame ahead of m_PersistenceMap
     };
 
 } //namespace aenc
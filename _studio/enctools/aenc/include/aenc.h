@@ -79,6 +79,9 @@ extern "C" {
     mfxStatus MFX_CDECL AEncInit(mfxHDL* pthis, AEncParam param);
     void      MFX_CDECL AEncClose(mfxHDL pthis);
     mfxStatus MFX_CDECL AEncProcessFrame(mfxHDL pthis, mfxU32 POC, mfxU8* InFrame, mfxI32 pitch, AEncFrame* OutFrame);
+    //same as NumFrames AEncProcessFrame() calls, OutFrames should have NumFrames entries, NULL InFrames[i] is EOS
+    //on error NumOutFrames frames are still valid, next call should start from the frame after the one which failed
+    mfxStatus MFX_CDECL AEncProcessFrames(mfxHDL pthis, mfxU32 NumFrames, const mfxU32* POC, mfxU8* const* InFrames, mfxI32 pitch, AEncFrame* OutFrames, mfxU32* NumOutFrames);
     mfxU16    MFX_CDECL AEncGetIntraDecision(mfxHDL pthis, mfxU32 displayOrder);
     mfxU16    MFX_CDECL AEncGetPersistenceMap(mfxHDL pthis, mfxU32 displayOrder, mfxU8 PMap[AENC_MAP_SIZE]);
     mfxU16    MFX_CDECL AEncGetLastPQp(mfxHDL pthis);
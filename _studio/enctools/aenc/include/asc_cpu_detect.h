@@ -37,6 +37,14 @@ static inline mfxI32 CpuFeature_SSE41() {
     return((__builtin_cpu_supports("sse4.1")));
 }
 
+static inline mfxI32 CpuFeature_AVX2() {
+    return((__builtin_cpu_supports("avx2")));
+}
+
+static inline mfxI32 CpuFeature_AVX512BW() {
+    return((__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")));
+}
+
 //
 // end Dispatcher
 //
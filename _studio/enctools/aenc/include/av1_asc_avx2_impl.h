@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef _AV1_ASC_AVX2_IMPL_H_
+#define _AV1_ASC_AVX2_IMPL_H_
+
+#include "av1_scd.h"
+
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+
+namespace aenc {
+    mfxU32 EvaluateForest_AVX2(const ASCTreeNode* nodes, const mfxU16* roots, mfxU32 numTrees, const mfxI32* features);
+}
+
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
+#endif //_AV1_ASC_AVX2_IMPL_H_
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef _AV1_ASC_AVX512_IMPL_H_
+#define _AV1_ASC_AVX512_IMPL_H_
+
+#include "av1_scd.h"
+
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+
+namespace aenc {
+    void GainOffset_AVX512(mfxU8** pSrc, mfxU8** pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff);
+    void RsCsCalc_4x4_AVX512(mfxU8* pSrc, int srcPitch, int wblocks, int hblocks, mfxU16* pRs, mfxU16* pCs);
+    void ImageDiffHistogram_AVX512(mfxU8* pSrc, mfxU8* pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC);
+    void ME_SAD_8x8_Block_Search_AVX512(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU16 *bestSAD, int *bestX, int *bestY);
+    mfxStatus Calc_RaCa_pic_AVX512(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
+
+    // defined with the C kernels so that every ISA rounds the same way
+    mfxF64 Calc_RaCa_pic_norm(mfxI32 Rs, mfxI32 Cs, mfxI32 width, mfxI32 height);
+}
+
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
+#endif //_AV1_ASC_AVX512_IMPL_H_
@@ -370,6 +370,7 @@ namespace aenc {
         */
         std::list<std::pair<mfxI32, bool> > ltr_check_history;
 
+        int m_AVX512_available;
         int m_AVX2_available;
         int m_SSE4_available;
         t_GainOffset               GainOffset;
@@ -474,6 +475,52 @@ namespace aenc {
         void Reset_last_frame_processed();
     };
 
+    // Node of a decision tree table, tables are generated by asc/tools/tree2table.py.
+    // Values with features[feature] < threshold go to the node which follows, others
+    // to node "next". TREE_LEFT_LEAF / TREE_RIGHT_LEAF mark a child which is a decision,
+    // the left one is kept in the upper bits of flags and the right one in "next".
+    // Features are signed 32 bit, unsigned values are saturated to INT32_MAX.
+    struct ASCTreeNode
+    {
+        mfxI32 threshold;
+        mfxU8  feature;
+        mfxU8  flags;
+        mfxU16 next;
+    };
+
+    enum
+    {
+        TREE_LEFT_LEAF  = 1,
+        TREE_RIGHT_LEAF = 2,
+        TREE_LEAF_SHIFT = 2
+    };
+
+    inline mfxU32 EvaluateTree(const ASCTreeNode* nodes, mfxU32 root, const mfxI32* features)
+    {
+        mfxU32 idx = root;
+
+        for (;;)
+        {
+            const ASCTreeNode& node = nodes[idx];
+            const mfxU32 right = features[node.feature] >= node.threshold;
+
+            // the only branch is the exit, child is selected by mask to keep
+            // compiler from turning data dependent choice into a branch
+            const mfxU32 mask = 0u - right;
+            if (node.flags & (TREE_LEFT_LEAF << right))
+                return (node.next & mask) | (mfxU32(node.flags >> TREE_LEAF_SHIFT) & ~mask);
+
+            idx = (node.next & mask) | ((idx + 1) & ~mask);
+        }
+    }
+
+    // Sum of decisions of numTrees trees stored in one node array
+    typedef mfxU32(*t_EvaluateForest)(const ASCTreeNode* nodes, const mfxU16* roots, mfxU32 numTrees, const mfxI32* features);
+
+    // Scene change voting forest, feature order is listed in av1_asc_tree_table.cpp
+    extern const ASCTreeNode SCDetectForest[6198];
+    extern const mfxU16 SCDetectForestRoots[21];
+
     bool SCDetectRF(mfxI32 diffMVdiffVal, mfxU32 RsCsDiff, mfxU32 MVDiff, mfxU32 Rs, mfxU32 AFD,
         mfxU32 CsDiff, mfxI32 diffTSC, mfxU32 TSC, mfxU32 gchDC, mfxI32 diffRsCsdiff,
         mfxU32 posBalance, mfxU32 SC, mfxU32 TSCindex, mfxU32 Scindex, mfxU32 Cs,
@@ -492,6 +539,9 @@ namespace aenc {
         mfxI32 diffAFD, mfxU32 negBalance, mfxU32 ssDCval, mfxU32 refDCval, mfxU32 RsDiff,
         mfxU32 mu_mv_mag_sq, mfxI16 mcTcor, mfxI16 tcor);
 
+    // Adaptive QP tree, feature order is listed in hevc_asc_apq_tree_table.cpp
+    extern const ASCTreeNode APQSelectTree[12265];
+
     mfxI8 APQSelect(mfxU32 SC, mfxU32 TSC, mfxU32 MVSize, mfxU32 Contrast, mfxU32 PyramidLayer, mfxU32 BaseQp);
 
 }; //namespace EncToolsAdaptiveGop
@@ -89,6 +89,27 @@ mfxStatus AEncProcessFrame(mfxHDL pthis, mfxU32 POC, mfxU8* InFrame, mfxI32 pitc
     }
 }
 
+mfxStatus AEncProcessFrames(mfxHDL pthis, mfxU32 NumFrames, const mfxU32* POC, mfxU8* const* InFrames, mfxI32 pitch, AEncFrame* OutFrames, mfxU32* NumOutFrames) {
+    if (!pthis) {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+    if (!POC || !InFrames || !OutFrames || !NumOutFrames) {
+        return MFX_ERR_NULL_PTR;
+    }
+
+    try {
+        aenc::AEnc* a = reinterpret_cast<aenc::AEnc*>(pthis);
+        return a->ProcessFrames(NumFrames, POC, InFrames, pitch, OutFrames, NumOutFrames);
+    }
+    catch (aenc::Error) {
+        return MFX_ERR_INVALID_VIDEO_PARAM;
+    }
+    catch (...)
+    {
+        return MFX_ERR_UNKNOWN;
+    }
+}
+
 mfxU16 AEncGetIntraDecision(mfxHDL pthis, mfxU32 displayOrder) {
     if (!pthis) {
         return 0;
@@ -240,7 +261,7 @@ namespace aenc {
 
 
 
-    InternalFrame::operator ExternalFrame() {
+    InternalFrame::operator ExternalFrame() & {
         ExternalFrame ext;
         ext.POC = POC;
         ext.QpY = QpY;
@@ -265,6 +286,20 @@ namespace aenc {
     }
 
 
+    InternalFrame::operator ExternalFrame() && {
+        //DPB lists are the only members that own memory, move them instead of copying
+        std::vector<uint32_t> removeFromDPB(std::move(RemoveFromDPB));
+        std::vector<uint32_t> refList(std::move(RefList));
+        std::vector<uint32_t> longTermRefList(std::move(LongTermRefList));
+
+        ExternalFrame ext = *this;
+        ext.RemoveFromDPB = std::move(removeFromDPB);
+        ext.RefList = std::move(refList);
+        ext.LongTermRefList = std::move(longTermRefList);
+        return ext;
+    }
+
+
     ExternalFrame::operator AEncFrame() {
         AEncFrame out;
         out.POC = POC;
@@ -386,21 +421,103 @@ namespace aenc {
         LastPFramePOC = 0;
         m_isLtrOn = InitParam.ALTR ? true : false;
         memset(m_PersistenceMap, 0, sizeof(m_PersistenceMap));
+        memset(m_ScdPersistenceMap, 0, sizeof(m_ScdPersistenceMap));
 
     }
 
 
     void AEnc::Close(){
+        ScdWorkers.Stop();
         Scd.Close();
         LtrScd.Close();
     }
 
 
     mfxStatus AEnc::ProcessFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch, AEncFrame* OutFrame) {
-        InternalFrame f;
+        return DecideFrame(StartFrame(POC, InFrame, pitch), OutFrame);
+    }
+
+
+    mfxStatus AEnc::ProcessFrames(uint32_t NumFrames, const uint32_t* POC, const uint8_t* const* InFrames, int32_t pitch, AEncFrame* OutFrames, uint32_t* NumOutFrames) {
+        *NumOutFrames = 0;
+        if (NumFrames == 0) {
+            return MFX_ERR_MORE_DATA;
+        }
+
+        if (ScdWorkers.GetNumStripes() < 2) {
+            ScdWorkers.Start(1);
+        }
+        StartFrame(POC[0], InFrames[0], pitch);
+
+        for (uint32_t i = 0; i < NumFrames; i++) {
+            InternalFrame& f = ScdFrames[ScdSlot];
+            InternalFrame& next = ScdFrames[(ScdSlot + 1) % 2];
+            const bool analyzeNext = i + 1 < NumFrames;
+
+            //SCD of the next frame runs on the worker while decisions are made for the current one,
+            //Run() returns when both are done
+            mfxStatus sts = MFX_ERR_NONE;
+            std::exception_ptr error[2];
+            ScdWorkers.Run(analyzeNext ? 2 : 1, [&](mfxU32 job) {
+                try {
+                    if (job == 0) {
+                        sts = DecideFrame(f, &OutFrames[*NumOutFrames]);
+                    }
+                    else {
+                        AnalyzeFrame(POC[i + 1], InFrames[i + 1], pitch, next);
+                    }
+                }
+                catch (...) {
+                    error[job] = std::current_exception();
+                }
+            });
+            ScdSlot = (ScdSlot + 1) % 2;
+
+            //Scd has already seen the next frame, keep its analysis for the call which resubmits it
+            const bool failed = error[0] || (sts != MFX_ERR_NONE && sts != MFX_ERR_MORE_DATA);
+            ScdAhead = failed && analyzeNext && !error[1] && InFrames[i + 1] != nullptr;
+
+            if (error[0]) {
+                std::rethrow_exception(error[0]);
+            }
+            if (sts == MFX_ERR_NONE) {
+                (*NumOutFrames)++;
+            }
+            if (error[1]) {
+                std::rethrow_exception(error[1]);
+            }
+            if (failed) {
+                return sts;
+            }
+        }
+
+        return *NumOutFrames ? MFX_ERR_NONE : MFX_ERR_MORE_DATA;
+    }
+
+
+    InternalFrame& AEnc::StartFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch) {
+        InternalFrame& f = ScdFrames[ScdSlot];
+
+        if (ScdAhead) {
+            //analysis can't be undone, the frame must come next
+            ScdAhead = false;
+            if (f.POC != POC || InFrame == nullptr) {
+                throw Error("frame analysed ahead was not resubmitted");
+            }
+            return f;
+        }
+
+        AnalyzeFrame(POC, InFrame, pitch, f);
+        return f;
+    }
+
+
+    void AEnc::AnalyzeFrame(uint32_t POC, const uint8_t* InFrame, int32_t pitch, InternalFrame& f) {
+        //reset record, assigning empty DPB lists keeps their capacity,
+        //SCD image and stat are zeroed too and RunScd() overwrites them
+        static const InternalFrame blank{};
+        f = blank;
         f.POC = POC;
-        f.PPyramidIdx = 0;
-        f.LTR = LTRType::NONE;
 
         if (InFrame != nullptr) {
             //run SCD, generates stat, saves GOP size and SC
@@ -408,15 +525,26 @@ namespace aenc {
 
             //save per frame stat
             SaveStat(f);
+        }
+        else {
+            //EOS
+            f.Type = FrameType::DUMMY;
+        }
+    }
+
+
+    mfxStatus AEnc::DecideFrame(InternalFrame& f, AEncFrame* OutFrame) {
+        if (f.Type != FrameType::DUMMY) {
+            //SCD of the next frame may already be done, the map must match the frame being decided
+            memcpy(m_PersistenceMap, f.LookbackPMap, sizeof(m_PersistenceMap));
 
             MakeIFrameDecision(f);
 
             //save frame to buffer
-            FrameBuffer.push_back(f);
+            ReuseLists(f);
+            FrameBuffer.push_back(std::move(f));
         }
         else {
-            //EOS
-            f.Type = FrameType::DUMMY;
             while (FrameBuffer.size() < InitParam.MaxMiniGopSize) {
                 FrameBuffer.push_back(f);
             }
@@ -428,21 +556,21 @@ namespace aenc {
         if (MakeMiniGopDecision(MiniGopSize)) {
             //GOP decided, compute ref list and QP for each frame in mini-GOP
             for (uint32_t i = 0; i < MiniGopSize; i++) {
-                f = FrameBuffer.front();
+                InternalFrame cur = std::move(FrameBuffer.front());
                 FrameBuffer.pop_front();
 
-                MarkFrameInMiniGOP(f, MiniGopSize, i);
+                MarkFrameInMiniGOP(cur, MiniGopSize, i);
 
-                ComputeStat(f);
+                ComputeStat(cur);
 
-                MakeAltrArefDecision(f);
+                MakeAltrArefDecision(cur);
 
-                BuildRefList(f);
-                AdjustQp(f);
-                MakeDbpDecision(f);
-                SaveFrameTypeInfo(f);
+                BuildRefList(cur);
+                AdjustQp(cur);
+                MakeDbpDecision(cur);
+                SaveFrameTypeInfo(cur);
 
-                OutputBuffer.push_back(f);
+                OutputBuffer.push_back(std::move(cur));
             }
         }
 
@@ -470,7 +598,8 @@ namespace aenc {
 
         Scd.GetImageAndStat(f.ScdImage, f.ScdStat, ASCReference_Frame, ASCprevious_frame_data);
         Scd.get_PersistenceMap(f.PMap, false);
-        Scd.get_PersistenceMap(m_PersistenceMap, true);
+        Scd.get_PersistenceMap(m_ScdPersistenceMap, true);
+        memcpy(f.LookbackPMap, m_ScdPersistenceMap, sizeof(f.LookbackPMap));
     }
 
 
@@ -572,7 +701,7 @@ namespace aenc {
     uint32_t AEnc::GetMiniGopSizeCommon() {
         //find start of next mini GOP
         uint32_t n = 1;
-        for (InternalFrame f : FrameBuffer) {
+        for (const InternalFrame& f : FrameBuffer) {
             //check if we need additional P frame
             //first frame can't be dummy, scene change frame is usually I, except cases when it is too close to previous I
             if (f.Type == FrameType::IDR || f.Type == FrameType::DUMMY || (!InitParam.StrictIFrame && f.SceneChanged)) {
@@ -1078,7 +1207,7 @@ namespace aenc {
             return MFX_ERR_MORE_DATA;
         }
 
-        ExternalFrame out = OutputBuffer.front();
+        ExternalFrame out = std::move(OutputBuffer.front());
         OutputBuffer.pop_front();
 
         //OutFrame.print();
@@ -1098,10 +1227,34 @@ namespace aenc {
         //out.print();
 
         *OutFrame = out;
+        RecycleLists(out);
         return MFX_ERR_NONE;
     }
 
 
+    void AEnc::ReuseLists(InternalFrame& f) {
+        for (std::vector<uint32_t>* list : { &f.RemoveFromDPB, &f.RefList, &f.LongTermRefList }) {
+            if (SpareLists.empty()) {
+                return;
+            }
+            if (list->capacity() == 0) {
+                list->swap(SpareLists.back());
+                SpareLists.pop_back();
+            }
+        }
+    }
+
+
+    void AEnc::RecycleLists(ExternalFrame& f) {
+        for (std::vector<uint32_t>* list : { &f.RemoveFromDPB, &f.RefList, &f.LongTermRefList }) {
+            if (list->capacity() != 0) {
+                list->clear();
+                SpareLists.push_back(std::move(*list));
+            }
+        }
+    }
+
+
     void AEnc::MarkFrameAsI(InternalFrame& f) {
         f.Type = FrameType::I;
         PocOfLastIFrame = f.POC;
@@ -28,6 +28,7 @@
 
 #include "av1_scd.h"
 #include "asc_cpu_detect.h"
+#include "av1_asc_avx512_impl.h"
 
 #if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
 
@@ -706,6 +707,16 @@ namespace aenc {
         *RS += Rs >> 4;
     }
 
+    mfxF64 Calc_RaCa_pic_norm(mfxI32 Rs, mfxI32 Cs, mfxI32 width, mfxI32 height) {
+        mfxI32 w4 = (width - 8) >> 2;
+        mfxI32 h4 = (height - 8) >> 2;
+        mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
+        mfxF64 drs = (mfxF64)Rs * d1;
+        mfxF64 dcs = (mfxF64)Cs * d1;
+
+        return sqrt(drs * drs + dcs * dcs);
+    }
+
     mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs) {
         mfxI32 i, j;
         mfxI32 Rs, Cs;
@@ -717,13 +728,7 @@ namespace aenc {
             }
         }
 
-        mfxI32 w4 = (width - 8) >> 2;
-        mfxI32 h4 = (height - 8) >> 2;
-        mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
-        mfxF64 drs = (mfxF64)Rs * d1;
-        mfxF64 dcs = (mfxF64)Cs * d1;
-
-        RsCs = sqrt(drs * drs + dcs * dcs);
+        RsCs = Calc_RaCa_pic_norm(Rs, Cs, width, height);
         return MFX_ERR_NONE;
     }
 
@@ -1035,6 +1040,7 @@ namespace aenc {
         m_pitch(0),
 
         ltr_check_history(),
+        m_AVX512_available(0),
         m_AVX2_available(0),
         m_SSE4_available(0),
         GainOffset(),
@@ -1252,18 +1258,23 @@ namespace aenc {
 #define ET_ASC_CPU_DISP_INIT_C(func)           (func = (func ## _C))
 #define ET_ASC_CPU_DISP_INIT_SSE4(func)        (func = (func ## _SSE4))
 #define ET_ASC_CPU_DISP_INIT_SSE4_C(func)      (m_SSE4_available ? ET_ASC_CPU_DISP_INIT_SSE4(func) : ET_ASC_CPU_DISP_INIT_C(func))
+#define ET_ASC_CPU_DISP_INIT_AVX512(func)      (func = (func ## _AVX512))
+#define ET_ASC_CPU_DISP_INIT_AVX512_C(func)    (m_AVX512_available ? ET_ASC_CPU_DISP_INIT_AVX512(func) : ET_ASC_CPU_DISP_INIT_C(func))
+#define ET_ASC_CPU_DISP_INIT_AVX512_SSE4_C(func) \
+    (m_AVX512_available ? ET_ASC_CPU_DISP_INIT_AVX512(func) : ET_ASC_CPU_DISP_INIT_SSE4_C(func))
 
     mfxStatus ASC::Init(mfxI32 Width, mfxI32 Height, mfxI32 Pitch, mfxU32 /*PicStruct*/, bool IsYUV, mfxU32 CodecId)
     {
+        m_AVX512_available = CpuFeature_AVX512BW();
         m_AVX2_available = 0;// CpuFeature_AVX2();
         m_SSE4_available = CpuFeature_SSE41();
-        ET_ASC_CPU_DISP_INIT_C(GainOffset);
-        ET_ASC_CPU_DISP_INIT_SSE4_C(RsCsCalc_4x4);
+        ET_ASC_CPU_DISP_INIT_AVX512_C(GainOffset);
+        ET_ASC_CPU_DISP_INIT_AVX512_SSE4_C(RsCsCalc_4x4);
         ET_ASC_CPU_DISP_INIT_C(RsCsCalc_bound);
         ET_ASC_CPU_DISP_INIT_C(RsCsCalc_diff);
-        ET_ASC_CPU_DISP_INIT_SSE4_C(ImageDiffHistogram);
-        ET_ASC_CPU_DISP_INIT_SSE4_C(ME_SAD_8x8_Block_Search);
-        ET_ASC_CPU_DISP_INIT_SSE4_C(Calc_RaCa_pic);
+        ET_ASC_CPU_DISP_INIT_AVX512_SSE4_C(ImageDiffHistogram);
+        ET_ASC_CPU_DISP_INIT_AVX512_SSE4_C(ME_SAD_8x8_Block_Search);
+        ET_ASC_CPU_DISP_INIT_AVX512_SSE4_C(Calc_RaCa_pic);
 
         InitStruct();
         try
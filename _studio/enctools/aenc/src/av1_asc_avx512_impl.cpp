@@ -0,0 +1,248 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "av1_asc_avx512_impl.h"
+#include "asc_cpu_detect.h"
+
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+
+#include <algorithm>
+
+namespace aenc {
+
+    // first n bytes of a row, n <= 64
+    static inline __mmask64 BytesMask(mfxI32 n)
+    {
+        return n >= 64 ? ~0ULL : (1ULL << n) - 1;
+    }
+
+    static inline __m512i LoadU8ToU16(const mfxU8 *p, __mmask64 mask)
+    {
+        return _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(mask, p)));
+    }
+
+    static inline __m512i AbsDiffU8(__m512i a, __m512i b)
+    {
+        return _mm512_or_si512(_mm512_subs_epu8(a, b), _mm512_subs_epu8(b, a));
+    }
+
+    void ME_SAD_8x8_Block_Search_AVX512(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange,
+        mfxU16 *bestSAD, int *bestX, int *bestY)
+    {
+        // 128-bit lane L takes reference bytes 4L..4L+15, its quadwords are candidates 4L and 4L + 2
+        const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6);
+        const __m512i shift = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 2, 3, 4, 5, 6, 7, 8, 9));
+        const __m128i pos   = _mm_setr_epi16(0, 2, 4, 6, 8, 10, 12, 14);
+
+        __m512i s[8];
+        for (int i = 0; i < 8; i++)
+            s[i] = _mm512_broadcastq_epi64(_mm_loadl_epi64((__m128i *)&pSrc[i * pitch]));
+
+        for (int y = 0; y < yrange; y += ET_SAD_SEARCH_VSTEP) {
+            // 8 candidates every two in X dimension at a time
+            for (int x = 0; x < xrange; x += 16) {
+                mfxU8*
+                    pr = pRef + (y * pitch) + x;
+                // don't read past the last candidate
+                __mmask64
+                    load = BytesMask(std::min(xrange - x + 7, 22));
+                __m512i
+                    sad = _mm512_setzero_si512();
+                for (int i = 0; i < 8; i++) {
+                    __m512i r = _mm512_maskz_loadu_epi8(load, &pr[i * pitch]);
+                    r = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(lanes, r), shift);
+                    sad = _mm512_add_epi64(sad, _mm512_sad_epu8(r, s[i]));
+                }
+                __m128i
+                    t = _mm512_cvtepi64_epi16(sad);
+                // kill out-of-bound values
+                t = _mm_or_si128(t, _mm_cmpgt_epi16(pos, _mm_set1_epi16((short)(xrange - x - 1))));
+                t = _mm_minpos_epu16(t);
+                mfxU16
+                    SAD = (mfxU16)_mm_extract_epi16(t, 0);
+                if (SAD < *bestSAD) {
+                    *bestSAD = SAD;
+                    *bestX = x + 2 * _mm_extract_epi16(t, 1);
+                    *bestY = y;
+                }
+            }
+        }
+    }
+
+    void RsCsCalc_4x4_AVX512(mfxU8* pSrc, int srcPitch, int wblocks, int hblocks, mfxU16* pRs, mfxU16* pCs)
+    {
+        pSrc += (4 * srcPitch) + 4;
+        for (mfxI32 i = 0; i < hblocks - 2; i++)
+        {
+            // 8 horizontal blocks at a time
+            for (mfxI32 j = 0; j < wblocks - 2; j += 8)
+            {
+                mfxI32 blocks = std::min(wblocks - 2 - j, 8);
+                __mmask64 pixels = BytesMask(4 * blocks);
+                mfxU8* p = pSrc + 4 * j;
+
+                __m512i rs = _mm512_setzero_si512();
+                __m512i cs = _mm512_setzero_si512();
+                __m512i a = LoadU8ToU16(p - srcPitch, pixels);
+
+                for (mfxI32 k = 0; k < 4; k++)
+                {
+                    __m512i b = LoadU8ToU16(p - 1, pixels);
+                    __m512i c = LoadU8ToU16(p, pixels);
+                    p += srcPitch;
+
+                    // accRs += dRs * dRs
+                    a = _mm512_srai_epi16(_mm512_abs_epi16(_mm512_sub_epi16(c, a)), 2);
+                    rs = _mm512_add_epi32(rs, _mm512_madd_epi16(a, a));
+
+                    // accCs += dCs * dCs
+                    b = _mm512_srai_epi16(_mm512_abs_epi16(_mm512_sub_epi16(c, b)), 2);
+                    cs = _mm512_add_epi32(cs, _mm512_madd_epi16(b, b));
+
+                    // reuse next iteration
+                    a = c;
+                }
+
+                // pairs of pixels to blocks, a block sum doesn't exceed 16 bits
+                rs = _mm512_add_epi32(rs, _mm512_srli_epi64(rs, 32));
+                cs = _mm512_add_epi32(cs, _mm512_srli_epi64(cs, 32));
+
+                __mmask32 store = (__mmask32)BytesMask(blocks);
+                _mm512_mask_storeu_epi16(&pRs[i * wblocks + j], store, _mm512_castsi128_si512(_mm512_cvtepi64_epi16(rs)));
+                _mm512_mask_storeu_epi16(&pCs[i * wblocks + j], store, _mm512_castsi128_si512(_mm512_cvtepi64_epi16(cs)));
+            }
+            pSrc += 4 * srcPitch;
+        }
+    }
+
+    void ImageDiffHistogram_AVX512(mfxU8* pSrc, mfxU8* pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i lo   = _mm512_set1_epi8(ET_HIST_THRESH_LO);
+        const __m512i hi   = _mm512_set1_epi8(ET_HIST_THRESH_HI);
+
+        __m512i sDC = _mm512_setzero_si512();
+        __m512i rDC = _mm512_setzero_si512();
+
+        mfxU32 h0 = 0, h1 = 0, h2 = 0, h3 = 0;
+
+        for (mfxU32 i = 0; i < height; i++)
+        {
+            // process 64 pixels per iteration
+            for (mfxU32 j = 0; j < width; j += 64)
+            {
+                __mmask64 m = BytesMask(mfxI32(std::min(width - j, 64u)));
+                __m512i s = _mm512_maskz_loadu_epi8(m, &pSrc[j]);
+                __m512i r = _mm512_maskz_loadu_epi8(m, &pRef[j]);
+
+                sDC = _mm512_add_epi64(sDC, _mm512_sad_epu8(s, zero));
+                rDC = _mm512_add_epi64(rDC, _mm512_sad_epu8(r, zero));
+
+                __m512i dn = _mm512_subs_epu8(r, s);   // max(-d, 0)
+                __m512i dp = _mm512_subs_epu8(s, r);   // max(+d, 0)
+
+                h0 += __builtin_popcountll(_mm512_mask_cmpgt_epu8_mask(m, dn, hi)); // d < -12
+                h1 += __builtin_popcountll(_mm512_mask_cmpgt_epu8_mask(m, dn, lo)); // d < -1
+                h2 += __builtin_popcountll(_mm512_mask_cmplt_epu8_mask(m, dp, lo)); // d < +1
+                h3 += __builtin_popcountll(_mm512_mask_cmplt_epu8_mask(m, dp, hi)); // d < +12
+            }
+            pSrc += pitch;
+            pRef += pitch;
+        }
+
+        *pSrcDC = _mm512_reduce_add_epi64(sDC);
+        *pRefDC = _mm512_reduce_add_epi64(rDC);
+
+        // undo cumulative counts, by differencing
+        histogram[0] = h0;
+        histogram[1] = h1 - h0;
+        histogram[2] = h2 - h1;
+        histogram[3] = h3 - h2;
+        histogram[4] = width * height - h3;
+    }
+
+    void GainOffset_AVX512(mfxU8** pSrc, mfxU8** pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff)
+    {
+        mfxU8 *ss = *pSrc,
+              *dd = *pDst;
+        // saturating byte arithmetic clamps results to [0, 255]
+        const __m512i gain = _mm512_set1_epi8((char)std::min(abs(gainDiff), 255));
+
+        for (mfxU16 i = 0; i < height; i++) {
+            for (mfxU16 j = 0; j < width; j += 64) {
+                __mmask64 m = BytesMask(width - j);
+                __m512i v = _mm512_maskz_loadu_epi8(m, &ss[j + i * pitch]);
+                v = (gainDiff > 0) ? _mm512_subs_epu8(v, gain) : _mm512_adds_epu8(v, gain);
+                _mm512_mask_storeu_epi8(&dd[j + i * pitch], m, v);
+            }
+        }
+
+        *pSrc = *pDst;
+    }
+
+    mfxStatus Calc_RaCa_pic_AVX512(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs)
+    {
+        const __m512i ones8  = _mm512_set1_epi8(1);
+        const __m512i ones16 = _mm512_set1_epi16(1);
+
+        mfxI32
+            RS = 0,
+            CS = 0;
+        for (mfxI32 i = 4; i < height - 4; i += 4)
+        {
+            // 16 horizontal blocks at a time
+            for (mfxI32 j = 4; j < width - 4; j += 64)
+            {
+                mfxI32 blocks = std::min((width - 4 - j + 3) >> 2, 16);
+                __mmask64 pixels = BytesMask(4 * blocks);
+                mfxU8 *pY = pSrc + i * pitch + j;
+
+                __m512i rs = _mm512_setzero_si512();
+                __m512i cs = _mm512_setzero_si512();
+                __m512i c = _mm512_maskz_loadu_epi8(pixels, pY);
+
+                for (mfxI32 k = 0; k < 4; k++)
+                {
+                    __m512i b = _mm512_maskz_loadu_epi8(pixels, pY + 1);
+                    __m512i a = _mm512_maskz_loadu_epi8(pixels, pY + pitch);
+                    pY += pitch;
+
+                    // Cs += abs(pS[j] - pS[j + 1]), Rs += abs(pS[j] - pS2[j]) in pairs of pixels
+                    cs = _mm512_add_epi16(cs, _mm512_maddubs_epi16(AbsDiffU8(c, b), ones8));
+                    rs = _mm512_add_epi16(rs, _mm512_maddubs_epi16(AbsDiffU8(c, a), ones8));
+
+                    // reuse next iteration
+                    c = a;
+                }
+
+                // Rs >> 4, Cs >> 4 of every block
+                rs = _mm512_srli_epi32(_mm512_madd_epi16(rs, ones16), 4);
+                cs = _mm512_srli_epi32(_mm512_madd_epi16(cs, ones16), 4);
+
+                RS += _mm512_reduce_add_epi32(rs);
+                CS += _mm512_reduce_add_epi32(cs);
+            }
+        }
+        RsCs = Calc_RaCa_pic_norm(RS, CS, width, height);
+        return MFX_ERR_NONE;
+    }
+
+} // namespace aenc
+
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
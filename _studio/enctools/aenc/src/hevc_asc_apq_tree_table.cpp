@@ -0,0 +1,12300 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generated by asc/tools/tree2table.py, do not edit.
+// Features: s, t, m, c, l, q
+
+#include "av1_scd.h"
+
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+
+namespace aenc {
+
+const ASCTreeNode APQSelectTree[12265] = {
+    {3, 4, 0, 3933},
+    {2, 4, 0, 1278},
+    {1971, 0, 0, 495},
+    {341, 2, 0, 201},
+    {50, 3, 0, 77},
+    {865853, 1, 0, 62},
+    {990, 0, 0, 12},
+    {190, 0, 0, 10},
+    {128, 0, 9, 9},
+    {14, 5, 19, 3},
+    {426, 0, 2, 0},
+    {18, 5, 11, 1},
+    {1808, 0, 0, 50},
+    {213, 2, 0, 45},
+    {27167, 1, 0, 22},
+    {10747, 1, 17, 16},
+    {39, 3, 2, 2},
+    {140, 2, 2, 2},
+    {6, 2, 21, 19},
+    {94, 2, 2, 4},
+    {1729, 0, 21, 21},
+    {1767, 0, 19, 3},
+    {47, 3, 0, 41},
+    {398636, 1, 2, 4},
+    {1364, 0, 0, 32},
+    {4, 2, 2, 3},
+    {1051, 0, 21, 27},
+    {50022, 1, 0, 31},
+    {22, 5, 0, 30},
+    {16, 5, 15, 5},
+    {24, 5, 19, 5},
+    {37, 3, 19, 3},
+    {1659, 0, 17, 33},
+    {37, 2, 21, 34},
+    {18, 5, 0, 40},
+    {17, 5, 2, 3},
+    {112, 2, 13, 37},
+    {16, 5, 0, 39},
+    {1671, 0, 15, 4},
+    {52143, 1, 19, 5},
+    {163, 2, 19, 3},
+    {311335, 1, 0, 43},
+    {19, 5, 7, 2},
+    {48, 3, 2, 4},
+    {24, 5, 23, 4},
+    {1392, 0, 0, 48},
+    {1263, 0, 2, 1},
+    {27, 5, 11, 1},
+    {1528, 0, 2, 4},
+    {18, 5, 15, 4},
+    {65377, 1, 0, 59},
+    {25, 3, 9, 52},
+    {1, 2, 2, 4},
+    {41993, 1, 0, 56},
+    {36, 3, 17, 55},
+    {16, 5, 19, 5},
+    {1926, 0, 0, 58},
+    {1900, 0, 15, 4},
+    {21, 5, 7, 0},
+    {29, 3, 2, 2},
+    {19, 3, 9, 61},
+    {26, 5, 19, 3},
+    {328, 0, 0, 70},
+    {1184189, 1, 0, 65},
+    {14, 5, 11, 1},
+    {1269902, 1, 1, 66},
+    {21, 5, 0, 68},
+    {179, 0, 11, 3},
+    {24, 5, 5, 69},
+    {269, 0, 11, 1},
+    {25, 3, 0, 75},
+    {1767, 0, 2, 2},
+    {1296, 0, 2, 3},
+    {1206, 0, 2, 2},
+    {30, 5, 11, 3},
+    {28, 3, 2, 2},
+    {26, 3, 11, 4},
+    {401170, 1, 0, 165},
+    {187215, 1, 0, 137},
+    {72, 3, 0, 101},
+    {141, 2, 0, 93},
+    {30, 5, 0, 91},
+    {63, 3, 0, 89},
+    {54, 3, 5, 84},
+    {131, 0, 9, 85},
+    {1169, 0, 13, 86},
+    {1428, 0, 0, 88},
+    {1294, 0, 11, 1},
+    {19, 5, 15, 4},
+    {27, 5, 2, 3},
+    {216, 0, 7, 2},
+    {1169, 0, 2, 1},
+    {559, 0, 7, 5},
+    {1660, 0, 0, 100},
+    {641, 0, 0, 99},
+    {17, 5, 21, 96},
+    {361, 0, 17, 97},
+    {365, 0, 2, 3},
+    {22, 5, 15, 4},
+    {60, 3, 3, 4},
+    {23, 5, 23, 3},
+    {317, 2, 0, 135},
+    {85, 3, 0, 121},
+    {28, 2, 0, 108},
+    {1001, 0, 17, 105},
+    {74, 3, 2, 1},
+    {1381, 0, 2, 4},
+    {17, 5, 3, 1},
+    {19, 5, 0, 118},
+    {18, 5, 0, 115},
+    {15, 5, 2, 0},
+    {12, 5, 5, 112},
+    {83516, 1, 2, 0},
+    {77, 3, 2, 0},
+    {44785, 1, 3, 1},
+    {913, 0, 2, 0},
+    {75, 2, 2, 1},
+    {889, 0, 3, 1},
+    {21, 5, 2, 0},
+    {843, 0, 9, 120},
+    {35741, 1, 11, 1},
+    {1881, 0, 0, 127},
+    {217, 2, 2, 1},
+    {97, 3, 0, 125},
+    {16, 5, 3, 1},
+    {132010, 1, 2, 4},
+    {21, 5, 11, 3},
+    {22, 5, 0, 134},
+    {6186, 1, 0, 132},
+    {1, 2, 2, 3},
+    {1913, 0, 2, 1},
+    {15, 5, 7, 2},
+    {98, 3, 5, 133},
+    {7220, 1, 7, 0},
+    {98, 3, 7, 2},
+    {327, 0, 2, 2},
+    {16, 5, 19, 3},
+    {286919, 1, 0, 152},
+    {90, 3, 0, 147},
+    {263924, 1, 2, 4},
+    {257573, 1, 2, 3},
+    {60, 3, 13, 142},
+    {88, 3, 2, 3},
+    {63, 3, 17, 144},
+    {15, 5, 13, 145},
+    {65, 3, 2, 4},
+    {23, 5, 19, 3},
+    {99, 3, 2, 4},
+    {353, 0, 0, 150},
+    {14, 5, 19, 3},
+    {1037, 0, 2, 0},
+    {17, 5, 3, 2},
+    {1215, 0, 0, 160},
+    {170, 2, 0, 159},
+    {54, 3, 17, 155},
+    {85, 3, 2, 1},
+    {110, 2, 0, 158},
+    {61, 2, 7, 2},
+    {16, 5, 15, 2},
+    {531, 0, 19, 3},
+    {58, 3, 0, 163},
+    {1721, 0, 21, 162},
+    {29, 5, 7, 2},
+    {64, 3, 17, 164},
+    {24, 5, 19, 3},
+    {875, 0, 0, 185},
+    {4, 2, 13, 167},
+    {13, 5, 0, 169},
+    {650918, 1, 7, 3},
+    {93, 3, 0, 184},
+    {2298223, 1, 0, 183},
+    {572, 0, 0, 181},
+    {21, 5, 0, 179},
+    {54, 3, 5, 174},
+    {80, 3, 0, 178},
+    {237, 2, 2, 2},
+    {158, 2, 2, 1},
+    {18, 5, 11, 1},
+    {85, 3, 3, 2},
+    {26, 5, 5, 180},
+    {285, 0, 7, 2},
+    {597, 0, 13, 182},
+    {635, 0, 11, 1},
+    {21, 5, 15, 2},
+    {32, 5, 11, 3},
+    {1876, 0, 0, 198},
+    {29, 5, 0, 194},
+    {6, 2, 2, 2},
+    {23, 5, 0, 192},
+    {1117, 0, 9, 190},
+    {21, 5, 2, 2},
+    {2, 2, 15, 2},
+    {27, 5, 2, 3},
+    {1, 2, 15, 1},
+    {1082, 0, 0, 197},
+    {272, 2, 2, 3},
+    {30, 5, 3, 2},
+    {1254864, 1, 7, 2},
+    {699831, 1, 2, 2},
+    {1933, 0, 2, 4},
+    {25, 5, 15, 4},
+    {451361, 1, 0, 297},
+    {1846, 2, 0, 294},
+    {13, 5, 0, 210},
+    {1759, 0, 2, 4},
+    {133639, 1, 2, 3},
+    {956, 2, 9, 207},
+    {66832, 1, 9, 208},
+    {11, 5, 13, 209},
+    {25, 3, 15, 1},
+    {178, 0, 17, 211},
+    {84050, 1, 0, 222},
+    {78929, 1, 0, 220},
+    {1832, 0, 0, 218},
+    {892, 0, 0, 216},
+    {805, 0, 11, 3},
+    {1289, 2, 2, 3},
+    {1563, 0, 7, 2},
+    {779, 2, 13, 219},
+    {29, 5, 11, 3},
+    {80315, 1, 1, 221},
+    {668, 0, 23, 4},
+    {439, 0, 0, 241},
+    {235, 0, 0, 227},
+    {90, 3, 9, 225},
+    {196, 0, 5, 226},
+    {204, 0, 23, 4},
+    {338079, 1, 0, 232},
+    {165775, 1, 9, 229},
+    {91, 3, 2, 1},
+    {88, 3, 5, 231},
+    {336, 0, 7, 3},
+    {72, 3, 0, 234},
+    {404577, 1, 15, 1},
+    {83, 3, 9, 235},
+    {371465, 1, 0, 239},
+    {407, 0, 0, 238},
+    {17, 5, 15, 2},
+    {19, 5, 11, 1},
+    {93, 3, 2, 1},
+    {26, 5, 7, 2},
+    {927, 0, 0, 281},
+    {31, 5, 0, 280},
+    {80, 3, 0, 256},
+    {869, 0, 0, 250},
+    {294111, 1, 0, 247},
+    {22, 3, 11, 1},
+    {70, 3, 2, 1},
+    {490, 0, 2, 2},
+    {20, 5, 7, 2},
+    {36, 3, 5, 251},
+    {21, 5, 0, 254},
+    {19, 5, 1, 253},
+    {901, 0, 3, 1},
+    {913, 0, 2, 1},
+    {884, 0, 11, 0},
+    {99, 3, 0, 271},
+    {464, 0, 0, 262},
+    {19, 5, 0, 261},
+    {16, 5, 5, 260},
+    {17, 5, 11, 3},
+    {21, 5, 11, 1},
+    {154177, 1, 5, 263},
+    {660, 0, 2, 2},
+    {16, 5, 1, 265},
+    {746, 2, 0, 269},
+    {98, 3, 0, 268},
+    {22, 5, 3, 1},
+    {195212, 1, 3, 2},
+    {98, 3, 9, 270},
+    {554, 0, 7, 0},
+    {219073, 1, 0, 278},
+    {16, 5, 0, 274},
+    {452, 0, 15, 2},
+    {563, 0, 2, 1},
+    {482, 2, 9, 276},
+    {715, 2, 2, 2},
+    {495, 0, 7, 2},
+    {15, 5, 2, 1},
+    {484, 0, 3, 1},
+    {33, 5, 15, 2},
+    {393, 2, 9, 282},
+    {99, 3, 2, 1},
+    {678, 2, 0, 288},
+    {398495, 1, 0, 287},
+    {594, 2, 9, 286},
+    {1715, 0, 23, 2},
+    {23, 5, 11, 1},
+    {1924, 0, 2, 1},
+    {43, 3, 5, 290},
+    {261546, 1, 2, 2},
+    {1197, 0, 0, 293},
+    {118566, 1, 11, 1},
+    {97, 3, 11, 1},
+    {87727, 1, 2, 2},
+    {1767, 0, 2, 3},
+    {33395, 1, 11, 1},
+    {35, 5, 2, 2},
+    {1015410, 1, 0, 346},
+    {1612, 2, 2, 2},
+    {1008296, 1, 2, 4},
+    {1505, 0, 0, 338},
+    {83, 3, 0, 325},
+    {1179, 0, 0, 311},
+    {13, 3, 1, 305},
+    {473790, 1, 9, 306},
+    {230, 0, 9, 307},
+    {688649, 1, 5, 308},
+    {29, 3, 0, 310},
+    {19, 5, 11, 1},
+    {557, 0, 7, 2},
+    {72, 3, 0, 324},
+    {66, 3, 0, 323},
+    {42, 3, 0, 319},
+    {556, 2, 2, 3},
+    {22, 5, 9, 316},
+    {392, 2, 5, 317},
+    {1346, 0, 2, 1},
+    {27, 5, 11, 1},
+    {1235, 0, 5, 320},
+    {26, 5, 2, 3},
+    {1276, 0, 5, 322},
+    {18, 5, 15, 1},
+    {26, 5, 15, 2},
+    {1439, 0, 11, 1},
+    {89, 3, 0, 328},
+    {430, 2, 17, 327},
+    {913, 2, 15, 2},
+    {562158, 1, 0, 331},
+    {449, 0, 2, 2},
+    {15, 5, 3, 1},
+    {1196, 2, 0, 337},
+    {879449, 1, 0, 335},
+    {91, 3, 2, 2},
+    {19, 5, 15, 2},
+    {1045, 0, 5, 336},
+    {21, 5, 11, 1},
+    {24, 5, 15, 1},
+    {1864, 0, 0, 343},
+    {1711, 0, 9, 340},
+    {1747, 0, 17, 341},
+    {1856, 0, 2, 3},
+    {24, 5, 15, 2},
+    {938, 2, 9, 344},
+    {1177, 2, 5, 345},
+    {26, 5, 7, 2},
+    {23, 5, 0, 405},
+    {83, 3, 0, 402},
+    {1250, 2, 0, 372},
+    {77, 3, 0, 371},
+    {1205, 2, 2, 2},
+    {13, 5, 9, 352},
+    {21, 3, 9, 353},
+    {2246011, 1, 0, 370},
+    {942, 2, 0, 369},
+    {757, 2, 2, 2},
+    {1202, 0, 0, 361},
+    {1323033, 1, 9, 358},
+    {59, 3, 0, 360},
+    {22, 5, 11, 1},
+    {723, 0, 11, 1},
+    {1083230, 1, 0, 363},
+    {19, 5, 7, 2},
+    {433, 2, 9, 364},
+    {1531, 0, 13, 365},
+    {1615, 0, 9, 366},
+    {18, 5, 9, 367},
+    {20, 5, 2, 3},
+    {1565820, 1, 15, 1},
+    {1725, 0, 15, 2},
+    {1333, 0, 11, 3},
+    {1560098, 1, 11, 1},
+    {1892045, 1, 0, 387},
+    {49, 3, 0, 376},
+    {18, 5, 2, 3},
+    {2190, 2, 15, 1},
+    {1801186, 1, 2, 3},
+    {15, 5, 9, 378},
+    {938, 0, 5, 379},
+    {81, 3, 0, 386},
+    {16949, 2, 2, 3},
+    {21, 5, 0, 385},
+    {1653303, 1, 2, 2},
+    {1486, 0, 2, 1},
+    {19, 5, 11, 1},
+    {1310, 2, 7, 2},
+    {1210, 0, 15, 1},
+    {13, 5, 13, 388},
+    {49, 3, 0, 393},
+    {2837, 2, 9, 390},
+    {698, 0, 9, 391},
+    {1390, 0, 2, 1},
+    {20, 5, 7, 3},
+    {1636, 2, 5, 394},
+    {12376, 2, 2, 1},
+    {5223, 2, 0, 399},
+    {1459, 0, 0, 398},
+    {5278436, 1, 11, 3},
+    {58, 3, 7, 3},
+    {17, 5, 0, 401},
+    {433, 0, 7, 2},
+    {11850103, 1, 15, 2},
+    {99, 3, 9, 403},
+    {16, 5, 5, 404},
+    {445, 0, 7, 2},
+    {73, 3, 0, 459},
+    {2158, 2, 0, 442},
+    {1300, 0, 0, 432},
+    {1941424, 1, 0, 423},
+    {1772178, 1, 0, 422},
+    {60, 3, 0, 420},
+    {553, 2, 0, 413},
+    {604, 0, 11, 1},
+    {1525, 2, 2, 3},
+    {776, 0, 13, 415},
+    {1619200, 1, 2, 3},
+    {1469739, 1, 2, 2},
+    {27, 5, 2, 2},
+    {1028, 2, 2, 1},
+    {1077, 0, 11, 3},
+    {1245, 0, 2, 1},
+    {435, 2, 7, 2},
+    {33, 3, 11, 1},
+    {3337569, 1, 0, 425},
+    {19, 3, 7, 2},
+    {1230, 2, 0, 429},
+    {211, 0, 5, 427},
+    {279, 0, 13, 428},
+    {29, 5, 7, 3},
+    {69, 3, 2, 3},
+    {4427704, 1, 9, 431},
+    {27, 5, 7, 2},
+    {24, 5, 0, 434},
+    {1016, 2, 11, 3},
+    {34, 5, 0, 441},
+    {32, 5, 0, 439},
+    {2222955, 1, 9, 437},
+    {2314349, 1, 5, 438},
+    {2351826, 1, 15, 2},
+    {33, 5, 9, 440},
+    {57, 3, 11, 1},
+    {606, 2, 15, 2},
+    {1609002, 1, 0, 447},
+    {1097635, 1, 9, 444},
+    {1191736, 1, 13, 445},
+    {852, 0, 13, 446},
+    {27, 5, 15, 2},
+    {2037339, 1, 0, 454},
+    {33, 3, 5, 449},
+    {27, 5, 0, 452},
+    {25, 5, 2, 1},
+    {1281, 0, 11, 1},
+    {1705240, 1, 13, 453},
+    {1957, 0, 7, 2},
+    {1009, 0, 2, 2},
+    {34, 5, 2, 1},
+    {67, 3, 2, 3},
+    {2188, 2, 2, 2},
+    {30, 5, 7, 2},
+    {2664245, 1, 0, 480},
+    {33, 5, 0, 477},
+    {24, 5, 0, 464},
+    {84, 3, 9, 463},
+    {3339, 2, 7, 2},
+    {1279763, 1, 9, 465},
+    {1579, 0, 0, 474},
+    {86, 3, 2, 2},
+    {2139, 2, 2, 1},
+    {2033, 2, 2, 3},
+    {28, 5, 2, 2},
+    {1542, 2, 2, 1},
+    {1151, 2, 2, 2},
+    {76, 3, 5, 473},
+    {630, 2, 11, 3},
+    {82, 3, 2, 2},
+    {80, 3, 2, 3},
+    {843, 2, 15, 2},
+    {1831, 2, 2, 1},
+    {34, 5, 2, 2},
+    {1205, 2, 7, 2},
+    {88, 3, 0, 494},
+    {24, 5, 5, 482},
+    {33, 5, 0, 493},
+    {351, 0, 13, 484},
+    {3227638, 1, 0, 487},
+    {1559, 2, 13, 486},
+    {83, 3, 11, 3},
+    {74, 3, 13, 488},
+    {28, 5, 0, 490},
+    {25, 5, 11, 1},
+    {30, 5, 0, 492},
+    {4065235, 1, 15, 2},
+    {77, 3, 7, 3},
+    {3299, 2, 11, 1},
+    {3872633, 1, 7, 2},
+    {5369, 1, 0, 548},
+    {600, 2, 2, 2},
+    {18, 3, 0, 510},
+    {8002, 0, 0, 500},
+    {25, 5, 23, 3},
+    {3514, 1, 2, 4},
+    {8430, 0, 2, 4},
+    {2195, 1, 13, 503},
+    {21, 5, 0, 509},
+    {38, 2, 2, 4},
+    {16, 5, 0, 508},
+    {15, 3, 2, 3},
+    {8204, 0, 19, 5},
+    {8295, 0, 15, 4},
+    {28, 5, 23, 3},
+    {81, 3, 2, 2},
+    {19, 3, 9, 512},
+    {62, 3, 0, 545},
+    {7283, 0, 0, 517},
+    {2084, 0, 2, 2},
+    {15, 5, 17, 516},
+    {2008, 0, 19, 5},
+    {28, 3, 0, 538},
+    {1267, 1, 17, 519},
+    {8235, 0, 0, 533},
+    {21, 3, 0, 522},
+    {7562, 0, 19, 5},
+    {7727, 0, 0, 532},
+    {24, 3, 0, 530},
+    {13, 5, 17, 525},
+    {22, 3, 0, 527},
+    {23, 5, 15, 4},
+    {3915, 1, 0, 529},
+    {18, 5, 15, 4},
+    {19, 5, 19, 5},
+    {7709, 0, 2, 4},
+    {21, 5, 11, 1},
+    {14, 5, 23, 4},
+    {1, 2, 0, 537},
+    {3744, 1, 17, 535},
+    {18, 5, 13, 536},
+    {22, 5, 23, 3},
+    {21, 5, 23, 3},
+    {9492, 0, 2, 2},
+    {167, 2, 2, 5},
+    {9330, 0, 0, 544},
+    {8405, 0, 17, 542},
+    {9225, 0, 9, 543},
+    {32, 5, 15, 4},
+    {9368, 0, 23, 4},
+    {2557, 0, 2, 4},
+    {12, 5, 2, 3},
+    {2489, 0, 23, 3},
+    {7614, 0, 0, 1044},
+    {3516, 0, 0, 832},
+    {65917, 1, 0, 596},
+    {2830, 0, 0, 584},
+    {2265, 0, 0, 569},
+    {70, 3, 0, 566},
+    {35, 3, 0, 565},
+    {39573, 1, 2, 2},
+    {2045, 0, 0, 564},
+    {542, 2, 0, 563},
+    {26, 3, 17, 559},
+    {2020, 0, 0, 562},
+    {2006, 0, 9, 561},
+    {21, 5, 7, 2},
+    {20, 5, 15, 4},
+    {27, 5, 15, 2},
+    {22, 5, 7, 0},
+    {29513, 1, 11, 3},
+    {23651, 1, 9, 567},
+    {24, 5, 1, 568},
+    {2046, 0, 3, 1},
+    {762, 2, 2, 2},
+    {20, 3, 9, 571},
+    {62, 3, 0, 582},
+    {40333, 1, 0, 574},
+    {2743, 0, 15, 2},
+    {51814, 1, 2, 4},
+    {52, 3, 0, 578},
+    {46529, 1, 17, 577},
+    {2723, 0, 19, 2},
+    {42199, 1, 0, 580},
+    {22, 5, 7, 2},
+    {2748, 0, 2, 4},
+    {2589, 0, 19, 3},
+    {130, 2, 2, 2},
+    {76, 3, 19, 5},
+    {44, 3, 0, 588},
+    {41170, 1, 2, 2},
+    {14708, 1, 5, 587},
+    {1079, 2, 11, 1},
+    {2882, 0, 0, 591},
+    {2868, 0, 2, 4},
+    {19, 5, 15, 5},
+    {63462, 1, 2, 4},
+    {48, 3, 0, 594},
+    {2, 2, 11, 4},
+    {85, 3, 9, 595},
+    {18, 5, 7, 3},
+    {34, 3, 0, 644},
+    {500, 2, 2, 2},
+    {262627, 1, 0, 601},
+    {249, 2, 9, 600},
+    {29, 3, 15, 2},
+    {975203, 1, 0, 628},
+    {2356, 0, 9, 603},
+    {3232, 0, 0, 622},
+    {28, 3, 0, 613},
+    {26, 5, 0, 610},
+    {56, 2, 2, 4},
+    {47, 2, 2, 3},
+    {2751, 0, 13, 609},
+    {10, 3, 15, 4},
+    {5, 3, 0, 612},
+    {29, 5, 15, 5},
+    {423, 2, 19, 3},
+    {3094, 0, 2, 4},
+    {30, 3, 0, 619},
+    {2973, 0, 0, 618},
+    {2766, 0, 2, 4},
+    {2683, 0, 19, 2},
+    {34, 5, 11, 1},
+    {20, 5, 13, 620},
+    {2805, 0, 2, 2},
+    {34, 5, 15, 2},
+    {28, 3, 2, 4},
+    {751086, 1, 2, 2},
+    {3445, 0, 2, 2},
+    {7, 3, 9, 626},
+    {24, 3, 2, 2},
+    {340889, 1, 11, 4},
+    {496, 2, 2, 4},
+    {157, 2, 2, 2},
+    {32, 5, 0, 643},
+    {31, 5, 2, 3},
+    {1273654, 1, 9, 633},
+    {26, 5, 0, 639},
+    {1996, 0, 5, 635},
+    {78, 2, 13, 636},
+    {24, 3, 2, 2},
+    {23, 5, 2, 2},
+    {108, 2, 11, 3},
+    {2170, 0, 9, 640},
+    {87, 2, 9, 641},
+    {30, 5, 2, 3},
+    {20, 3, 7, 2},
+    {2025, 0, 7, 2},
+    {15, 5, 0, 657},
+    {12, 5, 0, 651},
+    {642, 2, 0, 649},
+    {11, 5, 2, 2},
+    {2806, 0, 15, 5},
+    {64, 3, 17, 650},
+    {10, 5, 19, 3},
+    {61, 3, 0, 655},
+    {53, 3, 13, 653},
+    {595397, 1, 2, 1},
+    {14, 5, 7, 3},
+    {2565, 0, 13, 656},
+    {67, 3, 19, 2},
+    {3, 2, 0, 677},
+    {2555, 0, 0, 671},
+    {65, 3, 0, 667},
+    {52, 3, 9, 661},
+    {123178, 1, 0, 666},
+    {58, 3, 2, 2},
+    {25, 5, 13, 664},
+    {57, 3, 9, 665},
+    {2217, 0, 7, 2},
+    {148152, 1, 19, 3},
+    {2526, 0, 2, 3},
+    {79, 3, 2, 3},
+    {30, 5, 2, 5},
+    {20, 5, 23, 4},
+    {3291, 0, 0, 674},
+    {49, 3, 2, 2},
+    {46, 3, 11, 3},
+    {185997, 1, 17, 675},
+    {76, 3, 2, 3},
+    {43, 3, 15, 2},
+    {21, 5, 0, 731},
+    {43, 3, 0, 698},
+    {35, 3, 0, 682},
+    {123, 2, 17, 681},
+    {3262, 0, 11, 1},
+    {2733, 0, 0, 685},
+    {1779, 2, 9, 684},
+    {2454, 0, 15, 2},
+    {2940, 0, 0, 690},
+    {18, 5, 13, 687},
+    {19, 5, 0, 689},
+    {31, 2, 15, 2},
+    {39, 3, 7, 2},
+    {392, 2, 0, 696},
+    {144378, 1, 9, 692},
+    {39, 3, 2, 3},
+    {3391, 0, 2, 3},
+    {82, 2, 2, 2},
+    {20, 5, 15, 2},
+    {17, 5, 9, 697},
+    {757487, 1, 15, 2},
+    {17, 5, 9, 699},
+    {92, 3, 0, 730},
+    {19, 5, 0, 719},
+    {18, 5, 0, 712},
+    {2691, 0, 9, 703},
+    {712792, 1, 2, 2},
+    {522733, 1, 2, 1},
+    {2692, 0, 5, 706},
+    {2850, 0, 0, 708},
+    {233, 2, 11, 3},
+    {69, 3, 0, 711},
+    {454, 2, 9, 710},
+    {284068, 1, 7, 2},
+    {79, 3, 15, 2},
+    {52, 3, 0, 717},
+    {47, 3, 0, 716},
+    {44, 3, 9, 715},
+    {709, 2, 15, 2},
+    {185, 2, 11, 1},
+    {470587, 1, 2, 2},
+    {58, 3, 11, 3},
+    {20, 5, 0, 728},
+    {793251, 1, 2, 2},
+    {201301, 1, 9, 722},
+    {2833, 0, 2, 2},
+    {2515, 0, 0, 727},
+    {31, 2, 13, 725},
+    {407078, 1, 2, 2},
+    {83, 3, 15, 2},
+    {1724, 2, 15, 1},
+    {2038, 0, 2, 2},
+    {1985, 0, 11, 3},
+    {3004, 0, 11, 1},
+    {97, 3, 0, 831},
+    {2984, 0, 0, 790},
+    {76, 3, 0, 762},
+    {4196, 2, 0, 761},
+    {490560, 1, 0, 748},
+    {22, 5, 9, 737},
+    {387422, 1, 0, 746},
+    {601, 2, 9, 739},
+    {2429, 0, 0, 743},
+    {2168, 0, 9, 741},
+    {225763, 1, 2, 1},
+    {29, 5, 11, 1},
+    {25, 5, 2, 2},
+    {24, 5, 2, 3},
+    {2717, 0, 11, 3},
+    {32, 2, 2, 2},
+    {2425, 0, 15, 2},
+    {54, 3, 9, 749},
+    {137, 2, 0, 757},
+    {2895, 0, 2, 1},
+    {90, 2, 0, 754},
+    {68, 3, 9, 753},
+    {2335, 0, 11, 1},
+    {1052054, 1, 0, 756},
+    {25, 5, 11, 4},
+    {22, 5, 7, 2},
+    {947221, 1, 0, 759},
+    {2895, 0, 11, 3},
+    {56, 3, 2, 2},
+    {2184, 2, 11, 1},
+    {2076, 0, 15, 2},
+    {37, 5, 0, 789},
+    {58, 2, 0, 768},
+    {26, 5, 2, 2},
+    {5, 2, 9, 766},
+    {93, 3, 5, 767},
+    {7, 2, 11, 1},
+    {2308, 0, 0, 782},
+    {89, 3, 0, 780},
+    {80, 3, 0, 774},
+    {78, 3, 5, 772},
+    {885, 2, 2, 2},
+    {2011, 0, 11, 1},
+    {2135, 0, 9, 775},
+    {633891, 1, 0, 779},
+    {26, 5, 2, 2},
+    {1110, 2, 5, 778},
+    {350672, 1, 11, 1},
+    {2163, 0, 15, 1},
+    {29, 5, 9, 781},
+    {90, 3, 11, 3},
+    {567, 2, 0, 785},
+    {393, 2, 9, 784},
+    {2703, 0, 15, 1},
+    {1334973, 1, 9, 786},
+    {92, 3, 2, 3},
+    {1563436, 1, 2, 2},
+    {29, 5, 11, 3},
+    {80, 3, 7, 2},
+    {795203, 1, 0, 821},
+    {35, 3, 0, 794},
+    {432, 2, 2, 1},
+    {123, 2, 19, 2},
+    {1928, 2, 0, 814},
+    {72, 2, 0, 797},
+    {72, 3, 11, 1},
+    {433631, 1, 0, 807},
+    {621, 2, 2, 2},
+    {106761, 1, 5, 800},
+    {278, 2, 9, 801},
+    {179531, 1, 9, 802},
+    {272768, 1, 5, 803},
+    {27, 5, 0, 806},
+    {24, 5, 2, 1},
+    {320049, 1, 7, 2},
+    {40, 5, 11, 1},
+    {197, 2, 2, 2},
+    {57, 3, 0, 810},
+    {468842, 1, 15, 2},
+    {64, 3, 0, 813},
+    {607582, 1, 2, 1},
+    {28, 5, 7, 2},
+    {3112, 0, 7, 2},
+    {43, 3, 13, 815},
+    {2917, 2, 0, 820},
+    {541754, 1, 9, 817},
+    {38, 5, 2, 2},
+    {3441, 0, 13, 819},
+    {28, 5, 11, 1},
+    {67, 3, 11, 1},
+    {61, 3, 2, 2},
+    {302, 2, 0, 827},
+    {39, 3, 9, 824},
+    {247, 2, 0, 826},
+    {28, 2, 11, 1},
+    {259, 2, 11, 1},
+    {40, 3, 9, 828},
+    {602, 2, 9, 829},
+    {877, 2, 13, 830},
+    {43, 3, 7, 2},
+    {3251, 0, 7, 2},
+    {1511, 2, 0, 955},
+    {18, 5, 0, 844},
+    {30, 3, 0, 841},
+    {6981, 0, 0, 840},
+    {16, 5, 2, 3},
+    {155, 2, 0, 839},
+    {25, 3, 11, 3},
+    {15, 5, 7, 2},
+    {42169, 1, 19, 5},
+    {15, 5, 2, 2},
+    {162913, 1, 9, 843},
+    {565404, 1, 15, 2},
+    {7260, 0, 0, 941},
+    {937845, 1, 0, 932},
+    {31, 3, 0, 914},
+    {444, 2, 0, 887},
+    {552870, 1, 2, 2},
+    {37, 2, 0, 866},
+    {6760, 0, 0, 864},
+    {13145, 1, 9, 852},
+    {13324, 1, 5, 853},
+    {19313, 1, 9, 854},
+    {19406, 1, 5, 855},
+    {17, 3, 9, 856},
+    {21, 3, 0, 862},
+    {25, 2, 2, 2},
+    {21778, 1, 9, 859},
+    {44904, 1, 0, 861},
+    {3889, 0, 11, 1},
+    {19, 2, 11, 1},
+    {43023, 1, 9, 863},
+    {49136, 1, 7, 2},
+    {2, 2, 2, 2},
+    {6891, 0, 15, 2},
+    {424, 2, 0, 886},
+    {381583, 1, 0, 885},
+    {41, 2, 0, 870},
+    {4582, 0, 7, 2},
+    {21, 3, 0, 881},
+    {4815, 0, 2, 2},
+    {4609, 0, 0, 880},
+    {376391, 1, 2, 1},
+    {280185, 1, 2, 2},
+    {87, 2, 0, 879},
+    {4378, 0, 2, 1},
+    {15, 3, 2, 2},
+    {4048, 0, 11, 1},
+    {325, 2, 11, 1},
+    {94, 2, 11, 1},
+    {29, 3, 9, 882},
+    {119, 2, 0, 884},
+    {30, 3, 7, 2},
+    {4095, 0, 7, 2},
+    {417, 2, 11, 1},
+    {384478, 1, 3, 2},
+    {3696, 0, 0, 889},
+    {3600, 0, 11, 3},
+    {681969, 1, 2, 2},
+    {424944, 1, 0, 897},
+    {15, 3, 9, 892},
+    {21, 3, 2, 2},
+    {5181, 0, 9, 894},
+    {120402, 1, 0, 896},
+    {5439, 0, 15, 2},
+    {38, 5, 7, 2},
+    {822, 2, 0, 903},
+    {3863, 0, 5, 899},
+    {535, 2, 9, 900},
+    {556, 2, 5, 901},
+    {434637, 1, 2, 2},
+    {31, 5, 7, 2},
+    {537565, 1, 0, 906},
+    {977, 2, 2, 2},
+    {5067, 0, 19, 2},
+    {1348, 2, 2, 2},
+    {29, 3, 2, 2},
+    {41, 5, 2, 3},
+    {32, 5, 0, 913},
+    {31, 5, 2, 1},
+    {20, 3, 2, 3},
+    {25, 5, 15, 2},
+    {5507, 0, 11, 3},
+    {712158, 1, 9, 915},
+    {45, 3, 9, 916},
+    {55, 3, 2, 2},
+    {152, 2, 0, 921},
+    {51, 3, 5, 919},
+    {29, 5, 5, 920},
+    {4271, 0, 7, 2},
+    {924408, 1, 2, 1},
+    {327, 2, 0, 930},
+    {268, 2, 0, 928},
+    {4252, 0, 9, 925},
+    {29, 5, 0, 927},
+    {5494, 0, 7, 2},
+    {37, 5, 11, 1},
+    {38, 5, 5, 929},
+    {40, 5, 11, 1},
+    {3915, 0, 2, 2},
+    {3829, 0, 11, 1},
+    {6, 2, 0, 935},
+    {3786, 0, 2, 2},
+    {26, 5, 15, 4},
+    {940896, 1, 5, 936},
+    {62, 3, 2, 2},
+    {40, 3, 9, 938},
+    {608, 2, 2, 2},
+    {4190, 0, 2, 2},
+    {52, 3, 7, 3},
+    {37721, 1, 0, 944},
+    {69, 3, 2, 2},
+    {18, 3, 11, 4},
+    {7262, 0, 17, 945},
+    {50842, 1, 0, 948},
+    {69, 2, 2, 2},
+    {30, 5, 7, 3},
+    {19, 5, 0, 950},
+    {7452, 0, 15, 2},
+    {19, 3, 5, 951},
+    {378081, 1, 0, 953},
+    {1000, 2, 11, 1},
+    {412114, 1, 2, 2},
+    {409744, 1, 11, 4},
+    {1051467, 1, 0, 1043},
+    {25, 5, 0, 982},
+    {30, 3, 0, 965},
+    {24, 3, 9, 959},
+    {2303, 2, 0, 963},
+    {27, 3, 0, 962},
+    {1622, 2, 11, 3},
+    {740826, 1, 11, 3},
+    {29, 3, 2, 1},
+    {2443, 2, 7, 2},
+    {1530, 2, 0, 967},
+    {3971, 0, 11, 3},
+    {22, 5, 0, 972},
+    {48, 3, 2, 2},
+    {5080, 0, 9, 970},
+    {20, 5, 13, 971},
+    {2251, 2, 11, 3},
+    {1731, 2, 0, 975},
+    {595537, 1, 9, 974},
+    {34, 3, 7, 3},
+    {234543, 1, 0, 978},
+    {24, 5, 9, 977},
+    {153405, 1, 15, 2},
+    {23, 5, 13, 979},
+    {24, 5, 0, 981},
+    {1866, 2, 11, 3},
+    {900994, 1, 11, 3},
+    {87248, 1, 0, 985},
+    {5739, 0, 2, 1},
+    {83252, 1, 11, 1},
+    {3915, 2, 0, 1037},
+    {35, 5, 0, 1012},
+    {5105, 0, 2, 2},
+    {81, 3, 0, 1010},
+    {27, 5, 9, 990},
+    {70, 3, 0, 1009},
+    {176417, 1, 13, 992},
+    {10, 3, 13, 993},
+    {22, 3, 9, 994},
+    {29, 5, 0, 1008},
+    {28, 5, 0, 1000},
+    {2568, 2, 2, 1},
+    {66, 3, 2, 1},
+    {33, 3, 9, 999},
+    {271412, 1, 11, 3},
+    {2022, 2, 0, 1003},
+    {1863, 2, 2, 1},
+    {456515, 1, 15, 2},
+    {4227, 0, 2, 2},
+    {3980, 0, 2, 3},
+    {2412, 2, 2, 2},
+    {2301, 2, 2, 3},
+    {752067, 1, 15, 2},
+    {23, 3, 15, 2},
+    {34, 5, 15, 2},
+    {84, 3, 9, 1011},
+    {4309, 0, 7, 2},
+    {415687, 1, 0, 1028},
+    {7523, 0, 2, 3},
+    {3605, 2, 0, 1027},
+    {37, 3, 0, 1021},
+    {41, 5, 0, 1020},
+    {246959, 1, 9, 1018},
+    {25, 3, 13, 1019},
+    {35, 3, 7, 2},
+    {44, 5, 7, 2},
+    {341512, 1, 9, 1022},
+    {1758, 2, 9, 1023},
+    {41, 5, 0, 1026},
+    {2107, 2, 5, 1025},
+    {6010, 0, 15, 1},
+    {44, 5, 11, 3},
+    {39, 5, 7, 2},
+    {32, 3, 2, 2},
+    {890013, 1, 0, 1036},
+    {37, 5, 9, 1031},
+    {40, 5, 2, 2},
+    {5402, 0, 2, 3},
+    {4268, 0, 0, 1035},
+    {649417, 1, 11, 3},
+    {579553, 1, 7, 2},
+    {40, 5, 15, 1},
+    {5410, 2, 2, 2},
+    {42, 5, 0, 1042},
+    {4485, 2, 0, 1041},
+    {4135, 0, 11, 3},
+    {4973, 2, 11, 3},
+    {58, 3, 7, 3},
+    {54, 3, 7, 2},
+    {65, 3, 0, 1263},
+    {35, 3, 0, 1154},
+    {55461, 1, 0, 1078},
+    {653, 2, 0, 1076},
+    {8728, 0, 0, 1052},
+    {23, 3, 17, 1050},
+    {2, 2, 2, 2},
+    {7891, 0, 11, 4},
+    {9156, 0, 9, 1053},
+    {15, 2, 9, 1054},
+    {36, 5, 0, 1073},
+    {53307, 1, 2, 3},
+    {9411, 0, 13, 1057},
+    {24, 3, 0, 1061},
+    {14, 3, 0, 1060},
+    {11754, 0, 7, 2},
+    {16, 3, 23, 3},
+    {21, 2, 5, 1062},
+    {28, 3, 0, 1069},
+    {34, 5, 0, 1068},
+    {27, 3, 0, 1067},
+    {9793, 0, 2, 2},
+    {25, 5, 11, 1},
+    {29, 5, 7, 2},
+    {9793, 0, 7, 3},
+    {24, 5, 9, 1070},
+    {33, 3, 2, 2},
+    {31, 5, 2, 2},
+    {31, 3, 7, 3},
+    {27107, 1, 13, 1074},
+    {52, 2, 13, 1075},
+    {35530, 1, 11, 5},
+    {10207, 0, 2, 4},
+    {1319, 2, 11, 3},
+    {1, 2, 0, 1107},
+    {13249, 0, 0, 1103},
+    {34, 3, 0, 1097},
+    {10915, 0, 9, 1082},
+    {81517, 1, 13, 1083},
+    {274744, 1, 0, 1085},
+    {11314, 0, 7, 2},
+    {11587, 0, 9, 1086},
+    {29, 5, 9, 1087},
+    {12694, 0, 2, 2},
+    {30, 3, 0, 1094},
+    {12227, 0, 2, 3},
+    {32, 5, 0, 1092},
+    {11891, 0, 15, 2},
+    {39, 5, 13, 1093},
+    {21, 3, 7, 3},
+    {12027, 0, 9, 1095},
+    {37, 5, 9, 1096},
+    {43, 5, 7, 2},
+    {186976, 1, 0, 1101},
+    {11212, 0, 2, 0},
+    {80407, 1, 2, 4},
+    {11156, 0, 15, 1},
+    {34, 5, 2, 2},
+    {12532, 0, 15, 1},
+    {34, 3, 2, 1},
+    {15573, 0, 2, 1},
+    {14486, 0, 2, 2},
+    {43, 5, 7, 2},
+    {1641, 2, 0, 1148},
+    {34, 5, 0, 1146},
+    {8238, 0, 0, 1120},
+    {388056, 1, 0, 1118},
+    {331319, 1, 2, 2},
+    {28, 3, 0, 1116},
+    {144, 2, 2, 2},
+    {23, 3, 2, 3},
+    {7898, 0, 15, 2},
+    {29, 5, 2, 2},
+    {24, 5, 11, 1},
+    {7728, 0, 2, 3},
+    {27, 5, 15, 2},
+    {139, 2, 0, 1129},
+    {10205, 0, 0, 1128},
+    {10, 2, 9, 1123},
+    {11, 2, 5, 1124},
+    {8512, 0, 2, 2},
+    {8475, 0, 2, 3},
+    {17, 2, 9, 1127},
+    {8395, 0, 7, 2},
+    {61422, 1, 15, 2},
+    {151, 2, 17, 1130},
+    {10353, 0, 0, 1144},
+    {240, 2, 0, 1136},
+    {9531, 0, 9, 1133},
+    {9884, 0, 2, 1},
+    {207, 2, 9, 1135},
+    {27, 5, 7, 2},
+    {666, 2, 0, 1143},
+    {455102, 1, 2, 3},
+    {29, 3, 0, 1141},
+    {9390, 0, 2, 2},
+    {18, 3, 15, 2},
+    {27, 5, 2, 2},
+    {449, 2, 11, 3},
+    {684, 2, 7, 2},
+    {388354, 1, 9, 1145},
+    {10480, 0, 11, 4},
+    {2, 2, 2, 2},
+    {20, 3, 7, 2},
+    {13624, 0, 0, 1152},
+    {243943, 1, 2, 2},
+    {19, 3, 5, 1151},
+    {2892, 2, 7, 2},
+    {22, 5, 9, 1153},
+    {29, 5, 3, 2},
+    {279, 2, 0, 1231},
+    {90333, 1, 0, 1186},
+    {53, 3, 0, 1185},
+    {48, 3, 0, 1176},
+    {10174, 0, 0, 1173},
+    {8055, 0, 9, 1160},
+    {8805, 0, 0, 1163},
+    {8676, 0, 17, 1162},
+    {31, 5, 15, 4},
+    {9091, 0, 0, 1166},
+    {8890, 0, 9, 1165},
+    {26, 5, 7, 3},
+    {9459, 0, 0, 1169},
+    {168, 2, 2, 3},
+    {41, 5, 19, 3},
+    {44, 3, 2, 4},
+    {41, 3, 2, 2},
+    {9508, 0, 9, 1172},
+    {24, 5, 19, 3},
+    {25, 5, 21, 1174},
+    {3, 2, 13, 1175},
+    {10387, 0, 19, 5},
+    {25, 5, 0, 1183},
+    {50, 3, 9, 1178},
+    {51, 3, 0, 1180},
+    {1, 2, 15, 1},
+    {28436, 1, 13, 1181},
+    {1, 2, 5, 1182},
+    {9190, 0, 15, 1},
+    {27, 5, 5, 1184},
+    {8749, 0, 7, 2},
+    {80, 2, 19, 2},
+    {7959, 0, 0, 1194},
+    {40, 3, 0, 1189},
+    {7860, 0, 11, 1},
+    {525886, 1, 2, 2},
+    {8, 2, 17, 1191},
+    {276112, 1, 2, 2},
+    {7773, 0, 2, 3},
+    {32, 5, 15, 4},
+    {10630, 0, 0, 1213},
+    {1, 2, 0, 1210},
+    {28, 5, 0, 1200},
+    {9442, 0, 17, 1198},
+    {53, 3, 21, 1199},
+    {26, 5, 19, 5},
+    {36, 5, 0, 1209},
+    {43, 3, 0, 1204},
+    {40, 3, 17, 1203},
+    {34, 5, 23, 4},
+    {9739, 0, 17, 1205},
+    {218640, 1, 13, 1206},
+    {58, 3, 2, 4},
+    {34, 5, 2, 3},
+    {271748, 1, 19, 5},
+    {51, 3, 15, 4},
+    {197, 2, 17, 1211},
+    {243270, 1, 13, 1212},
+    {434121, 1, 19, 3},
+    {119, 2, 0, 1228},
+    {252497, 1, 0, 1217},
+    {1, 2, 2, 4},
+    {10877, 0, 19, 2},
+    {44, 2, 2, 4},
+    {34, 5, 13, 1219},
+    {13659, 0, 2, 3},
+    {44, 5, 2, 4},
+    {37, 5, 0, 1223},
+    {43, 3, 19, 3},
+    {13020, 0, 2, 3},
+    {38, 5, 0, 1227},
+    {12255, 0, 2, 3},
+    {37, 3, 15, 4},
+    {51, 3, 19, 3},
+    {225, 2, 0, 1230},
+    {51, 3, 19, 2},
+    {38, 5, 19, 3},
+    {942, 2, 0, 1260},
+    {10209, 0, 0, 1252},
+    {8855, 0, 0, 1238},
+    {7659, 0, 17, 1235},
+    {37, 3, 0, 1237},
+    {363695, 1, 19, 2},
+    {20, 5, 15, 2},
+    {38, 3, 9, 1239},
+    {158705, 1, 0, 1248},
+    {9595, 0, 0, 1243},
+    {8999, 0, 13, 1242},
+    {27, 5, 7, 2},
+    {46, 3, 2, 2},
+    {9907, 0, 2, 4},
+    {35, 5, 2, 4},
+    {9755, 0, 13, 1247},
+    {27, 5, 19, 3},
+    {55, 3, 0, 1251},
+    {296515, 1, 17, 1250},
+    {9696, 0, 11, 4},
+    {30, 5, 15, 4},
+    {291557, 1, 2, 2},
+    {49, 3, 9, 1254},
+    {252680, 1, 2, 4},
+    {11547, 0, 2, 2},
+    {10751, 0, 9, 1257},
+    {34602, 1, 9, 1258},
+    {125133, 1, 17, 1259},
+    {54, 3, 19, 2},
+    {39, 3, 2, 2},
+    {38, 3, 9, 1262},
+    {36, 5, 7, 3},
+    {73, 3, 0, 1274},
+    {30, 5, 2, 2},
+    {84094, 1, 0, 1268},
+    {39171, 1, 9, 1267},
+    {70, 3, 11, 1},
+    {71, 3, 9, 1269},
+    {28, 5, 0, 1272},
+    {9427, 0, 9, 1271},
+    {10052, 0, 7, 2},
+    {8844, 0, 13, 1273},
+    {282, 2, 11, 3},
+    {42, 5, 9, 1275},
+    {82, 3, 9, 1276},
+    {130379, 1, 9, 1277},
+    {84, 3, 7, 3},
+    {2049, 0, 0, 2172},
+    {65, 3, 0, 1811},
+    {792223, 1, 0, 1581},
+    {297, 2, 0, 1480},
+    {983, 0, 0, 1314},
+    {652, 0, 0, 1307},
+    {225851, 1, 0, 1290},
+    {248, 2, 0, 1288},
+    {22, 5, 21, 1287},
+    {27, 5, 19, 5},
+    {85406, 1, 2, 5},
+    {22, 5, 23, 4},
+    {61, 3, 0, 1306},
+    {295, 0, 2, 4},
+    {56, 3, 0, 1304},
+    {771243, 1, 0, 1302},
+    {29, 3, 17, 1295},
+    {8, 2, 0, 1300},
+    {52, 3, 2, 3},
+    {4, 2, 2, 4},
+    {730680, 1, 13, 1299},
+    {24, 5, 19, 3},
+    {152, 0, 2, 2},
+    {21, 5, 19, 3},
+    {192, 0, 2, 3},
+    {26, 5, 19, 5},
+    {212, 0, 2, 4},
+    {27, 5, 23, 6},
+    {17, 5, 15, 2},
+    {34504, 1, 13, 1308},
+    {71362, 1, 0, 1311},
+    {23, 5, 2, 2},
+    {20, 5, 7, 3},
+    {30, 5, 2, 3},
+    {783, 0, 9, 1313},
+    {19, 5, 11, 3},
+    {49, 3, 0, 1432},
+    {17, 3, 0, 1323},
+    {13010, 1, 0, 1318},
+    {12069, 1, 23, 4},
+    {1310, 0, 5, 1319},
+    {16, 3, 0, 1321},
+    {26, 5, 19, 3},
+    {31, 5, 2, 2},
+    {20, 5, 11, 3},
+    {1805, 0, 0, 1408},
+    {27531, 1, 0, 1340},
+    {10551, 1, 0, 1331},
+    {28, 5, 21, 1327},
+    {32, 5, 0, 1330},
+    {41, 3, 2, 5},
+    {9675, 1, 23, 6},
+    {9873, 1, 23, 4},
+    {27489, 1, 2, 3},
+    {26941, 1, 2, 5},
+    {1621, 0, 2, 5},
+    {1135, 0, 0, 1337},
+    {42, 3, 21, 1336},
+    {1131, 0, 15, 5},
+    {32, 3, 2, 3},
+    {21, 5, 17, 1339},
+    {26, 5, 15, 2},
+    {57817, 1, 0, 1364},
+    {1390, 0, 25, 1342},
+    {1748, 0, 0, 1363},
+    {26, 3, 0, 1353},
+    {27, 5, 2, 5},
+    {18, 3, 0, 1349},
+    {266, 2, 0, 1348},
+    {1583, 0, 23, 6},
+    {24, 5, 23, 4},
+    {34956, 1, 0, 1352},
+    {65, 2, 21, 1351},
+    {74, 2, 27, 5},
+    {35459, 1, 27, 5},
+    {27, 3, 17, 1354},
+    {24, 5, 0, 1357},
+    {1690, 0, 2, 6},
+    {75, 2, 27, 4},
+    {26, 5, 0, 1360},
+    {25, 5, 21, 1359},
+    {99, 2, 27, 5},
+    {1669, 0, 2, 5},
+    {84, 2, 17, 1362},
+    {29, 5, 23, 4},
+    {1752, 0, 15, 5},
+    {27, 3, 0, 1367},
+    {21, 3, 17, 1366},
+    {1182, 0, 11, 3},
+    {24, 5, 0, 1378},
+    {49, 2, 0, 1376},
+    {21, 5, 0, 1371},
+    {20, 5, 23, 4},
+    {1058, 0, 13, 1372},
+    {41, 3, 0, 1374},
+    {35, 3, 23, 6},
+    {498514, 1, 25, 1375},
+    {1109, 0, 19, 5},
+    {38, 3, 13, 1377},
+    {197, 2, 11, 4},
+    {224, 2, 0, 1405},
+    {69079, 1, 17, 1380},
+    {43, 3, 2, 5},
+    {700804, 1, 0, 1404},
+    {1124, 0, 0, 1386},
+    {37, 3, 2, 4},
+    {29, 5, 2, 5},
+    {203808, 1, 19, 6},
+    {206776, 1, 21, 1387},
+    {71, 2, 0, 1394},
+    {1167, 0, 2, 5},
+    {1145, 0, 0, 1392},
+    {37, 3, 2, 5},
+    {1138, 0, 23, 4},
+    {28, 5, 2, 6},
+    {26, 5, 27, 4},
+    {28, 5, 21, 1395},
+    {1697, 0, 0, 1400},
+    {598895, 1, 0, 1398},
+    {36, 3, 19, 6},
+    {39, 3, 2, 4},
+    {36, 5, 23, 4},
+    {39, 5, 0, 1403},
+    {457666, 1, 2, 5},
+    {412572, 1, 23, 4},
+    {112, 2, 27, 5},
+    {1234, 0, 19, 2},
+    {1380, 0, 13, 1406},
+    {517263, 1, 2, 5},
+    {1591, 0, 19, 3},
+    {4267, 1, 21, 1409},
+    {10881, 1, 0, 1411},
+    {1950, 0, 23, 3},
+    {153, 2, 2, 4},
+    {59, 2, 0, 1429},
+    {44, 3, 2, 4},
+    {1835, 0, 17, 1415},
+    {2033, 0, 2, 4},
+    {12864, 1, 17, 1417},
+    {20, 3, 17, 1418},
+    {34, 3, 0, 1424},
+    {27, 3, 2, 5},
+    {1950, 0, 0, 1422},
+    {1, 2, 23, 4},
+    {26, 3, 17, 1423},
+    {1998, 0, 23, 4},
+    {42, 3, 0, 1428},
+    {1, 2, 2, 4},
+    {1897, 0, 21, 1427},
+    {31, 5, 19, 5},
+    {34, 5, 27, 4},
+    {1902, 0, 0, 1431},
+    {26, 5, 27, 5},
+    {35, 5, 23, 3},
+    {1213, 0, 0, 1436},
+    {61, 3, 0, 1435},
+    {37, 5, 19, 6},
+    {1145, 0, 7, 2},
+    {2, 2, 0, 1450},
+    {1466, 0, 0, 1440},
+    {1333, 0, 2, 2},
+    {24, 5, 15, 2},
+    {52, 3, 0, 1442},
+    {30, 5, 19, 5},
+    {1931, 0, 2, 4},
+    {46021, 1, 17, 1444},
+    {1700, 0, 2, 2},
+    {1599, 0, 9, 1446},
+    {1653, 0, 0, 1449},
+    {1635, 0, 2, 2},
+    {31, 5, 19, 3},
+    {28, 5, 15, 4},
+    {1396, 0, 21, 1451},
+    {1418, 0, 13, 1452},
+    {221303, 1, 0, 1462},
+    {58622, 1, 0, 1456},
+    {1688, 0, 21, 1455},
+    {32, 5, 27, 4},
+    {1430, 0, 0, 1458},
+    {21, 5, 19, 5},
+    {59, 3, 0, 1461},
+    {52, 3, 13, 1460},
+    {55, 3, 19, 2},
+    {19, 5, 7, 3},
+    {375844, 1, 21, 1463},
+    {717101, 1, 0, 1478},
+    {639581, 1, 0, 1477},
+    {1644, 0, 0, 1467},
+    {1516, 0, 19, 5},
+    {604413, 1, 0, 1476},
+    {18, 2, 0, 1475},
+    {532920, 1, 0, 1472},
+    {1817, 0, 13, 1471},
+    {30, 5, 19, 5},
+    {1820, 0, 0, 1474},
+    {29, 5, 11, 3},
+    {33, 5, 15, 2},
+    {455703, 1, 23, 3},
+    {30, 5, 19, 5},
+    {1741, 0, 15, 4},
+    {2001, 0, 21, 1479},
+    {35, 5, 23, 6},
+    {1447, 0, 0, 1534},
+    {1616, 2, 0, 1526},
+    {239, 0, 17, 1483},
+    {34, 5, 0, 1522},
+    {22, 3, 0, 1493},
+    {94022, 1, 17, 1486},
+    {551, 0, 17, 1487},
+    {1140, 0, 0, 1492},
+    {17, 5, 0, 1490},
+    {811, 0, 19, 2},
+    {112605, 1, 13, 1491},
+    {23, 5, 19, 3},
+    {31, 5, 11, 4},
+    {379, 2, 0, 1498},
+    {57, 3, 2, 3},
+    {362, 0, 25, 1496},
+    {339, 2, 2, 2},
+    {24, 5, 19, 5},
+    {422070, 1, 0, 1514},
+    {55, 3, 0, 1509},
+    {1351, 2, 2, 1},
+    {51, 3, 0, 1505},
+    {775, 2, 9, 1503},
+    {132140, 1, 9, 1504},
+    {23, 5, 11, 3},
+    {1355, 0, 2, 2},
+    {21, 5, 13, 1507},
+    {52, 3, 5, 1508},
+    {369, 0, 11, 4},
+    {142251, 1, 2, 2},
+    {1157, 0, 2, 2},
+    {689, 2, 2, 3},
+    {27, 5, 5, 1513},
+    {29, 5, 11, 1},
+    {449787, 1, 17, 1515},
+    {32, 3, 13, 1516},
+    {254, 0, 17, 1517},
+    {911, 0, 9, 1518},
+    {1385, 0, 2, 3},
+    {891, 2, 2, 4},
+    {23, 5, 2, 2},
+    {21, 5, 19, 3},
+    {58, 3, 0, 1525},
+    {1000, 2, 2, 3},
+    {80577, 1, 11, 4},
+    {37, 5, 7, 3},
+    {202393, 1, 0, 1531},
+    {2275, 2, 0, 1529},
+    {57, 3, 15, 1},
+    {39933, 1, 2, 2},
+    {609, 0, 23, 4},
+    {52, 3, 2, 4},
+    {576300, 1, 2, 4},
+    {1201, 0, 15, 4},
+    {21, 5, 0, 1543},
+    {1897, 0, 0, 1541},
+    {1543, 0, 0, 1538},
+    {42, 3, 19, 1},
+    {1617, 0, 13, 1539},
+    {1763, 0, 2, 3},
+    {52566, 1, 11, 6},
+    {17, 5, 21, 1542},
+    {2034, 0, 23, 6},
+    {39, 3, 0, 1564},
+    {1337, 2, 0, 1557},
+    {679982, 1, 2, 5},
+    {316, 2, 17, 1547},
+    {256815, 1, 0, 1550},
+    {2001, 0, 2, 2},
+    {179823, 1, 15, 4},
+    {1646, 0, 13, 1551},
+    {1210, 2, 2, 3},
+    {873, 2, 0, 1554},
+    {33, 5, 11, 3},
+    {24, 5, 5, 1555},
+    {28, 5, 2, 2},
+    {1767, 0, 15, 2},
+    {78590, 1, 0, 1560},
+    {29, 5, 2, 4},
+    {1777, 0, 27, 5},
+    {606930, 1, 2, 3},
+    {37, 5, 2, 4},
+    {309473, 1, 2, 4},
+    {32, 5, 19, 3},
+    {692689, 1, 0, 1575},
+    {830, 2, 0, 1571},
+    {408638, 1, 21, 1567},
+    {565176, 1, 13, 1568},
+    {51, 3, 0, 1570},
+    {1525, 0, 23, 4},
+    {32, 5, 15, 5},
+    {1907, 0, 17, 1572},
+    {1925, 0, 21, 1573},
+    {1518, 2, 17, 1574},
+    {66914, 1, 19, 5},
+    {53, 3, 0, 1579},
+    {712977, 1, 13, 1577},
+    {31, 5, 17, 1578},
+    {35, 5, 15, 4},
+    {711617, 1, 2, 3},
+    {28, 5, 11, 3},
+    {849979, 1, 0, 1594},
+    {44, 3, 0, 1590},
+    {1326, 0, 0, 1588},
+    {25, 2, 13, 1585},
+    {28, 5, 9, 1586},
+    {803622, 1, 9, 1587},
+    {25, 3, 11, 3},
+    {33, 5, 13, 1589},
+    {40, 5, 15, 4},
+    {6, 2, 21, 1591},
+    {63, 3, 2, 4},
+    {823232, 1, 13, 1593},
+    {28, 5, 19, 3},
+    {541, 0, 0, 1654},
+    {6937089, 1, 0, 1646},
+    {37, 5, 0, 1640},
+    {5104438, 1, 0, 1638},
+    {18, 5, 0, 1603},
+    {318, 2, 2, 4},
+    {133, 0, 0, 1602},
+    {89, 0, 15, 4},
+    {16, 5, 15, 5},
+    {3565316, 1, 2, 3},
+    {1168, 2, 0, 1624},
+    {2, 2, 17, 1606},
+    {360, 0, 0, 1621},
+    {1957886, 1, 0, 1614},
+    {15, 3, 0, 1611},
+    {247, 0, 2, 3},
+    {25, 5, 23, 4},
+    {20, 5, 2, 3},
+    {43, 3, 9, 1613},
+    {1044291, 1, 19, 3},
+    {32, 3, 13, 1615},
+    {204, 0, 13, 1616},
+    {62, 3, 0, 1620},
+    {59, 3, 2, 4},
+    {333, 0, 2, 3},
+    {33, 5, 23, 4},
+    {32, 5, 15, 5},
+    {900400, 1, 9, 1622},
+    {1707092, 1, 13, 1623},
+    {374, 0, 11, 5},
+    {2532714, 1, 0, 1630},
+    {483, 0, 17, 1626},
+    {25, 5, 0, 1629},
+    {23, 5, 2, 5},
+    {1819, 2, 19, 3},
+    {529, 0, 19, 3},
+    {3429822, 1, 0, 1636},
+    {2183, 2, 0, 1633},
+    {415, 0, 19, 3},
+    {33, 5, 2, 3},
+    {180, 0, 9, 1635},
+    {30, 5, 7, 2},
+    {31, 5, 2, 4},
+    {27, 5, 19, 3},
+    {44, 3, 2, 4},
+    {32, 5, 19, 5},
+    {44, 3, 13, 1641},
+    {60, 3, 0, 1643},
+    {3086391, 1, 19, 5},
+    {428, 0, 17, 1644},
+    {39, 5, 2, 5},
+    {61, 3, 23, 3},
+    {20392, 2, 2, 2},
+    {1400, 2, 0, 1650},
+    {36, 3, 2, 3},
+    {31, 5, 11, 4},
+    {10538, 2, 0, 1652},
+    {37, 5, 19, 3},
+    {24, 5, 21, 1653},
+    {28, 5, 19, 3},
+    {35, 3, 0, 1710},
+    {1406, 0, 0, 1687},
+    {26, 3, 0, 1676},
+    {904729, 1, 0, 1659},
+    {27, 5, 23, 4},
+    {24, 3, 0, 1673},
+    {1416, 2, 2, 3},
+    {417, 2, 0, 1664},
+    {3030567, 1, 2, 3},
+    {25, 5, 19, 3},
+    {30, 5, 0, 1670},
+    {1731466, 1, 0, 1667},
+    {1357, 0, 19, 2},
+    {14, 3, 9, 1668},
+    {2494933, 1, 13, 1669},
+    {24, 5, 15, 2},
+    {874, 0, 9, 1671},
+    {16, 3, 2, 3},
+    {2920352, 1, 11, 3},
+    {25, 3, 2, 2},
+    {1204, 0, 2, 3},
+    {928, 0, 15, 1},
+    {987855, 1, 13, 1677},
+    {1306, 0, 2, 3},
+    {945, 0, 0, 1682},
+    {698, 0, 9, 1680},
+    {898, 0, 2, 3},
+    {36, 5, 15, 4},
+    {1117, 0, 0, 1685},
+    {1038, 2, 2, 4},
+    {26, 5, 19, 3},
+    {28, 5, 2, 4},
+    {1159, 0, 15, 5},
+    {1274813, 1, 0, 1694},
+    {1959, 0, 2, 3},
+    {32, 3, 0, 1692},
+    {36, 5, 2, 4},
+    {1681, 0, 23, 4},
+    {1684, 0, 2, 4},
+    {32, 5, 19, 3},
+    {1305895, 1, 9, 1695},
+    {19, 3, 0, 1699},
+    {7, 3, 0, 1698},
+    {32, 5, 23, 4},
+    {1591, 0, 15, 4},
+    {1192, 2, 2, 4},
+    {22, 3, 13, 1701},
+    {2271668, 1, 2, 5},
+    {29, 3, 0, 1705},
+    {1624, 0, 17, 1704},
+    {1713, 0, 15, 4},
+    {1896, 0, 2, 4},
+    {1628837, 1, 2, 3},
+    {32, 3, 2, 3},
+    {35, 5, 2, 5},
+    {29, 5, 15, 4},
+    {169, 2, 0, 1725},
+    {1939, 0, 2, 3},
+    {892606, 1, 0, 1715},
+    {51, 3, 21, 1714},
+    {1331, 0, 15, 4},
+    {28, 5, 17, 1716},
+    {1169540, 1, 0, 1719},
+    {31, 5, 2, 5},
+    {1097203, 1, 19, 5},
+    {29, 5, 13, 1720},
+    {58, 3, 0, 1724},
+    {36, 5, 17, 1722},
+    {1446152, 1, 21, 1723},
+    {41, 5, 15, 4},
+    {1180, 0, 23, 4},
+    {1934, 0, 0, 1806},
+    {60, 3, 0, 1784},
+    {717, 0, 0, 1745},
+    {43, 3, 0, 1730},
+    {635, 0, 19, 3},
+    {35, 5, 2, 5},
+    {2351, 2, 0, 1742},
+    {622, 0, 17, 1733},
+    {1072, 2, 0, 1738},
+    {626, 0, 0, 1736},
+    {22, 5, 23, 4},
+    {29, 5, 2, 4},
+    {24, 5, 19, 5},
+    {56, 3, 0, 1740},
+    {30, 5, 15, 5},
+    {24, 5, 13, 1741},
+    {28, 5, 23, 4},
+    {27, 5, 2, 4},
+    {22, 5, 21, 1744},
+    {684, 0, 19, 3},
+    {38, 3, 0, 1753},
+    {1563, 0, 2, 4},
+    {814, 0, 0, 1749},
+    {28, 5, 15, 5},
+    {37, 3, 0, 1752},
+    {4085, 2, 2, 4},
+    {1597982, 1, 15, 4},
+    {1282, 0, 15, 4},
+    {1644059, 1, 2, 4},
+    {839, 2, 0, 1764},
+    {174, 2, 13, 1756},
+    {38, 5, 0, 1763},
+    {1444, 0, 17, 1758},
+    {26, 5, 0, 1761},
+    {44, 3, 13, 1760},
+    {288, 2, 15, 4},
+    {36, 5, 17, 1762},
+    {53, 3, 15, 4},
+    {1730, 0, 19, 5},
+    {962, 0, 21, 1765},
+    {51, 3, 0, 1774},
+    {39, 3, 13, 1767},
+    {1295156, 1, 0, 1773},
+    {1199048, 1, 0, 1770},
+    {1664, 0, 19, 3},
+    {1230870, 1, 13, 1771},
+    {1396, 0, 2, 5},
+    {25, 5, 15, 4},
+    {1167, 0, 15, 4},
+    {57, 3, 2, 4},
+    {8027, 2, 2, 4},
+    {1662, 0, 0, 1781},
+    {989855, 1, 17, 1778},
+    {54, 3, 2, 3},
+    {31, 5, 13, 1780},
+    {1579, 2, 15, 4},
+    {944390, 1, 13, 1782},
+    {1770, 0, 13, 1783},
+    {40, 5, 19, 3},
+    {992123, 1, 0, 1787},
+    {1178, 0, 9, 1786},
+    {27, 5, 15, 4},
+    {5344, 2, 0, 1803},
+    {1645, 0, 0, 1802},
+    {650, 2, 0, 1794},
+    {63, 3, 2, 3},
+    {61, 3, 2, 4},
+    {1176, 0, 2, 4},
+    {25, 5, 23, 3},
+    {34, 5, 0, 1801},
+    {4275, 2, 2, 4},
+    {2267448, 1, 0, 1799},
+    {1005, 2, 2, 3},
+    {1737735, 1, 15, 4},
+    {1369, 2, 17, 1800},
+    {33, 5, 15, 4},
+    {3368704, 1, 19, 3},
+    {1919, 0, 19, 3},
+    {1576, 0, 2, 4},
+    {1201, 0, 2, 5},
+    {28, 5, 23, 4},
+    {1955, 0, 0, 1808},
+    {1610393, 1, 11, 3},
+    {1581, 2, 2, 4},
+    {1207993, 1, 2, 3},
+    {2023, 0, 15, 5},
+    {441041, 1, 0, 1986},
+    {240, 0, 0, 1844},
+    {188561, 1, 0, 1819},
+    {68, 0, 13, 1815},
+    {21, 5, 2, 2},
+    {84, 3, 2, 2},
+    {19, 5, 2, 3},
+    {15, 5, 11, 1},
+    {175, 0, 0, 1825},
+    {17, 5, 17, 1821},
+    {25, 5, 2, 5},
+    {204, 2, 21, 1823},
+    {310056, 1, 17, 1824},
+    {154, 0, 23, 6},
+    {412, 2, 0, 1843},
+    {222378, 1, 0, 1830},
+    {213, 0, 21, 1828},
+    {21, 5, 17, 1829},
+    {24, 5, 23, 6},
+    {233703, 1, 0, 1833},
+    {21, 5, 9, 1832},
+    {23, 5, 15, 2},
+    {228, 0, 2, 3},
+    {282067, 1, 0, 1842},
+    {24, 5, 0, 1840},
+    {200, 0, 0, 1838},
+    {23, 5, 23, 4},
+    {205, 0, 2, 4},
+    {19, 5, 7, 2},
+    {28, 5, 2, 5},
+    {208, 0, 23, 6},
+    {188, 0, 11, 5},
+    {92, 3, 15, 2},
+    {1611, 2, 0, 1982},
+    {66, 3, 0, 1851},
+    {1186, 0, 0, 1848},
+    {877, 2, 11, 4},
+    {1457, 0, 2, 4},
+    {1362, 0, 21, 1850},
+    {39, 5, 23, 6},
+    {398, 0, 0, 1865},
+    {510, 2, 0, 1862},
+    {312818, 1, 2, 4},
+    {386, 2, 2, 2},
+    {335, 0, 0, 1860},
+    {260, 0, 9, 1857},
+    {25, 5, 2, 2},
+    {21, 5, 2, 3},
+    {19, 5, 15, 4},
+    {88, 3, 9, 1861},
+    {25, 5, 19, 5},
+    {243, 0, 13, 1863},
+    {75, 3, 2, 2},
+    {73, 3, 11, 3},
+    {558, 0, 0, 1912},
+    {76, 3, 0, 1868},
+    {18, 5, 15, 2},
+    {206319, 1, 0, 1882},
+    {274, 2, 0, 1871},
+    {99, 3, 7, 2},
+    {103600, 1, 9, 1872},
+    {537, 0, 0, 1881},
+    {196918, 1, 2, 3},
+    {189710, 1, 0, 1879},
+    {188611, 1, 0, 1878},
+    {428, 0, 2, 3},
+    {422, 0, 15, 2},
+    {24, 5, 19, 3},
+    {93, 3, 9, 1880},
+    {616, 2, 15, 2},
+    {23, 5, 7, 3},
+    {517, 0, 0, 1903},
+    {398, 2, 0, 1888},
+    {443, 0, 0, 1886},
+    {19, 5, 15, 2},
+    {21, 5, 2, 3},
+    {19, 5, 15, 2},
+    {407, 0, 5, 1889},
+    {99, 3, 2, 2},
+    {20, 5, 0, 1894},
+    {483, 0, 2, 3},
+    {297909, 1, 5, 1893},
+    {1199, 2, 11, 1},
+    {434, 0, 0, 1896},
+    {98, 3, 11, 3},
+    {98, 3, 0, 1899},
+    {502, 0, 2, 2},
+    {27, 5, 15, 2},
+    {1261, 2, 0, 1902},
+    {23, 5, 2, 3},
+    {1218, 2, 11, 3},
+    {21, 5, 7, 2},
+    {372, 2, 0, 1906},
+    {257091, 1, 9, 1905},
+    {21, 5, 15, 2},
+    {99, 3, 2, 3},
+    {24, 5, 0, 1910},
+    {319106, 1, 5, 1909},
+    {21, 5, 11, 3},
+    {98, 3, 13, 1911},
+    {259523, 1, 15, 2},
+    {899, 2, 0, 1976},
+    {71, 3, 0, 1933},
+    {1423, 0, 0, 1922},
+    {1166, 0, 0, 1920},
+    {954, 0, 2, 2},
+    {135949, 1, 2, 3},
+    {21, 5, 2, 2},
+    {860, 0, 15, 4},
+    {1345, 0, 21, 1921},
+    {28, 5, 23, 4},
+    {31, 5, 0, 1930},
+    {25, 5, 2, 3},
+    {1, 2, 9, 1925},
+    {19, 5, 13, 1926},
+    {23, 5, 2, 3},
+    {22, 5, 2, 2},
+    {21, 5, 2, 3},
+    {1832, 0, 11, 3},
+    {70, 3, 2, 3},
+    {33, 5, 2, 1},
+    {1820, 0, 7, 3},
+    {205049, 1, 0, 1958},
+    {134013, 1, 2, 2},
+    {1446, 0, 0, 1949},
+    {121599, 1, 0, 1948},
+    {69, 2, 9, 1938},
+    {952, 0, 2, 3},
+    {80, 3, 2, 2},
+    {62023, 1, 0, 1944},
+    {882, 0, 9, 1942},
+    {21, 5, 5, 1943},
+    {891, 0, 7, 2},
+    {78, 2, 0, 1946},
+    {21, 5, 7, 2},
+    {22, 5, 2, 1},
+    {15, 5, 15, 2},
+    {82, 3, 15, 1},
+    {75, 3, 17, 1950},
+    {1912, 0, 2, 2},
+    {10591, 1, 0, 1957},
+    {1880, 0, 0, 1955},
+    {26, 2, 13, 1954},
+    {20, 5, 19, 3},
+    {21, 5, 9, 1956},
+    {23, 5, 15, 2},
+    {1711, 0, 11, 1},
+    {256377, 1, 0, 1960},
+    {98, 3, 11, 5},
+    {76, 3, 21, 1961},
+    {156, 2, 0, 1970},
+    {44, 2, 5, 1963},
+    {809, 0, 0, 1968},
+    {86, 3, 2, 2},
+    {371331, 1, 0, 1967},
+    {19, 5, 15, 2},
+    {24, 5, 11, 3},
+    {310118, 1, 9, 1969},
+    {28, 5, 23, 4},
+    {728, 0, 13, 1971},
+    {334983, 1, 9, 1972},
+    {357518, 1, 13, 1973},
+    {382724, 1, 9, 1974},
+    {1357, 0, 2, 3},
+    {21, 5, 11, 3},
+    {235593, 1, 0, 1980},
+    {96, 3, 2, 2},
+    {36, 5, 2, 2},
+    {210336, 1, 19, 3},
+    {262844, 1, 2, 3},
+    {1197, 0, 11, 3},
+    {98, 3, 13, 1983},
+    {284328, 1, 9, 1984},
+    {443, 0, 2, 3},
+    {21, 5, 7, 2},
+    {1830, 0, 0, 2167},
+    {353, 2, 0, 2027},
+    {92, 3, 0, 2023},
+    {1295, 0, 0, 2022},
+    {336, 0, 0, 2006},
+    {88, 2, 0, 1994},
+    {305, 0, 2, 3},
+    {26, 5, 19, 3},
+    {216, 2, 0, 1998},
+    {215, 0, 9, 1996},
+    {320, 0, 2, 1},
+    {23, 5, 11, 1},
+    {238, 2, 0, 2001},
+    {195, 0, 2, 4},
+    {23, 5, 15, 2},
+    {28, 5, 2, 3},
+    {309, 0, 0, 2005},
+    {26, 5, 2, 2},
+    {24, 5, 11, 1},
+    {22, 5, 15, 2},
+    {798521, 1, 0, 2019},
+    {367, 0, 0, 2010},
+    {591553, 1, 17, 2009},
+    {24, 5, 19, 3},
+    {616, 0, 0, 2013},
+    {86, 3, 9, 2012},
+    {20, 5, 11, 3},
+    {91, 2, 5, 2014},
+    {1050, 0, 2, 2},
+    {188, 2, 2, 4},
+    {803, 0, 0, 2018},
+    {17, 5, 19, 2},
+    {24, 5, 11, 4},
+    {138, 2, 13, 2020},
+    {481, 0, 17, 2021},
+    {28, 5, 23, 4},
+    {744442, 1, 15, 4},
+    {1044, 0, 2, 4},
+    {35, 5, 2, 5},
+    {934, 0, 17, 2026},
+    {31, 5, 15, 5},
+    {2148163, 1, 0, 2111},
+    {514288, 1, 0, 2043},
+    {435, 0, 0, 2035},
+    {265, 0, 13, 2031},
+    {99, 3, 0, 2033},
+    {18, 5, 7, 2},
+    {420, 0, 13, 2034},
+    {20, 5, 15, 2},
+    {955, 2, 0, 2041},
+    {460213, 1, 13, 2037},
+    {27, 5, 2, 2},
+    {1021, 0, 2, 3},
+    {451, 0, 9, 2040},
+    {22, 5, 19, 3},
+    {503900, 1, 13, 2042},
+    {3189, 2, 11, 3},
+    {95, 3, 0, 2108},
+    {2037651, 1, 2, 3},
+    {1139, 2, 0, 2077},
+    {1130, 2, 0, 2075},
+    {20, 5, 0, 2057},
+    {17, 5, 0, 2050},
+    {1469739, 1, 19, 3},
+    {18, 5, 13, 2051},
+    {351, 0, 0, 2053},
+    {862021, 1, 11, 3},
+    {366, 0, 17, 2054},
+    {19, 5, 0, 2056},
+    {627, 2, 19, 3},
+    {390, 0, 19, 3},
+    {75, 3, 0, 2065},
+    {812375, 1, 0, 2060},
+    {25, 5, 15, 2},
+    {836, 2, 0, 2064},
+    {149, 0, 9, 2062},
+    {1915734, 1, 13, 2063},
+    {1965317, 1, 11, 3},
+    {929, 2, 11, 3},
+    {1737, 0, 2, 4},
+    {85, 3, 13, 2067},
+    {683, 2, 0, 2071},
+    {384, 0, 2, 3},
+    {710293, 1, 2, 4},
+    {25, 5, 15, 4},
+    {663175, 1, 0, 2073},
+    {291, 0, 11, 3},
+    {27, 5, 13, 2074},
+    {1028, 2, 19, 2},
+    {1138, 2, 17, 2076},
+    {27, 5, 19, 3},
+    {88, 3, 0, 2102},
+    {678, 0, 0, 2082},
+    {849740, 1, 2, 3},
+    {71, 3, 2, 3},
+    {26, 5, 11, 1},
+    {69, 3, 0, 2088},
+    {729496, 1, 13, 2084},
+    {1675, 0, 0, 2087},
+    {25, 5, 9, 2086},
+    {29, 5, 15, 2},
+    {24, 5, 7, 3},
+    {1611, 0, 0, 2100},
+    {1355, 0, 0, 2094},
+    {70, 3, 0, 2092},
+    {19, 5, 15, 4},
+    {1237, 0, 13, 2093},
+    {33, 5, 19, 3},
+    {1409, 0, 0, 2097},
+    {29, 5, 2, 2},
+    {26, 5, 11, 3},
+    {74, 3, 9, 2098},
+    {78, 3, 2, 3},
+    {31, 5, 19, 3},
+    {1757, 0, 13, 2101},
+    {33, 5, 19, 2},
+    {1241610, 1, 9, 2103},
+    {90, 3, 9, 2104},
+    {92, 3, 0, 2107},
+    {28, 5, 13, 2106},
+    {33, 5, 19, 3},
+    {28, 5, 19, 3},
+    {1526, 0, 13, 2109},
+    {1658, 0, 9, 2110},
+    {26, 5, 15, 2},
+    {12615265, 1, 0, 2162},
+    {23, 5, 0, 2122},
+    {20, 5, 13, 2114},
+    {21, 5, 0, 2119},
+    {68, 3, 5, 2116},
+    {1872, 2, 13, 2117},
+    {83, 3, 2, 2},
+    {6060, 2, 11, 3},
+    {1550, 0, 2, 1},
+    {1153, 0, 2, 3},
+    {1009, 0, 15, 2},
+    {39, 5, 2, 3},
+    {537, 0, 0, 2142},
+    {98, 3, 2, 2},
+    {93, 3, 0, 2141},
+    {66, 3, 17, 2127},
+    {89, 3, 2, 3},
+    {88, 3, 2, 4},
+    {3437, 2, 0, 2134},
+    {259, 0, 0, 2132},
+    {30, 5, 11, 3},
+    {263, 0, 9, 2133},
+    {694, 2, 11, 3},
+    {20840, 2, 2, 2},
+    {144, 0, 0, 2137},
+    {111, 0, 19, 2},
+    {35, 5, 2, 3},
+    {241, 0, 13, 2139},
+    {2896064, 1, 17, 2140},
+    {32, 5, 19, 3},
+    {1057, 2, 11, 4},
+    {32, 5, 0, 2157},
+    {88, 3, 0, 2154},
+    {1561, 0, 2, 2},
+    {1522, 0, 2, 3},
+    {1084, 2, 0, 2149},
+    {27, 5, 13, 2148},
+    {29, 5, 11, 3},
+    {1320, 2, 0, 2152},
+    {921, 0, 17, 2151},
+    {86, 3, 15, 4},
+    {84, 3, 9, 2153},
+    {6908, 2, 15, 2},
+    {31, 5, 0, 2156},
+    {3806206, 1, 19, 3},
+    {981, 0, 15, 2},
+    {4544, 2, 2, 3},
+    {2858237, 1, 2, 4},
+    {928, 2, 13, 2160},
+    {2535895, 1, 17, 2161},
+    {37, 5, 11, 3},
+    {16056182, 1, 17, 2163},
+    {45, 0, 0, 2165},
+    {23, 5, 19, 3},
+    {27, 5, 2, 4},
+    {103, 0, 11, 3},
+    {3955, 2, 2, 3},
+    {855544, 1, 0, 2171},
+    {1846, 0, 17, 2170},
+    {90, 3, 15, 4},
+    {1981, 0, 19, 3},
+    {5119, 1, 0, 2222},
+    {543, 2, 2, 4},
+    {27, 3, 0, 2208},
+    {7293, 0, 0, 2178},
+    {6248, 0, 17, 2177},
+    {21, 5, 15, 6},
+    {10912, 0, 2, 5},
+    {8524, 0, 0, 2205},
+    {26, 5, 0, 2191},
+    {24, 3, 2, 5},
+    {8276, 0, 0, 2188},
+    {5, 2, 2, 6},
+    {14, 3, 21, 2185},
+    {20, 3, 2, 5},
+    {22, 5, 2, 6},
+    {20, 5, 27, 5},
+    {18, 3, 2, 6},
+    {2670, 1, 2, 5},
+    {8345, 0, 19, 5},
+    {12, 3, 0, 2193},
+    {32, 5, 27, 4},
+    {42, 5, 0, 2204},
+    {27, 5, 0, 2196},
+    {3514, 1, 19, 5},
+    {34, 5, 0, 2203},
+    {26, 3, 0, 2202},
+    {31, 5, 21, 2199},
+    {11, 2, 2, 4},
+    {23, 3, 2, 5},
+    {8269, 0, 27, 5},
+    {3164, 1, 23, 4},
+    {22, 3, 19, 5},
+    {13, 2, 23, 6},
+    {8652, 0, 2, 4},
+    {34, 5, 2, 4},
+    {8623, 0, 23, 6},
+    {43, 3, 0, 2219},
+    {50, 2, 2, 4},
+    {36, 2, 2, 5},
+    {3, 2, 2, 4},
+    {1267, 1, 17, 2213},
+    {9916, 0, 2, 5},
+    {39, 5, 2, 5},
+    {31, 3, 0, 2217},
+    {29, 3, 19, 5},
+    {2907, 1, 13, 2218},
+    {9822, 0, 19, 3},
+    {71, 3, 0, 2221},
+    {1117, 1, 15, 5},
+    {6443, 0, 15, 4},
+    {7547, 0, 0, 3485},
+    {3463, 0, 0, 2895},
+    {69405, 1, 0, 2311},
+    {35330, 1, 0, 2241},
+    {2644, 0, 0, 2231},
+    {21, 5, 0, 2229},
+    {213, 2, 23, 4},
+    {27118, 1, 17, 2230},
+    {28, 5, 23, 4},
+    {29120, 1, 2, 4},
+    {28, 5, 0, 2238},
+    {14, 5, 5, 2234},
+    {16024, 1, 0, 2237},
+    {3214, 0, 2, 4},
+    {173, 2, 15, 4},
+    {27030, 1, 15, 4},
+    {28545, 1, 2, 2},
+    {1, 2, 17, 2240},
+    {2, 2, 11, 4},
+    {47, 3, 0, 2259},
+    {2240, 0, 0, 2249},
+    {2163, 0, 0, 2248},
+    {46204, 1, 0, 2246},
+    {26, 5, 7, 2},
+    {2102, 0, 2, 4},
+    {20, 5, 23, 4},
+    {32, 5, 27, 3},
+    {45841, 1, 17, 2250},
+    {2911, 0, 0, 2257},
+    {54377, 1, 13, 2252},
+    {29, 5, 2, 4},
+    {17, 3, 2, 4},
+    {2804, 0, 2, 3},
+    {27, 5, 17, 2256},
+    {63777, 1, 19, 3},
+    {2949, 0, 13, 2258},
+    {29, 5, 23, 3},
+    {106, 2, 0, 2291},
+    {2830, 0, 0, 2283},
+    {64263, 1, 0, 2276},
+    {53, 3, 0, 2265},
+    {40572, 1, 2, 5},
+    {2734, 0, 23, 4},
+    {42663, 1, 0, 2267},
+    {56, 3, 11, 5},
+    {28, 5, 2, 5},
+    {2536, 0, 21, 2269},
+    {2596, 0, 0, 2272},
+    {25, 5, 2, 4},
+    {48386, 1, 19, 5},
+    {32, 2, 2, 5},
+    {2689, 0, 2, 4},
+    {1, 2, 17, 2275},
+    {27, 5, 23, 4},
+    {2666, 0, 2, 4},
+    {25, 5, 21, 2278},
+    {46, 2, 2, 5},
+    {30, 2, 2, 4},
+    {65601, 1, 2, 5},
+    {2298, 0, 2, 4},
+    {32, 5, 23, 4},
+    {3358, 0, 2, 5},
+    {1, 2, 17, 2285},
+    {60119, 1, 2, 5},
+    {50, 3, 0, 2289},
+    {3220, 0, 2, 4},
+    {27, 5, 19, 5},
+    {30, 5, 2, 4},
+    {24, 5, 19, 3},
+    {2293, 0, 0, 2294},
+    {2117, 0, 13, 2293},
+    {29, 5, 15, 4},
+    {112, 2, 0, 2297},
+    {2653, 0, 13, 2296},
+    {29, 5, 19, 2},
+    {670, 2, 0, 2307},
+    {30, 5, 2, 4},
+    {3366, 0, 2, 4},
+    {2846, 0, 2, 5},
+    {138, 2, 21, 2302},
+    {24, 5, 0, 2305},
+    {21, 5, 2, 5},
+    {19, 5, 23, 6},
+    {2608, 0, 17, 2306},
+    {26, 5, 19, 6},
+    {858, 2, 17, 2308},
+    {35, 5, 17, 2309},
+    {53477, 1, 2, 2},
+    {42, 5, 23, 3},
+    {35, 3, 0, 2444},
+    {424, 2, 0, 2393},
+    {296050, 1, 0, 2339},
+    {379, 2, 0, 2338},
+    {3308, 0, 2, 3},
+    {34, 3, 0, 2337},
+    {104144, 1, 0, 2324},
+    {3023, 0, 0, 2323},
+    {69916, 1, 17, 2320},
+    {72867, 1, 2, 4},
+    {32, 5, 13, 2322},
+    {34, 5, 23, 3},
+    {33, 5, 15, 5},
+    {2792, 0, 0, 2329},
+    {2464, 0, 21, 2326},
+    {2701, 0, 17, 2327},
+    {2704, 0, 21, 2328},
+    {2765, 0, 19, 5},
+    {30, 3, 2, 4},
+    {4, 3, 0, 2332},
+    {3078, 0, 23, 4},
+    {3178, 0, 2, 4},
+    {3042, 0, 17, 2334},
+    {39, 5, 2, 5},
+    {19, 3, 13, 2336},
+    {30, 5, 19, 3},
+    {2736, 0, 23, 4},
+    {2586, 0, 15, 4},
+    {758085, 1, 0, 2372},
+    {31, 3, 0, 2364},
+    {349636, 1, 0, 2344},
+    {335836, 1, 2, 4},
+    {203, 2, 23, 4},
+    {16, 3, 0, 2346},
+    {731859, 1, 23, 4},
+    {373, 2, 2, 4},
+    {17, 3, 0, 2354},
+    {3094, 0, 0, 2351},
+    {2883, 0, 2, 5},
+    {33, 5, 23, 4},
+    {3135, 0, 13, 2352},
+    {32, 5, 2, 5},
+    {27, 5, 23, 4},
+    {2468, 0, 17, 2355},
+    {44, 5, 2, 4},
+    {596793, 1, 0, 2359},
+    {27, 3, 21, 2358},
+    {13, 2, 19, 5},
+    {30, 3, 2, 6},
+    {722818, 1, 21, 2361},
+    {2911, 0, 0, 2363},
+    {27, 5, 27, 5},
+    {29, 5, 23, 6},
+    {7, 2, 13, 2365},
+    {216, 2, 2, 4},
+    {2664, 0, 17, 2367},
+    {318911, 1, 0, 2370},
+    {2849, 0, 2, 4},
+    {27, 5, 19, 5},
+    {27, 5, 2, 5},
+    {24, 5, 23, 4},
+    {1063191, 1, 0, 2384},
+    {143, 2, 0, 2377},
+    {786576, 1, 13, 2375},
+    {1008889, 1, 17, 2376},
+    {27, 5, 19, 5},
+    {34, 3, 2, 4},
+    {31, 3, 2, 5},
+    {30, 3, 0, 2383},
+    {197, 2, 17, 2381},
+    {24, 3, 21, 2382},
+    {28, 3, 19, 5},
+    {25, 5, 19, 3},
+    {28, 5, 2, 4},
+    {24, 5, 17, 2386},
+    {2499, 0, 0, 2392},
+    {1745609, 1, 0, 2390},
+    {21, 3, 21, 2389},
+    {1715169, 1, 19, 5},
+    {25, 5, 17, 2391},
+    {2153, 0, 19, 3},
+    {2968, 0, 15, 4},
+    {1588, 2, 0, 2414},
+    {26, 5, 0, 2405},
+    {229196, 1, 13, 2396},
+    {2245, 0, 17, 2397},
+    {725, 2, 17, 2398},
+    {22, 5, 0, 2400},
+    {1107, 2, 19, 3},
+    {25, 5, 0, 2404},
+    {2474, 0, 17, 2402},
+    {2673, 0, 13, 2403},
+    {26, 3, 15, 4},
+    {275502, 1, 19, 3},
+    {14, 3, 0, 2407},
+    {8, 3, 23, 4},
+    {848634, 1, 2, 4},
+    {141230, 1, 0, 2413},
+    {25, 3, 2, 3},
+    {31, 5, 17, 2411},
+    {76648, 1, 13, 2412},
+    {34, 5, 15, 4},
+    {15, 3, 15, 4},
+    {3353, 2, 0, 2441},
+    {349013, 1, 0, 2422},
+    {303707, 1, 2, 3},
+    {3062, 0, 2, 5},
+    {2631, 0, 0, 2421},
+    {33, 5, 2, 5},
+    {25, 5, 15, 4},
+    {40, 5, 15, 4},
+    {2790, 0, 0, 2430},
+    {2747, 0, 2, 5},
+    {33, 3, 2, 4},
+    {15, 3, 17, 2426},
+    {1587059, 1, 2, 5},
+    {30, 3, 0, 2429},
+    {21, 3, 23, 4},
+    {2665, 0, 23, 4},
+    {633222, 1, 0, 2432},
+    {3352, 0, 19, 5},
+    {22, 3, 0, 2436},
+    {21, 3, 0, 2435},
+    {16, 3, 15, 4},
+    {33, 5, 11, 3},
+    {2333, 2, 13, 2437},
+    {37, 5, 0, 2439},
+    {33, 5, 15, 4},
+    {41, 5, 13, 2440},
+    {45, 5, 19, 5},
+    {2284, 0, 2, 4},
+    {2200, 0, 2, 3},
+    {31, 5, 11, 3},
+    {72, 3, 0, 2748},
+    {1065053, 1, 0, 2683},
+    {179, 2, 0, 2582},
+    {754993, 1, 0, 2560},
+    {2342, 0, 0, 2482},
+    {1, 2, 0, 2458},
+    {65, 3, 17, 2451},
+    {70, 3, 2, 5},
+    {103327, 1, 0, 2455},
+    {2271, 0, 2, 4},
+    {35, 5, 23, 4},
+    {30, 5, 17, 2456},
+    {32, 5, 21, 2457},
+    {39, 5, 19, 5},
+    {128, 2, 2, 4},
+    {2283, 0, 0, 2479},
+    {462748, 1, 0, 2466},
+    {402382, 1, 2, 5},
+    {124030, 1, 0, 2464},
+    {34, 5, 15, 4},
+    {36, 5, 13, 2465},
+    {37, 5, 19, 3},
+    {37, 5, 0, 2477},
+    {28, 5, 0, 2474},
+    {66, 3, 0, 2470},
+    {27, 5, 19, 3},
+    {67, 3, 13, 2471},
+    {2261, 0, 2, 3},
+    {25, 5, 21, 2473},
+    {710736, 1, 15, 5},
+    {717733, 1, 0, 2476},
+    {64, 2, 19, 3},
+    {35, 5, 15, 4},
+    {48, 3, 2, 4},
+    {41, 5, 15, 4},
+    {227147, 1, 17, 2480},
+    {29, 5, 2, 3},
+    {58, 3, 15, 4},
+    {392864, 1, 0, 2551},
+    {149, 2, 0, 2547},
+    {139, 2, 0, 2542},
+    {66, 3, 0, 2534},
+    {58, 3, 0, 2525},
+    {385405, 1, 0, 2524},
+    {90, 2, 0, 2511},
+    {3039, 0, 0, 2499},
+    {25, 2, 0, 2493},
+    {2406, 0, 2, 4},
+    {2395, 0, 19, 3},
+    {2659, 0, 17, 2494},
+    {45, 3, 0, 2497},
+    {23, 5, 2, 4},
+    {198142, 1, 15, 4},
+    {71, 2, 21, 2498},
+    {31, 5, 19, 3},
+    {265277, 1, 0, 2509},
+    {3335, 0, 0, 2508},
+    {33, 5, 0, 2507},
+    {36, 3, 21, 2503},
+    {3060, 0, 0, 2505},
+    {3047, 0, 23, 3},
+    {1, 2, 17, 2506},
+    {53, 3, 19, 5},
+    {47, 3, 15, 5},
+    {51, 3, 19, 3},
+    {363310, 1, 2, 4},
+    {39, 3, 19, 5},
+    {38, 3, 17, 2512},
+    {41, 3, 0, 2515},
+    {3059, 0, 2, 5},
+    {31, 5, 15, 5},
+    {2764, 0, 0, 2517},
+    {35, 5, 15, 5},
+    {112, 2, 0, 2522},
+    {162809, 1, 2, 4},
+    {33, 5, 2, 3},
+    {2900, 0, 17, 2521},
+    {27, 5, 15, 5},
+    {24, 5, 13, 2523},
+    {33, 5, 19, 3},
+    {3296, 0, 15, 5},
+    {2718, 0, 0, 2532},
+    {65, 3, 2, 4},
+    {2392, 0, 17, 2528},
+    {59, 3, 13, 2529},
+    {2462, 0, 17, 2530},
+    {267201, 1, 2, 3},
+    {2505, 0, 15, 4},
+    {1, 2, 17, 2533},
+    {207561, 1, 15, 4},
+    {3394, 0, 2, 3},
+    {2352, 0, 21, 2536},
+    {67, 3, 0, 2540},
+    {68, 2, 2, 4},
+    {2927, 0, 21, 2539},
+    {33, 5, 23, 4},
+    {2465, 0, 17, 2541},
+    {2484, 0, 23, 4},
+    {2956, 0, 0, 2545},
+    {134065, 1, 2, 3},
+    {31, 5, 15, 5},
+    {3144, 0, 2, 4},
+    {34, 5, 23, 4},
+    {51, 3, 2, 4},
+    {288717, 1, 0, 2550},
+    {32, 5, 19, 5},
+    {3078, 0, 11, 4},
+    {2362, 0, 0, 2553},
+    {2344, 0, 19, 2},
+    {3435, 0, 0, 2557},
+    {431747, 1, 2, 4},
+    {415474, 1, 17, 2556},
+    {44, 3, 15, 4},
+    {3442, 0, 9, 2558},
+    {3449, 0, 17, 2559},
+    {29, 5, 23, 4},
+    {39, 5, 2, 4},
+    {56, 3, 0, 2569},
+    {101, 2, 2, 4},
+    {45, 3, 0, 2566},
+    {41, 3, 17, 2565},
+    {3070, 0, 15, 4},
+    {65, 2, 0, 2568},
+    {34, 5, 19, 5},
+    {71, 2, 11, 5},
+    {35, 5, 0, 2573},
+    {3068, 0, 2, 3},
+    {57, 3, 13, 2572},
+    {70, 3, 19, 3},
+    {5, 2, 0, 2575},
+    {37, 5, 19, 5},
+    {36, 5, 0, 2577},
+    {2858, 0, 19, 2},
+    {3176, 0, 2, 1},
+    {1012510, 1, 2, 4},
+    {814463, 1, 13, 2580},
+    {885668, 1, 17, 2581},
+    {3117, 0, 15, 4},
+    {546070, 1, 0, 2638},
+    {2200, 0, 0, 2588},
+    {875, 2, 13, 2585},
+    {41, 3, 5, 2586},
+    {371448, 1, 2, 3},
+    {120240, 1, 15, 4},
+    {69, 3, 0, 2635},
+    {734, 2, 0, 2616},
+    {51, 3, 0, 2606},
+    {461025, 1, 2, 3},
+    {49, 3, 0, 2604},
+    {2736, 0, 0, 2599},
+    {2501, 0, 2, 4},
+    {2232, 0, 17, 2596},
+    {34, 5, 2, 3},
+    {28, 5, 13, 2598},
+    {2291, 0, 19, 2},
+    {28, 5, 0, 2601},
+    {48, 3, 15, 4},
+    {335, 2, 17, 2602},
+    {39, 3, 13, 2603},
+    {45, 3, 19, 3},
+    {205, 2, 17, 2605},
+    {2898, 0, 19, 3},
+    {586, 2, 2, 3},
+    {295, 2, 0, 2611},
+    {24, 5, 17, 2609},
+    {31, 5, 13, 2610},
+    {362456, 1, 15, 4},
+    {2669, 0, 2, 4},
+    {520, 2, 2, 4},
+    {58, 3, 2, 3},
+    {30, 5, 17, 2615},
+    {35, 5, 15, 4},
+    {417549, 1, 0, 2630},
+    {3799, 2, 0, 2627},
+    {37, 3, 0, 2620},
+    {2538, 0, 15, 2},
+    {46, 3, 17, 2621},
+    {47, 3, 13, 2622},
+    {90875, 1, 0, 2624},
+    {2737, 0, 11, 4},
+    {219748, 1, 0, 2626},
+    {208096, 1, 19, 3},
+    {225489, 1, 23, 4},
+    {402895, 1, 2, 4},
+    {35, 5, 2, 3},
+    {3053, 0, 15, 4},
+    {51, 3, 0, 2634},
+    {519250, 1, 2, 3},
+    {26, 5, 17, 2633},
+    {32, 5, 23, 4},
+    {42, 5, 15, 2},
+    {210996, 1, 2, 3},
+    {31, 5, 2, 4},
+    {27, 5, 15, 4},
+    {46, 5, 0, 2682},
+    {49, 3, 0, 2653},
+    {26, 5, 0, 2646},
+    {879449, 1, 17, 2642},
+    {920848, 1, 13, 2643},
+    {930811, 1, 17, 2644},
+    {24, 5, 13, 2645},
+    {1012572, 1, 15, 4},
+    {2855, 0, 2, 4},
+    {2795, 0, 2, 3},
+    {42, 3, 17, 2649},
+    {43, 3, 0, 2651},
+    {2521, 0, 15, 4},
+    {2146, 0, 13, 2652},
+    {1043673, 1, 19, 3},
+    {717108, 1, 0, 2662},
+    {256, 2, 17, 2655},
+    {3234, 0, 0, 2659},
+    {3204, 0, 2, 4},
+    {53, 3, 2, 4},
+    {50, 3, 19, 3},
+    {50, 3, 17, 2660},
+    {3461, 0, 2, 4},
+    {62, 3, 15, 4},
+    {3353, 0, 0, 2677},
+    {458, 2, 0, 2673},
+    {1007293, 1, 2, 3},
+    {42, 5, 2, 5},
+    {320, 2, 2, 3},
+    {192, 2, 13, 2668},
+    {3205, 0, 0, 2671},
+    {951112, 1, 17, 2670},
+    {2946, 0, 19, 3},
+    {3278, 0, 21, 2672},
+    {37, 5, 19, 3},
+    {2398, 0, 2, 4},
+    {955051, 1, 2, 4},
+    {58, 3, 2, 3},
+    {31, 5, 15, 4},
+    {40, 5, 2, 3},
+    {2076, 2, 17, 2679},
+    {971293, 1, 13, 2680},
+    {36, 5, 2, 4},
+    {30, 5, 19, 3},
+    {3432, 0, 19, 5},
+    {381, 2, 0, 2713},
+    {2503, 0, 0, 2706},
+    {2112, 0, 0, 2688},
+    {352, 2, 17, 2687},
+    {26, 5, 15, 2},
+    {54, 3, 0, 2703},
+    {53, 3, 2, 4},
+    {205, 2, 0, 2695},
+    {2144, 0, 13, 2692},
+    {1544629, 1, 2, 2},
+    {24, 5, 13, 2694},
+    {37, 5, 11, 3},
+    {40, 3, 17, 2696},
+    {32, 5, 0, 2700},
+    {51, 3, 2, 3},
+    {29, 5, 2, 2},
+    {46, 3, 15, 2},
+    {1242485, 1, 13, 2701},
+    {319, 2, 2, 4},
+    {36, 5, 15, 4},
+    {331, 2, 13, 2704},
+    {2337, 0, 2, 4},
+    {35, 5, 15, 4},
+    {1173015, 1, 17, 2707},
+    {39, 5, 2, 4},
+    {1261489, 1, 0, 2710},
+    {65, 3, 15, 4},
+    {2816, 0, 17, 2711},
+    {1268211, 1, 17, 2712},
+    {3229, 0, 15, 4},
+    {1084567, 1, 0, 2715},
+    {1074001, 1, 11, 4},
+    {20, 5, 0, 2717},
+    {1746298, 1, 23, 4},
+    {1140890, 1, 0, 2725},
+    {1138270, 1, 0, 2724},
+    {42, 3, 0, 2721},
+    {2567, 0, 19, 5},
+    {907, 2, 13, 2722},
+    {51, 3, 2, 3},
+    {27, 5, 15, 4},
+    {29, 5, 11, 1},
+    {54, 3, 0, 2740},
+    {2101, 0, 0, 2728},
+    {2063, 0, 19, 3},
+    {30, 5, 0, 2735},
+    {2644, 0, 2, 4},
+    {2557, 0, 2, 3},
+    {1421464, 1, 2, 4},
+    {1380851, 1, 2, 2},
+    {3369, 2, 2, 4},
+    {2231, 0, 19, 3},
+    {53, 3, 17, 2736},
+    {2253, 0, 17, 2737},
+    {3091, 0, 2, 3},
+    {2414, 0, 2, 5},
+    {38, 5, 19, 5},
+    {744, 2, 0, 2742},
+    {1232347, 1, 19, 3},
+    {2319, 0, 17, 2743},
+    {61, 3, 17, 2744},
+    {2563, 2, 2, 4},
+    {1350772, 1, 2, 3},
+    {3196, 0, 17, 2747},
+    {41, 5, 15, 4},
+    {2955, 0, 0, 2880},
+    {421136, 1, 0, 2812},
+    {79516, 1, 0, 2755},
+    {2335, 0, 2, 5},
+    {37, 5, 2, 5},
+    {2237, 0, 17, 2754},
+    {2324, 0, 23, 4},
+    {132377, 1, 0, 2758},
+    {126904, 1, 2, 5},
+    {416, 2, 19, 3},
+    {97, 3, 0, 2811},
+    {27, 5, 0, 2778},
+    {2976, 2, 2, 2},
+    {91, 3, 0, 2776},
+    {700, 2, 0, 2770},
+    {81, 3, 0, 2769},
+    {23, 5, 0, 2766},
+    {144, 2, 15, 4},
+    {25, 5, 0, 2768},
+    {287538, 1, 15, 4},
+    {78, 3, 19, 3},
+    {88, 3, 19, 5},
+    {82, 3, 13, 2771},
+    {252714, 1, 0, 2773},
+    {90, 3, 15, 4},
+    {274845, 1, 17, 2774},
+    {21, 5, 17, 2775},
+    {25, 5, 15, 4},
+    {2724, 0, 13, 2777},
+    {2791, 0, 19, 2},
+    {36, 5, 0, 2808},
+    {179999, 1, 0, 2799},
+    {158839, 1, 0, 2782},
+    {2, 2, 15, 4},
+    {2793, 0, 0, 2794},
+    {90, 3, 9, 2784},
+    {92, 3, 17, 2785},
+    {8, 2, 2, 3},
+    {95, 3, 2, 3},
+    {35, 5, 2, 4},
+    {33, 5, 2, 2},
+    {30, 5, 0, 2791},
+    {5, 2, 19, 3},
+    {31, 5, 2, 3},
+    {94, 3, 2, 4},
+    {2724, 0, 15, 2},
+    {34, 5, 0, 2797},
+    {93, 3, 2, 3},
+    {83, 3, 15, 2},
+    {94, 3, 13, 2798},
+    {169856, 1, 15, 4},
+    {391143, 1, 0, 2806},
+    {90, 3, 13, 2801},
+    {1085, 2, 2, 4},
+    {29, 5, 13, 2803},
+    {4, 2, 17, 2804},
+    {5, 2, 2, 3},
+    {33, 5, 15, 4},
+    {1267, 2, 2, 3},
+    {412792, 1, 19, 3},
+    {40, 5, 2, 3},
+    {39, 5, 13, 2810},
+    {2670, 0, 15, 4},
+    {32, 5, 11, 3},
+    {3039, 2, 0, 2878},
+    {96, 3, 0, 2856},
+    {88, 3, 0, 2845},
+    {2773, 0, 2, 4},
+    {796409, 1, 0, 2825},
+    {286, 2, 0, 2823},
+    {78, 3, 2, 4},
+    {27, 5, 2, 3},
+    {77, 3, 2, 3},
+    {22, 5, 13, 2822},
+    {690807, 1, 23, 4},
+    {76, 3, 17, 2824},
+    {2160, 0, 19, 3},
+    {73, 3, 13, 2826},
+    {613, 2, 0, 2829},
+    {2070, 0, 17, 2828},
+    {1111949, 1, 19, 3},
+    {907754, 1, 0, 2831},
+    {1290, 2, 19, 5},
+    {1091561, 1, 0, 2838},
+    {2095, 0, 17, 2833},
+    {2270, 0, 0, 2835},
+    {30, 5, 19, 3},
+    {31, 5, 2, 4},
+    {2512, 0, 13, 2837},
+    {24, 5, 15, 2},
+    {24, 5, 0, 2840},
+    {2421, 0, 11, 3},
+    {2572, 0, 0, 2843},
+    {81, 3, 17, 2842},
+    {1845, 2, 19, 3},
+    {32, 5, 2, 3},
+    {27, 5, 23, 4},
+    {2098, 0, 21, 2846},
+    {1529693, 1, 0, 2849},
+    {2822, 0, 17, 2848},
+    {2884, 0, 15, 4},
+    {35, 5, 2, 3},
+    {24, 5, 0, 2852},
+    {2474, 0, 15, 4},
+    {90, 3, 21, 2853},
+    {91, 3, 17, 2854},
+    {29, 5, 2, 5},
+    {26, 5, 23, 4},
+    {2120, 0, 0, 2858},
+    {24, 5, 15, 2},
+    {75, 2, 0, 2860},
+    {30, 5, 19, 5},
+    {97, 3, 0, 2863},
+    {2558, 0, 13, 2862},
+    {27, 5, 19, 3},
+    {2598, 0, 2, 3},
+    {27, 5, 0, 2869},
+    {99, 3, 0, 2868},
+    {97, 2, 13, 2867},
+    {98, 3, 15, 4},
+    {2205, 0, 19, 3},
+    {35, 5, 2, 4},
+    {98, 3, 0, 2873},
+    {595689, 1, 9, 2872},
+    {31, 5, 19, 3},
+    {99, 3, 0, 2877},
+    {28, 5, 17, 2875},
+    {2288, 0, 13, 2876},
+    {2562, 0, 19, 3},
+    {33, 5, 15, 4},
+    {2552, 0, 13, 2879},
+    {25, 5, 15, 4},
+    {220520, 1, 0, 2883},
+    {1, 2, 2, 4},
+    {30, 5, 27, 5},
+    {95, 3, 0, 2894},
+    {24, 5, 0, 2887},
+    {985, 2, 2, 4},
+    {87, 3, 15, 4},
+    {67, 2, 0, 2890},
+    {575060, 1, 2, 3},
+    {3343, 0, 19, 5},
+    {318172, 1, 2, 4},
+    {572, 2, 13, 2892},
+    {3234, 0, 17, 2893},
+    {33, 5, 19, 3},
+    {98, 3, 15, 4},
+    {6263, 0, 0, 3327},
+    {32, 3, 0, 2985},
+    {503, 2, 0, 2957},
+    {445663, 1, 2, 4},
+    {25, 3, 0, 2933},
+    {163, 2, 0, 2923},
+    {3981, 0, 0, 2909},
+    {28063, 1, 17, 2903},
+    {282805, 1, 2, 4},
+    {3847, 0, 17, 2905},
+    {8, 3, 17, 2906},
+    {3904, 0, 17, 2907},
+    {3967, 0, 13, 2908},
+    {30, 5, 15, 4},
+    {6144, 0, 0, 2922},
+    {47265, 1, 17, 2911},
+    {49049, 1, 21, 2912},
+    {71, 2, 2, 4},
+    {56, 2, 0, 2917},
+    {4315, 0, 2, 4},
+    {4265, 0, 17, 2916},
+    {4287, 0, 11, 4},
+    {4207, 0, 9, 2918},
+    {5517, 0, 2, 2},
+    {70, 2, 17, 2920},
+    {4490, 0, 17, 2921},
+    {4609, 0, 11, 4},
+    {6230, 0, 11, 4},
+    {3931, 0, 0, 2926},
+    {3831, 0, 17, 2925},
+    {398974, 1, 11, 4},
+    {174, 2, 0, 2930},
+    {4502, 0, 17, 2928},
+    {167, 2, 2, 2},
+    {165, 2, 11, 4},
+    {48310, 1, 2, 4},
+    {41321, 1, 17, 2932},
+    {35, 5, 11, 1},
+    {14878, 1, 0, 2938},
+    {39, 2, 0, 2937},
+    {26, 3, 2, 4},
+    {2, 2, 11, 4},
+    {4548, 0, 19, 2},
+    {4336, 0, 0, 2953},
+    {439844, 1, 2, 2},
+    {33559, 1, 0, 2943},
+    {3938, 0, 2, 4},
+    {3911, 0, 19, 2},
+    {44, 2, 0, 2951},
+    {30, 5, 17, 2945},
+    {4309, 0, 2, 5},
+    {41, 5, 2, 5},
+    {347509, 1, 2, 4},
+    {23, 2, 2, 3},
+    {204976, 1, 17, 2950},
+    {3816, 0, 19, 3},
+    {56, 2, 2, 4},
+    {3857, 0, 11, 4},
+    {41, 5, 17, 2954},
+    {43, 5, 0, 2956},
+    {75157, 1, 19, 5},
+    {4710, 0, 15, 4},
+    {28, 5, 0, 2969},
+    {26, 5, 2, 4},
+    {2996, 2, 2, 4},
+    {43457, 1, 21, 2961},
+    {10, 3, 13, 2962},
+    {659, 2, 13, 2963},
+    {1007, 2, 17, 2964},
+    {22, 3, 0, 2966},
+    {118999, 1, 15, 4},
+    {1689, 2, 2, 4},
+    {25, 3, 13, 2968},
+    {25, 5, 15, 4},
+    {314045, 1, 2, 4},
+    {313720, 1, 2, 2},
+    {1840, 2, 0, 2977},
+    {5914, 0, 17, 2973},
+    {30, 3, 0, 2975},
+    {41, 5, 15, 5},
+    {6111, 0, 17, 2976},
+    {39, 5, 23, 4},
+    {2961, 2, 0, 2983},
+    {2843, 2, 2, 2},
+    {2088, 2, 0, 2982},
+    {23, 3, 13, 2981},
+    {27, 3, 11, 3},
+    {2659, 2, 19, 3},
+    {289644, 1, 17, 2984},
+    {34, 5, 15, 4},
+    {64, 3, 0, 3222},
+    {1115877, 1, 0, 3219},
+    {43, 5, 0, 3203},
+    {3595, 0, 0, 3011},
+    {4268, 2, 0, 3008},
+    {600230, 1, 0, 3005},
+    {142, 2, 0, 2997},
+    {554097, 1, 0, 2996},
+    {20415, 1, 13, 2994},
+    {3509, 0, 2, 4},
+    {3485, 0, 19, 5},
+    {34, 5, 15, 2},
+    {149811, 1, 0, 3000},
+    {3482, 0, 21, 2999},
+    {29, 5, 23, 4},
+    {45, 3, 13, 3001},
+    {53, 3, 17, 3002},
+    {3510, 0, 0, 3004},
+    {37, 5, 23, 4},
+    {41, 5, 15, 2},
+    {3592, 0, 2, 3},
+    {35, 3, 2, 4},
+    {3578, 0, 19, 5},
+    {3560, 0, 2, 2},
+    {3506, 0, 2, 3},
+    {31, 5, 19, 3},
+    {305415, 1, 2, 4},
+    {5690, 0, 0, 3159},
+    {51, 3, 0, 3097},
+    {33, 3, 0, 3022},
+    {13794, 1, 9, 3016},
+    {4156, 0, 2, 4},
+    {1085, 2, 2, 2},
+    {32, 5, 17, 3019},
+    {48578, 1, 21, 3020},
+    {3740, 0, 21, 3021},
+    {3927, 0, 15, 4},
+    {1980, 2, 0, 3084},
+    {25, 5, 0, 3040},
+    {151949, 1, 0, 3031},
+    {57, 2, 0, 3029},
+    {15155, 1, 21, 3027},
+    {23, 5, 2, 4},
+    {45948, 1, 15, 4},
+    {5244, 0, 2, 4},
+    {4084, 0, 19, 5},
+    {21, 5, 13, 3032},
+    {23, 5, 17, 3033},
+    {300824, 1, 0, 3039},
+    {259692, 1, 2, 4},
+    {24, 5, 0, 3037},
+    {46, 3, 15, 4},
+    {211110, 1, 17, 3038},
+    {228624, 1, 15, 4},
+    {4078, 0, 15, 5},
+    {5444, 0, 0, 3072},
+    {128615, 1, 0, 3062},
+    {4856, 0, 0, 3057},
+    {4145, 0, 0, 3051},
+    {39756, 1, 17, 3045},
+    {870, 2, 2, 4},
+    {3926, 0, 0, 3048},
+    {3881, 0, 19, 3},
+    {62589, 1, 17, 3049},
+    {3987, 0, 2, 3},
+    {32, 5, 23, 4},
+    {38, 3, 17, 3052},
+    {39, 3, 0, 3054},
+    {52449, 1, 15, 5},
+    {29, 5, 2, 4},
+    {28, 5, 17, 3056},
+    {4360, 0, 19, 3},
+    {977, 2, 0, 3061},
+    {43, 3, 17, 3059},
+    {44, 3, 2, 4},
+    {73763, 1, 11, 4},
+    {45870, 1, 23, 4},
+    {1304, 2, 0, 3066},
+    {5348, 0, 17, 3064},
+    {5396, 0, 2, 4},
+    {115, 2, 19, 3},
+    {1775, 2, 2, 4},
+    {47, 3, 2, 2},
+    {140179, 1, 21, 3069},
+    {1408, 2, 13, 3070},
+    {198133, 1, 2, 4},
+    {38, 5, 19, 3},
+    {41, 3, 0, 3074},
+    {5448, 0, 15, 4},
+    {5628, 0, 0, 3082},
+    {189007, 1, 0, 3078},
+    {64702, 1, 13, 3077},
+    {327, 2, 19, 3},
+    {255874, 1, 0, 3081},
+    {236078, 1, 2, 3},
+    {29, 5, 19, 5},
+    {5496, 0, 11, 5},
+    {5664, 0, 17, 3083},
+    {5672, 0, 11, 4},
+    {4924, 2, 0, 3096},
+    {44818, 1, 0, 3088},
+    {43, 3, 2, 4},
+    {36, 5, 15, 2},
+    {3951, 0, 17, 3089},
+    {4036, 0, 0, 3091},
+    {36, 5, 15, 5},
+    {32, 5, 0, 3094},
+    {23, 5, 2, 4},
+    {22, 5, 19, 3},
+    {40, 3, 2, 3},
+    {38, 5, 23, 4},
+    {37, 5, 19, 5},
+    {62, 3, 0, 3142},
+    {147, 2, 0, 3120},
+    {13410, 1, 13, 3100},
+    {60, 3, 0, 3110},
+    {299016, 1, 0, 3109},
+    {5513, 0, 0, 3106},
+    {56, 3, 17, 3104},
+    {4867, 0, 17, 3105},
+    {58, 3, 19, 3},
+    {35, 5, 2, 5},
+    {56, 3, 17, 3108},
+    {79357, 1, 23, 4},
+    {34, 5, 15, 5},
+    {3889, 0, 13, 3111},
+    {102503, 1, 0, 3113},
+    {29, 5, 15, 4},
+    {35, 5, 2, 4},
+    {61, 3, 21, 3115},
+    {120859, 1, 21, 3116},
+    {27, 5, 17, 3117},
+    {31, 5, 0, 3119},
+    {72, 2, 15, 5},
+    {72, 2, 23, 4},
+    {52, 3, 0, 3123},
+    {5165, 0, 17, 3122},
+    {5522, 0, 23, 3},
+    {4809, 0, 0, 3131},
+    {57, 3, 2, 4},
+    {3881, 0, 0, 3129},
+    {281780, 1, 2, 4},
+    {33, 5, 13, 3128},
+    {3755, 0, 23, 4},
+    {4337, 0, 17, 3130},
+    {4387, 0, 15, 4},
+    {1503, 2, 0, 3140},
+    {59, 3, 17, 3133},
+    {465, 2, 17, 3134},
+    {640, 2, 2, 4},
+    {35, 5, 0, 3139},
+    {61, 3, 2, 4},
+    {33, 5, 2, 4},
+    {29, 5, 19, 5},
+    {60, 3, 15, 5},
+    {33, 5, 21, 3141},
+    {37, 5, 19, 3},
+    {4980, 0, 0, 3157},
+    {138685, 1, 0, 3146},
+    {114798, 1, 17, 3145},
+    {31, 5, 23, 4},
+    {63, 3, 17, 3147},
+    {254111, 1, 2, 4},
+    {27, 5, 0, 3153},
+    {201597, 1, 0, 3151},
+    {4337, 0, 15, 4},
+    {21, 5, 21, 3152},
+    {4369, 0, 23, 3},
+    {140, 2, 0, 3155},
+    {169392, 1, 15, 4},
+    {237, 2, 13, 3156},
+    {34, 5, 19, 3},
+    {184515, 1, 17, 3158},
+    {63, 3, 11, 4},
+    {288900, 1, 0, 3202},
+    {2, 2, 0, 3176},
+    {49, 3, 0, 3174},
+    {41, 3, 2, 3},
+    {24, 5, 0, 3167},
+    {35, 3, 2, 3},
+    {23, 5, 2, 4},
+    {62386, 1, 19, 3},
+    {36, 3, 17, 3168},
+    {5924, 0, 17, 3169},
+    {27, 5, 0, 3171},
+    {25, 5, 19, 3},
+    {6135, 0, 2, 5},
+    {38, 3, 2, 4},
+    {33, 5, 23, 4},
+    {57, 3, 2, 4},
+    {29, 5, 23, 4},
+    {39, 3, 0, 3183},
+    {102818, 1, 2, 4},
+    {661, 2, 2, 4},
+    {33, 3, 17, 3180},
+    {35, 3, 0, 3182},
+    {29, 5, 15, 4},
+    {36, 3, 15, 4},
+    {5919, 0, 0, 3190},
+    {29, 5, 17, 3185},
+    {5916, 0, 2, 5},
+    {5693, 0, 13, 3187},
+    {50, 3, 2, 4},
+    {46, 3, 2, 4},
+    {509, 2, 19, 5},
+    {28, 5, 2, 4},
+    {24, 5, 0, 3194},
+    {59, 3, 17, 3193},
+    {6061, 0, 15, 4},
+    {37, 2, 17, 3195},
+    {1060, 2, 0, 3201},
+    {170712, 1, 0, 3199},
+    {161924, 1, 2, 3},
+    {6182, 0, 19, 3},
+    {26, 5, 17, 3200},
+    {46, 3, 19, 5},
+    {27, 5, 15, 5},
+    {826, 2, 15, 4},
+    {33, 3, 0, 3209},
+    {1152, 2, 17, 3205},
+    {5299, 0, 0, 3208},
+    {2068, 2, 9, 3207},
+    {48, 5, 19, 5},
+    {5001, 2, 15, 1},
+    {70, 2, 2, 4},
+    {46, 5, 0, 3216},
+    {46, 3, 0, 3214},
+    {43, 3, 17, 3213},
+    {44, 3, 15, 5},
+    {80829, 1, 2, 4},
+    {4411, 0, 23, 4},
+    {6031, 0, 2, 4},
+    {48, 5, 2, 5},
+    {39, 3, 23, 3},
+    {34, 3, 9, 3220},
+    {3487, 0, 13, 3221},
+    {1184400, 1, 19, 3},
+    {382, 2, 0, 3309},
+    {88, 3, 0, 3300},
+    {46123, 1, 0, 3229},
+    {16973, 1, 2, 4},
+    {5420, 0, 2, 4},
+    {22, 5, 13, 3228},
+    {5404, 0, 19, 3},
+    {272407, 1, 0, 3260},
+    {4371, 0, 0, 3246},
+    {157850, 1, 0, 3238},
+    {94, 2, 2, 4},
+    {33, 5, 0, 3235},
+    {92635, 1, 15, 4},
+    {3628, 0, 9, 3236},
+    {4, 2, 17, 3237},
+    {34, 5, 15, 2},
+    {160164, 1, 13, 3239},
+    {4162, 0, 0, 3245},
+    {3699, 0, 17, 3241},
+    {250942, 1, 2, 3},
+    {3884, 0, 13, 3243},
+    {3, 2, 2, 4},
+    {31, 5, 11, 3},
+    {4301, 0, 11, 3},
+    {4644, 0, 0, 3248},
+    {86, 3, 15, 4},
+    {225851, 1, 0, 3259},
+    {45, 5, 2, 2},
+    {212873, 1, 2, 3},
+    {97, 2, 0, 3257},
+    {47547, 1, 17, 3253},
+    {77, 3, 0, 3256},
+    {60954, 1, 17, 3255},
+    {204249, 1, 15, 4},
+    {19, 2, 15, 4},
+    {5852, 0, 17, 3258},
+    {32, 5, 19, 3},
+    {49, 2, 19, 3},
+    {4662, 0, 0, 3279},
+    {3875, 0, 2, 4},
+    {35, 5, 0, 3274},
+    {221, 2, 2, 4},
+    {22, 5, 13, 3265},
+    {65, 3, 17, 3266},
+    {376203, 1, 13, 3267},
+    {614770, 1, 0, 3271},
+    {3598, 0, 2, 4},
+    {3500, 0, 2, 3},
+    {28, 5, 23, 4},
+    {79, 3, 2, 3},
+    {70, 3, 2, 4},
+    {3632, 0, 19, 3},
+    {39, 5, 2, 4},
+    {66, 3, 17, 3276},
+    {68, 3, 0, 3278},
+    {3584, 0, 15, 5},
+    {38, 5, 19, 5},
+    {231, 2, 0, 3296},
+    {38, 5, 0, 3294},
+    {5685, 0, 0, 3287},
+    {25, 5, 17, 3283},
+    {2, 2, 17, 3284},
+    {4671, 0, 13, 3285},
+    {71, 3, 2, 3},
+    {6, 2, 15, 4},
+    {652499, 1, 2, 3},
+    {452641, 1, 0, 3291},
+    {79, 3, 2, 4},
+    {34, 5, 15, 4},
+    {32, 5, 0, 3293},
+    {5734, 0, 15, 4},
+    {35, 5, 15, 4},
+    {67, 3, 2, 4},
+    {4887, 0, 15, 5},
+    {269, 2, 9, 3297},
+    {5074, 0, 13, 3298},
+    {5599, 0, 17, 3299},
+    {33, 5, 19, 3},
+    {150073, 1, 0, 3303},
+    {174, 2, 13, 3302},
+    {25, 5, 15, 4},
+    {5, 2, 13, 3304},
+    {4248, 0, 13, 3305},
+    {89, 3, 0, 3307},
+    {24, 5, 11, 3},
+    {4493, 0, 2, 2},
+    {30, 5, 11, 3},
+    {92, 3, 0, 3324},
+    {5520, 0, 17, 3311},
+    {45, 5, 2, 4},
+    {2767, 2, 0, 3323},
+    {30, 5, 17, 3314},
+    {77, 3, 0, 3320},
+    {1023, 2, 2, 4},
+    {31, 5, 13, 3317},
+    {425, 2, 17, 3318},
+    {34, 5, 17, 3319},
+    {527909, 1, 19, 3},
+    {499, 2, 13, 3321},
+    {6243, 0, 17, 3322},
+    {34, 5, 23, 3},
+    {5678, 0, 15, 5},
+    {4101, 0, 0, 3326},
+    {3813, 0, 11, 1},
+    {95, 3, 19, 3},
+    {67, 3, 0, 3461},
+    {40, 2, 0, 3399},
+    {37, 3, 0, 3360},
+    {486744, 1, 2, 3},
+    {7240, 0, 0, 3349},
+    {6, 2, 0, 3344},
+    {22878, 1, 13, 3334},
+    {7172, 0, 2, 3},
+    {236677, 1, 2, 5},
+    {7118, 0, 2, 4},
+    {3, 2, 0, 3341},
+    {48173, 1, 2, 4},
+    {37, 5, 2, 3},
+    {33, 5, 15, 4},
+    {5, 2, 0, 3343},
+    {32, 5, 15, 5},
+    {36, 5, 15, 4},
+    {34, 3, 0, 3347},
+    {6647, 0, 2, 3},
+    {6506, 0, 15, 4},
+    {35, 3, 2, 3},
+    {37, 5, 19, 5},
+    {165249, 1, 0, 3355},
+    {27, 5, 0, 3352},
+    {19, 5, 23, 4},
+    {8695, 1, 21, 3353},
+    {37, 5, 13, 3354},
+    {71994, 1, 23, 3},
+    {21, 2, 0, 3358},
+    {39, 5, 2, 5},
+    {34, 3, 15, 4},
+    {36, 5, 17, 3359},
+    {39, 5, 23, 4},
+    {65, 3, 2, 4},
+    {129705, 1, 0, 3392},
+    {123245, 1, 2, 5},
+    {42, 5, 0, 3387},
+    {42, 3, 0, 3377},
+    {20159, 1, 0, 3368},
+    {1, 2, 2, 3},
+    {6430, 0, 15, 4},
+    {93826, 1, 2, 5},
+    {22540, 1, 0, 3371},
+    {20446, 1, 15, 4},
+    {2, 2, 13, 3372},
+    {36, 5, 0, 3376},
+    {7406, 0, 0, 3375},
+    {32392, 1, 15, 4},
+    {31, 5, 15, 5},
+    {26, 2, 19, 3},
+    {22626, 1, 17, 3378},
+    {46, 3, 0, 3386},
+    {32, 5, 0, 3382},
+    {45, 3, 17, 3381},
+    {38359, 1, 23, 4},
+    {7235, 0, 2, 3},
+    {88416, 1, 2, 4},
+    {45, 3, 2, 5},
+    {36, 5, 19, 5},
+    {25753, 1, 15, 4},
+    {46, 5, 0, 3389},
+    {12, 2, 23, 4},
+    {6793, 0, 21, 3390},
+    {7, 2, 17, 3391},
+    {50, 5, 23, 4},
+    {23, 2, 2, 4},
+    {284863, 1, 17, 3394},
+    {6, 2, 2, 3},
+    {46, 3, 17, 3396},
+    {31, 5, 13, 3397},
+    {52, 3, 2, 5},
+    {36, 5, 19, 5},
+    {1274, 2, 0, 3450},
+    {80, 2, 0, 3417},
+    {26, 3, 0, 3408},
+    {65170, 1, 9, 3403},
+    {479421, 1, 0, 3406},
+    {346147, 1, 2, 5},
+    {6665, 0, 15, 4},
+    {6803, 0, 2, 1},
+    {30, 5, 7, 3},
+    {376918, 1, 0, 3415},
+    {7213, 0, 17, 3410},
+    {33, 3, 17, 3411},
+    {44659, 1, 0, 3413},
+    {35, 5, 23, 3},
+    {37, 3, 2, 4},
+    {33, 5, 15, 5},
+    {453245, 1, 2, 4},
+    {30, 5, 15, 2},
+    {32, 5, 2, 4},
+    {146, 2, 0, 3432},
+    {27, 5, 17, 3420},
+    {6541, 0, 17, 3421},
+    {39, 3, 0, 3428},
+    {36858, 1, 21, 3423},
+    {347449, 1, 0, 3425},
+    {88, 2, 19, 3},
+    {30, 5, 17, 3426},
+    {25, 3, 2, 3},
+    {7068, 0, 19, 3},
+    {31, 5, 2, 4},
+    {121, 2, 17, 3430},
+    {29, 5, 13, 3431},
+    {30, 5, 19, 3},
+    {30, 5, 2, 4},
+    {423398, 1, 0, 3441},
+    {54644, 1, 0, 3436},
+    {37, 3, 19, 5},
+    {151, 2, 0, 3438},
+    {150, 2, 19, 5},
+    {201, 2, 2, 4},
+    {6861, 0, 17, 3440},
+    {26, 5, 19, 3},
+    {7503, 0, 2, 5},
+    {59, 3, 0, 3448},
+    {45, 3, 17, 3444},
+    {7061, 0, 0, 3446},
+    {53, 3, 19, 5},
+    {7114, 0, 21, 3447},
+    {7346, 0, 19, 5},
+    {26, 5, 17, 3449},
+    {65, 3, 15, 4},
+    {35, 3, 0, 3458},
+    {460806, 1, 2, 4},
+    {7469, 0, 2, 4},
+    {24, 3, 17, 3454},
+    {360450, 1, 9, 3455},
+    {1668, 2, 0, 3457},
+    {40, 5, 15, 4},
+    {33, 5, 15, 2},
+    {62, 3, 17, 3459},
+    {6749, 0, 17, 3460},
+    {31, 5, 23, 3},
+    {81, 3, 2, 4},
+    {273536, 1, 0, 3477},
+    {306, 2, 0, 3468},
+    {7118, 0, 13, 3465},
+    {1, 2, 17, 3466},
+    {189922, 1, 2, 3},
+    {47, 2, 15, 4},
+    {6988, 0, 2, 4},
+    {6869, 0, 0, 3474},
+    {6394, 0, 2, 4},
+    {72, 3, 2, 3},
+    {29, 5, 13, 3473},
+    {36, 5, 19, 3},
+    {35, 5, 13, 3475},
+    {38, 5, 9, 3476},
+    {44, 5, 7, 3},
+    {6662, 0, 0, 3481},
+    {6195, 2, 2, 4},
+    {410656, 1, 2, 3},
+    {6638, 0, 15, 4},
+    {77, 3, 2, 4},
+    {76, 3, 17, 3483},
+    {6956, 0, 2, 3},
+    {34, 5, 19, 3},
+    {60, 3, 0, 3907},
+    {1376, 2, 0, 3884},
+    {13391, 0, 0, 3877},
+    {35, 3, 0, 3663},
+    {53404, 1, 0, 3546},
+    {704, 2, 2, 5},
+    {411, 2, 0, 3542},
+    {10398, 0, 0, 3531},
+    {23, 3, 0, 3507},
+    {112, 2, 0, 3504},
+    {44, 2, 0, 3502},
+    {22, 3, 0, 3500},
+    {34, 5, 2, 4},
+    {28, 5, 21, 3499},
+    {10017, 1, 27, 5},
+    {8091, 0, 2, 4},
+    {31, 5, 27, 4},
+    {20, 3, 2, 5},
+    {39, 5, 27, 5},
+    {18, 3, 2, 2},
+    {10320, 0, 25, 3506},
+    {42, 5, 19, 5},
+    {7875, 0, 0, 3515},
+    {29, 3, 2, 5},
+    {8124, 1, 0, 3511},
+    {7674, 0, 19, 6},
+    {9127, 1, 13, 3512},
+    {28, 5, 21, 3513},
+    {35, 5, 17, 3514},
+    {39, 5, 23, 4},
+    {9556, 0, 0, 3518},
+    {10835, 1, 2, 4},
+    {29, 5, 19, 5},
+    {10041, 0, 2, 4},
+    {29, 3, 0, 3522},
+    {9806, 0, 2, 5},
+    {42, 5, 23, 6},
+    {92, 2, 0, 3530},
+    {9922, 0, 0, 3528},
+    {45, 2, 0, 3527},
+    {9, 2, 2, 5},
+    {47, 5, 19, 5},
+    {32, 5, 19, 6},
+    {36, 5, 21, 3529},
+    {9997, 0, 19, 3},
+    {31, 5, 15, 4},
+    {11, 3, 13, 3532},
+    {12962, 0, 0, 3540},
+    {6, 2, 0, 3538},
+    {42, 5, 17, 3535},
+    {12723, 1, 17, 3536},
+    {11754, 0, 21, 3537},
+    {44, 5, 23, 3},
+    {10508, 0, 2, 4},
+    {10441, 0, 19, 3},
+    {13192, 0, 2, 3},
+    {44, 5, 15, 4},
+    {9294, 0, 0, 3544},
+    {27, 5, 11, 1},
+    {10769, 0, 2, 4},
+    {9992, 0, 19, 3},
+    {11020, 0, 0, 3602},
+    {9131, 0, 0, 3581},
+    {8299, 0, 0, 3568},
+    {1163, 2, 0, 3567},
+    {24, 3, 17, 3551},
+    {7564, 0, 0, 3553},
+    {7558, 0, 19, 3},
+    {143408, 1, 17, 3554},
+    {30, 5, 2, 4},
+    {41, 2, 0, 3557},
+    {8204, 0, 23, 4},
+    {26, 5, 17, 3558},
+    {34, 3, 2, 4},
+    {29, 5, 0, 3566},
+    {7758, 0, 0, 3562},
+    {7598, 0, 19, 5},
+    {433815, 1, 2, 3},
+    {160, 2, 2, 4},
+    {27, 5, 13, 3565},
+    {8067, 0, 19, 3},
+    {28, 3, 19, 5},
+    {36, 5, 15, 2},
+    {21, 2, 17, 3569},
+    {33, 3, 0, 3580},
+    {42, 5, 0, 3577},
+    {8634, 0, 2, 4},
+    {23, 2, 9, 3573},
+    {8556, 0, 17, 3574},
+    {400, 2, 17, 3575},
+    {29, 5, 9, 3576},
+    {36, 5, 15, 2},
+    {81, 2, 17, 3578},
+    {202360, 1, 17, 3579},
+    {418, 2, 15, 5},
+    {32, 5, 23, 4},
+    {32, 3, 0, 3591},
+    {253, 2, 0, 3585},
+    {229, 2, 17, 3584},
+    {34, 5, 23, 4},
+    {385824, 1, 17, 3586},
+    {21, 3, 17, 3587},
+    {30, 3, 2, 4},
+    {39, 5, 0, 3590},
+    {10213, 0, 15, 4},
+    {41, 5, 23, 3},
+    {662, 2, 0, 3601},
+    {33, 3, 0, 3597},
+    {271, 2, 0, 3596},
+    {33, 5, 13, 3595},
+    {39, 5, 19, 3},
+    {42, 5, 19, 3},
+    {49, 5, 2, 3},
+    {34, 3, 17, 3599},
+    {9576, 0, 17, 3600},
+    {9836, 0, 23, 4},
+    {29, 5, 15, 5},
+    {9, 3, 13, 3603},
+    {5, 2, 0, 3662},
+    {11656, 0, 0, 3631},
+    {34, 3, 0, 3627},
+    {74579, 1, 21, 3607},
+    {30, 5, 0, 3612},
+    {24, 3, 17, 3609},
+    {11207, 0, 21, 3610},
+    {11220, 0, 13, 3611},
+    {78099, 1, 23, 3},
+    {12, 3, 21, 3613},
+    {45, 5, 2, 3},
+    {2, 2, 2, 5},
+    {1, 2, 2, 3},
+    {317481, 1, 0, 3624},
+    {36, 5, 2, 5},
+    {293192, 1, 0, 3622},
+    {32, 5, 2, 3},
+    {77008, 1, 13, 3621},
+    {11128, 0, 15, 5},
+    {34, 5, 2, 4},
+    {15, 3, 23, 4},
+    {11446, 0, 13, 3625},
+    {38, 5, 21, 3626},
+    {40, 5, 19, 3},
+    {11144, 0, 0, 3629},
+    {32, 5, 15, 2},
+    {11157, 0, 21, 3630},
+    {11174, 0, 15, 5},
+    {17, 3, 0, 3635},
+    {11754, 0, 21, 3633},
+    {33, 5, 2, 3},
+    {12557, 0, 15, 4},
+    {31, 3, 0, 3658},
+    {32, 5, 17, 3637},
+    {3, 2, 2, 5},
+    {46, 5, 0, 3656},
+    {38, 5, 0, 3647},
+    {19, 3, 17, 3641},
+    {37, 5, 2, 4},
+    {36, 5, 0, 3646},
+    {12334, 0, 21, 3644},
+    {293955, 1, 17, 3645},
+    {305816, 1, 23, 4},
+    {303229, 1, 19, 5},
+    {26, 3, 0, 3653},
+    {325488, 1, 0, 3651},
+    {1, 2, 17, 3650},
+    {12285, 0, 23, 3},
+    {12210, 0, 2, 5},
+    {361715, 1, 19, 5},
+    {41, 5, 13, 3654},
+    {43, 5, 21, 3655},
+    {45, 5, 15, 5},
+    {51, 5, 2, 4},
+    {18, 3, 15, 4},
+    {48, 5, 0, 3660},
+    {34, 3, 15, 4},
+    {33, 3, 17, 3661},
+    {34, 3, 23, 4},
+    {40, 5, 19, 3},
+    {339, 2, 0, 3822},
+    {97152, 1, 0, 3739},
+    {9739, 0, 0, 3717},
+    {38, 3, 0, 3674},
+    {8104, 0, 0, 3669},
+    {37, 5, 15, 4},
+    {217, 2, 2, 3},
+    {7, 2, 0, 3672},
+    {44, 5, 23, 4},
+    {37, 5, 2, 5},
+    {14246, 1, 23, 6},
+    {52, 3, 0, 3715},
+    {28, 5, 0, 3682},
+    {9207, 0, 0, 3681},
+    {26, 5, 0, 3679},
+    {28183, 1, 15, 5},
+    {1, 2, 2, 5},
+    {29822, 1, 15, 5},
+    {28573, 1, 23, 4},
+    {43, 5, 0, 3713},
+    {46, 3, 0, 3700},
+    {8862, 0, 0, 3691},
+    {48637, 1, 0, 3687},
+    {35, 2, 15, 4},
+    {8235, 0, 0, 3690},
+    {7603, 0, 21, 3689},
+    {35, 5, 15, 5},
+    {37, 5, 19, 5},
+    {92635, 1, 2, 3},
+    {9708, 0, 2, 3},
+    {45, 3, 2, 6},
+    {8965, 0, 21, 3695},
+    {39, 2, 2, 4},
+    {11, 2, 2, 5},
+    {2, 2, 0, 3699},
+    {40, 3, 23, 4},
+    {33, 5, 19, 5},
+    {27793, 1, 0, 3702},
+    {33, 5, 23, 4},
+    {29891, 1, 0, 3709},
+    {31, 5, 2, 4},
+    {51, 3, 0, 3708},
+    {28740, 1, 2, 3},
+    {9053, 0, 13, 3707},
+    {9120, 0, 23, 4},
+    {28917, 1, 15, 4},
+    {51, 3, 17, 3710},
+    {9191, 0, 0, 3712},
+    {31, 5, 19, 3},
+    {33, 5, 23, 4},
+    {9628, 0, 2, 4},
+    {9218, 0, 27, 5},
+    {8838, 0, 17, 3716},
+    {53, 3, 23, 6},
+    {5, 2, 0, 3733},
+    {36, 5, 0, 3724},
+    {1, 2, 0, 3722},
+    {10393, 0, 2, 3},
+    {33, 5, 27, 5},
+    {45771, 1, 21, 3723},
+    {51, 3, 27, 5},
+    {7175, 1, 21, 3725},
+    {44, 5, 2, 4},
+    {37, 5, 17, 3727},
+    {3, 2, 0, 3732},
+    {10387, 0, 0, 3731},
+    {10174, 0, 2, 4},
+    {9888, 0, 19, 5},
+    {39, 5, 7, 5},
+    {10718, 0, 27, 5},
+    {49, 5, 2, 5},
+    {52, 3, 2, 4},
+    {30, 2, 0, 3737},
+    {18, 2, 23, 6},
+    {45, 3, 17, 3738},
+    {48, 5, 23, 4},
+    {320, 2, 0, 3821},
+    {259, 2, 0, 3817},
+    {12027, 0, 0, 3814},
+    {7909, 0, 0, 3749},
+    {52, 3, 2, 5},
+    {173, 2, 2, 4},
+    {27, 2, 0, 3748},
+    {1, 2, 2, 4},
+    {7719, 0, 19, 5},
+    {7826, 0, 23, 4},
+    {52, 3, 0, 3785},
+    {213046, 1, 0, 3767},
+    {38, 3, 21, 3752},
+    {40, 3, 0, 3754},
+    {10884, 0, 19, 5},
+    {212423, 1, 2, 4},
+    {1, 2, 0, 3766},
+    {49, 3, 0, 3764},
+    {114846, 1, 21, 3758},
+    {123146, 1, 0, 3760},
+    {33, 5, 23, 4},
+    {48, 3, 0, 3763},
+    {10588, 0, 17, 3762},
+    {38, 5, 23, 4},
+    {43, 5, 19, 5},
+    {48, 5, 2, 5},
+    {50, 3, 27, 4},
+    {221, 2, 23, 6},
+    {101, 2, 0, 3781},
+    {2, 2, 2, 5},
+    {10354, 0, 0, 3778},
+    {41, 5, 21, 3771},
+    {49, 5, 2, 5},
+    {256056, 1, 0, 3774},
+    {9741, 0, 27, 4},
+    {42, 5, 0, 3776},
+    {8442, 0, 19, 5},
+    {38, 3, 21, 3777},
+    {39, 3, 19, 5},
+    {50, 3, 0, 3780},
+    {37, 5, 19, 5},
+    {1, 2, 27, 4},
+    {313913, 1, 2, 5},
+    {300547, 1, 21, 3783},
+    {35, 5, 17, 3784},
+    {38, 5, 15, 4},
+    {128196, 1, 21, 3786},
+    {238, 2, 2, 6},
+    {10707, 0, 0, 3811},
+    {9016, 0, 0, 3790},
+    {274981, 1, 19, 5},
+    {37, 5, 0, 3802},
+    {58, 3, 0, 3801},
+    {9, 2, 0, 3796},
+    {1, 2, 2, 5},
+    {386647, 1, 2, 5},
+    {34, 5, 27, 5},
+    {334297, 1, 0, 3799},
+    {9615, 0, 17, 3798},
+    {33, 5, 19, 6},
+    {120, 2, 2, 6},
+    {30, 5, 23, 6},
+    {59, 3, 19, 5},
+    {53, 3, 0, 3807},
+    {25, 2, 2, 6},
+    {9567, 0, 0, 3806},
+    {40, 5, 23, 4},
+    {9731, 0, 27, 5},
+    {244911, 1, 0, 3810},
+    {39, 5, 25, 3809},
+    {10472, 0, 23, 4},
+    {179, 2, 27, 4},
+    {46, 5, 2, 5},
+    {11341, 0, 2, 4},
+    {2, 2, 19, 5},
+    {50, 5, 17, 3815},
+    {38, 3, 2, 5},
+    {284881, 1, 19, 5},
+    {453288, 1, 2, 6},
+    {8671, 0, 17, 3819},
+    {9602, 0, 21, 3820},
+    {309, 2, 19, 5},
+    {9137, 0, 11, 5},
+    {10182, 0, 0, 3863},
+    {9010, 0, 0, 3839},
+    {8674, 0, 0, 3833},
+    {8260, 0, 17, 3826},
+    {38, 5, 2, 4},
+    {1077, 2, 2, 3},
+    {29, 5, 0, 3830},
+    {8405, 0, 23, 3},
+    {8506, 0, 2, 4},
+    {33, 5, 17, 3832},
+    {665, 2, 23, 4},
+    {494, 2, 21, 3834},
+    {299192, 1, 0, 3838},
+    {123414, 1, 13, 3836},
+    {195047, 1, 17, 3837},
+    {50, 5, 15, 4},
+    {8871, 0, 23, 4},
+    {53, 3, 0, 3861},
+    {504, 2, 0, 3846},
+    {359, 2, 0, 3843},
+    {39, 5, 19, 5},
+    {9453, 0, 2, 5},
+    {9248, 0, 2, 4},
+    {39, 5, 23, 3},
+    {9933, 0, 0, 3859},
+    {9839, 0, 2, 5},
+    {9058, 0, 21, 3849},
+    {363531, 1, 0, 3857},
+    {49, 3, 0, 3856},
+    {35, 5, 0, 3855},
+    {9453, 0, 0, 3854},
+    {1070, 2, 19, 3},
+    {9795, 0, 23, 3},
+    {1296, 2, 19, 5},
+    {39, 5, 23, 6},
+    {9373, 0, 21, 3858},
+    {35, 5, 19, 5},
+    {10052, 0, 17, 3860},
+    {31, 5, 23, 4},
+    {9352, 0, 2, 4},
+    {38, 5, 19, 6},
+    {567, 2, 2, 4},
+    {10884, 0, 0, 3867},
+    {10876, 0, 2, 3},
+    {22, 5, 23, 4},
+    {10942, 0, 0, 3870},
+    {10890, 0, 2, 5},
+    {38, 5, 19, 3},
+    {515, 2, 0, 3873},
+    {42, 3, 2, 4},
+    {34, 5, 15, 4},
+    {11079, 0, 17, 3874},
+    {11478, 0, 2, 4},
+    {42, 5, 2, 5},
+    {38, 5, 23, 4},
+    {29, 3, 0, 3879},
+    {16193, 0, 15, 2},
+    {35, 3, 0, 3882},
+    {506, 2, 2, 4},
+    {48, 5, 15, 4},
+    {14890, 0, 2, 5},
+    {50, 5, 19, 5},
+    {35, 3, 2, 4},
+    {36784, 1, 9, 3886},
+    {5323, 2, 2, 4},
+    {3167, 2, 0, 3902},
+    {34, 3, 0, 3900},
+    {18, 3, 17, 3890},
+    {24, 3, 0, 3898},
+    {1525, 2, 9, 3892},
+    {22, 3, 0, 3897},
+    {13059, 0, 2, 3},
+    {19, 3, 2, 4},
+    {9950, 0, 17, 3896},
+    {28, 5, 15, 1},
+    {10004, 0, 15, 2},
+    {1984, 2, 17, 3899},
+    {228382, 1, 19, 2},
+    {8665, 0, 13, 3901},
+    {40, 5, 15, 2},
+    {79500, 1, 17, 3903},
+    {15, 3, 0, 3905},
+    {9568, 0, 15, 4},
+    {13566, 0, 9, 3906},
+    {25, 5, 7, 3},
+    {72, 3, 0, 3928},
+    {3, 2, 0, 3911},
+    {67, 3, 17, 3910},
+    {38, 5, 15, 4},
+    {8666, 0, 0, 3916},
+    {65, 3, 0, 3914},
+    {7625, 0, 23, 4},
+    {388, 2, 13, 3915},
+    {345065, 1, 19, 3},
+    {30, 5, 0, 3925},
+    {71, 3, 0, 3923},
+    {29, 5, 0, 3921},
+    {82459, 1, 17, 3920},
+    {152922, 1, 23, 4},
+    {63, 3, 17, 3922},
+    {132308, 1, 15, 4},
+    {271, 2, 13, 3924},
+    {28, 5, 15, 2},
+    {13976, 0, 17, 3926},
+    {14176, 0, 13, 3927},
+    {86533, 1, 23, 4},
+    {8331, 0, 2, 4},
+    {8321, 0, 2, 3},
+    {7618, 0, 13, 3931},
+    {420016, 1, 17, 3932},
+    {8162, 0, 19, 3},
+    {1941, 0, 0, 5779},
+    {416, 2, 0, 4851},
+    {747468, 1, 0, 4629},
+    {52, 3, 0, 4284},
+    {993, 0, 0, 3957},
+    {8, 2, 0, 3955},
+    {43, 3, 0, 3944},
+    {144, 0, 0, 3943},
+    {27, 5, 2, 4},
+    {135, 0, 23, 6},
+    {19, 5, 31, 6},
+    {50, 3, 0, 3950},
+    {28, 5, 0, 3949},
+    {548, 0, 2, 5},
+    {122, 0, 2, 4},
+    {18, 5, 19, 5},
+    {49, 3, 19, 3},
+    {608, 0, 2, 5},
+    {22, 5, 0, 3953},
+    {245, 0, 31, 6},
+    {161, 0, 2, 6},
+    {29, 5, 27, 8},
+    {250719, 1, 33, 3956},
+    {205, 0, 19, 3},
+    {16, 3, 0, 3965},
+    {13054, 1, 0, 3961},
+    {119, 2, 2, 8},
+    {1724, 0, 27, 8},
+    {36, 5, 0, 3964},
+    {1668, 0, 2, 5},
+    {21, 5, 15, 4},
+    {1873, 0, 27, 4},
+    {53109, 1, 0, 4139},
+    {42, 3, 0, 4125},
+    {27518, 1, 0, 4008},
+    {24, 3, 0, 3979},
+    {27132, 1, 2, 7},
+    {1634, 0, 0, 3977},
+    {27030, 1, 0, 3975},
+    {27, 5, 2, 5},
+    {26393, 1, 2, 4},
+    {21, 5, 19, 5},
+    {1621, 0, 29, 3976},
+    {21, 5, 15, 4},
+    {1645, 0, 2, 7},
+    {27, 5, 27, 7},
+    {41, 3, 2, 7},
+    {1788, 0, 0, 3993},
+    {1141, 0, 0, 3990},
+    {24, 5, 0, 3984},
+    {1134, 0, 31, 1},
+    {1132, 0, 29, 3985},
+    {33, 5, 33, 3986},
+    {35, 5, 2, 7},
+    {34, 5, 0, 3989},
+    {9962, 1, 35, 7},
+    {1135, 0, 35, 7},
+    {1145, 0, 13, 3991},
+    {6, 2, 33, 3992},
+    {27, 5, 15, 2},
+    {1845, 0, 0, 3995},
+    {32, 5, 27, 8},
+    {32, 3, 0, 4005},
+    {1938, 0, 0, 4004},
+    {25, 5, 0, 3999},
+    {1912, 0, 31, 6},
+    {25, 3, 0, 4001},
+    {30, 5, 31, 6},
+    {21914, 1, 33, 4002},
+    {28, 3, 2, 8},
+    {29, 5, 27, 8},
+    {32, 5, 35, 7},
+    {22, 5, 2, 7},
+    {107, 2, 2, 8},
+    {21, 5, 31, 6},
+    {22, 2, 0, 4032},
+    {2, 2, 0, 4030},
+    {24, 5, 0, 4013},
+    {35, 3, 2, 6},
+    {1885, 0, 35, 7},
+    {1757, 0, 0, 4016},
+    {31, 5, 2, 8},
+    {1242, 0, 35, 7},
+    {25, 3, 29, 4017},
+    {1829, 0, 0, 4020},
+    {31, 5, 29, 4019},
+    {36, 5, 35, 6},
+    {26, 5, 0, 4023},
+    {25, 5, 2, 6},
+    {29, 3, 27, 7},
+    {28, 5, 33, 4024},
+    {36740, 1, 0, 4026},
+    {1897, 0, 35, 7},
+    {39, 5, 2, 7},
+    {1894, 0, 25, 4028},
+    {29, 5, 33, 4029},
+    {30, 5, 27, 8},
+    {11, 2, 13, 4031},
+    {28612, 1, 27, 7},
+    {26, 5, 0, 4098},
+    {19, 3, 29, 4034},
+    {1589, 0, 0, 4059},
+    {21, 3, 0, 4048},
+    {20, 3, 2, 7},
+    {24, 5, 0, 4044},
+    {22, 5, 29, 4039},
+    {204, 2, 2, 8},
+    {23, 5, 0, 4042},
+    {28545, 1, 35, 7},
+    {31516, 1, 2, 8},
+    {1569, 0, 27, 8},
+    {25, 5, 2, 7},
+    {113, 2, 25, 4046},
+    {30172, 1, 29, 4047},
+    {1546, 0, 31, 8},
+    {32349, 1, 33, 4049},
+    {24, 5, 0, 4056},
+    {41920, 1, 0, 4053},
+    {100, 2, 33, 4052},
+    {22, 5, 35, 6},
+    {87, 2, 25, 4054},
+    {23, 5, 2, 8},
+    {133, 2, 31, 6},
+    {22, 3, 2, 7},
+    {33313, 1, 29, 4058},
+    {37648, 1, 35, 7},
+    {22, 5, 0, 4066},
+    {148, 2, 0, 4064},
+    {38070, 1, 2, 6},
+    {25, 3, 2, 8},
+    {109, 2, 35, 7},
+    {25, 3, 25, 4065},
+    {166, 2, 27, 7},
+    {24, 3, 0, 4089},
+    {31596, 1, 0, 4083},
+    {31537, 1, 2, 6},
+    {1622, 0, 0, 4080},
+    {20, 3, 33, 4071},
+    {21, 3, 29, 4072},
+    {22, 3, 33, 4073},
+    {23, 3, 0, 4075},
+    {29260, 1, 35, 7},
+    {25, 5, 0, 4077},
+    {28740, 1, 31, 8},
+    {28879, 1, 0, 4079},
+    {28188, 1, 27, 8},
+    {30256, 1, 31, 8},
+    {1627, 0, 2, 7},
+    {23, 5, 25, 4082},
+    {72, 2, 27, 7},
+    {24, 5, 2, 7},
+    {45544, 1, 2, 8},
+    {122, 2, 2, 7},
+    {23, 5, 0, 4088},
+    {22, 3, 31, 8},
+    {22, 3, 35, 7},
+    {38419, 1, 2, 7},
+    {167, 2, 0, 4096},
+    {25, 5, 2, 8},
+    {144, 2, 2, 8},
+    {28, 3, 2, 8},
+    {91, 2, 29, 4095},
+    {25, 3, 35, 7},
+    {32094, 1, 29, 4097},
+    {23, 5, 27, 8},
+    {29, 5, 0, 4120},
+    {20, 3, 0, 4106},
+    {27, 5, 29, 4101},
+    {18, 3, 0, 4105},
+    {28, 5, 0, 4104},
+    {1584, 0, 35, 7},
+    {1595, 0, 27, 8},
+    {1607, 0, 31, 8},
+    {23, 3, 0, 4112},
+    {28, 5, 0, 4111},
+    {27, 5, 29, 4109},
+    {126, 2, 29, 4110},
+    {188, 2, 35, 7},
+    {1580, 0, 35, 7},
+    {28, 5, 2, 7},
+    {27, 5, 0, 4117},
+    {28471, 1, 29, 4115},
+    {29, 3, 33, 4116},
+    {48115, 1, 31, 8},
+    {30186, 1, 2, 7},
+    {1615, 0, 33, 4119},
+    {28183, 1, 31, 8},
+    {20, 3, 2, 8},
+    {30, 5, 0, 4123},
+    {103, 2, 31, 8},
+    {30619, 1, 33, 4124},
+    {18, 3, 35, 7},
+    {1129, 0, 0, 4128},
+    {1125, 0, 2, 4},
+    {10261, 1, 31, 4},
+    {11372, 1, 0, 4136},
+    {1131, 0, 29, 4130},
+    {25, 5, 0, 4134},
+    {1134, 0, 0, 4133},
+    {10418, 1, 27, 8},
+    {22, 5, 31, 8},
+    {70, 2, 2, 7},
+    {1134, 0, 31, 6},
+    {1679, 0, 17, 4137},
+    {1845, 0, 29, 4138},
+    {29, 5, 35, 6},
+    {24, 3, 0, 4149},
+    {118079, 1, 5, 4141},
+    {1497, 0, 0, 4146},
+    {1202, 0, 0, 4145},
+    {1151, 0, 2, 4},
+    {25, 5, 19, 3},
+    {23, 5, 23, 3},
+    {186, 2, 17, 4147},
+    {1826, 0, 2, 6},
+    {31, 5, 23, 6},
+    {25, 5, 0, 4179},
+    {1273, 0, 0, 4162},
+    {37, 3, 33, 4152},
+    {23, 5, 0, 4158},
+    {3, 2, 2, 7},
+    {1132, 0, 0, 4156},
+    {1118, 0, 27, 5},
+    {44, 3, 2, 8},
+    {505524, 1, 35, 6},
+    {534579, 1, 2, 6},
+    {24, 5, 0, 4161},
+    {2, 2, 35, 6},
+    {1165, 0, 31, 6},
+    {1473, 0, 0, 4169},
+    {38, 3, 13, 4164},
+    {1390, 0, 17, 4165},
+    {19, 5, 13, 4166},
+    {96150, 1, 0, 4168},
+    {24, 5, 19, 2},
+    {23, 5, 11, 3},
+    {69355, 1, 0, 4171},
+    {23, 5, 27, 7},
+    {33, 2, 0, 4173},
+    {14, 2, 31, 3},
+    {98663, 1, 0, 4175},
+    {1671, 0, 31, 5},
+    {42, 3, 0, 4178},
+    {32, 3, 21, 4177},
+    {1717, 0, 19, 6},
+    {222, 2, 23, 4},
+    {1802, 0, 0, 4272},
+    {737275, 1, 0, 4268},
+    {46, 3, 0, 4243},
+    {25, 3, 0, 4185},
+    {1618, 0, 2, 7},
+    {31, 5, 19, 5},
+    {211660, 1, 0, 4198},
+    {15, 2, 0, 4193},
+    {40, 5, 2, 6},
+    {2, 2, 2, 8},
+    {1156, 0, 0, 4191},
+    {196629, 1, 35, 7},
+    {1, 2, 29, 4192},
+    {32, 5, 27, 8},
+    {107832, 1, 0, 4196},
+    {1681, 0, 2, 7},
+    {36, 5, 35, 7},
+    {1734, 0, 2, 3},
+    {36, 5, 19, 6},
+    {286, 2, 0, 4237},
+    {26, 5, 0, 4203},
+    {1175, 0, 2, 7},
+    {513683, 1, 2, 7},
+    {36, 3, 31, 6},
+    {1557, 0, 0, 4214},
+    {1, 2, 0, 4210},
+    {1513, 0, 2, 7},
+    {33, 5, 0, 4209},
+    {27, 5, 2, 7},
+    {40, 3, 35, 6},
+    {39, 3, 27, 8},
+    {161, 2, 2, 7},
+    {642744, 1, 2, 7},
+    {32, 5, 2, 7},
+    {1544, 0, 35, 6},
+    {1632, 0, 0, 4217},
+    {133, 2, 29, 4216},
+    {38, 5, 31, 6},
+    {41, 5, 0, 4236},
+    {1641, 0, 0, 4220},
+    {30, 5, 31, 8},
+    {1775, 0, 0, 4234},
+    {528893, 1, 0, 4228},
+    {336227, 1, 0, 4225},
+    {1, 2, 29, 4224},
+    {37, 5, 35, 7},
+    {1764, 0, 2, 6},
+    {1733, 0, 2, 7},
+    {28, 5, 31, 6},
+    {38, 5, 0, 4233},
+    {1646, 0, 25, 4230},
+    {37, 3, 29, 4231},
+    {37, 5, 2, 6},
+    {30, 5, 31, 8},
+    {31, 3, 31, 6},
+    {32, 5, 29, 4235},
+    {170, 2, 31, 8},
+    {1726, 0, 35, 6},
+    {1530, 0, 0, 4240},
+    {676756, 1, 17, 4239},
+    {36, 5, 27, 8},
+    {34, 3, 25, 4241},
+    {38, 5, 29, 4242},
+    {641777, 1, 35, 6},
+    {194, 2, 0, 4266},
+    {193380, 1, 0, 4246},
+    {1436, 0, 19, 7},
+    {1140, 0, 21, 4247},
+    {285819, 1, 0, 4252},
+    {39, 5, 2, 7},
+    {31, 5, 2, 8},
+    {49, 3, 29, 4251},
+    {30, 5, 35, 7},
+    {1748, 0, 2, 8},
+    {29, 5, 29, 4254},
+    {51, 3, 2, 8},
+    {50, 3, 2, 7},
+    {30, 5, 25, 4257},
+    {1663, 0, 0, 4264},
+    {38, 5, 0, 4263},
+    {37, 5, 2, 8},
+    {33, 5, 2, 7},
+    {31, 5, 29, 4262},
+    {8, 2, 31, 8},
+    {1515, 0, 27, 7},
+    {1705, 0, 29, 4265},
+    {37, 5, 27, 7},
+    {1609, 0, 2, 5},
+    {29, 5, 23, 4},
+    {39, 3, 0, 4271},
+    {38, 3, 2, 4},
+    {28, 5, 15, 4},
+    {26, 5, 35, 7},
+    {40, 3, 0, 4283},
+    {42, 5, 2, 4},
+    {1, 2, 29, 4275},
+    {30, 3, 0, 4278},
+    {28, 5, 29, 4277},
+    {30, 5, 35, 6},
+    {313457, 1, 0, 4282},
+    {77529, 1, 21, 4280},
+    {1893, 0, 25, 4281},
+    {32, 5, 23, 6},
+    {33, 5, 35, 6},
+    {38, 5, 23, 4},
+    {187215, 1, 0, 4473},
+    {64, 3, 0, 4322},
+    {1249, 0, 0, 4302},
+    {74553, 1, 0, 4290},
+    {883, 0, 9, 4289},
+    {27, 5, 7, 3},
+    {59, 3, 0, 4300},
+    {367, 0, 0, 4293},
+    {338, 2, 19, 8},
+    {357, 2, 2, 7},
+    {33, 5, 0, 4298},
+    {56, 3, 0, 4297},
+    {75514, 1, 27, 8},
+    {96366, 1, 35, 6},
+    {56, 3, 33, 4299},
+    {36, 5, 27, 8},
+    {1046, 0, 9, 4301},
+    {30, 5, 19, 2},
+    {62, 3, 0, 4320},
+    {57, 3, 0, 4318},
+    {85034, 1, 0, 4308},
+    {39, 2, 2, 6},
+    {34375, 1, 2, 4},
+    {30, 5, 23, 6},
+    {13, 2, 0, 4311},
+    {24, 5, 13, 4310},
+    {34, 5, 19, 3},
+    {85784, 1, 0, 4313},
+    {30, 5, 15, 4},
+    {1779, 0, 2, 4},
+    {26, 5, 2, 3},
+    {1441, 0, 2, 4},
+    {23, 5, 2, 5},
+    {1418, 0, 19, 5},
+    {19, 5, 9, 4319},
+    {23, 5, 19, 2},
+    {1530, 0, 2, 6},
+    {30, 5, 31, 6},
+    {72, 3, 0, 4347},
+    {1541, 0, 0, 4338},
+    {71, 3, 0, 4334},
+    {219, 0, 13, 4326},
+    {881, 0, 2, 5},
+    {23, 5, 0, 4333},
+    {18, 5, 0, 4332},
+    {74151, 1, 13, 4330},
+    {17, 5, 17, 4331},
+    {845, 0, 19, 5},
+    {162566, 1, 19, 5},
+    {66, 3, 15, 4},
+    {1171, 0, 0, 4337},
+    {20, 5, 2, 3},
+    {18, 5, 15, 2},
+    {27, 5, 27, 5},
+    {31, 5, 2, 2},
+    {52912, 1, 2, 4},
+    {17459, 1, 0, 4346},
+    {2, 2, 2, 4},
+    {1827, 0, 13, 4343},
+    {1832, 0, 17, 4344},
+    {1879, 0, 2, 4},
+    {25, 5, 15, 4},
+    {1722, 0, 15, 6},
+    {26, 5, 0, 4442},
+    {70, 2, 0, 4400},
+    {1906, 0, 0, 4396},
+    {83, 3, 0, 4381},
+    {20, 5, 0, 4370},
+    {73, 3, 0, 4357},
+    {84225, 1, 2, 5},
+    {67110, 1, 2, 3},
+    {19, 5, 2, 4},
+    {31755, 1, 19, 3},
+    {19, 5, 2, 4},
+    {881, 0, 0, 4361},
+    {17, 5, 2, 4},
+    {58622, 1, 15, 4},
+    {17, 5, 0, 4363},
+    {37992, 1, 11, 3},
+    {1306, 0, 0, 4367},
+    {913, 0, 17, 4365},
+    {55, 2, 2, 3},
+    {75, 3, 15, 2},
+    {41077, 1, 17, 4368},
+    {1, 2, 2, 3},
+    {57753, 1, 15, 4},
+    {22, 5, 13, 4371},
+    {74, 3, 0, 4378},
+    {1397, 0, 2, 5},
+    {8, 2, 0, 4376},
+    {73, 3, 2, 3},
+    {23, 5, 15, 4},
+    {91068, 1, 2, 4},
+    {23, 5, 11, 3},
+    {1310, 0, 2, 3},
+    {25, 5, 2, 2},
+    {80, 3, 15, 4},
+    {2, 2, 17, 4382},
+    {6487, 1, 13, 4383},
+    {1157, 0, 0, 4386},
+    {93, 3, 21, 4385},
+    {427, 0, 11, 3},
+    {11, 2, 0, 4390},
+    {7, 2, 17, 4388},
+    {97, 3, 13, 4389},
+    {21, 5, 3, 1},
+    {17, 5, 9, 4391},
+    {1880, 0, 17, 4392},
+    {1884, 0, 13, 4393},
+    {1890, 0, 0, 4395},
+    {24, 5, 19, 3},
+    {21, 5, 15, 4},
+    {6102, 1, 13, 4397},
+    {6186, 1, 2, 3},
+    {18, 5, 5, 4399},
+    {21, 5, 11, 3},
+    {162692, 1, 0, 4438},
+    {99, 3, 0, 4434},
+    {16, 5, 0, 4406},
+    {78, 3, 0, 4405},
+    {62023, 1, 11, 4},
+    {83, 3, 15, 2},
+    {1081, 0, 0, 4432},
+    {23, 5, 0, 4425},
+    {18, 5, 0, 4415},
+    {901, 0, 0, 4414},
+    {891, 0, 2, 4},
+    {17, 5, 2, 2},
+    {240, 2, 2, 4},
+    {76, 3, 15, 2},
+    {44635, 1, 15, 2},
+    {22, 5, 0, 4421},
+    {75, 3, 2, 4},
+    {111, 2, 17, 4418},
+    {20, 5, 0, 4420},
+    {163, 2, 11, 4},
+    {55879, 1, 11, 3},
+    {256, 0, 13, 4422},
+    {75, 3, 0, 4424},
+    {55760, 1, 15, 2},
+    {911, 0, 19, 3},
+    {107, 2, 9, 4426},
+    {24, 5, 0, 4430},
+    {906, 0, 2, 3},
+    {896, 0, 2, 2},
+    {69405, 1, 11, 3},
+    {75, 3, 13, 4431},
+    {143, 2, 11, 4},
+    {1310, 0, 33, 4433},
+    {24, 5, 19, 3},
+    {505, 0, 17, 4435},
+    {415, 2, 2, 4},
+    {758, 0, 13, 4437},
+    {105600, 1, 15, 7},
+    {333, 2, 2, 2},
+    {177690, 1, 2, 3},
+    {163892, 1, 13, 4441},
+    {491, 0, 27, 3},
+    {75, 3, 0, 4448},
+    {15, 2, 2, 4},
+    {1, 2, 2, 3},
+    {1391, 0, 13, 4446},
+    {1419, 0, 29, 4447},
+    {28, 5, 15, 8},
+    {162, 2, 0, 4462},
+    {90, 3, 0, 4460},
+    {1098, 0, 0, 4453},
+    {83, 3, 2, 5},
+    {1023, 0, 11, 4},
+    {76, 3, 0, 4457},
+    {1452, 0, 0, 4456},
+    {28, 5, 15, 2},
+    {1486, 0, 23, 3},
+    {86, 3, 13, 4458},
+    {89, 3, 9, 4459},
+    {29, 5, 11, 3},
+    {6, 2, 2, 3},
+    {29, 5, 19, 3},
+    {758, 0, 0, 4471},
+    {226, 0, 0, 4465},
+    {219, 0, 11, 6},
+    {91, 3, 17, 4466},
+    {407, 2, 2, 4},
+    {28, 5, 2, 3},
+    {136033, 1, 0, 4470},
+    {553, 0, 15, 2},
+    {160879, 1, 15, 2},
+    {1310, 0, 2, 3},
+    {30, 5, 31, 6},
+    {380506, 1, 0, 4550},
+    {1151, 0, 0, 4537},
+    {99, 2, 0, 4490},
+    {917, 0, 0, 4487},
+    {94, 3, 2, 6},
+    {18, 5, 0, 4480},
+    {351268, 1, 19, 3},
+    {887, 0, 2, 5},
+    {551, 0, 2, 3},
+    {298318, 1, 2, 3},
+    {24, 5, 0, 4485},
+    {23, 2, 23, 3},
+    {6, 2, 2, 5},
+    {31, 5, 15, 4},
+    {59, 3, 0, 4489},
+    {37, 5, 27, 8},
+    {75, 3, 19, 2},
+    {183, 0, 0, 4503},
+    {342610, 1, 2, 3},
+    {21, 5, 0, 4499},
+    {19, 5, 25, 4494},
+    {20, 5, 2, 6},
+    {253758, 1, 0, 4497},
+    {200643, 1, 27, 7},
+    {167, 0, 25, 4498},
+    {263277, 1, 27, 7},
+    {27, 5, 0, 4502},
+    {22, 5, 2, 7},
+    {139, 0, 27, 7},
+    {96, 3, 35, 7},
+    {87, 3, 0, 4511},
+    {724, 0, 0, 4510},
+    {86, 3, 0, 4509},
+    {18, 5, 0, 4508},
+    {16, 5, 7, 5},
+    {224752, 1, 19, 3},
+    {20, 5, 11, 1},
+    {354886, 1, 27, 3},
+    {353, 2, 0, 4531},
+    {89, 3, 25, 4513},
+    {30, 5, 0, 4527},
+    {660, 0, 0, 4524},
+    {202982, 1, 0, 4517},
+    {190761, 1, 27, 3},
+    {235, 0, 0, 4523},
+    {269113, 1, 0, 4521},
+    {214815, 1, 2, 6},
+    {226, 0, 27, 3},
+    {302, 2, 2, 6},
+    {28, 5, 15, 4},
+    {361, 0, 15, 4},
+    {95, 3, 2, 7},
+    {90, 3, 13, 4526},
+    {900, 0, 23, 3},
+    {271010, 1, 2, 7},
+    {33, 5, 2, 8},
+    {277, 2, 2, 8},
+    {852, 0, 31, 6},
+    {208, 0, 0, 4535},
+    {26, 5, 2, 8},
+    {270512, 1, 25, 4534},
+    {191, 0, 31, 3},
+    {411, 2, 2, 3},
+    {243551, 1, 19, 3},
+    {74, 3, 0, 4547},
+    {1503, 0, 0, 4541},
+    {60, 3, 2, 7},
+    {253512, 1, 27, 7},
+    {220300, 1, 21, 4542},
+    {1749, 0, 0, 4546},
+    {1603, 0, 25, 4544},
+    {28, 5, 29, 4545},
+    {1710, 0, 35, 6},
+    {37, 5, 19, 6},
+    {1298, 0, 29, 4548},
+    {1382, 0, 2, 4},
+    {88, 3, 11, 3},
+    {95, 3, 0, 4624},
+    {1904, 0, 2, 6},
+    {57, 3, 0, 4562},
+    {53, 3, 29, 4554},
+    {282, 0, 0, 4558},
+    {3, 2, 0, 4557},
+    {25, 5, 31, 6},
+    {19, 5, 23, 4},
+    {672, 0, 25, 4559},
+    {443279, 1, 0, 4561},
+    {30, 5, 27, 4},
+    {38, 5, 23, 6},
+    {601930, 1, 0, 4610},
+    {471255, 1, 0, 4580},
+    {86, 3, 0, 4579},
+    {150, 2, 0, 4573},
+    {85, 3, 2, 5},
+    {1337, 0, 0, 4571},
+    {18, 5, 2, 3},
+    {82, 2, 2, 3},
+    {48, 2, 23, 4},
+    {1571, 0, 21, 4572},
+    {1674, 0, 19, 3},
+    {180, 2, 17, 4574},
+    {80, 3, 13, 4575},
+    {85, 3, 2, 4},
+    {21, 5, 17, 4577},
+    {402, 0, 21, 4578},
+    {27, 5, 15, 4},
+    {433815, 1, 23, 3},
+    {476194, 1, 0, 4583},
+    {241, 0, 2, 6},
+    {26, 5, 27, 7},
+    {589526, 1, 2, 6},
+    {1827, 0, 2, 6},
+    {80, 3, 0, 4608},
+    {70, 3, 0, 4605},
+    {489905, 1, 0, 4594},
+    {21, 2, 2, 6},
+    {1641, 0, 17, 4590},
+    {60, 3, 0, 4592},
+    {31, 5, 19, 5},
+    {33, 5, 2, 4},
+    {25, 5, 19, 3},
+    {252, 0, 13, 4595},
+    {20, 2, 0, 4600},
+    {1634, 0, 17, 4597},
+    {27, 5, 0, 4599},
+    {61, 3, 19, 3},
+    {1747, 0, 15, 4},
+    {65, 3, 2, 4},
+    {22, 5, 21, 4602},
+    {62, 3, 17, 4603},
+    {1625, 0, 21, 4604},
+    {30, 5, 19, 5},
+    {76, 3, 2, 4},
+    {724, 0, 25, 4607},
+    {27, 5, 35, 6},
+    {18, 5, 17, 4609},
+    {851, 0, 15, 5},
+    {723894, 1, 0, 4621},
+    {35, 5, 2, 5},
+    {1597, 0, 2, 4},
+    {315, 0, 17, 4614},
+    {308, 2, 0, 4620},
+    {431, 0, 21, 4616},
+    {1200, 0, 0, 4618},
+    {23, 5, 19, 3},
+    {27, 5, 21, 4619},
+    {637654, 1, 19, 5},
+    {354, 2, 19, 5},
+    {1118, 0, 2, 4},
+    {17, 5, 21, 4623},
+    {25, 5, 19, 3},
+    {408269, 1, 13, 4625},
+    {707481, 1, 2, 6},
+    {309, 2, 2, 4},
+    {777, 0, 2, 6},
+    {31, 5, 19, 6},
+    {98, 3, 0, 4843},
+    {118, 0, 0, 4644},
+    {2386470, 1, 0, 4641},
+    {30, 2, 0, 4637},
+    {3, 2, 2, 4},
+    {27, 5, 2, 4},
+    {1, 2, 2, 5},
+    {24, 5, 27, 5},
+    {19, 5, 0, 4639},
+    {1175958, 1, 19, 5},
+    {65, 3, 2, 3},
+    {89, 0, 19, 3},
+    {103, 0, 0, 4643},
+    {22, 5, 7, 0},
+    {20, 5, 15, 2},
+    {5, 2, 0, 4656},
+    {51, 3, 0, 4653},
+    {1119, 0, 0, 4650},
+    {943321, 1, 2, 6},
+    {680, 0, 17, 4649},
+    {27, 5, 27, 4},
+    {26, 5, 25, 4651},
+    {4, 2, 2, 6},
+    {3, 2, 31, 8},
+    {551, 0, 0, 4655},
+    {24, 5, 31, 6},
+    {26, 5, 27, 5},
+    {65, 3, 0, 4821},
+    {913653, 1, 0, 4682},
+    {41, 3, 0, 4666},
+    {326, 2, 0, 4663},
+    {785602, 1, 21, 4661},
+    {31, 5, 2, 5},
+    {816728, 1, 11, 4},
+    {35, 3, 2, 3},
+    {29, 3, 2, 4},
+    {23, 5, 19, 3},
+    {62, 3, 2, 4},
+    {425, 0, 21, 4668},
+    {1233, 0, 0, 4671},
+    {863, 0, 25, 4670},
+    {24, 5, 35, 7},
+    {861174, 1, 0, 4681},
+    {810605, 1, 0, 4680},
+    {58, 3, 2, 7},
+    {782376, 1, 0, 4676},
+    {26, 5, 27, 7},
+    {804085, 1, 2, 5},
+    {1324, 0, 0, 4679},
+    {34, 5, 19, 6},
+    {28, 5, 27, 5},
+    {1273, 0, 35, 6},
+    {48, 3, 27, 5},
+    {338, 0, 0, 4703},
+    {33, 3, 17, 4684},
+    {1185356, 1, 0, 4690},
+    {19, 5, 0, 4688},
+    {18, 5, 2, 7},
+    {236, 0, 27, 5},
+    {189, 0, 2, 4},
+    {142, 0, 19, 6},
+    {54, 3, 0, 4698},
+    {248, 0, 17, 4692},
+    {190, 2, 0, 4697},
+    {22, 5, 25, 4694},
+    {111, 2, 2, 4},
+    {30, 5, 2, 6},
+    {27, 5, 27, 5},
+    {29, 5, 23, 6},
+    {335, 2, 25, 4699},
+    {30, 5, 0, 4702},
+    {22, 5, 21, 4701},
+    {26, 5, 19, 5},
+    {35, 5, 27, 5},
+    {1311, 0, 0, 4754},
+    {38, 3, 0, 4709},
+    {1253380, 1, 13, 4706},
+    {847, 0, 2, 4},
+    {21, 5, 2, 5},
+    {1895943, 1, 23, 4},
+    {57, 3, 0, 4735},
+    {71, 2, 0, 4715},
+    {30, 5, 0, 4714},
+    {25, 5, 25, 4713},
+    {40, 2, 27, 5},
+    {906, 0, 27, 4},
+    {1526688, 1, 0, 4717},
+    {32, 5, 23, 4},
+    {44, 3, 0, 4720},
+    {28, 5, 25, 4719},
+    {33, 5, 19, 6},
+    {393, 2, 2, 5},
+    {2058965, 1, 0, 4728},
+    {1656570, 1, 0, 4727},
+    {56, 3, 2, 6},
+    {52, 3, 25, 4725},
+    {25, 5, 2, 5},
+    {23, 5, 19, 6},
+    {22, 5, 23, 4},
+    {23, 5, 21, 4729},
+    {50, 3, 0, 4732},
+    {46, 3, 21, 4731},
+    {25, 5, 27, 5},
+    {995, 0, 2, 6},
+    {25, 5, 25, 4734},
+    {31, 5, 23, 6},
+    {1050205, 1, 0, 4741},
+    {152, 2, 0, 4739},
+    {1207, 0, 2, 4},
+    {25, 5, 19, 3},
+    {30, 5, 21, 4740},
+    {891, 0, 19, 5},
+    {27, 5, 0, 4744},
+    {26, 5, 2, 5},
+    {22, 5, 23, 6},
+    {58, 3, 0, 4746},
+    {986, 0, 19, 6},
+    {31, 5, 0, 4751},
+    {1965895, 1, 0, 4749},
+    {60, 3, 23, 4},
+    {259, 2, 2, 5},
+    {2482784, 1, 23, 4},
+    {1036, 0, 2, 6},
+    {342, 2, 2, 4},
+    {37, 5, 23, 6},
+    {941885, 1, 0, 4757},
+    {1574, 0, 2, 6},
+    {24, 5, 27, 5},
+    {16, 3, 0, 4759},
+    {19, 2, 19, 5},
+    {34, 5, 0, 4789},
+    {953771, 1, 0, 4762},
+    {23, 5, 11, 4},
+    {87, 2, 0, 4770},
+    {73, 2, 2, 4},
+    {43, 2, 0, 4768},
+    {30, 5, 0, 4767},
+    {11, 2, 23, 4},
+    {1851, 0, 15, 4},
+    {59, 3, 2, 4},
+    {24, 5, 19, 5},
+    {384, 2, 0, 4785},
+    {1907, 0, 0, 4783},
+    {52, 3, 0, 4777},
+    {1488, 0, 17, 4774},
+    {48, 3, 0, 4776},
+    {2465696, 1, 23, 4},
+    {1870, 0, 19, 5},
+    {61, 3, 0, 4782},
+    {58, 3, 0, 4781},
+    {1514, 0, 21, 4780},
+    {55, 3, 19, 5},
+    {1479, 0, 27, 5},
+    {1245835, 1, 23, 4},
+    {1912, 0, 17, 4784},
+    {31, 5, 27, 4},
+    {26, 5, 17, 4786},
+    {1351052, 1, 0, 4788},
+    {28, 5, 23, 4},
+    {28, 5, 19, 5},
+    {40, 5, 0, 4819},
+    {61, 2, 0, 4794},
+    {38, 3, 2, 4},
+    {1972074, 1, 2, 4},
+    {29, 3, 23, 3},
+    {367, 2, 0, 4817},
+    {34, 3, 0, 4807},
+    {29, 3, 0, 4806},
+    {22, 3, 0, 4799},
+    {72, 2, 15, 5},
+    {218, 2, 2, 5},
+    {37, 5, 0, 4804},
+    {129, 2, 17, 4802},
+    {1301461, 1, 2, 5},
+    {165, 2, 23, 6},
+    {38, 5, 25, 4805},
+    {26, 3, 27, 5},
+    {1733, 0, 15, 4},
+    {1288222, 1, 0, 4810},
+    {1517, 0, 2, 5},
+    {35, 5, 23, 6},
+    {1896, 0, 2, 5},
+    {56, 3, 0, 4816},
+    {48, 3, 17, 4813},
+    {53, 3, 0, 4815},
+    {1815, 0, 23, 4},
+    {1457968, 1, 19, 5},
+    {61, 3, 27, 4},
+    {1485, 0, 17, 4818},
+    {38, 5, 23, 3},
+    {1586, 0, 2, 5},
+    {1493, 0, 27, 4},
+    {764242, 1, 0, 4824},
+    {253, 2, 2, 2},
+    {763358, 1, 19, 6},
+    {377, 2, 0, 4839},
+    {1428, 0, 0, 4837},
+    {303, 2, 0, 4829},
+    {87, 3, 17, 4828},
+    {215, 0, 23, 4},
+    {21, 5, 0, 4832},
+    {20, 5, 2, 4},
+    {488, 0, 23, 4},
+    {27, 5, 0, 4835},
+    {1595732, 1, 2, 4},
+    {960563, 1, 15, 5},
+    {185, 0, 21, 4836},
+    {30, 5, 19, 5},
+    {1792, 0, 2, 3},
+    {115, 2, 19, 5},
+    {73, 3, 2, 3},
+    {1190064, 1, 5, 4841},
+    {1380, 0, 17, 4842},
+    {30, 5, 19, 3},
+    {32, 5, 0, 4847},
+    {804, 0, 2, 6},
+    {29, 5, 2, 6},
+    {722, 0, 19, 5},
+    {99, 3, 0, 4850},
+    {169, 2, 2, 6},
+    {33, 5, 27, 4},
+    {1320, 0, 27, 5},
+    {65, 3, 0, 5327},
+    {755585, 1, 0, 4952},
+    {490, 0, 0, 4867},
+    {159576, 1, 0, 4863},
+    {370, 0, 0, 4861},
+    {33, 3, 21, 4857},
+    {57, 3, 0, 4860},
+    {88680, 1, 2, 4},
+    {21, 5, 35, 7},
+    {20, 5, 27, 4},
+    {372, 0, 5, 4862},
+    {396, 0, 15, 5},
+    {232, 0, 21, 4864},
+    {58, 3, 0, 4866},
+    {477820, 1, 15, 5},
+    {19, 5, 19, 3},
+    {21, 3, 0, 4871},
+    {915, 2, 2, 5},
+    {579, 2, 9, 4870},
+    {1409, 0, 15, 5},
+    {1727, 2, 0, 4940},
+    {1404, 0, 0, 4920},
+    {920, 0, 0, 4879},
+    {152063, 1, 17, 4875},
+    {25, 5, 21, 4876},
+    {30, 5, 0, 4878},
+    {28, 5, 27, 5},
+    {230306, 1, 23, 4},
+    {1083, 0, 0, 4898},
+    {48, 3, 0, 4888},
+    {25, 5, 0, 4886},
+    {16, 5, 21, 4883},
+    {21, 5, 2, 5},
+    {17, 5, 2, 3},
+    {979, 0, 23, 3},
+    {31, 5, 2, 3},
+    {976, 0, 15, 4},
+    {34, 5, 0, 4896},
+    {262312, 1, 0, 4894},
+    {99492, 1, 2, 2},
+    {970, 2, 2, 4},
+    {1028, 0, 9, 4893},
+    {25, 5, 19, 3},
+    {997, 0, 2, 4},
+    {27, 5, 7, 0},
+    {36, 5, 2, 4},
+    {101302, 1, 15, 2},
+    {37, 5, 0, 4919},
+    {1247, 2, 2, 5},
+    {1078, 2, 0, 4918},
+    {1246, 0, 0, 4904},
+    {1133, 0, 17, 4903},
+    {20, 5, 19, 3},
+    {120602, 1, 0, 4915},
+    {44937, 1, 0, 4907},
+    {27, 5, 19, 5},
+    {1395, 0, 0, 4914},
+    {34, 5, 2, 3},
+    {51, 3, 0, 4912},
+    {28, 5, 2, 4},
+    {16, 5, 19, 3},
+    {1286, 0, 2, 4},
+    {20, 5, 19, 2},
+    {21, 5, 15, 2},
+    {1343, 0, 2, 4},
+    {31, 3, 21, 4917},
+    {43, 3, 19, 5},
+    {1189, 2, 11, 4},
+    {1133, 0, 27, 5},
+    {1924, 0, 0, 4938},
+    {45, 3, 0, 4927},
+    {553651, 1, 17, 4923},
+    {1480, 0, 29, 4924},
+    {1823, 0, 2, 5},
+    {1524, 0, 2, 4},
+    {29, 5, 23, 4},
+    {402217, 1, 0, 4934},
+    {629, 2, 0, 4930},
+    {21, 5, 35, 6},
+    {58, 3, 2, 7},
+    {17, 5, 29, 4932},
+    {1135, 2, 21, 4933},
+    {28, 5, 27, 4},
+    {973, 2, 0, 4936},
+    {708, 2, 19, 3},
+    {1631, 0, 21, 4937},
+    {1789, 0, 19, 6},
+    {146870, 1, 2, 4},
+    {1927, 0, 31, 5},
+    {44, 3, 21, 4941},
+    {1408, 0, 0, 4947},
+    {23, 5, 0, 4944},
+    {2655, 2, 27, 4},
+    {53, 3, 21, 4945},
+    {734554, 1, 2, 5},
+    {30, 5, 23, 4},
+    {1481, 0, 0, 4950},
+    {58, 3, 25, 4949},
+    {31, 5, 19, 5},
+    {1927, 0, 21, 4951},
+    {29, 5, 23, 4},
+    {35, 3, 0, 5023},
+    {1587, 0, 0, 5005},
+    {1776, 2, 0, 4985},
+    {813, 0, 0, 4969},
+    {33, 3, 0, 4965},
+    {6119069, 1, 0, 4963},
+    {23, 3, 21, 4959},
+    {20, 5, 17, 4960},
+    {688, 2, 2, 3},
+    {29, 3, 13, 4962},
+    {34, 5, 23, 4},
+    {481, 0, 2, 6},
+    {239, 0, 15, 4},
+    {2969069, 1, 0, 4967},
+    {30, 5, 23, 6},
+    {29, 5, 21, 4968},
+    {409, 0, 15, 5},
+    {1491, 0, 2, 4},
+    {1087, 2, 0, 4983},
+    {1120, 0, 0, 4974},
+    {1467454, 1, 17, 4973},
+    {707, 2, 15, 4},
+    {912, 2, 0, 4981},
+    {1337, 0, 17, 4976},
+    {448, 2, 0, 4978},
+    {27, 5, 15, 4},
+    {28, 3, 0, 4980},
+    {32, 5, 23, 4},
+    {40, 5, 15, 4},
+    {1224, 0, 13, 4982},
+    {2668835, 1, 23, 4},
+    {894, 0, 2, 4},
+    {33, 5, 23, 4},
+    {35, 5, 0, 5001},
+    {25, 5, 0, 4988},
+    {4046138, 1, 19, 5},
+    {8980, 2, 2, 4},
+    {602, 0, 21, 4990},
+    {1112, 0, 0, 4997},
+    {1047, 0, 2, 5},
+    {1736553, 1, 17, 4993},
+    {4748849, 1, 2, 5},
+    {1959335, 1, 21, 4995},
+    {961, 0, 17, 4996},
+    {32, 5, 19, 5},
+    {31, 5, 2, 4},
+    {1206, 0, 17, 4999},
+    {31, 3, 2, 5},
+    {26, 5, 23, 4},
+    {45, 5, 2, 5},
+    {1180, 0, 0, 5004},
+    {954, 0, 19, 5},
+    {1531004, 1, 27, 4},
+    {1808, 2, 0, 5022},
+    {42, 5, 0, 5020},
+    {1589, 0, 0, 5009},
+    {30, 5, 23, 6},
+    {10, 3, 17, 5010},
+    {1418625, 1, 0, 5016},
+    {1149, 2, 0, 5013},
+    {1934, 0, 19, 5},
+    {16, 3, 25, 5014},
+    {1899, 0, 2, 5},
+    {1781, 0, 23, 4},
+    {1801, 0, 2, 5},
+    {1517614, 1, 21, 5018},
+    {22, 3, 17, 5019},
+    {2138919, 1, 19, 5},
+    {18, 3, 2, 5},
+    {48, 5, 27, 5},
+    {33, 3, 27, 4},
+    {4732243, 1, 0, 5304},
+    {680, 0, 0, 5109},
+    {38, 5, 0, 5095},
+    {1112626, 1, 0, 5036},
+    {237, 0, 21, 5028},
+    {415, 0, 0, 5030},
+    {893823, 1, 19, 3},
+    {64, 3, 2, 5},
+    {50, 3, 0, 5033},
+    {21, 5, 23, 4},
+    {998648, 1, 21, 5034},
+    {23, 5, 2, 4},
+    {503, 0, 19, 5},
+    {303, 0, 0, 5057},
+    {49, 3, 0, 5039},
+    {1874933, 1, 19, 6},
+    {2568009, 1, 0, 5048},
+    {2566286, 1, 0, 5047},
+    {57, 3, 21, 5042},
+    {63, 3, 0, 5046},
+    {249, 0, 0, 5045},
+    {22, 5, 23, 4},
+    {24, 5, 19, 3},
+    {31, 5, 19, 5},
+    {26, 5, 15, 2},
+    {957, 2, 0, 5052},
+    {19, 5, 21, 5050},
+    {31, 5, 17, 5051},
+    {103, 0, 19, 5},
+    {2167, 2, 0, 5054},
+    {1693, 2, 23, 6},
+    {2894838, 1, 17, 5055},
+    {3241576, 1, 2, 5},
+    {24, 5, 19, 5},
+    {21, 5, 0, 5061},
+    {2837, 2, 2, 6},
+    {18, 5, 25, 5060},
+    {605, 0, 19, 5},
+    {1502, 2, 0, 5073},
+    {37, 5, 0, 5072},
+    {615, 0, 2, 4},
+    {1848493, 1, 0, 5066},
+    {32, 5, 19, 5},
+    {23, 5, 21, 5067},
+    {2306252, 1, 2, 4},
+    {63, 3, 2, 4},
+    {61, 3, 2, 5},
+    {60, 3, 2, 6},
+    {31, 5, 19, 5},
+    {691, 2, 15, 5},
+    {331, 0, 25, 5074},
+    {620, 0, 0, 5091},
+    {3945, 2, 2, 4},
+    {445, 0, 0, 5078},
+    {31, 5, 23, 6},
+    {3133, 2, 0, 5087},
+    {2506129, 1, 0, 5084},
+    {605, 0, 2, 4},
+    {61, 3, 2, 5},
+    {34, 5, 17, 5083},
+    {35, 5, 23, 4},
+    {32, 5, 2, 4},
+    {50, 3, 2, 3},
+    {27, 5, 23, 4},
+    {29, 5, 0, 5089},
+    {2822706, 1, 19, 6},
+    {3588, 2, 21, 5090},
+    {31, 5, 19, 6},
+    {3337569, 1, 2, 5},
+    {3538, 2, 0, 5094},
+    {28, 5, 27, 4},
+    {33, 5, 23, 6},
+    {40, 5, 0, 5106},
+    {62, 3, 0, 5103},
+    {554, 0, 0, 5102},
+    {39, 5, 0, 5100},
+    {1082, 2, 23, 6},
+    {2318772, 1, 25, 5101},
+    {58, 3, 19, 5},
+    {1862425, 1, 19, 5},
+    {64, 3, 2, 6},
+    {1437, 2, 25, 5105},
+    {39, 5, 19, 6},
+    {3223, 2, 25, 5107},
+    {42, 5, 2, 4},
+    {295, 0, 19, 5},
+    {36, 5, 0, 5251},
+    {2051904, 1, 0, 5201},
+    {701, 2, 0, 5133},
+    {63, 3, 0, 5131},
+    {647, 2, 0, 5129},
+    {531, 2, 21, 5115},
+    {568, 2, 0, 5124},
+    {35, 5, 2, 4},
+    {37, 3, 17, 5118},
+    {1087835, 1, 21, 5119},
+    {28, 5, 17, 5120},
+    {30, 5, 21, 5121},
+    {1432, 0, 0, 5123},
+    {1320, 0, 19, 5},
+    {1232347, 1, 27, 4},
+    {53, 3, 2, 4},
+    {40, 3, 2, 5},
+    {38, 3, 0, 5128},
+    {26, 5, 23, 4},
+    {30, 5, 19, 5},
+    {1200, 0, 2, 5},
+    {28, 5, 19, 5},
+    {1351052, 1, 2, 4},
+    {1149699, 1, 19, 5},
+    {36, 3, 17, 5134},
+    {802, 2, 0, 5142},
+    {34, 5, 0, 5141},
+    {52, 3, 0, 5139},
+    {881439, 1, 2, 4},
+    {29, 5, 23, 4},
+    {60, 3, 2, 4},
+    {890641, 1, 19, 3},
+    {857179, 1, 11, 5},
+    {980780, 1, 21, 5143},
+    {26, 5, 0, 5160},
+    {1002, 0, 0, 5149},
+    {24, 5, 2, 6},
+    {38, 3, 25, 5147},
+    {23, 5, 2, 4},
+    {1575432, 1, 19, 5},
+    {47, 3, 17, 5150},
+    {1881236, 1, 0, 5157},
+    {22, 5, 17, 5152},
+    {25, 5, 2, 4},
+    {23, 5, 0, 5155},
+    {1220, 2, 23, 4},
+    {24, 5, 17, 5156},
+    {1555852, 1, 19, 5},
+    {1978334, 1, 0, 5159},
+    {52, 3, 23, 6},
+    {1522, 0, 23, 4},
+    {31, 5, 0, 5186},
+    {1662, 0, 0, 5181},
+    {57, 3, 2, 4},
+    {2442, 2, 2, 4},
+    {53, 3, 0, 5176},
+    {28, 5, 0, 5170},
+    {27, 5, 0, 5168},
+    {41, 3, 23, 4},
+    {1667, 2, 2, 4},
+    {46, 3, 23, 4},
+    {29, 5, 0, 5174},
+    {46, 3, 2, 5},
+    {45, 3, 2, 4},
+    {928, 2, 19, 5},
+    {1413, 0, 17, 5175},
+    {51, 3, 23, 4},
+    {54, 3, 0, 5178},
+    {1306, 0, 23, 3},
+    {1267, 0, 21, 5179},
+    {1433, 0, 17, 5180},
+    {28, 5, 19, 5},
+    {53, 3, 0, 5185},
+    {29, 5, 21, 5183},
+    {1686372, 1, 17, 5184},
+    {1796, 0, 23, 4},
+    {1028, 2, 19, 5},
+    {32, 5, 0, 5189},
+    {38, 3, 21, 5188},
+    {62, 3, 19, 5},
+    {34, 5, 0, 5195},
+    {33, 5, 0, 5194},
+    {1562, 0, 2, 5},
+    {3867, 2, 2, 6},
+    {1069, 0, 23, 4},
+    {41, 3, 23, 4},
+    {35, 5, 0, 5198},
+    {1974652, 1, 2, 5},
+    {1680, 0, 19, 5},
+    {976, 2, 2, 4},
+    {914, 2, 21, 5200},
+    {1520, 0, 27, 5},
+    {473, 2, 0, 5207},
+    {54, 3, 2, 6},
+    {25, 5, 25, 5204},
+    {30, 5, 0, 5206},
+    {1057, 0, 23, 4},
+    {455, 2, 27, 5},
+    {61, 3, 0, 5249},
+    {41, 3, 0, 5214},
+    {1151, 2, 2, 5},
+    {1125, 0, 17, 5211},
+    {28, 5, 21, 5212},
+    {30, 5, 17, 5213},
+    {34, 5, 23, 4},
+    {26, 5, 21, 5215},
+    {1254, 2, 0, 5231},
+    {1513, 0, 2, 5},
+    {34, 5, 0, 5228},
+    {29, 5, 0, 5225},
+    {27, 5, 21, 5220},
+    {3000915, 1, 2, 5},
+    {28, 5, 17, 5222},
+    {944, 2, 17, 5223},
+    {1219, 2, 2, 5},
+    {1027, 0, 19, 5},
+    {30, 5, 2, 5},
+    {48, 3, 2, 4},
+    {1117, 0, 23, 4},
+    {35, 5, 2, 4},
+    {868, 2, 17, 5230},
+    {1202, 2, 23, 4},
+    {1295, 2, 0, 5233},
+    {33, 5, 23, 6},
+    {1434, 2, 0, 5235},
+    {808, 0, 19, 5},
+    {28, 5, 0, 5242},
+    {27, 5, 0, 5240},
+    {2655, 2, 0, 5239},
+    {962, 0, 23, 4},
+    {55, 3, 23, 6},
+    {2387, 2, 21, 5241},
+    {2798195, 1, 27, 4},
+    {2455702, 1, 2, 5},
+    {2349648, 1, 2, 4},
+    {30, 5, 21, 5245},
+    {31, 5, 17, 5246},
+    {1374, 0, 0, 5248},
+    {1276, 0, 23, 6},
+    {32, 5, 19, 5},
+    {3219, 2, 2, 4},
+    {698, 0, 19, 5},
+    {47, 5, 0, 5300},
+    {1524, 0, 0, 5278},
+    {1767, 2, 0, 5268},
+    {1426, 0, 2, 4},
+    {1116, 0, 0, 5257},
+    {720, 0, 15, 4},
+    {2683452, 1, 0, 5267},
+    {2278012, 1, 2, 6},
+    {38, 5, 0, 5266},
+    {1120, 2, 2, 5},
+    {2198006, 1, 2, 5},
+    {37, 5, 0, 5265},
+    {50, 3, 17, 5264},
+    {1503198, 1, 19, 6},
+    {1405204, 1, 27, 4},
+    {1358, 0, 23, 6},
+    {1355, 0, 19, 5},
+    {39, 5, 0, 5276},
+    {37, 5, 0, 5274},
+    {2969069, 1, 2, 4},
+    {2411, 2, 21, 5272},
+    {1307, 0, 17, 5273},
+    {1478, 0, 23, 4},
+    {3029, 2, 2, 5},
+    {2994476, 1, 23, 6},
+    {39, 3, 17, 5277},
+    {56, 3, 23, 4},
+    {1782678, 1, 2, 5},
+    {2683, 2, 2, 5},
+    {1859, 2, 0, 5298},
+    {1596, 0, 21, 5282},
+    {40, 3, 17, 5283},
+    {41, 5, 0, 5292},
+    {1039, 2, 0, 5289},
+    {1859, 0, 0, 5288},
+    {37, 5, 2, 5},
+    {1234843, 1, 19, 5},
+    {60, 3, 19, 5},
+    {37, 5, 2, 5},
+    {51, 3, 2, 6},
+    {44, 3, 27, 5},
+    {60, 3, 0, 5296},
+    {1029113, 1, 21, 5294},
+    {57, 3, 2, 4},
+    {1805, 0, 19, 6},
+    {1146582, 1, 25, 5297},
+    {45, 5, 23, 6},
+    {1552545, 1, 17, 5299},
+    {42, 5, 19, 5},
+    {1567790, 1, 25, 5301},
+    {853, 2, 21, 5302},
+    {1688, 0, 17, 5303},
+    {1745, 0, 27, 5},
+    {2058, 2, 0, 5309},
+    {6937089, 1, 0, 5308},
+    {766, 0, 25, 5307},
+    {27, 5, 27, 5},
+    {313, 0, 23, 4},
+    {15666, 2, 0, 5322},
+    {422, 0, 0, 5320},
+    {8062281, 1, 0, 5318},
+    {244, 0, 0, 5314},
+    {21, 5, 27, 4},
+    {26, 5, 21, 5315},
+    {4764565, 1, 0, 5317},
+    {30, 5, 27, 4},
+    {34, 5, 19, 6},
+    {60, 3, 2, 4},
+    {24, 5, 27, 5},
+    {56, 3, 2, 4},
+    {3945, 2, 19, 5},
+    {7303399, 1, 0, 5325},
+    {219, 0, 2, 2},
+    {28, 5, 11, 3},
+    {252, 0, 25, 5326},
+    {32, 5, 23, 4},
+    {567931, 1, 0, 5507},
+    {635, 0, 0, 5443},
+    {411, 0, 0, 5366},
+    {249, 0, 0, 5348},
+    {78, 3, 0, 5336},
+    {355341, 1, 17, 5333},
+    {239, 0, 2, 3},
+    {26, 5, 17, 5335},
+    {69, 3, 19, 3},
+    {576, 2, 0, 5343},
+    {328373, 1, 2, 3},
+    {478, 2, 13, 5339},
+    {166, 0, 2, 6},
+    {162, 0, 0, 5342},
+    {22, 5, 27, 7},
+    {21, 5, 31, 6},
+    {100, 3, 13, 5344},
+    {41, 5, 2, 4},
+    {27, 5, 0, 5347},
+    {22, 5, 23, 4},
+    {33, 5, 15, 5},
+    {329348, 1, 0, 5351},
+    {404, 0, 13, 5350},
+    {407, 0, 19, 3},
+    {409, 0, 2, 1},
+    {73, 3, 13, 5353},
+    {534231, 1, 0, 5364},
+    {87, 3, 0, 5359},
+    {300, 0, 0, 5358},
+    {265, 0, 17, 5357},
+    {21, 5, 15, 4},
+    {24, 5, 23, 4},
+    {364, 0, 13, 5360},
+    {94, 3, 13, 5361},
+    {97, 3, 17, 5362},
+    {23, 5, 17, 5363},
+    {1536, 2, 11, 5},
+    {96, 3, 2, 4},
+    {22, 5, 19, 5},
+    {79, 3, 0, 5372},
+    {75, 3, 2, 3},
+    {162059, 1, 17, 5369},
+    {521, 0, 13, 5370},
+    {545, 0, 2, 3},
+    {284806, 1, 15, 4},
+    {494, 0, 0, 5423},
+    {98, 3, 0, 5377},
+    {430, 0, 2, 4},
+    {318468, 1, 2, 4},
+    {21, 5, 19, 3},
+    {180548, 1, 0, 5382},
+    {811, 2, 17, 5379},
+    {153144, 1, 13, 5380},
+    {24, 5, 17, 5381},
+    {425, 0, 19, 3},
+    {423, 0, 0, 5390},
+    {304076, 1, 13, 5384},
+    {17, 5, 17, 5385},
+    {99, 3, 13, 5386},
+    {21, 5, 2, 3},
+    {19, 5, 0, 5389},
+    {415868, 1, 11, 3},
+    {420, 0, 19, 3},
+    {99, 3, 0, 5397},
+    {467, 0, 0, 5396},
+    {318751, 1, 2, 3},
+    {318224, 1, 0, 5395},
+    {1110, 2, 11, 4},
+    {24, 5, 19, 5},
+    {476, 0, 19, 5},
+    {247370, 1, 0, 5416},
+    {1284, 2, 2, 3},
+    {187024, 1, 0, 5401},
+    {23, 5, 11, 3},
+    {491, 0, 2, 3},
+    {197278, 1, 0, 5404},
+    {194520, 1, 19, 5},
+    {26, 5, 0, 5414},
+    {1025, 2, 2, 4},
+    {208833, 1, 0, 5409},
+    {200403, 1, 2, 4},
+    {23, 5, 15, 4},
+    {214535, 1, 13, 5410},
+    {480, 0, 2, 4},
+    {469, 0, 2, 3},
+    {25, 5, 2, 3},
+    {237225, 1, 19, 3},
+    {900, 2, 17, 5415},
+    {438, 0, 19, 5},
+    {337387, 1, 0, 5418},
+    {427, 0, 19, 3},
+    {20, 5, 0, 5422},
+    {18, 5, 0, 5421},
+    {1063, 2, 19, 2},
+    {429, 0, 15, 4},
+    {26, 5, 15, 4},
+    {171523, 1, 0, 5426},
+    {561, 0, 2, 3},
+    {512, 0, 15, 4},
+    {24, 5, 0, 5436},
+    {97, 3, 17, 5428},
+    {514, 0, 0, 5431},
+    {1239, 2, 2, 3},
+    {276435, 1, 19, 2},
+    {274875, 1, 9, 5432},
+    {417757, 1, 2, 3},
+    {851, 2, 0, 5435},
+    {21, 5, 15, 2},
+    {549, 0, 19, 2},
+    {293643, 1, 0, 5442},
+    {28, 5, 0, 5441},
+    {25, 5, 2, 4},
+    {512, 0, 13, 5440},
+    {816, 2, 11, 3},
+    {254130, 1, 19, 2},
+    {503, 0, 11, 4},
+    {112235, 1, 0, 5446},
+    {97, 3, 2, 2},
+    {15, 5, 15, 5},
+    {1822, 0, 0, 5499},
+    {98, 3, 0, 5487},
+    {929, 2, 0, 5456},
+    {770, 0, 17, 5450},
+    {1743, 0, 0, 5453},
+    {414839, 1, 13, 5452},
+    {36, 5, 19, 3},
+    {34, 5, 2, 2},
+    {434121, 1, 17, 5455},
+    {30, 5, 19, 3},
+    {3911, 2, 0, 5481},
+    {222627, 1, 0, 5478},
+    {143634, 1, 21, 5459},
+    {1576, 0, 2, 4},
+    {1345, 0, 0, 5463},
+    {217219, 1, 2, 3},
+    {200495, 1, 15, 4},
+    {2721, 2, 0, 5477},
+    {92, 3, 2, 3},
+    {35, 5, 0, 5476},
+    {2249, 2, 0, 5473},
+    {82, 3, 17, 5468},
+    {2021, 2, 2, 3},
+    {27, 5, 0, 5471},
+    {24, 5, 23, 4},
+    {189906, 1, 13, 5472},
+    {34, 5, 19, 3},
+    {82, 3, 13, 5474},
+    {24, 5, 13, 5475},
+    {29, 5, 19, 3},
+    {79, 3, 15, 4},
+    {203508, 1, 19, 5},
+    {921, 0, 2, 4},
+    {353384, 1, 2, 4},
+    {778, 0, 19, 3},
+    {93, 3, 2, 5},
+    {36, 5, 2, 3},
+    {67, 3, 13, 5484},
+    {5083, 2, 13, 5485},
+    {6974, 2, 17, 5486},
+    {26, 5, 19, 3},
+    {99, 3, 0, 5491},
+    {1050, 0, 17, 5489},
+    {1587, 0, 2, 4},
+    {1415, 0, 11, 1},
+    {1086, 2, 0, 5495},
+    {1741, 0, 2, 4},
+    {433, 2, 2, 3},
+    {26, 5, 15, 4},
+    {513425, 1, 0, 5498},
+    {25, 5, 2, 2},
+    {1517, 0, 19, 3},
+    {20, 5, 23, 4},
+    {945, 2, 0, 5501},
+    {31, 5, 19, 2},
+    {33, 5, 0, 5503},
+    {95, 3, 23, 4},
+    {34, 5, 0, 5505},
+    {326462, 1, 23, 6},
+    {74, 3, 21, 5506},
+    {1802, 2, 15, 4},
+    {91, 3, 0, 5746},
+    {3122605, 1, 0, 5711},
+    {1615, 0, 0, 5687},
+    {1926, 2, 0, 5622},
+    {66, 3, 0, 5521},
+    {871942, 1, 0, 5514},
+    {843, 0, 11, 4},
+    {564, 0, 2, 3},
+    {2755689, 1, 2, 5},
+    {550, 0, 2, 5},
+    {992, 2, 0, 5520},
+    {33, 5, 21, 5519},
+    {38, 5, 19, 3},
+    {1468907, 1, 15, 4},
+    {1266, 0, 0, 5595},
+    {74, 3, 0, 5554},
+    {40, 5, 0, 5552},
+    {245, 0, 0, 5527},
+    {221, 0, 2, 3},
+    {18, 5, 23, 4},
+    {67, 3, 0, 5529},
+    {1166930, 1, 15, 4},
+    {1104, 0, 0, 5551},
+    {70, 3, 0, 5540},
+    {949426, 1, 17, 5532},
+    {39, 5, 2, 5},
+    {1257, 2, 2, 4},
+    {514, 0, 0, 5538},
+    {1159, 2, 2, 5},
+    {442, 0, 2, 5},
+    {766, 2, 23, 4},
+    {27, 5, 2, 4},
+    {1682691, 1, 23, 4},
+    {1766480, 1, 0, 5550},
+    {18, 5, 21, 5542},
+    {1112, 2, 0, 5549},
+    {993, 2, 2, 3},
+    {29, 5, 2, 3},
+    {23, 5, 2, 4},
+    {848230, 1, 13, 5547},
+    {1120575, 1, 2, 4},
+    {20, 5, 19, 3},
+    {38, 5, 19, 3},
+    {1912729, 1, 23, 4},
+    {692, 2, 23, 4},
+    {67, 3, 2, 3},
+    {1497, 2, 15, 4},
+    {640132, 1, 0, 5556},
+    {362, 0, 15, 4},
+    {349, 0, 0, 5572},
+    {117, 0, 0, 5559},
+    {2713942, 1, 23, 3},
+    {1414076, 1, 0, 5561},
+    {651282, 1, 15, 4},
+    {1685280, 1, 0, 5563},
+    {20, 5, 23, 3},
+    {78, 3, 2, 4},
+    {315, 0, 2, 4},
+    {75, 3, 0, 5568},
+    {279, 0, 17, 5567},
+    {34, 5, 15, 4},
+    {76, 3, 0, 5570},
+    {2600949, 1, 19, 5},
+    {38, 5, 2, 5},
+    {34, 5, 15, 4},
+    {86, 3, 0, 5594},
+    {76, 3, 0, 5578},
+    {1161, 0, 2, 3},
+    {1623513, 1, 0, 5577},
+    {521, 0, 19, 2},
+    {2666621, 1, 23, 4},
+    {422, 2, 13, 5579},
+    {1774, 2, 2, 3},
+    {1172, 0, 2, 4},
+    {1697, 2, 0, 5592},
+    {664917, 1, 17, 5583},
+    {1133, 0, 2, 5},
+    {462, 0, 0, 5587},
+    {663, 2, 21, 5586},
+    {19, 5, 15, 4},
+    {29, 5, 2, 3},
+    {2208512, 1, 2, 4},
+    {78, 3, 13, 5590},
+    {22, 5, 17, 5591},
+    {81, 3, 19, 3},
+    {726, 0, 2, 5},
+    {37, 5, 19, 5},
+    {1016711, 1, 23, 3},
+    {853677, 1, 0, 5598},
+    {1366, 2, 2, 3},
+    {37, 5, 19, 3},
+    {494, 2, 17, 5599},
+    {1312, 0, 21, 5600},
+    {900663, 1, 0, 5602},
+    {1479, 0, 19, 3},
+    {31, 5, 0, 5613},
+    {20, 5, 17, 5604},
+    {747, 2, 0, 5608},
+    {1148870, 1, 21, 5606},
+    {1281241, 1, 17, 5607},
+    {70, 3, 19, 5},
+    {1021504, 1, 0, 5610},
+    {1464, 0, 19, 3},
+    {1620016, 1, 0, 5612},
+    {28, 5, 23, 4},
+    {1693681, 1, 15, 4},
+    {37, 5, 0, 5618},
+    {36, 5, 17, 5615},
+    {1359, 0, 13, 5616},
+    {1524, 0, 2, 4},
+    {1396, 0, 19, 3},
+    {2844472, 1, 2, 3},
+    {72, 3, 0, 5621},
+    {38, 5, 23, 4},
+    {75, 3, 27, 5},
+    {1011, 0, 0, 5648},
+    {2069885, 1, 0, 5629},
+    {463, 0, 0, 5626},
+    {3963, 2, 19, 3},
+    {77, 3, 0, 5628},
+    {2047, 2, 15, 4},
+    {2551, 2, 15, 4},
+    {2009, 2, 0, 5631},
+    {31, 5, 15, 2},
+    {415, 0, 0, 5641},
+    {409, 0, 0, 5640},
+    {214, 0, 0, 5637},
+    {138, 0, 0, 5636},
+    {21, 5, 15, 4},
+    {30, 5, 15, 4},
+    {38, 5, 17, 5638},
+    {2052, 2, 13, 5639},
+    {370, 0, 23, 4},
+    {27, 5, 11, 3},
+    {839, 0, 0, 5646},
+    {39, 5, 0, 5645},
+    {2109703, 1, 17, 5644},
+    {2427656, 1, 23, 4},
+    {70, 3, 23, 4},
+    {2994476, 1, 2, 3},
+    {23, 5, 15, 4},
+    {36, 5, 0, 5682},
+    {10817, 2, 0, 5679},
+    {89, 3, 2, 4},
+    {1088378, 1, 0, 5655},
+    {951268, 1, 0, 5654},
+    {31, 5, 15, 4},
+    {29, 5, 23, 4},
+    {1457968, 1, 13, 5656},
+    {1162, 0, 13, 5657},
+    {2276600, 1, 0, 5673},
+    {68, 3, 13, 5659},
+    {2476, 2, 17, 5660},
+    {2240781, 1, 0, 5671},
+    {2237405, 1, 2, 3},
+    {1682691, 1, 0, 5665},
+    {1527, 0, 2, 3},
+    {33, 5, 19, 3},
+    {1903265, 1, 0, 5668},
+    {1345, 0, 2, 4},
+    {28, 5, 23, 4},
+    {25, 5, 0, 5670},
+    {24, 5, 15, 5},
+    {32, 5, 19, 3},
+    {1457, 0, 2, 4},
+    {27, 5, 19, 5},
+    {68, 3, 17, 5674},
+    {2465696, 1, 13, 5675},
+    {28, 5, 17, 5676},
+    {80, 3, 2, 4},
+    {2755689, 1, 13, 5678},
+    {1314, 0, 19, 3},
+    {1525, 0, 2, 4},
+    {1398, 0, 2, 5},
+    {27, 5, 23, 4},
+    {74, 3, 0, 5685},
+    {3066, 2, 2, 4},
+    {38, 5, 23, 4},
+    {5049, 2, 17, 5686},
+    {9314, 2, 15, 2},
+    {2275662, 1, 0, 5709},
+    {709, 2, 0, 5694},
+    {69, 3, 9, 5690},
+    {1874, 0, 2, 5},
+    {34, 5, 0, 5693},
+    {962541, 1, 19, 5},
+    {36, 5, 23, 4},
+    {2013233, 1, 2, 4},
+    {727, 2, 13, 5696},
+    {702604, 1, 17, 5697},
+    {1929, 0, 0, 5708},
+    {71, 3, 0, 5702},
+    {1245073, 1, 17, 5700},
+    {1013, 2, 2, 3},
+    {40, 5, 19, 3},
+    {82, 3, 0, 5706},
+    {1449, 2, 2, 5},
+    {993, 2, 21, 5705},
+    {34, 5, 19, 3},
+    {1820, 0, 2, 5},
+    {1549625, 1, 15, 4},
+    {39, 5, 15, 5},
+    {1756, 0, 2, 3},
+    {33, 5, 23, 3},
+    {408, 0, 0, 5723},
+    {10355818, 1, 0, 5721},
+    {335, 0, 0, 5718},
+    {3247349, 1, 21, 5715},
+    {3454632, 1, 17, 5716},
+    {82, 3, 2, 4},
+    {77, 3, 19, 3},
+    {3368704, 1, 13, 5719},
+    {4427704, 1, 2, 4},
+    {371, 0, 23, 4},
+    {33775677, 1, 2, 4},
+    {31, 5, 23, 3},
+    {420, 0, 9, 5724},
+    {9755, 2, 0, 5743},
+    {33, 5, 0, 5741},
+    {67, 3, 21, 5727},
+    {1062, 0, 0, 5739},
+    {446, 0, 0, 5730},
+    {22, 5, 23, 3},
+    {3584270, 1, 0, 5736},
+    {6699, 2, 2, 5},
+    {6060, 2, 2, 4},
+    {916, 0, 2, 4},
+    {716, 0, 2, 3},
+    {31, 5, 23, 4},
+    {5366796, 1, 2, 4},
+    {28, 5, 2, 5},
+    {75, 3, 19, 5},
+    {78, 3, 5, 5740},
+    {25, 5, 19, 5},
+    {1790, 2, 2, 5},
+    {36, 5, 23, 3},
+    {77, 3, 2, 4},
+    {70, 3, 13, 5745},
+    {29, 5, 19, 3},
+    {100, 3, 0, 5778},
+    {526, 2, 0, 5749},
+    {1196, 0, 19, 6},
+    {2125802, 1, 0, 5765},
+    {92, 3, 17, 5751},
+    {20, 5, 0, 5758},
+    {95, 3, 17, 5753},
+    {98, 3, 0, 5755},
+    {1077, 2, 19, 3},
+    {19, 5, 0, 5757},
+    {856753, 1, 19, 5},
+    {429, 0, 15, 4},
+    {95, 3, 2, 4},
+    {264, 0, 21, 5760},
+    {24, 5, 0, 5763},
+    {93, 3, 2, 4},
+    {21, 5, 19, 3},
+    {29, 5, 2, 4},
+    {409, 0, 19, 5},
+    {4838241, 1, 0, 5777},
+    {14163, 2, 0, 5775},
+    {96, 3, 0, 5774},
+    {819, 0, 2, 5},
+    {4018531, 1, 2, 5},
+    {92, 3, 17, 5771},
+    {30, 5, 0, 5773},
+    {2486297, 1, 19, 3},
+    {95, 3, 19, 5},
+    {2167818, 1, 23, 4},
+    {3086391, 1, 2, 4},
+    {30, 5, 19, 5},
+    {15399, 2, 19, 3},
+    {980, 0, 23, 3},
+    {5146, 1, 0, 5986},
+    {546, 2, 0, 5968},
+    {8716, 0, 0, 5918},
+    {7293, 0, 0, 5812},
+    {3003, 0, 0, 5800},
+    {35, 3, 0, 5786},
+    {29, 3, 23, 6},
+    {2911, 1, 0, 5797},
+    {2417, 1, 0, 5795},
+    {6, 2, 33, 5789},
+    {22, 5, 29, 5790},
+    {1735, 1, 33, 5791},
+    {24, 5, 33, 5792},
+    {44, 3, 29, 5793},
+    {1980, 0, 29, 5794},
+    {28, 5, 35, 7},
+    {61, 3, 2, 7},
+    {30, 5, 19, 5},
+    {268, 2, 29, 5798},
+    {2537, 0, 2, 8},
+    {17, 5, 35, 7},
+    {6937, 0, 2, 4},
+    {26, 3, 21, 5802},
+    {56, 3, 0, 5810},
+    {4781, 1, 2, 4},
+    {54, 3, 2, 6},
+    {213, 2, 0, 5809},
+    {33, 5, 2, 6},
+    {29, 5, 21, 5808},
+    {87, 2, 27, 5},
+    {29, 5, 27, 5},
+    {25, 5, 2, 5},
+    {264, 2, 23, 4},
+    {24, 3, 0, 5892},
+    {33, 5, 0, 5854},
+    {8181, 0, 0, 5819},
+    {7553, 0, 33, 5816},
+    {7564, 0, 2, 8},
+    {28, 5, 2, 7},
+    {25, 5, 31, 6},
+    {3915, 1, 0, 5845},
+    {8280, 0, 33, 5821},
+    {15, 3, 0, 5829},
+    {14, 3, 0, 5826},
+    {8299, 0, 2, 8},
+    {25, 5, 25, 5825},
+    {29, 5, 35, 7},
+    {27, 5, 2, 7},
+    {8305, 0, 2, 8},
+    {25, 5, 35, 7},
+    {20, 3, 0, 5836},
+    {8480, 0, 2, 6},
+    {3461, 1, 2, 8},
+    {8464, 0, 2, 6},
+    {8390, 0, 2, 7},
+    {27, 5, 2, 8},
+    {24, 5, 35, 6},
+    {23, 3, 2, 8},
+    {8677, 0, 0, 5840},
+    {21, 3, 33, 5839},
+    {29, 5, 31, 8},
+    {22, 3, 0, 5844},
+    {3744, 1, 2, 8},
+    {28, 5, 29, 5843},
+    {32, 5, 35, 6},
+    {29, 5, 27, 7},
+    {16, 3, 0, 5851},
+    {3992, 1, 25, 5847},
+    {31, 5, 2, 8},
+    {8357, 0, 29, 5849},
+    {4187, 1, 29, 5850},
+    {25, 5, 31, 6},
+    {30, 5, 2, 8},
+    {8506, 0, 2, 7},
+    {25, 5, 35, 7},
+    {8553, 0, 0, 5891},
+    {37, 5, 0, 5867},
+    {1406, 1, 33, 5857},
+    {19, 3, 0, 5861},
+    {36, 5, 25, 5859},
+    {12, 3, 29, 5860},
+    {2670, 1, 27, 8},
+    {35, 5, 33, 5862},
+    {36, 5, 0, 5865},
+    {4713, 1, 2, 6},
+    {22, 3, 35, 7},
+    {3128, 1, 2, 7},
+    {2943, 1, 27, 8},
+    {19, 3, 0, 5885},
+    {14, 3, 29, 5869},
+    {42, 5, 0, 5874},
+    {4730, 1, 2, 7},
+    {2623, 1, 29, 5872},
+    {3610, 1, 33, 5873},
+    {16, 3, 35, 7},
+    {8344, 0, 25, 5875},
+    {5, 2, 2, 7},
+    {1, 2, 2, 6},
+    {8524, 0, 0, 5883},
+    {46, 5, 0, 5882},
+    {3992, 1, 2, 8},
+    {2760, 1, 2, 7},
+    {15, 3, 35, 6},
+    {16, 3, 31, 6},
+    {1436, 1, 33, 5884},
+    {47, 5, 35, 7},
+    {21, 3, 25, 5886},
+    {7553, 0, 0, 5889},
+    {39, 5, 33, 5888},
+    {41, 5, 31, 6},
+    {4031, 1, 2, 7},
+    {22, 3, 31, 6},
+    {35, 5, 35, 6},
+    {42, 5, 2, 4},
+    {7625, 0, 21, 5894},
+    {8632, 0, 2, 5},
+    {23, 5, 0, 5897},
+    {27, 3, 35, 7},
+    {41, 2, 2, 6},
+    {7, 2, 2, 7},
+    {34, 5, 0, 5908},
+    {4844, 1, 0, 5907},
+    {25, 5, 25, 5902},
+    {4113, 1, 0, 5905},
+    {26, 3, 2, 7},
+    {28, 5, 31, 6},
+    {30, 5, 25, 5906},
+    {7795, 0, 31, 6},
+    {7773, 0, 35, 7},
+    {40, 5, 0, 5917},
+    {2983, 1, 0, 5911},
+    {36, 5, 35, 6},
+    {29, 3, 2, 8},
+    {7775, 0, 0, 5915},
+    {4037, 1, 25, 5914},
+    {7719, 0, 31, 6},
+    {27, 3, 29, 5916},
+    {7791, 0, 31, 6},
+    {7875, 0, 27, 7},
+    {105, 1, 29, 5919},
+    {26, 3, 0, 5924},
+    {319, 2, 0, 5923},
+    {12, 2, 25, 5922},
+    {36, 5, 23, 6},
+    {37, 5, 19, 5},
+    {59, 3, 0, 5967},
+    {1, 2, 0, 5958},
+    {1099, 1, 0, 5929},
+    {50, 3, 2, 8},
+    {43, 5, 27, 5},
+    {48, 5, 0, 5957},
+    {46, 3, 0, 5949},
+    {28, 3, 0, 5933},
+    {45, 5, 35, 6},
+    {33, 3, 0, 5938},
+    {43, 5, 2, 4},
+    {31, 3, 25, 5936},
+    {9928, 0, 2, 8},
+    {34, 5, 23, 6},
+    {38, 3, 0, 5943},
+    {2760, 1, 0, 5942},
+    {46, 5, 2, 6},
+    {34, 5, 31, 8},
+    {39, 5, 35, 7},
+    {9587, 0, 0, 5945},
+    {40, 5, 27, 4},
+    {1694, 1, 0, 5947},
+    {46, 5, 35, 6},
+    {11157, 0, 17, 5948},
+    {43, 5, 27, 8},
+    {9831, 0, 2, 7},
+    {1503, 1, 0, 5954},
+    {44, 5, 2, 7},
+    {1159, 1, 2, 8},
+    {28, 5, 27, 8},
+    {9405, 0, 0, 5956},
+    {36, 5, 31, 8},
+    {26, 5, 23, 8},
+    {47, 3, 31, 4},
+    {35, 3, 0, 5966},
+    {10822, 0, 0, 5964},
+    {9168, 0, 21, 5961},
+    {29, 3, 17, 5962},
+    {10400, 0, 2, 6},
+    {34, 5, 23, 6},
+    {11201, 0, 2, 6},
+    {27, 5, 27, 7},
+    {41, 5, 31, 6},
+    {28, 5, 23, 6},
+    {1, 1, 0, 5970},
+    {38, 3, 15, 5},
+    {23, 5, 0, 5972},
+    {17, 5, 35, 7},
+    {1571, 2, 2, 5},
+    {26, 3, 0, 5976},
+    {3408, 0, 2, 5},
+    {31, 5, 23, 6},
+    {760, 1, 21, 5977},
+    {33, 5, 25, 5978},
+    {50, 5, 2, 4},
+    {608, 2, 17, 5980},
+    {7694, 0, 0, 5984},
+    {5157, 0, 2, 6},
+    {3711, 1, 2, 5},
+    {36, 5, 23, 6},
+    {2875, 1, 2, 5},
+    {37, 5, 23, 6},
+    {7547, 0, 0, 11071},
+    {3514, 0, 0, 8106},
+    {99318, 1, 0, 6298},
+    {2822, 0, 0, 6190},
+    {755, 2, 0, 6168},
+    {47, 3, 0, 6051},
+    {715, 2, 0, 6049},
+    {2034, 0, 0, 6023},
+    {43, 3, 0, 6022},
+    {55556, 1, 0, 6018},
+    {1954, 0, 0, 5999},
+    {28, 5, 2, 8},
+    {1948, 0, 35, 7},
+    {19735, 1, 25, 6000},
+    {32, 3, 0, 6017},
+    {45302, 1, 2, 5},
+    {1, 2, 0, 6015},
+    {34504, 1, 0, 6013},
+    {32052, 1, 2, 4},
+    {24910, 1, 0, 6007},
+    {31, 5, 35, 7},
+    {2006, 0, 0, 6010},
+    {1985, 0, 29, 6009},
+    {29, 5, 19, 6},
+    {26, 5, 25, 6011},
+    {29, 5, 29, 6012},
+    {31, 5, 35, 7},
+    {28, 3, 29, 6014},
+    {25, 5, 35, 7},
+    {1978, 0, 21, 6016},
+    {29, 5, 27, 7},
+    {1993, 0, 23, 6},
+    {2011, 0, 0, 6021},
+    {1975, 0, 21, 6020},
+    {28, 5, 23, 3},
+    {27, 5, 11, 3},
+    {22, 5, 11, 3},
+    {2146, 0, 0, 6033},
+    {28, 3, 0, 6028},
+    {17820, 1, 25, 6026},
+    {34, 5, 2, 3},
+    {24, 5, 15, 4},
+    {2087, 0, 0, 6032},
+    {32, 5, 2, 4},
+    {2054, 0, 21, 6031},
+    {29, 5, 27, 5},
+    {38, 5, 23, 6},
+    {2244, 0, 0, 6037},
+    {34752, 1, 0, 6036},
+    {2195, 0, 35, 6},
+    {29, 5, 27, 5},
+    {35, 5, 0, 6047},
+    {49, 2, 0, 6044},
+    {45, 3, 2, 5},
+    {34, 5, 2, 5},
+    {27, 5, 2, 6},
+    {2779, 0, 2, 5},
+    {2765, 0, 23, 6},
+    {29, 3, 2, 5},
+    {28, 3, 21, 6046},
+    {21, 5, 23, 6},
+    {49, 2, 2, 5},
+    {28, 3, 19, 6},
+    {20, 5, 33, 6050},
+    {22, 5, 31, 8},
+    {2250, 0, 0, 6057},
+    {237, 2, 2, 4},
+    {65, 3, 2, 7},
+    {37, 5, 25, 6055},
+    {2112, 0, 17, 6056},
+    {68388, 1, 23, 6},
+    {69405, 1, 0, 6149},
+    {40039, 1, 0, 6064},
+    {2682, 0, 0, 6061},
+    {39696, 1, 31, 8},
+    {62, 3, 2, 4},
+    {2708, 0, 2, 5},
+    {31, 5, 23, 4},
+    {24, 5, 0, 6089},
+    {62, 3, 2, 8},
+    {22, 5, 0, 6070},
+    {46204, 1, 25, 6068},
+    {19, 2, 2, 5},
+    {2633, 0, 27, 7},
+    {49, 2, 0, 6081},
+    {58, 3, 0, 6079},
+    {6, 2, 0, 6076},
+    {23, 5, 29, 6074},
+    {1, 2, 21, 6075},
+    {2608, 0, 35, 7},
+    {23, 5, 29, 6077},
+    {51, 3, 25, 6078},
+    {2589, 0, 27, 7},
+    {23, 5, 21, 6080},
+    {61, 3, 19, 7},
+    {2707, 0, 0, 6085},
+    {23, 5, 0, 6084},
+    {54, 3, 27, 7},
+    {2602, 0, 27, 7},
+    {43844, 1, 25, 6086},
+    {23, 5, 0, 6088},
+    {52, 3, 27, 7},
+    {2738, 0, 31, 8},
+    {61, 3, 0, 6147},
+    {59, 3, 0, 6135},
+    {1, 2, 0, 6095},
+    {51, 3, 29, 6093},
+    {2650, 0, 2, 5},
+    {27, 5, 27, 7},
+    {51, 3, 0, 6121},
+    {72, 2, 0, 6112},
+    {48, 3, 25, 6098},
+    {49, 3, 0, 6100},
+    {45850, 1, 31, 8},
+    {44885, 1, 0, 6104},
+    {44052, 1, 2, 6},
+    {18, 2, 2, 8},
+    {2747, 0, 23, 6},
+    {26, 5, 0, 6106},
+    {65, 2, 31, 6},
+    {50, 3, 0, 6111},
+    {45, 2, 2, 7},
+    {31, 5, 2, 8},
+    {30, 5, 2, 7},
+    {2693, 0, 31, 8},
+    {33, 5, 35, 7},
+    {50, 3, 2, 4},
+    {73, 2, 17, 6114},
+    {26, 5, 0, 6118},
+    {48, 3, 0, 6117},
+    {43345, 1, 31, 8},
+    {2670, 0, 31, 6},
+    {31, 5, 2, 7},
+    {2730, 0, 2, 7},
+    {28, 5, 31, 8},
+    {34, 5, 2, 7},
+    {28, 5, 29, 6123},
+    {2750, 0, 0, 6132},
+    {2604, 0, 29, 6125},
+    {56, 3, 2, 6},
+    {54, 3, 2, 7},
+    {19, 2, 25, 6128},
+    {31, 5, 2, 8},
+    {46304, 1, 0, 6131},
+    {30, 5, 35, 7},
+    {63663, 1, 27, 7},
+    {33, 5, 2, 8},
+    {2770, 0, 29, 6134},
+    {32, 5, 35, 7},
+    {2639, 0, 0, 6146},
+    {28, 5, 0, 6143},
+    {27, 5, 2, 8},
+    {2548, 0, 0, 6140},
+    {103, 2, 31, 6},
+    {74, 2, 2, 5},
+    {60357, 1, 25, 6142},
+    {2576, 0, 23, 8},
+    {48, 2, 29, 6144},
+    {2497, 0, 29, 6145},
+    {29, 5, 19, 6},
+    {2730, 0, 23, 6},
+    {34, 5, 29, 6148},
+    {41, 5, 35, 7},
+    {65, 3, 0, 6157},
+    {53, 3, 21, 6151},
+    {4, 2, 21, 6152},
+    {86297, 1, 0, 6156},
+    {29, 5, 2, 6},
+    {56, 3, 2, 7},
+    {25, 5, 27, 8},
+    {2633, 0, 23, 6},
+    {91, 3, 2, 4},
+    {17, 2, 2, 7},
+    {2330, 0, 0, 6166},
+    {37, 5, 0, 6164},
+    {2265, 0, 25, 6162},
+    {2274, 0, 2, 7},
+    {30, 5, 31, 8},
+    {39, 5, 2, 6},
+    {2303, 0, 35, 6},
+    {78, 3, 2, 7},
+    {75, 3, 31, 8},
+    {1972, 0, 0, 6170},
+    {22, 5, 31, 8},
+    {15, 5, 9, 6171},
+    {2070, 0, 21, 6172},
+    {2289, 0, 17, 6173},
+    {2781, 0, 2, 6},
+    {92304, 1, 0, 6189},
+    {83516, 1, 0, 6187},
+    {78136, 1, 2, 4},
+    {47, 5, 0, 6186},
+    {8563, 1, 25, 6179},
+    {2120, 2, 2, 4},
+    {2339, 0, 21, 6181},
+    {43248, 1, 0, 6183},
+    {2408, 0, 19, 5},
+    {979, 2, 25, 6184},
+    {51, 3, 17, 6185},
+    {2628, 0, 27, 5},
+    {66914, 1, 15, 6},
+    {2395, 0, 2, 5},
+    {42, 5, 27, 5},
+    {2614, 0, 15, 5},
+    {44, 3, 0, 6222},
+    {14159, 1, 0, 6195},
+    {12699, 1, 2, 3},
+    {31, 5, 2, 5},
+    {3243, 0, 19, 5},
+    {2251, 2, 0, 6221},
+    {36, 3, 0, 6215},
+    {31, 3, 0, 6213},
+    {2088, 2, 2, 6},
+    {1109, 2, 0, 6211},
+    {876, 2, 2, 6},
+    {432, 2, 0, 6210},
+    {3441, 0, 2, 5},
+    {37, 5, 0, 6205},
+    {3358, 0, 27, 4},
+    {2831, 0, 25, 6206},
+    {44, 5, 2, 5},
+    {38, 5, 21, 6208},
+    {2857, 0, 21, 6209},
+    {13, 3, 23, 4},
+    {41, 5, 23, 6},
+    {2937, 0, 2, 5},
+    {2841, 0, 23, 4},
+    {90189, 1, 2, 5},
+    {81797, 1, 27, 4},
+    {21, 2, 0, 6218},
+    {43, 3, 2, 6},
+    {31, 5, 19, 2},
+    {3027, 0, 25, 6219},
+    {30, 5, 17, 6220},
+    {3282, 0, 27, 5},
+    {36, 5, 19, 5},
+    {2962, 0, 0, 6239},
+    {683, 2, 0, 6235},
+    {2857, 0, 29, 6225},
+    {129, 2, 0, 6233},
+    {26419, 1, 0, 6228},
+    {2890, 0, 11, 6},
+    {28042, 1, 13, 6229},
+    {62, 3, 2, 4},
+    {2867, 0, 0, 6232},
+    {28, 5, 19, 5},
+    {31, 5, 23, 4},
+    {2878, 0, 2, 8},
+    {30, 5, 23, 4},
+    {58, 3, 2, 5},
+    {2903, 0, 17, 6237},
+    {2936, 0, 13, 6238},
+    {40, 5, 15, 4},
+    {52, 3, 0, 6268},
+    {3190, 0, 0, 6247},
+    {52696, 1, 0, 6244},
+    {1, 2, 2, 7},
+    {31, 5, 23, 6},
+    {3039, 0, 0, 6246},
+    {34, 5, 27, 4},
+    {90525, 1, 23, 6},
+    {37717, 1, 0, 6261},
+    {30, 5, 0, 6255},
+    {50, 3, 0, 6251},
+    {49, 3, 23, 7},
+    {3345, 0, 0, 6253},
+    {2, 2, 23, 4},
+    {1, 2, 17, 6254},
+    {26, 5, 19, 5},
+    {3503, 2, 2, 6},
+    {37, 5, 2, 5},
+    {2, 2, 2, 6},
+    {3374, 0, 2, 4},
+    {35, 5, 2, 6},
+    {10969, 1, 27, 5},
+    {50, 3, 0, 6263},
+    {44, 5, 23, 4},
+    {3366, 0, 2, 7},
+    {3287, 0, 21, 6265},
+    {3327, 0, 2, 5},
+    {51, 3, 29, 6267},
+    {3299, 0, 23, 7},
+    {6739, 1, 0, 6272},
+    {24, 5, 21, 6270},
+    {25, 5, 21, 6271},
+    {27, 5, 15, 6},
+    {3267, 0, 0, 6281},
+    {64561, 1, 0, 6280},
+    {31, 5, 2, 5},
+    {73, 3, 2, 5},
+    {15672, 1, 17, 6277},
+    {25213, 1, 0, 6279},
+    {47, 2, 23, 6},
+    {3168, 0, 19, 5},
+    {234, 2, 23, 4},
+    {3295, 0, 0, 6283},
+    {3284, 0, 19, 7},
+    {4548, 2, 2, 5},
+    {3305, 0, 21, 6285},
+    {24, 2, 0, 6291},
+    {63, 3, 2, 6},
+    {69367, 1, 2, 4},
+    {53481, 1, 2, 5},
+    {3389, 0, 2, 4},
+    {32, 5, 19, 6},
+    {57, 3, 25, 6292},
+    {3441, 0, 2, 5},
+    {82754, 1, 0, 6295},
+    {43, 5, 27, 5},
+    {3372, 0, 0, 6297},
+    {31, 5, 19, 6},
+    {43, 5, 23, 4},
+    {35, 3, 0, 6763},
+    {417, 2, 0, 6579},
+    {2451, 0, 0, 6344},
+    {606930, 1, 0, 6310},
+    {566458, 1, 0, 6309},
+    {184, 2, 21, 6304},
+    {236, 2, 25, 6305},
+    {45, 5, 2, 4},
+    {2189, 0, 25, 6307},
+    {2424, 0, 2, 6},
+    {39, 5, 23, 6},
+    {33, 5, 27, 8},
+    {293, 2, 0, 6341},
+    {668134, 1, 17, 6312},
+    {286, 2, 2, 4},
+    {2327, 0, 0, 6339},
+    {27, 5, 0, 6319},
+    {2049, 0, 21, 6316},
+    {1816920, 1, 2, 5},
+    {23, 3, 25, 6318},
+    {2095, 0, 27, 5},
+    {22, 3, 0, 6326},
+    {1642653, 1, 2, 5},
+    {32, 5, 0, 6325},
+    {30, 5, 2, 6},
+    {28, 5, 2, 5},
+    {18, 3, 27, 5},
+    {1527651, 1, 23, 4},
+    {31, 5, 0, 6335},
+    {22, 2, 0, 6333},
+    {30, 5, 0, 6332},
+    {29, 5, 2, 5},
+    {28, 5, 25, 6331},
+    {26, 3, 27, 4},
+    {2, 2, 23, 6},
+    {2188, 0, 17, 6334},
+    {28, 5, 27, 5},
+    {33, 5, 0, 6338},
+    {2190, 0, 21, 6337},
+    {2223, 0, 19, 5},
+    {40, 2, 19, 6},
+    {39, 5, 2, 5},
+    {37, 5, 23, 4},
+    {2239, 0, 0, 6343},
+    {24, 3, 19, 5},
+    {24, 5, 19, 5},
+    {312908, 1, 0, 6398},
+    {199080, 1, 0, 6370},
+    {24, 3, 0, 6365},
+    {190810, 1, 2, 7},
+    {36, 5, 0, 6350},
+    {9, 2, 27, 5},
+    {14, 3, 0, 6352},
+    {2793, 0, 19, 5},
+    {187, 2, 2, 4},
+    {3004, 0, 0, 6363},
+    {40, 5, 0, 6362},
+    {123178, 1, 2, 4},
+    {18, 3, 0, 6361},
+    {38, 5, 2, 6},
+    {15, 3, 0, 6360},
+    {108075, 1, 19, 6},
+    {113926, 1, 23, 6},
+    {2945, 0, 19, 5},
+    {125312, 1, 19, 5},
+    {121363, 1, 2, 5},
+    {40, 5, 27, 4},
+    {3006, 0, 0, 6369},
+    {28, 3, 25, 6367},
+    {173091, 1, 25, 6368},
+    {28, 5, 23, 6},
+    {32, 5, 31, 6},
+    {2704, 0, 0, 6378},
+    {25, 3, 0, 6374},
+    {25, 5, 2, 5},
+    {23, 5, 23, 4},
+    {258265, 1, 2, 6},
+    {32, 5, 2, 6},
+    {23, 5, 21, 6377},
+    {29, 3, 23, 6},
+    {90, 2, 0, 6387},
+    {2813, 0, 25, 6380},
+    {35, 5, 0, 6386},
+    {22, 5, 0, 6383},
+    {240563, 1, 23, 4},
+    {2968, 0, 21, 6384},
+    {12, 2, 2, 5},
+    {33, 5, 19, 5},
+    {8, 3, 23, 6},
+    {5, 3, 17, 6388},
+    {2883, 0, 21, 6389},
+    {227, 2, 2, 7},
+    {2939, 0, 25, 6391},
+    {32, 3, 2, 5},
+    {16, 3, 0, 6394},
+    {3064, 0, 23, 6},
+    {28, 3, 0, 6397},
+    {3003, 0, 2, 5},
+    {30, 5, 27, 7},
+    {28, 5, 27, 7},
+    {705132, 1, 0, 6528},
+    {3424, 0, 0, 6518},
+    {30, 3, 0, 6494},
+    {344815, 1, 0, 6407},
+    {20, 3, 2, 6},
+    {3267, 0, 2, 7},
+    {16, 3, 21, 6405},
+    {2827, 0, 25, 6406},
+    {28, 5, 23, 4},
+    {33, 5, 0, 6470},
+    {23, 5, 0, 6414},
+    {3084, 0, 0, 6413},
+    {274, 2, 2, 7},
+    {2773, 0, 2, 6},
+    {362093, 1, 27, 7},
+    {20, 5, 7, 2},
+    {2741, 0, 0, 6420},
+    {31, 5, 25, 6416},
+    {32, 5, 0, 6418},
+    {2570, 0, 27, 7},
+    {2564, 0, 29, 6419},
+    {165, 2, 31, 6},
+    {3225, 0, 0, 6454},
+    {234, 2, 0, 6453},
+    {7, 3, 0, 6429},
+    {6, 3, 2, 6},
+    {2835, 0, 25, 6425},
+    {582127, 1, 29, 6426},
+    {28, 5, 2, 6},
+    {25, 5, 29, 6428},
+    {26, 5, 27, 7},
+    {378826, 1, 0, 6431},
+    {15, 3, 31, 6},
+    {27, 5, 0, 6436},
+    {511409, 1, 0, 6435},
+    {380210, 1, 33, 6434},
+    {3214, 0, 31, 8},
+    {532920, 1, 27, 7},
+    {29, 5, 0, 6444},
+    {28, 5, 0, 6441},
+    {10, 3, 0, 6440},
+    {153, 2, 31, 8},
+    {30, 2, 7, 7},
+    {427051, 1, 29, 6442},
+    {21, 3, 2, 7},
+    {137, 2, 27, 7},
+    {30, 5, 29, 6445},
+    {31, 5, 0, 6448},
+    {452836, 1, 29, 6447},
+    {156, 2, 27, 7},
+    {11, 3, 0, 6451},
+    {410882, 1, 29, 6450},
+    {3054, 0, 27, 7},
+    {589526, 1, 29, 6452},
+    {3005, 0, 35, 7},
+    {17, 3, 31, 6},
+    {3233, 0, 0, 6456},
+    {487806, 1, 19, 6},
+    {24, 2, 25, 6457},
+    {629454, 1, 0, 6467},
+    {30, 5, 0, 6465},
+    {620307, 1, 2, 8},
+    {29, 5, 2, 7},
+    {28, 5, 2, 6},
+    {6, 3, 0, 6464},
+    {27, 5, 31, 6},
+    {26, 5, 27, 7},
+    {31, 5, 25, 6466},
+    {430017, 1, 27, 7},
+    {21, 3, 2, 5},
+    {17, 3, 2, 6},
+    {30, 5, 31, 6},
+    {3327, 0, 0, 6490},
+    {27, 3, 0, 6487},
+    {41, 5, 0, 6485},
+    {375916, 1, 29, 6474},
+    {631280, 1, 2, 7},
+    {10, 3, 0, 6482},
+    {83, 2, 29, 6477},
+    {3106, 0, 2, 7},
+    {5, 3, 25, 6479},
+    {8, 3, 0, 6481},
+    {467471, 1, 35, 7},
+    {9, 3, 27, 8},
+    {13, 3, 2, 6},
+    {34, 5, 2, 8},
+    {471637, 1, 27, 7},
+    {42, 5, 2, 8},
+    {3003, 0, 35, 7},
+    {28, 3, 0, 6489},
+    {3191, 0, 27, 7},
+    {35, 5, 31, 6},
+    {575692, 1, 0, 6493},
+    {542604, 1, 2, 6},
+    {37, 5, 27, 8},
+    {38, 5, 23, 6},
+    {17, 2, 0, 6499},
+    {34, 3, 0, 6497},
+    {41, 5, 19, 5},
+    {2878, 0, 2, 5},
+    {33, 5, 19, 5},
+    {226, 2, 0, 6514},
+    {456314, 1, 0, 6505},
+    {2873, 0, 25, 6502},
+    {2972, 0, 0, 6504},
+    {26, 5, 19, 5},
+    {45, 5, 27, 4},
+    {3108, 0, 0, 6508},
+    {530361, 1, 29, 6507},
+    {132, 2, 35, 6},
+    {3403, 0, 2, 6},
+    {41, 5, 2, 7},
+    {119, 2, 29, 6511},
+    {652270, 1, 25, 6512},
+    {3268, 0, 2, 7},
+    {34, 5, 31, 6},
+    {3045, 0, 0, 6517},
+    {346005, 1, 2, 6},
+    {41, 5, 23, 6},
+    {3164, 0, 19, 5},
+    {535968, 1, 2, 5},
+    {190, 2, 2, 5},
+    {8, 3, 21, 6521},
+    {3506, 0, 0, 6527},
+    {42, 5, 2, 8},
+    {28, 5, 0, 6526},
+    {3458, 0, 2, 5},
+    {3447, 0, 27, 7},
+    {113, 2, 27, 7},
+    {33, 5, 19, 5},
+    {10, 3, 0, 6532},
+    {33, 5, 2, 8},
+    {3079, 0, 2, 8},
+    {27, 5, 31, 6},
+    {1482376, 1, 0, 6576},
+    {33, 3, 0, 6571},
+    {43, 5, 0, 6569},
+    {18, 3, 0, 6545},
+    {3240, 0, 0, 6544},
+    {838735, 1, 0, 6541},
+    {3147, 0, 2, 6},
+    {36, 5, 29, 6540},
+    {39, 5, 35, 6},
+    {2586, 0, 21, 6542},
+    {2718, 0, 17, 6543},
+    {31, 5, 19, 6},
+    {38, 5, 23, 4},
+    {771713, 1, 0, 6548},
+    {34, 2, 2, 6},
+    {2759, 0, 27, 5},
+    {3471, 0, 2, 6},
+    {23, 3, 0, 6554},
+    {963907, 1, 17, 6551},
+    {1306393, 1, 2, 6},
+    {2546, 0, 2, 5},
+    {35, 5, 23, 6},
+    {2530, 0, 21, 6555},
+    {2624, 0, 25, 6556},
+    {3411, 0, 0, 6567},
+    {243, 2, 0, 6560},
+    {107, 2, 2, 6},
+    {3178, 0, 27, 5},
+    {30, 3, 2, 4},
+    {390, 2, 2, 6},
+    {357, 2, 2, 4},
+    {3116, 0, 21, 6564},
+    {37, 5, 2, 6},
+    {3190, 0, 2, 5},
+    {28, 5, 23, 6},
+    {34, 5, 17, 6568},
+    {36, 5, 27, 4},
+    {56, 2, 2, 6},
+    {826615, 1, 35, 7},
+    {3285, 0, 0, 6573},
+    {2947, 0, 19, 6},
+    {34, 3, 17, 6574},
+    {29, 5, 2, 5},
+    {3314, 0, 19, 5},
+    {322, 2, 2, 5},
+    {2566, 0, 17, 6578},
+    {36, 5, 23, 4},
+    {36, 5, 0, 6705},
+    {23, 5, 0, 6591},
+    {1801, 2, 0, 6589},
+    {26, 3, 0, 6585},
+    {2329, 0, 13, 6584},
+    {19, 3, 15, 6},
+    {602, 2, 21, 6586},
+    {22, 5, 25, 6587},
+    {564846, 1, 21, 6588},
+    {2613, 0, 23, 4},
+    {451968, 1, 2, 5},
+    {4904, 2, 15, 5},
+    {150878, 1, 0, 6595},
+    {29, 3, 2, 6},
+    {2174, 0, 21, 6594},
+    {3220, 0, 19, 5},
+    {33, 5, 0, 6689},
+    {833, 2, 0, 6637},
+    {2977, 0, 0, 6631},
+    {435, 2, 0, 6603},
+    {32, 5, 0, 6602},
+    {545845, 1, 25, 6601},
+    {27, 5, 27, 4},
+    {2543, 0, 23, 4},
+    {19, 3, 21, 6604},
+    {451, 2, 21, 6605},
+    {2681, 0, 0, 6627},
+    {2062, 0, 0, 6608},
+    {1942184, 1, 19, 5},
+    {27, 5, 0, 6617},
+    {2475, 0, 0, 6616},
+    {1087460, 1, 25, 6611},
+    {26, 5, 0, 6614},
+    {2323, 0, 2, 5},
+    {24, 5, 23, 6},
+    {2320, 0, 21, 6615},
+    {1434061, 1, 27, 4},
+    {26, 5, 19, 5},
+    {32, 3, 0, 6623},
+    {28, 5, 0, 6621},
+    {26, 3, 17, 6620},
+    {2299, 0, 27, 5},
+    {546915, 1, 2, 5},
+    {757, 2, 27, 5},
+    {2224, 0, 0, 6625},
+    {31, 5, 27, 5},
+    {1497905, 1, 2, 4},
+    {1058782, 1, 19, 6},
+    {404802, 1, 21, 6628},
+    {577, 2, 25, 6629},
+    {25, 5, 25, 6630},
+    {715394, 1, 27, 5},
+    {22, 3, 0, 6634},
+    {1146582, 1, 2, 4},
+    {19, 3, 23, 6},
+    {1122512, 1, 2, 5},
+    {29, 3, 2, 4},
+    {27, 5, 19, 5},
+    {28, 5, 0, 6667},
+    {33, 3, 0, 6665},
+    {2624, 0, 0, 6653},
+    {1333905, 1, 2, 5},
+    {640688, 1, 0, 6651},
+    {491408, 1, 2, 5},
+    {2338, 0, 0, 6645},
+    {461101, 1, 23, 4},
+    {2409, 0, 0, 6647},
+    {2371, 0, 19, 6},
+    {1049, 2, 21, 6648},
+    {1875, 2, 2, 5},
+    {233318, 1, 2, 4},
+    {27, 5, 19, 5},
+    {18, 3, 17, 6652},
+    {23, 3, 23, 4},
+    {27, 5, 0, 6661},
+    {834672, 1, 2, 4},
+    {29, 3, 0, 6660},
+    {11, 3, 21, 6657},
+    {25, 5, 17, 6658},
+    {531026, 1, 17, 6659},
+    {26, 3, 23, 4},
+    {2846, 0, 19, 5},
+    {22, 3, 17, 6662},
+    {26, 3, 21, 6663},
+    {2764, 0, 21, 6664},
+    {3210, 2, 19, 5},
+    {836685, 1, 2, 5},
+    {664917, 1, 23, 6},
+    {12, 3, 21, 6668},
+    {1595732, 1, 2, 5},
+    {30, 5, 0, 6679},
+    {25, 3, 0, 6676},
+    {18, 3, 0, 6675},
+    {29, 5, 0, 6674},
+    {381144, 1, 19, 5},
+    {14, 3, 19, 5},
+    {3553, 2, 23, 4},
+    {29, 5, 0, 6678},
+    {2989, 0, 19, 5},
+    {2210, 0, 19, 5},
+    {31, 5, 2, 5},
+    {24, 3, 2, 5},
+    {1155, 2, 0, 6684},
+    {22, 3, 21, 6683},
+    {2592, 0, 23, 6},
+    {442825, 1, 17, 6685},
+    {15, 3, 17, 6686},
+    {1682, 2, 0, 6688},
+    {2650, 0, 23, 6},
+    {3145, 0, 19, 5},
+    {2451, 0, 21, 6690},
+    {3206, 2, 0, 6702},
+    {34, 5, 0, 6697},
+    {2801, 0, 21, 6693},
+    {24, 3, 2, 5},
+    {16, 3, 17, 6695},
+    {3165, 0, 2, 6},
+    {1008, 2, 27, 5},
+    {35, 5, 2, 5},
+    {27, 3, 21, 6699},
+    {3267, 0, 2, 6},
+    {2734, 0, 2, 5},
+    {1433298, 1, 27, 5},
+    {951268, 1, 2, 4},
+    {2886, 0, 21, 6704},
+    {3138, 0, 19, 5},
+    {2405, 0, 0, 6713},
+    {30, 3, 0, 6710},
+    {1914, 2, 21, 6708},
+    {38, 5, 21, 6709},
+    {23, 3, 27, 5},
+    {236947, 1, 13, 6711},
+    {1619200, 1, 21, 6712},
+    {2057, 0, 19, 5},
+    {3245, 0, 0, 6749},
+    {44, 5, 2, 6},
+    {2712, 0, 0, 6727},
+    {34, 3, 2, 5},
+    {42, 5, 0, 6723},
+    {40, 5, 21, 6719},
+    {41, 5, 0, 6721},
+    {708, 2, 23, 6},
+    {20, 3, 21, 6722},
+    {33, 3, 27, 5},
+    {2429, 0, 17, 6724},
+    {844336, 1, 25, 6725},
+    {21, 3, 21, 6726},
+    {32, 3, 27, 5},
+    {25, 3, 0, 6736},
+    {1299, 2, 21, 6729},
+    {3070, 0, 0, 6732},
+    {2826, 0, 21, 6731},
+    {2856, 0, 19, 5},
+    {2927, 2, 2, 5},
+    {21, 3, 2, 6},
+    {3186, 0, 17, 6735},
+    {3207, 0, 27, 4},
+    {3538, 2, 0, 6748},
+    {1502, 2, 0, 6743},
+    {1246, 2, 2, 5},
+    {27, 3, 25, 6740},
+    {2859, 0, 21, 6741},
+    {820, 2, 25, 6742},
+    {31, 3, 23, 6},
+    {242917, 1, 21, 6744},
+    {1129394, 1, 0, 6747},
+    {3186, 0, 25, 6746},
+    {40, 5, 27, 5},
+    {1324496, 1, 23, 6},
+    {29, 3, 23, 4},
+    {26, 3, 25, 6750},
+    {3397, 0, 0, 6756},
+    {1863, 2, 0, 6754},
+    {843820, 1, 25, 6753},
+    {39, 5, 27, 5},
+    {2540, 2, 21, 6755},
+    {3343, 0, 27, 5},
+    {335667, 1, 25, 6757},
+    {34, 3, 0, 6762},
+    {44, 5, 0, 6761},
+    {3420, 0, 17, 6760},
+    {39, 5, 19, 5},
+    {48, 5, 23, 4},
+    {3486, 0, 27, 5},
+    {266354, 1, 0, 7046},
+    {21, 5, 0, 6781},
+    {899, 2, 0, 6771},
+    {2593, 0, 0, 6770},
+    {2, 2, 9, 6768},
+    {19, 5, 25, 6769},
+    {133610, 1, 27, 4},
+    {69, 3, 23, 4},
+    {222890, 1, 0, 6775},
+    {72, 3, 0, 6774},
+    {1688, 2, 31, 6},
+    {1953, 2, 23, 4},
+    {15, 5, 21, 6776},
+    {64, 3, 0, 6778},
+    {1269, 2, 35, 4},
+    {2463, 0, 21, 6779},
+    {18, 5, 2, 8},
+    {2764, 0, 35, 5},
+    {139, 2, 0, 6893},
+    {66, 3, 0, 6866},
+    {50, 3, 0, 6819},
+    {168298, 1, 0, 6803},
+    {2066, 0, 13, 6786},
+    {30, 5, 0, 6791},
+    {3, 2, 0, 6790},
+    {46, 3, 17, 6789},
+    {2334, 0, 27, 5},
+    {115, 2, 27, 5},
+    {3407, 0, 2, 4},
+    {35, 5, 2, 6},
+    {2751, 0, 0, 6801},
+    {2328, 0, 25, 6795},
+    {2714, 0, 0, 6799},
+    {16, 2, 0, 6798},
+    {32, 5, 23, 4},
+    {131449, 1, 19, 6},
+    {45, 3, 2, 5},
+    {33, 5, 27, 5},
+    {48, 3, 2, 5},
+    {3290, 0, 27, 4},
+    {38, 3, 0, 6811},
+    {2381, 0, 17, 6805},
+    {3065, 0, 0, 6809},
+    {37, 3, 0, 6808},
+    {25, 5, 19, 5},
+    {25, 5, 27, 4},
+    {227889, 1, 21, 6810},
+    {24, 5, 19, 5},
+    {112, 2, 0, 6818},
+    {44, 3, 2, 5},
+    {42, 3, 0, 6815},
+    {195212, 1, 27, 5},
+    {34, 5, 0, 6817},
+    {2872, 0, 23, 6},
+    {35, 5, 23, 4},
+    {29, 5, 19, 6},
+    {3269, 0, 0, 6853},
+    {1, 2, 0, 6832},
+    {53, 3, 21, 6822},
+    {2439, 0, 0, 6831},
+    {39, 5, 0, 6829},
+    {2300, 0, 25, 6825},
+    {2312, 0, 21, 6826},
+    {215881, 1, 2, 5},
+    {145589, 1, 2, 6},
+    {2342, 0, 27, 2},
+    {155252, 1, 21, 6830},
+    {2178, 0, 23, 6},
+    {54, 3, 23, 6},
+    {2902, 0, 0, 6846},
+    {23, 2, 0, 6840},
+    {29, 5, 21, 6835},
+    {202891, 1, 0, 6838},
+    {39, 5, 2, 5},
+    {2751, 0, 19, 6},
+    {13, 2, 2, 5},
+    {30, 5, 23, 6},
+    {33, 5, 25, 6841},
+    {62, 3, 2, 4},
+    {39, 5, 2, 4},
+    {249510, 1, 2, 5},
+    {83, 2, 25, 6845},
+    {36, 5, 27, 5},
+    {3183, 0, 0, 6852},
+    {62, 3, 0, 6851},
+    {209312, 1, 21, 6849},
+    {35, 5, 2, 5},
+    {26, 5, 23, 6},
+    {33, 5, 19, 5},
+    {33, 5, 27, 4},
+    {114994, 1, 0, 6856},
+    {3354, 0, 1, 6855},
+    {3381, 0, 7, 4},
+    {65, 3, 0, 6864},
+    {33, 5, 0, 6859},
+    {26, 5, 27, 5},
+    {37, 5, 2, 6},
+    {35, 5, 0, 6862},
+    {62, 3, 19, 6},
+    {2, 2, 2, 6},
+    {36, 5, 23, 4},
+    {1, 2, 25, 6865},
+    {32, 5, 15, 5},
+    {1, 2, 0, 6884},
+    {145646, 1, 0, 6880},
+    {36, 5, 0, 6875},
+    {131726, 1, 0, 6872},
+    {70, 3, 29, 6871},
+    {28, 5, 31, 6},
+    {136106, 1, 13, 6873},
+    {29, 5, 25, 6874},
+    {141898, 1, 27, 8},
+    {41, 5, 2, 8},
+    {69, 3, 2, 6},
+    {40, 5, 2, 7},
+    {68, 3, 33, 6879},
+    {38, 5, 31, 8},
+    {3402, 0, 2, 6},
+    {2765, 0, 17, 6882},
+    {30, 5, 21, 6883},
+    {36, 5, 19, 5},
+    {75, 3, 21, 6885},
+    {3387, 0, 0, 6890},
+    {3, 2, 0, 6889},
+    {84, 3, 21, 6888},
+    {31, 5, 19, 5},
+    {31, 5, 19, 3},
+    {26, 5, 33, 6891},
+    {3451, 0, 2, 6},
+    {32, 5, 31, 6},
+    {80, 3, 0, 6995},
+    {3415, 0, 0, 6990},
+    {32, 5, 0, 6937},
+    {2043, 0, 0, 6898},
+    {2066, 2, 31, 3},
+    {61, 3, 0, 6921},
+    {2799, 0, 0, 6914},
+    {2458, 0, 0, 6907},
+    {2238, 0, 0, 6906},
+    {963, 2, 0, 6905},
+    {755, 2, 2, 7},
+    {28, 5, 27, 4},
+    {113786, 1, 19, 5},
+    {1739, 2, 19, 5},
+    {1232, 2, 2, 4},
+    {105439, 1, 0, 6910},
+    {2621, 0, 27, 5},
+    {30, 5, 21, 6911},
+    {458, 2, 2, 5},
+    {31, 5, 2, 6},
+    {43, 3, 27, 5},
+    {30, 5, 0, 6920},
+    {54, 3, 2, 5},
+    {175, 2, 2, 4},
+    {166, 2, 2, 5},
+    {48, 3, 21, 6919},
+    {27, 5, 23, 4},
+    {50, 3, 23, 4},
+    {1025, 2, 0, 6927},
+    {2715, 0, 0, 6924},
+    {199, 2, 23, 4},
+    {29, 5, 2, 5},
+    {27, 5, 21, 6926},
+    {2942, 0, 23, 4},
+    {1868, 2, 0, 6935},
+    {69, 3, 0, 6932},
+    {2349, 0, 21, 6930},
+    {25, 5, 29, 6931},
+    {2877, 0, 27, 8},
+    {2537, 0, 17, 6933},
+    {3152, 0, 2, 5},
+    {27, 5, 23, 8},
+    {200878, 1, 2, 5},
+    {20580, 2, 19, 5},
+    {1775, 2, 0, 6972},
+    {967, 2, 0, 6965},
+    {2496, 0, 0, 6949},
+    {811, 2, 0, 6948},
+    {35, 5, 17, 6942},
+    {2193, 0, 0, 6946},
+    {70, 3, 2, 3},
+    {254503, 1, 2, 3},
+    {353, 2, 19, 6},
+    {168851, 1, 13, 6947},
+    {261546, 1, 19, 3},
+    {37, 5, 23, 6},
+    {49, 3, 0, 6956},
+    {3027, 0, 2, 4},
+    {240064, 1, 2, 6},
+    {2672, 0, 21, 6953},
+    {41, 3, 0, 6955},
+    {38, 3, 27, 5},
+    {2853, 0, 27, 4},
+    {51, 3, 0, 6961},
+    {50, 3, 2, 4},
+    {3351, 0, 2, 4},
+    {36, 5, 2, 5},
+    {2878, 0, 19, 5},
+    {35, 5, 21, 6962},
+    {392, 2, 2, 5},
+    {184770, 1, 17, 6964},
+    {36, 5, 27, 5},
+    {35, 5, 2, 5},
+    {2238, 0, 21, 6967},
+    {34, 5, 0, 6971},
+    {103600, 1, 17, 6969},
+    {1089, 2, 17, 6970},
+    {1686, 2, 23, 4},
+    {2502, 0, 27, 5},
+    {243814, 1, 2, 6},
+    {42, 3, 0, 6979},
+    {2899, 0, 0, 6977},
+    {47, 5, 2, 5},
+    {40, 5, 19, 3},
+    {3257, 0, 21, 6978},
+    {41, 5, 19, 5},
+    {2276, 0, 0, 6981},
+    {2220, 0, 19, 6},
+    {58, 3, 17, 6982},
+    {2422, 2, 0, 6985},
+    {2304, 0, 2, 4},
+    {35, 5, 23, 4},
+    {2926, 0, 0, 6988},
+    {191388, 1, 17, 6987},
+    {41, 5, 23, 4},
+    {42, 5, 2, 5},
+    {3236, 0, 23, 6},
+    {552, 2, 17, 6991},
+    {3488, 0, 2, 6},
+    {56, 3, 21, 6993},
+    {145203, 1, 21, 6994},
+    {1103, 2, 23, 6},
+    {167320, 1, 0, 7001},
+    {166702, 1, 2, 7},
+    {1212, 2, 2, 5},
+    {91, 3, 2, 5},
+    {34, 5, 25, 7000},
+    {35, 5, 27, 4},
+    {90, 3, 0, 7039},
+    {33, 5, 0, 7023},
+    {1576, 2, 0, 7011},
+    {87, 3, 0, 7009},
+    {2495, 0, 17, 7006},
+    {84, 3, 0, 7008},
+    {29, 5, 23, 4},
+    {29, 5, 19, 5},
+    {32, 5, 17, 7010},
+    {241218, 1, 15, 5},
+    {2107, 0, 0, 7015},
+    {82, 3, 0, 7014},
+    {1960, 0, 19, 5},
+    {86, 3, 19, 5},
+    {26, 5, 2, 5},
+    {24, 5, 21, 7017},
+    {88, 3, 2, 3},
+    {2282, 2, 2, 4},
+    {86, 3, 0, 7022},
+    {2169, 0, 21, 7021},
+    {83, 3, 23, 3},
+    {2884, 0, 19, 5},
+    {41, 5, 2, 5},
+    {39, 5, 2, 3},
+    {250137, 1, 0, 7038},
+    {34, 5, 0, 7029},
+    {83, 3, 21, 7028},
+    {87, 3, 19, 5},
+    {35, 5, 0, 7034},
+    {415, 2, 21, 7031},
+    {2467, 0, 0, 7033},
+    {2298, 0, 15, 4},
+    {1903, 2, 23, 3},
+    {88, 3, 0, 7037},
+    {198358, 1, 2, 4},
+    {2438, 0, 15, 5},
+    {2692, 0, 15, 4},
+    {797, 2, 23, 3},
+    {91, 3, 25, 7040},
+    {2384, 0, 0, 7042},
+    {30, 5, 15, 4},
+    {23, 5, 0, 7044},
+    {22, 5, 15, 4},
+    {92, 3, 2, 4},
+    {34, 5, 23, 4},
+    {2495, 0, 0, 7435},
+    {54, 3, 0, 7198},
+    {354, 2, 0, 7091},
+    {2125, 0, 0, 7061},
+    {52, 3, 2, 3},
+    {777349, 1, 0, 7054},
+    {41, 3, 2, 6},
+    {32, 5, 31, 8},
+    {130, 2, 0, 7056},
+    {35, 5, 15, 4},
+    {40, 3, 2, 5},
+    {26, 5, 21, 7058},
+    {860307, 1, 21, 7059},
+    {29, 5, 2, 6},
+    {37, 3, 23, 6},
+    {994776, 1, 0, 7080},
+    {2131, 0, 13, 7063},
+    {123, 2, 0, 7076},
+    {2, 2, 25, 7065},
+    {35, 5, 0, 7070},
+    {410409, 1, 2, 5},
+    {2152, 0, 25, 7068},
+    {2409, 0, 2, 5},
+    {2389, 0, 23, 6},
+    {33, 2, 0, 7075},
+    {367827, 1, 0, 7073},
+    {41, 5, 27, 5},
+    {47, 3, 17, 7074},
+    {40, 5, 19, 3},
+    {2159, 0, 27, 5},
+    {817318, 1, 17, 7077},
+    {50, 3, 0, 7079},
+    {304, 2, 23, 6},
+    {26, 5, 7, 2},
+    {290, 2, 2, 5},
+    {52, 3, 2, 5},
+    {2189, 0, 0, 7084},
+    {2138, 0, 19, 5},
+    {37, 5, 0, 7090},
+    {270, 2, 0, 7089},
+    {44, 3, 2, 3},
+    {43, 3, 2, 4},
+    {31, 5, 15, 4},
+    {2336, 0, 15, 5},
+    {38, 5, 19, 5},
+    {51, 3, 0, 7173},
+    {1681683, 1, 0, 7169},
+    {49, 3, 0, 7155},
+    {2284, 0, 0, 7119},
+    {22, 5, 25, 7096},
+    {507, 2, 0, 7103},
+    {1535323, 1, 0, 7102},
+    {28, 5, 0, 7100},
+    {25, 5, 23, 4},
+    {2104, 0, 25, 7101},
+    {34, 5, 23, 6},
+    {30, 5, 15, 4},
+    {1954, 0, 0, 7105},
+    {1950, 0, 23, 4},
+    {845248, 1, 0, 7107},
+    {802144, 1, 23, 6},
+    {46, 5, 2, 6},
+    {40, 3, 21, 7109},
+    {45, 3, 0, 7112},
+    {39, 5, 17, 7111},
+    {1133881, 1, 27, 5},
+    {47, 3, 0, 7114},
+    {41, 5, 23, 4},
+    {48, 3, 0, 7117},
+    {2141, 0, 2, 4},
+    {40, 5, 19, 5},
+    {2122, 0, 21, 7118},
+    {37, 5, 19, 5},
+    {41, 5, 2, 5},
+    {2288, 0, 0, 7122},
+    {2286, 0, 19, 3},
+    {2294, 0, 21, 7123},
+    {1342362, 1, 0, 7152},
+    {405365, 1, 0, 7127},
+    {272805, 1, 2, 4},
+    {30, 5, 23, 4},
+    {1655, 2, 0, 7141},
+    {1214865, 1, 0, 7140},
+    {424, 2, 0, 7132},
+    {36, 5, 17, 7131},
+    {39, 5, 15, 4},
+    {41, 3, 17, 7133},
+    {43, 3, 21, 7134},
+    {34, 5, 0, 7138},
+    {25, 5, 17, 7136},
+    {1186976, 1, 21, 7137},
+    {28, 5, 19, 5},
+    {38, 5, 17, 7139},
+    {2435, 0, 23, 4},
+    {27, 5, 15, 4},
+    {1725, 2, 0, 7143},
+    {23, 5, 19, 3},
+    {43, 3, 0, 7151},
+    {715209, 1, 0, 7149},
+    {31, 5, 21, 7146},
+    {38, 3, 21, 7147},
+    {39, 3, 17, 7148},
+    {38, 5, 23, 4},
+    {1134014, 1, 2, 5},
+    {28, 5, 15, 4},
+    {30, 5, 23, 6},
+    {2469, 0, 2, 4},
+    {394, 2, 2, 5},
+    {31, 5, 19, 5},
+    {50, 3, 0, 7166},
+    {1493755, 1, 0, 7165},
+    {911, 2, 0, 7162},
+    {855, 2, 2, 6},
+    {937488, 1, 2, 5},
+    {2190, 0, 2, 6},
+    {40, 5, 23, 4},
+    {945, 2, 13, 7163},
+    {25, 5, 17, 7164},
+    {41, 5, 23, 4},
+    {45, 5, 19, 6},
+    {1259, 2, 0, 7168},
+    {2415, 0, 23, 4},
+    {26, 5, 11, 3},
+    {1697111, 1, 1, 7170},
+    {2302, 0, 2, 4},
+    {1877001, 1, 2, 4},
+    {26, 5, 27, 5},
+    {658004, 1, 0, 7178},
+    {584768, 1, 2, 1},
+    {36, 5, 2, 5},
+    {24, 5, 21, 7177},
+    {31, 5, 19, 5},
+    {2100, 0, 0, 7182},
+    {30, 5, 17, 7180},
+    {35, 5, 21, 7181},
+    {2000, 0, 27, 4},
+    {2307, 0, 0, 7192},
+    {53, 3, 0, 7190},
+    {26, 5, 17, 7185},
+    {35, 5, 21, 7186},
+    {1170722, 1, 25, 7187},
+    {1213747, 1, 17, 7188},
+    {40, 5, 25, 7189},
+    {47, 5, 23, 6},
+    {1664281, 1, 25, 7191},
+    {37, 5, 23, 6},
+    {52, 3, 0, 7194},
+    {31, 5, 23, 6},
+    {45, 5, 0, 7197},
+    {1164902, 1, 17, 7196},
+    {27, 5, 19, 5},
+    {2413, 2, 27, 5},
+    {87, 3, 0, 7397},
+    {2000, 0, 0, 7222},
+    {1997, 0, 0, 7218},
+    {102, 2, 0, 7204},
+    {64, 3, 2, 4},
+    {39, 5, 27, 5},
+    {1785262, 1, 2, 5},
+    {742017, 1, 0, 7211},
+    {22, 5, 13, 7207},
+    {30, 5, 21, 7208},
+    {33, 5, 17, 7209},
+    {78, 3, 2, 5},
+    {35, 5, 19, 5},
+    {992960, 1, 25, 7212},
+    {1978, 0, 0, 7217},
+    {1650, 2, 0, 7216},
+    {32, 5, 21, 7215},
+    {72, 3, 27, 5},
+    {1946, 0, 19, 5},
+    {37, 5, 23, 4},
+    {1002644, 1, 0, 7220},
+    {31, 5, 31, 8},
+    {1999, 0, 17, 7221},
+    {29, 5, 19, 3},
+    {2420, 0, 0, 7373},
+    {408952, 1, 0, 7256},
+    {387699, 1, 0, 7251},
+    {2340, 0, 0, 7248},
+    {65, 3, 0, 7231},
+    {3, 2, 21, 7228},
+    {37, 5, 17, 7229},
+    {2299, 0, 2, 5},
+    {40, 5, 19, 5},
+    {70, 3, 0, 7233},
+    {37, 5, 19, 3},
+    {38, 5, 0, 7245},
+    {2296, 0, 0, 7242},
+    {75, 3, 0, 7237},
+    {309893, 1, 19, 5},
+    {35, 5, 17, 7238},
+    {2136, 0, 17, 7239},
+    {37, 5, 21, 7240},
+    {2270, 0, 2, 4},
+    {2188, 0, 19, 5},
+    {30, 5, 0, 7244},
+    {23, 5, 23, 4},
+    {37, 5, 23, 4},
+    {2133, 0, 21, 7246},
+    {1053, 2, 2, 4},
+    {323531, 1, 19, 3},
+    {2409, 0, 2, 5},
+    {76, 3, 17, 7250},
+    {31, 5, 19, 6},
+    {61, 3, 0, 7253},
+    {31, 5, 15, 2},
+    {2294, 0, 0, 7255},
+    {35, 5, 15, 5},
+    {36, 5, 23, 3},
+    {540, 2, 0, 7302},
+    {81, 3, 2, 5},
+    {967420, 1, 0, 7288},
+    {413039, 1, 25, 7260},
+    {71, 3, 0, 7286},
+    {831931, 1, 0, 7280},
+    {2269, 0, 0, 7277},
+    {55, 3, 17, 7264},
+    {27, 5, 0, 7268},
+    {12, 2, 21, 7266},
+    {649072, 1, 17, 7267},
+    {26, 5, 23, 4},
+    {706049, 1, 0, 7276},
+    {82, 2, 0, 7275},
+    {56, 2, 2, 5},
+    {501308, 1, 21, 7272},
+    {2077, 0, 2, 4},
+    {34, 5, 2, 6},
+    {28, 5, 19, 5},
+    {37, 5, 19, 6},
+    {2071, 0, 23, 4},
+    {67, 3, 2, 4},
+    {2313, 0, 2, 5},
+    {22, 2, 19, 5},
+    {278, 2, 2, 6},
+    {37, 5, 2, 5},
+    {35, 5, 2, 4},
+    {66, 3, 0, 7285},
+    {895038, 1, 19, 5},
+    {28, 5, 23, 6},
+    {504757, 1, 2, 4},
+    {26, 5, 23, 4},
+    {30, 5, 17, 7289},
+    {2399, 0, 2, 4},
+    {37, 5, 0, 7300},
+    {2247, 0, 0, 7297},
+    {65, 3, 0, 7296},
+    {57, 3, 2, 4},
+    {187, 2, 13, 7295},
+    {1760450, 1, 23, 4},
+    {376, 2, 19, 3},
+    {32, 5, 21, 7298},
+    {1594985, 1, 2, 4},
+    {1055635, 1, 19, 5},
+    {2210, 0, 2, 4},
+    {1817104, 1, 23, 4},
+    {2303, 0, 0, 7362},
+    {611565, 1, 0, 7322},
+    {28, 5, 0, 7306},
+    {2159, 0, 27, 3},
+    {43, 5, 2, 5},
+    {2297, 0, 2, 5},
+    {554211, 1, 2, 4},
+    {34, 5, 0, 7314},
+    {484416, 1, 17, 7311},
+    {30, 5, 17, 7312},
+    {2261, 0, 2, 5},
+    {33, 5, 19, 3},
+    {40, 5, 2, 4},
+    {78, 3, 0, 7317},
+    {67, 3, 23, 3},
+    {2284, 0, 2, 4},
+    {484416, 1, 0, 7320},
+    {471739, 1, 23, 3},
+    {37, 5, 2, 5},
+    {2276, 0, 19, 5},
+    {616, 2, 0, 7325},
+    {2038, 0, 2, 5},
+    {36, 5, 15, 5},
+    {2280, 0, 0, 7357},
+    {3617, 2, 0, 7351},
+    {73, 3, 0, 7340},
+    {2204, 2, 0, 7334},
+    {2059, 0, 0, 7332},
+    {1549625, 1, 2, 4},
+    {28, 5, 19, 6},
+    {1446152, 1, 2, 5},
+    {31, 5, 23, 4},
+    {2049, 0, 21, 7335},
+    {1069599, 1, 0, 7337},
+    {46, 5, 19, 6},
+    {2198, 0, 2, 6},
+    {24, 5, 25, 7339},
+    {35, 5, 23, 4},
+    {77, 3, 0, 7343},
+    {1534539, 1, 25, 7342},
+    {42, 5, 23, 4},
+    {1375876, 1, 2, 5},
+    {85, 3, 0, 7350},
+    {2023, 0, 17, 7346},
+    {625975, 1, 25, 7347},
+    {1278, 2, 21, 7348},
+    {2219, 0, 2, 5},
+    {2122, 0, 23, 6},
+    {27, 5, 19, 3},
+    {1561480, 1, 0, 7354},
+    {640903, 1, 17, 7353},
+    {27, 5, 19, 5},
+    {2117, 0, 0, 7356},
+    {28, 5, 19, 3},
+    {27, 5, 15, 4},
+    {2295, 0, 2, 3},
+    {33, 5, 2, 4},
+    {1240405, 1, 0, 7361},
+    {2287, 0, 19, 5},
+    {28, 5, 15, 5},
+    {592, 2, 0, 7364},
+    {33, 5, 23, 4},
+    {8459, 2, 0, 7371},
+    {83, 3, 2, 5},
+    {1109628, 1, 2, 6},
+    {1034344, 1, 2, 4},
+    {79, 3, 2, 6},
+    {705494, 1, 17, 7370},
+    {58, 3, 23, 6},
+    {2341, 0, 17, 7372},
+    {27, 5, 19, 5},
+    {1166539, 1, 0, 7393},
+    {68, 3, 0, 7383},
+    {349805, 1, 25, 7376},
+    {4, 2, 17, 7377},
+    {2489, 0, 0, 7382},
+    {61, 2, 21, 7379},
+    {2484, 0, 2, 4},
+    {67, 3, 2, 5},
+    {1955, 2, 23, 4},
+    {42, 5, 27, 4},
+    {1263, 2, 0, 7389},
+    {86, 3, 0, 7388},
+    {334789, 1, 17, 7386},
+    {71, 2, 2, 6},
+    {2469, 0, 19, 6},
+    {2472, 0, 27, 5},
+    {2476, 0, 17, 7390},
+    {2483, 0, 0, 7392},
+    {30, 5, 19, 5},
+    {40, 5, 19, 5},
+    {1609002, 1, 2, 6},
+    {500, 2, 2, 5},
+    {26, 5, 2, 4},
+    {2454, 0, 15, 4},
+    {548568, 1, 0, 7412},
+    {529633, 1, 0, 7409},
+    {1994, 0, 21, 7400},
+    {37, 5, 0, 7408},
+    {2168, 0, 0, 7404},
+    {2013, 0, 17, 7403},
+    {36, 2, 19, 3},
+    {407078, 1, 2, 4},
+    {2446, 0, 17, 7406},
+    {2480, 0, 13, 7407},
+    {26, 5, 19, 3},
+    {38, 5, 23, 3},
+    {95, 3, 25, 7410},
+    {98, 3, 17, 7411},
+    {23, 5, 19, 3},
+    {292, 2, 0, 7419},
+    {628062, 1, 2, 6},
+    {620793, 1, 2, 4},
+    {572043, 1, 25, 7416},
+    {118, 2, 17, 7417},
+    {221, 2, 25, 7418},
+    {2296, 0, 27, 4},
+    {654268, 1, 0, 7422},
+    {724, 2, 17, 7421},
+    {95, 3, 19, 3},
+    {805673, 1, 0, 7425},
+    {97, 3, 2, 4},
+    {678481, 1, 27, 5},
+    {95, 3, 0, 7433},
+    {92, 3, 0, 7432},
+    {34, 5, 0, 7430},
+    {91, 3, 25, 7429},
+    {2283, 0, 23, 6},
+    {35, 5, 17, 7431},
+    {36, 5, 27, 4},
+    {28, 5, 23, 4},
+    {814463, 1, 25, 7434},
+    {2001, 0, 27, 4},
+    {97, 3, 0, 8092},
+    {2312, 2, 0, 8030},
+    {27, 5, 0, 7600},
+    {188, 2, 0, 7508},
+    {71, 3, 0, 7504},
+    {567465, 1, 0, 7472},
+    {22, 5, 0, 7443},
+    {342200, 1, 23, 4},
+    {35, 2, 0, 7456},
+    {68, 3, 2, 4},
+    {62, 3, 0, 7455},
+    {2892, 0, 0, 7450},
+    {5, 2, 2, 5},
+    {26, 5, 2, 4},
+    {2558, 0, 27, 5},
+    {41, 3, 17, 7451},
+    {2911, 0, 17, 7452},
+    {271575, 1, 25, 7453},
+    {54, 3, 2, 5},
+    {3121, 0, 23, 6},
+    {281048, 1, 23, 6},
+    {64, 3, 2, 6},
+    {338867, 1, 0, 7466},
+    {162, 2, 0, 7464},
+    {58, 3, 2, 6},
+    {54, 3, 2, 4},
+    {49, 3, 0, 7463},
+    {24, 5, 23, 4},
+    {285287, 1, 27, 5},
+    {24, 5, 21, 7465},
+    {2714, 0, 23, 4},
+    {43, 3, 0, 7469},
+    {178, 2, 2, 5},
+    {23, 5, 19, 6},
+    {156, 2, 0, 7471},
+    {3363, 0, 23, 6},
+    {62, 3, 27, 5},
+    {22, 5, 0, 7474},
+    {77, 2, 15, 2},
+    {600839, 1, 0, 7476},
+    {40, 2, 23, 3},
+    {25, 5, 0, 7491},
+    {69, 3, 0, 7486},
+    {62, 3, 2, 4},
+    {2669, 0, 0, 7482},
+    {983337, 1, 2, 4},
+    {838735, 1, 11, 3},
+    {733504, 1, 17, 7483},
+    {24, 5, 2, 5},
+    {3053, 0, 2, 5},
+    {52, 3, 23, 4},
+    {3204, 0, 0, 7489},
+    {23, 5, 13, 7488},
+    {933737, 1, 27, 2},
+    {23, 5, 2, 5},
+    {70, 3, 19, 5},
+    {2621, 0, 17, 7492},
+    {2664, 0, 25, 7493},
+    {26, 5, 0, 7500},
+    {69, 3, 0, 7499},
+    {904192, 1, 0, 7497},
+    {831266, 1, 19, 6},
+    {2703, 0, 2, 5},
+    {1236695, 1, 27, 5},
+    {136, 2, 19, 2},
+    {905696, 1, 2, 4},
+    {26, 2, 0, 7503},
+    {3214, 0, 19, 5},
+    {2948, 0, 27, 5},
+    {2976, 0, 25, 7505},
+    {3, 2, 2, 4},
+    {3427, 0, 2, 4},
+    {403547, 1, 23, 6},
+    {21, 5, 0, 7515},
+    {686126, 1, 0, 7513},
+    {1731, 2, 2, 6},
+    {2918, 0, 2, 3},
+    {279669, 1, 15, 4},
+    {20, 5, 2, 5},
+    {18, 5, 23, 6},
+    {345414, 1, 0, 7529},
+    {498, 2, 0, 7524},
+    {57, 3, 0, 7522},
+    {51, 3, 0, 7521},
+    {50, 3, 21, 7520},
+    {2727, 0, 23, 4},
+    {26, 5, 23, 4},
+    {315105, 1, 2, 4},
+    {2935, 0, 19, 5},
+    {87, 3, 0, 7527},
+    {42, 3, 21, 7526},
+    {2621, 0, 23, 4},
+    {23, 5, 2, 5},
+    {89, 3, 23, 3},
+    {26, 5, 0, 7583},
+    {279, 2, 0, 7538},
+    {199, 2, 21, 7532},
+    {646680, 1, 0, 7534},
+    {451665, 1, 19, 6},
+    {274, 2, 2, 6},
+    {904038, 1, 0, 7537},
+    {252, 2, 23, 4},
+    {211, 2, 23, 4},
+    {59, 3, 0, 7561},
+    {2798, 0, 0, 7544},
+    {1409392, 1, 0, 7542},
+    {38, 3, 19, 5},
+    {975, 2, 2, 4},
+    {2595, 0, 19, 5},
+    {3353, 0, 2, 5},
+    {54, 3, 0, 7559},
+    {22, 5, 0, 7548},
+    {48, 3, 19, 5},
+    {24, 5, 0, 7555},
+    {497132, 1, 0, 7551},
+    {3077, 0, 27, 4},
+    {40, 3, 0, 7553},
+    {39, 3, 23, 4},
+    {3029, 0, 21, 7554},
+    {49, 3, 19, 5},
+    {25, 5, 2, 5},
+    {50, 3, 0, 7558},
+    {3039, 0, 19, 5},
+    {863, 2, 19, 3},
+    {1525, 2, 2, 5},
+    {2820, 0, 23, 4},
+    {23, 5, 0, 7569},
+    {563501, 1, 17, 7563},
+    {369, 2, 17, 7564},
+    {22, 5, 0, 7566},
+    {1581, 2, 23, 6},
+    {1005, 2, 21, 7567},
+    {1259, 2, 17, 7568},
+    {84, 3, 23, 4},
+    {1292921, 1, 0, 7582},
+    {68, 3, 0, 7574},
+    {65, 3, 2, 6},
+    {441, 2, 2, 5},
+    {61, 3, 23, 6},
+    {692689, 1, 2, 5},
+    {24, 5, 0, 7578},
+    {894, 2, 21, 7577},
+    {1828, 2, 19, 5},
+    {74, 3, 17, 7579},
+    {25, 5, 21, 7580},
+    {84, 3, 17, 7581},
+    {441041, 1, 23, 4},
+    {74, 3, 23, 6},
+    {46, 3, 21, 7584},
+    {3088, 0, 0, 7596},
+    {665313, 1, 0, 7587},
+    {458, 2, 27, 4},
+    {53, 3, 0, 7590},
+    {916624, 1, 25, 7589},
+    {1164, 2, 19, 6},
+    {1411836, 1, 2, 6},
+    {692, 2, 2, 5},
+    {2633, 0, 21, 7593},
+    {2778, 0, 17, 7594},
+    {1247723, 1, 2, 5},
+    {917860, 1, 19, 6},
+    {3350, 0, 2, 5},
+    {3258, 0, 2, 4},
+    {82, 3, 21, 7599},
+    {804257, 1, 19, 5},
+    {906571, 1, 0, 7870},
+    {66, 3, 0, 7826},
+    {1818, 2, 0, 7814},
+    {47, 5, 0, 7807},
+    {445113, 1, 0, 7689},
+    {43, 3, 0, 7634},
+    {3416, 0, 2, 6},
+    {37, 3, 0, 7612},
+    {306482, 1, 21, 7609},
+    {36, 3, 0, 7611},
+    {31, 5, 23, 6},
+    {423398, 1, 27, 5},
+    {17, 2, 0, 7616},
+    {42, 5, 2, 6},
+    {3095, 0, 2, 4},
+    {2776, 0, 19, 5},
+    {2791, 0, 0, 7623},
+    {367163, 1, 2, 4},
+    {294792, 1, 2, 5},
+    {39, 3, 25, 7620},
+    {39, 5, 2, 6},
+    {495, 2, 17, 7622},
+    {37, 5, 23, 4},
+    {1208, 2, 2, 4},
+    {2831, 0, 25, 7625},
+    {2857, 0, 17, 7626},
+    {40, 2, 0, 7631},
+    {31, 5, 0, 7630},
+    {30, 5, 21, 7629},
+    {22, 2, 19, 5},
+    {286447, 1, 27, 5},
+    {283, 2, 25, 7632},
+    {41, 3, 2, 5},
+    {3042, 0, 19, 5},
+    {59, 3, 0, 7663},
+    {441, 2, 0, 7656},
+    {271111, 1, 0, 7638},
+    {270815, 1, 27, 4},
+    {3117, 0, 0, 7649},
+    {2521, 0, 25, 7640},
+    {333, 2, 0, 7646},
+    {49, 3, 21, 7642},
+    {164, 2, 0, 7645},
+    {285287, 1, 25, 7644},
+    {38, 5, 23, 6},
+    {203, 2, 19, 5},
+    {3032, 0, 2, 5},
+    {53, 3, 2, 5},
+    {31, 5, 23, 6},
+    {48, 2, 0, 7655},
+    {429868, 1, 2, 5},
+    {50, 3, 25, 7652},
+    {3126, 0, 25, 7653},
+    {1, 2, 2, 5},
+    {34, 5, 23, 4},
+    {76, 2, 19, 5},
+    {2621, 0, 25, 7657},
+    {290291, 1, 21, 7658},
+    {37, 5, 2, 5},
+    {3398, 0, 2, 4},
+    {50, 3, 21, 7661},
+    {352670, 1, 17, 7662},
+    {399384, 1, 23, 4},
+    {35, 5, 0, 7684},
+    {564, 2, 0, 7683},
+    {278438, 1, 21, 7666},
+    {2817, 0, 0, 7670},
+    {162, 2, 25, 7668},
+    {30, 5, 17, 7669},
+    {338867, 1, 23, 6},
+    {31, 5, 0, 7680},
+    {47, 2, 25, 7672},
+    {64, 3, 2, 6},
+    {3137, 0, 21, 7674},
+    {28, 5, 21, 7675},
+    {30, 5, 2, 5},
+    {29, 5, 0, 7678},
+    {401339, 1, 27, 5},
+    {67, 2, 25, 7679},
+    {3172, 0, 23, 6},
+    {12, 2, 21, 7681},
+    {330548, 1, 2, 6},
+    {3131, 0, 27, 5},
+    {62, 3, 23, 4},
+    {18, 2, 21, 7685},
+    {42, 5, 2, 6},
+    {63, 3, 21, 7687},
+    {40, 5, 2, 5},
+    {307, 2, 27, 5},
+    {339, 2, 0, 7762},
+    {517488, 1, 0, 7712},
+    {3357, 0, 0, 7705},
+    {37, 5, 0, 7704},
+    {144, 2, 0, 7700},
+    {3145, 0, 0, 7698},
+    {2975, 0, 2, 5},
+    {42, 3, 25, 7697},
+    {2928, 0, 23, 6},
+    {53, 2, 2, 5},
+    {484746, 1, 27, 5},
+    {2874, 0, 0, 7702},
+    {33, 5, 27, 4},
+    {45, 3, 25, 7703},
+    {54, 3, 23, 6},
+    {44, 5, 23, 4},
+    {109, 2, 0, 7708},
+    {56, 3, 25, 7707},
+    {31, 5, 27, 5},
+    {3396, 0, 0, 7710},
+    {34, 5, 23, 6},
+    {35, 5, 25, 7711},
+    {504033, 1, 19, 5},
+    {22, 2, 0, 7725},
+    {3210, 0, 21, 7714},
+    {39, 5, 0, 7720},
+    {35, 5, 21, 7716},
+    {51, 3, 17, 7717},
+    {36, 5, 17, 7718},
+    {64, 3, 2, 4},
+    {58, 3, 23, 6},
+    {3353, 0, 2, 5},
+    {3255, 0, 21, 7722},
+    {42, 5, 2, 5},
+    {41, 5, 2, 4},
+    {55, 3, 19, 5},
+    {47, 3, 0, 7729},
+    {2837, 0, 2, 5},
+    {2817, 0, 21, 7728},
+    {2828, 0, 19, 6},
+    {24, 2, 25, 7730},
+    {3244, 0, 0, 7748},
+    {284, 2, 0, 7740},
+    {2966, 0, 0, 7738},
+    {2885, 0, 0, 7736},
+    {49, 3, 2, 5},
+    {35, 5, 27, 5},
+    {2951, 0, 25, 7737},
+    {31, 5, 27, 5},
+    {221, 2, 2, 5},
+    {208, 2, 23, 6},
+    {35, 5, 0, 7744},
+    {301, 2, 25, 7742},
+    {55, 3, 21, 7743},
+    {567802, 1, 27, 5},
+    {537737, 1, 0, 7746},
+    {39, 5, 19, 5},
+    {57, 3, 21, 7747},
+    {41, 5, 27, 4},
+    {3294, 0, 0, 7751},
+    {50, 3, 2, 6},
+    {42, 5, 19, 6},
+    {3300, 0, 21, 7752},
+    {115, 2, 0, 7761},
+    {52, 3, 0, 7756},
+    {39, 5, 2, 6},
+    {33, 5, 27, 5},
+    {75, 2, 2, 5},
+    {47, 2, 21, 7758},
+    {668946, 1, 2, 6},
+    {37, 5, 21, 7760},
+    {41, 5, 27, 4},
+    {156, 2, 15, 6},
+    {505177, 1, 0, 7768},
+    {984, 2, 2, 5},
+    {37, 5, 2, 5},
+    {476651, 1, 2, 5},
+    {470783, 1, 2, 4},
+    {32, 5, 23, 4},
+    {1079, 2, 0, 7797},
+    {3346, 0, 0, 7783},
+    {3276, 0, 0, 7782},
+    {2511, 0, 25, 7772},
+    {54, 3, 2, 5},
+    {657822, 1, 0, 7777},
+    {638584, 1, 2, 4},
+    {33, 5, 17, 7776},
+    {42, 3, 19, 5},
+    {42, 5, 2, 6},
+    {29, 5, 2, 5},
+    {28, 5, 0, 7781},
+    {2626, 0, 27, 5},
+    {3111, 0, 27, 5},
+    {52, 3, 23, 4},
+    {452, 2, 0, 7785},
+    {3391, 0, 19, 6},
+    {795, 2, 0, 7792},
+    {59, 3, 2, 5},
+    {36, 5, 0, 7789},
+    {38, 3, 23, 6},
+    {3477, 0, 2, 5},
+    {3466, 0, 2, 6},
+    {37, 5, 27, 5},
+    {838, 2, 17, 7793},
+    {3402, 0, 25, 7794},
+    {46, 3, 25, 7795},
+    {3446, 0, 17, 7796},
+    {37, 5, 19, 5},
+    {1171, 2, 0, 7799},
+    {1099, 2, 11, 5},
+    {3445, 0, 2, 6},
+    {879772, 1, 2, 5},
+    {40, 3, 0, 7803},
+    {39, 3, 23, 6},
+    {3037, 0, 2, 5},
+    {826254, 1, 2, 6},
+    {645860, 1, 2, 5},
+    {2823, 0, 27, 5},
+    {981, 2, 25, 7808},
+    {50, 5, 2, 6},
+    {321445, 1, 21, 7810},
+    {49, 5, 0, 7813},
+    {48, 5, 2, 6},
+    {41, 3, 27, 5},
+    {45, 3, 23, 6},
+    {56, 3, 0, 7818},
+    {39, 3, 2, 5},
+    {48, 5, 2, 4},
+    {1997, 2, 23, 6},
+    {3458, 0, 2, 6},
+    {638142, 1, 0, 7825},
+    {2904, 0, 17, 7821},
+    {3335, 0, 2, 4},
+    {42, 5, 2, 3},
+    {38, 5, 2, 4},
+    {33, 5, 19, 3},
+    {2848, 0, 19, 5},
+    {258, 2, 0, 7851},
+    {2938, 0, 0, 7837},
+    {48, 2, 0, 7833},
+    {2589, 0, 21, 7830},
+    {31, 5, 25, 7831},
+    {2893, 0, 2, 4},
+    {40, 5, 23, 6},
+    {39, 5, 2, 5},
+    {33, 5, 25, 7835},
+    {86, 3, 25, 7836},
+    {564278, 1, 19, 5},
+    {85, 3, 2, 6},
+    {897319, 1, 2, 6},
+    {3, 2, 0, 7842},
+    {41, 5, 21, 7841},
+    {43, 5, 27, 4},
+    {873070, 1, 2, 5},
+    {711671, 1, 0, 7847},
+    {553719, 1, 0, 7846},
+    {34, 5, 19, 6},
+    {695185, 1, 23, 6},
+    {72, 3, 2, 4},
+    {69, 3, 17, 7849},
+    {35, 5, 2, 4},
+    {11, 2, 23, 6},
+    {88, 3, 0, 7864},
+    {359, 2, 17, 7853},
+    {435536, 1, 0, 7855},
+    {697, 2, 19, 5},
+    {3106, 0, 0, 7859},
+    {31, 5, 0, 7858},
+    {69, 3, 23, 4},
+    {833524, 1, 23, 4},
+    {73, 3, 0, 7862},
+    {68, 3, 2, 5},
+    {34, 5, 23, 6},
+    {78, 3, 2, 5},
+    {31, 5, 23, 6},
+    {2955, 0, 2, 5},
+    {90, 3, 21, 7866},
+    {91, 3, 17, 7867},
+    {35, 5, 2, 5},
+    {701015, 1, 2, 5},
+    {29, 5, 23, 4},
+    {496, 2, 0, 7970},
+    {73, 3, 0, 7965},
+    {36, 5, 0, 7935},
+    {2623, 0, 0, 7886},
+    {55, 3, 0, 7880},
+    {278, 2, 0, 7878},
+    {52, 3, 2, 5},
+    {47, 3, 23, 3},
+    {1137537, 1, 21, 7879},
+    {32, 5, 23, 4},
+    {2511, 0, 21, 7881},
+    {34, 5, 0, 7885},
+    {282, 2, 17, 7883},
+    {2587, 0, 2, 5},
+    {32, 5, 19, 5},
+    {1105210, 1, 19, 5},
+    {62, 3, 0, 7929},
+    {2678, 0, 0, 7894},
+    {274, 2, 0, 7891},
+    {53, 3, 2, 6},
+    {33, 5, 15, 2},
+    {1457731, 1, 2, 5},
+    {351, 2, 21, 7893},
+    {32, 5, 23, 4},
+    {2800, 0, 0, 7900},
+    {255, 2, 0, 7898},
+    {198, 2, 2, 4},
+    {31, 5, 19, 5},
+    {442, 2, 21, 7899},
+    {463, 2, 19, 5},
+    {3365, 0, 0, 7924},
+    {34, 5, 0, 7918},
+    {2846, 0, 0, 7904},
+    {1240780, 1, 19, 5},
+    {2936, 0, 21, 7905},
+    {29, 5, 0, 7913},
+    {28, 5, 0, 7911},
+    {3196, 0, 0, 7910},
+    {269, 2, 2, 5},
+    {176, 2, 23, 6},
+    {176, 2, 23, 4},
+    {304, 2, 2, 5},
+    {250, 2, 23, 6},
+    {32, 5, 2, 5},
+    {2975, 0, 17, 7915},
+    {31, 5, 2, 5},
+    {1194004, 1, 2, 4},
+    {3196, 0, 23, 4},
+    {44, 3, 25, 7919},
+    {338, 2, 2, 5},
+    {35, 5, 0, 7923},
+    {55, 3, 21, 7922},
+    {90, 2, 19, 6},
+    {1192067, 1, 27, 4},
+    {34, 5, 2, 5},
+    {3389, 0, 17, 7926},
+    {46, 3, 2, 4},
+    {3424, 0, 21, 7928},
+    {3458, 0, 19, 5},
+    {2925, 0, 0, 7933},
+    {1241270, 1, 2, 4},
+    {72, 2, 21, 7932},
+    {2911, 0, 27, 5},
+    {35, 5, 17, 7934},
+    {66, 2, 15, 5},
+    {489, 2, 0, 7964},
+    {45, 3, 0, 7943},
+    {996390, 1, 0, 7939},
+    {2678, 0, 15, 5},
+    {42, 3, 2, 5},
+    {39, 3, 2, 6},
+    {39, 5, 2, 5},
+    {37, 3, 27, 5},
+    {482, 2, 2, 6},
+    {70, 3, 2, 5},
+    {1032988, 1, 0, 7950},
+    {119, 2, 0, 7948},
+    {3313, 0, 19, 5},
+    {45, 5, 2, 4},
+    {3070, 0, 27, 5},
+    {1384185, 1, 0, 7962},
+    {411, 2, 2, 4},
+    {129, 2, 0, 7955},
+    {3195, 0, 17, 7954},
+    {47, 5, 27, 4},
+    {67, 3, 2, 6},
+    {298, 2, 0, 7960},
+    {3178, 0, 0, 7959},
+    {1372826, 1, 23, 4},
+    {3324, 0, 15, 4},
+    {2779, 0, 13, 7961},
+    {42, 5, 19, 5},
+    {327, 2, 21, 7963},
+    {1528158, 1, 15, 5},
+    {3140, 0, 15, 5},
+    {1124798, 1, 17, 7966},
+    {44, 5, 2, 4},
+    {139, 2, 17, 7968},
+    {3149, 0, 2, 6},
+    {38, 5, 27, 5},
+    {88, 3, 0, 8020},
+    {37, 3, 25, 7972},
+    {1000896, 1, 0, 7982},
+    {48, 5, 2, 6},
+    {3278, 0, 0, 7980},
+    {2633, 0, 0, 7977},
+    {2554, 0, 23, 4},
+    {3137, 0, 21, 7978},
+    {52, 3, 25, 7979},
+    {938154, 1, 23, 4},
+    {76, 3, 17, 7981},
+    {3473, 0, 19, 5},
+    {3438, 0, 0, 8017},
+    {536, 2, 0, 7989},
+    {2640, 0, 21, 7985},
+    {32, 5, 2, 6},
+    {529, 2, 2, 6},
+    {29, 5, 2, 5},
+    {67, 3, 23, 6},
+    {61, 3, 2, 5},
+    {60, 3, 2, 6},
+    {839, 2, 0, 7993},
+    {3366, 0, 23, 6},
+    {1394, 2, 0, 8005},
+    {50, 3, 0, 8000},
+    {1350, 2, 2, 6},
+    {1326333, 1, 21, 7997},
+    {34, 5, 0, 7999},
+    {1138, 2, 19, 5},
+    {37, 5, 27, 4},
+    {35, 5, 2, 6},
+    {1255, 2, 2, 5},
+    {56, 3, 2, 5},
+    {53, 3, 2, 6},
+    {30, 5, 27, 5},
+    {1220127, 1, 0, 8013},
+    {55, 3, 0, 8011},
+    {30, 5, 21, 8008},
+    {35, 5, 2, 5},
+    {51, 3, 2, 5},
+    {44, 3, 23, 6},
+    {39, 5, 25, 8012},
+    {47, 5, 23, 6},
+    {3176, 0, 2, 5},
+    {1973, 2, 2, 5},
+    {47, 5, 17, 8016},
+    {1724, 2, 27, 4},
+    {759, 2, 21, 8018},
+    {1120694, 1, 25, 8019},
+    {3448, 0, 27, 5},
+    {917, 2, 25, 8021},
+    {2894, 0, 21, 8022},
+    {33, 5, 0, 8027},
+    {29, 5, 0, 8025},
+    {2982, 0, 19, 5},
+    {90, 3, 25, 8026},
+    {3087, 0, 27, 4},
+    {41, 5, 2, 6},
+    {90, 3, 2, 5},
+    {36, 5, 27, 5},
+    {599480, 1, 0, 8055},
+    {567384, 1, 0, 8054},
+    {56, 3, 0, 8043},
+    {3062, 0, 0, 8039},
+    {2364, 2, 13, 8035},
+    {3900, 2, 2, 5},
+    {35, 5, 17, 8037},
+    {2671, 0, 2, 6},
+    {47, 5, 23, 6},
+    {3354, 0, 2, 3},
+    {50, 3, 17, 8041},
+    {366585, 1, 2, 3},
+    {37, 5, 19, 3},
+    {471674, 1, 0, 8052},
+    {2814, 0, 0, 8048},
+    {2708, 0, 17, 8046},
+    {43, 5, 2, 4},
+    {32, 5, 19, 6},
+    {62, 3, 2, 5},
+    {58, 3, 21, 8050},
+    {3400, 0, 17, 8051},
+    {29, 5, 19, 5},
+    {490077, 1, 2, 4},
+    {35, 5, 15, 4},
+    {587434, 1, 27, 3},
+    {3346, 0, 0, 8085},
+    {61, 3, 0, 8072},
+    {37, 3, 0, 8059},
+    {36, 3, 23, 4},
+    {39, 3, 21, 8060},
+    {6488, 2, 0, 8071},
+    {634744, 1, 25, 8062},
+    {1226298, 1, 0, 8067},
+    {1077134, 1, 0, 8066},
+    {2422, 2, 21, 8065},
+    {2429, 2, 19, 5},
+    {2783, 0, 19, 5},
+    {25, 5, 25, 8068},
+    {41, 3, 0, 8070},
+    {34, 5, 19, 5},
+    {2697, 0, 27, 5},
+    {7069, 2, 27, 5},
+    {5188, 2, 0, 8084},
+    {4904, 2, 0, 8083},
+    {1069391, 1, 0, 8077},
+    {78, 3, 21, 8076},
+    {87, 3, 19, 5},
+    {1106240, 1, 13, 8078},
+    {2767, 0, 17, 8079},
+    {34, 5, 2, 5},
+    {31, 5, 2, 4},
+    {28, 5, 2, 5},
+    {3070, 0, 23, 4},
+    {2872, 0, 19, 3},
+    {46, 5, 23, 6},
+    {42, 3, 21, 8086},
+    {13117, 2, 2, 5},
+    {41, 5, 2, 4},
+    {3412, 0, 17, 8089},
+    {3430, 0, 21, 8090},
+    {34, 5, 17, 8091},
+    {3470, 0, 19, 5},
+    {33, 5, 0, 8102},
+    {498187, 1, 0, 8095},
+    {28, 5, 23, 4},
+    {595, 2, 0, 8099},
+    {27, 5, 17, 8097},
+    {3072, 0, 17, 8098},
+    {756604, 1, 23, 4},
+    {1069, 2, 21, 8100},
+    {24, 5, 2, 4},
+    {2623, 0, 23, 4},
+    {98, 3, 0, 8104},
+    {110, 2, 19, 5},
+    {218, 2, 17, 8105},
+    {34, 5, 19, 5},
+    {32, 3, 0, 8810},
+    {38, 5, 0, 8608},
+    {26, 5, 0, 8175},
+    {111644, 1, 0, 8129},
+    {4215, 0, 21, 8111},
+    {6297, 0, 0, 8125},
+    {73807, 1, 2, 6},
+    {4631, 0, 0, 8120},
+    {2, 2, 0, 8116},
+    {23, 5, 27, 5},
+    {30, 3, 2, 6},
+    {4377, 0, 2, 6},
+    {310, 2, 2, 6},
+    {24, 5, 23, 4},
+    {19227, 1, 17, 8121},
+    {24, 5, 0, 8123},
+    {343, 2, 23, 4},
+    {4, 2, 2, 5},
+    {22422, 1, 27, 4},
+    {27, 3, 2, 5},
+    {6756, 0, 0, 8128},
+    {24, 5, 19, 3},
+    {7189, 0, 35, 6},
+    {576979, 1, 0, 8159},
+    {381129, 1, 0, 8153},
+    {330968, 1, 0, 8149},
+    {20, 5, 17, 8133},
+    {22, 5, 0, 8135},
+    {25, 3, 11, 5},
+    {5497, 0, 0, 8148},
+    {13, 3, 0, 8138},
+    {995, 2, 23, 3},
+    {24, 5, 0, 8143},
+    {23, 5, 0, 8141},
+    {181236, 1, 19, 3},
+    {4223, 0, 21, 8142},
+    {1174, 2, 15, 4},
+    {375, 2, 0, 8146},
+    {5283, 0, 2, 4},
+    {23, 3, 15, 5},
+    {1199, 2, 17, 8147},
+    {1558, 2, 23, 4},
+    {24, 2, 19, 5},
+    {20, 3, 0, 8151},
+    {24, 5, 7, 6},
+    {25, 3, 13, 8152},
+    {4270, 0, 11, 5},
+    {22, 5, 0, 8156},
+    {688, 2, 17, 8155},
+    {5649, 2, 23, 4},
+    {101, 2, 2, 5},
+    {548111, 1, 2, 3},
+    {6308, 0, 19, 6},
+    {705046, 1, 0, 8168},
+    {25, 3, 0, 8165},
+    {3991, 0, 0, 8163},
+    {3837, 0, 15, 4},
+    {2628, 2, 2, 3},
+    {25, 5, 11, 5},
+    {623063, 1, 2, 4},
+    {4120, 0, 13, 8167},
+    {25, 5, 23, 4},
+    {1431, 2, 0, 8173},
+    {710, 2, 2, 6},
+    {526, 2, 2, 5},
+    {4406, 0, 17, 8172},
+    {752991, 1, 23, 6},
+    {965969, 1, 2, 5},
+    {22, 5, 23, 4},
+    {789, 2, 0, 8506},
+    {6132, 0, 0, 8478},
+    {612080, 1, 0, 8364},
+    {3834, 0, 0, 8219},
+    {2, 2, 21, 8180},
+    {227921, 1, 0, 8193},
+    {3830, 0, 2, 3},
+    {30, 3, 0, 8191},
+    {22, 3, 21, 8184},
+    {24, 3, 0, 8186},
+    {8, 2, 27, 4},
+    {23, 2, 2, 5},
+    {32, 5, 21, 8188},
+    {147074, 1, 2, 4},
+    {112316, 1, 2, 6},
+    {36, 5, 27, 4},
+    {97299, 1, 2, 3},
+    {9, 2, 15, 5},
+    {41, 2, 0, 8202},
+    {3691, 0, 0, 8200},
+    {36, 5, 0, 8198},
+    {31, 5, 2, 5},
+    {3623, 0, 19, 5},
+    {26, 3, 2, 4},
+    {3665, 0, 27, 5},
+    {3799, 0, 25, 8201},
+    {29, 5, 19, 5},
+    {22, 3, 21, 8203},
+    {3562, 0, 21, 8204},
+    {3762, 0, 0, 8217},
+    {44, 2, 29, 8206},
+    {340022, 1, 25, 8207},
+    {540483, 1, 0, 8214},
+    {26, 3, 0, 8213},
+    {23, 3, 21, 8210},
+    {354, 2, 25, 8211},
+    {3603, 0, 2, 5},
+    {31, 5, 27, 5},
+    {3577, 0, 27, 5},
+    {548442, 1, 29, 8215},
+    {149, 2, 2, 6},
+    {31, 5, 23, 6},
+    {31, 3, 21, 8218},
+    {30, 5, 23, 6},
+    {19188, 1, 21, 8220},
+    {359, 2, 0, 8345},
+    {23, 3, 0, 8261},
+    {8, 3, 0, 8238},
+    {4541, 0, 0, 8237},
+    {31, 5, 21, 8225},
+    {58, 2, 0, 8235},
+    {7, 3, 2, 4},
+    {330362, 1, 0, 8233},
+    {34, 5, 0, 8230},
+    {40, 2, 23, 4},
+    {105955, 1, 21, 8231},
+    {36, 5, 25, 8232},
+    {26, 2, 27, 4},
+    {33, 5, 17, 8234},
+    {36, 5, 23, 4},
+    {4191, 0, 21, 8236},
+    {4344, 0, 19, 5},
+    {227, 2, 23, 6},
+    {31437, 1, 21, 8239},
+    {2, 2, 0, 8246},
+    {125312, 1, 0, 8244},
+    {31716, 1, 13, 8242},
+    {5405, 0, 21, 8243},
+    {5609, 0, 15, 5},
+    {4741, 0, 2, 4},
+    {29, 5, 23, 6},
+    {4629, 0, 2, 5},
+    {381467, 1, 2, 5},
+    {378344, 1, 2, 3},
+    {228, 2, 2, 5},
+    {4550, 0, 0, 8259},
+    {4466, 0, 0, 8257},
+    {113, 2, 21, 8253},
+    {4355, 0, 0, 8256},
+    {121, 2, 2, 5},
+    {3992, 0, 23, 3},
+    {131, 2, 23, 6},
+    {91523, 1, 2, 5},
+    {69121, 1, 23, 1},
+    {4625, 0, 2, 3},
+    {4558, 0, 15, 5},
+    {60, 2, 0, 8316},
+    {323846, 1, 0, 8304},
+    {4346, 0, 0, 8282},
+    {28493, 1, 0, 8267},
+    {4013, 0, 2, 5},
+    {3985, 0, 23, 3},
+    {47, 2, 2, 6},
+    {42771, 1, 0, 8274},
+    {2, 2, 2, 5},
+    {32, 5, 0, 8273},
+    {4285, 0, 21, 8272},
+    {29, 5, 19, 5},
+    {33395, 1, 19, 5},
+    {30, 5, 21, 8275},
+    {28, 3, 0, 8279},
+    {26, 3, 2, 6},
+    {32, 5, 2, 5},
+    {31, 5, 23, 6},
+    {54506, 1, 2, 5},
+    {30, 3, 17, 8281},
+    {34, 5, 23, 6},
+    {5717, 0, 0, 8295},
+    {33804, 1, 21, 8284},
+    {35034, 1, 9, 8285},
+    {5, 2, 0, 8291},
+    {4, 2, 0, 8290},
+    {5265, 0, 21, 8288},
+    {29, 5, 17, 8289},
+    {34, 5, 23, 4},
+    {4728, 0, 23, 3},
+    {38419, 1, 25, 8292},
+    {59, 2, 2, 2},
+    {4675, 0, 2, 5},
+    {4671, 0, 23, 2},
+    {5887, 0, 2, 5},
+    {15, 2, 0, 8302},
+    {5863, 0, 0, 8301},
+    {28, 3, 2, 5},
+    {28, 5, 21, 8300},
+    {5845, 0, 23, 4},
+    {32, 5, 19, 6},
+    {32, 5, 2, 4},
+    {28, 5, 23, 6},
+    {4756, 0, 0, 8313},
+    {37, 5, 0, 8311},
+    {4166, 0, 21, 8307},
+    {29, 3, 0, 8310},
+    {4279, 0, 21, 8309},
+    {32, 5, 23, 6},
+    {4237, 0, 19, 5},
+    {26, 3, 25, 8312},
+    {423492, 1, 23, 4},
+    {28, 3, 2, 6},
+    {5066, 0, 2, 5},
+    {31, 5, 23, 6},
+    {5263, 0, 0, 8328},
+    {77896, 1, 0, 8321},
+    {25688, 1, 0, 8320},
+    {4521, 0, 23, 6},
+    {76797, 1, 23, 6},
+    {31, 3, 0, 8324},
+    {5199, 0, 21, 8323},
+    {101696, 1, 15, 5},
+    {62, 2, 25, 8325},
+    {350, 2, 2, 6},
+    {114, 2, 2, 5},
+    {106, 2, 23, 6},
+    {590686, 1, 2, 3},
+    {5809, 0, 2, 5},
+    {5784, 0, 2, 4},
+    {31, 3, 0, 8343},
+    {173, 2, 0, 8338},
+    {308193, 1, 2, 5},
+    {152, 2, 2, 5},
+    {125, 2, 0, 8337},
+    {28, 5, 19, 5},
+    {29, 5, 23, 4},
+    {305, 2, 2, 4},
+    {5322, 0, 21, 8340},
+    {28, 3, 0, 8342},
+    {35, 5, 27, 5},
+    {305952, 1, 23, 6},
+    {85, 2, 2, 5},
+    {34, 5, 19, 6},
+    {149085, 1, 0, 8353},
+    {13, 3, 13, 8347},
+    {670, 2, 2, 6},
+    {29, 3, 0, 8351},
+    {5001, 0, 2, 5},
+    {94022, 1, 27, 5},
+    {31, 3, 2, 6},
+    {471, 2, 23, 1},
+    {30, 3, 0, 8360},
+    {361, 2, 0, 8356},
+    {4984, 0, 15, 6},
+    {28, 5, 0, 8358},
+    {487, 2, 23, 4},
+    {5847, 0, 21, 8359},
+    {392534, 1, 19, 5},
+    {515, 2, 0, 8362},
+    {475867, 1, 19, 3},
+    {541, 2, 25, 8363},
+    {593281, 1, 23, 6},
+    {155, 2, 0, 8437},
+    {9, 3, 0, 8367},
+    {34, 5, 23, 4},
+    {22, 3, 0, 8377},
+    {30, 5, 21, 8369},
+    {12, 2, 2, 5},
+    {37, 5, 2, 5},
+    {36, 5, 2, 6},
+    {2, 2, 0, 8374},
+    {34, 5, 23, 4},
+    {32, 5, 2, 5},
+    {31, 5, 2, 6},
+    {15, 3, 27, 5},
+    {28, 5, 0, 8390},
+    {24, 3, 17, 8379},
+    {25, 3, 0, 8381},
+    {3995, 0, 27, 5},
+    {27, 3, 0, 8385},
+    {26, 3, 17, 8383},
+    {27, 5, 17, 8384},
+    {4298, 0, 23, 4},
+    {756418, 1, 0, 8388},
+    {30, 3, 17, 8387},
+    {4071, 0, 23, 4},
+    {27, 5, 21, 8389},
+    {10, 2, 23, 6},
+    {32, 5, 0, 8412},
+    {29, 3, 0, 8410},
+    {856020, 1, 0, 8403},
+    {29, 5, 0, 8398},
+    {16, 2, 0, 8397},
+    {28, 3, 2, 4},
+    {707021, 1, 27, 4},
+    {655893, 1, 19, 5},
+    {3879, 0, 2, 6},
+    {695299, 1, 0, 8401},
+    {30, 5, 19, 5},
+    {26, 3, 2, 5},
+    {25, 3, 23, 4},
+    {12, 2, 2, 6},
+    {981453, 1, 2, 5},
+    {27, 3, 2, 5},
+    {3930, 0, 25, 8407},
+    {30, 5, 21, 8408},
+    {24, 3, 2, 6},
+    {885978, 1, 27, 5},
+    {7, 2, 2, 5},
+    {30, 5, 23, 6},
+    {37, 5, 0, 8433},
+    {53, 2, 0, 8422},
+    {35, 5, 0, 8419},
+    {807469, 1, 2, 6},
+    {33, 5, 0, 8418},
+    {26, 3, 27, 5},
+    {774485, 1, 27, 5},
+    {29, 3, 25, 8420},
+    {36, 5, 2, 5},
+    {31, 3, 23, 4},
+    {83, 2, 21, 8423},
+    {729496, 1, 0, 8430},
+    {3954, 0, 0, 8427},
+    {26, 3, 17, 8426},
+    {35, 5, 23, 4},
+    {91, 2, 25, 8428},
+    {29, 3, 2, 5},
+    {130, 2, 23, 6},
+    {821900, 1, 0, 8432},
+    {35, 5, 19, 6},
+    {35, 5, 27, 5},
+    {69, 2, 2, 5},
+    {26, 3, 17, 8435},
+    {3989, 0, 2, 5},
+    {31, 3, 19, 5},
+    {3697, 0, 0, 8448},
+    {17, 3, 21, 8439},
+    {30, 3, 0, 8446},
+    {1015052, 1, 0, 8445},
+    {3605, 0, 2, 6},
+    {20, 3, 25, 8443},
+    {32, 5, 2, 5},
+    {30, 5, 23, 6},
+    {3578, 0, 19, 5},
+    {31, 3, 29, 8447},
+    {3661, 0, 23, 4},
+    {735289, 1, 0, 8461},
+    {4929, 0, 0, 8452},
+    {660396, 1, 21, 8451},
+    {661330, 1, 27, 5},
+    {695983, 1, 2, 5},
+    {5286, 0, 0, 8458},
+    {648982, 1, 0, 8457},
+    {5067, 0, 2, 6},
+    {37, 5, 19, 6},
+    {4977, 0, 27, 5},
+    {5367, 0, 21, 8459},
+    {665379, 1, 21, 8460},
+    {34, 5, 27, 5},
+    {3968, 0, 0, 8468},
+    {820392, 1, 0, 8465},
+    {3798, 0, 2, 5},
+    {3774, 0, 23, 6},
+    {24, 3, 2, 6},
+    {17, 3, 2, 5},
+    {3754, 0, 23, 6},
+    {22, 3, 0, 8471},
+    {269, 2, 2, 5},
+    {870593, 1, 23, 4},
+    {783800, 1, 2, 5},
+    {763030, 1, 0, 8475},
+    {4599, 0, 21, 8474},
+    {4776, 0, 27, 5},
+    {256, 2, 21, 8476},
+    {763419, 1, 17, 8477},
+    {31, 5, 23, 6},
+    {1, 2, 25, 8479},
+    {48932, 1, 0, 8488},
+    {6159, 1, 33, 8481},
+    {47342, 1, 0, 8487},
+    {31, 5, 0, 8484},
+    {27, 5, 19, 5},
+    {36, 5, 2, 5},
+    {6448, 0, 17, 8486},
+    {6711, 0, 27, 5},
+    {7125, 0, 35, 3},
+    {30, 5, 0, 8500},
+    {28, 5, 0, 8494},
+    {31, 3, 2, 5},
+    {376234, 1, 0, 8493},
+    {215801, 1, 27, 4},
+    {27, 5, 23, 6},
+    {17, 3, 0, 8496},
+    {589526, 1, 23, 4},
+    {7125, 0, 0, 8498},
+    {6299, 0, 23, 4},
+    {7431, 0, 21, 8499},
+    {28, 3, 27, 5},
+    {7416, 0, 21, 8501},
+    {563374, 1, 2, 2},
+    {30, 3, 2, 5},
+    {23, 3, 21, 8504},
+    {7527, 0, 2, 5},
+    {36, 5, 27, 5},
+    {34, 5, 0, 8564},
+    {33, 5, 0, 8554},
+    {13, 3, 0, 8512},
+    {4252, 0, 2, 5},
+    {3962, 0, 21, 8511},
+    {4161, 0, 19, 3},
+    {598455, 1, 0, 8520},
+    {17, 3, 2, 5},
+    {258778, 1, 17, 8515},
+    {31, 5, 0, 8519},
+    {15, 3, 17, 8517},
+    {16, 3, 21, 8518},
+    {1271, 2, 19, 5},
+    {467048, 1, 27, 5},
+    {2440, 2, 0, 8544},
+    {4095, 0, 0, 8529},
+    {1120, 2, 0, 8526},
+    {16, 3, 17, 8524},
+    {32, 5, 2, 6},
+    {958, 2, 23, 6},
+    {29, 3, 2, 5},
+    {1890, 2, 2, 4},
+    {826753, 1, 19, 5},
+    {17, 3, 21, 8530},
+    {21, 3, 17, 8531},
+    {22, 3, 25, 8532},
+    {24, 3, 0, 8534},
+    {712128, 1, 19, 5},
+    {5322, 0, 2, 5},
+    {30, 3, 0, 8542},
+    {886060, 1, 2, 4},
+    {1920, 2, 2, 6},
+    {31, 5, 2, 6},
+    {736526, 1, 21, 8540},
+    {1180, 2, 25, 8541},
+    {4864, 0, 23, 6},
+    {4906, 0, 17, 8543},
+    {5167, 0, 23, 6},
+    {2834, 2, 0, 8547},
+    {3897, 0, 17, 8546},
+    {624813, 1, 27, 3},
+    {15, 3, 0, 8549},
+    {5040, 0, 23, 3},
+    {2990, 2, 17, 8550},
+    {929370, 1, 2, 5},
+    {24, 3, 21, 8552},
+    {28, 5, 21, 8553},
+    {31, 5, 19, 5},
+    {211254, 1, 0, 8559},
+    {179862, 1, 2, 3},
+    {955, 2, 21, 8557},
+    {24, 3, 2, 6},
+    {1380, 2, 23, 6},
+    {4593, 0, 2, 5},
+    {1132, 2, 0, 8562},
+    {859, 2, 23, 6},
+    {4411, 0, 21, 8563},
+    {451665, 1, 23, 6},
+    {4364, 0, 0, 8579},
+    {35, 5, 0, 8568},
+    {12, 3, 2, 6},
+    {3821, 0, 15, 5},
+    {36, 5, 2, 6},
+    {17, 3, 0, 8574},
+    {970, 2, 25, 8571},
+    {1176, 2, 17, 8572},
+    {3792, 0, 2, 6},
+    {3762, 0, 27, 4},
+    {629986, 1, 21, 8575},
+    {1130, 2, 25, 8576},
+    {1691, 2, 21, 8577},
+    {28, 3, 25, 8578},
+    {30, 3, 23, 6},
+    {1418, 2, 0, 8583},
+    {60284, 1, 2, 5},
+    {31, 3, 2, 6},
+    {20, 3, 11, 5},
+    {14, 3, 0, 8586},
+    {753904, 1, 21, 8585},
+    {35, 5, 23, 6},
+    {6928, 0, 0, 8606},
+    {6393, 0, 0, 8603},
+    {5445, 0, 0, 8599},
+    {35, 5, 0, 8593},
+    {2324, 2, 0, 8592},
+    {389737, 1, 19, 5},
+    {326290, 1, 23, 3},
+    {4937, 0, 2, 5},
+    {36, 5, 0, 8596},
+    {440446, 1, 23, 6},
+    {25, 3, 17, 8597},
+    {27, 3, 21, 8598},
+    {29, 3, 27, 5},
+    {6227, 0, 2, 5},
+    {36, 5, 0, 8602},
+    {4485, 2, 27, 5},
+    {28, 3, 23, 6},
+    {36, 5, 2, 4},
+    {459899, 1, 2, 6},
+    {6744, 0, 19, 3},
+    {28, 3, 2, 5},
+    {7285, 0, 15, 5},
+    {106, 2, 0, 8667},
+    {3657, 0, 0, 8617},
+    {99, 2, 2, 7},
+    {30, 3, 0, 8615},
+    {3600, 0, 0, 8614},
+    {39, 2, 23, 6},
+    {16, 3, 27, 4},
+    {31, 3, 2, 5},
+    {487202, 1, 27, 7},
+    {7, 3, 0, 8621},
+    {39, 5, 21, 8619},
+    {3, 3, 2, 6},
+    {452095, 1, 23, 4},
+    {115326, 1, 0, 8634},
+    {48, 5, 2, 2},
+    {6818, 0, 2, 3},
+    {2, 2, 21, 8625},
+    {24, 3, 0, 8627},
+    {4186, 0, 19, 5},
+    {29, 3, 0, 8629},
+    {26, 3, 27, 5},
+    {31, 3, 0, 8631},
+    {5, 2, 19, 5},
+    {40, 5, 2, 5},
+    {3922, 0, 17, 8633},
+    {9, 2, 19, 5},
+    {11, 2, 0, 8647},
+    {4416, 0, 0, 8641},
+    {940561, 1, 0, 8640},
+    {39, 5, 2, 5},
+    {23, 3, 21, 8639},
+    {29, 3, 19, 5},
+    {7, 2, 27, 5},
+    {43, 5, 2, 6},
+    {41, 5, 2, 4},
+    {6120, 0, 0, 8645},
+    {3, 2, 19, 5},
+    {2, 2, 2, 4},
+    {40, 5, 27, 5},
+    {98, 2, 0, 8666},
+    {41, 5, 0, 8653},
+    {39, 5, 21, 8650},
+    {71, 2, 0, 8652},
+    {927847, 1, 27, 4},
+    {94, 2, 23, 6},
+    {186190, 1, 0, 8656},
+    {71, 2, 2, 5},
+    {42, 5, 19, 5},
+    {43, 5, 0, 8664},
+    {24, 3, 0, 8660},
+    {5601, 0, 21, 8659},
+    {6722, 0, 27, 5},
+    {42, 5, 0, 8662},
+    {3755, 0, 19, 6},
+    {71, 2, 2, 4},
+    {363188, 1, 23, 6},
+    {44, 5, 25, 8665},
+    {589106, 1, 23, 4},
+    {155205, 1, 19, 5},
+    {4351, 0, 0, 8731},
+    {545, 2, 0, 8684},
+    {13, 3, 0, 8676},
+    {9, 3, 0, 8675},
+    {4326, 0, 2, 6},
+    {120, 2, 21, 8673},
+    {3934, 0, 2, 4},
+    {40, 5, 19, 5},
+    {12, 3, 23, 4},
+    {300027, 1, 21, 8677},
+    {29, 3, 2, 6},
+    {486308, 1, 0, 8683},
+    {3614, 0, 21, 8680},
+    {24, 3, 2, 6},
+    {241, 2, 21, 8682},
+    {3682, 0, 23, 6},
+    {14, 3, 27, 5},
+    {31596, 1, 0, 8686},
+    {3735, 0, 27, 3},
+    {28, 3, 0, 8721},
+    {687147, 1, 0, 8712},
+    {1535, 2, 0, 8699},
+    {715, 2, 0, 8691},
+    {47, 5, 23, 4},
+    {3586, 0, 0, 8693},
+    {3543, 0, 27, 5},
+    {1335, 2, 0, 8696},
+    {3785, 0, 2, 6},
+    {938, 2, 19, 6},
+    {1350, 2, 17, 8697},
+    {23, 3, 25, 8698},
+    {3977, 0, 27, 4},
+    {334844, 1, 25, 8700},
+    {15, 3, 0, 8702},
+    {3656, 0, 19, 5},
+    {39, 5, 0, 8704},
+    {3668, 0, 23, 4},
+    {4691, 2, 2, 6},
+    {2916, 2, 2, 5},
+    {24, 3, 0, 8709},
+    {45, 5, 21, 8708},
+    {48, 5, 27, 5},
+    {2054, 2, 0, 8711},
+    {47, 5, 23, 6},
+    {46, 5, 27, 5},
+    {10, 3, 21, 8713},
+    {3757, 0, 0, 8720},
+    {3730, 0, 2, 5},
+    {740371, 1, 21, 8716},
+    {1143253, 1, 2, 5},
+    {18, 3, 25, 8718},
+    {3556, 0, 25, 8719},
+    {1079, 2, 27, 5},
+    {4258, 0, 27, 5},
+    {30, 3, 0, 8727},
+    {954, 2, 0, 8725},
+    {3727, 0, 17, 8724},
+    {4079, 0, 27, 5},
+    {1586, 2, 21, 8726},
+    {332883, 1, 23, 6},
+    {2385, 2, 0, 8730},
+    {1354, 2, 21, 8729},
+    {717423, 1, 27, 5},
+    {3687, 0, 19, 6},
+    {1310, 2, 0, 8770},
+    {42, 5, 0, 8760},
+    {5847, 0, 0, 8748},
+    {13, 3, 21, 8735},
+    {40, 5, 0, 8746},
+    {5498, 0, 2, 5},
+    {5372, 0, 0, 8745},
+    {14, 3, 17, 8739},
+    {43077, 1, 0, 8741},
+    {315, 2, 23, 6},
+    {39, 5, 2, 5},
+    {29, 3, 21, 8743},
+    {218, 2, 25, 8744},
+    {833, 2, 23, 4},
+    {706613, 1, 27, 4},
+    {997, 2, 2, 5},
+    {18, 3, 27, 5},
+    {15, 3, 2, 5},
+    {41, 5, 2, 6},
+    {10, 3, 0, 8754},
+    {316, 2, 2, 5},
+    {299, 2, 2, 6},
+    {501448, 1, 23, 6},
+    {40, 5, 0, 8756},
+    {493776, 1, 27, 5},
+    {13, 3, 2, 5},
+    {11, 3, 25, 8758},
+    {12, 3, 21, 8759},
+    {432556, 1, 23, 6},
+    {48, 5, 0, 8765},
+    {571854, 1, 21, 8762},
+    {45, 5, 2, 5},
+    {4630, 0, 25, 8764},
+    {595141, 1, 27, 5},
+    {49, 5, 0, 8769},
+    {6997, 0, 2, 5},
+    {1127, 2, 2, 4},
+    {30, 3, 27, 4},
+    {297956, 1, 19, 5},
+    {16, 3, 0, 8773},
+    {41, 5, 2, 5},
+    {4605, 0, 19, 5},
+    {4918, 0, 0, 8782},
+    {4443, 0, 0, 8776},
+    {48, 5, 23, 4},
+    {29, 3, 0, 8780},
+    {3022, 2, 25, 8778},
+    {45, 5, 2, 4},
+    {4597, 0, 11, 6},
+    {500401, 1, 2, 6},
+    {45, 5, 27, 4},
+    {446942, 1, 0, 8803},
+    {437023, 1, 2, 3},
+    {29, 3, 0, 8799},
+    {395401, 1, 0, 8798},
+    {6645, 0, 0, 8796},
+    {28, 3, 2, 6},
+    {242917, 1, 0, 8794},
+    {5499, 0, 2, 5},
+    {2231, 2, 0, 8793},
+    {5129, 0, 13, 8792},
+    {43, 5, 19, 3},
+    {5245, 0, 23, 3},
+    {6032, 0, 25, 8795},
+    {46, 5, 19, 5},
+    {7407, 0, 13, 8797},
+    {374157, 1, 23, 3},
+    {28, 3, 23, 6},
+    {386647, 1, 0, 8802},
+    {325357, 1, 21, 8801},
+    {46, 5, 27, 5},
+    {46, 5, 19, 5},
+    {4954, 0, 0, 8805},
+    {4939, 0, 23, 3},
+    {49, 5, 2, 5},
+    {4745, 2, 0, 8808},
+    {694526, 1, 23, 6},
+    {42, 5, 25, 8809},
+    {43, 5, 23, 6},
+    {65, 3, 0, 10525},
+    {7042, 0, 0, 10357},
+    {30, 5, 0, 9228},
+    {26, 5, 0, 8921},
+    {58, 3, 0, 8905},
+    {39, 3, 0, 8860},
+    {5521, 0, 0, 8855},
+    {3655, 0, 0, 8821},
+    {132, 2, 0, 8820},
+    {3554, 0, 7, 6},
+    {552970, 1, 15, 4},
+    {5411, 0, 0, 8854},
+    {22, 5, 0, 8827},
+    {21, 5, 0, 8825},
+    {3882, 0, 19, 5},
+    {437290, 1, 21, 8826},
+    {2984, 2, 19, 5},
+    {23, 5, 0, 8832},
+    {367827, 1, 0, 8831},
+    {275123, 1, 2, 3},
+    {3567, 2, 27, 3},
+    {4804, 0, 23, 4},
+    {3898, 0, 0, 8839},
+    {434914, 1, 2, 4},
+    {25, 5, 0, 8837},
+    {24, 5, 21, 8836},
+    {34, 3, 15, 5},
+    {35, 3, 21, 8838},
+    {145174, 1, 27, 5},
+    {24, 5, 0, 8842},
+    {37, 3, 21, 8841},
+    {594887, 1, 23, 6},
+    {25, 5, 21, 8843},
+    {5272, 0, 2, 4},
+    {4901, 0, 2, 5},
+    {4242, 0, 0, 8851},
+    {4019, 0, 0, 8849},
+    {9, 2, 2, 4},
+    {3983, 0, 23, 4},
+    {51800, 1, 21, 8850},
+    {54506, 1, 27, 5},
+    {260912, 1, 0, 8853},
+    {4465, 0, 19, 6},
+    {4631, 0, 19, 5},
+    {5434, 0, 11, 5},
+    {25, 5, 0, 8859},
+    {6208, 0, 0, 8858},
+    {22, 5, 23, 4},
+    {36, 3, 27, 5},
+    {34, 3, 19, 5},
+    {3544, 0, 0, 8866},
+    {454994, 1, 0, 8865},
+    {3534, 0, 2, 4},
+    {45, 3, 2, 5},
+    {3524, 0, 19, 5},
+    {3532, 0, 15, 2},
+    {209753, 1, 0, 8881},
+    {6348, 0, 0, 8875},
+    {41, 3, 0, 8872},
+    {125820, 1, 2, 5},
+    {95936, 1, 2, 6},
+    {4639, 0, 23, 6},
+    {46, 3, 21, 8873},
+    {48, 3, 2, 5},
+    {4873, 0, 27, 5},
+    {46, 3, 0, 8880},
+    {1, 2, 0, 8878},
+    {6448, 0, 19, 5},
+    {6620, 0, 25, 8879},
+    {6855, 0, 19, 5},
+    {7011, 0, 19, 6},
+    {763030, 1, 0, 8898},
+    {235150, 1, 0, 8885},
+    {231754, 1, 2, 1},
+    {94, 2, 19, 5},
+    {24, 5, 0, 8893},
+    {22, 5, 2, 5},
+    {1865, 2, 0, 8892},
+    {20, 5, 17, 8889},
+    {21, 5, 21, 8890},
+    {342482, 1, 17, 8891},
+    {501693, 1, 23, 4},
+    {4238, 0, 27, 5},
+    {49, 3, 2, 5},
+    {41, 3, 0, 8897},
+    {40, 3, 21, 8896},
+    {5720, 0, 19, 5},
+    {6312, 0, 23, 4},
+    {3635, 0, 25, 8899},
+    {728, 2, 21, 8900},
+    {4624, 0, 2, 6},
+    {49, 3, 21, 8902},
+    {24, 5, 0, 8904},
+    {779304, 1, 23, 4},
+    {54, 3, 23, 4},
+    {19, 5, 17, 8906},
+    {21, 5, 0, 8908},
+    {414, 2, 27, 5},
+    {4025, 0, 2, 5},
+    {695, 2, 0, 8916},
+    {469413, 1, 2, 5},
+    {144052, 1, 0, 8915},
+    {38934, 1, 21, 8913},
+    {60, 3, 21, 8914},
+    {42, 2, 27, 4},
+    {121, 2, 27, 5},
+    {2434, 2, 0, 8920},
+    {60, 3, 17, 8918},
+    {23, 5, 21, 8919},
+    {326421, 1, 23, 4},
+    {3842, 0, 27, 5},
+    {3988, 0, 0, 9027},
+    {762, 2, 0, 9006},
+    {56, 3, 0, 8991},
+    {42, 3, 0, 8951},
+    {3551, 0, 17, 8926},
+    {388752, 1, 0, 8945},
+    {33, 3, 0, 8931},
+    {3704, 0, 25, 8929},
+    {15449, 1, 13, 8930},
+    {13, 2, 23, 4},
+    {357779, 1, 2, 4},
+    {52646, 1, 0, 8941},
+    {5, 2, 0, 8936},
+    {3748, 0, 25, 8935},
+    {1, 2, 23, 4},
+    {28, 5, 0, 8939},
+    {30013, 1, 21, 8938},
+    {3921, 0, 19, 5},
+    {49762, 1, 21, 8940},
+    {9, 2, 23, 6},
+    {40, 3, 2, 5},
+    {35, 3, 2, 6},
+    {82, 2, 21, 8944},
+    {34, 3, 27, 5},
+    {280, 2, 21, 8946},
+    {300, 2, 0, 8949},
+    {40, 3, 25, 8948},
+    {292, 2, 23, 3},
+    {754235, 1, 21, 8950},
+    {36, 3, 27, 5},
+    {326964, 1, 0, 8961},
+    {29, 5, 0, 8958},
+    {3892, 0, 2, 4},
+    {27, 5, 0, 8956},
+    {3666, 0, 23, 4},
+    {195047, 1, 21, 8957},
+    {287002, 1, 27, 5},
+    {206, 2, 2, 5},
+    {23, 2, 2, 4},
+    {47, 3, 19, 5},
+    {37, 2, 0, 8965},
+    {2, 2, 2, 6},
+    {3605, 0, 21, 8964},
+    {386726, 1, 27, 4},
+    {250, 2, 0, 8984},
+    {71, 2, 0, 8970},
+    {418490, 1, 17, 8968},
+    {65, 2, 2, 6},
+    {3833, 0, 23, 6},
+    {3761, 0, 0, 8979},
+    {985893, 1, 2, 4},
+    {3552, 0, 13, 8973},
+    {47, 3, 0, 8975},
+    {758153, 1, 23, 6},
+    {49, 3, 0, 8977},
+    {558779, 1, 19, 6},
+    {29, 5, 21, 8978},
+    {576056, 1, 27, 4},
+    {465115, 1, 21, 8980},
+    {54, 3, 2, 5},
+    {90, 2, 21, 8982},
+    {28, 5, 2, 4},
+    {155, 2, 19, 5},
+    {27, 5, 21, 8985},
+    {28, 5, 25, 8986},
+    {29, 5, 0, 8989},
+    {45, 3, 25, 8988},
+    {776774, 1, 27, 5},
+    {46, 3, 2, 6},
+    {44, 3, 27, 5},
+    {444488, 1, 0, 8996},
+    {106294, 1, 0, 8994},
+    {63, 3, 23, 4},
+    {179, 2, 25, 8995},
+    {57, 3, 27, 5},
+    {62, 3, 2, 5},
+    {614, 2, 2, 6},
+    {28, 5, 0, 9001},
+    {3792, 0, 2, 5},
+    {95, 2, 27, 4},
+    {59, 3, 0, 9003},
+    {3827, 0, 23, 6},
+    {61, 3, 0, 9005},
+    {3725, 0, 19, 5},
+    {3702, 0, 23, 4},
+    {33, 3, 13, 9007},
+    {56, 3, 0, 9024},
+    {28, 5, 0, 9017},
+    {3203, 2, 0, 9016},
+    {27, 5, 0, 9013},
+    {727124, 1, 2, 5},
+    {55, 3, 19, 5},
+    {308437, 1, 17, 9014},
+    {40, 3, 2, 5},
+    {38, 3, 23, 4},
+    {38, 3, 15, 5},
+    {29, 5, 0, 9021},
+    {3699, 0, 21, 9019},
+    {3918, 0, 2, 5},
+    {4411, 2, 19, 6},
+    {425757, 1, 21, 9022},
+    {1423, 2, 25, 9023},
+    {3647, 0, 19, 5},
+    {3921, 0, 0, 9026},
+    {145203, 1, 23, 4},
+    {3971, 0, 11, 4},
+    {105600, 1, 0, 9076},
+    {5488, 0, 0, 9047},
+    {46, 3, 21, 9030},
+    {56, 3, 0, 9044},
+    {14125, 1, 21, 9032},
+    {54, 3, 0, 9043},
+    {52, 3, 2, 5},
+    {27, 5, 0, 9036},
+    {51, 3, 19, 5},
+    {28, 5, 0, 9038},
+    {5344, 0, 23, 6},
+    {29, 5, 0, 9041},
+    {4628, 0, 2, 5},
+    {62101, 1, 27, 4},
+    {5203, 0, 21, 9042},
+    {2, 2, 23, 4},
+    {73807, 1, 19, 5},
+    {687, 2, 2, 5},
+    {57, 3, 2, 5},
+    {161, 2, 19, 6},
+    {36, 3, 0, 9056},
+    {5778, 0, 21, 9049},
+    {6395, 0, 2, 6},
+    {34, 3, 0, 9052},
+    {5986, 0, 23, 4},
+    {19, 2, 2, 4},
+    {29, 5, 2, 4},
+    {4, 2, 2, 5},
+    {89970, 1, 27, 5},
+    {6429, 0, 2, 5},
+    {52, 3, 2, 5},
+    {48, 3, 0, 9075},
+    {5630, 0, 0, 9062},
+    {43802, 1, 21, 9061},
+    {46, 3, 19, 6},
+    {27, 5, 0, 9065},
+    {45, 3, 2, 1},
+    {5968, 0, 23, 6},
+    {5692, 0, 21, 9066},
+    {28, 5, 0, 9069},
+    {6051, 0, 2, 5},
+    {39933, 1, 19, 6},
+    {29, 5, 0, 9072},
+    {364, 2, 2, 6},
+    {6163, 0, 27, 5},
+    {38, 3, 21, 9073},
+    {90, 2, 2, 5},
+    {55794, 1, 19, 6},
+    {6333, 0, 27, 5},
+    {54, 2, 0, 9131},
+    {1, 2, 0, 9083},
+    {4941, 0, 0, 9082},
+    {27, 5, 2, 4},
+    {290291, 1, 17, 9081},
+    {43, 3, 23, 4},
+    {6323, 0, 23, 4},
+    {5973, 0, 0, 9121},
+    {33, 3, 0, 9087},
+    {27, 5, 25, 9086},
+    {4067, 0, 27, 5},
+    {739230, 1, 0, 9120},
+    {29, 5, 0, 9115},
+    {28, 5, 0, 9104},
+    {4853, 0, 0, 9097},
+    {489116, 1, 2, 6},
+    {10, 2, 0, 9094},
+    {4370, 0, 19, 6},
+    {4624, 0, 2, 4},
+    {4501, 0, 2, 6},
+    {52, 3, 23, 6},
+    {43, 2, 2, 4},
+    {54, 3, 2, 5},
+    {47, 3, 0, 9102},
+    {3, 2, 21, 9101},
+    {5282, 0, 27, 5},
+    {18, 2, 17, 9103},
+    {347076, 1, 23, 4},
+    {38, 3, 0, 9108},
+    {10, 2, 0, 9107},
+    {4, 2, 23, 4},
+    {4490, 0, 23, 6},
+    {17, 2, 25, 9109},
+    {50, 3, 21, 9110},
+    {58, 3, 0, 9114},
+    {345065, 1, 2, 6},
+    {21, 2, 21, 9113},
+    {299610, 1, 19, 5},
+    {43, 2, 23, 6},
+    {52, 3, 21, 9116},
+    {60, 3, 2, 6},
+    {8, 2, 25, 9118},
+    {55, 3, 21, 9119},
+    {26, 2, 23, 6},
+    {31, 2, 23, 4},
+    {56, 3, 2, 5},
+    {27, 5, 0, 9125},
+    {6439, 0, 21, 9124},
+    {6830, 0, 19, 6},
+    {28, 5, 21, 9126},
+    {157771, 1, 17, 9127},
+    {29, 5, 0, 9130},
+    {47, 3, 2, 4},
+    {4, 2, 19, 5},
+    {6250, 0, 19, 5},
+    {43, 3, 0, 9163},
+    {551, 2, 0, 9139},
+    {5188, 0, 2, 5},
+    {599166, 1, 21, 9135},
+    {175, 2, 2, 5},
+    {744322, 1, 2, 5},
+    {39, 3, 2, 6},
+    {4188, 0, 23, 6},
+    {5045, 0, 0, 9149},
+    {1169, 2, 21, 9141},
+    {36, 3, 0, 9147},
+    {4586, 0, 0, 9145},
+    {35, 3, 2, 4},
+    {4335, 0, 19, 5},
+    {33, 3, 2, 5},
+    {2192, 2, 27, 5},
+    {4214, 0, 21, 9148},
+    {4814, 0, 27, 5},
+    {35, 3, 0, 9154},
+    {28, 5, 0, 9152},
+    {2259, 2, 27, 5},
+    {34, 3, 21, 9153},
+    {5336, 0, 23, 6},
+    {28, 5, 2, 5},
+    {39, 3, 0, 9160},
+    {6215, 0, 0, 9159},
+    {550357, 1, 21, 9158},
+    {732748, 1, 27, 4},
+    {6834, 0, 19, 6},
+    {27, 5, 21, 9161},
+    {5891, 0, 2, 5},
+    {558217, 1, 27, 5},
+    {5059, 0, 2, 5},
+    {193, 2, 0, 9195},
+    {152449, 1, 0, 9167},
+    {55, 3, 19, 6},
+    {47, 3, 0, 9171},
+    {27, 5, 21, 9169},
+    {4153, 0, 21, 9170},
+    {4986, 0, 27, 5},
+    {63, 3, 0, 9193},
+    {597416, 1, 0, 9186},
+    {28, 5, 0, 9180},
+    {4190, 0, 0, 9176},
+    {27, 5, 27, 5},
+    {27, 5, 21, 9177},
+    {173, 2, 2, 4},
+    {4857, 0, 2, 4},
+    {283960, 1, 19, 5},
+    {29, 5, 0, 9185},
+    {140, 2, 2, 5},
+    {4346, 0, 17, 9183},
+    {307057, 1, 21, 9184},
+    {54, 3, 27, 5},
+    {4205, 0, 27, 5},
+    {147, 2, 0, 9190},
+    {27, 5, 25, 9188},
+    {29, 5, 17, 9189},
+    {4650, 0, 27, 4},
+    {53, 3, 0, 9192},
+    {4640, 0, 19, 6},
+    {56, 3, 19, 5},
+    {28, 5, 2, 6},
+    {120, 2, 23, 6},
+    {508, 2, 0, 9203},
+    {4477, 0, 0, 9201},
+    {4247, 0, 0, 9200},
+    {360, 2, 21, 9199},
+    {909065, 1, 27, 5},
+    {289894, 1, 23, 6},
+    {208760, 1, 2, 5},
+    {177586, 1, 23, 6},
+    {46, 3, 0, 9206},
+    {28, 5, 2, 5},
+    {501808, 1, 19, 5},
+    {4075, 0, 17, 9207},
+    {821138, 1, 0, 9226},
+    {29, 5, 0, 9223},
+    {27, 5, 0, 9216},
+    {1371, 2, 0, 9213},
+    {851, 2, 21, 9212},
+    {1033, 2, 27, 5},
+    {4372, 0, 17, 9214},
+    {56, 3, 21, 9215},
+    {578195, 1, 19, 5},
+    {28, 5, 2, 5},
+    {4797, 0, 0, 9222},
+    {631038, 1, 0, 9220},
+    {4300, 0, 19, 5},
+    {681727, 1, 25, 9221},
+    {57, 3, 23, 6},
+    {4935, 0, 27, 4},
+    {3745, 2, 2, 6},
+    {650, 2, 21, 9225},
+    {671, 2, 19, 5},
+    {51, 3, 2, 5},
+    {888, 2, 23, 6},
+    {99, 2, 0, 9650},
+    {213652, 1, 0, 9446},
+    {88966, 1, 0, 9345},
+    {5784, 0, 0, 9292},
+    {52, 3, 0, 9265},
+    {4163, 0, 0, 9252},
+    {36, 3, 2, 5},
+    {44635, 1, 0, 9244},
+    {4, 2, 0, 9239},
+    {34, 3, 21, 9238},
+    {3748, 0, 27, 4},
+    {22517, 1, 0, 9242},
+    {34, 5, 21, 9241},
+    {40, 5, 27, 5},
+    {34, 3, 2, 5},
+    {3914, 0, 15, 5},
+    {36, 5, 2, 5},
+    {6, 2, 0, 9247},
+    {31, 5, 27, 5},
+    {45826, 1, 17, 9248},
+    {49441, 1, 0, 9251},
+    {3926, 0, 2, 5},
+    {3903, 0, 23, 6},
+    {79516, 1, 27, 5},
+    {5341, 0, 21, 9253},
+    {80829, 1, 0, 9260},
+    {39, 3, 21, 9255},
+    {68087, 1, 0, 9258},
+    {45, 3, 2, 5},
+    {5482, 0, 23, 4},
+    {32, 5, 25, 9259},
+    {71741, 1, 19, 5},
+    {45, 3, 0, 9262},
+    {5752, 0, 19, 5},
+    {5698, 0, 0, 9264},
+    {86982, 1, 23, 2},
+    {37, 5, 3, 1},
+    {15261, 1, 21, 9266},
+    {63, 3, 0, 9290},
+    {44, 5, 0, 9289},
+    {42420, 1, 0, 9270},
+    {4577, 0, 23, 6},
+    {50991, 1, 0, 9272},
+    {4526, 0, 19, 5},
+    {59, 3, 2, 6},
+    {5258, 0, 0, 9279},
+    {4, 2, 0, 9276},
+    {56, 3, 19, 3},
+    {41, 5, 2, 6},
+    {34, 5, 25, 9278},
+    {4289, 0, 23, 4},
+    {5, 2, 0, 9286},
+    {58, 3, 2, 5},
+    {77507, 1, 2, 6},
+    {1, 2, 2, 5},
+    {54, 3, 21, 9284},
+    {60013, 1, 17, 9285},
+    {55, 3, 23, 4},
+    {5560, 0, 21, 9287},
+    {54, 3, 17, 9288},
+    {33, 5, 27, 4},
+    {4921, 0, 19, 5},
+    {42, 5, 2, 4},
+    {4005, 0, 19, 6},
+    {6888, 0, 0, 9337},
+    {46, 3, 2, 5},
+    {83740, 1, 0, 9335},
+    {11, 2, 0, 9331},
+    {6320, 0, 0, 9308},
+    {6269, 0, 2, 6},
+    {9, 2, 2, 6},
+    {41, 3, 2, 4},
+    {6207, 0, 2, 4},
+    {1, 2, 25, 9302},
+    {5868, 0, 21, 9303},
+    {2, 2, 0, 9307},
+    {45, 5, 2, 5},
+    {6146, 0, 25, 9306},
+    {40, 5, 19, 6},
+    {35, 3, 27, 4},
+    {2, 2, 0, 9327},
+    {6881, 0, 2, 4},
+    {31, 5, 21, 9311},
+    {38, 5, 0, 9321},
+    {35, 5, 2, 5},
+    {32, 5, 17, 9314},
+    {34, 5, 0, 9316},
+    {16363, 1, 27, 5},
+    {1, 2, 2, 4},
+    {39, 3, 17, 9318},
+    {41, 3, 0, 9320},
+    {40, 3, 27, 5},
+    {19767, 1, 19, 5},
+    {1, 2, 0, 9326},
+    {40, 3, 0, 9325},
+    {46, 5, 2, 6},
+    {6799, 0, 23, 4},
+    {6657, 0, 19, 6},
+    {45, 5, 19, 5},
+    {39, 5, 17, 9328},
+    {3, 2, 2, 4},
+    {38, 3, 2, 5},
+    {46, 5, 19, 6},
+    {37, 5, 2, 5},
+    {80995, 1, 2, 4},
+    {36, 5, 2, 4},
+    {48711, 1, 19, 5},
+    {6456, 0, 25, 9336},
+    {35, 5, 23, 6},
+    {39756, 1, 0, 9344},
+    {1, 2, 0, 9341},
+    {18851, 1, 21, 9340},
+    {37, 5, 23, 6},
+    {6990, 0, 17, 9342},
+    {33, 5, 17, 9343},
+    {40, 5, 27, 4},
+    {6974, 0, 27, 5},
+    {59, 3, 0, 9431},
+    {32, 5, 0, 9353},
+    {5576, 0, 2, 5},
+    {22, 2, 0, 9351},
+    {5026, 0, 2, 6},
+    {3970, 0, 27, 5},
+    {3854, 0, 2, 5},
+    {179095, 1, 27, 5},
+    {3647, 0, 0, 9355},
+    {3527, 0, 23, 6},
+    {2, 2, 0, 9362},
+    {1, 2, 2, 6},
+    {44, 3, 0, 9361},
+    {39, 3, 2, 5},
+    {36, 3, 2, 6},
+    {35, 5, 23, 6},
+    {58, 3, 27, 5},
+    {6652, 0, 0, 9407},
+    {45, 5, 0, 9404},
+    {48, 3, 0, 9385},
+    {43, 2, 0, 9380},
+    {41, 2, 2, 6},
+    {6470, 0, 2, 5},
+    {16, 2, 0, 9378},
+    {38, 5, 2, 6},
+    {37, 5, 0, 9377},
+    {3, 2, 25, 9372},
+    {166362, 1, 0, 9374},
+    {99194, 1, 27, 5},
+    {6, 2, 2, 6},
+    {33, 5, 25, 9376},
+    {35, 5, 23, 6},
+    {5, 2, 27, 4},
+    {45, 3, 2, 6},
+    {3772, 0, 27, 5},
+    {38, 3, 2, 5},
+    {4420, 0, 25, 9382},
+    {62, 2, 21, 9383},
+    {5236, 0, 17, 9384},
+    {38, 5, 19, 5},
+    {37, 5, 0, 9395},
+    {35, 5, 0, 9390},
+    {49, 3, 2, 5},
+    {6, 2, 25, 9389},
+    {6503, 0, 23, 4},
+    {6417, 0, 0, 9394},
+    {8, 2, 2, 5},
+    {36, 5, 2, 6},
+    {6308, 0, 23, 6},
+    {6553, 0, 27, 5},
+    {6236, 0, 2, 5},
+    {77, 2, 2, 5},
+    {41, 5, 0, 9402},
+    {103994, 1, 25, 9399},
+    {5189, 0, 2, 5},
+    {9, 2, 25, 9401},
+    {57, 2, 23, 6},
+    {42, 5, 25, 9403},
+    {52, 3, 23, 6},
+    {46, 5, 2, 4},
+    {159032, 1, 17, 9406},
+    {6388, 0, 23, 6},
+    {126904, 1, 0, 9409},
+    {49, 3, 27, 5},
+    {163767, 1, 0, 9418},
+    {163384, 1, 2, 4},
+    {46, 5, 2, 6},
+    {6728, 0, 0, 9415},
+    {44, 3, 25, 9414},
+    {6702, 0, 19, 5},
+    {10, 2, 21, 9416},
+    {23, 2, 2, 5},
+    {35, 5, 23, 4},
+    {36, 5, 0, 9425},
+    {78, 2, 0, 9423},
+    {172273, 1, 25, 9421},
+    {191845, 1, 2, 6},
+    {10, 2, 23, 6},
+    {88, 2, 21, 9424},
+    {34, 5, 23, 6},
+    {42, 5, 2, 6},
+    {39, 5, 2, 5},
+    {38, 5, 0, 9430},
+    {6807, 0, 2, 6},
+    {166699, 1, 19, 5},
+    {188348, 1, 23, 4},
+    {44, 5, 0, 9445},
+    {33, 5, 0, 9439},
+    {31, 5, 0, 9436},
+    {3929, 0, 2, 6},
+    {3873, 0, 27, 4},
+    {32, 5, 2, 6},
+    {3973, 0, 25, 9438},
+    {129345, 1, 23, 4},
+    {61, 3, 0, 9442},
+    {36, 5, 2, 6},
+    {137957, 1, 23, 6},
+    {4, 2, 25, 9443},
+    {61, 2, 21, 9444},
+    {3973, 0, 23, 6},
+    {48, 5, 23, 4},
+    {5911, 0, 0, 9624},
+    {372790, 1, 0, 9529},
+    {4552, 0, 0, 9473},
+    {48, 3, 0, 9465},
+    {79, 2, 0, 9464},
+    {363531, 1, 2, 4},
+    {40, 3, 0, 9459},
+    {38, 3, 2, 5},
+    {42, 5, 2, 4},
+    {36, 3, 2, 5},
+    {35, 3, 0, 9458},
+    {4468, 0, 23, 6},
+    {34, 5, 19, 6},
+    {3563, 0, 25, 9460},
+    {35, 5, 17, 9461},
+    {277257, 1, 0, 9463},
+    {237443, 1, 23, 6},
+    {355812, 1, 19, 5},
+    {41, 3, 27, 5},
+    {56, 2, 0, 9472},
+    {355070, 1, 2, 5},
+    {3868, 0, 2, 6},
+    {3867, 0, 2, 4},
+    {1, 2, 2, 6},
+    {3656, 0, 2, 5},
+    {36, 5, 23, 6},
+    {252985, 1, 27, 5},
+    {56, 2, 0, 9511},
+    {2, 2, 0, 9480},
+    {52, 3, 2, 4},
+    {5036, 0, 21, 9477},
+    {1, 2, 2, 6},
+    {33, 5, 25, 9479},
+    {35, 5, 23, 6},
+    {36, 5, 2, 6},
+    {5315, 0, 0, 9493},
+    {60, 3, 2, 5},
+    {34, 5, 25, 9484},
+    {35, 5, 0, 9488},
+    {51, 3, 2, 6},
+    {45, 3, 25, 9487},
+    {4639, 0, 27, 5},
+    {39, 3, 25, 9489},
+    {41, 3, 21, 9490},
+    {320459, 1, 2, 6},
+    {4913, 0, 21, 9492},
+    {5138, 0, 27, 5},
+    {5683, 0, 0, 9509},
+    {54, 3, 2, 5},
+    {41, 3, 0, 9499},
+    {19, 2, 21, 9497},
+    {40, 3, 2, 5},
+    {5328, 0, 23, 6},
+    {13, 2, 0, 9505},
+    {33, 5, 25, 9501},
+    {11, 2, 2, 6},
+    {35, 5, 2, 5},
+    {34, 5, 21, 9504},
+    {294698, 1, 27, 5},
+    {262670, 1, 13, 9506},
+    {16, 2, 17, 9507},
+    {50, 3, 2, 5},
+    {31, 5, 23, 6},
+    {39, 3, 2, 6},
+    {34, 5, 19, 6},
+    {298590, 1, 0, 9518},
+    {62, 2, 13, 9513},
+    {39, 5, 21, 9514},
+    {90, 2, 0, 9517},
+    {40, 5, 17, 9516},
+    {44, 5, 27, 4},
+    {40, 5, 23, 6},
+    {5430, 0, 0, 9525},
+    {46, 5, 2, 4},
+    {70, 2, 0, 9524},
+    {329348, 1, 21, 9522},
+    {5083, 0, 25, 9523},
+    {35, 5, 23, 6},
+    {40, 3, 23, 6},
+    {353909, 1, 2, 6},
+    {73, 2, 2, 5},
+    {42, 3, 21, 9528},
+    {33, 5, 23, 4},
+    {5091, 0, 0, 9611},
+    {627284, 1, 0, 9583},
+    {39, 5, 0, 9576},
+    {41, 3, 0, 9549},
+    {3583, 0, 0, 9535},
+    {3565, 0, 23, 7},
+    {382476, 1, 0, 9538},
+    {40, 3, 21, 9537},
+    {36, 5, 19, 5},
+    {3983, 0, 0, 9541},
+    {537248, 1, 21, 9540},
+    {36, 3, 27, 5},
+    {29, 2, 0, 9544},
+    {418134, 1, 2, 5},
+    {1, 2, 23, 6},
+    {65, 2, 0, 9546},
+    {39, 3, 27, 5},
+    {33, 3, 21, 9547},
+    {70, 2, 21, 9548},
+    {33, 5, 23, 6},
+    {2, 2, 0, 9553},
+    {3974, 0, 2, 5},
+    {36, 5, 25, 9552},
+    {3668, 0, 23, 4},
+    {71, 2, 0, 9572},
+    {38, 5, 0, 9570},
+    {3604, 0, 0, 9560},
+    {33, 5, 25, 9557},
+    {51, 3, 2, 5},
+    {3571, 0, 2, 5},
+    {34, 5, 19, 6},
+    {32, 5, 0, 9569},
+    {31, 5, 0, 9566},
+    {4352, 0, 0, 9564},
+    {3854, 0, 27, 5},
+    {50, 3, 2, 6},
+    {4615, 0, 27, 4},
+    {50, 3, 2, 5},
+    {48, 3, 2, 6},
+    {45, 3, 27, 5},
+    {64, 3, 27, 5},
+    {4474, 0, 25, 9571},
+    {4640, 0, 23, 6},
+    {52, 3, 0, 9575},
+    {4668, 0, 21, 9574},
+    {4805, 0, 19, 6},
+    {92, 2, 27, 4},
+    {495663, 1, 0, 9578},
+    {2, 2, 23, 6},
+    {51, 3, 25, 9579},
+    {40, 5, 17, 9580},
+    {556233, 1, 0, 9582},
+    {4096, 0, 23, 4},
+    {596497, 1, 27, 5},
+    {95, 2, 2, 6},
+    {3638, 0, 0, 9588},
+    {3534, 0, 5, 9586},
+    {3548, 0, 21, 9587},
+    {57, 3, 27, 5},
+    {51, 3, 0, 9598},
+    {2, 2, 25, 9590},
+    {33, 3, 0, 9593},
+    {37, 5, 25, 9592},
+    {5, 2, 23, 4},
+    {4201, 0, 2, 5},
+    {4063, 0, 21, 9595},
+    {4088, 0, 25, 9596},
+    {31, 5, 25, 9597},
+    {813526, 1, 23, 4},
+    {56, 3, 0, 9606},
+    {32, 5, 17, 9600},
+    {37, 5, 0, 9604},
+    {44, 2, 17, 9602},
+    {53, 3, 17, 9603},
+    {86, 2, 27, 5},
+    {41, 2, 25, 9605},
+    {38, 5, 27, 4},
+    {1002026, 1, 2, 5},
+    {34, 2, 25, 9608},
+    {51, 2, 21, 9609},
+    {89, 2, 2, 6},
+    {70, 2, 27, 5},
+    {39, 5, 0, 9620},
+    {31, 5, 0, 9617},
+    {52, 3, 2, 5},
+    {482938, 1, 21, 9615},
+    {5201, 0, 17, 9616},
+    {5378, 0, 23, 4},
+    {62, 3, 2, 4},
+    {32, 5, 2, 5},
+    {5359, 0, 23, 6},
+    {57, 2, 0, 9623},
+    {26, 2, 21, 9622},
+    {42, 2, 19, 5},
+    {525588, 1, 27, 4},
+    {2, 2, 0, 9627},
+    {36, 5, 2, 5},
+    {6323, 0, 23, 6},
+    {5938, 0, 17, 9628},
+    {33, 5, 0, 9644},
+    {32, 5, 0, 9640},
+    {79, 2, 0, 9638},
+    {31, 5, 0, 9633},
+    {514534, 1, 23, 4},
+    {48, 2, 0, 9635},
+    {6122, 0, 19, 5},
+    {46, 3, 0, 9637},
+    {60, 2, 19, 5},
+    {379174, 1, 27, 4},
+    {42, 3, 2, 5},
+    {6278, 0, 23, 6},
+    {61, 2, 2, 5},
+    {47, 3, 25, 9642},
+    {6573, 0, 17, 9643},
+    {6746, 0, 23, 4},
+    {5999, 0, 25, 9645},
+    {6574, 0, 21, 9646},
+    {6968, 0, 2, 5},
+    {79, 2, 0, 9649},
+    {6944, 0, 23, 6},
+    {41, 5, 27, 5},
+    {4871, 0, 0, 10199},
+    {37, 5, 0, 9896},
+    {44, 3, 0, 9763},
+    {629220, 1, 0, 9716},
+    {462, 2, 0, 9675},
+    {42, 3, 0, 9672},
+    {4407, 0, 2, 5},
+    {441358, 1, 0, 9670},
+    {4119, 0, 0, 9666},
+    {34, 3, 0, 9661},
+    {4000, 0, 27, 4},
+    {426, 2, 2, 6},
+    {38, 3, 0, 9664},
+    {438910, 1, 23, 4},
+    {394563, 1, 2, 5},
+    {266913, 1, 23, 4},
+    {4269, 0, 21, 9667},
+    {81032, 1, 21, 9668},
+    {35, 3, 2, 6},
+    {4301, 0, 27, 5},
+    {600516, 1, 21, 9671},
+    {34, 3, 23, 6},
+    {4606, 0, 0, 9674},
+    {306, 2, 23, 6},
+    {264807, 1, 23, 6},
+    {35, 3, 0, 9690},
+    {5297, 2, 0, 9689},
+    {35, 5, 0, 9685},
+    {1204, 2, 2, 5},
+    {34, 3, 0, 9684},
+    {33, 3, 0, 9682},
+    {866, 2, 27, 5},
+    {4552, 0, 2, 4},
+    {4157, 0, 27, 5},
+    {84125, 1, 27, 4},
+    {34, 3, 2, 6},
+    {724, 2, 25, 9687},
+    {36, 5, 2, 4},
+    {492407, 1, 19, 6},
+    {4494, 0, 15, 4},
+    {36, 3, 0, 9692},
+    {633, 2, 19, 5},
+    {34, 5, 0, 9706},
+    {31, 5, 0, 9695},
+    {1642, 2, 23, 6},
+    {32, 5, 0, 9698},
+    {553, 2, 2, 5},
+    {40, 3, 23, 4},
+    {37, 3, 0, 9700},
+    {4371, 0, 23, 4},
+    {1041, 2, 21, 9701},
+    {39, 3, 25, 9702},
+    {33, 5, 0, 9704},
+    {209378, 1, 19, 5},
+    {3714, 0, 17, 9705},
+    {4231, 0, 23, 6},
+    {35, 5, 0, 9710},
+    {899, 2, 0, 9709},
+    {39, 3, 19, 5},
+    {594451, 1, 27, 5},
+    {43, 3, 2, 5},
+    {42, 3, 2, 4},
+    {585, 2, 25, 9713},
+    {4718, 0, 21, 9714},
+    {4779, 0, 25, 9715},
+    {4844, 0, 19, 5},
+    {1071808, 1, 0, 9760},
+    {3539, 0, 0, 9719},
+    {948, 2, 19, 6},
+    {463, 2, 0, 9742},
+    {3784, 0, 0, 9724},
+    {748704, 1, 2, 6},
+    {38, 3, 21, 9723},
+    {3699, 0, 27, 5},
+    {804627, 1, 0, 9734},
+    {177, 2, 0, 9727},
+    {747268, 1, 27, 5},
+    {665604, 1, 21, 9728},
+    {4143, 0, 0, 9731},
+    {40, 3, 2, 5},
+    {266, 2, 23, 6},
+    {4292, 0, 25, 9732},
+    {41, 3, 21, 9733},
+    {4458, 0, 23, 6},
+    {290, 2, 0, 9739},
+    {174, 2, 21, 9736},
+    {887146, 1, 21, 9737},
+    {34, 5, 25, 9738},
+    {3919, 0, 27, 4},
+    {886179, 1, 25, 9740},
+    {3932, 0, 25, 9741},
+    {32, 5, 27, 5},
+    {36, 5, 0, 9758},
+    {873070, 1, 2, 5},
+    {34, 3, 0, 9746},
+    {814463, 1, 23, 4},
+    {32, 5, 0, 9753},
+    {43, 3, 2, 5},
+    {31, 5, 0, 9752},
+    {663374, 1, 21, 9750},
+    {40, 3, 2, 5},
+    {37, 3, 27, 4},
+    {2073, 2, 27, 4},
+    {35, 3, 17, 9754},
+    {40, 3, 21, 9755},
+    {691530, 1, 25, 9756},
+    {41, 3, 2, 5},
+    {865620, 1, 19, 6},
+    {4476, 0, 25, 9759},
+    {42, 3, 23, 6},
+    {3814, 0, 2, 4},
+    {32, 5, 2, 5},
+    {3730, 0, 19, 5},
+    {3534, 0, 0, 9769},
+    {3523, 0, 0, 9767},
+    {645655, 1, 2, 6},
+    {32, 5, 15, 4},
+    {57, 3, 21, 9768},
+    {1747, 2, 23, 4},
+    {378, 2, 0, 9823},
+    {4849, 0, 0, 9819},
+    {36, 5, 0, 9807},
+    {106, 2, 0, 9776},
+    {56, 3, 2, 4},
+    {33, 5, 2, 5},
+    {390572, 1, 19, 5},
+    {58, 3, 0, 9791},
+    {244505, 1, 0, 9783},
+    {4723, 0, 2, 6},
+    {123219, 1, 0, 9782},
+    {52, 3, 21, 9781},
+    {97496, 1, 19, 6},
+    {34, 5, 23, 4},
+    {55, 3, 21, 9784},
+    {582444, 1, 0, 9790},
+    {57, 3, 0, 9788},
+    {33, 5, 25, 9787},
+    {504855, 1, 23, 6},
+    {312645, 1, 21, 9789},
+    {4667, 0, 27, 4},
+    {4613, 0, 23, 4},
+    {64, 3, 2, 5},
+    {31, 5, 0, 9794},
+    {174511, 1, 23, 6},
+    {4477, 0, 0, 9801},
+    {34, 5, 25, 9796},
+    {3944, 0, 0, 9799},
+    {3797, 0, 2, 5},
+    {60, 3, 27, 4},
+    {35, 5, 2, 6},
+    {161, 2, 23, 6},
+    {4634, 0, 0, 9804},
+    {186848, 1, 21, 9803},
+    {34, 5, 19, 5},
+    {209093, 1, 25, 9805},
+    {34, 5, 21, 9806},
+    {4768, 0, 27, 5},
+    {149, 2, 0, 9811},
+    {682882, 1, 2, 2},
+    {230980, 1, 2, 5},
+    {49, 3, 23, 4},
+    {843401, 1, 2, 4},
+    {52, 3, 0, 9815},
+    {4760, 0, 2, 6},
+    {229664, 1, 27, 5},
+    {531026, 1, 0, 9818},
+    {103417, 1, 21, 9817},
+    {57, 3, 19, 6},
+    {240, 2, 23, 4},
+    {33, 5, 21, 9820},
+    {35, 5, 2, 5},
+    {289, 2, 2, 4},
+    {52, 3, 19, 5},
+    {1065053, 1, 0, 9894},
+    {62, 3, 0, 9891},
+    {59, 3, 0, 9876},
+    {35, 5, 0, 9872},
+    {340564, 1, 0, 9844},
+    {57, 3, 0, 9841},
+    {4584, 2, 2, 5},
+    {33, 5, 0, 9838},
+    {78837, 1, 21, 9832},
+    {54, 3, 0, 9837},
+    {189367, 1, 0, 9836},
+    {122330, 1, 17, 9835},
+    {53, 3, 19, 5},
+    {45, 3, 19, 5},
+    {251305, 1, 27, 4},
+    {1987, 2, 2, 6},
+    {43498, 1, 2, 4},
+    {4441, 0, 23, 6},
+    {793, 2, 0, 9843},
+    {34, 5, 19, 5},
+    {1154, 2, 27, 5},
+    {51, 3, 2, 5},
+    {34, 5, 0, 9865},
+    {4703, 0, 2, 5},
+    {619454, 1, 0, 9852},
+    {870, 2, 21, 9849},
+    {1135, 2, 25, 9850},
+    {3895, 0, 2, 5},
+    {3767, 0, 23, 6},
+    {48, 3, 0, 9860},
+    {32, 5, 0, 9856},
+    {896714, 1, 2, 5},
+    {4288, 0, 27, 5},
+    {873893, 1, 0, 9859},
+    {47, 3, 2, 6},
+    {656888, 1, 19, 5},
+    {4415, 0, 27, 4},
+    {609, 2, 21, 9861},
+    {733, 2, 17, 9862},
+    {1047, 2, 21, 9863},
+    {4125, 0, 17, 9864},
+    {4588, 0, 23, 6},
+    {46, 3, 0, 9869},
+    {45, 3, 0, 9868},
+    {755879, 1, 23, 4},
+    {573696, 1, 19, 5},
+    {882, 2, 21, 9870},
+    {4485, 0, 2, 6},
+    {50, 3, 23, 6},
+    {36, 5, 2, 5},
+    {922748, 1, 21, 9874},
+    {51, 3, 25, 9875},
+    {54, 3, 23, 6},
+    {60, 3, 0, 9884},
+    {4323, 0, 0, 9879},
+    {32, 5, 11, 4},
+    {642, 2, 0, 9881},
+    {33, 5, 23, 4},
+    {767592, 1, 2, 5},
+    {35, 5, 2, 6},
+    {616614, 1, 23, 4},
+    {3693, 0, 0, 9886},
+    {1980, 2, 27, 4},
+    {1097, 2, 2, 5},
+    {4261, 0, 25, 9888},
+    {4777, 0, 2, 6},
+    {4529, 0, 2, 5},
+    {36, 5, 19, 5},
+    {3940, 0, 2, 5},
+    {662735, 1, 2, 4},
+    {2851, 2, 23, 6},
+    {1623, 2, 25, 9895},
+    {3651, 0, 27, 4},
+    {43, 3, 0, 10018},
+    {2001, 2, 0, 9999},
+    {4292, 0, 0, 9943},
+    {41, 3, 0, 9940},
+    {176238, 1, 0, 9912},
+    {14427, 1, 17, 9902},
+    {38, 3, 0, 9909},
+    {134740, 1, 2, 5},
+    {963, 2, 0, 9907},
+    {630, 2, 2, 6},
+    {41, 5, 27, 5},
+    {4011, 0, 2, 5},
+    {40, 5, 23, 4},
+    {21661, 1, 25, 9910},
+    {3813, 0, 2, 5},
+    {3728, 0, 23, 6},
+    {1257, 2, 0, 9938},
+    {38, 3, 0, 9927},
+    {34, 3, 0, 9919},
+    {441358, 1, 25, 9916},
+    {634729, 1, 0, 9918},
+    {4121, 0, 23, 4},
+    {569, 2, 27, 5},
+    {501392, 1, 21, 9920},
+    {35, 3, 0, 9925},
+    {4056, 0, 2, 5},
+    {1074001, 1, 2, 5},
+    {40, 5, 2, 6},
+    {3927, 0, 27, 5},
+    {249, 2, 2, 6},
+    {4206, 0, 23, 6},
+    {629, 2, 0, 9932},
+    {367, 2, 2, 6},
+    {175, 2, 25, 9930},
+    {3816, 0, 21, 9931},
+    {3949, 0, 27, 5},
+    {203861, 1, 25, 9933},
+    {4119, 0, 0, 9935},
+    {964430, 1, 23, 4},
+    {39, 3, 17, 9936},
+    {4174, 0, 2, 5},
+    {44, 5, 27, 5},
+    {3647, 0, 2, 6},
+    {3533, 0, 23, 4},
+    {42, 3, 21, 9941},
+    {4123, 0, 2, 6},
+    {3699, 0, 27, 5},
+    {1704, 2, 0, 9995},
+    {41, 5, 0, 9964},
+    {69510, 1, 21, 9946},
+    {41, 3, 0, 9956},
+    {38, 5, 0, 9950},
+    {217367, 1, 2, 5},
+    {162809, 1, 23, 4},
+    {36, 3, 0, 9955},
+    {40, 5, 0, 9954},
+    {34, 3, 2, 6},
+    {667119, 1, 23, 4},
+    {4620, 0, 27, 5},
+    {4849, 0, 23, 4},
+    {4704, 0, 2, 6},
+    {793, 2, 0, 9962},
+    {42, 3, 0, 9961},
+    {4656, 0, 2, 4},
+    {4318, 0, 23, 6},
+    {4631, 0, 23, 6},
+    {42, 3, 2, 4},
+    {1557, 2, 23, 4},
+    {170, 2, 25, 9965},
+    {48, 5, 0, 9991},
+    {38, 3, 0, 9979},
+    {37, 3, 0, 9978},
+    {33, 3, 21, 9969},
+    {47, 5, 0, 9977},
+    {34, 3, 0, 9972},
+    {755, 2, 23, 4},
+    {35, 3, 25, 9973},
+    {222120, 1, 0, 9975},
+    {71994, 1, 27, 4},
+    {36, 3, 25, 9976},
+    {44, 5, 23, 6},
+    {4604, 0, 27, 4},
+    {635233, 1, 19, 5},
+    {824485, 1, 0, 9990},
+    {611, 2, 0, 9986},
+    {337, 2, 0, 9984},
+    {40, 3, 17, 9983},
+    {307, 2, 23, 6},
+    {39, 3, 2, 6},
+    {4812, 0, 27, 5},
+    {41, 3, 21, 9987},
+    {4358, 0, 21, 9988},
+    {42, 3, 2, 6},
+    {44, 5, 27, 5},
+    {41, 3, 27, 4},
+    {844, 2, 0, 9994},
+    {688, 2, 2, 4},
+    {41, 3, 27, 4},
+    {4678, 0, 27, 4},
+    {4363, 0, 13, 9996},
+    {43, 5, 21, 9997},
+    {48, 5, 2, 5},
+    {409744, 1, 27, 5},
+    {50, 5, 2, 5},
+    {3617, 0, 17, 10001},
+    {36, 3, 0, 10003},
+    {4064, 0, 27, 5},
+    {749314, 1, 2, 6},
+    {42, 3, 2, 6},
+    {41, 5, 0, 10008},
+    {4092, 0, 2, 6},
+    {252171, 1, 27, 4},
+    {3784, 0, 0, 10010},
+    {3747, 0, 23, 4},
+    {37, 3, 25, 10011},
+    {171647, 1, 17, 10012},
+    {2182, 2, 25, 10013},
+    {38, 3, 25, 10014},
+    {656821, 1, 2, 5},
+    {41, 3, 0, 10017},
+    {43, 5, 27, 5},
+    {45, 5, 23, 6},
+    {282, 2, 0, 10042},
+    {928401, 1, 0, 10039},
+    {4472, 0, 0, 10029},
+    {4052, 0, 0, 10024},
+    {404513, 1, 2, 6},
+    {122367, 1, 19, 5},
+    {51, 3, 21, 10025},
+    {776774, 1, 0, 10028},
+    {182077, 1, 21, 10027},
+    {61, 3, 27, 5},
+    {39, 5, 23, 4},
+    {48, 5, 2, 4},
+    {50, 3, 0, 10037},
+    {4846, 0, 2, 4},
+    {49, 3, 2, 5},
+    {142, 2, 25, 10034},
+    {179, 2, 2, 6},
+    {42, 5, 2, 5},
+    {40, 5, 23, 6},
+    {808920, 1, 25, 10038},
+    {4723, 0, 27, 5},
+    {3905, 0, 2, 5},
+    {1018151, 1, 17, 10041},
+    {3809, 0, 23, 4},
+    {58, 3, 0, 10145},
+    {3874, 0, 0, 10068},
+    {48, 5, 0, 10065},
+    {1093392, 1, 2, 5},
+    {57, 3, 0, 10064},
+    {1658, 2, 2, 5},
+    {1592, 2, 2, 3},
+    {254231, 1, 0, 10059},
+    {56, 3, 2, 6},
+    {148304, 1, 0, 10054},
+    {46, 3, 17, 10053},
+    {49, 3, 27, 5},
+    {45, 5, 2, 5},
+    {40, 5, 0, 10058},
+    {674, 2, 21, 10057},
+    {3581, 0, 15, 4},
+    {3797, 0, 19, 5},
+    {851733, 1, 0, 10062},
+    {1261, 2, 2, 6},
+    {344, 2, 27, 5},
+    {3794, 0, 25, 10063},
+    {986911, 1, 19, 5},
+    {38, 5, 19, 5},
+    {1761, 2, 2, 6},
+    {3749, 0, 2, 5},
+    {3663, 0, 23, 6},
+    {808172, 1, 0, 10125},
+    {792766, 1, 0, 10123},
+    {4244, 0, 0, 10090},
+    {4238, 2, 2, 6},
+    {86533, 1, 0, 10074},
+    {56, 3, 23, 6},
+    {57, 3, 2, 5},
+    {109414, 1, 17, 10076},
+    {289894, 1, 0, 10081},
+    {4154, 0, 2, 5},
+    {3893, 0, 17, 10079},
+    {39, 5, 2, 6},
+    {1239, 2, 27, 5},
+    {356329, 1, 17, 10082},
+    {47, 5, 2, 4},
+    {55, 3, 0, 10089},
+    {52, 3, 2, 4},
+    {45, 3, 17, 10086},
+    {4180, 0, 2, 5},
+    {1593, 2, 25, 10088},
+    {2379, 2, 19, 5},
+    {4100, 0, 27, 5},
+    {4868, 0, 2, 6},
+    {46, 3, 0, 10093},
+    {754551, 1, 23, 4},
+    {680396, 1, 0, 10117},
+    {4275, 0, 25, 10095},
+    {47, 5, 0, 10111},
+    {52, 3, 0, 10105},
+    {447457, 1, 2, 6},
+    {4562, 0, 0, 10101},
+    {4336, 0, 2, 6},
+    {4311, 0, 27, 4},
+    {91068, 1, 0, 10103},
+    {33472, 1, 23, 6},
+    {4664, 0, 2, 5},
+    {41, 5, 23, 4},
+    {653540, 1, 2, 4},
+    {53, 3, 0, 10108},
+    {43, 5, 23, 4},
+    {1429, 2, 2, 5},
+    {44, 5, 2, 6},
+    {41, 5, 27, 5},
+    {4341, 0, 17, 10112},
+    {503126, 1, 2, 5},
+    {4629, 0, 25, 10114},
+    {4673, 0, 21, 10115},
+    {50, 3, 17, 10116},
+    {56, 3, 27, 4},
+    {39, 5, 0, 10119},
+    {2026, 2, 23, 6},
+    {4634, 0, 21, 10120},
+    {4820, 0, 2, 5},
+    {43, 5, 25, 10122},
+    {46, 5, 23, 6},
+    {453, 2, 2, 6},
+    {800844, 1, 27, 5},
+    {2174, 2, 0, 10142},
+    {364, 2, 0, 10128},
+    {4738, 0, 19, 6},
+    {4752, 0, 0, 10141},
+    {45, 3, 0, 10131},
+    {4662, 0, 23, 4},
+    {4488, 0, 0, 10138},
+    {3976, 0, 17, 10133},
+    {56, 3, 0, 10137},
+    {746, 2, 21, 10135},
+    {1014, 2, 25, 10136},
+    {42, 5, 23, 6},
+    {997184, 1, 19, 5},
+    {4641, 0, 17, 10139},
+    {42, 5, 17, 10140},
+    {46, 5, 23, 4},
+    {4804, 0, 27, 5},
+    {4506, 0, 2, 4},
+    {4144, 2, 25, 10144},
+    {4079, 0, 19, 5},
+    {3626, 0, 0, 10153},
+    {49, 5, 0, 10152},
+    {3516, 0, 21, 10148},
+    {3542, 0, 17, 10149},
+    {61, 3, 21, 10150},
+    {62, 3, 2, 5},
+    {3569, 0, 23, 4},
+    {1907, 2, 23, 6},
+    {46, 5, 0, 10193},
+    {64, 3, 0, 10187},
+    {414, 2, 0, 10160},
+    {337, 2, 0, 10159},
+    {59, 3, 25, 10158},
+    {3671, 0, 27, 5},
+    {61, 3, 19, 6},
+    {45, 5, 0, 10185},
+    {63, 3, 0, 10180},
+    {1272, 2, 0, 10169},
+    {61, 3, 0, 10168},
+    {600, 2, 21, 10165},
+    {4522, 0, 2, 6},
+    {41, 5, 2, 6},
+    {4246, 0, 27, 5},
+    {618, 2, 27, 5},
+    {1381, 2, 0, 10171},
+    {4029, 0, 19, 5},
+    {62, 3, 0, 10174},
+    {1665, 2, 2, 5},
+    {433948, 1, 27, 5},
+    {43, 5, 2, 5},
+    {184377, 1, 25, 10176},
+    {432205, 1, 0, 10179},
+    {2930, 2, 2, 5},
+    {40, 5, 19, 5},
+    {4275, 0, 23, 6},
+    {42, 5, 2, 5},
+    {246911, 1, 21, 10182},
+    {812, 2, 17, 10183},
+    {1267, 2, 25, 10184},
+    {1912, 2, 23, 6},
+    {62, 3, 2, 5},
+    {863930, 1, 27, 5},
+    {275046, 1, 21, 10188},
+    {4587, 0, 2, 4},
+    {1014, 2, 21, 10190},
+    {4098, 0, 2, 4},
+    {3910, 0, 2, 5},
+    {3810, 0, 23, 4},
+    {64, 3, 0, 10197},
+    {51, 5, 0, 10196},
+    {3833, 0, 23, 6},
+    {4199, 0, 23, 4},
+    {1410, 2, 2, 6},
+    {4215, 0, 11, 4},
+    {35, 3, 0, 10256},
+    {913, 2, 0, 10229},
+    {6324, 0, 0, 10221},
+    {48, 5, 2, 4},
+    {415, 2, 0, 10211},
+    {321, 2, 21, 10205},
+    {39, 5, 0, 10209},
+    {34, 3, 2, 6},
+    {35, 5, 21, 10208},
+    {37, 5, 19, 5},
+    {5104, 0, 25, 10210},
+    {42, 5, 27, 4},
+    {310733, 1, 21, 10212},
+    {34, 3, 0, 10219},
+    {34, 5, 0, 10215},
+    {344435, 1, 27, 5},
+    {33, 3, 2, 5},
+    {41, 5, 2, 5},
+    {38, 5, 2, 6},
+    {594093, 1, 27, 5},
+    {649, 2, 2, 5},
+    {649417, 1, 27, 5},
+    {6849, 0, 0, 10226},
+    {33, 3, 17, 10223},
+    {512, 2, 2, 4},
+    {6350, 0, 2, 5},
+    {40, 5, 19, 5},
+    {301948, 1, 25, 10227},
+    {6925, 0, 25, 10228},
+    {34, 5, 27, 5},
+    {5791, 0, 0, 10244},
+    {34, 3, 0, 10237},
+    {5715, 0, 0, 10236},
+    {33, 3, 0, 10235},
+    {2400, 2, 2, 5},
+    {89301, 1, 23, 6},
+    {1317, 2, 23, 6},
+    {5758, 0, 19, 6},
+    {295668, 1, 0, 10241},
+    {208833, 1, 25, 10239},
+    {5095, 0, 13, 10240},
+    {36, 5, 19, 3},
+    {5602, 0, 2, 6},
+    {38, 5, 2, 5},
+    {34, 5, 23, 6},
+    {1194, 2, 0, 10247},
+    {5829, 0, 13, 10246},
+    {34, 5, 27, 5},
+    {33, 3, 0, 10251},
+    {6197, 0, 0, 10250},
+    {36, 5, 19, 3},
+    {41, 5, 23, 4},
+    {5958, 0, 13, 10252},
+    {34, 3, 0, 10254},
+    {37, 5, 19, 3},
+    {6448, 0, 17, 10255},
+    {43, 5, 15, 4},
+    {904, 2, 0, 10284},
+    {6759, 0, 21, 10258},
+    {40, 3, 0, 10263},
+    {148, 2, 0, 10261},
+    {39, 5, 27, 5},
+    {37, 3, 2, 5},
+    {6934, 0, 23, 6},
+    {57, 3, 2, 5},
+    {279372, 1, 0, 10281},
+    {34, 5, 0, 10272},
+    {48, 3, 2, 5},
+    {33, 5, 2, 5},
+    {45, 3, 0, 10271},
+    {41, 3, 21, 10270},
+    {186784, 1, 19, 6},
+    {122, 2, 23, 4},
+    {7017, 0, 2, 6},
+    {49, 3, 0, 10277},
+    {45, 5, 2, 5},
+    {43, 3, 2, 6},
+    {38, 5, 27, 5},
+    {119, 2, 21, 10278},
+    {40, 5, 2, 6},
+    {6792, 0, 25, 10280},
+    {226547, 1, 23, 6},
+    {46, 3, 0, 10283},
+    {6811, 0, 27, 5},
+    {6782, 0, 23, 6},
+    {56, 3, 0, 10340},
+    {52, 3, 2, 5},
+    {48, 5, 0, 10328},
+    {463104, 1, 0, 10311},
+    {4949, 0, 0, 10290},
+    {4877, 0, 23, 6},
+    {45, 5, 2, 5},
+    {447675, 1, 2, 5},
+    {5507, 0, 21, 10293},
+    {128858, 1, 0, 10301},
+    {50, 3, 2, 6},
+    {102261, 1, 2, 6},
+    {6630, 0, 2, 6},
+    {44, 3, 2, 5},
+    {38, 5, 2, 5},
+    {5799, 0, 25, 10300},
+    {81226, 1, 23, 6},
+    {1922, 2, 0, 10310},
+    {43, 3, 0, 10309},
+    {6814, 0, 2, 4},
+    {388192, 1, 0, 10308},
+    {318911, 1, 21, 10306},
+    {1713, 2, 2, 4},
+    {32, 5, 19, 5},
+    {6344, 0, 27, 5},
+    {1517, 2, 23, 6},
+    {43, 5, 23, 6},
+    {46, 3, 0, 10321},
+    {3389, 2, 0, 10315},
+    {575060, 1, 2, 5},
+    {5058, 0, 27, 5},
+    {7773, 2, 2, 5},
+    {4755, 2, 25, 10317},
+    {40, 3, 2, 5},
+    {37, 3, 25, 10319},
+    {35, 5, 21, 10320},
+    {43, 5, 27, 5},
+    {6009, 0, 2, 6},
+    {5088, 0, 0, 10324},
+    {38, 5, 27, 5},
+    {1852, 2, 21, 10325},
+    {5489, 0, 21, 10326},
+    {5725, 0, 25, 10327},
+    {38, 5, 23, 6},
+    {50, 5, 0, 10337},
+    {46, 3, 0, 10336},
+    {49, 5, 0, 10333},
+    {155557, 1, 21, 10332},
+    {5028, 0, 23, 6},
+    {43, 3, 2, 5},
+    {5059, 0, 21, 10335},
+    {40, 3, 19, 6},
+    {1368, 2, 27, 4},
+    {51, 5, 0, 10339},
+    {6003, 0, 23, 4},
+    {6051, 0, 19, 5},
+    {64, 3, 2, 6},
+    {5320, 0, 21, 10342},
+    {1668, 2, 0, 10354},
+    {5782, 0, 0, 10347},
+    {41, 5, 2, 5},
+    {38, 5, 2, 4},
+    {32, 5, 19, 5},
+    {1618, 2, 2, 4},
+    {60, 3, 0, 10352},
+    {268095, 1, 0, 10351},
+    {33, 5, 19, 5},
+    {5862, 0, 19, 6},
+    {476559, 1, 2, 5},
+    {344167, 1, 23, 6},
+    {1710, 2, 25, 10355},
+    {384924, 1, 2, 5},
+    {31, 5, 23, 6},
+    {88643, 1, 0, 10406},
+    {34638, 1, 0, 10377},
+    {7445, 0, 0, 10376},
+    {35, 3, 25, 10361},
+    {36, 5, 0, 10370},
+    {13360, 1, 21, 10363},
+    {7170, 0, 2, 5},
+    {24, 5, 0, 10366},
+    {18811, 1, 27, 5},
+    {30, 5, 21, 10367},
+    {35, 5, 0, 10369},
+    {44, 3, 23, 6},
+    {45, 3, 27, 5},
+    {39, 5, 2, 6},
+    {75, 2, 2, 5},
+    {37, 5, 0, 10374},
+    {7077, 0, 27, 4},
+    {38, 5, 21, 10375},
+    {7114, 0, 19, 5},
+    {7479, 0, 31, 5},
+    {32, 5, 0, 10401},
+    {25, 5, 0, 10380},
+    {7199, 0, 23, 4},
+    {393, 2, 2, 5},
+    {38, 3, 0, 10391},
+    {34, 3, 21, 10383},
+    {30, 5, 0, 10387},
+    {35, 3, 25, 10385},
+    {28, 2, 25, 10386},
+    {42, 2, 23, 4},
+    {31, 5, 0, 10389},
+    {7124, 0, 27, 4},
+    {7388, 0, 17, 10390},
+    {28, 2, 19, 6},
+    {17, 2, 0, 10398},
+    {42596, 1, 25, 10393},
+    {63487, 1, 0, 10397},
+    {7376, 0, 2, 4},
+    {31, 5, 2, 5},
+    {2, 2, 23, 4},
+    {7107, 0, 19, 6},
+    {31, 5, 0, 10400},
+    {113, 2, 23, 6},
+    {7220, 0, 23, 6},
+    {49, 3, 0, 10404},
+    {46, 5, 25, 10403},
+    {137, 2, 27, 5},
+    {50033, 1, 2, 5},
+    {37, 5, 23, 6},
+    {42, 3, 0, 10458},
+    {7397, 0, 0, 10441},
+    {41, 5, 0, 10429},
+    {7063, 0, 0, 10412},
+    {213723, 1, 13, 10411},
+    {39, 5, 23, 4},
+    {31, 5, 21, 10413},
+    {179064, 1, 0, 10416},
+    {154637, 1, 21, 10415},
+    {40, 5, 27, 5},
+    {324734, 1, 21, 10417},
+    {7143, 0, 21, 10418},
+    {37, 5, 0, 10424},
+    {36, 3, 0, 10421},
+    {35, 3, 23, 4},
+    {40, 3, 2, 5},
+    {33, 5, 25, 10423},
+    {457666, 1, 23, 6},
+    {383801, 1, 0, 10426},
+    {327740, 1, 19, 6},
+    {7328, 0, 2, 5},
+    {37, 3, 21, 10428},
+    {40, 5, 27, 5},
+    {34, 3, 0, 10432},
+    {242, 2, 2, 3},
+    {7244, 0, 23, 6},
+    {35, 3, 17, 10433},
+    {36, 3, 25, 10434},
+    {50, 5, 2, 6},
+    {47, 5, 2, 5},
+    {43, 5, 0, 10440},
+    {7265, 0, 2, 5},
+    {42, 5, 25, 10439},
+    {7194, 0, 23, 6},
+    {7089, 0, 23, 6},
+    {7399, 0, 29, 10442},
+    {7519, 0, 0, 10456},
+    {24, 2, 0, 10447},
+    {7427, 0, 0, 10446},
+    {7412, 0, 27, 5},
+    {31, 5, 27, 7},
+    {286, 2, 0, 10451},
+    {338337, 1, 0, 10450},
+    {24, 5, 19, 5},
+    {7475, 0, 15, 5},
+    {431747, 1, 2, 6},
+    {7401, 0, 25, 10453},
+    {38, 5, 21, 10454},
+    {36, 3, 25, 10455},
+    {44, 5, 23, 6},
+    {173, 2, 21, 10457},
+    {7543, 0, 7, 5},
+    {395, 2, 0, 10510},
+    {364, 2, 0, 10508},
+    {7297, 0, 0, 10492},
+    {7045, 0, 29, 10462},
+    {51, 3, 2, 5},
+    {43, 3, 21, 10464},
+    {31, 5, 0, 10477},
+    {46, 3, 0, 10472},
+    {171, 2, 0, 10470},
+    {127031, 1, 25, 10468},
+    {68, 2, 21, 10469},
+    {189647, 1, 23, 6},
+    {45, 3, 2, 5},
+    {28, 5, 23, 4},
+    {7177, 0, 2, 6},
+    {47, 3, 21, 10474},
+    {413598, 1, 2, 5},
+    {26, 5, 17, 10476},
+    {28, 5, 23, 4},
+    {44, 3, 0, 10482},
+    {258000, 1, 2, 5},
+    {130379, 1, 2, 6},
+    {7094, 0, 21, 10481},
+    {34, 5, 23, 6},
+    {102, 2, 0, 10486},
+    {262338, 1, 2, 6},
+    {41, 5, 21, 10485},
+    {82, 2, 27, 5},
+    {230200, 1, 0, 10488},
+    {7252, 0, 27, 5},
+    {453423, 1, 2, 5},
+    {7062, 0, 21, 10490},
+    {175, 2, 29, 10491},
+    {257, 2, 23, 7},
+    {200, 2, 2, 5},
+    {64, 3, 0, 10507},
+    {358603, 1, 0, 10504},
+    {46, 3, 0, 10501},
+    {7496, 0, 2, 5},
+    {43, 3, 0, 10499},
+    {35, 5, 23, 6},
+    {7310, 0, 25, 10500},
+    {28, 5, 27, 7},
+    {32, 5, 0, 10503},
+    {48, 3, 19, 5},
+    {7465, 0, 27, 5},
+    {7415, 0, 29, 10505},
+    {7492, 0, 25, 10506},
+    {30, 5, 27, 7},
+    {31, 5, 23, 6},
+    {30, 5, 2, 7},
+    {27, 5, 31, 6},
+    {628, 2, 21, 10511},
+    {29, 5, 0, 10513},
+    {7083, 0, 27, 5},
+    {408843, 1, 0, 10521},
+    {7401, 0, 0, 10519},
+    {7361, 0, 0, 10518},
+    {43, 5, 2, 5},
+    {7214, 0, 27, 5},
+    {46, 5, 27, 4},
+    {2266, 2, 2, 5},
+    {1674, 2, 23, 4},
+    {1437, 2, 0, 10524},
+    {50, 3, 25, 10523},
+    {7391, 0, 23, 6},
+    {51, 5, 19, 5},
+    {221, 2, 0, 10796},
+    {44497, 1, 0, 10548},
+    {78, 3, 0, 10541},
+    {15155, 1, 0, 10535},
+    {75, 3, 0, 10532},
+    {64, 2, 21, 10531},
+    {33, 5, 23, 6},
+    {5125, 0, 0, 10534},
+    {22, 5, 7, 2},
+    {77, 3, 27, 5},
+    {77, 3, 0, 10539},
+    {70, 3, 0, 10538},
+    {7030, 0, 19, 5},
+    {98, 2, 23, 4},
+    {5698, 0, 2, 4},
+    {26, 5, 15, 4},
+    {4999, 0, 2, 5},
+    {37, 5, 0, 10547},
+    {85, 3, 2, 4},
+    {4871, 0, 2, 6},
+    {18, 2, 21, 10546},
+    {4705, 0, 19, 5},
+    {4750, 0, 15, 4},
+    {281529, 1, 0, 10661},
+    {6343, 0, 0, 10642},
+    {76, 3, 0, 10591},
+    {5852, 0, 0, 10588},
+    {164124, 1, 0, 10572},
+    {68, 3, 0, 10563},
+    {3605, 0, 0, 10557},
+    {147960, 1, 2, 5},
+    {3551, 0, 23, 6},
+    {4007, 0, 0, 10562},
+    {38, 2, 2, 4},
+    {35, 5, 2, 4},
+    {31, 5, 2, 5},
+    {3707, 0, 19, 5},
+    {44, 5, 23, 3},
+    {80, 2, 2, 4},
+    {33, 5, 21, 10565},
+    {36, 5, 0, 10571},
+    {34, 5, 0, 10570},
+    {109486, 1, 21, 10568},
+    {3878, 0, 13, 10569},
+    {122969, 1, 23, 3},
+    {4, 2, 23, 3},
+    {129381, 1, 15, 5},
+    {33, 5, 0, 10579},
+    {3908, 0, 2, 5},
+    {3881, 0, 2, 4},
+    {167320, 1, 17, 10576},
+    {26, 5, 2, 5},
+    {196834, 1, 25, 10578},
+    {25, 5, 23, 4},
+    {252916, 1, 0, 10587},
+    {25, 2, 0, 10586},
+    {45, 5, 2, 4},
+    {182869, 1, 0, 10585},
+    {35, 5, 2, 6},
+    {34, 5, 27, 4},
+    {67, 3, 23, 6},
+    {174965, 1, 27, 5},
+    {58, 2, 23, 4},
+    {5926, 0, 17, 10589},
+    {24, 5, 17, 10590},
+    {6183, 0, 23, 4},
+    {4833, 0, 0, 10620},
+    {78, 3, 0, 10594},
+    {30, 5, 23, 6},
+    {33, 5, 0, 10614},
+    {24, 5, 0, 10602},
+    {80, 3, 13, 10597},
+    {21, 5, 0, 10599},
+    {4173, 0, 19, 3},
+    {4149, 0, 2, 4},
+    {88, 3, 2, 3},
+    {87, 3, 15, 4},
+    {83, 3, 0, 10609},
+    {13, 2, 0, 10607},
+    {26, 5, 2, 4},
+    {82, 3, 2, 4},
+    {82127, 1, 19, 3},
+    {29, 5, 2, 4},
+    {208386, 1, 23, 4},
+    {4, 2, 0, 10612},
+    {1, 2, 2, 5},
+    {29, 5, 23, 4},
+    {84, 3, 2, 4},
+    {4776, 0, 19, 5},
+    {120569, 1, 0, 10619},
+    {40, 5, 2, 5},
+    {45836, 1, 0, 10618},
+    {37, 5, 23, 4},
+    {4776, 0, 19, 6},
+    {4078, 0, 23, 4},
+    {6121, 0, 2, 5},
+    {80, 3, 0, 10635},
+    {1, 2, 0, 10631},
+    {79, 3, 2, 5},
+    {77, 3, 0, 10629},
+    {42, 5, 2, 4},
+    {5306, 0, 21, 10627},
+    {6014, 0, 2, 5},
+    {24, 5, 23, 4},
+    {78, 3, 17, 10630},
+    {29, 5, 19, 5},
+    {3, 2, 2, 4},
+    {79, 3, 0, 10634},
+    {44, 5, 23, 3},
+    {27, 5, 19, 3},
+    {37, 5, 2, 4},
+    {34, 5, 2, 5},
+    {23, 5, 25, 10638},
+    {26, 5, 0, 10640},
+    {2, 2, 19, 5},
+    {2, 2, 2, 4},
+    {82, 3, 23, 4},
+    {7175, 0, 0, 10655},
+    {3, 2, 0, 10649},
+    {31, 5, 0, 10646},
+    {23, 5, 23, 4},
+    {6896, 0, 2, 5},
+    {2, 2, 2, 3},
+    {34, 5, 15, 4},
+    {178, 2, 0, 10653},
+    {171093, 1, 2, 4},
+    {68, 3, 2, 5},
+    {32, 5, 23, 4},
+    {6632, 0, 2, 6},
+    {36, 5, 23, 4},
+    {31, 2, 0, 10660},
+    {4, 2, 2, 4},
+    {2, 2, 21, 10658},
+    {7462, 0, 25, 10659},
+    {33, 5, 19, 5},
+    {73, 3, 23, 6},
+    {90, 3, 0, 10792},
+    {32, 5, 0, 10735},
+    {3715, 0, 0, 10670},
+    {651999, 1, 0, 10668},
+    {28, 5, 2, 6},
+    {32, 2, 2, 5},
+    {26, 5, 27, 5},
+    {76, 3, 17, 10669},
+    {28, 5, 23, 6},
+    {81, 3, 0, 10728},
+    {135, 2, 0, 10724},
+    {5509, 0, 0, 10692},
+    {55, 2, 2, 5},
+    {383993, 1, 0, 10679},
+    {31, 2, 2, 5},
+    {69, 3, 2, 5},
+    {27, 5, 25, 10678},
+    {30, 5, 23, 6},
+    {436588, 1, 21, 10680},
+    {67, 3, 0, 10682},
+    {25, 5, 23, 4},
+    {14, 2, 0, 10691},
+    {30, 5, 0, 10690},
+    {1, 2, 21, 10685},
+    {28, 5, 0, 10689},
+    {26, 5, 0, 10688},
+    {3981, 0, 19, 5},
+    {3905, 0, 23, 6},
+    {29, 5, 23, 4},
+    {4293, 0, 19, 6},
+    {69, 3, 27, 5},
+    {6094, 0, 0, 10697},
+    {23, 5, 21, 10694},
+    {78, 3, 2, 4},
+    {77, 3, 2, 5},
+    {73, 3, 23, 4},
+    {30, 5, 0, 10717},
+    {513228, 1, 0, 10711},
+    {499306, 1, 2, 4},
+    {29, 5, 0, 10709},
+    {22, 2, 21, 10702},
+    {116, 2, 2, 5},
+    {77, 3, 2, 5},
+    {72, 3, 2, 4},
+    {81, 2, 0, 10708},
+    {26, 5, 2, 5},
+    {24, 5, 19, 6},
+    {26, 5, 23, 4},
+    {6928, 0, 21, 10710},
+    {355341, 1, 27, 3},
+    {26, 5, 0, 10715},
+    {25, 5, 0, 10714},
+    {8, 2, 27, 5},
+    {13, 2, 19, 6},
+    {549479, 1, 2, 5},
+    {28, 5, 23, 6},
+    {2, 2, 0, 10719},
+    {76, 3, 19, 5},
+    {358186, 1, 0, 10722},
+    {298512, 1, 25, 10721},
+    {7045, 0, 19, 5},
+    {544482, 1, 2, 5},
+    {404732, 1, 23, 6},
+    {445028, 1, 0, 10726},
+    {4087, 0, 23, 4},
+    {4937, 0, 21, 10727},
+    {5528, 0, 11, 5},
+    {3794, 0, 0, 10730},
+    {3756, 0, 15, 4},
+    {22, 2, 21, 10731},
+    {4809, 0, 0, 10733},
+    {313766, 1, 19, 5},
+    {4829, 0, 13, 10734},
+    {27, 5, 23, 4},
+    {7028, 0, 0, 10779},
+    {7, 2, 0, 10756},
+    {73, 3, 0, 10747},
+    {44, 5, 0, 10743},
+    {4, 2, 2, 5},
+    {40, 5, 2, 6},
+    {3539, 0, 21, 10742},
+    {72, 3, 27, 5},
+    {69, 3, 2, 6},
+    {68, 3, 2, 4},
+    {66, 3, 17, 10746},
+    {46, 5, 19, 5},
+    {4, 2, 0, 10754},
+    {387222, 1, 0, 10752},
+    {289499, 1, 21, 10750},
+    {74, 3, 21, 10751},
+    {40, 5, 27, 4},
+    {74, 3, 13, 10753},
+    {4849, 0, 23, 4},
+    {5310, 0, 2, 6},
+    {42, 5, 19, 6},
+    {4083, 0, 0, 10766},
+    {355219, 1, 21, 10758},
+    {621758, 1, 0, 10762},
+    {74, 3, 21, 10760},
+    {34, 5, 2, 6},
+    {539938, 1, 23, 6},
+    {142, 2, 0, 10765},
+    {938408, 1, 21, 10764},
+    {54, 2, 27, 5},
+    {690620, 1, 23, 6},
+    {38, 5, 0, 10777},
+    {131, 2, 0, 10773},
+    {119, 2, 0, 10771},
+    {76, 3, 21, 10770},
+    {4455, 0, 23, 4},
+    {127, 2, 2, 6},
+    {36, 5, 23, 6},
+    {527419, 1, 2, 5},
+    {506346, 1, 2, 3},
+    {35, 5, 2, 5},
+    {34, 5, 23, 4},
+    {47, 5, 2, 4},
+    {340171, 1, 27, 5},
+    {76, 3, 0, 10787},
+    {75, 3, 2, 4},
+    {7084, 0, 21, 10782},
+    {527666, 1, 0, 10786},
+    {69, 3, 2, 6},
+    {338609, 1, 25, 10785},
+    {35, 5, 23, 6},
+    {34, 5, 19, 6},
+    {2, 2, 17, 10788},
+    {487806, 1, 25, 10789},
+    {7365, 0, 2, 5},
+    {35, 5, 2, 6},
+    {7324, 0, 23, 6},
+    {4001, 0, 2, 2},
+    {23, 5, 9, 10794},
+    {3891, 0, 2, 3},
+    {30, 5, 15, 4},
+    {94, 3, 0, 11062},
+    {5413, 0, 0, 10976},
+    {1088144, 1, 0, 10972},
+    {28, 5, 0, 10820},
+    {21, 5, 13, 10801},
+    {4768, 0, 0, 10816},
+    {314, 2, 21, 10803},
+    {318, 2, 25, 10804},
+    {80, 3, 0, 10812},
+    {183861, 1, 2, 5},
+    {4152, 0, 0, 10810},
+    {27, 5, 2, 6},
+    {898, 2, 2, 5},
+    {26, 5, 27, 5},
+    {26, 5, 21, 10811},
+    {77193, 1, 23, 4},
+    {25, 5, 0, 10814},
+    {4397, 0, 19, 5},
+    {605833, 1, 2, 5},
+    {3660, 0, 19, 5},
+    {332, 2, 13, 10817},
+    {4808, 0, 9, 10818},
+    {86533, 1, 2, 5},
+    {26, 5, 19, 5},
+    {4275, 2, 0, 10964},
+    {1712, 2, 0, 10928},
+    {3624, 0, 0, 10833},
+    {879, 2, 0, 10826},
+    {67, 3, 25, 10825},
+    {3612, 0, 23, 4},
+    {3593, 0, 2, 4},
+    {70207, 1, 25, 10828},
+    {47, 5, 2, 6},
+    {3561, 0, 0, 10832},
+    {42, 5, 2, 4},
+    {39, 5, 19, 5},
+    {33, 5, 19, 6},
+    {1584, 2, 0, 10923},
+    {1435, 2, 0, 10919},
+    {36, 5, 0, 10883},
+    {5260, 0, 0, 10880},
+    {76, 3, 0, 10849},
+    {31, 5, 0, 10841},
+    {111855, 1, 2, 5},
+    {30, 5, 19, 6},
+    {34, 5, 21, 10842},
+    {226547, 1, 2, 5},
+    {68, 3, 21, 10844},
+    {35, 5, 0, 10846},
+    {4556, 0, 19, 5},
+    {92635, 1, 21, 10847},
+    {4269, 0, 17, 10848},
+    {4758, 0, 23, 4},
+    {4581, 0, 0, 10870},
+    {83, 3, 2, 5},
+    {82, 3, 0, 10869},
+    {507048, 1, 0, 10865},
+    {330904, 1, 0, 10863},
+    {78, 3, 0, 10857},
+    {155496, 1, 2, 5},
+    {31, 5, 23, 6},
+    {3688, 0, 25, 10858},
+    {79, 3, 0, 10862},
+    {34, 5, 21, 10860},
+    {35, 5, 17, 10861},
+    {487, 2, 23, 4},
+    {1052, 2, 23, 4},
+    {4382, 0, 2, 5},
+    {355654, 1, 23, 4},
+    {79, 3, 2, 5},
+    {767592, 1, 0, 10868},
+    {4021, 0, 23, 4},
+    {3766, 0, 19, 6},
+    {528587, 1, 27, 4},
+    {869, 2, 0, 10876},
+    {4691, 0, 21, 10872},
+    {35, 5, 0, 10875},
+    {76941, 1, 13, 10874},
+    {382, 2, 19, 5},
+    {540345, 1, 23, 3},
+    {585383, 1, 2, 5},
+    {79, 3, 25, 10878},
+    {4652, 0, 25, 10879},
+    {31, 5, 23, 4},
+    {78, 3, 2, 6},
+    {692556, 1, 21, 10882},
+    {33, 5, 23, 6},
+    {45, 5, 0, 10917},
+    {519, 2, 0, 10904},
+    {4098, 0, 0, 10896},
+    {84, 3, 0, 10894},
+    {920848, 1, 2, 5},
+    {71, 3, 0, 10890},
+    {226, 2, 27, 5},
+    {234, 2, 21, 10891},
+    {423, 2, 25, 10892},
+    {691417, 1, 21, 10893},
+    {3907, 0, 27, 5},
+    {3677, 0, 2, 5},
+    {41, 5, 23, 4},
+    {595003, 1, 2, 5},
+    {80, 3, 0, 10903},
+    {72, 3, 2, 5},
+    {71, 3, 2, 6},
+    {38, 5, 21, 10901},
+    {4638, 0, 17, 10902},
+    {69, 3, 23, 4},
+    {4647, 0, 19, 5},
+    {88, 3, 2, 5},
+    {44, 5, 0, 10915},
+    {4323, 0, 0, 10908},
+    {4317, 0, 23, 4},
+    {86, 3, 2, 4},
+    {980, 2, 21, 10910},
+    {1306, 2, 2, 5},
+    {77, 3, 2, 6},
+    {4421, 0, 2, 5},
+    {688283, 1, 25, 10914},
+    {38, 5, 27, 5},
+    {628521, 1, 2, 5},
+    {567049, 1, 23, 6},
+    {49, 5, 21, 10918},
+    {364607, 1, 27, 5},
+    {4428, 0, 2, 5},
+    {698475, 1, 2, 5},
+    {48, 5, 2, 5},
+    {34, 5, 23, 4},
+    {1586, 2, 0, 10925},
+    {45, 5, 27, 4},
+    {29, 5, 25, 10926},
+    {4592, 0, 2, 5},
+    {4545, 0, 23, 6},
+    {36, 5, 21, 10929},
+    {74, 3, 21, 10930},
+    {2900, 2, 0, 10957},
+    {4454, 0, 0, 10951},
+    {47, 5, 0, 10945},
+    {238022, 1, 0, 10936},
+    {40, 5, 2, 4},
+    {4011, 0, 23, 4},
+    {1739, 2, 17, 10937},
+    {626873, 1, 0, 10941},
+    {43, 5, 2, 5},
+    {40, 5, 2, 6},
+    {461584, 1, 23, 6},
+    {43, 5, 0, 10944},
+    {38, 5, 17, 10943},
+    {4126, 0, 23, 4},
+    {1956, 2, 23, 4},
+    {49, 5, 0, 10947},
+    {781164, 1, 23, 4},
+    {4107, 0, 0, 10950},
+    {219357, 1, 21, 10949},
+    {76, 3, 23, 6},
+    {51, 5, 27, 4},
+    {85, 3, 21, 10952},
+    {2236, 2, 0, 10955},
+    {608558, 1, 2, 6},
+    {1804, 2, 27, 5},
+    {87, 3, 17, 10956},
+    {43, 5, 19, 5},
+    {2977, 2, 21, 10958},
+    {2992, 2, 0, 10960},
+    {51, 5, 27, 5},
+    {42, 5, 21, 10961},
+    {43, 5, 17, 10962},
+    {455939, 1, 25, 10963},
+    {49, 5, 23, 4},
+    {5098, 2, 0, 10966},
+    {3866, 0, 15, 4},
+    {74, 3, 2, 5},
+    {46, 5, 0, 10971},
+    {69, 3, 2, 6},
+    {4647, 0, 2, 4},
+    {39, 5, 27, 5},
+    {573696, 1, 19, 5},
+    {1120287, 1, 0, 10975},
+    {76, 3, 21, 10974},
+    {30, 5, 19, 5},
+    {3701, 0, 15, 4},
+    {28, 5, 21, 10977},
+    {2007, 2, 0, 11054},
+    {42, 5, 0, 11044},
+    {70, 3, 0, 10993},
+    {616, 2, 21, 10981},
+    {1453, 2, 0, 10991},
+    {6814, 0, 0, 10989},
+    {831, 2, 21, 10984},
+    {895, 2, 0, 10987},
+    {35, 5, 17, 10986},
+    {6229, 0, 27, 4},
+    {36, 5, 2, 5},
+    {30, 5, 23, 4},
+    {725, 2, 17, 10990},
+    {36, 5, 23, 6},
+    {39, 5, 21, 10992},
+    {373733, 1, 27, 5},
+    {90, 3, 0, 11040},
+    {5740, 0, 0, 11002},
+    {86, 3, 2, 5},
+    {72, 3, 21, 10997},
+    {33, 5, 0, 11000},
+    {642097, 1, 25, 10999},
+    {5596, 0, 27, 5},
+    {77, 3, 25, 11001},
+    {5662, 0, 23, 6},
+    {5765, 0, 0, 11004},
+    {450, 2, 19, 6},
+    {622422, 1, 0, 11039},
+    {570, 2, 0, 11016},
+    {7385, 0, 2, 6},
+    {76, 3, 0, 11011},
+    {320349, 1, 0, 11010},
+    {31, 5, 23, 4},
+    {34, 5, 27, 5},
+    {77, 3, 25, 11012},
+    {361607, 1, 2, 4},
+    {271111, 1, 2, 6},
+    {34, 5, 25, 11015},
+    {6191, 0, 27, 5},
+    {1486, 2, 0, 11024},
+    {6261, 0, 0, 11019},
+    {1137, 2, 23, 6},
+    {87, 3, 0, 11023},
+    {7261, 0, 25, 11021},
+    {7313, 0, 21, 11022},
+    {34, 5, 23, 6},
+    {6496, 0, 19, 5},
+    {6291, 0, 0, 11029},
+    {38, 5, 2, 4},
+    {29, 5, 25, 11027},
+    {30, 5, 2, 6},
+    {1734, 2, 23, 6},
+    {1939, 2, 2, 6},
+    {41, 5, 2, 6},
+    {32, 5, 0, 11033},
+    {6452, 0, 23, 4},
+    {78, 3, 0, 11036},
+    {39, 5, 2, 6},
+    {34, 5, 27, 5},
+    {84, 3, 2, 5},
+    {34, 5, 21, 11038},
+    {6373, 0, 27, 4},
+    {668321, 1, 23, 4},
+    {5770, 0, 2, 5},
+    {36, 5, 17, 11042},
+    {1060, 2, 25, 11043},
+    {5680, 0, 23, 6},
+    {87, 3, 21, 11045},
+    {5994, 0, 2, 6},
+    {46, 5, 0, 11050},
+    {5801, 0, 2, 6},
+    {90, 3, 21, 11049},
+    {448221, 1, 23, 6},
+    {48, 5, 2, 5},
+    {47, 5, 0, 11053},
+    {1505, 2, 23, 4},
+    {5579, 0, 23, 4},
+    {78, 3, 21, 11055},
+    {82, 3, 0, 11057},
+    {7057, 0, 19, 5},
+    {5729, 0, 0, 11061},
+    {5535, 0, 0, 11060},
+    {46, 5, 27, 4},
+    {50, 5, 19, 5},
+    {38, 5, 27, 5},
+    {22, 5, 0, 11066},
+    {95, 3, 0, 11065},
+    {4046, 0, 3, 3},
+    {3815, 0, 15, 2},
+    {6180, 2, 0, 11070},
+    {95, 3, 21, 11068},
+    {3652, 0, 21, 11069},
+    {47, 5, 19, 5},
+    {95, 3, 7, 4},
+    {1283, 2, 0, 12080},
+    {61, 3, 0, 11957},
+    {35, 3, 0, 11441},
+    {51453, 1, 0, 11157},
+    {765, 2, 0, 11151},
+    {10532, 0, 0, 11142},
+    {248, 2, 0, 11136},
+    {24, 3, 0, 11088},
+    {8454, 0, 0, 11083},
+    {9430, 1, 2, 5},
+    {31, 5, 33, 11082},
+    {38, 5, 27, 8},
+    {29, 5, 29, 11084},
+    {42, 5, 0, 11087},
+    {34, 5, 2, 6},
+    {18, 3, 27, 8},
+    {18561, 1, 31, 8},
+    {7955, 0, 0, 11102},
+    {85, 2, 0, 11101},
+    {2, 2, 0, 11099},
+    {5973, 1, 0, 11095},
+    {39, 5, 2, 6},
+    {27, 3, 33, 11094},
+    {27, 5, 27, 7},
+    {35, 5, 25, 11096},
+    {40, 5, 2, 6},
+    {29, 3, 2, 8},
+    {7893, 0, 27, 8},
+    {28, 5, 29, 11100},
+    {36, 5, 35, 6},
+    {38, 5, 23, 4},
+    {9091, 0, 0, 11108},
+    {9563, 1, 0, 11105},
+    {39, 5, 19, 6},
+    {41, 5, 21, 11106},
+    {46675, 1, 2, 5},
+    {8902, 0, 19, 6},
+    {9922, 0, 0, 11130},
+    {3, 2, 0, 11113},
+    {32, 3, 25, 11111},
+    {44, 5, 25, 11112},
+    {17856, 1, 23, 6},
+    {9755, 0, 0, 11124},
+    {181, 2, 0, 11121},
+    {6149, 1, 33, 11116},
+    {34, 3, 0, 11120},
+    {38, 5, 25, 11118},
+    {108, 2, 2, 5},
+    {29, 3, 23, 4},
+    {9647, 0, 31, 6},
+    {9733, 0, 0, 11123},
+    {44, 5, 35, 6},
+    {39, 5, 27, 5},
+    {172, 2, 2, 6},
+    {42, 5, 0, 11129},
+    {29, 3, 2, 8},
+    {9854, 0, 2, 8},
+    {9794, 0, 35, 6},
+    {27, 3, 19, 6},
+    {11, 2, 25, 11131},
+    {42, 5, 2, 4},
+    {171, 2, 2, 6},
+    {10163, 0, 0, 11135},
+    {31, 3, 19, 5},
+    {39, 5, 23, 6},
+    {27, 3, 2, 5},
+    {9343, 0, 0, 11139},
+    {34, 5, 23, 6},
+    {455, 2, 0, 11141},
+    {34, 5, 19, 5},
+    {31527, 1, 19, 5},
+    {583, 2, 2, 2},
+    {479, 2, 0, 11148},
+    {10728, 0, 25, 11145},
+    {10797, 0, 2, 6},
+    {37, 5, 21, 11147},
+    {26, 3, 23, 6},
+    {10653, 0, 2, 6},
+    {36, 5, 21, 11150},
+    {39, 5, 27, 4},
+    {10113, 0, 2, 7},
+    {7559, 0, 0, 11154},
+    {39, 5, 35, 7},
+    {8588, 0, 0, 11156},
+    {34, 5, 23, 6},
+    {34, 5, 27, 5},
+    {9411, 0, 0, 11251},
+    {45, 2, 0, 11186},
+    {34, 3, 0, 11180},
+    {8114, 0, 0, 11168},
+    {1, 2, 0, 11164},
+    {7992, 0, 2, 5},
+    {42, 5, 27, 4},
+    {132983, 1, 21, 11165},
+    {7648, 0, 25, 11166},
+    {35, 2, 21, 11167},
+    {38, 5, 19, 5},
+    {38, 5, 0, 11173},
+    {21, 3, 2, 5},
+    {17, 2, 0, 11172},
+    {30, 5, 11, 3},
+    {470940, 1, 23, 6},
+    {8791, 0, 2, 5},
+    {8361, 0, 0, 11177},
+    {30, 3, 21, 11176},
+    {45, 5, 27, 5},
+    {41, 5, 0, 11179},
+    {19, 2, 23, 6},
+    {47, 5, 19, 6},
+    {1, 2, 25, 11181},
+    {141576, 1, 21, 11182},
+    {419739, 1, 2, 5},
+    {23, 2, 2, 5},
+    {15, 2, 2, 4},
+    {42, 5, 27, 4},
+    {20, 3, 0, 11189},
+    {71, 2, 2, 5},
+    {8793, 0, 23, 2},
+    {42, 5, 0, 11239},
+    {261, 2, 0, 11216},
+    {8524, 0, 0, 11212},
+    {294746, 1, 0, 11204},
+    {30, 3, 0, 11202},
+    {58, 2, 25, 11195},
+    {7620, 0, 25, 11196},
+    {27, 3, 2, 5},
+    {241, 2, 2, 5},
+    {31, 5, 0, 11201},
+    {7838, 0, 2, 5},
+    {106, 2, 27, 5},
+    {7669, 0, 23, 6},
+    {8496, 0, 2, 5},
+    {8374, 0, 19, 6},
+    {30, 3, 0, 11206},
+    {523998, 1, 23, 6},
+    {465688, 1, 2, 5},
+    {109, 2, 21, 11208},
+    {8276, 0, 2, 5},
+    {32, 3, 17, 11210},
+    {36, 5, 2, 6},
+    {29, 5, 19, 5},
+    {32, 3, 0, 11215},
+    {175, 2, 21, 11214},
+    {30, 3, 23, 6},
+    {140, 2, 27, 5},
+    {7695, 0, 0, 11223},
+    {7651, 0, 0, 11222},
+    {352, 2, 25, 11219},
+    {28, 3, 21, 11220},
+    {306671, 1, 21, 11221},
+    {37, 5, 27, 4},
+    {7669, 0, 35, 5},
+    {445450, 1, 0, 11236},
+    {8490, 0, 0, 11230},
+    {7715, 0, 25, 11226},
+    {326964, 1, 2, 5},
+    {287, 2, 25, 11228},
+    {924, 2, 21, 11229},
+    {37, 5, 27, 5},
+    {837, 2, 0, 11235},
+    {430, 2, 0, 11233},
+    {302351, 1, 27, 5},
+    {28, 5, 2, 6},
+    {32, 3, 27, 5},
+    {247297, 1, 23, 4},
+    {39, 5, 0, 11238},
+    {28, 5, 23, 6},
+    {497549, 1, 27, 4},
+    {8024, 0, 21, 11240},
+    {46, 5, 0, 11248},
+    {43, 5, 0, 11247},
+    {121261, 1, 25, 11243},
+    {31, 3, 2, 4},
+    {8537, 0, 17, 11245},
+    {29, 3, 21, 11246},
+    {8882, 0, 19, 5},
+    {395478, 1, 23, 4},
+    {32, 3, 0, 11250},
+    {8465, 0, 27, 4},
+    {48, 5, 27, 5},
+    {31, 5, 0, 11284},
+    {896, 2, 2, 5},
+    {25, 3, 0, 11264},
+    {30, 5, 0, 11262},
+    {27, 5, 17, 11256},
+    {23, 3, 2, 4},
+    {28, 5, 21, 11258},
+    {29, 5, 0, 11260},
+    {773, 2, 19, 5},
+    {213395, 1, 21, 11261},
+    {10075, 0, 23, 4},
+    {395, 2, 2, 5},
+    {220, 2, 19, 6},
+    {28, 5, 0, 11272},
+    {368, 2, 0, 11269},
+    {75613, 1, 0, 11268},
+    {62898, 1, 23, 6},
+    {29, 3, 27, 5},
+    {379, 2, 17, 11270},
+    {10327, 0, 2, 5},
+    {254041, 1, 27, 5},
+    {30, 5, 0, 11282},
+    {11227, 0, 2, 6},
+    {341, 2, 0, 11280},
+    {29, 5, 2, 5},
+    {242689, 1, 2, 5},
+    {14, 2, 2, 6},
+    {33, 3, 17, 11279},
+    {34, 3, 27, 4},
+    {378, 2, 17, 11281},
+    {163684, 1, 19, 6},
+    {32, 3, 25, 11283},
+    {11156, 0, 23, 6},
+    {19, 2, 0, 11335},
+    {12966, 0, 0, 11310},
+    {32, 3, 25, 11287},
+    {1, 2, 0, 11309},
+    {319415, 1, 2, 5},
+    {11157, 0, 0, 11295},
+    {34, 3, 25, 11291},
+    {78257, 1, 0, 11293},
+    {35, 5, 19, 6},
+    {11146, 0, 2, 3},
+    {34, 5, 7, 3},
+    {37, 5, 0, 11302},
+    {32, 5, 0, 11299},
+    {33, 3, 21, 11298},
+    {11186, 0, 27, 5},
+    {11171, 0, 17, 11300},
+    {79357, 1, 2, 4},
+    {75855, 1, 19, 6},
+    {78644, 1, 0, 11304},
+    {40, 5, 27, 5},
+    {44, 5, 0, 11308},
+    {295295, 1, 2, 4},
+    {11207, 0, 2, 6},
+    {80433, 1, 19, 5},
+    {50, 5, 27, 5},
+    {11781, 0, 27, 5},
+    {45, 5, 0, 11327},
+    {28, 3, 0, 11314},
+    {19, 3, 17, 11313},
+    {13009, 0, 23, 6},
+    {39, 5, 17, 11315},
+    {1, 2, 0, 11326},
+    {13361, 0, 0, 11320},
+    {34, 3, 21, 11318},
+    {43, 5, 2, 6},
+    {13192, 0, 27, 5},
+    {42, 5, 0, 11325},
+    {32, 3, 25, 11322},
+    {13522, 0, 0, 11324},
+    {41, 5, 23, 4},
+    {41, 5, 19, 6},
+    {43, 5, 23, 4},
+    {33, 3, 19, 5},
+    {48, 5, 25, 11328},
+    {50, 5, 0, 11333},
+    {49, 5, 0, 11331},
+    {13209, 0, 19, 6},
+    {32, 3, 25, 11332},
+    {13631, 0, 23, 4},
+    {51, 5, 2, 6},
+    {13178, 0, 27, 5},
+    {117691, 1, 0, 11368},
+    {43, 5, 0, 11363},
+    {384, 2, 0, 11348},
+    {20, 3, 0, 11341},
+    {35, 5, 25, 11340},
+    {73374, 1, 27, 8},
+    {10037, 0, 0, 11347},
+    {84576, 1, 0, 11345},
+    {34, 3, 2, 6},
+    {89, 2, 23, 6},
+    {9912, 0, 2, 8},
+    {28, 3, 35, 6},
+    {21, 3, 23, 6},
+    {33, 5, 0, 11350},
+    {483, 2, 19, 5},
+    {10377, 0, 0, 11360},
+    {24, 3, 0, 11357},
+    {96466, 1, 0, 11356},
+    {10168, 0, 2, 5},
+    {36, 5, 17, 11355},
+    {39, 5, 23, 4},
+    {35, 5, 19, 6},
+    {29, 3, 25, 11358},
+    {635, 2, 2, 5},
+    {36, 5, 19, 6},
+    {40, 5, 2, 5},
+    {656, 2, 25, 11362},
+    {92837, 1, 23, 6},
+    {20, 3, 0, 11365},
+    {81629, 1, 35, 6},
+    {34, 3, 2, 8},
+    {29, 3, 17, 11367},
+    {31, 3, 27, 4},
+    {10465, 0, 0, 11417},
+    {16, 3, 0, 11373},
+    {9556, 0, 21, 11371},
+    {272113, 1, 17, 11372},
+    {38, 5, 19, 6},
+    {44, 5, 0, 11414},
+    {27, 3, 0, 11393},
+    {641, 2, 0, 11392},
+    {35, 5, 0, 11387},
+    {126, 2, 0, 11379},
+    {33, 5, 27, 5},
+    {20, 3, 0, 11381},
+    {418, 2, 27, 5},
+    {32, 5, 17, 11382},
+    {25, 3, 0, 11386},
+    {24, 3, 2, 5},
+    {34, 5, 2, 4},
+    {369481, 1, 19, 5},
+    {34, 5, 27, 4},
+    {249219, 1, 25, 11388},
+    {21, 3, 25, 11389},
+    {40, 5, 2, 4},
+    {25, 3, 2, 6},
+    {10213, 0, 23, 4},
+    {9812, 0, 11, 5},
+    {551, 2, 0, 11411},
+    {185719, 1, 21, 11395},
+    {32, 5, 0, 11399},
+    {427, 2, 21, 11397},
+    {9898, 0, 2, 5},
+    {496, 2, 19, 6},
+    {32, 3, 0, 11405},
+    {10205, 0, 2, 6},
+    {214883, 1, 25, 11402},
+    {294953, 1, 21, 11403},
+    {9986, 0, 2, 4},
+    {28, 3, 19, 6},
+    {9750, 0, 0, 11409},
+    {294620, 1, 2, 6},
+    {42, 5, 2, 4},
+    {33, 3, 19, 6},
+    {10279, 0, 2, 5},
+    {41, 5, 27, 5},
+    {41, 5, 25, 11412},
+    {827, 2, 21, 11413},
+    {344167, 1, 27, 5},
+    {427, 2, 17, 11415},
+    {9866, 0, 21, 11416},
+    {30, 3, 27, 4},
+    {33, 3, 0, 11439},
+    {658, 2, 0, 11438},
+    {374, 2, 2, 6},
+    {11441, 0, 2, 6},
+    {281, 2, 2, 5},
+    {10616, 0, 25, 11423},
+    {32, 5, 21, 11424},
+    {24, 3, 0, 11430},
+    {23, 3, 2, 6},
+    {35, 5, 25, 11427},
+    {10856, 0, 0, 11429},
+    {37, 5, 23, 6},
+    {11140, 0, 23, 6},
+    {214, 2, 2, 6},
+    {365358, 1, 2, 6},
+    {37, 5, 21, 11433},
+    {30, 3, 2, 4},
+    {38, 5, 0, 11436},
+    {29, 3, 23, 6},
+    {29, 3, 2, 5},
+    {204068, 1, 23, 6},
+    {10850, 0, 19, 5},
+    {300509, 1, 13, 11440},
+    {11044, 0, 23, 6},
+    {241, 2, 0, 11748},
+    {51135, 1, 0, 11516},
+    {45, 5, 0, 11508},
+    {9430, 0, 0, 11491},
+    {27, 2, 0, 11484},
+    {8877, 0, 0, 11464},
+    {41, 3, 0, 11457},
+    {39, 3, 0, 11451},
+    {8543, 0, 29, 11450},
+    {29, 5, 31, 6},
+    {7643, 0, 0, 11454},
+    {33, 5, 17, 11453},
+    {38, 5, 27, 5},
+    {8861, 0, 2, 6},
+    {34, 5, 17, 11456},
+    {38, 5, 19, 2},
+    {8834, 0, 0, 11463},
+    {42, 3, 25, 11459},
+    {44, 3, 29, 11460},
+    {47, 3, 2, 6},
+    {33, 5, 25, 11462},
+    {42, 5, 35, 6},
+    {8863, 0, 19, 6},
+    {33, 5, 0, 11480},
+    {29, 5, 25, 11466},
+    {9174, 0, 0, 11475},
+    {47, 3, 25, 11468},
+    {29824, 1, 0, 11473},
+    {28917, 1, 2, 6},
+    {31, 5, 2, 5},
+    {30, 5, 21, 11472},
+    {9130, 0, 19, 6},
+    {30013, 1, 2, 5},
+    {29957, 1, 23, 4},
+    {1, 2, 0, 11478},
+    {51, 3, 2, 4},
+    {28978, 1, 27, 4},
+    {29098, 1, 17, 11479},
+    {29812, 1, 23, 6},
+    {39, 5, 0, 11482},
+    {47, 3, 27, 5},
+    {40, 5, 25, 11483},
+    {40, 3, 23, 4},
+    {46021, 1, 2, 4},
+    {55, 2, 0, 11488},
+    {41, 2, 2, 6},
+    {29, 5, 27, 7},
+    {25267, 1, 33, 11489},
+    {39207, 1, 2, 8},
+    {32, 5, 23, 6},
+    {25641, 1, 0, 11499},
+    {9453, 0, 33, 11493},
+    {45, 3, 0, 11495},
+    {43, 5, 27, 5},
+    {20604, 1, 0, 11498},
+    {4, 2, 2, 7},
+    {40, 5, 27, 7},
+    {10557, 0, 35, 5},
+    {210, 2, 2, 6},
+    {46, 3, 0, 11505},
+    {42, 5, 0, 11504},
+    {34, 5, 2, 8},
+    {3, 2, 31, 8},
+    {44, 5, 27, 7},
+    {10059, 0, 33, 11506},
+    {42, 5, 2, 7},
+    {51, 3, 27, 7},
+    {7576, 0, 0, 11510},
+    {7560, 0, 27, 5},
+    {125, 2, 0, 11515},
+    {49, 5, 2, 7},
+    {8355, 1, 33, 11513},
+    {46, 5, 33, 11514},
+    {48, 5, 31, 8},
+    {10596, 0, 31, 5},
+    {7865, 0, 0, 11530},
+    {7667, 0, 0, 11523},
+    {43, 3, 2, 6},
+    {117, 2, 0, 11521},
+    {197657, 1, 27, 5},
+    {7562, 0, 21, 11522},
+    {33, 5, 31, 6},
+    {7860, 0, 2, 2},
+    {56, 3, 2, 5},
+    {155427, 1, 25, 11526},
+    {40, 3, 2, 7},
+    {7693, 0, 29, 11528},
+    {7787, 0, 21, 11529},
+    {46, 5, 27, 7},
+    {49, 5, 0, 11740},
+    {53, 3, 0, 11699},
+    {46, 5, 0, 11681},
+    {9109, 0, 0, 11585},
+    {83350, 1, 0, 11544},
+    {40, 3, 29, 11536},
+    {2, 2, 0, 11541},
+    {1, 2, 0, 11540},
+    {51, 3, 25, 11539},
+    {37, 5, 27, 5},
+    {34, 5, 27, 5},
+    {29, 5, 0, 11543},
+    {26, 5, 31, 6},
+    {38, 5, 35, 6},
+    {8431, 0, 0, 11567},
+    {40, 3, 0, 11555},
+    {7985, 0, 0, 11548},
+    {7979, 0, 31, 5},
+    {8108, 0, 33, 11549},
+    {179, 2, 0, 11554},
+    {42, 5, 0, 11553},
+    {52, 2, 29, 11552},
+    {32, 5, 27, 7},
+    {479716, 1, 27, 8},
+    {31, 5, 35, 7},
+    {7871, 0, 33, 11556},
+    {43, 5, 0, 11564},
+    {287135, 1, 0, 11559},
+    {41, 5, 31, 6},
+    {8309, 0, 2, 8},
+    {51, 3, 2, 7},
+    {460885, 1, 25, 11562},
+    {45, 3, 29, 11563},
+    {36, 5, 31, 8},
+    {44, 5, 2, 8},
+    {46, 3, 2, 8},
+    {42, 3, 35, 7},
+    {166210, 1, 29, 11568},
+    {229609, 1, 0, 11570},
+    {44, 5, 35, 7},
+    {41, 3, 0, 11575},
+    {16, 2, 29, 11572},
+    {35, 5, 2, 7},
+    {296313, 1, 29, 11574},
+    {26, 5, 31, 6},
+    {43, 5, 0, 11578},
+    {42, 3, 2, 7},
+    {8873, 0, 31, 8},
+    {21, 2, 2, 6},
+    {44, 5, 33, 11580},
+    {47, 3, 29, 11581},
+    {8681, 0, 0, 11583},
+    {8490, 0, 35, 6},
+    {8703, 0, 33, 11584},
+    {8773, 0, 31, 8},
+    {158, 2, 0, 11672},
+    {12134, 0, 0, 11665},
+    {36, 3, 0, 11598},
+    {158086, 1, 0, 11593},
+    {11141, 0, 2, 5},
+    {153508, 1, 0, 11592},
+    {142184, 1, 27, 7},
+    {33, 5, 23, 6},
+    {4, 2, 0, 11597},
+    {1, 2, 2, 7},
+    {402032, 1, 2, 8},
+    {28, 5, 31, 6},
+    {41, 5, 35, 6},
+    {34, 5, 0, 11614},
+    {42, 3, 0, 11603},
+    {52, 2, 0, 11602},
+    {100073, 1, 27, 7},
+    {9645, 0, 35, 7},
+    {70207, 1, 33, 11604},
+    {45, 3, 0, 11606},
+    {9160, 0, 27, 7},
+    {32, 5, 33, 11607},
+    {154449, 1, 0, 11610},
+    {33, 5, 29, 11609},
+    {50, 3, 35, 7},
+    {2, 2, 0, 11613},
+    {224002, 1, 25, 11612},
+    {10684, 0, 35, 6},
+    {212909, 1, 27, 7},
+    {391538, 1, 0, 11664},
+    {139424, 1, 0, 11629},
+    {44, 5, 2, 6},
+    {52, 3, 2, 6},
+    {10978, 0, 2, 7},
+    {42, 5, 0, 11628},
+    {70207, 1, 0, 11622},
+    {16, 2, 35, 7},
+    {38, 2, 0, 11627},
+    {9218, 0, 0, 11625},
+    {35, 5, 31, 8},
+    {10319, 0, 33, 11626},
+    {38, 5, 27, 7},
+    {37, 5, 35, 7},
+    {9890, 0, 35, 6},
+    {40, 5, 0, 11648},
+    {50, 3, 0, 11635},
+    {9474, 0, 0, 11633},
+    {42, 3, 35, 7},
+    {86, 2, 25, 11634},
+    {35, 5, 35, 7},
+    {48, 2, 2, 7},
+    {52, 3, 0, 11646},
+    {8, 2, 2, 7},
+    {7, 2, 2, 8},
+    {10249, 0, 0, 11641},
+    {36, 5, 31, 6},
+    {4, 2, 2, 6},
+    {39, 5, 2, 7},
+    {51, 3, 0, 11645},
+    {36, 5, 27, 8},
+    {341818, 1, 35, 6},
+    {183091, 1, 25, 11647},
+    {282207, 1, 35, 6},
+    {385824, 1, 0, 11662},
+    {33, 2, 0, 11656},
+    {3, 2, 0, 11655},
+    {2, 2, 2, 8},
+    {10100, 0, 29, 11653},
+    {313593, 1, 2, 7},
+    {254756, 1, 27, 7},
+    {172219, 1, 35, 7},
+    {9739, 0, 0, 11659},
+    {9277, 0, 2, 8},
+    {42, 5, 35, 6},
+    {81, 2, 25, 11660},
+    {156044, 1, 25, 11661},
+    {281660, 1, 31, 6},
+    {36, 2, 2, 8},
+    {43, 5, 27, 8},
+    {392401, 1, 23, 7},
+    {42, 5, 25, 11666},
+    {45, 5, 2, 7},
+    {43, 5, 33, 11668},
+    {308559, 1, 0, 11671},
+    {37, 3, 33, 11670},
+    {298318, 1, 27, 8},
+    {12966, 0, 27, 7},
+    {9476, 0, 0, 11674},
+    {43, 5, 35, 6},
+    {40, 3, 0, 11677},
+    {39, 3, 2, 6},
+    {42, 5, 27, 8},
+    {35, 5, 0, 11679},
+    {9732, 0, 27, 5},
+    {10529, 0, 2, 7},
+    {68199, 1, 31, 5},
+    {166951, 1, 0, 11684},
+    {10564, 0, 2, 7},
+    {73509, 1, 35, 6},
+    {134, 2, 0, 11698},
+    {47, 3, 0, 11696},
+    {47, 5, 0, 11689},
+    {44, 2, 33, 11688},
+    {289456, 1, 31, 6},
+    {4, 2, 0, 11695},
+    {48, 5, 0, 11693},
+    {327623, 1, 33, 11692},
+    {10840, 0, 35, 6},
+    {306916, 1, 2, 8},
+    {13178, 0, 27, 8},
+    {8890, 0, 35, 7},
+    {388147, 1, 29, 11697},
+    {48, 5, 27, 7},
+    {10571, 0, 23, 8},
+    {154, 2, 0, 11733},
+    {8285, 0, 29, 11701},
+    {36, 5, 0, 11712},
+    {26, 5, 29, 11703},
+    {55, 3, 2, 8},
+    {12, 2, 0, 11711},
+    {54, 3, 0, 11710},
+    {10465, 0, 0, 11709},
+    {34, 5, 2, 8},
+    {133747, 1, 31, 8},
+    {209885, 1, 27, 8},
+    {10528, 0, 35, 7},
+    {186304, 1, 35, 7},
+    {46, 5, 0, 11729},
+    {11, 2, 0, 11719},
+    {42, 5, 0, 11717},
+    {58, 3, 2, 6},
+    {10717, 0, 35, 6},
+    {44, 5, 25, 11718},
+    {10527, 0, 27, 8},
+    {10613, 0, 2, 6},
+    {54, 3, 33, 11721},
+    {115, 2, 0, 11728},
+    {51, 2, 0, 11725},
+    {32, 2, 2, 7},
+    {39, 5, 27, 7},
+    {42, 5, 0, 11727},
+    {9615, 0, 35, 6},
+    {9615, 0, 27, 8},
+    {40, 5, 35, 7},
+    {56, 3, 0, 11732},
+    {210806, 1, 2, 8},
+    {10460, 0, 35, 7},
+    {1, 2, 35, 7},
+    {10048, 0, 0, 11737},
+    {434121, 1, 0, 11736},
+    {42, 5, 35, 6},
+    {36, 5, 27, 4},
+    {175, 2, 21, 11738},
+    {10514, 0, 2, 7},
+    {42, 5, 23, 6},
+    {3, 2, 0, 11746},
+    {51, 5, 2, 7},
+    {50, 5, 0, 11745},
+    {1, 2, 29, 11744},
+    {11132, 0, 35, 6},
+    {459784, 1, 31, 8},
+    {10238, 0, 2, 7},
+    {10198, 0, 31, 6},
+    {896, 2, 0, 11947},
+    {8785, 0, 0, 11774},
+    {425, 2, 0, 11764},
+    {296, 2, 21, 11752},
+    {211597, 1, 21, 11753},
+    {39, 3, 29, 11754},
+    {440987, 1, 2, 7},
+    {353996, 1, 2, 5},
+    {308661, 1, 0, 11762},
+    {7952, 0, 21, 11758},
+    {8195, 0, 0, 11761},
+    {8053, 0, 2, 6},
+    {29, 5, 31, 6},
+    {31, 5, 23, 4},
+    {30, 5, 2, 7},
+    {27, 5, 31, 6},
+    {384924, 1, 0, 11767},
+    {30097, 1, 2, 5},
+    {606, 2, 27, 4},
+    {649, 2, 0, 11770},
+    {37, 3, 2, 5},
+    {32, 5, 23, 6},
+    {48, 5, 0, 11773},
+    {681, 2, 25, 11772},
+    {34, 5, 23, 6},
+    {442987, 1, 27, 4},
+    {9955, 0, 0, 11834},
+    {47, 5, 0, 11831},
+    {69220, 1, 0, 11781},
+    {40, 3, 0, 11779},
+    {42248, 1, 27, 7},
+    {43, 5, 2, 4},
+    {9641, 0, 27, 5},
+    {36, 3, 0, 11786},
+    {9704, 0, 2, 7},
+    {9499, 0, 0, 11785},
+    {42, 5, 27, 4},
+    {33, 5, 23, 4},
+    {38, 5, 0, 11806},
+    {289, 2, 0, 11790},
+    {33, 5, 2, 8},
+    {53, 3, 35, 7},
+    {99415, 1, 0, 11792},
+    {31, 5, 27, 5},
+    {9140, 0, 0, 11794},
+    {50, 3, 27, 8},
+    {36, 5, 0, 11805},
+    {9434, 0, 0, 11799},
+    {210806, 1, 33, 11797},
+    {9218, 0, 29, 11798},
+    {32, 5, 35, 7},
+    {573, 2, 33, 11800},
+    {9633, 0, 21, 11801},
+    {29, 5, 21, 11802},
+    {34, 5, 2, 7},
+    {354489, 1, 2, 7},
+    {31, 5, 35, 6},
+    {46, 3, 35, 6},
+    {40, 5, 0, 11814},
+    {39, 5, 0, 11812},
+    {219128, 1, 0, 11810},
+    {40, 3, 27, 8},
+    {395, 2, 33, 11811},
+    {44, 3, 23, 6},
+    {51, 3, 2, 8},
+    {9628, 0, 27, 5},
+    {42, 5, 0, 11821},
+    {41, 5, 0, 11817},
+    {41, 3, 35, 7},
+    {40, 3, 29, 11818},
+    {489, 2, 2, 5},
+    {9126, 0, 33, 11820},
+    {298, 2, 27, 7},
+    {43, 5, 25, 11822},
+    {44, 5, 0, 11825},
+    {40, 3, 2, 8},
+    {9629, 0, 23, 6},
+    {342968, 1, 0, 11830},
+    {46, 5, 0, 11829},
+    {42, 3, 25, 11828},
+    {9148, 0, 23, 7},
+    {9561, 0, 23, 6},
+    {697, 2, 27, 8},
+    {509, 2, 21, 11832},
+    {49, 5, 29, 11833},
+    {525, 2, 31, 5},
+    {36, 5, 0, 11845},
+    {36, 3, 0, 11838},
+    {10548, 0, 29, 11837},
+    {31, 5, 35, 6},
+    {892, 2, 2, 7},
+    {10414, 0, 2, 5},
+    {408, 2, 0, 11844},
+    {121495, 1, 0, 11843},
+    {10070, 0, 31, 6},
+    {33, 5, 35, 5},
+    {10408, 0, 23, 7},
+    {49, 5, 0, 11932},
+    {352643, 1, 0, 11923},
+    {544, 2, 0, 11904},
+    {56, 3, 0, 11895},
+    {73807, 1, 0, 11863},
+    {58749, 1, 2, 4},
+    {54, 3, 0, 11862},
+    {10663, 0, 0, 11854},
+    {10285, 0, 19, 5},
+    {41, 5, 0, 11857},
+    {52, 3, 2, 6},
+    {50, 3, 27, 5},
+    {416, 2, 2, 8},
+    {43932, 1, 2, 8},
+    {50, 3, 25, 11860},
+    {52, 3, 21, 11861},
+    {45, 5, 23, 6},
+    {11430, 0, 23, 4},
+    {11571, 0, 0, 11893},
+    {55, 3, 0, 11890},
+    {492, 2, 0, 11889},
+    {281, 2, 0, 11869},
+    {52, 3, 33, 11868},
+    {42, 5, 27, 7},
+    {308, 2, 0, 11873},
+    {311186, 1, 0, 11872},
+    {10927, 0, 23, 7},
+    {45, 5, 23, 4},
+    {388, 2, 0, 11879},
+    {10558, 0, 2, 7},
+    {45, 5, 2, 6},
+    {45, 3, 29, 11877},
+    {51, 3, 21, 11878},
+    {10449, 0, 31, 5},
+    {53, 3, 0, 11887},
+    {10424, 0, 0, 11882},
+    {410, 2, 31, 6},
+    {479, 2, 2, 6},
+    {40, 5, 21, 11884},
+    {51, 3, 21, 11885},
+    {52, 3, 25, 11886},
+    {10800, 0, 23, 6},
+    {10889, 0, 2, 7},
+    {44, 5, 27, 7},
+    {46, 5, 23, 6},
+    {289268, 1, 2, 5},
+    {126346, 1, 29, 11892},
+    {10872, 0, 31, 8},
+    {47, 5, 2, 8},
+    {38, 5, 35, 7},
+    {263338, 1, 2, 5},
+    {48, 5, 0, 11903},
+    {58, 3, 0, 11902},
+    {57, 3, 0, 11900},
+    {10523, 0, 23, 6},
+    {10752, 0, 2, 5},
+    {39, 5, 27, 7},
+    {13745, 0, 23, 6},
+    {11290, 0, 27, 4},
+    {697, 2, 0, 11913},
+    {10754, 0, 21, 11906},
+    {42, 5, 0, 11910},
+    {41, 5, 2, 5},
+    {55, 3, 21, 11909},
+    {39, 5, 19, 6},
+    {45, 5, 25, 11911},
+    {47, 5, 21, 11912},
+    {11154, 0, 27, 5},
+    {711, 2, 0, 11915},
+    {51405, 1, 27, 7},
+    {53, 3, 0, 11918},
+    {52, 3, 2, 7},
+    {42, 5, 23, 6},
+    {153508, 1, 21, 11919},
+    {48, 5, 0, 11922},
+    {55, 3, 25, 11921},
+    {11886, 0, 23, 6},
+    {801, 2, 27, 4},
+    {372072, 1, 0, 11927},
+    {556, 2, 0, 11926},
+    {39, 5, 19, 6},
+    {10829, 0, 19, 5},
+    {44, 5, 0, 11931},
+    {617, 2, 2, 5},
+    {393875, 1, 2, 5},
+    {42, 5, 27, 5},
+    {387914, 1, 23, 6},
+    {51, 5, 0, 11945},
+    {50, 5, 0, 11944},
+    {406, 2, 0, 11940},
+    {317, 2, 0, 11939},
+    {53, 3, 33, 11937},
+    {272, 2, 17, 11938},
+    {54, 3, 27, 5},
+    {10642, 0, 23, 7},
+    {536, 2, 0, 11942},
+    {10653, 0, 31, 5},
+    {567, 2, 17, 11943},
+    {372926, 1, 23, 4},
+    {11550, 0, 23, 7},
+    {513, 2, 29, 11946},
+    {161978, 1, 31, 5},
+    {51, 5, 2, 5},
+    {902, 2, 17, 11949},
+    {50, 3, 0, 11955},
+    {439844, 1, 2, 6},
+    {331998, 1, 21, 11952},
+    {1152, 2, 21, 11953},
+    {43, 5, 2, 4},
+    {38, 5, 19, 5},
+    {10582, 0, 2, 5},
+    {326071, 1, 23, 4},
+    {32, 5, 0, 11988},
+    {72, 3, 0, 11982},
+    {65, 3, 0, 11963},
+    {287, 2, 25, 11961},
+    {26, 5, 2, 5},
+    {382, 2, 27, 5},
+    {27, 5, 0, 11968},
+    {23, 5, 5, 11965},
+    {25, 5, 2, 5},
+    {9114, 0, 2, 3},
+    {7637, 0, 27, 5},
+    {28, 5, 0, 11970},
+    {70, 3, 23, 4},
+    {227, 2, 0, 11979},
+    {154, 2, 2, 4},
+    {71, 3, 2, 5},
+    {31, 5, 0, 11977},
+    {70, 3, 0, 11976},
+    {7707, 0, 23, 4},
+    {9849, 0, 23, 4},
+    {68, 3, 21, 11978},
+    {8624, 0, 23, 4},
+    {252, 2, 13, 11980},
+    {179774, 1, 2, 4},
+    {560, 2, 23, 6},
+    {255809, 1, 0, 11987},
+    {31, 5, 21, 11984},
+    {1, 2, 0, 11986},
+    {5798, 1, 27, 5},
+    {7691, 0, 23, 6},
+    {30, 5, 23, 6},
+    {2, 2, 0, 11999},
+    {283207, 1, 2, 6},
+    {145096, 1, 0, 11997},
+    {34, 5, 2, 6},
+    {69, 3, 0, 11994},
+    {8890, 0, 19, 6},
+    {33, 5, 0, 11996},
+    {41311, 1, 23, 4},
+    {52646, 1, 23, 4},
+    {10276, 0, 21, 11998},
+    {38, 5, 27, 5},
+    {42, 5, 0, 12055},
+    {71, 3, 0, 12029},
+    {8367, 0, 0, 12008},
+    {67, 3, 0, 12005},
+    {64, 3, 25, 12004},
+    {7586, 0, 27, 5},
+    {129992, 1, 21, 12006},
+    {69, 3, 17, 12007},
+    {35, 5, 23, 4},
+    {35, 5, 0, 12021},
+    {65, 3, 0, 12011},
+    {9619, 0, 19, 5},
+    {68, 3, 0, 12016},
+    {67, 3, 21, 12013},
+    {235233, 1, 2, 4},
+    {33, 5, 2, 5},
+    {189485, 1, 23, 6},
+    {33, 5, 21, 12017},
+    {162125, 1, 2, 6},
+    {34, 5, 0, 12020},
+    {10690, 0, 23, 6},
+    {66478, 1, 27, 5},
+    {11386, 0, 25, 12022},
+    {65, 3, 0, 12027},
+    {138440, 1, 0, 12026},
+    {63324, 1, 2, 6},
+    {40, 5, 23, 6},
+    {167571, 1, 19, 5},
+    {41, 5, 2, 6},
+    {267837, 1, 23, 6},
+    {79, 3, 0, 12038},
+    {1075, 2, 0, 12037},
+    {75, 3, 2, 6},
+    {405, 2, 0, 12034},
+    {8162, 0, 23, 6},
+    {10687, 0, 2, 6},
+    {8460, 0, 25, 12036},
+    {181140, 1, 27, 5},
+    {36, 5, 27, 5},
+    {26, 2, 21, 12039},
+    {292, 2, 0, 12041},
+    {8181, 0, 19, 6},
+    {763, 2, 0, 12049},
+    {322618, 1, 0, 12048},
+    {8055, 0, 0, 12045},
+    {38, 5, 23, 6},
+    {9884, 0, 2, 4},
+    {9463, 0, 2, 6},
+    {8825, 0, 27, 5},
+    {506, 2, 23, 4},
+    {37, 5, 25, 12050},
+    {346147, 1, 25, 12051},
+    {9733, 0, 2, 5},
+    {1126, 2, 2, 5},
+    {475568, 1, 25, 12054},
+    {40, 5, 19, 6},
+    {47, 5, 0, 12067},
+    {224945, 1, 21, 12057},
+    {46, 5, 0, 12064},
+    {64, 3, 0, 12060},
+    {44, 5, 19, 5},
+    {43, 5, 0, 12062},
+    {910, 2, 27, 5},
+    {66, 3, 25, 12063},
+    {361523, 1, 23, 6},
+    {770, 2, 2, 6},
+    {534, 2, 2, 5},
+    {387, 2, 23, 6},
+    {50, 5, 0, 12079},
+    {49, 5, 0, 12071},
+    {48, 5, 21, 12070},
+    {414392, 1, 23, 6},
+    {79, 3, 0, 12077},
+    {15394, 0, 2, 4},
+    {66, 3, 2, 5},
+    {64, 3, 0, 12076},
+    {62, 3, 19, 5},
+    {693, 2, 27, 5},
+    {888, 2, 25, 12078},
+    {344109, 1, 23, 4},
+    {854, 2, 19, 5},
+    {35, 3, 0, 12136},
+    {46237, 1, 0, 12088},
+    {1746, 2, 0, 12086},
+    {45261, 1, 29, 12084},
+    {11839, 0, 2, 7},
+    {31, 5, 19, 2},
+    {30, 3, 2, 3},
+    {42323, 1, 23, 7},
+    {2102, 2, 0, 12113},
+    {31, 3, 0, 12106},
+    {12881, 0, 0, 12101},
+    {10277, 0, 21, 12092},
+    {23, 3, 0, 12099},
+    {259070, 1, 0, 12096},
+    {1796, 2, 21, 12095},
+    {1877, 2, 15, 5},
+    {11430, 0, 0, 12098},
+    {32, 5, 19, 2},
+    {27, 5, 15, 4},
+    {221098, 1, 2, 3},
+    {38, 5, 19, 3},
+    {36, 5, 0, 12104},
+    {13324, 0, 2, 4},
+    {31, 5, 27, 7},
+    {46, 5, 21, 12105},
+    {49, 5, 27, 5},
+    {327452, 1, 0, 12110},
+    {1507, 2, 2, 5},
+    {11612, 0, 2, 5},
+    {47, 5, 19, 2},
+    {42, 5, 0, 12112},
+    {39, 5, 19, 3},
+    {49, 5, 19, 2},
+    {57529, 2, 2, 6},
+    {12106, 0, 0, 12133},
+    {2720, 2, 0, 12118},
+    {125900, 1, 2, 3},
+    {37, 5, 19, 5},
+    {15701, 2, 0, 12132},
+    {8620, 2, 0, 12130},
+    {8728, 0, 0, 12122},
+    {7733, 0, 23, 4},
+    {2920, 2, 0, 12127},
+    {247592, 1, 0, 12125},
+    {10918, 0, 15, 5},
+    {30, 3, 21, 12126},
+    {35, 5, 19, 5},
+    {32, 3, 13, 12128},
+    {215255, 1, 2, 3},
+    {10366, 0, 23, 3},
+    {9667, 0, 21, 12131},
+    {38, 5, 19, 5},
+    {424680, 1, 15, 4},
+    {12705, 0, 21, 12134},
+    {5242, 2, 2, 5},
+    {35, 5, 19, 2},
+    {51, 5, 0, 12263},
+    {28, 5, 0, 12139},
+    {1316, 2, 27, 5},
+    {38, 5, 0, 12184},
+    {34, 5, 0, 12156},
+    {66, 3, 2, 5},
+    {40, 3, 0, 12145},
+    {8873, 0, 2, 5},
+    {8356, 0, 23, 6},
+    {337106, 1, 0, 12155},
+    {54, 3, 0, 12153},
+    {30, 5, 0, 12152},
+    {117487, 1, 25, 12149},
+    {1780, 2, 21, 12150},
+    {266549, 1, 2, 4},
+    {211110, 1, 19, 5},
+    {1679, 2, 27, 5},
+    {30, 5, 2, 4},
+    {2290, 2, 19, 6},
+    {33, 5, 23, 6},
+    {37, 5, 0, 12178},
+    {86, 3, 2, 5},
+    {39, 3, 0, 12161},
+    {11796, 0, 21, 12160},
+    {13196, 0, 27, 4},
+    {36, 5, 0, 12172},
+    {9224, 0, 0, 12168},
+    {35, 5, 0, 12165},
+    {3194, 2, 27, 4},
+    {353158, 1, 2, 6},
+    {243150, 1, 2, 4},
+    {8493, 0, 19, 5},
+    {35, 5, 0, 12171},
+    {9888, 0, 21, 12170},
+    {50, 3, 19, 5},
+    {14898, 0, 19, 6},
+    {13219, 0, 2, 6},
+    {57, 3, 0, 12175},
+    {411821, 1, 19, 5},
+    {93721, 1, 0, 12177},
+    {67, 3, 23, 4},
+    {9561, 0, 19, 6},
+    {4351, 2, 0, 12182},
+    {1585, 2, 2, 5},
+    {10950, 0, 25, 12181},
+    {11988, 0, 23, 6},
+    {48, 3, 2, 4},
+    {195517, 1, 19, 5},
+    {43, 5, 0, 12210},
+    {71, 3, 0, 12194},
+    {40, 5, 2, 5},
+    {61, 3, 0, 12192},
+    {39, 5, 2, 5},
+    {260612, 1, 21, 12190},
+    {313447, 1, 25, 12191},
+    {8939, 0, 19, 5},
+    {1941, 2, 21, 12193},
+    {2376, 2, 19, 6},
+    {10512, 0, 0, 12204},
+    {9046, 0, 0, 12198},
+    {41, 5, 2, 5},
+    {40, 5, 23, 6},
+    {162520, 1, 2, 5},
+    {122591, 1, 2, 6},
+    {74, 3, 25, 12201},
+    {40, 5, 17, 12202},
+    {42, 5, 21, 12203},
+    {83, 3, 19, 6},
+    {40, 5, 0, 12207},
+    {11266, 0, 25, 12206},
+    {39, 5, 23, 4},
+    {42, 5, 2, 5},
+    {78, 3, 2, 6},
+    {251735, 1, 23, 6},
+    {9143, 0, 0, 12220},
+    {446660, 1, 0, 12219},
+    {70, 3, 0, 12215},
+    {7724, 0, 2, 4},
+    {56, 3, 23, 4},
+    {77, 3, 25, 12216},
+    {79, 3, 0, 12218},
+    {8097, 0, 27, 5},
+    {8921, 0, 27, 4},
+    {49, 3, 23, 6},
+    {4551, 2, 0, 12257},
+    {50, 5, 2, 5},
+    {2080, 2, 0, 12233},
+    {47, 5, 21, 12224},
+    {1744, 2, 0, 12232},
+    {50121, 1, 21, 12226},
+    {48, 5, 21, 12227},
+    {49, 5, 25, 12228},
+    {69, 3, 21, 12229},
+    {10160, 0, 21, 12230},
+    {78, 3, 2, 4},
+    {136247, 1, 19, 6},
+    {2054, 2, 23, 6},
+    {48, 5, 0, 12242},
+    {45, 5, 21, 12235},
+    {54, 3, 0, 12241},
+    {45, 3, 2, 5},
+    {14253, 0, 2, 4},
+    {46, 5, 21, 12239},
+    {2635, 2, 25, 12240},
+    {10571, 0, 23, 6},
+    {3688, 2, 27, 4},
+    {49, 5, 0, 12251},
+    {11788, 0, 0, 12250},
+    {10998, 0, 2, 5},
+    {75, 3, 2, 6},
+    {10257, 0, 0, 12248},
+    {247981, 1, 23, 4},
+    {2774, 2, 17, 12249},
+    {10570, 0, 27, 5},
+    {48, 3, 23, 4},
+    {45, 3, 0, 12253},
+    {3186, 2, 27, 5},
+    {2467, 2, 2, 5},
+    {62, 3, 0, 12256},
+    {310234, 1, 23, 6},
+    {11855, 0, 27, 4},
+    {51, 3, 0, 12260},
+    {44, 3, 17, 12259},
+    {48, 3, 27, 4},
+    {45, 5, 0, 12262},
+    {44, 5, 23, 4},
+    {49, 5, 27, 5},
+    {2191, 2, 2, 5},
+    {75, 3, 23, 4},
+};
+
+} // namespace aenc
+
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
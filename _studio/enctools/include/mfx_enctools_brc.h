@@ -24,6 +24,7 @@
 #include "mfxdefs.h"
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <algorithm>
 #include "mfx_enctools_utils.h"
 #include <climits>
@@ -455,16 +456,18 @@ public:
         m_maxWinBits(maxBitPerFrame*windowSize),
         m_maxWinBitsLim(0),
         m_avgBitPerFrame(std::min(avgBitPerFrame, maxBitPerFrame)),
-        m_currPosInWindow(windowSize - 1),
+        m_currPosInWindow(0),
         m_lastFrameOrder(mfxU32(-1)),
         m_bLA(bLA)
 
     {
         windowSize = windowSize > 0 ? windowSize : 1; // kw
-        m_slidingWindow.resize(windowSize);
+        m_sumBits.resize(windowSize + 1);
+        m_sumBitsSkip.resize(windowSize + 1);
         for (mfxU32 i = 0; i < windowSize; i++)
         {
-            m_slidingWindow[i] = maxBitPerFrame / 3; //initial value to prevent big first frames
+            m_currPosInWindow++;
+            SetLastFrameBits(maxBitPerFrame / 3); //initial value to prevent big first frames
         }
         m_maxWinBitsLim = GetMaxWinBitsLim();
     }
@@ -474,15 +477,15 @@ public:
     }
     void UpdateSlidingWindow(mfxU32  sizeInBits, mfxU32  FrameOrder, bool bPanic, bool bSH, mfxU32 recode, mfxU32 /* qp */)
     {
-        mfxU32 windowSize = (mfxU32)m_slidingWindow.size();
+        mfxU32 windowSize = GetWindowSize();
         bool   bNextFrame = FrameOrder != m_lastFrameOrder;
 
         if (bNextFrame)
         {
             m_lastFrameOrder = FrameOrder;
-            m_currPosInWindow = (m_currPosInWindow + 1) % windowSize;
+            m_currPosInWindow = (m_currPosInWindow + 1) % (mfxU32)m_sumBits.size();
         }
-        m_slidingWindow[m_currPosInWindow] = sizeInBits;
+        SetLastFrameBits(sizeInBits);
 
         if (bNextFrame)
         {
@@ -522,13 +525,13 @@ public:
 
     mfxU32 GetWindowSize() const
     {
-        return (mfxU32)m_slidingWindow.size();
+        return (mfxU32)m_sumBits.size() - 1;
     }
 
     mfxI32 GetBudget(mfxU32 numFrames) const
     {
-        numFrames = std::min(mfxU32(m_slidingWindow.size()), numFrames);
-        return ((mfxI32)m_maxWinBitsLim - (mfxI32)GetLastFrameBits((mfxU32)m_slidingWindow.size() - numFrames, true));
+        numFrames = std::min(GetWindowSize(), numFrames);
+        return ((mfxI32)m_maxWinBitsLim - (mfxI32)GetLastFrameBits(GetWindowSize() - numFrames, true));
     }
 
 protected:
@@ -540,22 +543,28 @@ protected:
     mfxU32                      m_currPosInWindow;
     mfxU32                      m_lastFrameOrder;
     bool                        m_bLA;
-    std::vector<mfxU32>         m_slidingWindow;
 
+    // Running sums of frame sizes in a ring of window size + 1, the sum of the last N frames
+    // is the difference of two entries. Skip variant has sizes clamped to m_avgBitPerFrame / 3
+    std::vector<mfxU32>         m_sumBits;
+    std::vector<mfxU32>         m_sumBitsSkip;
+
+    void SetLastFrameBits(mfxU32 sizeInBits)
+    {
+        mfxU32 prevPos = (m_currPosInWindow + (mfxU32)m_sumBits.size() - 1) % (mfxU32)m_sumBits.size();
+
+        m_sumBits[m_currPosInWindow]     = m_sumBits[prevPos] + sizeInBits;
+        m_sumBitsSkip[m_currPosInWindow] = m_sumBitsSkip[prevPos] + std::max(sizeInBits, m_avgBitPerFrame / 3);
+    }
 
     mfxU32 GetLastFrameBits(mfxU32 numFrames, bool bCheckSkip) const
     {
-        mfxU32 size = 0;
-        numFrames = numFrames < m_slidingWindow.size() ? numFrames : (mfxU32)m_slidingWindow.size();
-        for (mfxU32 i = 0; i < numFrames; i++)
-        {
-            mfxU32 frame_size = m_slidingWindow[(m_currPosInWindow + m_slidingWindow.size() - i) % m_slidingWindow.size()];
-            if (bCheckSkip && (frame_size < m_avgBitPerFrame / 3))
-                frame_size = m_avgBitPerFrame / 3;
-            size += frame_size;
-            //printf("GetLastFrames: %d) %d sum %d\n",i,m_slidingWindow[(m_currPosInWindow + m_slidingWindow.size() - i) % m_slidingWindow.size() ], size);
-        }
-        return size;
+        numFrames = std::min(numFrames, GetWindowSize());
+        mfxU32 firstPos = (m_currPosInWindow + (mfxU32)m_sumBits.size() - numFrames) % (mfxU32)m_sumBits.size();
+
+        // unsigned wrap-around gives the same result as summation of the frames
+        const std::vector<mfxU32> & sumBits = bCheckSkip ? m_sumBitsSkip : m_sumBits;
+        return sumBits[m_currPosInWindow] - sumBits[firstPos];
     }
     mfxU32 GetStep() const
     {
@@ -592,7 +601,7 @@ public:
     {
         m_bInit = false;
         m_bDynamicInit = false;
-        m_FrameStruct.resize(0);
+        m_FrameStruct.clear();
     }
 
     mfxStatus ReportEncResult(mfxU32 dispOrder, mfxEncToolsBRCEncodeResult const & pEncRes) override;
@@ -614,7 +623,7 @@ protected:
     std::unique_ptr<AVGBitrate> m_avg;
     mfxU32     m_SkipCount;
     mfxU32     m_ReEncodeCount;
-    std::vector<BRC_FrameStruct> m_FrameStruct;
+    std::unordered_map<mfxU32, BRC_FrameStruct> m_FrameStruct; // frames in flight by display order
 
     virtual mfxU16 FillQpMap(const BRC_FrameStruct&, mfxU32 /*frameQp*/, mfxEncToolsHintQPMap*, mfxI16&) = 0;
 
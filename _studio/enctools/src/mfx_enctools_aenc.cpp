@@ -28,6 +28,7 @@
 
 mfxStatus AEncInit(mfxHDL*, AEncParam) { return MFX_ERR_UNSUPPORTED; }
 mfxStatus AEncProcessFrame(mfxHDL, mfxU32, mfxU8*, mfxI32, AEncFrame*) { return MFX_ERR_UNSUPPORTED; }
+mfxStatus AEncProcessFrames(mfxHDL, mfxU32, const mfxU32*, mfxU8* const*, mfxI32, AEncFrame*, mfxU32*) { return MFX_ERR_UNSUPPORTED; }
 void AEncUpdateFrame(mfxHDL, mfxU32, mfxU32, mfxU32, mfxU32) {}
 void AEncClose(mfxHDL) {}
 mfxU16 AEncGetIntraDecision(mfxHDL, mfxU32) { return 0; }
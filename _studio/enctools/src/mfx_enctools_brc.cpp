@@ -77,13 +77,6 @@ static mfxF64 LTR_BUF(mfxU16 type, mfxU32 dqp, bool boost, bool schg, bool shstr
 
 namespace EncToolsBRC {
 
-struct CompareByDisplayOrder
-{
-    mfxU32 m_DispOrder;
-    CompareByDisplayOrder(mfxU32 frameOrder) : m_DispOrder(frameOrder) {}
-    bool operator ()(BRC_FrameStruct const & frameStruct) const { return frameStruct.dispOrder == m_DispOrder; }
-};
-
 static mfxU32 hevcBitRateScale(mfxU32 bitrate)
 {
     mfxU32 bit_rate_scale = 0;
@@ -970,6 +963,7 @@ mfxStatus BRC_EncToolBase::Init(mfxEncToolsCtrl const & ctrl, bool bMBBRC, bool
 
     }
     m_ctx = {};
+    m_FrameStruct.reserve(m_par.mLaDepth + MAX_GOP_REFDIST + 1);
 
     m_ctx.fAbLong = m_par.inputBitsPerFrame;
     m_ctx.fAbShort = m_par.inputBitsPerFrame;
@@ -1044,17 +1038,17 @@ mfxStatus BRC_EncToolBase::UpdateFrame(mfxU32 dispOrder, mfxEncToolsBRCStatus *p
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
     MFX_CHECK_NULL_PTR1(pFrameSts);
 
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStructItr = m_FrameStruct.find(dispOrder);
     if (frameStructItr == m_FrameStruct.end())
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC hasn't processed the frame
 
-    BRC_FrameStruct frameStruct = *frameStructItr;
+    BRC_FrameStruct frameStruct = frameStructItr->second;
 
     mfxI32 bitsEncoded = frameStruct.frameSize * 8;
     mfxI32 qpY = frameStruct.qp + m_par.quantOffset;
-    if (frameStructItr->QpMapNZ)
+    if (frameStructItr->second.QpMapNZ)
     {
-        qpY = mfx::clamp((mfxI32)qpY - frameStructItr->QpMapBias, 1, 51);
+        qpY = mfx::clamp((mfxI32)qpY - frameStructItr->second.QpMapBias, 1, 51);
     }
     mfxI32 layer = frameStruct.pyrLayer;
     mfxU16 picType = GetFrameType(frameStruct.frameType, frameStruct.pyrLayer, m_par.gopRefDist, m_par.codecId);
@@ -1608,10 +1602,10 @@ mfxStatus BRC_EncToolBase::GetHRDPos(mfxU32 dispOrder, mfxEncToolsBRCHRDPos *pHR
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
     MFX_CHECK_NULL_PTR1(pHRDPos);
 
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStructItr = m_FrameStruct.find(dispOrder);
     if (frameStructItr == m_FrameStruct.end())
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC hasn't processed the frame
-    BRC_FrameStruct frameStruct = *frameStructItr;
+    BRC_FrameStruct frameStruct = frameStructItr->second;
 
     if (m_par.HRDConformance != MFX_BRC_NO_HRD)
     {
@@ -1622,7 +1616,7 @@ mfxStatus BRC_EncToolBase::GetHRDPos(mfxU32 dispOrder, mfxEncToolsBRCHRDPos *pHR
 }
 
 mfxStatus BRC_EncToolBase::DiscardFrame(mfxU32 dispOrder){
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStructItr = m_FrameStruct.find(dispOrder);
     if(frameStructItr != m_FrameStruct.end()){
         m_FrameStruct.erase(frameStructItr);
     }
@@ -1699,10 +1693,10 @@ mfxStatus BRC_EncToolBase::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantCon
     MFX_CHECK(m_bInit, MFX_ERR_NOT_INITIALIZED);
     MFX_CHECK_NULL_PTR1(pFrameQp);
 
-    auto frameStructItr = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStructItr = m_FrameStruct.find(dispOrder);
     if (frameStructItr == m_FrameStruct.end())
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC hasn't processed the frame
-    BRC_FrameStruct frameStruct = *frameStructItr;
+    BRC_FrameStruct frameStruct = frameStructItr->second;
 
     mfxU16 ParSceneChange = frameStruct.sceneChange;
     mfxU16 ParLongTerm = frameStruct.longTerm;
@@ -1737,7 +1731,7 @@ mfxStatus BRC_EncToolBase::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantCon
         HRDDev = m_hrdSpec->GetBufferDeviation(frameStruct.encOrder);
         maxFrameSizeHrd = m_hrdSpec->GetMaxFrameSizeInBits(frameStruct.encOrder, bIdr);
     }
-    frameStructItr->origSeqQp = GetCurQP(MFX_FRAMETYPE_P, frameStruct.pyrLayer, isRef, ParQpModulation, frameStruct.QPDeltaExplicitModulation, ParQpDeltaP);
+    frameStructItr->second.origSeqQp = GetCurQP(MFX_FRAMETYPE_P, frameStruct.pyrLayer, isRef, ParQpModulation, frameStruct.QPDeltaExplicitModulation, ParQpDeltaP);
     if (!m_bDynamicInit) {
         if (isIntra) {
             // Init DQP
@@ -2123,10 +2117,10 @@ mfxStatus BRC_EncToolBase::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantCon
     pFrameQp->NumDeltaQP = 0;
 
     // PAQ QpMapNZ & QpMap Average return by Base FillQpMap, other implementations can override these.
-    frameStructItr->QpMapNZ = FillQpMap(*frameStructItr, pFrameQp->QpY, qpMapHint, frameStructItr->QpMapBias);
-    if (frameStructItr->QpMapNZ) 
+    frameStructItr->second.QpMapNZ = FillQpMap(frameStructItr->second, pFrameQp->QpY, qpMapHint, frameStructItr->second.QpMapBias);
+    if (frameStructItr->second.QpMapNZ) 
     {
-        pFrameQp->QpY = mfx::clamp((mfxI32)pFrameQp->QpY + frameStructItr->QpMapBias, 1, 51); // Allow slice Qp to change 1-51 for lambda
+        pFrameQp->QpY = mfx::clamp((mfxI32)pFrameQp->QpY + frameStructItr->second.QpMapBias, 1, 51); // Allow slice Qp to change 1-51 for lambda
     }
 
     return MFX_ERR_NONE;
@@ -2135,21 +2129,21 @@ mfxStatus BRC_EncToolBase::ProcessFrame(mfxU32 dispOrder, mfxEncToolsBRCQuantCon
 
 mfxStatus BRC_EncToolBase::ReportEncResult(mfxU32 dispOrder, mfxEncToolsBRCEncodeResult const & pEncRes)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStruct = m_FrameStruct.find(dispOrder);
     if (frameStruct == m_FrameStruct.end())
     {
         return MFX_ERR_UNDEFINED_BEHAVIOR; // BRC gets encoding results for the frame it hasn't set QP for
     }
-    (*frameStruct).frameSize = pEncRes.CodedFrameSize;
-    (*frameStruct).qp = pEncRes.QpY;
-    (*frameStruct).numRecode = pEncRes.NumRecodesDone;
+    frameStruct->second.frameSize = pEncRes.CodedFrameSize;
+    frameStruct->second.qp = pEncRes.QpY;
+    frameStruct->second.numRecode = pEncRes.NumRecodesDone;
     return MFX_ERR_NONE;
 }
 
 
 mfxStatus BRC_EncToolBase::SetFrameStruct(mfxU32 dispOrder, mfxEncToolsBRCFrameParams  const & pFrameStruct)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStruct = m_FrameStruct.find(dispOrder);
     if (frameStruct == m_FrameStruct.end())
     {
         BRC_FrameStruct frStruct;
@@ -2162,20 +2156,19 @@ mfxStatus BRC_EncToolBase::SetFrameStruct(mfxU32 dispOrder, mfxEncToolsBRCFrameP
         frStruct.frameCmplx = pFrameStruct.SpatialComplexity;
         frStruct.PersistenceMapNZ = pFrameStruct.PersistenceMapNZ;
         memcpy(frStruct.PersistenceMap, pFrameStruct.PersistenceMap, sizeof(frStruct.PersistenceMap));
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.emplace(dispOrder, frStruct);
     }
     else
     {
-        (*frameStruct).frameType = pFrameStruct.FrameType;
-        (*frameStruct).pyrLayer = pFrameStruct.PyramidLayer;
-        (*frameStruct).encOrder = pFrameStruct.EncodeOrder; // or check if it's the same, otherwise - error ?
-        (*frameStruct).numRecode++;  // ??? check
-        (*frameStruct).longTerm = pFrameStruct.LongTerm;
-        (*frameStruct).sceneChange = pFrameStruct.SceneChange;
-        (*frameStruct).frameCmplx = pFrameStruct.SpatialComplexity;
-        (*frameStruct).PersistenceMapNZ = pFrameStruct.PersistenceMapNZ;
-        memcpy((*frameStruct).PersistenceMap, pFrameStruct.PersistenceMap, sizeof((*frameStruct).PersistenceMap));
+        frameStruct->second.frameType = pFrameStruct.FrameType;
+        frameStruct->second.pyrLayer = pFrameStruct.PyramidLayer;
+        frameStruct->second.encOrder = pFrameStruct.EncodeOrder; // or check if it's the same, otherwise - error ?
+        frameStruct->second.numRecode++;  // ??? check
+        frameStruct->second.longTerm = pFrameStruct.LongTerm;
+        frameStruct->second.sceneChange = pFrameStruct.SceneChange;
+        frameStruct->second.frameCmplx = pFrameStruct.SpatialComplexity;
+        frameStruct->second.PersistenceMapNZ = pFrameStruct.PersistenceMapNZ;
+        memcpy(frameStruct->second.PersistenceMap, pFrameStruct.PersistenceMap, sizeof(frameStruct->second.PersistenceMap));
 
     }
     return MFX_ERR_NONE;
@@ -2183,7 +2176,7 @@ mfxStatus BRC_EncToolBase::SetFrameStruct(mfxU32 dispOrder, mfxEncToolsBRCFrameP
 
 mfxStatus BRC_EncToolBase::ReportBufferHints(mfxU32 dispOrder, mfxEncToolsBRCBufferHint const & pBufHints)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStruct = m_FrameStruct.find(dispOrder);
     if (frameStruct == m_FrameStruct.end())
     {
         BRC_FrameStruct frStruct;
@@ -2191,21 +2184,20 @@ mfxStatus BRC_EncToolBase::ReportBufferHints(mfxU32 dispOrder, mfxEncToolsBRCBuf
         frStruct.LaAvgEncodedSize        = pBufHints.AvgEncodedSizeInBits;
         frStruct.LaCurEncodedSize        = pBufHints.CurEncodedSizeInBits;
         frStruct.LaIDist                 = pBufHints.DistToNextI;
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.emplace(dispOrder, frStruct);
     }
     else
     {
-        (*frameStruct).LaAvgEncodedSize        = pBufHints.AvgEncodedSizeInBits;
-        (*frameStruct).LaCurEncodedSize        = pBufHints.CurEncodedSizeInBits;
-        (*frameStruct).LaIDist                 = pBufHints.DistToNextI;
+        frameStruct->second.LaAvgEncodedSize        = pBufHints.AvgEncodedSizeInBits;
+        frameStruct->second.LaCurEncodedSize        = pBufHints.CurEncodedSizeInBits;
+        frameStruct->second.LaIDist                 = pBufHints.DistToNextI;
     }
     return MFX_ERR_NONE;
 }
 
 mfxStatus BRC_EncToolBase::ReportGopHints(mfxU32 dispOrder, mfxEncToolsHintPreEncodeGOP const & pGopHints)
 {
-    auto frameStruct = std::find_if(m_FrameStruct.begin(), m_FrameStruct.end(), CompareByDisplayOrder(dispOrder));
+    auto frameStruct = m_FrameStruct.find(dispOrder);
     if (frameStruct == m_FrameStruct.end())
     {
         BRC_FrameStruct frStruct;
@@ -2214,15 +2206,14 @@ mfxStatus BRC_EncToolBase::ReportGopHints(mfxU32 dispOrder, mfxEncToolsHintPreEn
         frStruct.qpModulation = pGopHints.QPModulation;
         frStruct.QPDeltaExplicitModulation = pGopHints.QPDeltaExplicitModulation;
         frStruct.miniGopSize = pGopHints.MiniGopSize;
-        m_FrameStruct.push_back(frStruct);
-        frameStruct = m_FrameStruct.end() - 1;
+        m_FrameStruct.emplace(dispOrder, frStruct);
     }
     else
     {
-        (*frameStruct).qpDelta = pGopHints.QPDelta;
-        (*frameStruct).qpModulation = pGopHints.QPModulation;
-        (*frameStruct).QPDeltaExplicitModulation = pGopHints.QPDeltaExplicitModulation;
-        (*frameStruct).miniGopSize = pGopHints.MiniGopSize;
+        frameStruct->second.qpDelta = pGopHints.QPDelta;
+        frameStruct->second.qpModulation = pGopHints.QPModulation;
+        frameStruct->second.QPDeltaExplicitModulation = pGopHints.QPDeltaExplicitModulation;
+        frameStruct->second.miniGopSize = pGopHints.MiniGopSize;
     }
     return MFX_ERR_NONE;
 
@@ -39,74 +39,122 @@
 #include "mfx_vp8_dec_decode_vp8_defs.h"
 #include "mfx_vp8_dec_decode_common.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Boolean entropy decoder for VP8 frame header.
+// Keeps up to 64 bits of the partition in a window which is refilled by whole bytes
+// only when less than a byte is left, normalization shift is taken from count of leading zeros.
+// pos(), bitcount() and value() report the state of a decoder reading one byte per 8 shifts
+// into 32-bit value (what VA expects for the rest of the first partition)
 class MFX_VP8_BoolDecoder
 {
 private:
+    uint64_t m_window;      // arithmetic value, MSB aligned
+    int32_t  m_windowBits;  // number of bitstream bits in window
     uint32_t m_range;
-    uint32_t m_value;
-    int32_t m_bitcount;
-    uint32_t m_pos;
+    uint32_t m_maxShifts;   // shifts after that decode() reports end of data
+    uint32_t m_fillPos;     // next byte to put to window, may go past the end
     uint8_t *m_input;
     int32_t m_input_size;
 
-    static const int range_normalization_shift[64];
-
-    int decode_bit(int probability)
+    static uint32_t count_leading_zeros(uint32_t x)
     {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, x);
+        return 31 - index;
+#else
+        return __builtin_clz(x);
+#endif
+    }
 
-        uint32_t bit = 0;
-        uint32_t split;
-        uint32_t bigsplit;
-        uint32_t count = this->m_bitcount;
-        uint32_t range = this->m_range;
-        uint32_t value = this->m_value;
+    void fill()
+    {
+        uint32_t const size = m_input_size > 0 ? (uint32_t)m_input_size : 0;
 
-        split = 1 +  (((range - 1) * probability) >> 8);
-        bigsplit = (split << 24);
+        if (m_fillPos + 8 <= size)
+        {
+            // take as many whole bytes as fit to window with single load
+            uint64_t next = 0;
+            for (int i = 0; i < 8; i++)
+                next = (next << 8) | m_input[m_fillPos + i];
+
+            uint32_t const bytes = (64 - m_windowBits) >> 3;
+            uint32_t const tail  = 64 - m_windowBits - 8 * bytes;
+
+            m_window     |= (next >> m_windowBits) & ~((uint64_t(1) << tail) - 1);
+            m_windowBits += 8 * bytes;
+            m_fillPos    += bytes;
+            return;
+        }
 
-        range = split;
-        if(value >= bigsplit)
+        // end of the buffer, bits after it are zeros
+        while (m_windowBits <= 56)
         {
-           range = this->m_range - split;
-           value = value - bigsplit;
-           bit = 1;
+            if (m_fillPos < size)
+                m_window |= uint64_t(m_input[m_fillPos]) << (56 - m_windowBits);
+            m_fillPos++;
+            m_windowBits += 8;
         }
+    }
 
-        if(range >= 0x80)
+    // normalization shifts since init
+    uint32_t shifts() const
+    {
+        return 8 * m_fillPos - m_windowBits;
+    }
+
+    // only top 8 bits of the window take part in comparison, so it is refilled
+    // after normalization, the path without normalization does not check it
+    int decode_bit(int probability)
+    {
+        uint32_t const split = 1 + (((m_range - 1) * probability) >> 8);
+        uint64_t const bigsplit = uint64_t(split) << 56;
+
+        uint32_t range = split;
+        int bit = 0;
+        if (m_window >= bigsplit)
         {
-            this->m_value = value;
-            this->m_range = range;
-            return bit;
+            range     = m_range - split;
+            m_window -= bigsplit;
+            bit = 1;
         }
-        else
+
+        if (range >= 0x80)
         {
-            do
-            {
-                range += range;
-                value += value;
-
-                if (!--count)
-                {
-                    count = 8;
-                    value |= static_cast<uint32_t>(this->m_input[this->m_pos]);
-                    this->m_pos++;
-                }
-             }
-             while(range < 0x80);
+            m_range = range;
+            return bit;
         }
-        this->m_bitcount = count;
-        this->m_value = value;
-        this->m_range = range;
+
+        uint32_t const shift = count_leading_zeros(range) - 24;
+
+        m_range       = range << shift;
+        m_window    <<= shift;
+        m_windowBits -= shift;
+
+        if (m_windowBits < 8)
+            fill();
+
         return bit;
+    }
 
+    uint32_t decode_literal()
+    {
+        uint32_t z = 0;
+        for (int bit = 7; bit >= 0; bit--)
+            z |= decode_bit(128) << bit;
+        return z;
     }
 
 public:
     MFX_VP8_BoolDecoder() :
+        m_window(0),
+        m_windowBits(0),
         m_range(0),
-        m_value(0),
-        m_bitcount(0),
-        m_pos(0),
+        m_maxShifts(0),
+        m_fillPos(0),
         m_input(0),
         m_input_size(0)
     {}
@@ -118,14 +166,15 @@ public:
 
     void init(uint8_t *pBitStream, int32_t dataSize)
     {
-        m_range = 255;
-        m_bitcount = 8;
-        m_pos = 0;
-        m_value = (pBitStream[0] << 24) + (pBitStream[1] << 16) +
-                  (pBitStream[2] << 8) + pBitStream[3];
-        m_pos += 4;
-        m_input     = pBitStream;
+        m_window     = 0;
+        m_windowBits = 0;
+        m_range      = 255;
+        m_maxShifts  = dataSize > 4 ? 8 * uint32_t(dataSize - 4) : 0;
+        m_fillPos    = 0;
+        m_input      = pBitStream;
         m_input_size = dataSize;
+
+        fill();
     }
 
     uint32_t decode(int bits = 1, int prob = 128)
@@ -133,7 +182,7 @@ public:
         uint32_t z = 0;
         int bit;
 
-        if (m_pos >= (uint32_t)m_input_size)
+        if (shifts() >= m_maxShifts)
             throw vp8_exception(MFX_ERR_MORE_DATA);
 
         for (bit = bits - 1; bit >= 0;bit--)
@@ -143,19 +192,46 @@ public:
         return z;
     }
 
+    // Probability updates of the frame header: flag coded with update_probs[i],
+    // if it is set 8-bit literal replaces probs[i]. Most of the flags are 0
+    void decode_prob_updates(uint8_t *probs, const uint8_t *update_probs, uint32_t count)
+    {
+        // work on a copy, so the state is not reloaded after each store to probs
+        MFX_VP8_BoolDecoder bd(*this);
+        uint32_t i = 0;
+
+        // flag and literal take at most 9 * 7 shifts, end of data can't be reached
+        // while there is room for it
+        uint32_t const maxUpdate = 9 * 7;
+        while (i < count && bd.shifts() + maxUpdate < bd.m_maxShifts)
+        {
+            if (bd.decode_bit(update_probs[i]))
+                probs[i] = uint8_t(bd.decode_literal());
+            i++;
+        }
+
+        *this = bd;
+
+        for (; i < count; i++)
+        {
+            if (decode(1, update_probs[i]))
+                probs[i] = uint8_t(decode(8));
+        }
+    }
+
     uint8_t * input()
     {
-        return &m_input[m_pos];
+        return &m_input[pos()];
     }
 
     uint32_t pos() const
     {
-        return m_pos;
+        return 4 + (shifts() >> 3);
     }
 
     int32_t bitcount() const
     {
-        return m_bitcount;
+        return 8 - (shifts() & 7);
     }
 
     uint32_t range() const
@@ -165,7 +241,14 @@ public:
 
     uint32_t value() const
     {
-        return m_value;
+        // window may be short of 32 bits until the next decode_bit()
+        uint64_t window = m_window;
+        uint32_t const size = m_input_size > 0 ? (uint32_t)m_input_size : 0;
+        for (uint32_t bits = m_windowBits, i = m_fillPos; bits < 32 && i < size; bits += 8, i++)
+            window |= uint64_t(m_input[i]) << (56 - bits);
+
+        // bits of the byte not yet due to be read are zeros
+        return uint32_t(window >> 32) & ~((1u << (shifts() & 7)) - 1);
     }
 };
 
@@ -1229,23 +1229,9 @@ mfxStatus VideoDECODEVP8_HW::DecodeFrameHeader(mfxBitstream *in)
         else
             m_refresh_info.refreshLastFrame = 1;
 
-        for (int i = 0; i < VP8_NUM_COEFF_PLANES; i++)
-        {
-            for (int j = 0; j < VP8_NUM_COEFF_BANDS; j++)
-            {
-                for (int k = 0; k < VP8_NUM_LOCAL_COMPLEXITIES; k++)
-                {
-                    for (int l = 0; l < VP8_NUM_COEFF_NODES; l++)
-                    {
-                        mfxU8 prob = vp8_coeff_update_probs[i][j][k][l];
-                        mfxU8 flag = (uint8_t)m_boolDecoder[VP8Defs::VP8_FIRST_PARTITION].decode(1, prob);
-
-                        if (flag)
-                            m_frameProbs.coeff_probs[i][j][k][l] = (uint8_t)m_boolDecoder[VP8_FIRST_PARTITION].decode(8);
-                    }
-                }
-            }
-        }
+        // both tables are [planes][bands][complexities][nodes], updates go in the same order
+        m_boolDecoder[VP8_FIRST_PARTITION].decode_prob_updates(&m_frameProbs.coeff_probs[0][0][0][0],
+            &vp8_coeff_update_probs[0][0][0][0], sizeof(m_frameProbs.coeff_probs));
 
         m_frame_info.mbSkipEnabled = (uint8_t)m_boolDecoder[VP8_FIRST_PARTITION].decode();
         m_frame_info.skipFalseProb = 0;
@@ -1407,15 +1393,4 @@ mfxStatus VideoDECODEVP8_HW::GetSurface(mfxFrameSurface1* & surface, mfxSurfaceH
     return m_surface_source->GetSurface(surface, import_surface);
 }
 
-//////////////////////////////////////////////////////////////////////////////
-// MFX_VP8_BoolDecoder
-
-const int MFX_VP8_BoolDecoder::range_normalization_shift[64] =
-{
-  7, 6, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3,
-  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
-};
-
 #endif //MFX_ENABLE_VP8_VIDEO_DECODE
@@ -56,6 +56,31 @@ MFX_FEATURE_BLOCKS_DECLARE_BQ_UTILS_IN_FEATURE_BLOCK
     #include "av1ehw_block_queues.h"
 #undef DEF_BLOCK_Q
 
+    // called at the end of Init(): per-frame stages run contiguous copies of their queues,
+    // Init/Reset/Close queues stay on the lists. Frozen queues can't be edited until Thaw()
+    void Freeze()
+    {
+        if (m_bFrozen)
+            return;
+        m_fFrameSubmit.Freeze();
+        m_fAsyncRoutine.Freeze();
+        m_fInitTask.Freeze();
+        m_fPreReorderTask.Freeze();
+        m_fPostReorderTask.Freeze();
+        m_fSubmitTask.Freeze();
+        m_fQueryTask.Freeze();
+        m_fFreeTask.Freeze();
+        m_bFrozen = true;
+    }
+
+    void Thaw()
+    {
+#define DEF_BLOCK_Q MFX_FEATURE_BLOCKS_THAW_QUEUES_IN_FEATURE_BLOCK
+    #include "av1ehw_block_queues.h"
+#undef DEF_BLOCK_Q
+        m_bFrozen = false;
+    }
+
     virtual const char* GetFeatureName(mfxU32 featureID) override;
     virtual const char* GetBlockName(ID id) override;
 
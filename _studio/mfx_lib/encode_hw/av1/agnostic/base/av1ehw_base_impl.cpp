@@ -181,9 +181,20 @@ private:
 #endif
 
 mfxStatus MFXVideoENCODEAV1_HW::Init(mfxVideoParam *par)
+{
+    mfxStatus sts = InternalInit(par);
+
+    if (sts >= MFX_ERR_NONE)
+        Freeze();
+
+    return sts;
+}
+
+mfxStatus MFXVideoENCODEAV1_HW::InternalInit(mfxVideoParam *par)
 {
     MFX_CHECK_NULL_PTR1(par);
     MFX_CHECK(m_storage.Empty(), MFX_ERR_UNDEFINED_BEHAVIOR);
+    Thaw();
     mfxStatus sts = MFX_ERR_NONE, wrn = MFX_ERR_NONE;
     StorageRW local, global;
 
@@ -284,7 +295,7 @@ mfxStatus MFXVideoENCODEAV1_HW::EncodeFrameCheck(
             (x < MFX_ERR_NONE && x != MFX_ERR_MORE_DATA_SUBMIT_TASK)
             || x == MFX_WRN_DEVICE_BUSY;
     };
-    sts = RunBlocks(BreakAtSts, BQ<BQ_FrameSubmit>::Get(*this), ctrl, surface, *bs, m_storage, local);
+    sts = RunBlocks(BreakAtSts, BQ<BQ_FrameSubmit>::GetFrozen(*this), ctrl, surface, *bs, m_storage, local);
     MFX_CHECK(!BreakAtSts(sts), sts);
 
     pEntryPoint->pState = this;
@@ -304,7 +315,7 @@ mfxStatus MFXVideoENCODEAV1_HW::Execute(mfxThreadTask ptask, mfxU32 /*uid_p*/, m
 
     auto& task = *(StorageRW*)ptask;
 
-    return RunBlocks(Check<mfxStatus, MFX_ERR_NONE>, BQ<BQ_AsyncRoutine>::Get(*this), m_storage, task);
+    return RunBlocks(Check<mfxStatus, MFX_ERR_NONE>, BQ<BQ_AsyncRoutine>::GetFrozen(*this), m_storage, task);
 }
 
 mfxStatus MFXVideoENCODEAV1_HW::FreeResources(mfxThreadTask /*task*/, mfxStatus /*sts*/)
@@ -319,6 +330,7 @@ mfxStatus MFXVideoENCODEAV1_HW::Close(void)
     auto sts = RunBlocks(IgnoreSts, BQ<BQ_Close>::Get(*this), m_storage);
 
     m_storage.Clear();
+    Thaw();
 
     return sts;
 }
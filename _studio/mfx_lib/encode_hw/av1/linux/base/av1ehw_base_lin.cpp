@@ -77,9 +77,9 @@ Linux::Base::MFXVideoENCODEAV1_HW::MFXVideoENCODEAV1_HW(
     InternalInitFeatures(status, mode);
 }
 
-mfxStatus Linux::Base::MFXVideoENCODEAV1_HW::Init(mfxVideoParam *par)
+mfxStatus Linux::Base::MFXVideoENCODEAV1_HW::InternalInit(mfxVideoParam *par)
 {
-    mfxStatus sts = AV1EHW::Base::MFXVideoENCODEAV1_HW::Init(par);
+    mfxStatus sts = AV1EHW::Base::MFXVideoENCODEAV1_HW::InternalInit(par);
     MFX_CHECK(sts >= MFX_ERR_NONE, sts);
 
     return sts;
@@ -40,7 +40,7 @@ namespace Base
             , mfxStatus& status
             , eFeatureMode mode = eFeatureMode::INIT);
 
-        virtual mfxStatus Init(mfxVideoParam *par) override;
+        virtual mfxStatus InternalInit(mfxVideoParam *par) override;
     };
 
 } //Base
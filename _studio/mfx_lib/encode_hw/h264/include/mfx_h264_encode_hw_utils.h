@@ -22,6 +22,7 @@
 
 #include <vector>
 #include <list>
+#include <map>
 #include <memory>
 #include <algorithm> /* for std::find_if on Linux/Android */
 #include <mfx_brc_common.h>
@@ -1442,8 +1443,143 @@ namespace MfxHwH264Encode
 #endif
     };
 
-    typedef std::list<DdiTask>::iterator DdiTaskIter;
-    typedef std::list<DdiTask>::const_iterator DdiTaskCiter;
+    class DdiTaskQueue;
+
+    // Fixed arena of tasks. Pipeline stages are queues linked through task indices,
+    // so moving a task between stages doesn't copy or allocate and the task keeps its address
+    class DdiTaskPool
+    {
+    public:
+        static const mfxU32 NO_TASK = mfxU32(-1);
+
+        // recreates all tasks and puts them to the 'free' queue, other queues must be cleared
+        void Init(mfxU32 size, DdiTaskQueue & free);
+
+        mfxU32 IndexOf(DdiTask const & task) const
+        {
+            assert(&task >= m_task.data() && &task < m_task.data() + m_task.size());
+            return mfxU32(&task - m_task.data());
+        }
+
+        DdiTaskQueue const * QueueOf(DdiTask const & task) const { return m_link[IndexOf(task)].queue; }
+
+        // index of tasks by frame order, lookup is limited to given queues and
+        // prefers queues in the order they are listed
+        void AddToIndex(DdiTask const & task);
+        void RemoveFromIndex(DdiTask const & task);
+        void ClearIndex() { m_byFrameOrder.clear(); }
+        DdiTask * FindByFrameOrder(mfxU32 frameOrder, std::initializer_list<DdiTaskQueue const *> queues);
+
+    private:
+        friend class DdiTaskQueue;
+
+        struct Link
+        {
+            mfxU32         prev;
+            mfxU32         next;
+            DdiTaskQueue * queue;
+        };
+
+        std::vector<DdiTask>          m_task;
+        std::vector<Link>             m_link;
+        std::multimap<mfxU32, mfxU32> m_byFrameOrder;
+    };
+
+    // std::list-like view of one pipeline stage, size() and splice() are O(1)
+    class DdiTaskQueue
+    {
+    public:
+        class iterator
+        {
+        public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef DdiTask                         value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef DdiTask *                       pointer;
+            typedef DdiTask &                       reference;
+
+            iterator() : m_queue(0), m_idx(DdiTaskPool::NO_TASK) {}
+            iterator(DdiTaskQueue const * queue, mfxU32 idx) : m_queue(queue), m_idx(idx) {}
+
+            DdiTask & operator *() const { return m_queue->m_pool->m_task[m_idx]; }
+            DdiTask * operator ->() const { return &**this; }
+
+            iterator & operator ++() { m_idx = m_queue->m_pool->m_link[m_idx].next; return *this; }
+            iterator & operator --()
+            {
+                m_idx = (m_idx == DdiTaskPool::NO_TASK) ? m_queue->m_tail : m_queue->m_pool->m_link[m_idx].prev;
+                return *this;
+            }
+            iterator operator ++(int) { iterator tmp = *this; ++*this; return tmp; }
+            iterator operator --(int) { iterator tmp = *this; --*this; return tmp; }
+
+            // like std::list iterators these refer to a task and stay valid across splice()
+            bool operator ==(iterator const & other) const { return m_idx == other.m_idx; }
+            bool operator !=(iterator const & other) const { return m_idx != other.m_idx; }
+
+        private:
+            friend class DdiTaskQueue;
+            DdiTaskQueue const * m_queue;
+            mfxU32               m_idx;
+        };
+
+        explicit DdiTaskQueue(DdiTaskPool & pool)
+            : m_pool(&pool)
+            , m_head(DdiTaskPool::NO_TASK)
+            , m_tail(DdiTaskPool::NO_TASK)
+            , m_size(0)
+        {}
+
+        DdiTaskQueue(DdiTaskQueue const &) = delete;
+        DdiTaskQueue & operator =(DdiTaskQueue const &) = delete;
+
+        iterator begin() const { return iterator(this, m_head); }
+        iterator end() const   { return iterator(this, DdiTaskPool::NO_TASK); }
+        DdiTask & front() const { assert(m_size); return m_pool->m_task[m_head]; }
+        DdiTask & back() const  { assert(m_size); return m_pool->m_task[m_tail]; }
+        bool   empty() const { return m_size == 0; }
+        mfxU32 size() const  { return m_size; }
+
+        iterator iterator_to(DdiTask const & task) const
+        {
+            assert(m_pool->QueueOf(task) == this);
+            return iterator(this, m_pool->IndexOf(task));
+        }
+
+        // forgets queued tasks, only valid right after DdiTaskPool::Init
+        void clear()
+        {
+            m_head = m_tail = DdiTaskPool::NO_TASK;
+            m_size = 0;
+        }
+
+        // moves task 'it' from 'other' in front of 'pos'
+        void splice(iterator pos, DdiTaskQueue & other, iterator it)
+        {
+            other.Unlink(it.m_idx);
+            Link(pos.m_idx, it.m_idx);
+        }
+
+        // moves all tasks from 'other' in front of 'pos'
+        void splice(iterator pos, DdiTaskQueue & other)
+        {
+            while (!other.empty())
+                splice(pos, other, other.begin());
+        }
+
+    private:
+        friend class DdiTaskPool;
+
+        void Unlink(mfxU32 idx);
+        void Link(mfxU32 pos, mfxU32 idx);
+
+        DdiTaskPool * m_pool;
+        mfxU32        m_head;
+        mfxU32        m_tail;
+        mfxU32        m_size;
+    };
+
+    typedef DdiTaskQueue::iterator DdiTaskIter;
 
 
     template <size_t N>
@@ -3190,18 +3326,19 @@ private:
 
         SliceDivider        m_sliceDivider;
 
-        std::list<DdiTask>  m_free;
-        std::list<DdiTask>  m_incoming;
-        std::list<DdiTask>  m_ScDetectionStarted;
-        std::list<DdiTask>  m_ScDetectionFinished;
-        std::list<DdiTask>  m_MctfStarted;
-        std::list<DdiTask>  m_MctfFinished;
-        std::list<DdiTask>  m_reordering;
-        std::list<DdiTask>  m_lookaheadStarted;
-        std::list<DdiTask>  m_lookaheadFinished;
-        std::list<DdiTask>  m_histRun;
-        std::list<DdiTask>  m_histWait;
-        std::list<DdiTask>  m_encoding;
+        DdiTaskPool         m_tasks;
+        DdiTaskQueue        m_free;
+        DdiTaskQueue        m_incoming;
+        DdiTaskQueue        m_ScDetectionStarted;
+        DdiTaskQueue        m_ScDetectionFinished;
+        DdiTaskQueue        m_MctfStarted;
+        DdiTaskQueue        m_MctfFinished;
+        DdiTaskQueue        m_reordering;
+        DdiTaskQueue        m_lookaheadStarted;
+        DdiTaskQueue        m_lookaheadFinished;
+        DdiTaskQueue        m_histRun;
+        DdiTaskQueue        m_histWait;
+        DdiTaskQueue        m_encoding;
         UMC::Mutex          m_listMutex;
         DdiTask             m_lastTask;
         mfxU32              m_stagesToGo;
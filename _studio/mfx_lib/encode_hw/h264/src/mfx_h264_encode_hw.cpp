@@ -841,6 +841,18 @@ ImplementationAvc::ImplementationAvc(VideoCORE * core)
 , m_stat()
 , m_isD3D9SimWithVideoMem(false)
 , m_sliceDivider()
+, m_free(m_tasks)
+, m_incoming(m_tasks)
+, m_ScDetectionStarted(m_tasks)
+, m_ScDetectionFinished(m_tasks)
+, m_MctfStarted(m_tasks)
+, m_MctfFinished(m_tasks)
+, m_reordering(m_tasks)
+, m_lookaheadStarted(m_tasks)
+, m_lookaheadFinished(m_tasks)
+, m_histRun(m_tasks)
+, m_histWait(m_tasks)
+, m_encoding(m_tasks)
 , m_stagesToGo(0)
 , m_bDeferredFrame(0)
 , m_fieldCounter(0)
@@ -1626,7 +1638,6 @@ mfxStatus ImplementationAvc::Init(mfxVideoParam * par)
     MFX_CHECK_STS(sts);
     {
         MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_HOTSPOTS, "cleanup");
-        m_free.resize(m_emulatorForSyncPart.GetTotalGreediness() + m_video.AsyncDepth - 1);
         m_incoming.clear();
         m_ScDetectionStarted.clear();
         m_ScDetectionFinished.clear();
@@ -1638,6 +1649,7 @@ mfxStatus ImplementationAvc::Init(mfxVideoParam * par)
         m_histRun.clear();
         m_histWait.clear();
         m_encoding.clear();
+        m_tasks.Init(m_emulatorForSyncPart.GetTotalGreediness() + m_video.AsyncDepth - 1, m_free);
     }
     m_fieldCounter   = 0;
     m_1stFieldStatus = MFX_ERR_NONE;
@@ -1957,6 +1969,7 @@ mfxStatus ImplementationAvc::Reset(mfxVideoParam *par)
         m_free.splice(m_free.end(), m_histRun);
         m_free.splice(m_free.end(), m_histWait);
         m_free.splice(m_free.end(), m_encoding);
+        m_tasks.ClearIndex();
 
         for (DdiTaskIter i = m_free.begin(); i != m_free.end(); ++i)
         {
@@ -2259,6 +2272,7 @@ void ImplementationAvc::OnLookaheadSubmitted(DdiTaskIter task)
     if (m_inputFrameType == MFX_IOPATTERN_IN_SYSTEM_MEMORY)
         m_core->DecreaseReference(*task->m_yuv);
     m_lookaheadStarted.splice(m_lookaheadStarted.end(), m_reordering, task);
+    m_tasks.AddToIndex(*task);
 }
 
 void ImplementationAvc::OnLookaheadQueried()
@@ -2366,6 +2380,7 @@ void ImplementationAvc::OnEncodingSubmitted(DdiTaskIter task)
 
     MFX_TRACE_D(task->m_startTime);
 
+    m_tasks.RemoveFromIndex(*task);
     m_encoding.splice(m_encoding.end(), m_lookaheadFinished, task);
 }
 
@@ -2517,16 +2532,11 @@ void ImplementationAvc::BrcPreEnc(
 {
     mfxExtCodingOption2 const & extOpt2 = GetExtBufferRef(m_video);
 
-    DdiTaskIter j = m_lookaheadFinished.begin();
-    mfxU32 numLaFrames = (mfxU32)m_lookaheadFinished.size();
-    while (j->m_encOrder != task.m_encOrder)
-        ++j, --numLaFrames;
-
-    numLaFrames = std::min<mfxU32>(extOpt2.LookAheadDepth, numLaFrames);
-
-    m_tmpVmeData.resize(numLaFrames);
-    for (size_t i = 0; i < m_tmpVmeData.size(); ++i, ++j)
-        m_tmpVmeData[i] = j->m_vmeData;
+    // task and up to LookAheadDepth - 1 frames following it
+    m_tmpVmeData.clear();
+    for (DdiTaskIter j = m_lookaheadFinished.iterator_to(task);
+        j != m_lookaheadFinished.end() && m_tmpVmeData.size() < size_t(extOpt2.LookAheadDepth); ++j)
+        m_tmpVmeData.push_back(j->m_vmeData);
 
     m_brc.PreEnc(task.m_brcFrameParams, m_tmpVmeData);
 }
@@ -3905,13 +3915,13 @@ mfxStatus ImplementationAvc::AsyncRoutine(mfxBitstream * bs)
 
             DdiTask * fwd = 0;
             if (l0.Size() > 0)
-                fwd = find_if_ptr4(m_lookaheadFinished, m_lookaheadStarted, m_histRun, m_histWait,
-                    FindByFrameOrder(dpb[l0[0] & 127].m_frameOrder));
+                fwd = m_tasks.FindByFrameOrder(dpb[l0[0] & 127].m_frameOrder,
+                    { &m_lookaheadFinished, &m_lookaheadStarted, &m_histRun, &m_histWait });
 
             DdiTask * bwd = 0;
             if (l1.Size() > 0)
-                bwd = find_if_ptr4(m_lookaheadFinished, m_lookaheadStarted, m_histRun, m_histWait,
-                    FindByFrameOrder(dpb[l1[0] & 127].m_frameOrder));
+                bwd = m_tasks.FindByFrameOrder(dpb[l1[0] & 127].m_frameOrder,
+                    { &m_lookaheadFinished, &m_lookaheadStarted, &m_histRun, &m_histWait });
 
             if ((!fwd) && l0.Size() >0  && extOpt2.MaxSliceSize) //TO DO
             {
@@ -4284,7 +4294,7 @@ mfxStatus ImplementationAvc::AsyncRoutine(mfxBitstream * bs)
             {
                 mfxU32 fieldId = task->m_fid[f];
 
-                mfxU16 recovery_frame_cnt = (mfxU16)std::count_if(m_reordering.begin(), m_reordering.end(), [](DdiTask task_item) {return task_item.m_type[0] & MFX_FRAMETYPE_REF; });
+                mfxU16 recovery_frame_cnt = (mfxU16)std::count_if(m_reordering.begin(), m_reordering.end(), [](DdiTask const & task_item) {return task_item.m_type[0] & MFX_FRAMETYPE_REF; });
                 if (!IsOn(extOpt.FramePicture))
                     recovery_frame_cnt *= 2; // assume that both paired fields are or aren't reference.
                 PrepareSeiMessageBuffer(m_video, *task, fieldId, m_sei, recovery_frame_cnt);
@@ -1732,6 +1732,100 @@ namespace
 };
 
 
+void DdiTaskPool::Init(mfxU32 size, DdiTaskQueue & free)
+{
+    m_task.clear();
+    m_task.resize(size);
+    m_link.assign(size, Link{ NO_TASK, NO_TASK, nullptr });
+    m_byFrameOrder.clear();
+
+    free.clear();
+    for (mfxU32 i = 0; i < size; i++)
+        free.Link(NO_TASK, i);
+}
+
+void DdiTaskPool::AddToIndex(DdiTask const & task)
+{
+    m_byFrameOrder.emplace(task.m_frameOrder, IndexOf(task));
+}
+
+void DdiTaskPool::RemoveFromIndex(DdiTask const & task)
+{
+    mfxU32 idx = IndexOf(task);
+    auto range = m_byFrameOrder.equal_range(task.m_frameOrder);
+
+    for (auto i = range.first; i != range.second; ++i)
+    {
+        if (i->second == idx)
+        {
+            m_byFrameOrder.erase(i);
+            return;
+        }
+    }
+}
+
+DdiTask * DdiTaskPool::FindByFrameOrder(mfxU32 frameOrder, std::initializer_list<DdiTaskQueue const *> queues)
+{
+    DdiTask * found = 0;
+    size_t    rank  = queues.size();
+    auto      range = m_byFrameOrder.equal_range(frameOrder);
+
+    for (auto i = range.first; i != range.second; ++i)
+    {
+        size_t r = std::find(queues.begin(), queues.end(), m_link[i->second].queue) - queues.begin();
+        if (r < rank)
+        {
+            found = &m_task[i->second];
+            rank  = r;
+        }
+    }
+
+    return found;
+}
+
+void DdiTaskQueue::Unlink(mfxU32 idx)
+{
+    DdiTaskPool::Link & link = m_pool->m_link[idx];
+    assert(link.queue == this);
+
+    if (link.prev != DdiTaskPool::NO_TASK)
+        m_pool->m_link[link.prev].next = link.next;
+    else
+        m_head = link.next;
+
+    if (link.next != DdiTaskPool::NO_TASK)
+        m_pool->m_link[link.next].prev = link.prev;
+    else
+        m_tail = link.prev;
+
+    link.prev  = link.next = DdiTaskPool::NO_TASK;
+    link.queue = nullptr;
+    m_size--;
+}
+
+void DdiTaskQueue::Link(mfxU32 pos, mfxU32 idx)
+{
+    DdiTaskPool::Link & link = m_pool->m_link[idx];
+    assert(link.queue == nullptr);
+
+    link.next  = pos;
+    link.prev  = (pos == DdiTaskPool::NO_TASK) ? m_tail : m_pool->m_link[pos].prev;
+    link.queue = this;
+
+    if (link.prev != DdiTaskPool::NO_TASK)
+        m_pool->m_link[link.prev].next = idx;
+    else
+        m_head = idx;
+
+    if (pos != DdiTaskPool::NO_TASK)
+        m_pool->m_link[pos].prev = idx;
+    else
+        m_tail = idx;
+
+    m_size++;
+}
+
+
 DdiTaskIter MfxHwH264Encode::ReorderFrame(
     ArrayDpbFrame const & dpb,
     DdiTaskIter           begin,
@@ -46,8 +46,11 @@ namespace Base
             mfxStatus& status
             , eFeatureMode mode);
 
+        // runs InternalInit() of the most derived encoder and freezes the per-frame queues
         virtual mfxStatus Init(mfxVideoParam *par) override;
 
+        virtual mfxStatus InternalInit(mfxVideoParam *par);
+
         virtual mfxStatus Reset(mfxVideoParam *par) override;
 
         virtual mfxStatus Close(void) override;
@@ -124,9 +124,9 @@ Linux::Base::MFXVideoENCODEH265_HW::MFXVideoENCODEH265_HW(
     }
 }
 
-mfxStatus Linux::Base::MFXVideoENCODEH265_HW::Init(mfxVideoParam *par)
+mfxStatus Linux::Base::MFXVideoENCODEH265_HW::InternalInit(mfxVideoParam *par)
 {
-    mfxStatus sts = HEVCEHW::Base::MFXVideoENCODEH265_HW::Init(par);
+    mfxStatus sts = HEVCEHW::Base::MFXVideoENCODEH265_HW::InternalInit(par);
     MFX_CHECK(sts >= MFX_ERR_NONE, sts);
 
     {
@@ -135,9 +135,9 @@ void MFXVideoENCODEH265_HW::InternalInitFeatures(
     status = MFX_ERR_NONE;
 }
 
-mfxStatus MFXVideoENCODEH265_HW::Init(mfxVideoParam *par)
+mfxStatus MFXVideoENCODEH265_HW::InternalInit(mfxVideoParam *par)
 {
-    auto sts = TBaseGen::Init(par);
+    auto sts = TBaseGen::InternalInit(par);
     MFX_CHECK_STS(sts);
 
     auto& st = BQ<BQ_SubmitTask>::Get(*this);
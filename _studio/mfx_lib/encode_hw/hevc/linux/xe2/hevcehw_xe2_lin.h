@@ -48,7 +48,7 @@ namespace Xe2
             , mfxStatus& status
             , eFeatureMode mode = eFeatureMode::INIT);
 
-        virtual mfxStatus Init(mfxVideoParam *par) override;
+        virtual mfxStatus InternalInit(mfxVideoParam *par) override;
     protected:
         using TFeatureList = HEVCEHW::Base::MFXVideoENCODEH265_HW::TFeatureList;
 
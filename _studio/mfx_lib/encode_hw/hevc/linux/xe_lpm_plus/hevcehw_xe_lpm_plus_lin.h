@@ -43,7 +43,7 @@ namespace Xe_LPM_Plus
             , mfxStatus& status
             , eFeatureMode mode = eFeatureMode::INIT);
 
-        virtual mfxStatus Init(mfxVideoParam *par) override;
+        virtual mfxStatus InternalInit(mfxVideoParam *par) override;
 
     protected:
         using TFeatureList = HEVCEHW::Base::MFXVideoENCODEH265_HW::TFeatureList;
@@ -734,6 +734,8 @@ mfxStatus ASC_Cm::calc_RaCa_Surf(mfxHDLPair surface, mfxF64& rscs) {
 }
 
 void ASC_Cm::Close() {
+    m_workers.Stop();
+
     if (m_videoData != nullptr) {
         VidSample_dispose();
         delete[] m_videoData;
@@ -804,16 +806,17 @@ mfxStatus ASC_Cm::Init(mfxI32 Width,
     m_task = nullptr;
     m_taskCp = nullptr;
 
+    m_AVX512_available = CpuFeature_AVX512BW();
     m_AVX2_available = CpuFeature_AVX2();
     m_SSE4_available = CpuFeature_SSE41();
 
-    ASC_CPU_DISP_INIT_C(GainOffset);
-    ASC_CPU_DISP_INIT_SSE4_C(RsCsCalc_4x4);
+    ASC_CPU_DISP_INIT_AVX512_C(GainOffset);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(RsCsCalc_4x4);
     ASC_CPU_DISP_INIT_C(RsCsCalc_bound);
     ASC_CPU_DISP_INIT_C(RsCsCalc_diff);
-    ASC_CPU_DISP_INIT_SSE4_C(ImageDiffHistogram);
-    ASC_CPU_DISP_INIT_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
-    ASC_CPU_DISP_INIT_SSE4_C(Calc_RaCa_pic);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(ImageDiffHistogram);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(Calc_RaCa_pic);
 
     InitStruct();
     try
@@ -887,6 +890,8 @@ mfxStatus ASC_Cm::Init(mfxI32 Width,
     SCD_CHECK_MFX_ERR(sts);
     m_dataReady = false;
     m_ASCinitialized = (sts == MFX_ERR_NONE);
+
+    m_workers.Start(m_numThreads - 1);
     return sts;
 }
 
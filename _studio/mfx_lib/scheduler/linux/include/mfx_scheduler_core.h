@@ -29,6 +29,9 @@
 
 #include <mfx_task.h>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "mfx_common.h"
@@ -51,6 +54,16 @@ enum
     MFX_INVALID_THREAD_ID       = -1
 };
 
+enum : mfxU32
+{
+    // index of an absent entry of the dependency or occupancy tables
+    MFX_INVALID_TABLE_INDEX     = 0xffffffff,
+    // number of hash index heads per table entry
+    MFX_HASH_BUCKETS_PER_ENTRY  = 2,
+    // number of 'waiting' reset counters, owners are hashed into them
+    MFX_WAITING_GENERATIONS     = 64
+};
+
 enum
 {
     MFX_THREAD_TIME_TO_WAIT     = 1000
@@ -61,6 +74,15 @@ enum
 struct MFX_SCHEDULER_TASK;
 struct MFX_THREAD_ASSIGNMENT;
 
+// Guard of the thread assignment table entry (MFX_SCHEDULER_WORK_STEALING mode).
+// It protects the occupancy of the entry and the handles of ready tasks,
+// which can't get a free thread number until a thread leaves the entry.
+struct MFX_THREAD_ASSIGNMENT_GUARD
+{
+    std::mutex guard;
+    std::vector<mfxTaskHandle> blockedTasks[MFX_PRIORITY_NUMBER];
+};
+
 typedef
 struct MFX_DEPENDENCY_ITEM
 {
@@ -104,6 +126,8 @@ struct MFX_CALL_INFO
     mfxU64 timeStamp;
     // The time spent by the call
     mfxU64 timeSpend;
+    // Owner's 'waiting' reset count at the call assignment
+    mfxU32 waitingGeneration;
 
 } MFX_CALL_INFO;
 
@@ -118,7 +142,7 @@ enum eWakeUpReason
 };
 
 
-class mfxSchedulerCore : public MFXIScheduler2
+class mfxSchedulerCore : public MFXIScheduler2, public MFXISchedulerStat
 {
 public:
     // Default constructor
@@ -176,6 +200,18 @@ public:
     mfxStatus AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoint,
                       const char *pFileName, int lineNumber);
 
+    //
+    // MFXISchedulerStat interface
+    //
+
+    // Get the current statistic
+    virtual
+    mfxStatus GetStat(MFX_SCHEDULER_STAT *pStat);
+
+    // Reset accumulated times, counters and histograms
+    virtual
+    mfxStatus ResetStat(void);
+
     //
     // MFXIUnknown interface
     //
@@ -207,6 +243,13 @@ public:
     // Notification to the scheduler that task got resolved dependencies
     void OnDependencyResolved(MFX_SCHEDULER_TASK *pTask);
 
+    // Notification to the scheduler that no task uses the thread assignment
+    void OnOccupancyReleased(MFX_THREAD_ASSIGNMENT *pAssignment);
+
+    // Check whether ready tasks are dispatched through per-thread queues
+    inline bool IsWorkStealing(void) const
+    { return 0 != (m_param.flags & MFX_SCHEDULER_WORK_STEALING); }
+
     // WA for SINGLE THREAD MODE
     virtual
     mfxStatus GetTimeout(mfxU32 & maxTimeToRun);
@@ -240,6 +283,10 @@ protected:
     void WakeUpThreads(
         mfxU32 num_dedicated_threads = (mfxU32)-1,
         mfxU32 num_regular_threads = (mfxU32)-1);
+    // Wake up the given thread
+    void WakeUpThread(MFX_SCHEDULER_THREAD_CONTEXT *thctx);
+    // Allocate the task, dependency and thread assignment tables
+    void AllocateTables(void);
     // Allocate the empty task
     mfxStatus AllocateEmptyTask(void);
     // Get the index in the occupancy table. The functions searches through
@@ -250,12 +297,30 @@ protected:
     void ScrubCompletedTasks(bool bComprehensive = false);
     // Register task outputs as dependencies.
     void RegisterTaskDependencies(MFX_SCHEDULER_TASK *pTask);
+    // Find the table index of the n-th filled entry with the given pointer
+    mfxU32 FindDependency(const void *pDependency, mfxU32 n = 0) const;
+    // Fill an empty entry of the dependency table, return its index
+    mfxU32 AddDependency(void *pDependency,
+                         mfxStatus mfxRes,
+                         MFX_SCHEDULER_TASK *pTask);
+    // Empty the entry of the dependency table
+    void RemoveDependency(mfxU32 idx);
     // Recover the dependency table after failure
     void RecoverDependencyTable(const void *pDependency);
+    // Get the guard of the thread assignment table entry
+    MFX_THREAD_ASSIGNMENT_GUARD &GetAssignmentGuard(const MFX_THREAD_ASSIGNMENT *pAssignment);
+    // Get the 'waiting' reset counter of the owner
+    std::atomic<mfxU32> &GetWaitingGeneration(const void *pOwner);
 
     // Get the priority of the task
     int GetTaskPriority(mfxTaskHandle task);
 
+    // Get the index of the routine statistic entry for the task
+    mfxU32 GetRoutineStatIndex(const MFX_TASK &task);
+    // Account the duration in the histogram
+    static
+    void UpdateHistogram(mfxU64 histogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS], mfxU64 time);
+
     // Get time statistic for the moment
     void GetTimeStat(mfxU64 timeSpent[MFX_PRIORITY_NUMBER],
                      mfxU64 totalTimeSpent[MFX_PRIORITY_NUMBER]);
@@ -274,6 +339,42 @@ protected:
                          MFX_SCHEDULER_TASK *pTask,
                          const mfxU32 threadNum);
 
+    // Update the task and its thread assignment after the call.
+    // Returns 'true', if the last thread left the done or failed task.
+    bool LeaveTask(const MFX_CALL_INFO *pCallInfo,
+                   MFX_SCHEDULER_TASK *pTask,
+                   const mfxU32 threadNum);
+    // Complete the task, resolve its dependencies and release resources.
+    // Returns 'true', if the task object becomes free.
+    bool RetireTask(MFX_SCHEDULER_TASK *pTask, const mfxU32 threadNum);
+
+    // Put the handle of a ready task into the queue of the given thread.
+    // Dedicated tasks always go to the thread #0. Continuations go to
+    // the front of the running thread's queue, other threads are not woken.
+    void PushReadyTask(mfxTaskHandle handle,
+                       int priority,
+                       int type,
+                       mfxU32 threadNum,
+                       bool bContinuation = false);
+    // Get a ready task of the given priority and type from the own queue,
+    // or steal it from the queues of other threads.
+    mfxStatus GetReadyTask(MFX_CALL_INFO &callInfo,
+                           int priority,
+                           int type,
+                           const mfxU32 threadNum);
+    // Validate the queued handle and wrap up the task
+    mfxStatus WrapUpReadyTask(MFX_CALL_INFO &callInfo,
+                              mfxTaskHandle handle,
+                              const mfxU32 threadNum);
+
+    // Lock the guard, which is used in the work stealing mode only
+    inline std::unique_lock<std::mutex> LockForWorkStealing(std::mutex &guard)
+    {
+        return (IsWorkStealing()) ?
+            (std::unique_lock<std::mutex>(guard)) :
+            (std::unique_lock<std::mutex>());
+    }
+
     inline void call_pRoutine(MFX_CALL_INFO& call);
 
     //
@@ -344,8 +445,6 @@ protected:
     MFX_SCHEDULER_PARAM2 m_param;
     // Reference counters
     mfxU32 m_refCounter;
-    // Current time stamp
-    mfxU64 m_currentTimeStamp;
     // Time wait period for 'waiting' tasks
     const
     mfxU64 m_timeWaitPeriod;
@@ -368,8 +467,7 @@ protected:
     mfxStatus StopWakeUpThread(void);
 
     // 'quit' flag for threads
-    volatile
-    bool m_bQuit;
+    std::atomic<bool> m_bQuit;
     volatile
     bool m_bQuitWakeUpThread;
 
@@ -379,7 +477,7 @@ protected:
 
 
     // Condition variable to wait free task objects
-    mfxU16 m_freeTasksCount;
+    std::atomic<mfxU32> m_freeTasksCount;
     std::condition_variable m_freeTasks;
     // Handle to the wakeup thread
     std::thread m_hwWakeUpThread;
@@ -392,8 +490,17 @@ protected:
     // TASKING STUFF
     //
 
-    // Guard for task queues
+    // Guard for task queues.
+    // In the MFX_SCHEDULER_WORK_STEALING mode working threads don't take it.
+    // Tasks are taken from the per-thread queues, the task state is protected
+    // by the task guard and the occupancy by the thread assignment entry
+    // guard. The dependency and thread assignment tables are protected by
+    // m_tableGuard, the statistic by m_statGuard. The locking order is
+    // m_guard, m_tableGuard, task, thread assignment entry, thread queue,
+    // m_statGuard.
     std::mutex m_guard;
+    std::mutex m_tableGuard;
+    std::mutex m_statGuard;
     // array of task queues
     MFX_SCHEDULER_TASK *m_pTasks[MFX_PRIORITY_NUMBER][MFX_TYPE_NUMBER];
     // Number of assigned tasks for each kind of tasks
@@ -404,6 +511,10 @@ protected:
     mfxU32 m_DedicatedThreadsToWakeUp;
     // Number of tasks for non-dedicated threads
     mfxU32 m_RegularThreadsToWakeUp;
+    // Thread to queue tasks, which inputs become ready (work stealing mode)
+    mfxU32 m_hintThreadNum;
+    // Round-robin counter to queue tasks added by external threads
+    mfxU32 m_nextHintThreadNum;
 
     // these members are used only from the main thread,
     // so synchronization is not necessary to access them.
@@ -418,17 +529,42 @@ protected:
     //
 
     // Dependency table.
-    // There are an index: it holds the number of values valid in the array.
-    // The array may have larger size.
+    // Entries are addressed by index, the index is saved by the producing
+    // task. Empty entries are tracked by the bit mask, filled entries are
+    // reachable through the hash index by the dependency pointer.
     std::vector<MFX_DEPENDENCY_ITEM> m_pDependencyTable;
-    volatile
-    mfxU32 m_numDependencies;
+    // Bit mask of empty entries of the dependency table
+    std::vector<mfxU64> m_dependencyFreeMask;
+    // Hash index heads and links. Entries with the same pointer are
+    // chained in the order of table indices.
+    std::vector<mfxU32> m_dependencyHash;
+    std::vector<mfxU32> m_dependencyHashNext;
 
     // Threads assignment table.
     std::vector<MFX_THREAD_ASSIGNMENT> m_occupancyTable;
-    // Number of valid entries in the table.
-    volatile
-    mfxU32 m_numOccupancies;
+    // Stack of unused entries of the threads assignment table
+    std::vector<mfxU32> m_freeOccupancies;
+    // Hash index heads and links, keyed by pState and pRoutine
+    std::vector<mfxU32> m_occupancyHash;
+    std::vector<mfxU32> m_occupancyHashNext;
+    // Guards of the threads assignment table entries (work stealing mode)
+    std::unique_ptr<MFX_THREAD_ASSIGNMENT_GUARD[]> m_occupancyGuards;
+
+    // 'waiting' reset counters. Tasks keep the counter value with their
+    // 'waiting' flag, the flag is reset by incrementing the counter.
+    std::atomic<mfxU32> m_waitingGenerations[MFX_WAITING_GENERATIONS];
+
+    //
+    // STATISTIC STUFF
+    //
+
+    // Distribution of time from task submission to its first call
+    mfxU64 m_waitTimeHistogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS];
+    // Number of tasks submitted with incomplete inputs
+    mfxU64 m_numDependencyStalls;
+    // Statistic of task routines
+    MFX_SCHEDULER_ROUTINE_STAT m_routineStat[MFX_SCHEDULER_STAT_MAX_ROUTINES];
+    mfxU32 m_numRoutineStat;
 
     // Number of allocated task objects
     mfxU32 m_taskCounter;
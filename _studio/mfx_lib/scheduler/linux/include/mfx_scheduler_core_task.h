@@ -28,6 +28,7 @@
 #include <mfx_scheduler_core_handle.h>
 
 #include <condition_variable>
+#include <mutex>
 
 // forward declaration of used types
 struct MFX_SCHEDULER_TASK;
@@ -88,6 +89,10 @@ struct MFX_SCHEDULER_TASK : public mfxDependencyItem<MFX_TASK_NUM_DEPENDENCIES>
 
     // task state variables
 
+    // Guard of the task state in the MFX_SCHEDULER_WORK_STEALING mode.
+    // It protects the job ID, the status and the dispatch parameters,
+    // 'done' is signaled under it.
+    std::mutex guard;
     // Waiting 'until task is done' object
     std::condition_variable done;
     // Final status of the current job
@@ -115,9 +120,17 @@ struct MFX_SCHEDULER_TASK : public mfxDependencyItem<MFX_TASK_NUM_DEPENDENCIES>
         mfxU64 threadMask;
         // Number of call of the task
         mfxU32 numberOfCalls;
+        // Index of the routine statistic entry
+        mfxU32 routineStatIdx;
+
+        // all task inputs are ready (MFX_SCHEDULER_WORK_STEALING mode only)
+        bool bInputsReady;
+        // Number of task handles queued for threads or blocked in the occupancy entry
+        mfxU32 numHints;
 
         // task timing parameters
         bool bWaiting;                                              // (bool) task needs some waiting
+        mfxU32 waitingGeneration;                                   // (mfxU32) owner's 'waiting' reset count, which bWaiting belongs to
         struct
         {
             // Time in msec of the last 'entering' to the task
@@ -132,6 +145,8 @@ struct MFX_SCHEDULER_TASK : public mfxDependencyItem<MFX_TASK_NUM_DEPENDENCIES>
             mfxU64 timeOverhead;
             // HW counter value of the last 'entering' to the task
             mfxU64 hwCounterLastEnter;
+            // Time stamp of the task submission
+            mfxU64 timeAdded;
         } timing;
 
         // source file info
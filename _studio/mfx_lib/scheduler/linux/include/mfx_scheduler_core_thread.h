@@ -22,9 +22,14 @@
 #define __MFX_SCHEDULER_CORE_THREAD_H
 
 #include <mfxdefs.h>
+#include <mfx_task.h>
+#include <mfx_scheduler_core_handle.h>
 
+#include <atomic>
 #include <thread>
+#include <mutex>
 #include <condition_variable>
+#include <deque>
 
 // forward declaration of the owning class
 class mfxSchedulerCore;
@@ -38,6 +43,8 @@ struct MFX_SCHEDULER_THREAD_CONTEXT
       , threadHandle()
       , workTime(0)
       , sleepTime(0)
+      , numCalls(0)
+      , bWakeUp(false)
     {}
 
     enum State {
@@ -45,7 +52,7 @@ struct MFX_SCHEDULER_THREAD_CONTEXT
         Running  // thread is executing a task
     };
 
-    State state;                       // thread state, waiting or running
+    std::atomic<State> state;          // thread state, waiting or running
     mfxSchedulerCore *pSchedulerCore;  // pointer to the owning core
     mfxU32 threadNum;                  // thread number assigned by the core
     std::thread threadHandle;          // thread handle
@@ -53,6 +60,16 @@ struct MFX_SCHEDULER_THREAD_CONTEXT
 
     mfxU64 workTime;                   // integral working time
     mfxU64 sleepTime;                  // integral sleeping time
+    mfxU64 numCalls;                   // number of task calls
+
+    // MFX_SCHEDULER_WORK_STEALING mode only.
+    // Handles of ready tasks queued for the thread. The thread pops from
+    // the front, other threads steal from the back. Handles are validated
+    // on pop, stale ones are dropped.
+    std::mutex readyGuard;
+    std::deque<mfxTaskHandle> readyTasks[MFX_PRIORITY_NUMBER][MFX_TYPE_NUMBER];
+    // the thread is asked to look for tasks, guarded by readyGuard
+    bool bWakeUp;
 };
 
 #endif // #ifndef __MFX_SCHEDULER_CORE_THREAD_H
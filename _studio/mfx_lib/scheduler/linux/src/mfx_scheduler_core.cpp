@@ -25,10 +25,9 @@
 #include <mfx_trace.h>
 
 mfxSchedulerCore::mfxSchedulerCore(void)
-    :  m_currentTimeStamp(0)
     // since on Linux we have blocking synchronization which means an absence of polling,
     // there is no need to use 'waiting' time period.
-    , m_timeWaitPeriod(0)
+    :  m_timeWaitPeriod(0)
     , m_hwWakeUpThread()
     , m_DedicatedThreadsToWakeUp(0)
     , m_RegularThreadsToWakeUp(0)
@@ -47,14 +46,29 @@ mfxSchedulerCore::mfxSchedulerCore(void)
     memset(m_pTasks, 0, sizeof(m_pTasks));
     memset(m_numAssignedTasks, 0, sizeof(m_numAssignedTasks));
     m_pFailedTasks = NULL;
+    m_hintThreadNum = 0;
+    m_nextHintThreadNum = 0;
 
     m_pFreeTasks = NULL;
 
     // reset dependency table variables
-    m_numDependencies = 0;
+    m_pDependencyTable.clear();
+    m_dependencyFreeMask.clear();
+    m_dependencyHash.clear();
+    m_dependencyHashNext.clear();
 
     // reset busy objects table
-    m_numOccupancies = 0;
+    m_occupancyTable.clear();
+    m_freeOccupancies.clear();
+    m_occupancyHash.clear();
+    m_occupancyHashNext.clear();
+    m_occupancyGuards.reset();
+
+    // reset the statistic
+    memset(m_waitTimeHistogram, 0, sizeof(m_waitTimeHistogram));
+    m_numDependencyStalls = 0;
+    memset(m_routineStat, 0, sizeof(m_routineStat));
+    m_numRoutineStat = 0;
 
     // reset task counters
     m_taskCounter = 0;
@@ -70,6 +84,11 @@ mfxSchedulerCore::mfxSchedulerCore(void)
 
     m_bQuitWakeUpThread = false;
 
+    for (auto & generation : m_waitingGenerations)
+    {
+        generation = 0;
+    }
+
 } // mfxSchedulerCore::mfxSchedulerCore(void)
 
 mfxSchedulerCore::~mfxSchedulerCore(void)
@@ -155,14 +174,29 @@ void mfxSchedulerCore::Close(void)
     memset(m_pTasks, 0, sizeof(m_pTasks));
     memset(m_numAssignedTasks, 0, sizeof(m_numAssignedTasks));
     m_pFailedTasks = NULL;
+    m_hintThreadNum = 0;
+    m_nextHintThreadNum = 0;
 
     m_pFreeTasks = NULL;
 
     // reset dependency table variables
-    m_numDependencies = 0;
+    m_pDependencyTable.clear();
+    m_dependencyFreeMask.clear();
+    m_dependencyHash.clear();
+    m_dependencyHashNext.clear();
 
     // reset busy objects table
-    m_numOccupancies = 0;
+    m_occupancyTable.clear();
+    m_freeOccupancies.clear();
+    m_occupancyHash.clear();
+    m_occupancyHashNext.clear();
+    m_occupancyGuards.reset();
+
+    // reset the statistic
+    memset(m_waitTimeHistogram, 0, sizeof(m_waitTimeHistogram));
+    m_numDependencyStalls = 0;
+    memset(m_routineStat, 0, sizeof(m_routineStat));
+    m_numRoutineStat = 0;
 
     // reset task counters
     m_taskCounter = 0;
@@ -180,25 +214,44 @@ void mfxSchedulerCore::WakeUpThreads(mfxU32 num_dedicated_threads, mfxU32 num_re
         // we have single dedicated thread, thus no loop here
         thctx = GetThreadCtx(0);
         if (thctx->state == MFX_SCHEDULER_THREAD_CONTEXT::Waiting) {
-            thctx->taskAdded.notify_one();
+            WakeUpThread(thctx);
         }
     }
     // if we have woken up dedicated thread, we exclude it from the loop below
     for (mfxU32 i = (num_dedicated_threads)? 1: 0; (i < m_param.numberOfThreads) && num_regular_threads; ++i) {
         thctx = GetThreadCtx(i);
         if (thctx->state == MFX_SCHEDULER_THREAD_CONTEXT::Waiting) {
-            thctx->taskAdded.notify_one();
+            WakeUpThread(thctx);
             --num_regular_threads;
         }
     }
 }
 
+void mfxSchedulerCore::WakeUpThread(MFX_SCHEDULER_THREAD_CONTEXT *thctx)
+{
+    // in the work stealing mode threads sleep on their own queue guard,
+    // the flag makes the wake up reliable
+    if (IsWorkStealing()) {
+        std::lock_guard<std::mutex> readyGuard(thctx->readyGuard);
+
+        thctx->bWakeUp = true;
+    }
+    thctx->taskAdded.notify_one();
+}
+
 void mfxSchedulerCore::Wait(const mfxU32 curThreadNum, std::unique_lock<std::mutex>& mutex)
 {
     MFX_SCHEDULER_THREAD_CONTEXT* thctx = GetThreadCtx(curThreadNum);
 
     if (thctx) {
-        thctx->taskAdded.wait(mutex);
+        if (IsWorkStealing()) {
+            std::unique_lock<std::mutex> readyGuard(thctx->readyGuard);
+
+            thctx->taskAdded.wait(readyGuard, [this, thctx] { return thctx->bWakeUp || m_bQuit; });
+            thctx->bWakeUp = false;
+        } else {
+            thctx->taskAdded.wait(mutex);
+        }
     }
 }
 
@@ -246,7 +299,6 @@ mfxStatus mfxSchedulerCore::AllocateEmptyTask(void)
         // register the task in the look up table
         m_ppTaskLookUpTable[m_pFreeTasks->taskID] = m_pFreeTasks;
     }
-    memset(&(m_pFreeTasks->param), 0, sizeof(m_pFreeTasks->param));
     // increment job number. This number must grow evenly.
     // make job number 0 an invalid value to avoid problem with
     // task number 0 with job number 0, which are NULL when being combined.
@@ -255,32 +307,97 @@ mfxStatus mfxSchedulerCore::AllocateEmptyTask(void)
     {
         m_jobCounter = 1;
     }
-    m_pFreeTasks->jobID = m_jobCounter;
+    {
+        // queued handles of the previous job are checked under the task guard
+        std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(m_pFreeTasks->guard);
+
+        memset(&(m_pFreeTasks->param), 0, sizeof(m_pFreeTasks->param));
+        m_pFreeTasks->jobID = m_jobCounter;
+    }
 
     return MFX_ERR_NONE;
 
 } // mfxStatus mfxSchedulerCore::AllocateEmptyTask(void)
 
+// static section of the file
+namespace
+{
+
+inline
+mfxU32 GetHashValue(const void *p, size_t numBuckets)
+{
+    // low bits of pointers are mostly zero due to alignment
+    const mfxU64 value = (mfxU64) (size_t) p;
+
+    return (mfxU32) (((value >> 4) * 0x9E3779B97F4A7C15ULL) >> 32) & (mfxU32) (numBuckets - 1);
+
+} // mfxU32 GetHashValue(const void *p, size_t numBuckets)
+
+inline
+size_t GetNumHashBuckets(size_t tableSize)
+{
+    size_t numBuckets = 1;
+
+    // the number of buckets must be a power of two
+    while (numBuckets < tableSize * MFX_HASH_BUCKETS_PER_ENTRY)
+    {
+        numBuckets <<= 1;
+    }
+
+    return numBuckets;
+
+} // size_t GetNumHashBuckets(size_t tableSize)
+
+} // namespace
+
+void mfxSchedulerCore::AllocateTables(void)
+{
+    mfxU32 i;
+
+    // clean up the task look up table
+    m_ppTaskLookUpTable.resize(MFX_MAX_NUMBER_TASK, nullptr);
+
+    // allocate the dependency table
+    m_pDependencyTable.assign(MFX_MAX_NUMBER_TASK * 2, MFX_DEPENDENCY_ITEM());
+    m_dependencyFreeMask.assign((m_pDependencyTable.size() + 63) / 64, ~0ULL);
+    m_dependencyHash.assign(GetNumHashBuckets(m_pDependencyTable.size()), MFX_INVALID_TABLE_INDEX);
+    m_dependencyHashNext.assign(m_pDependencyTable.size(), MFX_INVALID_TABLE_INDEX);
+
+    // allocate the thread assignment object table.
+    // its size should be equal to the number of task,
+    // larger table is not required.
+    m_occupancyTable.assign(MFX_MAX_NUMBER_TASK, MFX_THREAD_ASSIGNMENT());
+    m_occupancyHash.assign(GetNumHashBuckets(m_occupancyTable.size()), MFX_INVALID_TABLE_INDEX);
+    m_occupancyHashNext.assign(m_occupancyTable.size(), MFX_INVALID_TABLE_INDEX);
+    m_freeOccupancies.resize(m_occupancyTable.size());
+    // lower entries are taken first
+    for (i = 0; i < m_freeOccupancies.size(); i += 1)
+    {
+        m_freeOccupancies[i] = (mfxU32) (m_freeOccupancies.size() - 1 - i);
+    }
+    if (IsWorkStealing())
+    {
+        m_occupancyGuards.reset(new MFX_THREAD_ASSIGNMENT_GUARD[m_occupancyTable.size()]);
+    }
+
+} // void mfxSchedulerCore::AllocateTables(void)
+
 mfxStatus mfxSchedulerCore::GetOccupancyTableIndex(mfxU32 &idx,
                                                    const MFX_TASK *pTask)
 {
-    mfxU32 i = 0;
     MFX_THREAD_ASSIGNMENT *pAssignment = NULL;
+    mfxU32 bucket, i;
 
     //
     // THE EXECUTION IS ALREADY IN SECURE SECTION.
     // Just do what need to do.
     //
 
-    // check the table, decrement the number of used entries
-    while ((m_numOccupancies) &&
-           (0 == m_occupancyTable[m_numOccupancies - 1].m_numRefs))
-    {
-        m_numOccupancies -= 1;
-    }
-
     // find the existing element with the given pState and pRoutine
-    for (i = 0; i < m_numOccupancies; i += 1)
+    bucket = GetHashValue(pTask->entryPoint.pState, m_occupancyHash.size());
+    for (i = m_occupancyHash[bucket];
+         MFX_INVALID_TABLE_INDEX != i;
+         i = m_occupancyHashNext[i])
     {
         if ((m_occupancyTable[i].pState == pTask->entryPoint.pState) &&
             (m_occupancyTable[i].pRoutine == pTask->entryPoint.pRoutine))
@@ -304,19 +421,15 @@ mfxStatus mfxSchedulerCore::GetOccupancyTableIndex(mfxU32 &idx,
     // allocate one more element in the array
     else
     {
-        for (i = 0; i < m_numOccupancies; i += 1)
-        {
-            if (0 == m_occupancyTable[i].m_numRefs)
-            {
-                break;
-            }
-        }
         // we can't reallocate the table
-        if (m_occupancyTable.size() == i)
+        if (m_freeOccupancies.empty())
         {
             return MFX_WRN_DEVICE_BUSY;
         }
 
+        i = m_freeOccupancies.back();
+        m_freeOccupancies.pop_back();
+
         pAssignment = &(m_occupancyTable[i]);
 
         // fill the parameters
@@ -324,10 +437,11 @@ mfxStatus mfxSchedulerCore::GetOccupancyTableIndex(mfxU32 &idx,
         pAssignment->pState = pTask->entryPoint.pState;
         pAssignment->pRoutine = pTask->entryPoint.pRoutine;
         pAssignment->threadingPolicy = pTask->threadingPolicy;
-    }
 
-    // update the number of allocated objects
-    m_numOccupancies = std::max(mfxU32(m_numOccupancies), i + 1);
+        // make the element searchable
+        m_occupancyHashNext[i] = m_occupancyHash[bucket];
+        m_occupancyHash[bucket] = i;
+    }
 
     // save the index to return
     idx = i;
@@ -336,6 +450,46 @@ mfxStatus mfxSchedulerCore::GetOccupancyTableIndex(mfxU32 &idx,
 
 } // mfxStatus mfxSchedulerCore::GetOccupancyTableIndex(mfxU32 &idx,
 
+MFX_THREAD_ASSIGNMENT_GUARD &mfxSchedulerCore::GetAssignmentGuard(const MFX_THREAD_ASSIGNMENT *pAssignment)
+{
+    return m_occupancyGuards[pAssignment - m_occupancyTable.data()];
+
+} // MFX_THREAD_ASSIGNMENT_GUARD &mfxSchedulerCore::GetAssignmentGuard(const MFX_THREAD_ASSIGNMENT *pAssignment)
+
+std::atomic<mfxU32> &mfxSchedulerCore::GetWaitingGeneration(const void *pOwner)
+{
+    return m_waitingGenerations[GetHashValue(pOwner, MFX_WAITING_GENERATIONS)];
+
+} // std::atomic<mfxU32> &mfxSchedulerCore::GetWaitingGeneration(const void *pOwner)
+
+void mfxSchedulerCore::OnOccupancyReleased(MFX_THREAD_ASSIGNMENT *pAssignment)
+{
+    const mfxU32 idx = (mfxU32) (pAssignment - m_occupancyTable.data());
+    mfxU32 *pLink;
+
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    // unlink the element from the hash index
+    pLink = &m_occupancyHash[GetHashValue(pAssignment->pState, m_occupancyHash.size())];
+    while ((MFX_INVALID_TABLE_INDEX != *pLink) &&
+           (idx != *pLink))
+    {
+        pLink = &m_occupancyHashNext[*pLink];
+    }
+    if (idx == *pLink)
+    {
+        *pLink = m_occupancyHashNext[idx];
+        m_occupancyHashNext[idx] = MFX_INVALID_TABLE_INDEX;
+
+        // the element becomes free
+        m_freeOccupancies.push_back(idx);
+    }
+
+} // void mfxSchedulerCore::OnOccupancyReleased(MFX_THREAD_ASSIGNMENT *pAssignment)
+
 void mfxSchedulerCore::ScrubCompletedTasks(bool bComprehensive)
 {
     int priority;
@@ -365,8 +519,17 @@ void mfxSchedulerCore::ScrubCompletedTasks(bool bComprehensive)
             ppCur = m_pTasks[priority] + type;
             while (*ppCur)
             {
+                mfxStatus opRes;
+
+                {
+                    // the status is set by working threads in the work stealing mode
+                    std::unique_lock<std::mutex> taskGuard = LockForWorkStealing((*ppCur)->guard);
+
+                    opRes = (*ppCur)->opRes;
+                }
+
                 // move task completed to the 'free' queue.
-                if (MFX_ERR_NONE == (*ppCur)->opRes)
+                if (MFX_ERR_NONE == opRes)
                 {
                     MFX_SCHEDULER_TASK *pTemp;
 
@@ -378,8 +541,8 @@ void mfxSchedulerCore::ScrubCompletedTasks(bool bComprehensive)
                     m_pFreeTasks = pTemp;
                 }
                 // move task failed to the 'failed' queue.
-                else if ((MFX_ERR_NONE != (*ppCur)->opRes) &&
-                         (MFX_WRN_IN_EXECUTION != (*ppCur)->opRes))
+                else if ((MFX_ERR_NONE != opRes) &&
+                         (MFX_WRN_IN_EXECUTION != opRes))
                 {
                     MFX_SCHEDULER_TASK *pTemp;
 
@@ -401,121 +564,190 @@ void mfxSchedulerCore::ScrubCompletedTasks(bool bComprehensive)
 
 } // void mfxSchedulerCore::ScrubCompletedTasks(bool bComprehensive)
 
-void mfxSchedulerCore::RegisterTaskDependencies(MFX_SCHEDULER_TASK  *pTask)
+mfxU32 mfxSchedulerCore::FindDependency(const void *pDependency, mfxU32 n) const
 {
-    mfxU32 i, tableIdx, remainInputs;
-    const void *pSrcCopy[MFX_TASK_NUM_DEPENDENCIES];
-    mfxStatus taskRes = MFX_WRN_IN_EXECUTION;
+    mfxU32 idx;
 
     //
     // THE EXECUTION IS ALREADY IN SECURE SECTION.
     // Just do what need to do.
     //
 
-    // check if the table have empty position(s),
-    // If so decrement the index of the last table entry.
-    if (m_pDependencyTable.size() > m_numDependencies)
+    for (idx = m_dependencyHash[GetHashValue(pDependency, m_dependencyHash.size())];
+         MFX_INVALID_TABLE_INDEX != idx;
+         idx = m_dependencyHashNext[idx])
     {
-        auto it = std::find_if(m_pDependencyTable.rend() - m_numDependencies, m_pDependencyTable.rend(),
-                               [](const MFX_DEPENDENCY_ITEM & item){ return item.p != nullptr; });
-
-        m_numDependencies = m_pDependencyTable.rend() - it;
+        if (m_pDependencyTable[idx].p == pDependency)
+        {
+            if (0 == n)
+            {
+                break;
+            }
+            n -= 1;
+        }
     }
 
-    // get the number of source dependencies
-    remainInputs = 0;
-    for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
+    return idx;
+
+} // mfxU32 mfxSchedulerCore::FindDependency(const void *pDependency, mfxU32 n) const
+
+mfxU32 mfxSchedulerCore::AddDependency(void *pDependency,
+                                       mfxStatus mfxRes,
+                                       MFX_SCHEDULER_TASK *pTask)
+{
+    mfxU32 word, idx, *pLink;
+
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    // find the first empty table entry
+    for (word = 0; word < m_dependencyFreeMask.size(); word += 1)
     {
-        // make a copy of source dependencies.
-        // source dependencies have to be swept, because of duplication in
-        // the dependency table. task will sync on the first matching entry.
-        pSrcCopy[i] = pTask->param.task.pSrc[i];
-        if (pSrcCopy[i])
+        if (m_dependencyFreeMask[word])
         {
-            remainInputs += 1;
+            break;
         }
     }
+    // the table is full, extend it. Table indices keep valid.
+    if (m_dependencyFreeMask.size() == word)
+    {
+        m_pDependencyTable.resize(m_pDependencyTable.size() + 64, MFX_DEPENDENCY_ITEM());
+        m_dependencyHashNext.resize(m_pDependencyTable.size(), MFX_INVALID_TABLE_INDEX);
+        m_dependencyFreeMask.push_back(~0ULL);
+    }
+    idx = word * 64 + (mfxU32) __builtin_ctzll(m_dependencyFreeMask[word]);
+    m_dependencyFreeMask[word] &= ~(1ULL << (idx & 63));
+
+    // save the generated dependency
+    m_pDependencyTable[idx].p = pDependency;
+    m_pDependencyTable[idx].mfxRes = mfxRes;
+    m_pDependencyTable[idx].pTask = pTask;
+
+    // link the entry keeping the chain sorted by table index.
+    // tasks sync on the first matching entry.
+    pLink = &m_dependencyHash[GetHashValue(pDependency, m_dependencyHash.size())];
+    while ((MFX_INVALID_TABLE_INDEX != *pLink) &&
+           (idx > *pLink))
+    {
+        pLink = &m_dependencyHashNext[*pLink];
+    }
+    m_dependencyHashNext[idx] = *pLink;
+    *pLink = idx;
+
+    return idx;
 
-    // run over the table and save the handles of incomplete inputs
-    for (tableIdx = 0; tableIdx < m_numDependencies; tableIdx += 1)
+} // mfxU32 mfxSchedulerCore::AddDependency(void *pDependency,
+
+void mfxSchedulerCore::RemoveDependency(mfxU32 idx)
+{
+    mfxU32 *pLink;
+
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    if (nullptr == m_pDependencyTable.at(idx).p)
     {
-        // compare only filled table entries
-        if (m_pDependencyTable[tableIdx].p)
-        {
-            for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
-            {
-                // we found the source dependency,
-                // save the handle
-                if (m_pDependencyTable[tableIdx].p == pSrcCopy[i])
-                {
-                    // dependency is fail. The dependency resolved, but failed.
-                    if (MFX_WRN_IN_EXECUTION != m_pDependencyTable[tableIdx].mfxRes)
-                    {
-                        // waiting task inherits status from the parent task
-                        // need to propogate error status to all dependent tasks.
-                        //if (MFX_TASK_WAIT & pTask->param.task.threadingPolicy)
-                        {
-                            taskRes = m_pDependencyTable[tableIdx].mfxRes;
-                        }
-                        //// all other tasks are aborted
-                        //else
-                        //{
-                        //    taskRes = MFX_ERR_ABORTED;
-                        //}
-                    }
-                    // link dependency
-                    else
-                    {
-                        m_pDependencyTable[tableIdx].pTask->SetDependentItem(pTask, i);
-                    }
-                    // sweep already used dependency
-                    pSrcCopy[i] = NULL;
-                    remainInputs -= 1;
-                    break;
-                }
-            }
+        return;
+    }
 
-            // is there more source dependencies?
-            if (0 == remainInputs)
-            {
-                break;
-            }
-        }
+    // unlink the entry from the hash index
+    pLink = &m_dependencyHash[GetHashValue(m_pDependencyTable[idx].p, m_dependencyHash.size())];
+    while ((MFX_INVALID_TABLE_INDEX != *pLink) &&
+           (idx != *pLink))
+    {
+        pLink = &m_dependencyHashNext[*pLink];
+    }
+    if (idx == *pLink)
+    {
+        *pLink = m_dependencyHashNext[idx];
     }
+    m_dependencyHashNext[idx] = MFX_INVALID_TABLE_INDEX;
+
+    // the entry becomes empty
+    m_pDependencyTable[idx].p = nullptr;
+    m_dependencyFreeMask[idx / 64] |= (1ULL << (idx & 63));
+
+} // void mfxSchedulerCore::RemoveDependency(mfxU32 idx)
 
-    // run over the table and register generated outputs
-    tableIdx = 0;
+void mfxSchedulerCore::RegisterTaskDependencies(MFX_SCHEDULER_TASK  *pTask)
+{
+    mfxU32 i, j, tableIdx, numDuplicates;
+    mfxStatus taskRes = MFX_WRN_IN_EXECUTION;
+    bool bStalled = false;
+
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    // look up the handles of incomplete inputs
     for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
     {
-        if (pTask->param.task.pDst[i])
+        const void *pSrc = pTask->param.task.pSrc[i];
+
+        if (nullptr == pSrc)
         {
-            // find empty table entry
-            while (m_pDependencyTable.at(tableIdx).p)
-            {
-                tableIdx += 1;
-            }
+            continue;
+        }
 
-            // save the generated dependency
-            m_pDependencyTable[tableIdx].p = pTask->param.task.pDst[i];
-            m_pDependencyTable[tableIdx].mfxRes = taskRes;
-            m_pDependencyTable[tableIdx].pTask = pTask;
+        // source dependencies have to be swept, because of duplication in
+        // the dependency table. Duplicated inputs are bound to the
+        // following matching entries.
+        numDuplicates = 0;
+        for (j = 0; j < i; j += 1)
+        {
+            numDuplicates += (pTask->param.task.pSrc[j] == pSrc) ? (1) : (0);
+        }
 
-            // save the index of the output
-            pTask->param.dependencies.dstIdx[i] = tableIdx;
-            tableIdx += 1;
+        tableIdx = FindDependency(pSrc, numDuplicates);
+        if (MFX_INVALID_TABLE_INDEX == tableIdx)
+        {
+            continue;
+        }
+
+        // dependency is fail. The dependency resolved, but failed.
+        if (MFX_WRN_IN_EXECUTION != m_pDependencyTable[tableIdx].mfxRes)
+        {
+            // waiting task inherits status from the parent task
+            // need to propogate error status to all dependent tasks.
+            taskRes = m_pDependencyTable[tableIdx].mfxRes;
+        }
+        // link dependency
+        else
+        {
+            m_pDependencyTable[tableIdx].pTask->SetDependentItem(pTask, i);
+            bStalled = true;
         }
     }
 
-    // update the dependency table max index
-    if (tableIdx >= m_numDependencies)
+    if (bStalled)
     {
-        m_numDependencies = tableIdx;
+        m_numDependencyStalls += 1;
+        m_routineStat[pTask->param.routineStatIdx].numDependencyStalls += 1;
+    }
+
+    // register generated outputs
+    for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
+    {
+        if (pTask->param.task.pDst[i])
+        {
+            // save the index of the output
+            pTask->param.dependencies.dstIdx[i] = AddDependency(pTask->param.task.pDst[i],
+                                                                taskRes,
+                                                                pTask);
+        }
     }
 
     // if dependency were failed,
     // set the task into the 'aborted' state
     if (MFX_WRN_IN_EXECUTION != taskRes)
     {
+        std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(m_pFreeTasks->guard);
+
         // save the status
         m_pFreeTasks->curStatus = taskRes;
         m_pFreeTasks->opRes = taskRes;
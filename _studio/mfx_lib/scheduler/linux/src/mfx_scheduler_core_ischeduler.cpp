@@ -65,16 +65,8 @@ mfxStatus mfxSchedulerCore::Initialize2(const MFX_SCHEDULER_PARAM2 *pParam)
         m_param = *pParam;
     }
 
-    // clean up the task look up table
-    m_ppTaskLookUpTable.resize(MFX_MAX_NUMBER_TASK, nullptr);
-
-    // allocate the dependency table
-    m_pDependencyTable.resize(MFX_MAX_NUMBER_TASK * 2, MFX_DEPENDENCY_ITEM());
-
-    // allocate the thread assignment object table.
-    // its size should be equal to the number of task,
-    // larger table is not required.
-    m_occupancyTable.resize(MFX_MAX_NUMBER_TASK, MFX_THREAD_ASSIGNMENT());
+    // allocate the task, dependency and thread assignment tables
+    AllocateTables();
 
     if (MFX_SINGLE_THREAD != m_param.flags)
     {
@@ -196,10 +188,12 @@ mfxStatus mfxSchedulerCore::Synchronize(mfxTaskHandle handle, mfxU32 timeToWait)
 
             guard.unlock();
 
+            const mfxU64 start = GetHighPerformanceCounter();
             call.res = call.pTask->entryPoint.pRoutine(call.pTask->entryPoint.pState,
                                                        call.pTask->entryPoint.pParam,
                                                        call.threadNum,
                                                        call.callNum);
+            call.timeSpend = GetHighPerformanceCounter() - start;
 
             guard.lock();
 
@@ -247,7 +241,8 @@ mfxStatus mfxSchedulerCore::Synchronize(mfxTaskHandle handle, mfxU32 timeToWait)
     }
     else
     {
-        std::unique_lock<std::mutex> guard(m_guard);
+        // the task status is guarded by the task itself in the work stealing mode
+        std::unique_lock<std::mutex> guard((IsWorkStealing()) ? (pTask->guard) : (m_guard));
 
         MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_PRIVATE, "Scheduler::Wait");
         MFX_LTRACE_1(MFX_TRACE_LEVEL_SCHED, "^Depends^on", "%d", pTask->param.task.nParentId);
@@ -293,21 +288,17 @@ mfxStatus mfxSchedulerCore::WaitForDependencyResolved(const void *pDependency)
 
     // find a handle to wait
     {
-        std::lock_guard<std::mutex> guard(m_guard);
-        mfxU32 curIdx;
+        std::lock_guard<std::mutex> guard((IsWorkStealing()) ? (m_tableGuard) : (m_guard));
+        const mfxU32 curIdx = FindDependency(pDependency);
 
-        for (curIdx = 0; curIdx < m_numDependencies; curIdx += 1)
+        if (MFX_INVALID_TABLE_INDEX != curIdx)
         {
-            if (m_pDependencyTable.at(curIdx).p == pDependency)
-            {
-                // get the handle before leaving protected section
-                waitHandle.taskID = m_pDependencyTable[curIdx].pTask->taskID;
-                waitHandle.jobID = m_pDependencyTable[curIdx].pTask->jobID;
+            // get the handle before leaving protected section
+            waitHandle.taskID = m_pDependencyTable[curIdx].pTask->taskID;
+            waitHandle.jobID = m_pDependencyTable[curIdx].pTask->jobID;
 
-                // handle is found, go to wait
-                bFind = true;
-                break;
-            }
+            // handle is found, go to wait
+            bFind = true;
         }
         // leave the protected section
     }
@@ -349,8 +340,10 @@ mfxStatus mfxSchedulerCore::WaitForAllTasksCompletion(const void *pOwner)
         std::lock_guard<std::mutex> guard(m_guard);
 
         ForEachTask(
-            [&pOwner, &tasks](MFX_SCHEDULER_TASK* task)
+            [this, &pOwner, &tasks](MFX_SCHEDULER_TASK* task)
             {
+                std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(task->guard);
+
                 //make a list of all 'active' tasks of given owner
                 if ((task->param.task.pOwner == pOwner) && (MFX_WRN_IN_EXECUTION == task->opRes))
                 {
@@ -541,33 +534,41 @@ mfxStatus mfxSchedulerCore::AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoi
 
         // initialize the task
         m_pFreeTasks->ResetDependency();
-        mfxRes = m_pFreeTasks->Reset();
-        if (MFX_ERR_NONE != mfxRes)
         {
-            return mfxRes;
+            std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(m_pFreeTasks->guard);
+
+            mfxRes = m_pFreeTasks->Reset();
+            if (MFX_ERR_NONE != mfxRes)
+            {
+                return mfxRes;
+            }
         }
         m_pFreeTasks->param.task = task;
+        m_pFreeTasks->param.timing.timeAdded = GetHighPerformanceCounter();
+
+        // last entries in the dependency arrays of INTRA tasks must be empty.
+        // Check it before taking an occupancy entry, so a new entry never
+        // stays in the table without references.
+        if ((MFX_TASK_INTRA & task.threadingPolicy) &&
+            ((task.pSrc[MFX_TASK_NUM_DEPENDENCIES - 1]) ||
+             (task.pDst[MFX_TASK_NUM_DEPENDENCIES - 1])))
+        {
+            return MFX_ERR_INVALID_VIDEO_PARAM;
+        }
+
+        // working threads update the tables in the work stealing mode
+        std::unique_lock<std::mutex> tableGuard = LockForWorkStealing(m_tableGuard);
+
         mfxRes = GetOccupancyTableIndex(occupancyIdx, &task);
         if (MFX_ERR_NONE != mfxRes)
         {
             return mfxRes;
         }
-        if (m_occupancyTable.size() <= occupancyIdx)
-        {
-            return MFX_ERR_UNDEFINED_BEHAVIOR;
-        }
         pAssignment = &(m_occupancyTable[occupancyIdx]);
 
         // update the thread assignment parameters
         if (MFX_TASK_INTRA & task.threadingPolicy)
         {
-            // last entries in the dependency arrays must be empty
-            if ((m_pFreeTasks->param.task.pSrc[MFX_TASK_NUM_DEPENDENCIES - 1]) ||
-                (m_pFreeTasks->param.task.pDst[MFX_TASK_NUM_DEPENDENCIES - 1]))
-            {
-                return MFX_ERR_INVALID_VIDEO_PARAM;
-            }
-
             // fill INTRA task dependencies
             m_pFreeTasks->param.task.pSrc[MFX_TASK_NUM_DEPENDENCIES - 1] = pAssignment->pLastTask;
             m_pFreeTasks->param.task.pDst[MFX_TASK_NUM_DEPENDENCIES - 1] = m_pFreeTasks;
@@ -595,9 +596,28 @@ mfxStatus mfxSchedulerCore::AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoi
         handle.jobID = m_pFreeTasks->jobID;
         *pSyncPoint = (mfxSyncPoint) handle.handle;
 
+        // all checks have passed, the task is going to be queued
+        m_pFreeTasks->param.routineStatIdx = GetRoutineStatIndex(task);
+
         // Register task dependencies
         RegisterTaskDependencies(m_pFreeTasks);
 
+        // queue the task, if its inputs are ready.
+        // Otherwise the last resolved dependency queues it.
+        bool bQueue = false;
+
+        if (IsWorkStealing())
+        {
+            std::lock_guard<std::mutex> taskGuard(m_pFreeTasks->guard);
+
+            m_pFreeTasks->param.bInputsReady = m_pFreeTasks->IsDependenciesResolved();
+            bQueue = (m_pFreeTasks->param.bInputsReady) &&
+                     (MFX_TASK_NEED_CONTINUE == m_pFreeTasks->curStatus);
+            m_pFreeTasks->param.numHints = (bQueue) ? (1) : (0);
+
+            tableGuard.unlock();
+        }
+
 
         //
         // move task to the corresponding task
@@ -618,6 +638,7 @@ mfxStatus mfxSchedulerCore::AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoi
 
         // add the task to the end of the corresponding queue
         *ppTemp = pTask;
+        m_routineStat[pTask->param.routineStatIdx].numTasks += 1;
 
         // reset all 'waiting' tasks to prevent freezing
         // so called 'permanent' tasks.
@@ -632,8 +653,14 @@ mfxStatus mfxSchedulerCore::AddTask(const MFX_TASK &task, mfxSyncPoint *pSyncPoi
             num_sw_threads = numThreads;
         }
 
+        // spread tasks added by external threads over the thread queues
+        if (IsWorkStealing()) {
+            if (bQueue) {
+                PushReadyTask(handle, task.priority, type, m_nextHintThreadNum++ % m_param.numberOfThreads);
+            }
+        }
         // wake up working threads if task has resolved dependencies
-        if (IsReadyToRun(pTask)) {
+        else if (IsReadyToRun(pTask)) {
             WakeUpThreads(num_hw_threads, num_sw_threads);
         }
 
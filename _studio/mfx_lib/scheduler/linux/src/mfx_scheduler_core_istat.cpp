@@ -0,0 +1,219 @@
+// Copyright (c) 2024 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mfx_scheduler_core.h>
+#include <mfx_scheduler_core_task.h>
+
+#include <string.h>
+#include <algorithm>
+
+// declare the static section of the file
+namespace
+{
+
+// name of tasks without the routine name, the same as used for tracing
+const char DefaultRoutineName[] = "MFX Async Task";
+// name of the entry accumulating routines, which don't fit into the table
+const char OtherRoutinesName[] = "Other";
+
+} // namespace
+
+void mfxSchedulerCore::UpdateHistogram(mfxU64 histogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS], mfxU64 time)
+{
+    mfxU32 bin = 0;
+
+    // bin number is the number of significant bits of the time value
+    while ((time) && (MFX_SCHEDULER_STAT_HISTOGRAM_BINS - 1 > bin))
+    {
+        time >>= 1;
+        bin += 1;
+    }
+
+    histogram[bin] += 1;
+
+} // void mfxSchedulerCore::UpdateHistogram(mfxU64 histogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS], mfxU64 time)
+
+mfxU32 mfxSchedulerCore::GetRoutineStatIndex(const MFX_TASK &task)
+{
+    const char *pRoutineName = (task.entryPoint.pRoutineName) ?
+        (task.entryPoint.pRoutineName) :
+        (DefaultRoutineName);
+    // the last entry is reserved for routines, which don't fit into the table
+    const mfxU32 numNamed = std::min<mfxU32>(m_numRoutineStat, MFX_SCHEDULER_STAT_MAX_ROUTINES - 1);
+    mfxU32 i;
+
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    // routine names are string literals, compare pointers first
+    for (i = 0; i < numNamed; i += 1)
+    {
+        if (m_routineStat[i].pRoutineName == pRoutineName)
+        {
+            return i;
+        }
+    }
+    for (i = 0; i < numNamed; i += 1)
+    {
+        if (0 == strcmp(m_routineStat[i].pRoutineName, pRoutineName))
+        {
+            return i;
+        }
+    }
+
+    // all named entries are taken, use the overflow entry
+    if (MFX_SCHEDULER_STAT_MAX_ROUTINES - 1 == numNamed)
+    {
+        i = MFX_SCHEDULER_STAT_MAX_ROUTINES - 1;
+        m_routineStat[i].pRoutineName = OtherRoutinesName;
+        m_numRoutineStat = MFX_SCHEDULER_STAT_MAX_ROUTINES;
+
+        return i;
+    }
+
+    i = m_numRoutineStat;
+    m_numRoutineStat += 1;
+    m_routineStat[i].pRoutineName = pRoutineName;
+
+    return i;
+
+} // mfxU32 mfxSchedulerCore::GetRoutineStatIndex(const MFX_TASK &task)
+
+mfxStatus mfxSchedulerCore::GetStat(MFX_SCHEDULER_STAT *pStat)
+{
+    mfxU32 i;
+
+    // check error(s)
+    if (0 == m_param.numberOfThreads)
+    {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+    if (NULL == pStat)
+    {
+        return MFX_ERR_NULL_PTR;
+    }
+
+    memset(pStat, 0, sizeof(MFX_SCHEDULER_STAT));
+
+    // enter guarded section
+    std::lock_guard<std::mutex> guard(m_guard);
+
+    // threads utilization. There are no threads in the single thread mode.
+    if (m_pThreadCtx)
+    {
+        std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+        pStat->numberOfThreads = std::min<mfxU32>(m_param.numberOfThreads, MFX_SCHEDULER_STAT_MAX_THREADS);
+        for (i = 0; i < pStat->numberOfThreads; i += 1)
+        {
+            const MFX_SCHEDULER_THREAD_CONTEXT *pContext = GetThreadCtx(i);
+
+            pStat->threads[i].workTime = pContext->workTime;
+            pStat->threads[i].sleepTime = pContext->sleepTime;
+            pStat->threads[i].numCalls = pContext->numCalls;
+            pStat->threads[i].bRunning = (MFX_SCHEDULER_THREAD_CONTEXT::Running == pContext->state);
+        }
+    }
+
+    // queue depths
+    ForEachTask(
+        [this, pStat](MFX_SCHEDULER_TASK *task)
+        {
+            const mfxPriority priority = task->param.task.priority;
+            std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(task->guard);
+
+            if (MFX_WRN_IN_EXECUTION == task->opRes)
+            {
+                std::unique_lock<std::mutex> assignmentGuard;
+
+                // the occupancy is updated by working threads in the work stealing mode
+                if ((IsWorkStealing()) &&
+                    (MFX_TASK_NEED_CONTINUE == task->curStatus))
+                {
+                    assignmentGuard = std::unique_lock<std::mutex>(GetAssignmentGuard(task->param.pThreadAssignment).guard);
+                }
+
+                pStat->numQueuedTasks[priority] += 1;
+                pStat->numReadyTasks[priority] += (IsReadyToRun(task)) ? (1) : (0);
+            }
+        }
+    );
+
+    std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+    for (i = 0; i < MFX_SCHEDULER_STAT_PRIORITIES; i += 1)
+    {
+        pStat->numRunningCalls[i] = m_numAssignedTasks[i];
+    }
+
+    // task latencies
+    std::copy(std::begin(m_waitTimeHistogram), std::end(m_waitTimeHistogram), pStat->waitTimeHistogram);
+    pStat->numDependencyStalls = m_numDependencyStalls;
+    pStat->numRoutines = m_numRoutineStat;
+    std::copy(m_routineStat, m_routineStat + m_numRoutineStat, pStat->routines);
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus mfxSchedulerCore::GetStat(MFX_SCHEDULER_STAT *pStat)
+
+mfxStatus mfxSchedulerCore::ResetStat(void)
+{
+    mfxU32 i;
+
+    // check error(s)
+    if (0 == m_param.numberOfThreads)
+    {
+        return MFX_ERR_NOT_INITIALIZED;
+    }
+
+    // enter guarded section
+    std::lock_guard<std::mutex> guard(m_guard);
+    std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+    if (m_pThreadCtx)
+    {
+        for (i = 0; i < m_param.numberOfThreads; i += 1)
+        {
+            MFX_SCHEDULER_THREAD_CONTEXT *pContext = GetThreadCtx(i);
+
+            pContext->workTime = 0;
+            pContext->sleepTime = 0;
+            pContext->numCalls = 0;
+        }
+    }
+
+    memset(m_waitTimeHistogram, 0, sizeof(m_waitTimeHistogram));
+    m_numDependencyStalls = 0;
+
+    // tasks in flight keep indices of the routine entries,
+    // so the entries are only zeroed.
+    for (i = 0; i < m_numRoutineStat; i += 1)
+    {
+        const char *pRoutineName = m_routineStat[i].pRoutineName;
+
+        memset(m_routineStat + i, 0, sizeof(MFX_SCHEDULER_ROUTINE_STAT));
+        m_routineStat[i].pRoutineName = pRoutineName;
+    }
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus mfxSchedulerCore::ResetStat(void)
@@ -59,8 +59,13 @@ void MFX_SCHEDULER_TASK::OnDependencyResolved(mfxStatus result)
         // need to propogate error status to all dependent tasks.
         //if (MFX_TASK_WAIT & param.task.threadingPolicy)
         {
+            // the guard is used by the work stealing scheduler only,
+            // it is free otherwise
+            std::lock_guard<std::mutex> taskGuard(guard);
+
             opRes = result;
             curStatus = result;
+            done.notify_all();
         }
         // all other tasks are aborted
         //else
@@ -71,7 +76,6 @@ void MFX_SCHEDULER_TASK::OnDependencyResolved(mfxStatus result)
 
         // need to update dependency table for all tasks dependent from failed 
         m_pSchedulerCore->ResolveDependencyTable(this);
-        done.notify_all();
 
         // release the current task resources
         ReleaseResources();
@@ -117,6 +121,11 @@ void MFX_SCHEDULER_TASK::ReleaseResources(void)
         {
             param.pThreadAssignment->pLastTask = NULL;
         }
+        // let the scheduler reuse the table entry
+        if (0 == param.pThreadAssignment->m_numRefs)
+        {
+            m_pSchedulerCore->OnOccupancyReleased(param.pThreadAssignment);
+        }
     }
 
     // thread assignment info is not required for the task any more
@@ -48,6 +48,13 @@ enum
     MFX_WAIT_TIME_MS            = 1
 };
 
+inline
+int GetTaskType(mfxU32 threadingPolicy)
+{
+    return (MFX_TASK_DEDICATED & threadingPolicy) ? (MFX_TYPE_HARDWARE) : (MFX_TYPE_SOFTWARE);
+
+} // int GetTaskType(mfxU32 threadingPolicy)
+
 } // namespace
 
 int mfxSchedulerCore::GetTaskPriority(mfxTaskHandle task)
@@ -123,13 +130,21 @@ mfxStatus mfxSchedulerCore::GetTask(MFX_CALL_INFO &callInfo,
     mfxU64 totalTimeSpent[MFX_PRIORITY_NUMBER], timeSpent[MFX_PRIORITY_NUMBER];
 
     // get the current time stamp
-    m_currentTimeStamp = GetHighPerformanceCounter();
+    callInfo.timeStamp = GetHighPerformanceCounter();
 
     // get time spent statistic
-    GetTimeStat(timeSpent, totalTimeSpent);
+    {
+        std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+        GetTimeStat(timeSpent, totalTimeSpent);
+    }
 
-    // get the priority of the previous task
-    prevTaskPriority = GetTaskPriority(previousTask);
+    // get the priority of the previous task.
+    // In the work stealing mode continuations are queued by the thread itself.
+    if (!IsWorkStealing())
+    {
+        prevTaskPriority = GetTaskPriority(previousTask);
+    }
 
     // there are three runs over the tasks lists. On the 1st run,
     // the scheduler keeping workload balance, which is described by
@@ -161,7 +176,18 @@ mfxStatus mfxSchedulerCore::GetTask(MFX_CALL_INFO &callInfo,
                      type <= MFX_TYPE_SOFTWARE;
                      type += 1)
                 {
-                    MFX_SCHEDULER_TASK *pTask = m_pTasks[priority][type];
+                    MFX_SCHEDULER_TASK *pTask;
+
+                    // take the task from the ready queues
+                    if (IsWorkStealing())
+                    {
+                        if (MFX_ERR_NONE == GetReadyTask(callInfo, priority, type, threadNum))
+                        {
+                            return MFX_ERR_NONE;
+                        }
+                        continue;
+                    }
+                    pTask = m_pTasks[priority][type];
 
                     // try to continue the previous task
                     if (prevTaskPriority == priority)
@@ -276,15 +302,22 @@ bool mfxSchedulerCore::IsReadyToRun(MFX_SCHEDULER_TASK *pTask)
         return false;
     }
     // or dependencies are not resolved
-    if (false == pTask->IsDependenciesResolved()) {
+    if (IsWorkStealing()) {
+        if (false == pTask->param.bInputsReady) {
+            return false;
+        }
+    } else if (false == pTask->IsDependenciesResolved()) {
         return false;
     }
     // or there is no proper thread number
     if (MFX_INVALID_THREAD_NUMBER == GetFreeThreadNumber(*(pTask->param.pThreadAssignment), pTask)) {
         return false;
     }
-    // or task is still waiting
-    if (pTask->param.bWaiting) {
+    // or task is still waiting.
+    // The 'waiting' flag is reset by the owner's counter in the work stealing mode.
+    if ((pTask->param.bWaiting) &&
+        ((!IsWorkStealing()) ||
+         (pTask->param.waitingGeneration == GetWaitingGeneration(pTask->param.task.pOwner)))) {
         // prevent entering more than 1 thread in 'waiting' task,
         // let the thread inspect other tasks.
         if (pTask->param.occupancy) {
@@ -333,8 +366,21 @@ mfxStatus mfxSchedulerCore::WrapUpTask(MFX_CALL_INFO &callInfo,
     callInfo.threadNum = GetFreeThreadNumber(occupancyInfo, pTask);
     callInfo.callNum = pTask->param.numberOfCalls;
 
-    // update the scheduler
-    m_numAssignedTasks[pTask->param.task.priority] += 1;
+    {
+        std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+        // account the time the task was waiting for the first call
+        if (0 == pTask->param.numberOfCalls)
+        {
+            const mfxU64 waitTime = callInfo.timeStamp - pTask->param.timing.timeAdded;
+
+            UpdateHistogram(m_waitTimeHistogram, waitTime);
+            m_routineStat[pTask->param.routineStatIdx].waitTime += waitTime;
+        }
+
+        // update the scheduler
+        m_numAssignedTasks[pTask->param.task.priority] += 1;
+    }
 
     // update the number of assigned threads
     occupancyInfo.taskOccupancy += (0 == pTask->param.occupancy) ? (1) : (0);
@@ -349,16 +395,19 @@ mfxStatus mfxSchedulerCore::WrapUpTask(MFX_CALL_INFO &callInfo,
     pTask->param.numberOfCalls += 1;
 
     // update the task's timing
-    pTask->param.timing.timeLastEnter = m_currentTimeStamp;
-    pTask->param.timing.timeLastCallIssued = m_currentTimeStamp;
+    pTask->param.timing.timeLastEnter = callInfo.timeStamp;
+    pTask->param.timing.timeLastCallIssued = callInfo.timeStamp;
     pTask->param.timing.hwCounterLastEnter = GetHWEventCounter();
     // create handle
     callInfo.taskHandle.taskID = pTask->taskID;
     callInfo.taskHandle.jobID = pTask->jobID;
     // set the task pointer
     callInfo.pTask = &pTask->param.task;
-    // set the time stamp of task release
-    callInfo.timeStamp = m_currentTimeStamp;
+    // save the owner's 'waiting' reset count of the call
+    if (IsWorkStealing())
+    {
+        callInfo.waitingGeneration = GetWaitingGeneration(pTask->param.task.pOwner);
+    }
 
 
     return MFX_ERR_NONE;
@@ -367,6 +416,13 @@ mfxStatus mfxSchedulerCore::WrapUpTask(MFX_CALL_INFO &callInfo,
 
 void mfxSchedulerCore::ResetWaitingTasks(const void *pOwner)
 {
+    // the owner's tasks compare the counter with the saved value
+    if (IsWorkStealing())
+    {
+        GetWaitingGeneration(pOwner) += 1;
+        return;
+    }
+
     ForEachTask(
         [pOwner](MFX_SCHEDULER_TASK* task)
         {
@@ -387,6 +443,33 @@ void mfxSchedulerCore::ResetWaitingTasks(const void *pOwner)
 
 void mfxSchedulerCore::OnDependencyResolved(MFX_SCHEDULER_TASK *pTask)
 {
+    //
+    // THE EXECUTION IS ALREADY IN SECURE SECTION.
+    // Just do what need to do.
+    //
+
+    // the task is queued on the thread, which resolved the last dependency
+    if (IsWorkStealing()) {
+        if (pTask->IsDependenciesResolved()) {
+            std::lock_guard<std::mutex> taskGuard(pTask->guard);
+
+            pTask->param.bInputsReady = true;
+            if ((MFX_TASK_NEED_CONTINUE == pTask->curStatus) &&
+                (0 == pTask->param.numHints)) {
+                mfxTaskHandle handle = {};
+
+                handle.taskID = pTask->taskID;
+                handle.jobID = pTask->jobID;
+                pTask->param.numHints = 1;
+                PushReadyTask(handle,
+                              pTask->param.task.priority,
+                              GetTaskType(pTask->param.task.threadingPolicy),
+                              m_hintThreadNum);
+            }
+        }
+        return;
+    }
+
     if (IsReadyToRun(pTask)) {
         if (MFX_TASK_DEDICATED & pTask->param.task.threadingPolicy) {
             m_DedicatedThreadsToWakeUp += pTask->param.task.entryPoint.requiredNumThreads;
@@ -399,9 +482,6 @@ void mfxSchedulerCore::OnDependencyResolved(MFX_SCHEDULER_TASK *pTask)
 void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
                                          const mfxU32 threadNum)
 {
-    (void)pCallInfo;
-    (void)threadNum;
-
     MFX_SCHEDULER_TASK *pTask = nullptr;
     pTask = m_ppTaskLookUpTable.at(pCallInfo->taskHandle.taskID);
 
@@ -415,144 +495,280 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
     mfxU32 nTraceTaskId = 0;
     mfxU32 curTime;
 
-    MFX_THREAD_ASSIGNMENT &occupancyInfo = *(pTask->param.pThreadAssignment);
-
-    // update working time
-    curTime = GetLowResCurrentTime();
-    if (m_workingTime[m_timeIdx].startTime + MFX_TIME_STAT_PERIOD / MFX_TIME_STAT_PARTS <
-        curTime)
     {
-        // advance the working time index. The current entry is out of time.
-        m_timeIdx = (m_timeIdx + 1) % MFX_TIME_STAT_PARTS;
-        memset(m_workingTime + m_timeIdx, 0, sizeof(m_workingTime[m_timeIdx]));
-        m_workingTime[m_timeIdx].startTime = curTime;
-    }
-    m_workingTime[m_timeIdx].time[pTask->param.task.priority] += pCallInfo->timeSpend;
+        std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
 
-    // update the scheduler
-    m_numAssignedTasks[pTask->param.task.priority] -= 1;
+        // update working time
+        curTime = GetLowResCurrentTime();
+        if (m_workingTime[m_timeIdx].startTime + MFX_TIME_STAT_PERIOD / MFX_TIME_STAT_PARTS <
+            curTime)
+        {
+            // advance the working time index. The current entry is out of time.
+            m_timeIdx = (m_timeIdx + 1) % MFX_TIME_STAT_PARTS;
+            memset(m_workingTime + m_timeIdx, 0, sizeof(m_workingTime[m_timeIdx]));
+            m_workingTime[m_timeIdx].startTime = curTime;
+        }
+        m_workingTime[m_timeIdx].time[pTask->param.task.priority] += pCallInfo->timeSpend;
 
-    // clean up the task object
-    pTask->param.occupancy -= 1;
-    pTask->param.threadMask &= ~(1LL << pCallInfo->threadNum);
-    if (0 == (MFX_TASK_INTER & occupancyInfo.threadingPolicy))
-    {
-        occupancyInfo.occupancy -= 1;
-        occupancyInfo.threadMask &= ~(1LL << pCallInfo->threadNum);
+        // update the routine statistic
+        {
+            MFX_SCHEDULER_ROUTINE_STAT &routineStat = m_routineStat[pTask->param.routineStatIdx];
+
+            routineStat.numCalls += 1;
+            routineStat.runTime += pCallInfo->timeSpend;
+            UpdateHistogram(routineStat.runTimeHistogram, pCallInfo->timeSpend);
+        }
+
+        // update the scheduler
+        m_numAssignedTasks[pTask->param.task.priority] -= 1;
     }
-    occupancyInfo.taskOccupancy -= (0 == pTask->param.occupancy) ? (1) : (0);
 
     // Below we will notify dependent tasks that this task is done and
     // scheduler will get notifications from dependent tasks that their
     // dependencies are resolved. Upon these notifications scheduler will
     // calculate how many threads we need to wakeup to handle dependent
-    // tasks.
-    m_DedicatedThreadsToWakeUp = 0;
-    m_RegularThreadsToWakeUp = 0;
-
-    // try to not overwrite the newest status from other thread
-    if (pTask->param.timing.timeLastCallProcessed < pCallInfo->timeStamp)
+    // tasks. In the work stealing mode dependent tasks are queued instead.
+    if (!IsWorkStealing())
     {
-        pTask->param.timing.timeLastCallProcessed = pCallInfo->timeStamp;
+        m_DedicatedThreadsToWakeUp = 0;
+        m_RegularThreadsToWakeUp = 0;
     }
-    // update the status of the current job
-    if (isFailed(pCallInfo->res))
+
+    //
+    // update task status and tasks dependencies
+    //
+
+    if (LeaveTask(pCallInfo, pTask, threadNum))
     {
-        pTask->curStatus = pCallInfo->res;
+        // store TaskId for tracing event.
+        // The task object can be reused after the retirement.
+        nTraceTaskId = pCallInfo->pTask->nTaskId;
+
+        taskReleased = RetireTask(pTask, threadNum);
     }
-    // do not overwrite the failed status with successful one
-    else if ((MFX_TASK_DONE == pCallInfo->res) &&
-                (MFX_TASK_NEED_CONTINUE == pTask->curStatus))
-    {
-        pTask->curStatus = pCallInfo->res;
 
-        // reset all waiting tasks with the given working object
-        ResetWaitingTasks(pCallInfo->pTask->pOwner);
+    // wake up additional threads for this task and tasks dependent
+    if ((!IsWorkStealing()) &&
+        (m_DedicatedThreadsToWakeUp || m_RegularThreadsToWakeUp)) {
+        WakeUpThreads(m_DedicatedThreadsToWakeUp, m_RegularThreadsToWakeUp);
     }
-    // update the task timing
-    else if (MFX_TASK_BUSY == pCallInfo->res)
+
+    // wake up external threads waiting for a free task object
+    if (taskReleased)
     {
-        // try to not overwrite the newest status from other thread
-        if (pTask->param.timing.timeLastCallProcessed <= pCallInfo->timeStamp)
+        // working threads don't hold the common guard in the work stealing
+        // mode. Pass through it to not lose the notification, if AddTask has
+        // just checked the counter.
+        if ((0 == m_freeTasksCount++) && IsWorkStealing())
         {
-            pTask->param.bWaiting = true;
+            std::lock_guard<std::mutex> guard(m_guard);
         }
-        pTask->param.timing.timeOverhead += pCallInfo->timeSpend;
+        m_freeTasks.notify_one();
     }
-    else
+
+    // send tracing event
+    if (nTraceTaskId)
     {
-        // reset all waiting tasks with the given working object
-        ResetWaitingTasks(pCallInfo->pTask->pOwner);
+        MFX_LTRACE_1(MFX_TRACE_LEVEL_SCHED, "^Completed^", "%d", nTraceTaskId);
     }
-    pTask->param.timing.timeSpent += pCallInfo->timeSpend;
 
-    //
-    // update task status and tasks dependencies
-    //
+}
+
+bool mfxSchedulerCore::LeaveTask(const MFX_CALL_INFO *pCallInfo,
+                                 MFX_SCHEDULER_TASK *pTask,
+                                 const mfxU32 threadNum)
+{
+    MFX_THREAD_ASSIGNMENT &occupancyInfo = *(pTask->param.pThreadAssignment);
+    std::vector<mfxTaskHandle> blockedTasks[MFX_PRIORITY_NUMBER];
+    int type = MFX_TYPE_SOFTWARE;
+    bool bRetire;
 
-    if (0 == pTask->param.occupancy)
     {
-        // complete the task if it is done
-        if ((isFailed(pTask->curStatus)) ||
-            (MFX_TASK_DONE == pTask->curStatus))
+        std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(pTask->guard);
+        std::unique_lock<std::mutex> assignmentGuard;
+
+        if (IsWorkStealing())
         {
-            // store TaskId for tracing event
-            nTraceTaskId = pCallInfo->pTask->nTaskId;
+            MFX_THREAD_ASSIGNMENT_GUARD &assignment = GetAssignmentGuard(&occupancyInfo);
+            int priority;
 
-            // get entry point parameters to call FreeResources
-            MFX_ENTRY_POINT &entryPoint = pTask->param.task.entryPoint;
+            assignmentGuard = std::unique_lock<std::mutex>(assignment.guard);
 
-            if (entryPoint.pCompleteProc)
+            // the thread leaves the entry,
+            // tasks blocked by its occupancy are queued again below
+            for (priority = MFX_PRIORITY_LOW; priority < MFX_PRIORITY_NUMBER; priority += 1)
             {
-                mfxStatus mfxRes;
+                blockedTasks[priority].swap(assignment.blockedTasks[priority]);
+            }
+            type = GetTaskType(occupancyInfo.threadingPolicy);
+        }
 
-                // temporarily leave the protected code section
-                m_guard.unlock();
+        // clean up the task object
+        pTask->param.occupancy -= 1;
+        pTask->param.threadMask &= ~(1LL << pCallInfo->threadNum);
+        if (0 == (MFX_TASK_INTER & occupancyInfo.threadingPolicy))
+        {
+            occupancyInfo.occupancy -= 1;
+            occupancyInfo.threadMask &= ~(1LL << pCallInfo->threadNum);
+        }
+        occupancyInfo.taskOccupancy -= (0 == pTask->param.occupancy) ? (1) : (0);
 
-                mfxRes = pTask->CompleteTask(pTask->curStatus);
-                if ((isFailed(mfxRes)) &&
-                    (MFX_ERR_NONE == pTask->curStatus)) {
+        // try to not overwrite the newest status from other thread
+        if (pTask->param.timing.timeLastCallProcessed < pCallInfo->timeStamp)
+        {
+            pTask->param.timing.timeLastCallProcessed = pCallInfo->timeStamp;
+        }
+        // update the status of the current job
+        if (isFailed(pCallInfo->res))
+        {
+            pTask->curStatus = pCallInfo->res;
+        }
+        // do not overwrite the failed status with successful one
+        else if ((MFX_TASK_DONE == pCallInfo->res) &&
+                    (MFX_TASK_NEED_CONTINUE == pTask->curStatus))
+        {
+            pTask->curStatus = pCallInfo->res;
 
-                    pTask->curStatus = mfxRes;
-                }
+            // reset all waiting tasks with the given working object
+            ResetWaitingTasks(pCallInfo->pTask->pOwner);
+        }
+        // update the task timing
+        else if (MFX_TASK_BUSY == pCallInfo->res)
+        {
+            // try to not overwrite the newest status from other thread
+            if ((pTask->param.timing.timeLastCallProcessed <= pCallInfo->timeStamp) &&
+                ((!IsWorkStealing()) ||
+                 (pCallInfo->waitingGeneration == GetWaitingGeneration(pCallInfo->pTask->pOwner))))
+            {
+                pTask->param.bWaiting = true;
+                pTask->param.waitingGeneration = pCallInfo->waitingGeneration;
+            }
+            pTask->param.timing.timeOverhead += pCallInfo->timeSpend;
+        }
+        else
+        {
+            // reset all waiting tasks with the given working object
+            ResetWaitingTasks(pCallInfo->pTask->pOwner);
+        }
+        pTask->param.timing.timeSpent += pCallInfo->timeSpend;
+
+        // the last thread leaves the done or failed task
+        bRetire = (0 == pTask->param.occupancy) &&
+                  ((isFailed(pTask->curStatus)) ||
+                   (MFX_TASK_DONE == pTask->curStatus));
+
+        // the thread continues the task, unless other threads are hinted
+        if ((IsWorkStealing()) &&
+            (MFX_TASK_NEED_CONTINUE == pTask->curStatus) &&
+            (pTask->param.bInputsReady) &&
+            (0 == pTask->param.numHints))
+        {
+            pTask->param.numHints = 1;
+            PushReadyTask(pCallInfo->taskHandle,
+                          pTask->param.task.priority,
+                          type,
+                          threadNum,
+                          true);
+        }
+    }
+
+    // queue tasks blocked by the occupancy of the entry
+    for (int priority = MFX_PRIORITY_LOW; priority < MFX_PRIORITY_NUMBER; priority += 1)
+    {
+        for (const mfxTaskHandle &handle : blockedTasks[priority])
+        {
+            PushReadyTask(handle, priority, type, threadNum);
+        }
+    }
+
+    return bRetire;
+
+} // bool mfxSchedulerCore::LeaveTask(const MFX_CALL_INFO *pCallInfo,
+
+bool mfxSchedulerCore::RetireTask(MFX_SCHEDULER_TASK *pTask, const mfxU32 threadNum)
+{
+    bool taskReleased = false;
 
-                // enter the protected code section
-                m_guard.lock();
+    // get entry point parameters to call FreeResources
+    MFX_ENTRY_POINT &entryPoint = pTask->param.task.entryPoint;
+
+    if (entryPoint.pCompleteProc)
+    {
+        mfxStatus mfxRes;
+
+        // temporarily leave the protected code section
+        if (!IsWorkStealing())
+        {
+            m_guard.unlock();
+        }
+
+        mfxRes = pTask->CompleteTask(pTask->curStatus);
+        {
+            std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(pTask->guard);
+
+            if ((isFailed(mfxRes)) &&
+                (MFX_ERR_NONE == pTask->curStatus)) {
+
+                pTask->curStatus = mfxRes;
             }
         }
 
-        // update the failed task status
-        if (isFailed(pTask->curStatus))
+        // enter the protected code section
+        if (!IsWorkStealing())
+        {
+            m_guard.lock();
+        }
+    }
+
+    std::unique_lock<std::mutex> tableGuard = LockForWorkStealing(m_tableGuard);
+
+    // dependent tasks are queued on the current thread
+    m_hintThreadNum = threadNum;
+
+    // The status is published after the tables update. Once it is set,
+    // the task object can be reused.
+
+    // update the failed task status
+    if (isFailed(pTask->curStatus))
+    {
+        // update dependencies produced from the dependency table
+        ResolveDependencyTable(pTask);
+
+        // mark all dependent task as 'failed'
+        pTask->ResolveDependencies(pTask->curStatus);
+        // release all allocated resources
+        pTask->ReleaseResources();
+
         {
-            //mfxU32 i;
+            std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(pTask->guard);
 
             // save the status
             pTask->opRes = pTask->curStatus;
 
             pTask->done.notify_all();
+        }
+    }
+    // process task completed
+    else if (MFX_TASK_DONE == pTask->curStatus)
+    {
+        mfxU32 i;
 
-            // update dependencies produced from the dependency table
-            //for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
-            //{
-            //    if (pTask->param.task.pDst[i])
-            //    {
-            //        mfxU32 idx = pTask->param.dependencies.dstIdx[i];
-
-            //        m_pDependencyTable[idx].mfxRes = pTask->curStatus;
-            //    }
-            //}
-            ResolveDependencyTable(pTask);
-
-            // mark all dependent task as 'failed'
-            pTask->ResolveDependencies(pTask->curStatus);
-            // release all allocated resources
-            pTask->ReleaseResources();
-        }
-        // process task completed
-        else if (MFX_TASK_DONE == pTask->curStatus)
+        // remove dependencies produced from the dependency table
+        for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
         {
-            mfxU32 i;
+            if (pTask->param.task.pDst[i])
+            {
+                RemoveDependency(pTask->param.dependencies.dstIdx[i]);
+            }
+        }
+
+        // mark all dependent task as 'ready'
+        pTask->ResolveDependencies(MFX_ERR_NONE);
+        // release all allocated resources
+        pTask->ReleaseResources();
 
+        {
+            std::unique_lock<std::mutex> taskGuard = LockForWorkStealing(pTask->guard);
 
             // reset jobID to avoid false waiting on complete tasks, which were reused
             pTask->jobID = 0;
@@ -560,48 +776,181 @@ void mfxSchedulerCore::MarkTaskCompleted(const MFX_CALL_INFO *pCallInfo,
             pTask->opRes = MFX_ERR_NONE;
 
             pTask->done.notify_all();
+        }
+
+        // task object becomes free
+        taskReleased = true;
+    }
+
+    return taskReleased;
+
+} // bool mfxSchedulerCore::RetireTask(MFX_SCHEDULER_TASK *pTask, const mfxU32 threadNum)
+
+void mfxSchedulerCore::PushReadyTask(mfxTaskHandle handle,
+                                     int priority,
+                                     int type,
+                                     mfxU32 threadNum,
+                                     bool bContinuation)
+{
+    const mfxU32 numThreads = m_param.numberOfThreads;
+    mfxU32 i;
+
+    // only the thread #0 runs dedicated tasks
+    if (MFX_TYPE_HARDWARE == type)
+    {
+        threadNum = 0;
+    }
+
+    {
+        MFX_SCHEDULER_THREAD_CONTEXT *thctx = GetThreadCtx(threadNum);
+        std::lock_guard<std::mutex> readyGuard(thctx->readyGuard);
+
+        if (bContinuation)
+        {
+            thctx->readyTasks[priority][type].push_front(handle);
+        }
+        else
+        {
+            thctx->readyTasks[priority][type].push_back(handle);
+        }
+    }
+
+    // the running thread is going to get its continuation
+    if (bContinuation)
+    {
+        return;
+    }
+
+    // wake up the owner of the queue or any other sleeping thread,
+    // which can steal the task
+    for (i = 0; i < numThreads; i += 1)
+    {
+        MFX_SCHEDULER_THREAD_CONTEXT *thctx = GetThreadCtx((threadNum + i) % numThreads);
+
+        if (MFX_SCHEDULER_THREAD_CONTEXT::Waiting == thctx->state)
+        {
+            WakeUpThread(thctx);
+            break;
+        }
+        if (MFX_TYPE_HARDWARE == type)
+        {
+            break;
+        }
+    }
+
+} // void mfxSchedulerCore::PushReadyTask(mfxTaskHandle handle,
+
+mfxStatus mfxSchedulerCore::GetReadyTask(MFX_CALL_INFO &callInfo,
+                                         int priority,
+                                         int type,
+                                         const mfxU32 threadNum)
+{
+    const mfxU32 numThreads = m_param.numberOfThreads;
+    mfxU32 i;
+
+    // dedicated tasks are not stolen
+    const mfxU32 numVictims = (MFX_TYPE_HARDWARE == type) ? (1) : (numThreads);
+
+    for (i = 0; i < numVictims; i += 1)
+    {
+        MFX_SCHEDULER_THREAD_CONTEXT *thctx = GetThreadCtx((threadNum + i) % numThreads);
+
+        for (;;)
+        {
+            mfxTaskHandle handle;
 
-            // remove dependencies produced from the dependency table
-            for (i = 0; i < MFX_TASK_NUM_DEPENDENCIES; i += 1)
             {
-                if (pTask->param.task.pDst[i])
+                std::lock_guard<std::mutex> readyGuard(thctx->readyGuard);
+                std::deque<mfxTaskHandle> &readyTasks = thctx->readyTasks[priority][type];
+
+                if (readyTasks.empty())
                 {
-                    mfxU32 idx = pTask->param.dependencies.dstIdx[i];
+                    break;
+                }
 
-                    m_pDependencyTable.at(idx).p = nullptr;
+                // the own queue is served from the front, others from the back
+                if (0 == i)
+                {
+                    handle = readyTasks.front();
+                    readyTasks.pop_front();
+                }
+                else
+                {
+                    handle = readyTasks.back();
+                    readyTasks.pop_back();
                 }
             }
 
-            // mark all dependent task as 'ready'
-            pTask->ResolveDependencies(MFX_ERR_NONE);
-            // release all allocated resources
-            pTask->ReleaseResources();
-
-            // task object becomes free
-            taskReleased = true;
+            if (MFX_ERR_NONE == WrapUpReadyTask(callInfo, handle, threadNum))
+            {
+                return MFX_ERR_NONE;
+            }
         }
     }
 
+    return MFX_ERR_NOT_FOUND;
 
-    // wake up additional threads for this task and tasks dependent
-    if (m_DedicatedThreadsToWakeUp || m_RegularThreadsToWakeUp) {
-        WakeUpThreads(m_DedicatedThreadsToWakeUp, m_RegularThreadsToWakeUp);
+} // mfxStatus mfxSchedulerCore::GetReadyTask(MFX_CALL_INFO &callInfo,
+
+mfxStatus mfxSchedulerCore::WrapUpReadyTask(MFX_CALL_INFO &callInfo,
+                                            mfxTaskHandle handle,
+                                            const mfxU32 threadNum)
+{
+    MFX_SCHEDULER_TASK *pTask = m_ppTaskLookUpTable.at(handle.taskID);
+    mfxStatus mfxRes;
+
+    // check error(s)
+    if (nullptr == pTask)
+    {
+        return MFX_ERR_NOT_FOUND;
     }
 
-    // wake up external threads waiting for a free task object
-    if (taskReleased)
+    std::lock_guard<std::mutex> taskGuard(pTask->guard);
+
+    // the handle is outdated, the task runs another job
+    if (pTask->jobID != handle.jobID)
     {
-        ++m_freeTasksCount;
-        m_freeTasks.notify_one();
+        return MFX_ERR_NOT_FOUND;
     }
+    pTask->param.numHints -= 1;
 
-    // send tracing event
-    if (nTraceTaskId)
+    // the task is done or failed
+    if (MFX_TASK_NEED_CONTINUE != pTask->curStatus)
     {
-        MFX_LTRACE_1(MFX_TRACE_LEVEL_SCHED, "^Completed^", "%d", nTraceTaskId);
+        return MFX_ERR_NOT_FOUND;
     }
 
-}
+    MFX_THREAD_ASSIGNMENT &occupancyInfo = *(pTask->param.pThreadAssignment);
+    MFX_THREAD_ASSIGNMENT_GUARD &assignment = GetAssignmentGuard(&occupancyInfo);
+    std::lock_guard<std::mutex> assignmentGuard(assignment.guard);
+    const int priority = pTask->param.task.priority;
+
+    mfxRes = WrapUpTask(callInfo, pTask, threadNum);
+    if (MFX_ERR_NONE != mfxRes)
+    {
+        // the task waits for a thread leaving the entry
+        if (pTask->param.bInputsReady)
+        {
+            pTask->param.numHints += 1;
+            assignment.blockedTasks[priority].push_back(handle);
+        }
+        return mfxRes;
+    }
+
+    // let other threads join the task
+    if ((MFX_INVALID_THREAD_NUMBER != GetFreeThreadNumber(occupancyInfo, pTask)) &&
+        (0 == pTask->param.numHints))
+    {
+        pTask->param.numHints = 1;
+        PushReadyTask(handle,
+                      priority,
+                      GetTaskType(occupancyInfo.threadingPolicy),
+                      threadNum);
+    }
+
+    return MFX_ERR_NONE;
+
+} // mfxStatus mfxSchedulerCore::WrapUpReadyTask(MFX_CALL_INFO &callInfo,
 
 // update dependencies produced from the dependency table
 void mfxSchedulerCore::ResolveDependencyTable(MFX_SCHEDULER_TASK *pTask)
@@ -48,10 +48,17 @@ mfxStatus mfxSchedulerCore::StopWakeUpThread(void)
 
 void mfxSchedulerCore::ThreadProc(MFX_SCHEDULER_THREAD_CONTEXT *pContext)
 {
-    std::unique_lock<std::mutex> guard(m_guard);
+    // working threads don't take the common guard in the work stealing mode
+    std::unique_lock<std::mutex> guard(m_guard, std::defer_lock);
     mfxTaskHandle previousTaskHandle = {};
     mfxU64 start, stop;
     const uint32_t threadNum = pContext->threadNum;
+    const bool bWorkStealing = IsWorkStealing();
+
+    if (!bWorkStealing)
+    {
+        guard.lock();
+    }
 
     {
         char thread_name[30] = {};
@@ -71,16 +78,27 @@ void mfxSchedulerCore::ThreadProc(MFX_SCHEDULER_THREAD_CONTEXT *pContext)
             if (MFX_ERR_NONE == GetTask(call, previousTaskHandle, threadNum))
             {
                 pContext->state = MFX_SCHEDULER_THREAD_CONTEXT::Running;
-                guard.unlock();
+                if (!bWorkStealing)
+                {
+                    guard.unlock();
+                }
                 {
                     PERF_UTILITY_SET_ASYNC_TASK_ID(call.pTask->nTaskId);
                     PERF_UTILITY_AUTO("SchedulerRoutine", PERF_LEVEL_ROUTINE);
                     // perform asynchronous operation
                     call_pRoutine(call);
                 }
-                guard.lock();
+                if (!bWorkStealing)
+                {
+                    guard.lock();
+                }
 
-                pContext->workTime += call.timeSpend;
+                {
+                    std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+                    pContext->workTime += call.timeSpend;
+                    pContext->numCalls += 1;
+                }
                 // save the previous task's handle
                 previousTaskHandle = call.taskHandle;
 
@@ -102,7 +120,11 @@ void mfxSchedulerCore::ThreadProc(MFX_SCHEDULER_THREAD_CONTEXT *pContext)
         stop = GetHighPerformanceCounter();
 
         // update thread statistic
-        pContext->sleepTime += (stop - start);
+        {
+            std::unique_lock<std::mutex> statGuard = LockForWorkStealing(m_statGuard);
+
+            pContext->sleepTime += (stop - start);
+        }
     }
 }
 
@@ -24,9 +24,12 @@
 #include "mfx_feature_blocks_utils.h"
 
 #include <list>
+#include <vector>
 #include <map>
 #include <exception>
 #include <functional>
+#include <iterator>
+#include <stdexcept>
 
 namespace MfxFeatureBlocks
 {
@@ -139,6 +142,99 @@ public:
         TCall m_call;
     };
 
+    // Read-only contiguous copy of a block queue for the per-frame stages.
+    // The std::list stays the editable form for Push/Reorder/splice at init time,
+    // Freeze() takes the snapshot once the pipeline is final. A queue that isn't
+    // frozen is walked from the list, a frozen one can't be edited until Thaw().
+    template<class TBlock>
+    class FrozenQueue
+    {
+    public:
+        typedef std::list<TBlock> TList;
+        typedef TBlock value_type;
+        typedef const TBlock& const_reference;
+
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef TBlock value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const TBlock* pointer;
+            typedef const TBlock& reference;
+
+            explicit const_iterator(const TBlock* block) : m_block(block), m_bArray(true) {}
+            explicit const_iterator(typename TList::const_iterator it) : m_it(it), m_bArray(false) {}
+
+            reference operator*() const { return m_bArray ? *m_block : *m_it; }
+            pointer operator->() const { return &**this; }
+
+            const_iterator& operator++()
+            {
+                if (m_bArray)
+                    ++m_block;
+                else
+                    ++m_it;
+                return *this;
+            }
+            const_iterator operator++(int) { const_iterator tmp = *this; ++*this; return tmp; }
+
+            bool operator==(const const_iterator& other) const
+            {
+                return m_bArray ? m_block == other.m_block : m_it == other.m_it;
+            }
+            bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+        private:
+            const TBlock* m_block = nullptr;
+            typename TList::const_iterator m_it;
+            bool m_bArray;
+        };
+        typedef const_iterator iterator;
+
+        explicit FrozenQueue(const TList& queue) : m_queue(queue) {}
+        FrozenQueue(const FrozenQueue&) = delete;
+        FrozenQueue& operator=(const FrozenQueue&) = delete;
+
+        void Freeze()
+        {
+            m_blocks.assign(m_queue.begin(), m_queue.end());
+            m_bFrozen = true;
+        }
+
+        void Thaw()
+        {
+            m_blocks.clear();
+            m_blocks.shrink_to_fit();
+            m_bFrozen = false;
+        }
+
+        // the copy would go stale
+        void ThrowIfFrozen() const
+        {
+            if (m_bFrozen)
+                throw std::logic_error("Block queue is frozen");
+        }
+
+        bool Frozen() const { return m_bFrozen; }
+        bool empty() const { return m_bFrozen ? m_blocks.empty() : m_queue.empty(); }
+        size_t size() const { return m_bFrozen ? m_blocks.size() : m_queue.size(); }
+
+        const_iterator begin() const
+        {
+            return m_bFrozen ? const_iterator(m_blocks.data()) : const_iterator(m_queue.begin());
+        }
+        const_iterator end() const
+        {
+            return m_bFrozen ? const_iterator(m_blocks.data() + m_blocks.size()) : const_iterator(m_queue.end());
+        }
+
+    private:
+        const TList& m_queue;
+        std::vector<TBlock> m_blocks;
+        bool m_bFrozen = false;
+    };
+
     template<class T>
     static typename std::conditional<std::is_const<T>::value
         , typename T::const_iterator, typename T::iterator>::type
@@ -182,7 +278,12 @@ public:
     virtual const char* GetFeatureName(mfxU32 /*featureID*/) { return nullptr; }
     virtual const char* GetBlockName(ID /*id*/) { return nullptr; }
 
+    bool IsFrozen() const { return m_bFrozen; }
+
     std::map<mfxU32, mfxU32> m_initialized; //FeatureID -> FeatureMode
+
+protected:
+    bool m_bFrozen = false;
 };
 
 class IBlockTracer
@@ -32,17 +32,23 @@ template<mfxU32 QID> void Push(const ID id, typename BQ<QID>::TCall&& call) \
 
 #define MFX_FEATURE_BLOCKS_DECLARE_QUEUES_IN_FEATURE_BLOCK(NAME, ABR, RTYPE, ...)\
     static const mfxU32 BQ_##NAME = __LINE__;\
-    std::list<Block<std::function<RTYPE(__VA_ARGS__)>>> m_q##NAME;
+    std::list<Block<std::function<RTYPE(__VA_ARGS__)>>> m_q##NAME;\
+    FrozenQueue<Block<std::function<RTYPE(__VA_ARGS__)>>> m_f##NAME{m_q##NAME};
+
+#define MFX_FEATURE_BLOCKS_THAW_QUEUES_IN_FEATURE_BLOCK(NAME, ABR, RTYPE, ...)\
+    m_f##NAME.Thaw();
 
 #define MFX_FEATURE_BLOCKS_DECLARE_QUEUES_EXTERNAL(NAME, ABR, RTYPE, ...)\
 template<> struct FeatureBlocks::BQ <FeatureBlocks::BQ_##NAME>\
 {\
     typedef std::function<RTYPE(__VA_ARGS__)> TCall;\
     typedef std::list<FeatureBlocks::Block<TCall>> TQueue;\
-    static TQueue& Get(FeatureBlocks& blk) { return blk.m_q##NAME;}\
+    static TQueue& Get(FeatureBlocks& blk) { blk.m_f##NAME.ThrowIfFrozen(); return blk.m_q##NAME;}\
     static const TQueue& Get(const FeatureBlocks& blk) { return blk.m_q##NAME;}\
+    typedef FeatureBlocks::FrozenQueue<FeatureBlocks::Block<TCall>> TFrozen;\
+    static const TFrozen& GetFrozen(const FeatureBlocks& blk) { return blk.m_f##NAME;}\
     static void Push(FeatureBlocks& blks, const ID id, TCall&& call)\
-    { blks.Push(blks.m_q##NAME, id, std::move(call)); }\
+    { blks.m_f##NAME.ThrowIfFrozen(); blks.Push(blks.m_q##NAME, id, std::move(call)); }\
 };
 
 #define MFX_FEATURE_BLOCKS_DECLARE_QUEUES_IN_FEATURE_BASE(NAME, ABR, RTYPE, ...)\
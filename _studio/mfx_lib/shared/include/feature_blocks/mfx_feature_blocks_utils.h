@@ -26,6 +26,10 @@
 
 #include <memory>
 #include <list>
+#include <unordered_map>
+#include <array>
+#include <sstream>
+#include <stdexcept>
 #include <exception>
 #include <functional>
 #include <algorithm>
@@ -94,37 +98,111 @@ std::unique_ptr<typename std::conditional<std::is_base_of<Storable, T>::value, T
         (std::forward<Args>(args)...);
 }
 
+// Keys below NUM_SLOTS index a fixed array, larger keys fall back to a hash.
+// Feature keys are small consecutive numbers (see Glob/Task::NUM_KEYS), so
+// StorageVar<Key>::Get() inlines to a single load
 class StorageR
 {
 public:
     typedef mfxU32 TKey;
     static const TKey KEY_INVALID = TKey(-1);
+    static const TKey NUM_SLOTS = 64;
 
-    template<class T>
-    const T& Read(TKey key) const
+    StorageR() = default;
+    StorageR(StorageR&& other)
+        : m_slot(std::move(other.m_slot))
+        , m_ext(std::move(other.m_ext))
+        , m_nSlots(other.m_nSlots)
+    {
+        other.m_nSlots = 0;
+    }
+
+    StorageR& operator=(StorageR&& other)
     {
-        auto it = m_map.find(key);
-        if (it == m_map.end())
+        if (this != &other)
         {
-            std::stringstream ss;
-            ss << "Requested object with Key " << key << " was not found in storage";
-            throw std::logic_error(ss.str());
+            DestroyAll();
+            m_slot   = std::move(other.m_slot);
+            m_ext    = std::move(other.m_ext);
+            m_nSlots = other.m_nSlots;
+            other.m_nSlots = 0;
         }
-        return dynamic_cast<T&>(*it->second);
+        return *this;
+    }
+
+    ~StorageR()
+    {
+        DestroyAll();
+    }
+
+    template<class T>
+    const T& Read(TKey key) const
+    {
+        return Cast<T>(Find(key), key);
     }
 
     bool Contains(TKey key) const
     {
-        return (m_map.find(key) != m_map.end());
+        return !!Find(key);
     }
 
     bool Empty() const
     {
-        return m_map.empty();
+        return !m_nSlots && m_ext.empty();
     }
 
 protected:
-    std::map<TKey, std::unique_ptr<Storable>> m_map;
+    Storable* Find(TKey key) const
+    {
+        if (key < NUM_SLOTS)
+            return m_slot[key].get();
+
+        auto it = m_ext.find(key);
+        return it == m_ext.end() ? nullptr : it->second.get();
+    }
+
+    // type of the key is fixed by its StorageVar, so downcasts are static and dynamic_cast only verifies them
+    template<class T, typename std::enable_if<std::is_base_of<Storable, T>::value, int>::type = 0>
+    static T& Cast(Storable* pObj, TKey key)
+    {
+        if (!pObj)
+            ThrowNotFound(key);
+
+        assert(dynamic_cast<T*>(pObj));
+        return static_cast<T&>(*pObj);
+    }
+
+    // cross-cast to the wrapped type of MakeStorable<T>
+    template<class T, typename std::enable_if<!std::is_base_of<Storable, T>::value, int>::type = 0>
+    static T& Cast(Storable* pObj, TKey key)
+    {
+        if (!pObj)
+            ThrowNotFound(key);
+
+        return dynamic_cast<T&>(*pObj);
+    }
+
+    [[noreturn]] static void ThrowNotFound(TKey key)
+    {
+        std::stringstream ss;
+        ss << "Requested object with Key " << key << " was not found in storage";
+        throw std::logic_error(ss.str());
+    }
+
+    // descending keys, the order objects were destroyed in by std::map
+    void DestroyAll()
+    {
+        m_ext.clear();
+        for (TKey key = NUM_SLOTS; key > 0 && m_nSlots; --key)
+        {
+            m_nSlots -= !!m_slot[key - 1];
+            m_slot[key - 1].reset();
+        }
+    }
+
+    std::array<std::unique_ptr<Storable>, NUM_SLOTS>        m_slot;
+    std::unordered_map<TKey, std::unique_ptr<Storable>>     m_ext;
+    TKey                                                    m_nSlots = 0;
 };
 
 class StorageW : public StorageR
@@ -133,27 +211,35 @@ public:
     template<class T>
     T& Write(TKey key) const
     {
-        auto it = m_map.find(key);
-        if (it == m_map.end())
-        {
-            std::stringstream ss;
-            ss << "Requested object with Key " << key << " was not found in storage";
-            throw std::logic_error(ss.str());
-        }
-        return dynamic_cast<T&>(*it->second);
+        return Cast<T>(Find(key), key);
     }
 };
 
 class StorageRW : public StorageW
 {
 public:
+    // an empty slot reads as "not found", so null objects are never stored
     bool TryInsert(TKey key, std::unique_ptr<Storable>&& pObj)
     {
-        return m_map.emplace(key, std::move(pObj)).second;
+        if (!pObj)
+            return false;
+
+        if (key >= NUM_SLOTS)
+            return m_ext.emplace(key, std::move(pObj)).second;
+
+        if (m_slot[key])
+            return false;
+
+        m_slot[key] = std::move(pObj);
+        ++m_nSlots;
+        return true;
     }
 
     void Insert(TKey key, std::unique_ptr<Storable>&& pObj)
     {
+        if (!pObj)
+            throw std::logic_error("Null object can't be stored");
+
         if (!TryInsert(key, std::move(pObj)))
             throw std::logic_error("Keys must be unique");
     }
@@ -172,12 +258,19 @@ public:
 
     void Erase(TKey key)
     {
-        m_map.erase(key);
+        if (key >= NUM_SLOTS)
+        {
+            m_ext.erase(key);
+            return;
+        }
+
+        m_nSlots -= !!m_slot[key];
+        m_slot[key].reset();
     }
 
     void Clear()
     {
-        m_map.clear();
+        DestroyAll();
     }
 };
 
@@ -37,11 +37,18 @@ static const
 MFX_GUID MFXIScheduler2_GUID =
 { 0xdc775b1c, 0x951d, 0x421f, { 0xbf, 0xd8, 0xca, 0x56, 0x2d, 0x95, 0xa4, 0x18 } };
 
+// {0FB48A5F-EAC7-4265-AB34-7068633D6669}
+static const
+MFX_GUID MFXISchedulerStat_GUID =
+{ 0x0fb48a5f, 0xeac7, 0x4265, { 0xab, 0x34, 0x70, 0x68, 0x63, 0x3d, 0x66, 0x69 } };
+
 enum mfxSchedulerFlags
 {
     // default behaviour policy
     MFX_SCHEDULER_DEFAULT = 0,
-    MFX_SINGLE_THREAD = 1
+    MFX_SINGLE_THREAD = 1,
+    // dispatch ready tasks through per-thread queues with work stealing
+    MFX_SCHEDULER_WORK_STEALING = 2
 };
 
 enum mfxSchedulerMessage
@@ -152,4 +159,90 @@ public:
 
 };
 
+enum
+{
+    // maximum number of threads reported by the statistic
+    MFX_SCHEDULER_STAT_MAX_THREADS = 64,
+    // maximum number of task routines in the statistic. The last entry is
+    // reserved for tasks of routines, which don't fit into the other ones.
+    MFX_SCHEDULER_STAT_MAX_ROUTINES = 32,
+    // number of histogram bins. Bin 0 counts durations below 1 usec,
+    // bin i counts durations in [2^(i-1), 2^i) usec, the last bin
+    // counts all longer durations.
+    MFX_SCHEDULER_STAT_HISTOGRAM_BINS = 24,
+    // number of task priorities
+    MFX_SCHEDULER_STAT_PRIORITIES = MFX_PRIORITY_HIGH + 1
+};
+
+// All times are in microseconds.
+struct MFX_SCHEDULER_THREAD_STAT
+{
+    // integral time spent in task routines
+    mfxU64 workTime;
+    // integral time spent waiting for tasks, updated on wake up
+    mfxU64 sleepTime;
+    // number of task routine calls
+    mfxU64 numCalls;
+    // the thread is executing a task at the moment
+    bool bRunning;
+};
+
+struct MFX_SCHEDULER_ROUTINE_STAT
+{
+    // name of the routine, as given by MFX_ENTRY_POINT::pRoutineName
+    const char *pRoutineName;
+    // number of submitted tasks
+    mfxU64 numTasks;
+    // number of tasks submitted with incomplete inputs
+    mfxU64 numDependencyStalls;
+    // integral time from task submission to its first call
+    mfxU64 waitTime;
+    // number of routine calls
+    mfxU64 numCalls;
+    // integral time spent in the routine
+    mfxU64 runTime;
+    // distribution of call durations
+    mfxU64 runTimeHistogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS];
+};
+
+struct MFX_SCHEDULER_STAT
+{
+    // number of working threads
+    mfxU32 numberOfThreads;
+    MFX_SCHEDULER_THREAD_STAT threads[MFX_SCHEDULER_STAT_MAX_THREADS];
+
+    // number of incomplete tasks for every priority
+    mfxU32 numQueuedTasks[MFX_SCHEDULER_STAT_PRIORITIES];
+    // number of tasks ready to run for every priority
+    mfxU32 numReadyTasks[MFX_SCHEDULER_STAT_PRIORITIES];
+    // number of calls in progress for every priority
+    mfxU32 numRunningCalls[MFX_SCHEDULER_STAT_PRIORITIES];
+
+    // distribution of time from task submission to its first call
+    mfxU64 waitTimeHistogram[MFX_SCHEDULER_STAT_HISTOGRAM_BINS];
+    // number of tasks submitted with incomplete inputs
+    mfxU64 numDependencyStalls;
+
+    // statistic of task routines
+    mfxU32 numRoutines;
+    MFX_SCHEDULER_ROUTINE_STAT routines[MFX_SCHEDULER_STAT_MAX_ROUTINES];
+};
+
+// MFXISchedulerStat interface.
+// The interface provides the live statistic gathered by the scheduler.
+class MFXISchedulerStat : public MFXIUnknown
+{
+public:
+
+    virtual ~MFXISchedulerStat(void){}
+
+    // Get the current statistic
+    virtual
+    mfxStatus GetStat(MFX_SCHEDULER_STAT *pStat) = 0;
+
+    // Reset accumulated times, counters and histograms
+    virtual
+    mfxStatus ResetStat(void) = 0;
+};
+
 #endif // __MFX_INTERFACE_SCHEDULER_H
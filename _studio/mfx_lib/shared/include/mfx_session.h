@@ -183,6 +183,10 @@ public:
 
 MFXIPtr<MFXISession_2_1> TryGetSession_2_1(mfxSession session);
 
+// Get the statistic interface of the scheduler serving the session.
+// The scheduler is shared by joined sessions.
+MFXIPtr<MFXISchedulerStat> TryGetSchedulerStat(mfxSession session);
+
 class _mfxVersionedSessionImpl: public _mfxSession, public MFXISession_2_1
 {
 public:
@@ -40,9 +40,25 @@
 
 constexpr mfxU32 default_threads_limit = 16;
 
+// VPL_SCHEDULER_WORK_STEALING=1 switches the scheduler to per-thread
+// ready queues with work stealing
+static mfxSchedulerFlags GetDefaultSchedulerFlags()
+{
+    return mfx::GetEnv<mfxU32>("VPL_SCHEDULER_WORK_STEALING", 0) ? MFX_SCHEDULER_WORK_STEALING : MFX_SCHEDULER_DEFAULT;
+}
+
 TRY_GET_SESSION(1,10)
 TRY_GET_SESSION(2,1)
 
+MFXIPtr<MFXISchedulerStat> TryGetSchedulerStat(mfxSession session)
+{
+    if (session == NULL)
+    {
+        return MFXIPtr<MFXISchedulerStat>();
+    }
+    return MFXIPtr<MFXISchedulerStat>(static_cast<_mfxVersionedSessionImpl *>(session)->QueryInterface(MFXISchedulerStat_GUID));
+}
+
 //////////////////////////////////////////////////////////////////////////
 //  _mfxSession members
 //////////////////////////////////////////////////////////////////////////
@@ -180,7 +196,7 @@ mfxStatus _mfxSession::Init(mfxIMPL implInterface, mfxVersion *ver)
         return MFX_ERR_UNKNOWN;
     }
     memset(&schedParam, 0, sizeof(schedParam));
-    schedParam.flags = MFX_SCHEDULER_DEFAULT;
+    schedParam.flags = GetDefaultSchedulerFlags();
     schedParam.numberOfThreads = maxNumThreads;
     schedParam.pCore = m_pCORE.get();
     mfxRes = m_pScheduler->Initialize(&schedParam);
@@ -282,6 +298,12 @@ void *_mfxVersionedSessionImpl::QueryInterface(const MFX_GUID &guid)
         return (MFXISession_2_1 *)this;
     }
 
+    // scheduler statistic is provided by the session's scheduler
+    if (MFXISchedulerStat_GUID == guid)
+    {
+        return (m_pScheduler) ? (m_pScheduler->QueryInterface(guid)) : (NULL);
+    }
+
     // it is unsupported interface
     return NULL;
 } // void *_mfxVersionedSessionImpl::QueryInterface(const MFX_GUID &guid)
@@ -411,7 +433,7 @@ mfxStatus _mfxVersionedSessionImpl::InitEx(mfxInitParam& par, bool isSingleThrea
     if (pScheduler2) {
         MFX_SCHEDULER_PARAM2 schedParam;
         memset(&schedParam, 0, sizeof(schedParam));
-        schedParam.flags = MFX_SCHEDULER_DEFAULT;
+        schedParam.flags = GetDefaultSchedulerFlags();
 #if defined(MFX_ENABLE_SINGLE_THREAD)
         if (isSingleThreadMode)
             schedParam.flags = MFX_SINGLE_THREAD;
@@ -429,7 +451,7 @@ mfxStatus _mfxVersionedSessionImpl::InitEx(mfxInitParam& par, bool isSingleThrea
     else {
         MFX_SCHEDULER_PARAM schedParam;
         memset(&schedParam, 0, sizeof(schedParam));
-        schedParam.flags = MFX_SCHEDULER_DEFAULT;
+        schedParam.flags = GetDefaultSchedulerFlags();
 #if defined(MFX_ENABLE_SINGLE_THREAD)
         if (isSingleThreadMode)
             schedParam.flags = MFX_SINGLE_THREAD;
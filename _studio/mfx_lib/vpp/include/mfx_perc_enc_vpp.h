@@ -26,6 +26,7 @@
 #include "mfx_vpp_defs.h"
 #include "mfx_vpp_base.h"
 #include "libmfx_core.h"
+#include "mfx_stripe_workers.h"
 
 #if defined(MFX_ENABLE_ENCTOOLS)
 #include "mfxenctools-int.h"
@@ -108,6 +109,12 @@ modulation, m = 0. The second of each pair is used where modulation, m = 1. In b
 0 and 1, a proportionate blend of the pair is used to control the filter. Thus the modulation map controls
 the "blend" of two different filters that can have very different characteristics.
 
+High Bit Depth
+
+P010 input is filtered with the same parameters: pivots are scaled to the sample range and the
+differences are scaled back to 8 bit range after the slope is applied, so the filter strength
+does not depend on bit depth.
+
 Qp Adaptive Option
 
 By enabling QP adaptive option the filter output is clamped in a range with respect to the original where
@@ -189,6 +196,8 @@ public:
     bool IsReadyOutput(mfxRequestType) override;
 
 private:
+    void ProcessStripe(mfxFrameSurface1* in, mfxFrameSurface1* out, int stripe);
+
     CommonCORE_VPL* m_core = nullptr;
 
     bool m_initialized = false;
@@ -198,6 +207,15 @@ private:
     int width = 0;
     int height = 0;
 
+    // P010 goes through 16 bit kernels
+    Filter::SampleFormat sampleFormat{8, 0};
+    int bytesPerSample = 1;
+
+    // frame is split to stripes of stripeHeight lines filtered concurrently
+    int numStripes = 1;
+    int stripeHeight = 0;
+    mfx::StripeWorkers workers;
+
     std::array<Parameters::PerBlock, 2> parametersBlock;
     Parameters::PerFrame parametersFrame;
     
@@ -72,44 +72,126 @@ struct Filter
         T maximum;
     };
 
+    // sample layout, P010 keeps 10 bit samples in the upper bits (shift = 6)
+    struct SampleFormat
+    {
+        int bitDepth;
+        int shift;
+    };
+
+    // per line coefficients and modulated parameters, one set for every stripe processed concurrently
+    struct LineBuffers
+    {
+        std::vector<ModulatedParameters<int16_t>> modulatedParametersSpatial;
+        std::vector<ModulatedParameters<int16_t>> modulatedParametersTemporal;
+
+        std::array<std::vector<int16_t>, 2> coefficientsVertical;
+        std::array<std::vector<int16_t>, 2> coefficientsVerticalULDR;
+        std::array<std::vector<int16_t>, 2> coefficientsVerticalURDL;
+        std::vector<int16_t> coefficientsHorizontal;
+        std::vector<int16_t> coefficientsTemporal;
+    };
+
+    // coefficients of the current line, see processLine
+    struct Taps
+    {
+        const int16_t *h;
+        const int16_t *u;
+        const int16_t *d;
+        const int16_t *ul;
+        const int16_t *dr;
+        const int16_t *ur;
+        const int16_t *dl;
+        const int16_t *t;
+    };
+
+    typedef void (*CalculateCoefficientsFunc)(int leftShift, bool qpAdaptive, const ModulatedParameters<int16_t> *parameters,
+                                              const uint8_t *a, const uint8_t *b, int16_t *c, int width);
+    typedef void (*FilterLineFunc)(bool qpAdaptive, const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove,
+                                   const uint8_t *previousOutput, const uint8_t *inputLineBelow, uint8_t *output,
+                                   int width, int16_t qpClamp);
+
     static constexpr int unityLog2 = 8;
     static constexpr int unity = 1 << unityLog2;
 
-    std::vector<uint8_t> nullModulation;
-
-    std::vector<ModulatedParameters<int16_t>> modulatedParametersSpatial;
-    std::vector<ModulatedParameters<int16_t>> modulatedParametersTemporal;
+    std::vector<LineBuffers> lineBuffers;
 
-    std::array<std::vector<int16_t>, 2> coefficientsVertical;
-    std::array<std::vector<int16_t>, 2> coefficientsVerticalULDR;
-    std::array<std::vector<int16_t>, 2> coefficientsVerticalURDL;
-    std::vector<int16_t> coefficientsHorizontal;
-    std::vector<int16_t> coefficientsTemporal;
+    // 8 bit kernels, AVX-512 ones are picked at construction if CPU supports them
+    CalculateCoefficientsFunc calculateCoefficientsImpl = nullptr;
+    FilterLineFunc filterLineImpl = nullptr;
 
     bool haveFilteredOneFrame = false;
 
     Filter(
         const Parameters::PerFrame &parametersFrame,
         const std::array<Parameters::PerBlock, 2> &parametersBlock,
-        int width);
-
-    inline void calculateCoefficients(const __m128i &LeftShift, const Filter::ModulatedParameters<int16_t> *parameters, const uint8_t *a, const uint8_t *b, int16_t *c, int width);
+        int width,
+        int numStripes = 1);
+
+    static void calculateCoefficientsAvx2(int leftShift, bool qpAdaptive, const ModulatedParameters<int16_t> *parameters,
+                                          const uint8_t *a, const uint8_t *b, int16_t *c, int width);
+    static void calculateCoefficientsAvx512(int leftShift, bool qpAdaptive, const ModulatedParameters<int16_t> *parameters,
+                                            const uint8_t *a, const uint8_t *b, int16_t *c, int width);
+    static void calculateCoefficients16(int leftShift, bool qpAdaptive, const ModulatedParameters<int16_t> *parameters,
+                                        const uint16_t *a, const uint16_t *b, int16_t *c, int width, const SampleFormat &format);
+
+    static void filterLineAvx2(bool qpAdaptive, const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove,
+                               const uint8_t *previousOutput, const uint8_t *inputLineBelow, uint8_t *output,
+                               int width, int16_t qpClamp);
+    static void filterLineAvx512(bool qpAdaptive, const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove,
+                                 const uint8_t *previousOutput, const uint8_t *inputLineBelow, uint8_t *output,
+                                 int width, int16_t qpClamp);
+    static void filterLine16(bool qpAdaptive, const Taps &taps, const uint16_t *input, const uint16_t *inputLineAbove,
+                             const uint16_t *previousOutput, const uint16_t *inputLineBelow, uint16_t *output,
+                             int width, int16_t qpClamp, const SampleFormat &format);
+
+    inline void calculateCoefficients(int leftShift, const ModulatedParameters<int16_t> *parameters,
+                                      const uint8_t *a, const uint8_t *b, int16_t *c, int width, const SampleFormat &format);
+    inline void calculateCoefficients(int leftShift, const ModulatedParameters<int16_t> *parameters,
+                                      const uint16_t *a, const uint16_t *b, int16_t *c, int width, const SampleFormat &format);
+
+    inline void filterLine(const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove, const uint8_t *previousOutput,
+                           const uint8_t *inputLineBelow, uint8_t *output, int width, int16_t qpClamp, const SampleFormat &format);
+    inline void filterLine(const Taps &taps, const uint16_t *input, const uint16_t *inputLineAbove, const uint16_t *previousOutput,
+                           const uint16_t *inputLineBelow, uint16_t *output, int width, int16_t qpClamp, const SampleFormat &format);
+
+    inline void modulateParameters(LineBuffers &buffers, const uint8_t *modulation, int modulationStride, int y, int width16, const SampleFormat &format);
 
+    template <typename T>
     inline void processLine(
-        const __m128i &spatialLeftShift,
-        const __m128i &temporalLeftShift,
-        const uint8_t *input,
-        const uint8_t *inputLineAbove,
-        const uint8_t *previousOutput,
-        const uint8_t *inputLineBelow,
-        uint8_t *output,
+        LineBuffers &buffers,
+        int spatialLeftShift,
+        int temporalLeftShift,
+        const T *input,
+        const T *inputLineAbove,
+        const T *previousOutput,
+        const T *inputLineBelow,
+        T *output,
         int width,
         int y,
-        int16_t clamp);
+        int16_t clamp,
+        const SampleFormat &format);
+
+    template <typename T>
+    inline void processStripeImpl(const T *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                                  const T *previousOutput, int previousOutputStride, T *output, int outputStride,
+                                  int width, int height, int qp, int stripe, int yBegin, int yEnd, const SampleFormat &format);
 
     void processFrame(const uint8_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
                       const uint8_t *previousOutput, int previousOutputStride, uint8_t *output, int outputStride,
                       int width, int height, int qp=MAX_QP);
+
+    // Filters lines [yBegin, yEnd) of the frame using line buffers of the given stripe. Stripes of one frame
+    // are independent and may run concurrently, finishFrame() must be called once all of them are done.
+    // Strides are in samples, 16 bit samples hold format.bitDepth bits shifted left by format.shift.
+    void processStripe(const uint8_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                       const uint8_t *previousOutput, int previousOutputStride, uint8_t *output, int outputStride,
+                       int width, int height, int qp, int stripe, int yBegin, int yEnd);
+    void processStripe(const uint16_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                       const uint16_t *previousOutput, int previousOutputStride, uint16_t *output, int outputStride,
+                       int width, int height, int qp, int stripe, int yBegin, int yEnd, const SampleFormat &format);
+
+    void finishFrame();
 };
 
 }//namespace
@@ -29,6 +29,19 @@
 namespace PercEncPrefilter
 {
 
+// stripes shorter than that don't pay off the synchronization
+#define PERC_ENC_MIN_STRIPE_HEIGHT 128
+#define PERC_ENC_MAX_STRIPES 8
+
+// VPL_PERC_ENC_PREFILTER_THREADS sets number of threads filtering one frame, 1 disables stripes
+static int GetMaxStripes()
+{
+    const mfxU32 defaultStripes = std::min<mfxU32>(std::thread::hardware_concurrency(), PERC_ENC_MAX_STRIPES);
+    const mfxU32 maxStripes     = mfx::GetEnv<mfxU32>("VPL_PERC_ENC_PREFILTER_THREADS", defaultStripes);
+
+    return int(mfx::clamp<mfxU32>(maxStripes, 1, PERC_ENC_MAX_STRIPES));
+}
+
 mfxStatus PercEncFilter::Query(mfxExtBuffer* hint)
 {
     std::ignore = hint;
@@ -69,12 +82,33 @@ mfxStatus PercEncFilter::Init(mfxFrameInfo* in, mfxFrameInfo* out)
     MFX_CHECK(in->CropW >= 16, MFX_ERR_INVALID_VIDEO_PARAM);
     MFX_CHECK(in->CropH >= 2, MFX_ERR_INVALID_VIDEO_PARAM);
 
-    MFX_CHECK(in->FourCC         == MFX_FOURCC_NV12,         MFX_ERR_INVALID_VIDEO_PARAM);
+    MFX_CHECK(in->FourCC         == MFX_FOURCC_NV12 ||
+              in->FourCC         == MFX_FOURCC_P010,         MFX_ERR_INVALID_VIDEO_PARAM);
     MFX_CHECK(in->ChromaFormat   == MFX_CHROMAFORMAT_YUV420, MFX_ERR_INVALID_VIDEO_PARAM);
 
+    if (in->FourCC == MFX_FOURCC_P010)
+    {
+        MFX_CHECK(in->BitDepthLuma == 0 || in->BitDepthLuma == 10, MFX_ERR_INVALID_VIDEO_PARAM);
+
+        sampleFormat.bitDepth = 10;
+        sampleFormat.shift = in->Shift ? 16 - sampleFormat.bitDepth : 0;
+        bytesPerSample = 2;
+    }
+    else
+    {
+        sampleFormat.bitDepth = 8;
+        sampleFormat.shift = 0;
+        bytesPerSample = 1;
+    }
+
     width = in->CropW;
     height = in->CropH;
-    previousOutput.resize(size_t(width) * height);
+    previousOutput.resize(size_t(width) * height * bytesPerSample);
+
+    // stripes start at 16 line boundary to share modulation rows and keep chroma lines paired
+    numStripes = std::max(std::min(GetMaxStripes(), height / PERC_ENC_MIN_STRIPE_HEIGHT), 1);
+    stripeHeight = ((height + numStripes - 1) / numStripes + 15) / 16 * 16;
+    numStripes = (height + stripeHeight - 1) / stripeHeight;
 
     parametersFrame.spatialSlope = 2;
     parametersFrame.temporalSlope = 5;
@@ -108,7 +142,8 @@ mfxStatus PercEncFilter::Init(mfxFrameInfo* in, mfxFrameInfo* out)
     parametersBlock[0].temporal.maximum = 0.f;
     parametersBlock[1].temporal.maximum = 0.f;
 
-    filter = std::make_unique<Filter>(parametersFrame, parametersBlock, width);
+    filter = std::make_unique<Filter>(parametersFrame, parametersBlock, width, numStripes);
+    workers.Start(numStripes - 1);
 
 #if defined(MFX_ENABLE_ENCTOOLS)
     //modulation map
@@ -157,6 +192,8 @@ mfxStatus PercEncFilter::Init(mfxFrameInfo* in, mfxFrameInfo* out)
 
 mfxStatus PercEncFilter::Close()
 {
+    workers.Stop();
+
 #if defined(MFX_ENABLE_ENCTOOLS)
     if(m_encTools)
     {
@@ -285,40 +322,67 @@ mfxStatus PercEncFilter::RunFrameVPP(mfxFrameSurface1* in, mfxFrameSurface1* out
     MFX_SAFE_CALL(inLock.lock(MFX_MAP_READ));
     MFX_SAFE_CALL(outLock.lock(MFX_MAP_WRITE));
 
-    if (filter)
+    // every stripe keeps its own part of previous output, so the temporal term only reads lines
+    // of the previous frame which were written by the same stripe
+    workers.Run(numStripes, [&](mfxU32 stripe)
     {
-        filter->processFrame(in->Data.Y, in->Data.Pitch, modulation.data(), modulationStride, previousOutput.data(), width, out->Data.Y, out->Data.Pitch, width, height);
-    }
-    else
+        ProcessStripe(in, out, int(stripe));
+    });
+
+    if (filter)
+        filter->finishFrame();
+
+    return MFX_ERR_NONE;
+}
+
+void PercEncFilter::ProcessStripe(mfxFrameSurface1* in, mfxFrameSurface1* out, int stripe)
+{
+    const int yBegin = stripe * stripeHeight;
+    const int yEnd = std::min(yBegin + stripeHeight, height);
+    const size_t rowSize = size_t(width) * bytesPerSample;
+
+    if (!filter)
     {
-        for (size_t y = 0; y < size_t(height); ++y)
+        for (size_t y = yBegin; y < size_t(yEnd); ++y)
         {
             std::copy(
                 &in->Data.Y[in->Data.Pitch * y],
-                &in->Data.Y[in->Data.Pitch * y + width],
+                &in->Data.Y[in->Data.Pitch * y + rowSize],
                 &out->Data.Y[out->Data.Pitch * y]);
         }
     }
+    else if (bytesPerSample == 2)
+    {
+        filter->processStripe(in->Data.Y16, in->Data.Pitch / 2, modulation.data(), modulationStride,
+                              reinterpret_cast<const uint16_t*>(previousOutput.data()), width,
+                              out->Data.Y16, out->Data.Pitch / 2, width, height, MAX_QP,
+                              stripe, yBegin, yEnd, sampleFormat);
+    }
+    else
+    {
+        filter->processStripe(in->Data.Y, in->Data.Pitch, modulation.data(), modulationStride,
+                              previousOutput.data(), width,
+                              out->Data.Y, out->Data.Pitch, width, height, MAX_QP,
+                              stripe, yBegin, yEnd);
+    }
 
     // retain a copy of the output for next time... (it would be nice to avoid this copy)
-    for (size_t y = 0; y < size_t(height); ++y)
+    for (size_t y = yBegin; y < size_t(yEnd); ++y)
     {
         std::copy(
             &out->Data.Y[out->Data.Pitch * y],
-            &out->Data.Y[out->Data.Pitch * y + width],
-            &previousOutput[width * y]);
+            &out->Data.Y[out->Data.Pitch * y + rowSize],
+            &previousOutput[rowSize * y]);
     }
 
     // copy chroma
-    for (int y = 0; y < height / 2; ++y)
+    for (size_t y = yBegin / 2; y < size_t(yEnd / 2); ++y)
     {
         std::copy(
             &in->Data.UV[in->Data.Pitch * y],
-            &in->Data.UV[in->Data.Pitch * y + width],
+            &in->Data.UV[in->Data.Pitch * y + rowSize],
             &out->Data.UV[out->Data.Pitch * y]);
     }
-
-    return MFX_ERR_NONE;
 }
 
 bool PercEncFilter::IsReadyOutput(mfxRequestType)
@@ -42,35 +42,47 @@ namespace PercEncPrefilter
     Filter::Filter(
         const Parameters::PerFrame &parametersFrame,
         const std::array<Parameters::PerBlock, 2> &parametersBlock,
-        int width)
+        int width,
+        int numStripes)
         : parametersFrame{parametersFrame},
           parametersBlock{parametersBlock}
     {
         const auto coefficientsSize = (width + 32) / 16 * 16;
-        coefficientsVertical[0].resize(coefficientsSize);
-        coefficientsVertical[1].resize(coefficientsSize);
 
-        if (parametersFrame.qpAdaptive)
+        lineBuffers.resize(std::max(numStripes, 1));
+
+        for (auto &buffers : lineBuffers)
         {
-            coefficientsVerticalULDR[0].resize(coefficientsSize);
-            coefficientsVerticalULDR[1].resize(coefficientsSize);
-            coefficientsVerticalURDL[0].resize(coefficientsSize);
-            coefficientsVerticalURDL[1].resize(coefficientsSize);
-        }
+            buffers.coefficientsVertical[0].resize(coefficientsSize);
+            buffers.coefficientsVertical[1].resize(coefficientsSize);
+
+            if (parametersFrame.qpAdaptive)
+            {
+                buffers.coefficientsVerticalULDR[0].resize(coefficientsSize);
+                buffers.coefficientsVerticalULDR[1].resize(coefficientsSize);
+                buffers.coefficientsVerticalURDL[0].resize(coefficientsSize);
+                buffers.coefficientsVerticalURDL[1].resize(coefficientsSize);
+            }
 
-        coefficientsHorizontal.resize(coefficientsSize);
+            buffers.coefficientsHorizontal.resize(coefficientsSize);
 
-        if (parametersFrame.temporalEnabled)
-            coefficientsTemporal.resize(coefficientsSize);
+            if (parametersFrame.temporalEnabled)
+                buffers.coefficientsTemporal.resize(coefficientsSize);
 
-        modulatedParametersSpatial.resize((width + 32) / 16);
-        modulatedParametersTemporal.resize((width + 32) / 16);
-        nullModulation.resize((width + 32) / 16);
-    }
+            buffers.modulatedParametersSpatial.resize((width + 32) / 16);
+            buffers.modulatedParametersTemporal.resize((width + 32) / 16);
+        }
 
+        const bool cpuHasAvx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+
+        calculateCoefficientsImpl = cpuHasAvx512 ? calculateCoefficientsAvx512 : calculateCoefficientsAvx2;
+        filterLineImpl            = cpuHasAvx512 ? filterLineAvx512            : filterLineAvx2;
+    }
 
-    void Filter::calculateCoefficients(const __m128i &LeftShift, const Filter::ModulatedParameters<int16_t> *parameters, const uint8_t *a, const uint8_t *b, int16_t *c, int width)
+    void Filter::calculateCoefficientsAvx2(int leftShift, bool qpAdaptive, const Filter::ModulatedParameters<int16_t> *parameters, const uint8_t *a, const uint8_t *b, int16_t *c, int width)
     {
+        const __m128i LeftShift = _mm_cvtsi32_si128(leftShift);
+
         for (int i = 0; i < width; i += 16)
         {
             auto left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a));
@@ -82,7 +94,7 @@ namespace PercEncPrefilter
             auto coeff = _mm256_sub_epi16(_mm256_set1_epi16(parameters->pivot), absdiff);
             coeff = _mm256_sll_epi16(coeff, LeftShift);
             coeff = _mm256_min_epi16(coeff, _mm256_set1_epi16(parameters->maximum));
-            if(parametersFrame.qpAdaptive)
+            if(qpAdaptive)
             {
                 auto min = _mm256_set1_epi16(parameters->minimum);
                 const __m128i RightShift = _mm_set1_epi64x(9);
@@ -102,43 +114,57 @@ namespace PercEncPrefilter
         }
     }
 
-    void Filter::processLine(
-        const __m128i &spatialLeftShift,
-        const __m128i &temporalLeftShift,
-        const uint8_t *input,
-        const uint8_t *inputLineAbove,
-        const uint8_t *previousOutput,
-        const uint8_t *inputLineBelow,
-        uint8_t *output,
-        int width,
-        int y,
-        int16_t qpClamp)
+    // same as 8 bit version with the absolute difference scaled down to 8 bit range after the slope is applied
+    void Filter::calculateCoefficients16(int leftShift, bool qpAdaptive, const Filter::ModulatedParameters<int16_t> *parameters, const uint16_t *a, const uint16_t *b, int16_t *c, int width, const SampleFormat &format)
     {
-        calculateCoefficients(spatialLeftShift, modulatedParametersSpatial.data(), input, input + 1, coefficientsHorizontal.data() + 1, width);
-        coefficientsHorizontal[0] = 0;
-        coefficientsHorizontal[width] = 0;
-        calculateCoefficients(spatialLeftShift, modulatedParametersSpatial.data(), input, inputLineBelow, coefficientsVertical[y % 2].data(), width);
-        if(parametersFrame.qpAdaptive)
+        const __m128i LeftShift = _mm_cvtsi32_si128(leftShift);
+        const __m128i SampleShift = _mm_cvtsi32_si128(format.shift);
+        const __m128i DepthShift = _mm_cvtsi32_si128(format.bitDepth - 8);
+
+        for (int i = 0; i < width; i += 16)
         {
-            calculateCoefficients(spatialLeftShift, modulatedParametersSpatial.data(), input, inputLineBelow + 1, coefficientsVerticalULDR[y % 2].data() + 1, width);
-            coefficientsVerticalULDR[y % 2][0] = 0;
-            coefficientsVerticalULDR[y % 2][width] = 0;
-            calculateCoefficients(spatialLeftShift, modulatedParametersSpatial.data(), input, inputLineBelow - 1, coefficientsVerticalURDL[y % 2].data(), width);
-            coefficientsVerticalURDL[y % 2][0] = 0;
-            coefficientsVerticalURDL[y % 2][width] = 0;
+            auto dataL = _mm256_srl_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a)), SampleShift);
+            auto dataR = _mm256_srl_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b)), SampleShift);
+            auto diff = _mm256_subs_epi16(dataL, dataR);
+            auto absdiff = _mm256_abs_epi16(diff);
+            auto coeff = _mm256_sub_epi16(_mm256_set1_epi16(parameters->pivot), absdiff);
+            coeff = _mm256_sll_epi16(coeff, LeftShift);
+            coeff = _mm256_sra_epi16(coeff, DepthShift);
+            coeff = _mm256_min_epi16(coeff, _mm256_set1_epi16(parameters->maximum));
+            if(qpAdaptive)
+            {
+                auto min = _mm256_set1_epi16(parameters->minimum);
+                const __m128i RightShift = _mm_set1_epi64x(9);
+                __m256i minmod = _mm256_subs_epi16(_mm256_set1_epi16(512), _mm256_srl_epi16(absdiff, DepthShift));
+                min = _mm256_sra_epi16(_mm256_mullo_epi16(min, minmod), RightShift);
+                coeff = _mm256_max_epi16(coeff, min);
+            }
+            else
+            {
+                coeff = _mm256_max_epi16(coeff, _mm256_set1_epi16(parameters->minimum));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(c), coeff);
+            a += 16;
+            b += 16;
+            c += 16;
+            ++parameters;
         }
-        calculateCoefficients(temporalLeftShift, modulatedParametersTemporal.data(), input, previousOutput, coefficientsTemporal.data(), width);
+    }
 
-        auto h = coefficientsHorizontal.data() + 1;
-        auto d = coefficientsVertical[y % 2].data();
-        auto u = coefficientsVertical[!(y % 2)].data();
+    void Filter::filterLineAvx2(bool qpAdaptive, const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove,
+                                const uint8_t *previousOutput, const uint8_t *inputLineBelow, uint8_t *output,
+                                int width, int16_t qpClamp)
+    {
+        auto h = taps.h;
+        auto d = taps.d;
+        auto u = taps.u;
 
-        auto dr = coefficientsVerticalULDR[y % 2].data() + 1;
-        auto ul = coefficientsVerticalULDR[!(y % 2)].data() + 1;
-        auto dl = coefficientsVerticalURDL[y % 2].data();
-        auto ur = coefficientsVerticalURDL[!(y % 2)].data();
+        auto dr = taps.dr;
+        auto ul = taps.ul;
+        auto dl = taps.dl;
+        auto ur = taps.ur;
 
-        auto t = coefficientsTemporal.data();
+        auto t = taps.t;
 
         const __m128i l2 = _mm_setr_epi32(unityLog2, 0, 0, 0);
 
@@ -182,7 +208,7 @@ namespace PercEncPrefilter
                 accumulator = _mm256_add_epi16(accumulator, _mm256_mullo_epi16(x2, c));
                 coeffTotal = _mm256_add_epi16(coeffTotal, c);
             }
-            if(parametersFrame.qpAdaptive)
+            if(qpAdaptive)
             {
                 {
                 // up left
@@ -233,7 +259,7 @@ namespace PercEncPrefilter
             accumulator = _mm256_sra_epi16(accumulator, l2);
             accumulator = _mm256_add_epi16(accumulator, central2);
 
-            if(parametersFrame.qpAdaptive)
+            if(qpAdaptive)
             {
                 __m256i clamp = _mm256_set1_epi16(qpClamp); // clamp
                 auto central2max = _mm256_add_epi16(central2, clamp);
@@ -241,10 +267,6 @@ namespace PercEncPrefilter
                 accumulator = _mm256_min_epi16(accumulator, central2max);
                 accumulator = _mm256_max_epi16(accumulator, central2min);
             }
-            else
-            {
-                qpClamp = 0;
-            }
 
             __m128i lo_lane = _mm256_castsi256_si128(accumulator);
             __m128i hi_lane = _mm256_extracti128_si256(accumulator, 1);
@@ -260,7 +282,7 @@ namespace PercEncPrefilter
             h += 16;
             d += 16;
             u += 16;
-            if(parametersFrame.qpAdaptive)
+            if(qpAdaptive)
             {
                 dr += 16;
                 ul += 16;
@@ -271,73 +293,250 @@ namespace PercEncPrefilter
         }
     }
 
-    void Filter::processFrame(const uint8_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
-                            const uint8_t *previousOutput, int previousOutputStride, uint8_t *output, int outputStride,
-                            int width, int height, int qp)
+    // 16 bit products of 10 bit samples don't fit 16 bit sums, so taps are accumulated as
+    // coeff * (neighbor - central) in 32 bit, which equals the 8 bit formula without wrap around
+    void Filter::filterLine16(bool qpAdaptive, const Taps &taps, const uint16_t *input, const uint16_t *inputLineAbove,
+                              const uint16_t *previousOutput, const uint16_t *inputLineBelow, uint16_t *output,
+                              int width, int16_t qpClamp, const SampleFormat &format)
+    {
+        const __m128i SampleShift = _mm_cvtsi32_si128(format.shift);
+        const __m256i maxValue = _mm256_set1_epi16(int16_t((1 << format.bitDepth) - 1));
+
+        for (int i = 0; i < width; i += 16)
+        {
+            const auto central = _mm256_srl_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i)), SampleShift);
+
+            // rounding offset
+            __m256i accumulatorLo = _mm256_set1_epi32(unity / 2);
+            __m256i accumulatorHi = _mm256_set1_epi32(unity / 2);
+
+            auto accumulate = [&](const uint16_t *neighbor, const int16_t *coefficients)
+            {
+                auto x = _mm256_srl_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(neighbor + i)), SampleShift);
+                auto c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(coefficients + i));
+                auto diff = _mm256_sub_epi16(x, central);
+                auto lo = _mm256_mullo_epi16(diff, c);
+                auto hi = _mm256_mulhi_epi16(diff, c);
+                accumulatorLo = _mm256_add_epi32(accumulatorLo, _mm256_unpacklo_epi16(lo, hi));
+                accumulatorHi = _mm256_add_epi32(accumulatorHi, _mm256_unpackhi_epi16(lo, hi));
+            };
+
+            accumulate(input - 1, taps.h - 1);       // left
+            accumulate(input + 1, taps.h);           // right
+            accumulate(inputLineAbove, taps.u);      // up
+            accumulate(inputLineBelow, taps.d);      // down
+
+            if (qpAdaptive)
+            {
+                accumulate(inputLineAbove - 1, taps.ul - 1); // up left
+                accumulate(inputLineBelow + 1, taps.dr);     // down right
+                accumulate(inputLineAbove + 1, taps.ur + 1); // up right
+                accumulate(inputLineBelow - 1, taps.dl);     // down left
+            }
+
+            accumulate(previousOutput, taps.t);      // temporal
+
+            accumulatorLo = _mm256_srai_epi32(accumulatorLo, unityLog2);
+            accumulatorHi = _mm256_srai_epi32(accumulatorHi, unityLog2);
+
+            // unpack and pack work within 128 bit lanes, so packing restores the pixel order
+            auto accumulator = _mm256_packs_epi32(accumulatorLo, accumulatorHi);
+            accumulator = _mm256_add_epi16(accumulator, central);
+
+            if (qpAdaptive)
+            {
+                __m256i clamp = _mm256_set1_epi16(qpClamp);
+                accumulator = _mm256_min_epi16(accumulator, _mm256_add_epi16(central, clamp));
+                accumulator = _mm256_max_epi16(accumulator, _mm256_sub_epi16(central, clamp));
+            }
+
+            accumulator = _mm256_max_epi16(accumulator, _mm256_setzero_si256());
+            accumulator = _mm256_min_epi16(accumulator, maxValue);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), _mm256_sll_epi16(accumulator, SampleShift));
+        }
+    }
+
+    void Filter::calculateCoefficients(int leftShift, const Filter::ModulatedParameters<int16_t> *parameters, const uint8_t *a, const uint8_t *b, int16_t *c, int width, const SampleFormat &)
     {
+        calculateCoefficientsImpl(leftShift, parametersFrame.qpAdaptive, parameters, a, b, c, width);
+    }
+
+    void Filter::calculateCoefficients(int leftShift, const Filter::ModulatedParameters<int16_t> *parameters, const uint16_t *a, const uint16_t *b, int16_t *c, int width, const SampleFormat &format)
+    {
+        calculateCoefficients16(leftShift, parametersFrame.qpAdaptive, parameters, a, b, c, width, format);
+    }
+
+    void Filter::filterLine(const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove, const uint8_t *previousOutput,
+                            const uint8_t *inputLineBelow, uint8_t *output, int width, int16_t qpClamp, const SampleFormat &)
+    {
+        filterLineImpl(parametersFrame.qpAdaptive, taps, input, inputLineAbove, previousOutput, inputLineBelow, output, width, qpClamp);
+    }
+
+    void Filter::filterLine(const Taps &taps, const uint16_t *input, const uint16_t *inputLineAbove, const uint16_t *previousOutput,
+                            const uint16_t *inputLineBelow, uint16_t *output, int width, int16_t qpClamp, const SampleFormat &format)
+    {
+        filterLine16(parametersFrame.qpAdaptive, taps, input, inputLineAbove, previousOutput, inputLineBelow, output, width, qpClamp, format);
+    }
+
+    template <typename T>
+    void Filter::processLine(
+        LineBuffers &buffers,
+        int spatialLeftShift,
+        int temporalLeftShift,
+        const T *input,
+        const T *inputLineAbove,
+        const T *previousOutput,
+        const T *inputLineBelow,
+        T *output,
+        int width,
+        int y,
+        int16_t qpClamp,
+        const SampleFormat &format)
+    {
+        auto &coefficientsHorizontal = buffers.coefficientsHorizontal;
+        auto &coefficientsVertical = buffers.coefficientsVertical;
+        auto &coefficientsVerticalULDR = buffers.coefficientsVerticalULDR;
+        auto &coefficientsVerticalURDL = buffers.coefficientsVerticalURDL;
+        auto &coefficientsTemporal = buffers.coefficientsTemporal;
+        auto modulatedParametersSpatial = buffers.modulatedParametersSpatial.data();
+        auto modulatedParametersTemporal = buffers.modulatedParametersTemporal.data();
+
+        calculateCoefficients(spatialLeftShift, modulatedParametersSpatial, input, input + 1, coefficientsHorizontal.data() + 1, width, format);
+        coefficientsHorizontal[0] = 0;
+        coefficientsHorizontal[width] = 0;
+        calculateCoefficients(spatialLeftShift, modulatedParametersSpatial, input, inputLineBelow, coefficientsVertical[y % 2].data(), width, format);
+        if(parametersFrame.qpAdaptive)
+        {
+            calculateCoefficients(spatialLeftShift, modulatedParametersSpatial, input, inputLineBelow + 1, coefficientsVerticalULDR[y % 2].data() + 1, width, format);
+            coefficientsVerticalULDR[y % 2][0] = 0;
+            coefficientsVerticalULDR[y % 2][width] = 0;
+            calculateCoefficients(spatialLeftShift, modulatedParametersSpatial, input, inputLineBelow - 1, coefficientsVerticalURDL[y % 2].data(), width, format);
+            coefficientsVerticalURDL[y % 2][0] = 0;
+            coefficientsVerticalURDL[y % 2][width] = 0;
+        }
+        calculateCoefficients(temporalLeftShift, modulatedParametersTemporal, input, previousOutput, coefficientsTemporal.data(), width, format);
+
+        Taps taps;
+        taps.h = coefficientsHorizontal.data() + 1;
+        taps.d = coefficientsVertical[y % 2].data();
+        taps.u = coefficientsVertical[!(y % 2)].data();
+
+        taps.dr = coefficientsVerticalULDR[y % 2].data() + 1;
+        taps.ul = coefficientsVerticalULDR[!(y % 2)].data() + 1;
+        taps.dl = coefficientsVerticalURDL[y % 2].data();
+        taps.ur = coefficientsVerticalURDL[!(y % 2)].data();
+
+        taps.t = coefficientsTemporal.data();
+
+        filterLine(taps, input, inputLineAbove, previousOutput, inputLineBelow, output, width, qpClamp, format);
+    }
+
+    void Filter::modulateParameters(LineBuffers &buffers, const uint8_t *modulation, int modulationStride, int y, int width16, const SampleFormat &format)
+    {
+        // pivots are in sample units
+        const float pivotScale = float(256 << (format.bitDepth - 8));
+
+        for (int x = 0; x < width16 / 16; ++x)
+        {
+            ModulatedParameters<float> spatial = {};
+            ModulatedParameters<float> temporal = {};
+
+            const int modulationValue = modulationStride ? int(modulation[x + y / 16 * modulationStride]) : 0;
+            const int m[2] = {256 - modulationValue, modulationValue};
+
+            for (int i = 0; i < 2; ++i)
+            {
+                spatial.pivot += m[i] * parametersBlock[i].spatial.pivot * pivotScale;
+                spatial.maximum += m[i] * parametersBlock[i].spatial.maximum * unity;
+                spatial.minimum += m[i] * parametersBlock[i].spatial.minimum * unity;
+
+                if (haveFilteredOneFrame && parametersFrame.temporalEnabled)
+                {
+                    temporal.pivot += m[i] * parametersBlock[i].temporal.pivot * pivotScale;
+                    temporal.maximum += m[i] * parametersBlock[i].temporal.maximum * unity;
+                    temporal.minimum += m[i] * parametersBlock[i].temporal.minimum * unity;
+                }
+            }
+
+            buffers.modulatedParametersSpatial[x].pivot = int16_t(round(spatial.pivot / 256.f));
+            buffers.modulatedParametersSpatial[x].maximum = int16_t(round(spatial.maximum / 256.f));
+            buffers.modulatedParametersSpatial[x].minimum = int16_t(round(spatial.minimum / 256.f));
+
+            buffers.modulatedParametersTemporal[x].pivot = int16_t(round(temporal.pivot / 256.f));
+            buffers.modulatedParametersTemporal[x].maximum = int16_t(round(temporal.maximum / 256.f));
+            buffers.modulatedParametersTemporal[x].minimum = int16_t(round(temporal.minimum / 256.f));
+        }
+    }
+
+    template <typename T>
+    void Filter::processStripeImpl(const T *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                                   const T *previousOutput, int previousOutputStride, T *output, int outputStride,
+                                   int width, int height, int qp, int stripe, int yBegin, int yEnd, const SampleFormat &format)
+    {
+        LineBuffers &buffers = lineBuffers[stripe];
+
         const auto width16 = width / 16 * 16;
         qp = std::min(MAX_QP, std::max(MIN_QP, qp));
         // copy top line
-        std::copy(
-            &input[inputStride * 0],
-            &input[inputStride * 0 + width],
-            &output[outputStride * 0]);
+        if (yBegin == 0)
+            std::copy(
+                &input[inputStride * 0],
+                &input[inputStride * 0 + width],
+                &output[outputStride * 0]);
 
-        __m128i spatialLeftShift, temporalLeftShift{};
-        spatialLeftShift = _mm_set1_epi64x(log2(parametersFrame.spatialSlope));
+        int spatialLeftShift = 0, temporalLeftShift = 0;
+        spatialLeftShift = log2(parametersFrame.spatialSlope);
         if (haveFilteredOneFrame && parametersFrame.temporalEnabled)
-            temporalLeftShift = _mm_set1_epi64x(log2(parametersFrame.temporalSlope));
+            temporalLeftShift = log2(parametersFrame.temporalSlope);
 
         // don't filter top and bottom picture lines to avoid out-of-bounds read access
-        fill(coefficientsHorizontal.begin(),  coefficientsHorizontal.end(),  int16_t(0));
-        fill(coefficientsVertical[0].begin(), coefficientsVertical[0].end(), int16_t(0));
-        fill(coefficientsVertical[1].begin(), coefficientsVertical[1].end(), int16_t(0));
+        fill(buffers.coefficientsHorizontal.begin(),  buffers.coefficientsHorizontal.end(),  int16_t(0));
+        fill(buffers.coefficientsVertical[0].begin(), buffers.coefficientsVertical[0].end(), int16_t(0));
+        fill(buffers.coefficientsVertical[1].begin(), buffers.coefficientsVertical[1].end(), int16_t(0));
         if(parametersFrame.qpAdaptive)
         {
-            fill(coefficientsVerticalULDR[0].begin(), coefficientsVerticalULDR[0].end(), int16_t(0));
-            fill(coefficientsVerticalULDR[1].begin(), coefficientsVerticalULDR[1].end(), int16_t(0));
-            fill(coefficientsVerticalURDL[0].begin(), coefficientsVerticalURDL[0].end(), int16_t(0));
-            fill(coefficientsVerticalURDL[1].begin(), coefficientsVerticalURDL[1].end(), int16_t(0));
+            fill(buffers.coefficientsVerticalULDR[0].begin(), buffers.coefficientsVerticalULDR[0].end(), int16_t(0));
+            fill(buffers.coefficientsVerticalULDR[1].begin(), buffers.coefficientsVerticalULDR[1].end(), int16_t(0));
+            fill(buffers.coefficientsVerticalURDL[0].begin(), buffers.coefficientsVerticalURDL[0].end(), int16_t(0));
+            fill(buffers.coefficientsVerticalURDL[1].begin(), buffers.coefficientsVerticalURDL[1].end(), int16_t(0));
         }
         int16_t clamp = 255;
         if(parametersFrame.qpAdaptive)
-            clamp = (int16_t) (pow(2.0,((double)qp-4.0)/6.0)/4.0);
+            clamp = int16_t((int16_t) (pow(2.0,((double)qp-4.0)/6.0)/4.0) << (format.bitDepth - 8));
+
+        const int yFirst = std::max(yBegin, 1);
+        const int yLast = std::min(yEnd, height - 1);
 
-        for (int y = 1; y < height - 1; ++y)
+        // "up" coefficients of the first line are left from the line above, a stripe starting
+        // below the first filtered line calculates them the same way the line above would do
+        if (yFirst > 1 && yFirst < yLast)
         {
-            if (y == 1 || y % 16 == 0)
-                for (int x = 0; x < width16 / 16; ++x)
-                {
-                    ModulatedParameters<float> spatial = {};
-                    ModulatedParameters<float> temporal = {};
-
-                    const int modulationValue = modulationStride ? int(modulation[x + y / 16 * modulationStride]) : 0;
-                    const int m[2] = {256 - modulationValue, modulationValue};
-
-                    for (int i = 0; i < 2; ++i)
-                    {
-                        spatial.pivot += m[i] * parametersBlock[i].spatial.pivot * 256;
-                        spatial.maximum += m[i] * parametersBlock[i].spatial.maximum * unity;
-                        spatial.minimum += m[i] * parametersBlock[i].spatial.minimum * unity;
-
-                        if (haveFilteredOneFrame && parametersFrame.temporalEnabled)
-                        {
-                            temporal.pivot += m[i] * parametersBlock[i].temporal.pivot * 256;
-                            temporal.maximum += m[i] * parametersBlock[i].temporal.maximum * unity;
-                            temporal.minimum += m[i] * parametersBlock[i].temporal.minimum * unity;
-                        }
-                    }
-
-                    modulatedParametersSpatial[x].pivot = int16_t(round(spatial.pivot / 256.f));
-                    modulatedParametersSpatial[x].maximum = int16_t(round(spatial.maximum / 256.f));
-                    modulatedParametersSpatial[x].minimum = int16_t(round(spatial.minimum / 256.f));
-
-                    modulatedParametersTemporal[x].pivot = int16_t(round(temporal.pivot / 256.f));
-                    modulatedParametersTemporal[x].maximum = int16_t(round(temporal.maximum / 256.f));
-                    modulatedParametersTemporal[x].minimum = int16_t(round(temporal.minimum / 256.f));
-                }
+            const int y = yFirst - 1;
+            const T *line = &input[inputStride * y];
+            const T *lineBelow = &input[inputStride * (y + 1)];
+
+            modulateParameters(buffers, modulation, modulationStride, y, width16, format);
+
+            calculateCoefficients(spatialLeftShift, buffers.modulatedParametersSpatial.data(), line, lineBelow, buffers.coefficientsVertical[y % 2].data(), width16, format);
+            if(parametersFrame.qpAdaptive)
+            {
+                calculateCoefficients(spatialLeftShift, buffers.modulatedParametersSpatial.data(), line, lineBelow + 1, buffers.coefficientsVerticalULDR[y % 2].data() + 1, width16, format);
+                buffers.coefficientsVerticalULDR[y % 2][0] = 0;
+                buffers.coefficientsVerticalULDR[y % 2][width16] = 0;
+                calculateCoefficients(spatialLeftShift, buffers.modulatedParametersSpatial.data(), line, lineBelow - 1, buffers.coefficientsVerticalURDL[y % 2].data(), width16, format);
+                buffers.coefficientsVerticalURDL[y % 2][0] = 0;
+                buffers.coefficientsVerticalURDL[y % 2][width16] = 0;
+            }
+        }
+
+        for (int y = yFirst; y < yLast; ++y)
+        {
+            if (y == yFirst || y % 16 == 0)
+                modulateParameters(buffers, modulation, modulationStride, y, width16, format);
 
             processLine(
+                buffers,
                 spatialLeftShift,
                 temporalLeftShift,
                 &input[inputStride * y],
@@ -347,7 +546,8 @@ namespace PercEncPrefilter
                 &output[outputStride * y],
                 width16,
                 y,
-                clamp);
+                clamp,
+                format);
 
             // if width is not multiple of 16, any odd pixels at right are unfiltered
             std::copy(
@@ -357,11 +557,43 @@ namespace PercEncPrefilter
         }
 
         // copy bottom line
-        std::copy(
-            &input[inputStride * (height - 1)],
-            &input[inputStride * (height - 1) + width],
-            &output[outputStride * (height - 1)]);
+        if (yEnd >= height)
+            std::copy(
+                &input[inputStride * (height - 1)],
+                &input[inputStride * (height - 1) + width],
+                &output[outputStride * (height - 1)]);
+    }
+
+    void Filter::processFrame(const uint8_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                            const uint8_t *previousOutput, int previousOutputStride, uint8_t *output, int outputStride,
+                            int width, int height, int qp)
+    {
+        processStripe(input, inputStride, modulation, modulationStride, previousOutput, previousOutputStride,
+                      output, outputStride, width, height, qp, 0, 0, height);
+
+        finishFrame();
+    }
+
+    void Filter::processStripe(const uint8_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                               const uint8_t *previousOutput, int previousOutputStride, uint8_t *output, int outputStride,
+                               int width, int height, int qp, int stripe, int yBegin, int yEnd)
+    {
+        const SampleFormat format = {8, 0};
+
+        processStripeImpl(input, inputStride, modulation, modulationStride, previousOutput, previousOutputStride,
+                          output, outputStride, width, height, qp, stripe, yBegin, yEnd, format);
+    }
 
+    void Filter::processStripe(const uint16_t *input, int inputStride, const uint8_t *modulation, int modulationStride,
+                               const uint16_t *previousOutput, int previousOutputStride, uint16_t *output, int outputStride,
+                               int width, int height, int qp, int stripe, int yBegin, int yEnd, const SampleFormat &format)
+    {
+        processStripeImpl(input, inputStride, modulation, modulationStride, previousOutput, previousOutputStride,
+                          output, outputStride, width, height, qp, stripe, yBegin, yEnd, format);
+    }
+
+    void Filter::finishFrame()
+    {
         haveFilteredOneFrame = true;
     }
 
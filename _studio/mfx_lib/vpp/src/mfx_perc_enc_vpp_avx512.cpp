@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#if defined(ONEVPL_EXPERIMENTAL)
+
+#include "mfx_perc_enc_vpp_avx2.h"
+
+#include <immintrin.h>
+
+namespace PercEncPrefilter
+{
+    // 32 pixels cover two 16x16 blocks, lower half takes parameters of the first one
+    static inline __m512i setBlockPair(int16_t first, int16_t second)
+    {
+        return _mm512_inserti64x4(_mm512_set1_epi16(first), _mm256_set1_epi16(second), 1);
+    }
+
+    void Filter::calculateCoefficientsAvx512(int leftShift, bool qpAdaptive, const Filter::ModulatedParameters<int16_t> *parameters, const uint8_t *a, const uint8_t *b, int16_t *c, int width)
+    {
+        const __m128i LeftShift = _mm_cvtsi32_si128(leftShift);
+        const int width32 = width / 32 * 32;
+
+        for (int i = 0; i < width32; i += 32)
+        {
+            auto dataL = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a)));
+            auto dataR = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b)));
+            auto diff = _mm512_subs_epi16(dataL, dataR);
+            auto absdiff = _mm512_abs_epi16(diff);
+            auto coeff = _mm512_sub_epi16(setBlockPair(parameters[0].pivot, parameters[1].pivot), absdiff);
+            coeff = _mm512_sll_epi16(coeff, LeftShift);
+            coeff = _mm512_min_epi16(coeff, setBlockPair(parameters[0].maximum, parameters[1].maximum));
+            if(qpAdaptive)
+            {
+                auto min = setBlockPair(parameters[0].minimum, parameters[1].minimum);
+                const __m128i RightShift = _mm_set1_epi64x(9);
+                __m512i minmod = _mm512_subs_epi16(_mm512_set1_epi16(512), absdiff);
+                min = _mm512_sra_epi16(_mm512_mullo_epi16(min, minmod), RightShift);
+                coeff = _mm512_max_epi16(coeff, min);
+            }
+            else
+            {
+                coeff = _mm512_max_epi16(coeff, setBlockPair(parameters[0].minimum, parameters[1].minimum));
+            }
+            _mm512_storeu_si512(c, coeff);
+            a += 32;
+            b += 32;
+            c += 32;
+            parameters += 2;
+        }
+
+        // odd 16 pixel block
+        if (width32 < width)
+            calculateCoefficientsAvx2(leftShift, qpAdaptive, parameters, a, b, c, width - width32);
+    }
+
+    void Filter::filterLineAvx512(bool qpAdaptive, const Taps &taps, const uint8_t *input, const uint8_t *inputLineAbove,
+                                  const uint8_t *previousOutput, const uint8_t *inputLineBelow, uint8_t *output,
+                                  int width, int16_t qpClamp)
+    {
+        const int width32 = width / 32 * 32;
+        const __m128i l2 = _mm_setr_epi32(unityLog2, 0, 0, 0);
+
+        __m512i accumulator, coeffTotal;
+
+        // same arithmetic as filterLineAvx2, 16 bit sums wrap around the same way
+        auto accumulate = [&](const uint8_t *neighbor, const int16_t *coefficients)
+        {
+            auto x2 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(neighbor)));
+            auto c = _mm512_loadu_si512(coefficients);
+            accumulator = _mm512_add_epi16(accumulator, _mm512_mullo_epi16(x2, c));
+            coeffTotal = _mm512_add_epi16(coeffTotal, c);
+        };
+
+        for (int i = 0; i < width32; i += 32)
+        {
+            accumulator = _mm512_set1_epi16(unity / 2); // rounding offset
+            coeffTotal = _mm512_setzero_si512();
+
+            accumulate(input + i - 1, taps.h + i - 1);          // left
+            accumulate(input + i + 1, taps.h + i);              // right
+            accumulate(inputLineAbove + i, taps.u + i);         // up
+            accumulate(inputLineBelow + i, taps.d + i);         // down
+
+            if(qpAdaptive)
+            {
+                accumulate(inputLineAbove + i - 1, taps.ul + i - 1); // up left
+                accumulate(inputLineBelow + i + 1, taps.dr + i);     // down right
+                accumulate(inputLineAbove + i + 1, taps.ur + i + 1); // up right
+                accumulate(inputLineBelow + i - 1, taps.dl + i);     // down left
+            }
+
+            accumulate(previousOutput + i, taps.t + i);         // temporal
+
+            auto central2 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i)));
+            accumulator = _mm512_sub_epi16(accumulator, _mm512_mullo_epi16(central2, coeffTotal));
+
+            accumulator = _mm512_sra_epi16(accumulator, l2);
+            accumulator = _mm512_add_epi16(accumulator, central2);
+
+            if(qpAdaptive)
+            {
+                __m512i clamp = _mm512_set1_epi16(qpClamp);
+                accumulator = _mm512_min_epi16(accumulator, _mm512_add_epi16(central2, clamp));
+                accumulator = _mm512_max_epi16(accumulator, _mm512_sub_epi16(central2, clamp));
+            }
+
+            // saturate to 8 bit as packus does, then drop the upper bytes
+            accumulator = _mm512_max_epi16(accumulator, _mm512_setzero_si512());
+            accumulator = _mm512_min_epi16(accumulator, _mm512_set1_epi16(255));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), _mm512_cvtepi16_epi8(accumulator));
+        }
+
+        // odd 16 pixel block
+        if (width32 < width)
+        {
+            Taps tail = taps;
+            tail.h += width32;
+            tail.u += width32;
+            tail.d += width32;
+            tail.t += width32;
+            if(qpAdaptive)
+            {
+                tail.ul += width32;
+                tail.dr += width32;
+                tail.ur += width32;
+                tail.dl += width32;
+            }
+
+            filterLineAvx2(qpAdaptive, tail, input + width32, inputLineAbove + width32, previousOutput + width32,
+                           inputLineBelow + width32, output + width32, width - width32, qpClamp);
+        }
+    }
+
+} // namespace
+
+#endif
@@ -5719,8 +5719,8 @@ mfxStatus ValidateParams(mfxVideoParam *par, mfxVppCaps *caps, VideoCORE *core,
 
 #if defined (ONEVPL_EXPERIMENTAL)
     {
-        // perceptual encoding filter cannot work with CC others than NV12; also interlace is not supported
-        if (par->vpp.Out.FourCC != MFX_FOURCC_NV12 || par->vpp.Out.PicStruct != MFX_PICSTRUCT_PROGRESSIVE)
+        // perceptual encoding filter cannot work with CC others than NV12 and P010; also interlace is not supported
+        if ((par->vpp.Out.FourCC != MFX_FOURCC_NV12 && par->vpp.Out.FourCC != MFX_FOURCC_P010) || par->vpp.Out.PicStruct != MFX_PICSTRUCT_PROGRESSIVE)
         {
             if (IsFilterFound(pList, pLen, MFX_EXTBUFF_VPP_PERC_ENC_PREFILTER))
             {
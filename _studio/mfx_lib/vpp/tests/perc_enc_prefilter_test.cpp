@@ -0,0 +1,216 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Perceptual prefilter must give the same output bit for bit:
+//  - filtering a frame in row stripes, in any order, as filtering it whole,
+//    including the temporal term over a sequence of frames
+//  - with the AVX-512BW kernels as with the AVX2 reference kernels
+// 8 bit and P010 (with and without shift) input, with and without QP adaptive
+// filtering and modulation. Exits with non-zero status on a mismatch.
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mfx_perc_enc_vpp_avx2.h"
+
+using namespace PercEncPrefilter;
+
+// kernels read a few samples left and right of the line, planes keep a margin around them
+template <typename T>
+struct Plane
+{
+    static constexpr int margin = 32;
+
+    Plane(int width, int height)
+        : stride(width + 2 * margin)
+        , samples(size_t(stride) * (height + 2))
+    {}
+
+    T* data() { return &samples[stride + margin]; }
+
+    int            stride;
+    std::vector<T> samples;
+};
+
+struct Case
+{
+    int  width;
+    int  height;
+    int  bitDepth;
+    int  shift;
+    bool qpAdaptive;
+    bool modulated;
+    bool avx2;
+};
+
+// smooth content with noise, so that the coefficients don't saturate everywhere
+template <typename T>
+static void MakeFrame(Plane<T>& plane, const Case& c, int frame)
+{
+    const int maxValue = (1 << c.bitDepth) - 1;
+
+    for (int y = -1; y <= c.height; y++)
+    {
+        for (int x = -Plane<T>::margin; x < c.width + Plane<T>::margin; x++)
+        {
+            int v = ((x + 3 * frame) * 7 + y * 5) % (maxValue + 1);
+            v = std::min(std::max(v + rand() % 9 - 4, 0), maxValue);
+            plane.data()[y * plane.stride + x] = T(v << c.shift);
+        }
+    }
+}
+
+// filters the sequence splitting every frame at rows in splits, stripes go in reverse order
+template <typename T>
+static std::vector<T> FilterSequence(const Case& c, const std::vector<int>& splits, int frames)
+{
+    Parameters::PerFrame parametersFrame;
+    parametersFrame.qpAdaptive = c.qpAdaptive;
+    std::array<Parameters::PerBlock, 2> parametersBlock;
+    parametersBlock[1].spatial.pivot = 0.1f;
+
+    const int numStripes = int(splits.size()) - 1;
+    Filter filter(parametersFrame, parametersBlock, c.width, numStripes);
+
+    if (c.avx2)
+    {
+        filter.calculateCoefficientsImpl = Filter::calculateCoefficientsAvx2;
+        filter.filterLineImpl            = Filter::filterLineAvx2;
+    }
+
+    // every run of a case sees the same content
+    srand(c.width * 31 + c.height);
+
+    const int modulationStride = c.modulated ? (c.width + 15) / 16 : 0;
+    std::vector<uint8_t> modulation(size_t(modulationStride) * ((c.height + 15) / 16) + 1);
+    for (auto& m : modulation)
+        m = uint8_t(rand());
+
+    Plane<T> input(c.width, c.height), output(c.width, c.height);
+    std::vector<T> previousOutput(size_t(c.width) * c.height);
+    std::vector<T> result;
+
+    const Filter::SampleFormat format = { c.bitDepth, c.shift };
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        MakeFrame(input, c, frame);
+
+        for (int stripe = numStripes - 1; stripe >= 0; stripe--)
+        {
+            const int yBegin = splits[stripe], yEnd = splits[stripe + 1];
+
+            if (sizeof(T) == 1)
+                filter.processStripe((const uint8_t*)input.data(), input.stride, modulation.data(), modulationStride,
+                                     (const uint8_t*)previousOutput.data(), c.width, (uint8_t*)output.data(), output.stride,
+                                     c.width, c.height, MAX_QP - frame, stripe, yBegin, yEnd);
+            else
+                filter.processStripe((const uint16_t*)input.data(), input.stride, modulation.data(), modulationStride,
+                                     (const uint16_t*)previousOutput.data(), c.width, (uint16_t*)output.data(), output.stride,
+                                     c.width, c.height, MAX_QP - frame, stripe, yBegin, yEnd, format);
+
+            // like PercEncFilter, a stripe keeps its own rows of previous output
+            for (int y = yBegin; y < yEnd; y++)
+                std::copy(&output.data()[y * output.stride], &output.data()[y * output.stride + c.width], &previousOutput[size_t(y) * c.width]);
+        }
+
+        filter.finishFrame();
+
+        result.insert(result.end(), previousOutput.begin(), previousOutput.end());
+    }
+
+    return result;
+}
+
+template <typename T>
+static int Check(const Case& c, int frames, bool haveAvx512)
+{
+    int failures = 0;
+
+    auto report = [&](const char* what)
+    {
+        printf("FAILED %dx%d %d bit shift %d qpAdaptive %d modulated %d %s: %s\n",
+               c.width, c.height, c.bitDepth, c.shift, c.qpAdaptive, c.modulated, c.avx2 ? "AVX2" : "default kernels", what);
+        failures++;
+    };
+
+    const std::vector<T> whole = FilterSequence<T>(c, { 0, c.height }, frames);
+
+    // splits at 16 lines like PercEncFilter does, and at arbitrary lines
+    std::vector<std::vector<int>> splits = { { 0, std::min(16, c.height), c.height }, { 0, 1, 2, c.height - 1, c.height } };
+
+    for (int n = 2; n <= 8; n++)
+    {
+        std::vector<int> s = { 0 };
+        for (int i = 1; i < n; i++)
+            s.push_back(std::min(std::max(s.back(), i * c.height / n + rand() % 7 - 3), c.height));
+        s.push_back(c.height);
+        splits.push_back(s);
+    }
+
+    for (auto& s : splits)
+    {
+        if (FilterSequence<T>(c, s, frames) != whole)
+            report("stripes differ from whole frame");
+    }
+
+    // 16 bit samples have AVX2 kernels only
+    if (sizeof(T) == 1 && haveAvx512 && !c.avx2)
+    {
+        Case reference = c;
+        reference.avx2 = true;
+
+        if (FilterSequence<T>(reference, { 0, c.height }, frames) != whole)
+            report("AVX-512BW differs from AVX2");
+    }
+
+    return failures;
+}
+
+int main()
+{
+    const bool haveAvx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+    const int frames = 4;
+
+    int failures = 0, cases = 0;
+
+    for (int width : { 16, 40, 100, 264, 1288 })
+    {
+        for (int height : { 3, 17, 64, 130 })
+        {
+            for (int flags = 0; flags < 4; flags++)
+            {
+                const bool qpAdaptive = flags & 1, modulated = flags & 2;
+
+                failures += Check<uint8_t>({ width, height, 8, 0, qpAdaptive, modulated, false }, frames, haveAvx512);
+                failures += Check<uint16_t>({ width, height, 10, 6, qpAdaptive, modulated, false }, frames, haveAvx512);
+                failures += Check<uint16_t>({ width, height, 10, 0, qpAdaptive, modulated, false }, frames, haveAvx512);
+                cases += 3;
+            }
+        }
+    }
+
+    printf("%d cases, %d failures%s\n", cases, failures, haveAvx512 ? "" : " (AVX-512BW not checked, CPU doesn't support it)");
+
+    return failures ? 1 : 0;
+}
@@ -22,23 +22,28 @@
 
 #include <list>
 #include <string>
+#include <vector>
+#include <atomic>
 #include "asc_structures.h"
+#include "mfx_stripe_workers.h"
 
 namespace ns_asc {
 
-#if defined(__AVX2__)
 #define ASC_CPU_DISP_INIT_AVX2(func)        (func = (func ## _AVX2))
 #define ASC_CPU_DISP_INIT_AVX2_SSE4_C(func) (m_AVX2_available ? ASC_CPU_DISP_INIT_AVX2(func) : ASC_CPU_DISP_INIT_SSE4_C(func))
 #define ASC_CPU_DISP_INIT_AVX2_C(func)      (m_AVX2_available ? ASC_CPU_DISP_INIT_AVX2(func) : ASC_CPU_DISP_INIT_C(func))
-#else
-#define ASC_CPU_DISP_INIT_AVX2_SSE4_C       ASC_CPU_DISP_INIT_SSE4_C
-#define ASC_CPU_DISP_INIT_AVX2_C            ASC_CPU_DISP_INIT_C
-#endif
 
 #define ASC_CPU_DISP_INIT_C(func)           (func = (func ## _C))
 #define ASC_CPU_DISP_INIT_SSE4(func)        (func = (func ## _SSE4))
 #define ASC_CPU_DISP_INIT_SSE4_C(func)      (m_SSE4_available ? ASC_CPU_DISP_INIT_SSE4(func) : ASC_CPU_DISP_INIT_C(func))
 
+#define ASC_CPU_DISP_INIT_AVX512(func)      (func = (func ## _AVX512))
+#define ASC_CPU_DISP_INIT_AVX512_C(func)    (m_AVX512_available ? ASC_CPU_DISP_INIT_AVX512(func) : ASC_CPU_DISP_INIT_C(func))
+#define ASC_CPU_DISP_INIT_AVX512_SSE4_C(func) \
+    (m_AVX512_available ? ASC_CPU_DISP_INIT_AVX512(func) : ASC_CPU_DISP_INIT_SSE4_C(func))
+#define ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(func) \
+    (m_AVX512_available ? ASC_CPU_DISP_INIT_AVX512(func) : ASC_CPU_DISP_INIT_AVX2_SSE4_C(func))
+
 
 typedef void(*t_GainOffset)(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff);
 typedef void(*t_RsCsCalc)(pmfxU8 pSrc, int srcPitch, int wblocks, int hblocks, pmfxU16 pRs, pmfxU16 pCs);
@@ -114,6 +119,22 @@ typedef struct ASCextended_storage {
         frameOrder;
 }ASCVidRead;
 
+// Motion statistics of one row of blocks, rows are summed in order
+typedef struct ASCmotion_stats {
+    mfxI32
+        average,
+        var,
+        jtvar,
+        mcjtvar;
+    mfxU32
+        acc,
+        valb,
+        MVdiffVal,
+        AbsMVSize,
+        AbsMVHSize,
+        AbsMVVSize;
+}ASCMotionStats;
+
 class ASC {
 public:
     ASC();
@@ -130,6 +151,8 @@ protected:
 
     static const int subWidth = 128;
     static const int subHeight = 64;
+    // rows of 8x8 blocks, one frame is never split into more stripes
+    static const int meRows = subHeight / 8;
 
     ASCVidRead *m_support;
     ASCVidData *m_dataIn;
@@ -153,6 +176,7 @@ protected:
     std::list<std::pair<mfxI32, bool> >
         ltr_check_history;
 
+    int m_AVX512_available;
     int m_AVX2_available;
     int m_SSE4_available;
     t_GainOffset               GainOffset;
@@ -163,6 +187,19 @@ protected:
     t_ME_SAD_8x8_Block_Search  ME_SAD_8x8_Block_Search;
     t_Calc_RaCa_pic            Calc_RaCa_pic;
 
+    mfxU32
+        m_numThreads;
+    mfx::StripeWorkers
+        m_workers;
+    ASCMotionStats
+        m_rowStats[meRows];
+    std::atomic<mfxU32>
+        m_rowProgress[meRows];
+    mfxU32
+        m_stripeSum[meRows],
+        m_stripeRs[meRows],
+        m_stripeCs[meRows];
+
     virtual void VidSample_dispose();
 
     void SubSample_Point(
@@ -170,8 +207,10 @@ protected:
         pmfxU8 pDst, mfxU32 dstWidth, mfxU32 dstHeight, mfxU32 dstPitch,
         mfxI16 &avgLuma);
     mfxStatus RsCsCalc();
+    void RsCsCalcRows(mfxU32 stripe, mfxU32 numStripes);
     virtual mfxI32 ShotDetect(ASCimageData& Data, ASCimageData& DataRef, ASCImDetails& imageInfo, ASCTSCstat *current, ASCTSCstat *reference, mfxU8 controlLevel);
     void MotionAnalysis(ASCVidSample *videoIn, ASCVidSample *videoRef, mfxU32 *TSC, mfxU16 *AFD, mfxU32 *MVdiffVal, mfxU32 *AbsMVSize, mfxU32 *AbsMVHSize, mfxU32 *AbsMVVSize, ASCLayers lyrIdx);
+    void MotionAnalysisRows(ASCVidSample *videoIn, ASCVidSample *videoRef, ASCimageData *referenceImageIn, mfxU32 firstRow, mfxU32 rowStep, ASCLayers lyrIdx);
 
     typedef void(ASC::*t_resizeImg)(mfxU8 *frame, mfxI32 srcWidth, mfxI32 srcHeight, mfxI32 inputPitch, ns_asc::ASCLayers dstIdx, mfxU32 parity);
     t_resizeImg resizeFunc;
@@ -212,6 +251,7 @@ public:
     bool IsASCinitialized();
 
     void SetControlLevel(mfxU8 level);
+    mfxStatus SetNumThreads(mfxU32 numThreads);
     mfxStatus SetGoPSize(mfxU32 GoPSize);
     void ResetGoPSize();
 
@@ -21,8 +21,8 @@
 #ifndef _ASC_AVX2_IMPL_H_
 #define _ASC_AVX2_IMPL_H_
 
-#if defined(__AVX2__)
 #include "asc_common_impl.h"
+#include "tree.h"
 
 void ME_SAD_8x8_Block_Search_AVX2(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange,
     mfxU16 *bestSAD, int *bestX, int *bestY);
@@ -40,7 +40,6 @@ void GainOffset_AVX2(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mf
     mfxI16 gainDiff);
 mfxStatus Calc_RaCa_pic_AVX2(mfxU8 *pSrc, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
 mfxI16 AvgLumaCalc_AVX2(pmfxU32 pAvgLineVal, int len);
-
-#endif //defined(__AVX2__)
+mfxU32 EvaluateForest_AVX2(const ASCTreeNode* nodes, const mfxU16* roots, mfxU32 numTrees, const mfxI32* features);
 
 #endif //_ASC_AVX2_IMPL_H_
\ No newline at end of file
@@ -36,6 +36,7 @@ void RsCsCalc_diff_C(pmfxU16 pRs0, pmfxU16 pCs0, pmfxU16 pRs1, pmfxU16 pCs1, int
 void ImageDiffHistogram_C(pmfxU8 pSrc, pmfxU8 pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC);
 void GainOffset_C(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mfxU16 pitch,
     mfxI16 gainDiff);
+mfxF64 Calc_RaCa_pic_norm(mfxI32 Rs, mfxI32 Cs, mfxI32 width, mfxI32 height);
 mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
 mfxI16 AvgLumaCalc_C(pmfxU32 pAvgLineVal, int len);
 
@@ -32,15 +32,12 @@ static inline mfxI32 CpuFeature_SSE41() {
     return((__builtin_cpu_supports("sse4.1")));
 }
 
-#if defined(__AVX2__)
-#endif
-
 static inline mfxI32 CpuFeature_AVX2() {
-#if defined(__AVX2__)
-        return((__builtin_cpu_supports("avx2")));
-#else
-    return 0;
-#endif //defined(__AVX2__)
+    return((__builtin_cpu_supports("avx2")));
+}
+
+static inline mfxI32 CpuFeature_AVX512BW() {
+    return((__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")));
 }
 
 //
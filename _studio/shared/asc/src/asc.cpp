@@ -174,6 +174,12 @@ void ASCimageData::Close() {
     Image.V = nullptr;
 }
 
+// VPL_ASC_THREADS sets number of threads analysing one frame, by default the analysis is not split
+static mfxU32 GetDefaultNumThreads()
+{
+    return std::max<mfxU32>(mfx::GetEnv<mfxU32>("VPL_ASC_THREADS", 1), 1);
+}
+
 ASC::ASC()
     : m_gpuImPitch(0)
     , m_threadsWidth(0)
@@ -190,6 +196,7 @@ ASC::ASC()
     , m_height(0)
     , m_pitch(0)
     , ltr_check_history()
+    , m_AVX512_available(0)
     , m_AVX2_available(0)
     , m_SSE4_available(0)
     , GainOffset(nullptr)
@@ -199,6 +206,7 @@ ASC::ASC()
     , ImageDiffHistogram(nullptr)
     , ME_SAD_8x8_Block_Search(nullptr)
     , Calc_RaCa_pic(nullptr)
+    , m_numThreads(std::min<mfxU32>(GetDefaultNumThreads(), meRows))
     , resizeFunc(nullptr)
     , m_videoData(nullptr)
 {
@@ -406,16 +414,17 @@ mfxStatus ASC::Init(mfxI32 Width,
 {
     mfxStatus sts = MFX_ERR_NONE;
 
+    m_AVX512_available = CpuFeature_AVX512BW();
     m_AVX2_available = CpuFeature_AVX2();
     m_SSE4_available = CpuFeature_SSE41();
 
-    ASC_CPU_DISP_INIT_C(GainOffset);
-    ASC_CPU_DISP_INIT_SSE4_C(RsCsCalc_4x4);
+    ASC_CPU_DISP_INIT_AVX512_C(GainOffset);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(RsCsCalc_4x4);
     ASC_CPU_DISP_INIT_C(RsCsCalc_bound);
     ASC_CPU_DISP_INIT_C(RsCsCalc_diff);
-    ASC_CPU_DISP_INIT_SSE4_C(ImageDiffHistogram);
-    ASC_CPU_DISP_INIT_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
-    ASC_CPU_DISP_INIT_SSE4_C(Calc_RaCa_pic);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(ImageDiffHistogram);
+    ASC_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(ME_SAD_8x8_Block_Search);
+    ASC_CPU_DISP_INIT_AVX512_SSE4_C(Calc_RaCa_pic);
 
     InitStruct();
     try
@@ -474,6 +483,8 @@ mfxStatus ASC::Init(mfxI32 Width,
     m_dataReady = false;
     m_ASCinitialized = (sts == MFX_ERR_NONE);
 
+    m_workers.Start(m_numThreads - 1);
+
     (void)isCmSupported;
     return sts;
 }
@@ -490,6 +501,21 @@ void ASC::SetControlLevel(mfxU8 level) {
     m_support->control = level;
 }
 
+// overrides VPL_ASC_THREADS, which is read in debug builds only
+mfxStatus ASC::SetNumThreads(mfxU32 numThreads) {
+    if (numThreads == 0) {
+        ASC_PRINTF("\nError: Number of threads cannot be zero!\n");
+        return MFX_ERR_INVALID_VIDEO_PARAM;
+    }
+
+    m_numThreads = std::min<mfxU32>(numThreads, meRows);
+
+    if (m_ASCinitialized && m_workers.GetNumStripes() != m_numThreads)
+        m_workers.Start(m_numThreads - 1);
+
+    return MFX_ERR_NONE;
+}
+
 mfxStatus ASC::SetGoPSize(mfxU32 GoPSize) {
     if (GoPSize > Double_HEVC_Gop) {
         ASC_PRINTF("\nError: GoPSize is too big! (%i)\n", GoPSize);
@@ -514,6 +540,8 @@ void ASC::ResetGoPSize() {
 }
 
 void ASC::Close() {
+    m_workers.Stop();
+
     if(m_videoData != nullptr) {
         VidSample_dispose();
         delete[] m_videoData;
@@ -559,6 +587,29 @@ void ASC::SubSampleASC_ImageInt(mfxU8 *frame, mfxI32 srcWidth, mfxI32 srcHeight,
     SubSample_Point(frame + (parity * inputPitch), srcWidth, srcHeight / 2, inputPitch * 2, pDst, dstWidth, dstHeight, dstPitch, avgLuma);
 }
 
+//
+// Point-samples dst rows [y0, y1) and returns the sum of the samples
+//
+static mfxU32 SubSample_PointRows(
+    pmfxU8 pSrc, mfxU32 srcPitch, mfxI32 step_w, mfxI32 step_h, mfxI32 need_correction,
+    pmfxU8 pDst, mfxU32 dstWidth, mfxU32 dstPitch, mfxI32 y0, mfxI32 y1) {
+    mfxI32 correction = 0;
+    mfxU32 sumAll = 0;
+
+    for (mfxI32 y = y0; y < y1; y++) {
+        correction = (y % 2) & need_correction;
+        for (mfxI32 x = 0; x < (mfxI32)dstWidth; x++) {
+
+            pmfxU8 ps = pSrc + ((y * step_h + correction) * srcPitch) + (x * step_w);
+            pmfxU8 pd = pDst + (y * dstPitch) + x;
+
+            pd[0] = ps[0];
+            sumAll += ps[0];
+        }
+    }
+    return sumAll;
+}
+
 //
 // SubSample pSrc into pDst, using point-sampling of source pixels
 // Corrects the position on odd lines in case the input video is
@@ -572,21 +623,18 @@ void ASC::SubSample_Point(
     mfxI32 step_h = srcHeight / dstHeight;
 
     mfxI32 need_correction = !(step_h % 2);
-    mfxI32 correction = 0;
     mfxU32 sumAll = 0;
-    mfxI32 y = 0;
 
-    for (y = 0; y < (mfxI32)dstHeight; y++) {
-        correction = (y % 2) & need_correction;
-        for (mfxI32 x = 0; x < (mfxI32)dstWidth; x++) {
+    const mfxU32 numStripes = m_workers.GetNumStripes();
+    m_workers.Run(numStripes, [&](mfxU32 stripe) {
+        mfxI32 y0 = mfxI32(dstHeight * stripe / numStripes);
+        mfxI32 y1 = mfxI32(dstHeight * (stripe + 1) / numStripes);
+        m_stripeSum[stripe] = SubSample_PointRows(pSrc, srcPitch, step_w, step_h, need_correction, pDst, dstWidth, dstPitch, y0, y1);
+    });
 
-            pmfxU8 ps = pSrc + ((y * step_h + correction) * srcPitch) + (x * step_w);
-            pmfxU8 pd = pDst + (y * dstPitch) + x;
+    for (mfxU32 i = 0; i < numStripes; i++)
+        sumAll += m_stripeSum[i];
 
-            pd[0] = ps[0];
-            sumAll += ps[0];
-        }
-    }
     avgLuma = (mfxI16)(sumAll >> 13);
 }
 
@@ -609,13 +657,50 @@ mfxStatus ASC::RsCsCalc() {
             return MFX_ERR_MEMORY_ALLOC;
         GainOffset(&ss, &m_support->gainCorrection.Image.Y, (mfxU16)vidCar._cwidth, (mfxU16)vidCar._cheight, (mfxU16)vidCar.Extended_Width, diff);
     }
-    ss = m_videoData[ASCCurrent_Frame]->layer.Image.Y;
 
-    RsCsCalc_4x4(ss, pFrame->pitch, wblocks, hblocks, m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs);
-    RsCsCalc_bound(m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs, m_videoData[ASCCurrent_Frame]->layer.RsCs, &m_videoData[ASCCurrent_Frame]->layer.RsVal, &m_videoData[ASCCurrent_Frame]->layer.CsVal, wblocks, hblocks);
+    const mfxU32 numStripes = m_workers.GetNumStripes();
+    if (numStripes == 1) {
+        ss = m_videoData[ASCCurrent_Frame]->layer.Image.Y;
+
+        RsCsCalc_4x4(ss, pFrame->pitch, wblocks, hblocks, m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs);
+        RsCsCalc_bound(m_videoData[ASCCurrent_Frame]->layer.Rs, m_videoData[ASCCurrent_Frame]->layer.Cs, m_videoData[ASCCurrent_Frame]->layer.RsCs, &m_videoData[ASCCurrent_Frame]->layer.RsVal, &m_videoData[ASCCurrent_Frame]->layer.CsVal, wblocks, hblocks);
+        return MFX_ERR_NONE;
+    }
+
+    m_workers.Run(numStripes, [this, numStripes](mfxU32 stripe) { RsCsCalcRows(stripe, numStripes); });
+
+    // frame sums wrap at 16 bits in RsCsCalc_bound, so do the stripe sums
+    mfxU16
+        accRs = 0,
+        accCs = 0;
+    for (mfxU32 i = 0; i < numStripes; i++) {
+        accRs += (mfxU16)m_stripeRs[i];
+        accCs += (mfxU16)m_stripeCs[i];
+    }
+    m_videoData[ASCCurrent_Frame]->layer.RsVal = accRs;
+    m_videoData[ASCCurrent_Frame]->layer.CsVal = accCs;
     return MFX_ERR_NONE;
 }
 
+void ASC::RsCsCalcRows(mfxU32 stripe, mfxU32 numStripes) {
+    ASCimageData
+        &layer = m_videoData[ASCCurrent_Frame]->layer;
+    mfxI32
+        pitch   = (mfxI32)layer.Image.pitch,
+        hblocks = (mfxI32)(layer.Image.height >> BLOCK_SIZE_SHIFT),
+        wblocks = (mfxI32)(layer.Image.width >> BLOCK_SIZE_SHIFT),
+        first   = mfxI32(hblocks * stripe / numStripes),
+        last    = mfxI32(hblocks * (stripe + 1) / numStripes),
+        offset  = first * wblocks;
+
+    // RsCsCalc_4x4 leaves two bottom rows of blocks out, RsCsCalc_bound runs over all of them
+    mfxI32 calcRows = std::min(last, hblocks - 2) - first;
+    if (calcRows > 0)
+        RsCsCalc_4x4(layer.Image.Y + ((first << BLOCK_SIZE_SHIFT) * pitch), pitch, wblocks, calcRows + 2, layer.Rs + offset, layer.Cs + offset);
+
+    RsCsCalc_bound(layer.Rs + offset, layer.Cs + offset, layer.RsCs + offset, &m_stripeRs[stripe], &m_stripeCs[stripe], wblocks, last - first);
+}
+
 bool Hint_LTR_op_on(mfxU32 SC, mfxU32 TSC) {
     bool ltr = TSC *TSC < (std::max(SC, 64u) / 12);
     return ltr;
@@ -686,6 +771,33 @@ mfxI32 ASC::ShotDetect(ASCimageData& Data, ASCimageData& DataRef, ASCImDetails&
     return SChange;
 }
 
+void ASC::MotionAnalysisRows(ASCVidSample *videoIn, ASCVidSample *videoRef, ASCimageData *referenceImageIn, mfxU32 firstRow, mfxU32 rowStep, ASCLayers lyrIdx) {
+    for (mfxU32 i = firstRow; i < m_dataIn->layer[lyrIdx].Height_in_blocks; i += rowStep) {
+        ASCMotionStats
+            &row = m_rowStats[i];
+        row = {};
+        mfxU16 prevFPos = mfxU16(i << 4);
+        for (mfxU16 j = 0; j < m_dataIn->layer[lyrIdx].Width_in_blocks; j++) {
+            // predictor of block j takes vectors of blocks j - 1 and j of the row above
+            if (rowStep > 1 && i > 0) {
+                while (m_rowProgress[i - 1].load(std::memory_order_acquire) <= j)
+                    std::this_thread::yield();
+            }
+            mfxU16 fPos = prevFPos + j;
+            row.acc += ME_simple(&row, fPos, m_dataIn->layer, &videoIn->layer, referenceImageIn, true, m_dataIn, ME_SAD_8x8_Block_Search);
+            row.valb += videoIn->layer.SAD[fPos];
+            row.MVdiffVal += (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x) * (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x);
+            row.MVdiffVal += (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y) * (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y);
+            row.AbsMVHSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x);
+            row.AbsMVVSize += (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
+            row.AbsMVSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x) + (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
+
+            if (rowStep > 1)
+                m_rowProgress[i].store(j + 1u, std::memory_order_release);
+        }
+    }
+}
+
 void ASC::MotionAnalysis(ASCVidSample *videoIn, ASCVidSample *videoRef, mfxU32 *TSC, mfxU16 *AFD, mfxU32 *MVdiffVal, mfxU32 *AbsMVSize, mfxU32 *AbsMVHSize, mfxU32 *AbsMVVSize, ASCLayers lyrIdx) {
     mfxU32//24bit is enough
         valb = 0;
@@ -709,19 +821,30 @@ void ASC::MotionAnalysis(ASCVidSample *videoIn, ASCVidSample *videoRef, mfxU32 *
     videoIn->layer.var = 0;
     videoIn->layer.jtvar = 0;
     videoIn->layer.mcjtvar = 0;
-    for (mfxU16 i = 0; i < m_dataIn->layer[lyrIdx].Height_in_blocks; i++) {
-        mfxU16 prevFPos = i << 4;
-        for (mfxU16 j = 0; j < m_dataIn->layer[lyrIdx].Width_in_blocks; j++) {
-            mfxU16 fPos = prevFPos + j;
-            acc += ME_simple(m_support, fPos, m_dataIn->layer, &videoIn->layer, referenceImageIn, true, m_dataIn, ME_SAD_8x8_Block_Search);
-            valb += videoIn->layer.SAD[fPos];
-            *MVdiffVal += (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x) * (videoIn->layer.pInteger[fPos].x - videoRef->layer.pInteger[fPos].x);
-            *MVdiffVal += (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y) * (videoIn->layer.pInteger[fPos].y - videoRef->layer.pInteger[fPos].y);
-            *AbsMVHSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x);
-            *AbsMVVSize += (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
-            *AbsMVSize += (videoIn->layer.pInteger[fPos].x * videoIn->layer.pInteger[fPos].x) + (videoIn->layer.pInteger[fPos].y * videoIn->layer.pInteger[fPos].y);
 
-        }
+    // stripe s takes rows s, s + numStripes, ... and follows the row above it block by block
+    const mfxU32 numStripes = m_workers.GetNumStripes();
+    for (mfxU32 i = 0; i < m_dataIn->layer[lyrIdx].Height_in_blocks; i++)
+        m_rowProgress[i].store(0, std::memory_order_relaxed);
+
+    m_workers.Run(numStripes, [&](mfxU32 stripe) {
+        MotionAnalysisRows(videoIn, videoRef, referenceImageIn, stripe, numStripes, lyrIdx);
+    });
+
+    // rows are summed in order whatever number of stripes
+    for (mfxU32 i = 0; i < m_dataIn->layer[lyrIdx].Height_in_blocks; i++) {
+        const ASCMotionStats
+            &row = m_rowStats[i];
+        acc                    += row.acc;
+        valb                   += row.valb;
+        *MVdiffVal             += row.MVdiffVal;
+        *AbsMVHSize            += row.AbsMVHSize;
+        *AbsMVVSize            += row.AbsMVVSize;
+        *AbsMVSize             += row.AbsMVSize;
+        m_support->average     += row.average;
+        videoIn->layer.var     += row.var;
+        videoIn->layer.jtvar   += row.jtvar;
+        videoIn->layer.mcjtvar += row.mcjtvar;
     }
     videoIn->layer.var = videoIn->layer.var * 10 / 128 / 64;
     videoIn->layer.jtvar = videoIn->layer.jtvar * 10 / 128 / 64;
@@ -170,4 +170,63 @@ mfxI16 AvgLumaCalc_AVX2(pmfxU32 pAvgLineVal, int len) {
     avgVal = (mfxI16)_mm_extract_epi32(tmp, 0);
     return avgVal;
 }
+
+// Advances eight trees by one node. Nodes are read as two dwords: the threshold
+// and feature | flags << 8 | next << 16. Finished lanes keep their node.
+static inline void StepForest_AVX2(const int* nodes, const int* features, __m256i& idx, __m256i& live, __m256i& sum)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i idx2 = _mm256_slli_epi32(idx, 1);
+    const __m256i threshold = _mm256_i32gather_epi32(nodes, idx2, 4);
+    const __m256i packed = _mm256_i32gather_epi32(nodes + 1, idx2, 4);
+    const __m256i value = _mm256_i32gather_epi32(features, _mm256_and_si256(packed, _mm256_set1_epi32(0xff)), 4);
+
+    const __m256i left  = _mm256_cmpgt_epi32(threshold, value);
+    const __m256i flags = _mm256_and_si256(_mm256_srli_epi32(packed, 8), _mm256_set1_epi32(0xff));
+    const __m256i next  = _mm256_srli_epi32(packed, 16);
+
+    const __m256i leaf = _mm256_blendv_epi8(_mm256_and_si256(flags, _mm256_set1_epi32(TREE_RIGHT_LEAF)),
+                                            _mm256_and_si256(flags, _mm256_set1_epi32(TREE_LEFT_LEAF)), left);
+    const __m256i stop = _mm256_andnot_si256(_mm256_cmpeq_epi32(leaf, _mm256_setzero_si256()), live);
+    const __m256i decision = _mm256_blendv_epi8(next, _mm256_srli_epi32(flags, TREE_LEAF_SHIFT), left);
+
+    sum  = _mm256_add_epi32(sum, _mm256_and_si256(decision, stop));
+    live = _mm256_andnot_si256(stop, live);
+    idx  = _mm256_blendv_epi8(idx, _mm256_blendv_epi8(next, _mm256_add_epi32(idx, one), left), live);
+}
+
+// Sum of decisions, up to 24 trees are walked at a time in three vectors
+mfxU32 EvaluateForest_AVX2(const ASCTreeNode* nodes, const mfxU16* roots, mfxU32 numTrees, const mfxI32* features)
+{
+    const int* base = (const int*)nodes;
+    __m256i sum = _mm256_setzero_si256();
+
+    for (mfxU32 t = 0; t < numTrees; t += 24)
+    {
+        ASC_ALIGN_DECL(32) mfxI32 idx[24] = {}, live[24] = {};
+
+        for (mfxU32 i = 0; i < 24 && t + i < numTrees; i++)
+        {
+            idx[i]  = roots[t + i];
+            live[i] = -1;
+        }
+
+        __m256i idx0 = _mm256_load_si256((__m256i*)&idx[0]), live0 = _mm256_load_si256((__m256i*)&live[0]);
+        __m256i idx1 = _mm256_load_si256((__m256i*)&idx[8]), live1 = _mm256_load_si256((__m256i*)&live[8]);
+        __m256i idx2 = _mm256_load_si256((__m256i*)&idx[16]), live2 = _mm256_load_si256((__m256i*)&live[16]);
+
+        do
+        {
+            StepForest_AVX2(base, features, idx0, live0, sum);
+            StepForest_AVX2(base, features, idx1, live1, sum);
+            StepForest_AVX2(base, features, idx2, live2, sum);
+        } while (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(live0, live1), live2), _mm256_set1_epi32(-1)));
+    }
+
+    __m128i tmp = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    tmp = _mm_hadd_epi32(tmp, tmp);
+    tmp = _mm_hadd_epi32(tmp, tmp);
+
+    return mfxU32(_mm_cvtsi128_si32(tmp));
+}
 #endif //defined(__AVX2__)
@@ -207,6 +207,17 @@ void GainOffset_C(pmfxU8 *pSrc, pmfxU8 *pDst, mfxU16 width, mfxU16 height, mfxU1
     *pSrc = *pDst;
 }
 
+// kept out of the SIMD translation units so that every ISA rounds the same way
+mfxF64 Calc_RaCa_pic_norm(mfxI32 Rs, mfxI32 Cs, mfxI32 width, mfxI32 height) {
+    mfxI32 w4 = (width - 8) >> 2;
+    mfxI32 h4 = (height - 8) >> 2;
+    mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
+    mfxF64 drs = (mfxF64)Rs * d1;
+    mfxF64 dcs = (mfxF64)Cs * d1;
+
+    return sqrt(drs * drs + dcs * dcs);
+}
+
 mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs) {
     mfxI32 i, j;
     mfxI32 Rs, Cs;
@@ -218,13 +229,7 @@ mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitc
         }
     }
 
-    mfxI32 w4 = (width - 8) >> 2;
-    mfxI32 h4 = (height - 8) >> 2;
-    mfxF64 d1 = 1.0 / (mfxF64)(w4*h4);
-    mfxF64 drs = (mfxF64)Rs * d1;
-    mfxF64 dcs = (mfxF64)Cs * d1;
-
-    RsCs = sqrt(drs * drs + dcs * dcs);
+    RsCs = Calc_RaCa_pic_norm(Rs, Cs, width, height);
     return MFX_ERR_NONE;
 }
 
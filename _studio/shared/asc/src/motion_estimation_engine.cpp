@@ -219,7 +219,7 @@ void MVpropagationCheck(mfxI32 xLoc, mfxI32 yLoc, ASCImDetails dataIn, ASCMVecto
 
 #define SAD_SEARCH_VSTEP 2  // 1=FS 2=FHS
 
-mfxU16 ME_simple(ASCVidRead *videoIn, mfxI32 fPos, ASCImDetails *dataIn, ASCimageData *scale, ASCimageData *scaleRef, bool /*first*/, ASCVidData *limits, t_ME_SAD_8x8_Block_Search ME_SAD_8x8_Block_Search) {
+mfxU16 ME_simple(ASCMotionStats *stats, mfxI32 fPos, ASCImDetails *dataIn, ASCimageData *scale, ASCimageData *scaleRef, bool /*first*/, ASCVidData *limits, t_ME_SAD_8x8_Block_Search ME_SAD_8x8_Block_Search) {
     ASCMVector
         tMV,
         ttMV,
@@ -347,8 +347,8 @@ mfxU16 ME_simple(ASCVidRead *videoIn, mfxI32 fPos, ASCImDetails *dataIn, ASCimag
             }
         }
     }
-    videoIn->average += (current[fPos].x * current[fPos].x) + (current[fPos].y * current[fPos].y);
-    MVcalcVar8x8(current[fPos], objFrame, refFrame, scale->avgval, scaleRef->avgval, scale->var, scale->jtvar, scale->mcjtvar, dataIn);
+    stats->average += (current[fPos].x * current[fPos].x) + (current[fPos].y * current[fPos].y);
+    MVcalcVar8x8(current[fPos], objFrame, refFrame, scale->avgval, scaleRef->avgval, stats->var, stats->jtvar, stats->mcjtvar, dataIn);
     return(zeroSAD);
 }
 };
\ No newline at end of file
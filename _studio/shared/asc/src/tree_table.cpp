@@ -0,0 +1,6270 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generated by asc/tools/tree2table.py, do not edit.
+// Features: MVDiff, RsCsDiff, Rs, gchDC, CsDiff, diffTSC, refDCval, TSC, diffAFD, posBalance, Cs, TSCindex, Scindex, AFD, SC, RsDiff, diffRsCsdiff, negBalance, ssDCval, diffMVdiffVal
+
+#include "../include/tree.h"
+
+const ASCTreeNode SCDetectForest[6198] = {
+    // SCDetect1
+    {7, 5, 0, 124},
+    {93, 0, 0, 25},
+    {31, 19, 0, 16},
+    {9, 17, 0, 12},
+    {133, 3, 2, 1},
+    {1, 5, 0, 10},
+    {7, 1, 1, 7},
+    {1, 11, 2, 0},
+    {1376, 14, 2, 0},
+    {1, 17, 7, 0},
+    {21, 18, 2, 0},
+    {363, 10, 3, 1},
+    {111, 15, 0, 15},
+    {31, 3, 1, 14},
+    {213, 6, 3, 1},
+    {3109, 14, 3, 1},
+    {23, 4, 0, 22},
+    {35, 18, 2, 0},
+    {6, 15, 0, 21},
+    {45, 9, 1, 20},
+    {10, 13, 3, 1},
+    {18, 4, 7, 0},
+    {70, 9, 1, 23},
+    {23, 7, 2, 1},
+    {19, 13, 7, 0},
+    {8, 8, 0, 88},
+    {4, 5, 0, 75},
+    {34, 16, 0, 66},
+    {68, 2, 0, 50},
+    {66, 3, 0, 46},
+    {5, 1, 0, 39},
+    {2, 3, 1, 32},
+    {375, 0, 1, 33},
+    {58, 9, 0, 36},
+    {6, 11, 1, 35},
+    {227, 6, 3, 1},
+    {3, 3, 0, 38},
+    {7, 10, 3, 1},
+    {57, 17, 3, 1},
+    {30, 6, 0, 41},
+    {50, 10, 3, 1},
+    {-12, 16, 2, 0},
+    {4, 7, 5, 43},
+    {31, 13, 1, 44},
+    {14, 3, 1, 45},
+    {18, 10, 3, 1},
+    {26, 13, 2, 0},
+    {201, 6, 2, 0},
+    {1, 10, 5, 49},
+    {29, 2, 3, 1},
+    {6, 3, 1, 51},
+    {43, 1, 1, 52},
+    {62, 13, 0, 65},
+    {6, 15, 0, 60},
+    {7, 7, 0, 56},
+    {17, 13, 3, 1},
+    {449, 2, 2, 0},
+    {4, 16, 1, 58},
+    {80, 17, 2, 0},
+    {22, 13, 3, 1},
+    {716, 2, 2, 0},
+    {713, 2, 2, 1},
+    {40, 13, 1, 63},
+    {449, 14, 5, 64},
+    {161, 0, 7, 0},
+    {1425, 2, 3, 1},
+    {50, 6, 0, 71},
+    {31, 18, 5, 68},
+    {-5, 5, 0, 70},
+    {36, 18, 3, 1},
+    {282, 16, 3, 1},
+    {32, 3, 1, 72},
+    {72, 6, 0, 74},
+    {364, 2, 7, 0},
+    {901, 1, 3, 1},
+    {227, 0, 0, 78},
+    {8, 11, 2, 0},
+    {42, 6, 3, 1},
+    {31, 6, 0, 81},
+    {441, 14, 2, 1},
+    {1, 4, 7, 0},
+    {60, 13, 2, 1},
+    {10, 14, 0, 84},
+    {7, 13, 3, 1},
+    {58, 18, 2, 0},
+    {537, 10, 2, 1},
+    {6, 5, 1, 87},
+    {396, 2, 3, 1},
+    {50, 18, 0, 110},
+    {82, 10, 0, 99},
+    {129, 0, 0, 92},
+    {13, 13, 7, 0},
+    {23, 9, 0, 97},
+    {100, 17, 0, 95},
+    {13, 8, 3, 1},
+    {5, 15, 5, 96},
+    {344, 19, 3, 1},
+    {82, 2, 5, 98},
+    {142, 14, 3, 1},
+    {2, 16, 1, 100},
+    {20, 13, 0, 103},
+    {4, 5, 2, 1},
+    {729, 14, 3, 1},
+    {12, 3, 0, 107},
+    {593, 10, 2, 0},
+    {5, 4, 2, 1},
+    {34, 18, 7, 0},
+    {96, 17, 5, 108},
+    {43, 1, 1, 109},
+    {10, 8, 3, 1},
+    {40, 3, 0, 119},
+    {297, 14, 0, 114},
+    {2, 4, 1, 113},
+    {142, 19, 3, 1},
+    {621, 0, 0, 118},
+    {18, 8, 1, 116},
+    {484, 2, 2, 0},
+    {6, 15, 3, 1},
+    {28, 13, 7, 0},
+    {9, 11, 5, 120},
+    {16, 16, 1, 121},
+    {19, 7, 5, 122},
+    {277, 0, 1, 123},
+    {275, 1, 3, 1},
+    {2676, 10, 0, 286},
+    {71, 19, 0, 186},
+    {13, 5, 0, 157},
+    {56, 0, 0, 132},
+    {243, 14, 0, 130},
+    {79, 14, 3, 1},
+    {10, 5, 1, 131},
+    {26, 15, 3, 1},
+    {74, 1, 0, 140},
+    {-982, 19, 5, 134},
+    {6, 3, 0, 138},
+    {90, 18, 0, 137},
+    {37, 6, 3, 1},
+    {54, 13, 3, 1},
+    {55, 19, 1, 139},
+    {15, 16, 3, 1},
+    {76, 18, 0, 151},
+    {15, 8, 0, 146},
+    {2, 3, 5, 143},
+    {-25, 19, 0, 145},
+    {-46, 19, 3, 1},
+    {34, 6, 7, 0},
+    {35, 13, 2, 1},
+    {51, 19, 0, 149},
+    {161, 16, 3, 1},
+    {212, 1, 5, 150},
+    {1860, 14, 3, 1},
+    {12, 15, 1, 152},
+    {26, 8, 2, 1},
+    {22, 3, 2, 0},
+    {18, 3, 2, 1},
+    {134, 18, 1, 156},
+    {2103, 14, 7, 0},
+    {233, 16, 0, 176},
+    {57, 7, 2, 1},
+    {67, 16, 0, 167},
+    {31, 5, 0, 165},
+    {369, 10, 2, 0},
+    {24, 6, 5, 163},
+    {43, 13, 1, 164},
+    {44, 13, 7, 0},
+    {141, 0, 5, 166},
+    {162, 2, 7, 0},
+    {1173, 10, 2, 0},
+    {28, 19, 0, 175},
+    {2120, 2, 2, 0},
+    {151, 1, 2, 1},
+    {8, 15, 0, 174},
+    {20, 7, 5, 173},
+    {8, 4, 3, 1},
+    {29, 6, 7, 0},
+    {3549, 2, 3, 1},
+    {46, 3, 0, 183},
+    {21, 15, 2, 1},
+    {5, 12, 2, 0},
+    {89, 0, 2, 1},
+    {14, 7, 1, 181},
+    {64, 0, 5, 182},
+    {20, 15, 3, 1},
+    {54, 13, 0, 185},
+    {41, 0, 7, 0},
+    {178, 0, 7, 0},
+    {28, 17, 0, 227},
+    {157, 16, 0, 218},
+    {1437, 2, 2, 0},
+    {34, 8, 0, 216},
+    {32, 6, 0, 196},
+    {91, 19, 1, 192},
+    {196, 19, 2, 1},
+    {8, 5, 5, 194},
+    {140, 14, 1, 195},
+    {25, 13, 7, 0},
+    {22, 17, 0, 211},
+    {22, 7, 2, 0},
+    {783, 0, 2, 1},
+    {172, 14, 0, 204},
+    {53, 3, 0, 202},
+    {112, 9, 3, 1},
+    {1, 2, 2, 0},
+    {2, 4, 3, 1},
+    {11, 5, 1, 205},
+    {1184, 2, 2, 1},
+    {39, 3, 0, 210},
+    {403, 14, 5, 208},
+    {199, 10, 2, 0},
+    {439, 2, 7, 0},
+    {3, 15, 3, 1},
+    {23, 16, 0, 214},
+    {14, 16, 1, 213},
+    {343, 2, 7, 0},
+    {593, 2, 5, 215},
+    {17, 7, 3, 1},
+    {32, 7, 5, 217},
+    {114, 18, 3, 1},
+    {20, 7, 5, 219},
+    {2234, 2, 0, 225},
+    {125, 9, 0, 224},
+    {521, 0, 2, 0},
+    {12, 17, 2, 1},
+    {61, 3, 3, 1},
+    {121, 3, 3, 1},
+    {29, 15, 2, 1},
+    {107, 0, 7, 0},
+    {149, 18, 0, 280},
+    {12, 5, 0, 256},
+    {73, 18, 0, 243},
+    {8, 3, 0, 234},
+    {7, 4, 5, 232},
+    {74, 19, 2, 1},
+    {1269, 14, 3, 1},
+    {15, 8, 0, 237},
+    {41, 18, 5, 236},
+    {83, 9, 3, 1},
+    {-8, 16, 1, 238},
+    {78, 19, 1, 239},
+    {45, 18, 5, 240},
+    {2209, 2, 2, 0},
+    {41, 17, 2, 1},
+    {27, 8, 7, 0},
+    {15, 7, 0, 246},
+    {1, 4, 2, 1},
+    {249, 2, 7, 0},
+    {43, 16, 1, 247},
+    {4, 12, 0, 249},
+    {1129, 2, 7, 0},
+    {77, 9, 2, 0},
+    {3679, 14, 0, 255},
+    {267, 0, 5, 252},
+    {22, 4, 2, 1},
+    {484, 0, 1, 254},
+    {42, 9, 7, 0},
+    {243, 19, 3, 1},
+    {245, 1, 0, 275},
+    {20, 3, 0, 262},
+    {83, 13, 0, 261},
+    {81, 19, 2, 1},
+    {1253, 14, 7, 0},
+    {387, 2, 3, 1},
+    {81, 17, 0, 273},
+    {89, 9, 2, 1},
+    {103, 19, 1, 265},
+    {8, 15, 0, 271},
+    {68, 16, 2, 1},
+    {20, 5, 0, 270},
+    {417, 10, 2, 0},
+    {3, 4, 3, 1},
+    {526, 10, 7, 0},
+    {14, 15, 5, 272},
+    {679, 10, 7, 0},
+    {1062, 0, 5, 274},
+    {24, 7, 7, 0},
+    {16, 5, 2, 1},
+    {26, 8, 2, 1},
+    {86, 6, 5, 278},
+    {193, 0, 5, 279},
+    {37, 3, 3, 1},
+    {17, 16, 0, 282},
+    {177, 0, 7, 0},
+    {21, 8, 1, 283},
+    {23, 7, 2, 1},
+    {3, 3, 2, 1},
+    {7, 4, 7, 0},
+    {63, 19, 0, 292},
+    {13, 5, 1, 288},
+    {37, 3, 0, 291},
+    {133, 18, 1, 290},
+    {4855, 16, 7, 0},
+    {41, 15, 7, 0},
+    {20, 7, 0, 296},
+    {4782, 2, 2, 0},
+    {143, 0, 2, 1},
+    {4645, 10, 3, 1},
+    {75, 0, 0, 298},
+    {129, 6, 7, 0},
+    {29, 3, 5, 299},
+    {46, 4, 2, 1},
+    {31, 4, 5, 301},
+    {6212, 2, 1, 302},
+    {38, 3, 3, 1},
+    // SCDetect2
+    {67, 0, 0, 345},
+    {13, 5, 0, 334},
+    {7, 3, 0, 322},
+    {21, 6, 0, 314},
+    {77, 16, 0, 312},
+    {-1, 19, 1, 309},
+    {7, 1, 1, 310},
+    {18, 18, 2, 0},
+    {9, 0, 7, 0},
+    {11, 4, 2, 1},
+    {1352, 10, 7, 0},
+    {8, 5, 0, 317},
+    {260, 16, 1, 316},
+    {25, 6, 7, 0},
+    {59, 0, 0, 320},
+    {14, 19, 1, 319},
+    {43, 18, 7, 0},
+    {1683, 10, 2, 0},
+    {191, 1, 3, 1},
+    {1, 12, 0, 326},
+    {41, 3, 2, 1},
+    {175, 18, 1, 325},
+    {41, 0, 7, 0},
+    {-17, 8, 0, 328},
+    {1865, 10, 3, 1},
+    {5, 5, 1, 329},
+    {63, 0, 0, 332},
+    {79, 10, 5, 331},
+    {54, 19, 3, 1},
+    {393, 16, 2, 1},
+    {12, 4, 3, 1},
+    {3011, 10, 0, 344},
+    {2704, 14, 0, 339},
+    {29, 8, 2, 1},
+    {13, 15, 1, 338},
+    {29, 13, 7, 0},
+    {271, 16, 1, 340},
+    {1, 3, 1, 341},
+    {539, 1, 2, 1},
+    {61, 9, 5, 343},
+    {1801, 10, 7, 0},
+    {46, 0, 3, 1},
+    {13, 8, 0, 468},
+    {22, 3, 0, 430},
+    {9, 8, 0, 402},
+    {149, 0, 0, 352},
+    {3, 8, 1, 350},
+    {398, 16, 1, 351},
+    {5, 12, 7, 0},
+    {1, 5, 0, 378},
+    {56, 6, 0, 373},
+    {7282, 14, 0, 372},
+    {2, 15, 0, 360},
+    {24, 6, 2, 0},
+    {38, 9, 1, 358},
+    {-19, 8, 2, 0},
+    {26, 18, 7, 0},
+    {24, 18, 0, 363},
+    {4, 17, 5, 362},
+    {3, 7, 3, 1},
+    {19, 1, 1, 364},
+    {13, 7, 0, 371},
+    {855, 14, 2, 0},
+    {841, 14, 2, 1},
+    {31, 13, 0, 370},
+    {94, 2, 2, 0},
+    {42, 9, 3, 1},
+    {213, 2, 7, 0},
+    {945, 2, 7, 0},
+    {3078, 2, 7, 0},
+    {34, 13, 1, 374},
+    {1068, 14, 2, 0},
+    {10, 15, 0, 377},
+    {6, 4, 3, 1},
+    {865, 2, 3, 1},
+    {15, 13, 0, 392},
+    {30, 18, 0, 383},
+    {1, 4, 2, 1},
+    {4, 5, 1, 382},
+    {94, 2, 7, 0},
+    {12, 7, 0, 391},
+    {14, 13, 0, 388},
+    {7, 8, 1, 386},
+    {61, 17, 1, 387},
+    {1, 15, 7, 0},
+    {79, 10, 1, 389},
+    {11, 16, 1, 390},
+    {367, 10, 7, 0},
+    {336, 14, 3, 1},
+    {48, 6, 0, 400},
+    {48, 18, 2, 0},
+    {244, 16, 2, 1},
+    {84, 17, 2, 1},
+    {3, 12, 0, 398},
+    {197, 14, 3, 1},
+    {32, 6, 2, 0},
+    {11, 3, 7, 0},
+    {94, 16, 1, 401},
+    {1492, 14, 7, 0},
+    {210, 10, 0, 415},
+    {51, 6, 0, 411},
+    {3, 4, 2, 1},
+    {45, 18, 2, 0},
+    {148, 2, 0, 409},
+    {39, 6, 5, 408},
+    {18, 13, 7, 0},
+    {2, 15, 5, 410},
+    {25, 1, 3, 1},
+    {15, 3, 2, 0},
+    {94, 2, 2, 0},
+    {11, 1, 2, 1},
+    {47, 2, 3, 1},
+    {46, 18, 0, 423},
+    {92, 19, 0, 419},
+    {18, 13, 2, 0},
+    {783, 10, 3, 1},
+    {307, 2, 0, 422},
+    {393, 14, 5, 421},
+    {309, 10, 3, 1},
+    {364, 0, 7, 0},
+    {56, 16, 1, 424},
+    {916, 2, 0, 428},
+    {36, 17, 1, 426},
+    {265, 0, 2, 1},
+    {59, 18, 3, 1},
+    {1401, 1, 1, 429},
+    {26, 7, 3, 1},
+    {1, 14, 0, 434},
+    {6, 7, 5, 432},
+    {5, 15, 2, 1},
+    {89, 18, 7, 0},
+    {749, 1, 0, 460},
+    {2185, 14, 2, 0},
+    {2170, 14, 2, 1},
+    {91, 18, 0, 455},
+    {38, 16, 0, 449},
+    {59, 3, 0, 447},
+    {28, 9, 0, 443},
+    {9, 5, 1, 442},
+    {574, 2, 7, 0},
+    {5, 15, 2, 0},
+    {38, 6, 5, 445},
+    {90, 17, 1, 446},
+    {47, 18, 7, 0},
+    {2, 8, 1, 448},
+    {8, 16, 7, 0},
+    {302, 2, 0, 452},
+    {16, 4, 2, 0},
+    {31, 3, 3, 1},
+    {39, 6, 5, 453},
+    {85, 3, 1, 454},
+    {768, 10, 7, 0},
+    {25, 5, 0, 459},
+    {40, 13, 1, 457},
+    {78, 6, 2, 0},
+    {136, 10, 7, 0},
+    {508, 2, 3, 1},
+    {39, 13, 1, 461},
+    {-2, 8, 5, 462},
+    {59, 13, 0, 465},
+    {928, 16, 1, 464},
+    {573, 14, 3, 1},
+    {3, 5, 2, 1},
+    {45, 17, 5, 467},
+    {-13, 19, 7, 0},
+    {7, 4, 0, 535},
+    {22, 17, 0, 487},
+    {862, 0, 0, 486},
+    {788, 14, 0, 482},
+    {144, 19, 0, 476},
+    {128, 9, 2, 1},
+    {18, 16, 1, 475},
+    {98, 19, 3, 1},
+    {24, 13, 5, 477},
+    {29, 1, 0, 481},
+    {16, 5, 1, 479},
+    {2, 15, 1, 480},
+    {301, 2, 7, 0},
+    {96, 18, 3, 1},
+    {57, 16, 1, 483},
+    {29, 8, 1, 484},
+    {42, 13, 5, 485},
+    {1905, 2, 3, 1},
+    {79, 18, 3, 1},
+    {83, 19, 0, 506},
+    {56, 9, 0, 498},
+    {30, 3, 0, 495},
+    {10, 15, 2, 1},
+    {62, 17, 0, 494},
+    {247, 14, 2, 0},
+    {17, 10, 3, 1},
+    {7, 15, 7, 0},
+    {7, 5, 5, 496},
+    {570, 10, 1, 497},
+    {27, 7, 7, 0},
+    {22, 5, 0, 505},
+    {30, 13, 2, 0},
+    {1449, 14, 0, 503},
+    {60, 9, 2, 0},
+    {273, 10, 7, 0},
+    {109, 18, 2, 0},
+    {805, 10, 7, 0},
+    {1603, 14, 3, 1},
+    {417, 0, 0, 525},
+    {636, 10, 0, 522},
+    {105, 18, 0, 519},
+    {-1, 16, 0, 511},
+    {36, 13, 3, 1},
+    {130, 19, 0, 517},
+    {7, 3, 5, 513},
+    {9, 3, 0, 515},
+    {76, 9, 3, 1},
+    {84, 18, 5, 516},
+    {47, 1, 3, 1},
+    {2, 9, 2, 1},
+    {11, 10, 3, 1},
+    {107, 6, 5, 520},
+    {24, 8, 1, 521},
+    {135, 6, 3, 1},
+    {21, 8, 1, 523},
+    {25, 7, 5, 524},
+    {3466, 14, 3, 1},
+    {492, 10, 0, 534},
+    {18, 8, 0, 530},
+    {53, 6, 5, 528},
+    {3, 14, 5, 529},
+    {1381, 19, 3, 1},
+    {9, 16, 2, 1},
+    {19, 7, 5, 532},
+    {115, 10, 1, 533},
+    {216, 10, 7, 0},
+    {1057, 0, 3, 1},
+    {16, 3, 0, 563},
+    {22, 8, 0, 549},
+    {78, 18, 0, 545},
+    {6, 5, 0, 541},
+    {24, 13, 5, 540},
+    {512, 10, 7, 0},
+    {643, 2, 5, 542},
+    {10, 15, 0, 544},
+    {46, 18, 7, 0},
+    {82, 6, 7, 0},
+    {21, 7, 0, 547},
+    {106, 1, 7, 0},
+    {87, 6, 5, 548},
+    {11, 5, 3, 1},
+    {73, 19, 0, 558},
+    {131, 6, 0, 555},
+    {48, 15, 2, 0},
+    {8, 3, 2, 1},
+    {52, 18, 1, 554},
+    {9, 5, 3, 1},
+    {13, 5, 1, 556},
+    {7533, 2, 5, 557},
+    {7014, 10, 3, 1},
+    {3, 3, 2, 1},
+    {54, 13, 0, 562},
+    {16, 7, 2, 1},
+    {87, 18, 7, 0},
+    {1589, 2, 3, 1},
+    {65, 16, 0, 572},
+    {65, 7, 2, 1},
+    {10, 4, 2, 0},
+    {439, 10, 0, 570},
+    {202, 0, 2, 1},
+    {169, 0, 1, 569},
+    {371, 2, 7, 0},
+    {20, 5, 1, 571},
+    {34, 3, 7, 0},
+    {80, 19, 0, 581},
+    {633, 1, 0, 578},
+    {54, 13, 0, 577},
+    {87, 0, 2, 0},
+    {66, 19, 3, 1},
+    {269, 1, 3, 1},
+    {16, 5, 2, 1},
+    {44, 9, 2, 0},
+    {28, 4, 7, 0},
+    {3327, 14, 0, 594},
+    {229, 18, 2, 0},
+    {1033, 10, 0, 586},
+    {98, 19, 2, 1},
+    {26, 8, 3, 1},
+    {34, 8, 0, 590},
+    {30, 7, 0, 589},
+    {116, 0, 3, 1},
+    {42, 6, 7, 0},
+    {7, 15, 0, 592},
+    {1356, 10, 7, 0},
+    {46, 13, 2, 1},
+    {26, 5, 7, 0},
+    {18, 5, 0, 601},
+    {104, 9, 2, 0},
+    {439, 16, 1, 597},
+    {60, 9, 5, 598},
+    {44, 3, 2, 1},
+    {156, 0, 5, 600},
+    {7554, 14, 3, 1},
+    {12, 15, 1, 602},
+    {125, 9, 2, 0},
+    {4217, 14, 2, 1},
+    {460, 16, 2, 1},
+    {455, 1, 2, 0},
+    {288, 0, 7, 0},
+    // SCDetect3
+    {29, 13, 0, 732},
+    {66, 19, 0, 653},
+    {9, 8, 0, 629},
+    {24, 6, 0, 618},
+    {231, 1, 2, 1},
+    {4, 16, 0, 615},
+    {1, 2, 2, 0},
+    {130, 18, 3, 1},
+    {4, 17, 2, 0},
+    {4, 4, 2, 1},
+    {17, 6, 7, 0},
+    {22, 13, 0, 624},
+    {173, 6, 1, 620},
+    {36, 15, 0, 623},
+    {30, 3, 1, 622},
+    {1, 15, 7, 0},
+    {40, 15, 7, 0},
+    {48, 6, 2, 0},
+    {5, 15, 2, 0},
+    {31, 16, 2, 1},
+    {5, 5, 2, 1},
+    {1063, 14, 3, 1},
+    {13, 5, 0, 644},
+    {57, 6, 0, 642},
+    {101, 14, 0, 634},
+    {41, 18, 2, 0},
+    {73, 0, 3, 1},
+    {51, 19, 0, 639},
+    {5133, 2, 2, 1},
+    {-105, 19, 2, 0},
+    {60, 10, 5, 638},
+    {54, 17, 3, 1},
+    {9, 4, 2, 1},
+    {13, 3, 2, 0},
+    {233, 0, 3, 1},
+    {2, 4, 2, 0},
+    {2455, 2, 3, 1},
+    {230, 1, 0, 649},
+    {25, 6, 0, 647},
+    {361, 0, 7, 0},
+    {19, 13, 2, 0},
+    {2080, 14, 3, 1},
+    {6, 3, 0, 651},
+    {12, 4, 7, 0},
+    {25, 13, 5, 652},
+    {24, 7, 3, 1},
+    {6, 5, 0, 692},
+    {68, 6, 0, 680},
+    {8, 8, 0, 668},
+    {22, 4, 2, 1},
+    {-1, 5, 1, 658},
+    {38, 18, 0, 666},
+    {15, 13, 0, 665},
+    {3, 5, 0, 663},
+    {430, 2, 1, 662},
+    {483, 2, 7, 0},
+    {31, 10, 1, 664},
+    {163, 0, 3, 1},
+    {3, 4, 3, 1},
+    {35, 6, 2, 0},
+    {123, 9, 3, 1},
+    {383, 14, 0, 675},
+    {31, 18, 5, 670},
+    {125, 19, 0, 672},
+    {10, 4, 3, 1},
+    {43, 10, 2, 1},
+    {22, 10, 5, 674},
+    {11, 8, 3, 1},
+    {40, 18, 0, 678},
+    {170, 0, 5, 677},
+    {22, 13, 3, 1},
+    {5, 5, 1, 679},
+    {9, 7, 7, 0},
+    {667, 19, 0, 688},
+    {128, 9, 2, 1},
+    {100, 19, 1, 683},
+    {100, 3, 0, 687},
+    {9, 7, 1, 685},
+    {159, 0, 2, 0},
+    {535, 10, 7, 0},
+    {13, 14, 7, 0},
+    {13, 7, 2, 1},
+    {34, 18, 0, 691},
+    {25, 13, 7, 0},
+    {315, 1, 3, 1},
+    {86, 9, 0, 717},
+    {12, 8, 0, 700},
+    {10, 3, 2, 0},
+    {499, 14, 0, 697},
+    {71, 14, 3, 1},
+    {158, 19, 2, 0},
+    {801, 2, 5, 699},
+    {4114, 14, 3, 1},
+    {3578, 14, 0, 714},
+    {34, 17, 0, 704},
+    {8, 4, 2, 1},
+    {171, 10, 7, 0},
+    {524, 14, 5, 705},
+    {8, 15, 2, 1},
+    {12, 3, 0, 709},
+    {9, 7, 2, 1},
+    {59, 1, 7, 0},
+    {34, 3, 2, 1},
+    {17, 3, 0, 713},
+    {53, 6, 5, 712},
+    {99, 1, 3, 1},
+    {5, 15, 7, 0},
+    {4691, 2, 2, 1},
+    {172, 6, 1, 716},
+    {24, 13, 3, 1},
+    {25, 17, 2, 1},
+    {3, 12, 0, 726},
+    {19, 1, 2, 1},
+    {9, 10, 1, 721},
+    {12, 7, 0, 724},
+    {258, 14, 2, 0},
+    {1, 16, 3, 1},
+    {314, 14, 1, 725},
+    {19, 7, 7, 0},
+    {1323, 2, 0, 730},
+    {657, 19, 2, 1},
+    {11, 7, 2, 0},
+    {16, 13, 3, 1},
+    {1459, 2, 5, 731},
+    {23, 15, 3, 1},
+    {23, 8, 0, 807},
+    {16, 7, 0, 749},
+    {125, 0, 1, 735},
+    {61, 18, 0, 748},
+    {-2, 5, 0, 740},
+    {3, 4, 2, 0},
+    {2, 4, 1, 739},
+    {-5, 5, 3, 1},
+    {4, 1, 5, 741},
+    {6, 4, 0, 745},
+    {13, 7, 2, 0},
+    {6, 16, 1, 744},
+    {33, 1, 7, 0},
+    {435, 10, 5, 746},
+    {278, 0, 1, 747},
+    {-27, 16, 3, 1},
+    {119, 3, 3, 1},
+    {92, 19, 0, 784},
+    {26, 6, 0, 752},
+    {298, 10, 3, 1},
+    {46, 0, 1, 753},
+    {58, 13, 0, 779},
+    {19, 8, 0, 772},
+    {96, 16, 0, 765},
+    {20, 7, 1, 757},
+    {1, 12, 0, 759},
+    {21, 2, 7, 0},
+    {-38, 19, 0, 763},
+    {-40, 19, 2, 1},
+    {59, 18, 2, 0},
+    {45, 13, 3, 1},
+    {1738, 2, 1, 764},
+    {1777, 2, 7, 0},
+    {13, 15, 0, 769},
+    {9, 5, 0, 768},
+    {278, 10, 7, 0},
+    {15, 5, 7, 0},
+    {79, 6, 2, 0},
+    {9, 3, 2, 0},
+    {148, 0, 7, 0},
+    {61, 6, 1, 773},
+    {56, 19, 2, 1},
+    {622, 2, 0, 776},
+    {193, 2, 3, 1},
+    {16225, 1, 2, 1},
+    {-57, 19, 2, 0},
+    {43, 13, 7, 0},
+    {4, 12, 1, 780},
+    {24, 15, 2, 0},
+    {-5, 19, 5, 782},
+    {1466, 10, 1, 783},
+    {3716, 14, 7, 0},
+    {1, 5, 0, 787},
+    {39, 18, 2, 0},
+    {302, 10, 3, 1},
+    {85, 16, 0, 797},
+    {127, 6, 0, 796},
+    {90, 18, 0, 793},
+    {70, 17, 2, 1},
+    {20, 7, 2, 0},
+    {36, 16, 3, 1},
+    {450, 10, 2, 0},
+    {108, 18, 1, 795},
+    {48, 13, 7, 0},
+    {53, 10, 7, 0},
+    {1456, 2, 0, 803},
+    {31, 3, 2, 1},
+    {89, 9, 2, 0},
+    {7, 5, 2, 1},
+    {1287, 1, 2, 1},
+    {3, 3, 7, 0},
+    {21, 3, 2, 0},
+    {9, 5, 1, 805},
+    {19, 3, 5, 806},
+    {42, 13, 7, 0},
+    {81, 9, 0, 859},
+    {1, 16, 0, 811},
+    {204, 10, 5, 810},
+    {40, 13, 7, 0},
+    {82, 18, 0, 828},
+    {14, 7, 0, 816},
+    {132, 19, 2, 1},
+    {30, 13, 2, 0},
+    {64, 18, 7, 0},
+    {23, 7, 0, 820},
+    {77, 19, 2, 1},
+    {291, 1, 2, 1},
+    {40, 13, 7, 0},
+    {39, 17, 0, 823},
+    {244, 0, 2, 0},
+    {33, 8, 3, 1},
+    {68, 17, 2, 1},
+    {55, 18, 0, 826},
+    {670, 1, 3, 1},
+    {64, 13, 5, 827},
+    {1449, 2, 7, 0},
+    {18, 7, 0, 834},
+    {101, 16, 5, 830},
+    {8, 3, 0, 833},
+    {16, 7, 1, 832},
+    {40, 17, 3, 1},
+    {13, 7, 3, 1},
+    {29, 8, 0, 844},
+    {32, 13, 5, 836},
+    {186, 16, 0, 842},
+    {51, 7, 2, 1},
+    {737, 10, 2, 0},
+    {262, 0, 2, 0},
+    {553, 10, 2, 1},
+    {136, 2, 7, 0},
+    {6949, 14, 5, 843},
+    {27, 7, 3, 1},
+    {6, 15, 0, 847},
+    {67, 6, 1, 846},
+    {46, 7, 7, 0},
+    {45, 13, 0, 854},
+    {7, 12, 0, 852},
+    {2767, 14, 2, 1},
+    {36, 9, 2, 1},
+    {33, 9, 7, 0},
+    {33, 4, 1, 853},
+    {22, 7, 3, 1},
+    {6, 3, 2, 1},
+    {54, 17, 2, 1},
+    {1516, 16, 2, 1},
+    {16, 4, 2, 0},
+    {1792, 14, 3, 1},
+    {16, 4, 0, 887},
+    {106, 19, 0, 867},
+    {831, 1, 2, 1},
+    {40, 0, 5, 863},
+    {645, 0, 2, 1},
+    {30, 8, 1, 865},
+    {44, 13, 2, 0},
+    {90, 19, 3, 1},
+    {51, 13, 0, 880},
+    {32, 8, 0, 876},
+    {6, 17, 1, 870},
+    {88, 16, 0, 874},
+    {797, 14, 5, 872},
+    {10, 17, 5, 873},
+    {19, 7, 7, 0},
+    {2087, 2, 5, 875},
+    {652, 10, 3, 1},
+    {8, 17, 0, 878},
+    {11, 15, 3, 1},
+    {5, 15, 2, 1},
+    {600, 10, 7, 0},
+    {7, 15, 0, 884},
+    {262, 0, 2, 0},
+    {38, 10, 1, 883},
+    {54, 3, 3, 1},
+    {121, 3, 2, 0},
+    {1599, 2, 5, 886},
+    {89, 6, 7, 0},
+    {6, 17, 0, 889},
+    {123, 18, 7, 0},
+    {15, 5, 2, 1},
+    {14, 5, 5, 891},
+    {30, 17, 3, 1},
+    // SCDetect4
+    {16, 7, 0, 1035},
+    {569, 2, 0, 991},
+    {9, 8, 0, 938},
+    {127, 0, 0, 906},
+    {510, 1, 0, 905},
+    {2, 9, 0, 903},
+    {566, 2, 2, 1},
+    {76, 14, 2, 0},
+    {73, 14, 2, 1},
+    {106, 17, 1, 902},
+    {211, 6, 3, 1},
+    {8, 8, 1, 904},
+    {85, 19, 3, 1},
+    {1568, 1, 7, 0},
+    {66, 17, 0, 921},
+    {3, 4, 0, 915},
+    {224, 19, 0, 911},
+    {1768, 0, 1, 910},
+    {101, 3, 3, 1},
+    {393, 0, 2, 0},
+    {69, 2, 2, 0},
+    {7, 13, 1, 914},
+    {9, 13, 7, 0},
+    {1, 2, 5, 916},
+    {28, 6, 0, 918},
+    {8, 7, 7, 0},
+    {539, 14, 2, 0},
+    {8, 16, 1, 920},
+    {243, 10, 3, 1},
+    {25, 18, 0, 925},
+    {27, 6, 2, 1},
+    {71, 17, 1, 924},
+    {2641, 0, 7, 0},
+    {42, 9, 0, 933},
+    {36, 16, 0, 932},
+    {227, 6, 0, 930},
+    {-241, 16, 2, 0},
+    {-282, 16, 3, 1},
+    {226, 18, 2, 0},
+    {7, 7, 7, 0},
+    {296, 2, 7, 0},
+    {51, 6, 0, 936},
+    {2, 8, 1, 935},
+    {2, 3, 3, 1},
+    {59, 9, 1, 937},
+    {14, 7, 7, 0},
+    {64, 19, 0, 951},
+    {65, 6, 0, 949},
+    {99, 2, 0, 945},
+    {43, 17, 0, 943},
+    {13, 15, 3, 1},
+    {2, 15, 5, 944},
+    {86, 2, 3, 1},
+    {13, 4, 2, 1},
+    {54, 17, 1, 947},
+    {11, 8, 1, 948},
+    {1066, 14, 7, 0},
+    {7, 9, 2, 0},
+    {6, 9, 3, 1},
+    {6, 5, 0, 970},
+    {53, 16, 0, 968},
+    {302, 14, 0, 965},
+    {78, 6, 2, 0},
+    {234, 19, 0, 963},
+    {14, 16, 2, 1},
+    {9, 3, 0, 960},
+    {58, 14, 2, 1},
+    {6, 7, 7, 0},
+    {20, 3, 2, 1},
+    {4, 5, 1, 962},
+    {125, 14, 3, 1},
+    {5, 3, 2, 1},
+    {16, 2, 3, 1},
+    {45, 6, 2, 0},
+    {10, 8, 5, 967},
+    {3, 15, 7, 0},
+    {1, 5, 2, 1},
+    {149, 2, 7, 0},
+    {127, 18, 0, 986},
+    {13, 8, 0, 978},
+    {274, 14, 0, 975},
+    {8, 5, 5, 974},
+    {87, 10, 7, 0},
+    {47, 18, 0, 977},
+    {11, 13, 3, 1},
+    {31, 16, 3, 1},
+    {31, 13, 0, 981},
+    {1, 4, 2, 1},
+    {185, 14, 7, 0},
+    {46, 1, 2, 1},
+    {278, 2, 0, 985},
+    {55, 10, 2, 1},
+    {33, 2, 7, 0},
+    {61, 18, 3, 1},
+    {43, 1, 0, 989},
+    {4, 4, 1, 988},
+    {12, 7, 7, 0},
+    {32, 8, 2, 0},
+    {5, 4, 3, 1},
+    {11, 8, 0, 1004},
+    {21, 6, 0, 998},
+    {2, 8, 2, 1},
+    {-1, 19, 1, 995},
+    {6, 0, 2, 0},
+    {1, 13, 2, 1},
+    {4, 1, 3, 1},
+    {3, 3, 1, 999},
+    {43, 18, 2, 0},
+    {410, 1, 0, 1003},
+    {4, 5, 1, 1002},
+    {92, 19, 3, 1},
+    {12, 19, 3, 1},
+    {56, 0, 0, 1013},
+    {340, 10, 0, 1008},
+    {1979, 2, 1, 1007},
+    {13, 13, 3, 1},
+    {17, 8, 1, 1009},
+    {3770, 14, 2, 0},
+    {3706, 14, 2, 1},
+    {68, 6, 2, 0},
+    {2270, 14, 3, 1},
+    {54, 19, 0, 1018},
+    {41, 18, 0, 1016},
+    {27, 13, 7, 0},
+    {22, 15, 1, 1017},
+    {1833, 2, 7, 0},
+    {75, 18, 0, 1029},
+    {17, 8, 0, 1023},
+    {84, 16, 1, 1021},
+    {2030, 2, 5, 1022},
+    {18, 13, 7, 0},
+    {321, 16, 2, 1},
+    {2062, 2, 2, 0},
+    {178, 0, 2, 1},
+    {16, 3, 2, 0},
+    {9, 5, 2, 1},
+    {12, 15, 3, 1},
+    {21, 8, 0, 1033},
+    {1277, 2, 2, 0},
+    {84, 16, 1, 1032},
+    {10, 4, 7, 0},
+    {3, 3, 1, 1034},
+    {1995, 10, 7, 0},
+    {10, 5, 0, 1080},
+    {5, 12, 0, 1074},
+    {13, 8, 0, 1059},
+    {20, 4, 0, 1056},
+    {4, 4, 1, 1040},
+    {47, 13, 0, 1052},
+    {10, 4, 0, 1045},
+    {449, 2, 2, 0},
+    {968, 14, 1, 1044},
+    {444, 2, 3, 1},
+    {13, 3, 0, 1051},
+    {122, 0, 0, 1048},
+    {81, 15, 3, 1},
+    {140, 0, 5, 1049},
+    {54, 17, 1, 1050},
+    {547, 1, 7, 0},
+    {47, 6, 7, 0},
+    {51, 9, 0, 1055},
+    {40, 16, 2, 1},
+    {349, 10, 7, 0},
+    {200, 1, 3, 1},
+    {3703, 14, 2, 0},
+    {5, 19, 5, 1058},
+    {98, 19, 3, 1},
+    {147, 1, 0, 1065},
+    {89, 17, 0, 1063},
+    {82, 16, 1, 1062},
+    {1455, 0, 3, 1},
+    {29, 9, 2, 1},
+    {53, 10, 7, 0},
+    {526, 0, 0, 1073},
+    {193, 19, 0, 1072},
+    {76, 9, 2, 0},
+    {116, 0, 5, 1069},
+    {20, 7, 0, 1071},
+    {969, 10, 7, 0},
+    {1425, 10, 3, 1},
+    {277, 19, 7, 0},
+    {1749, 2, 7, 0},
+    {36, 19, 1, 1075},
+    {23, 4, 1, 1076},
+    {2238, 10, 5, 1077},
+    {160, 6, 2, 1},
+    {205, 19, 1, 1079},
+    {4026, 10, 7, 0},
+    {25, 17, 0, 1121},
+    {13, 4, 0, 1111},
+    {111, 19, 0, 1093},
+    {127, 3, 2, 1},
+    {113, 14, 5, 1085},
+    {127, 1, 0, 1088},
+    {533, 0, 1, 1087},
+    {3, 15, 7, 0},
+    {683, 10, 5, 1089},
+    {26, 6, 0, 1091},
+    {33, 13, 7, 0},
+    {1155, 2, 2, 0},
+    {995, 10, 7, 0},
+    {10, 17, 0, 1100},
+    {56, 8, 2, 1},
+    {127, 18, 0, 1099},
+    {122, 14, 5, 1097},
+    {17, 8, 2, 0},
+    {22, 13, 7, 0},
+    {1006, 10, 7, 0},
+    {58, 6, 0, 1109},
+    {84, 9, 5, 1102},
+    {290, 14, 1, 1103},
+    {187, 16, 2, 1},
+    {904, 2, 2, 0},
+    {576, 10, 2, 1},
+    {68, 18, 1, 1107},
+    {22, 5, 5, 1108},
+    {272, 10, 3, 1},
+    {1354, 2, 5, 1110},
+    {1131, 10, 7, 0},
+    {44, 13, 0, 1116},
+    {27, 6, 5, 1113},
+    {1316, 10, 5, 1114},
+    {14, 17, 1, 1115},
+    {18, 5, 3, 1},
+    {359, 0, 0, 1119},
+    {4852, 14, 5, 1118},
+    {5815, 10, 3, 1},
+    {18, 4, 2, 1},
+    {63, 13, 3, 1},
+    {12, 16, 0, 1132},
+    {96, 19, 1, 1123},
+    {11, 8, 0, 1125},
+    {1095, 0, 3, 1},
+    {48, 13, 0, 1129},
+    {345, 10, 2, 0},
+    {39, 6, 1, 1128},
+    {22, 2, 3, 1},
+    {5, 15, 1, 1130},
+    {33, 7, 2, 1},
+    {53, 13, 3, 1},
+    {62, 19, 0, 1148},
+    {448, 10, 5, 1134},
+    {23, 8, 0, 1137},
+    {59, 6, 2, 0},
+    {5774, 2, 3, 1},
+    {24, 7, 0, 1142},
+    {63, 17, 2, 0},
+    {50, 19, 2, 1},
+    {35, 8, 2, 0},
+    {5, 3, 3, 1},
+    {2677, 10, 0, 1145},
+    {2388, 14, 2, 1},
+    {1637, 14, 7, 0},
+    {50, 9, 1, 1146},
+    {9944, 2, 5, 1147},
+    {11454, 2, 3, 1},
+    {238, 16, 0, 1175},
+    {3032, 14, 2, 0},
+    {82, 19, 0, 1157},
+    {76, 19, 0, 1155},
+    {35, 8, 2, 0},
+    {624, 10, 5, 1154},
+    {55, 13, 7, 0},
+    {93, 0, 2, 0},
+    {1285, 2, 7, 0},
+    {92, 18, 0, 1167},
+    {74, 17, 2, 1},
+    {634, 0, 0, 1164},
+    {14, 15, 0, 1163},
+    {324, 14, 2, 1},
+    {5, 4, 3, 1},
+    {679, 10, 7, 0},
+    {762, 2, 2, 1},
+    {62, 6, 2, 0},
+    {689, 2, 7, 0},
+    {83, 6, 0, 1171},
+    {20, 7, 1, 1169},
+    {32, 8, 2, 1},
+    {380, 2, 7, 0},
+    {98, 1, 5, 1172},
+    {151, 6, 5, 1173},
+    {6, 4, 5, 1174},
+    {437, 14, 7, 0},
+    {2300, 2, 0, 1179},
+    {358, 0, 5, 1177},
+    {28, 17, 2, 1},
+    {50, 13, 3, 1},
+    {833, 16, 0, 1183},
+    {33, 8, 2, 1},
+    {97, 19, 5, 1182},
+    {17, 3, 7, 0},
+    {121, 17, 2, 0},
+    {15, 8, 1, 1185},
+    {22, 15, 2, 1},
+    {66, 13, 7, 0},
+    // SCDetect5
+    {12, 8, 0, 1307},
+    {4, 5, 0, 1266},
+    {53, 19, 0, 1225},
+    {9, 9, 0, 1206},
+    {11, 15, 0, 1202},
+    {2, 4, 0, 1198},
+    {123, 17, 1, 1194},
+    {1, 13, 0, 1196},
+    {17, 2, 3, 1},
+    {-2, 5, 2, 0},
+    {570, 0, 3, 1},
+    {18, 18, 2, 0},
+    {6, 0, 5, 1200},
+    {1, 11, 2, 1},
+    {588, 10, 7, 0},
+    {85, 6, 2, 0},
+    {12, 4, 1, 1204},
+    {234, 2, 2, 1},
+    {1, 7, 3, 1},
+    {43, 13, 0, 1220},
+    {2455, 1, 0, 1218},
+    {-7, 8, 0, 1215},
+    {27, 10, 0, 1212},
+    {4, 15, 1, 1211},
+    {74, 2, 7, 0},
+    {46, 17, 1, 1213},
+    {15, 3, 1, 1214},
+    {62, 9, 3, 1},
+    {-4, 5, 2, 0},
+    {307, 14, 2, 0},
+    {11, 16, 3, 1},
+    {5, 12, 2, 0},
+    {1541, 2, 3, 1},
+    {117, 6, 2, 0},
+    {116, 6, 2, 1},
+    {19, 4, 1, 1223},
+    {5, 12, 2, 0},
+    {1905, 10, 7, 0},
+    {124, 3, 0, 1263},
+    {7, 8, 0, 1249},
+    {12, 16, 0, 1239},
+    {6, 4, 0, 1236},
+    {74, 6, 2, 0},
+    {76, 18, 0, 1234},
+    {80, 9, 1, 1232},
+    {3, 3, 2, 0},
+    {275, 19, 3, 1},
+    {901, 2, 1, 1235},
+    {31, 13, 3, 1},
+    {33, 18, 5, 1237},
+    {3, 12, 2, 0},
+    {18, 7, 3, 1},
+    {980, 14, 0, 1247},
+    {34, 6, 5, 1241},
+    {280, 10, 1, 1242},
+    {290, 10, 5, 1243},
+    {733, 0, 0, 1246},
+    {38, 13, 1, 1245},
+    {5, 15, 7, 0},
+    {25, 13, 7, 0},
+    {26, 4, 1, 1248},
+    {23, 15, 7, 0},
+    {50, 9, 0, 1260},
+    {16, 13, 0, 1255},
+    {7, 11, 0, 1254},
+    {9, 13, 2, 1},
+    {201, 0, 3, 1},
+    {70, 17, 7, 0},
+    {6, 15, 1, 1256},
+    {460, 10, 5, 1257},
+    {41, 13, 2, 1},
+    {11, 8, 1, 1259},
+    {10, 7, 3, 1},
+    {1085, 10, 1, 1261},
+    {1120, 10, 5, 1262},
+    {6, 7, 7, 0},
+    {27, 13, 2, 0},
+    {7, 2, 5, 1265},
+    {17, 13, 7, 0},
+    {66, 19, 0, 1283},
+    {34, 6, 0, 1273},
+    {9, 4, 2, 1},
+    {-15, 16, 0, 1272},
+    {385, 10, 2, 0},
+    {1, 4, 3, 1},
+    {5136, 14, 3, 1},
+    {63, 0, 1, 1274},
+    {17, 7, 0, 1278},
+    {11, 8, 1, 1276},
+    {46, 6, 2, 0},
+    {41, 6, 3, 1},
+    {87, 18, 2, 0},
+    {72, 6, 0, 1282},
+    {218, 0, 1, 1281},
+    {11, 15, 7, 0},
+    {1397, 14, 3, 1},
+    {50, 18, 0, 1294},
+    {25, 17, 0, 1286},
+    {2673, 14, 3, 1},
+    {135, 0, 5, 1287},
+    {2, 15, 0, 1289},
+    {103, 17, 7, 0},
+    {588, 10, 2, 1},
+    {142, 0, 1, 1291},
+    {52, 6, 2, 0},
+    {75, 2, 1, 1293},
+    {944, 14, 7, 0},
+    {2, 14, 0, 1297},
+    {31, 1, 2, 1},
+    {15, 13, 7, 0},
+    {8, 8, 0, 1299},
+    {775, 1, 3, 1},
+    {7, 15, 0, 1302},
+    {115, 9, 1, 1301},
+    {861, 14, 7, 0},
+    {383, 10, 5, 1303},
+    {255, 16, 2, 0},
+    {229, 0, 2, 0},
+    {88, 19, 1, 1306},
+    {90, 1, 3, 1},
+    {65, 19, 0, 1359},
+    {45, 0, 0, 1314},
+    {32, 6, 5, 1310},
+    {68, 15, 0, 1313},
+    {542, 10, 2, 0},
+    {13, 5, 3, 1},
+    {22, 7, 3, 1},
+    {23, 8, 0, 1344},
+    {5087, 16, 2, 1},
+    {13, 8, 1, 1317},
+    {706, 0, 2, 1},
+    {33, 18, 0, 1320},
+    {54, 14, 3, 1},
+    {-71, 19, 0, 1330},
+    {78, 17, 0, 1328},
+    {100, 18, 2, 0},
+    {1466, 2, 2, 1},
+    {8, 3, 2, 0},
+    {74, 18, 2, 1},
+    {308, 0, 1, 1327},
+    {204, 2, 3, 1},
+    {1390, 2, 2, 0},
+    {20, 1, 3, 1},
+    {7, 5, 1, 1331},
+    {19, 7, 0, 1342},
+    {22, 6, 5, 1333},
+    {14, 8, 1, 1334},
+    {33, 13, 0, 1339},
+    {18, 17, 1, 1336},
+    {36, 19, 1, 1337},
+    {137, 1, 2, 1},
+    {222, 10, 7, 0},
+    {777, 10, 2, 1},
+    {124, 1, 2, 0},
+    {17, 7, 3, 1},
+    {7129, 2, 1, 1343},
+    {8092, 2, 7, 0},
+    {313, 1, 0, 1348},
+    {20, 3, 2, 0},
+    {64, 6, 1, 1347},
+    {12, 7, 3, 1},
+    {31, 17, 0, 1351},
+    {29, 7, 1, 1350},
+    {110, 9, 7, 0},
+    {6, 12, 0, 1356},
+    {12, 7, 1, 1353},
+    {45, 13, 2, 1},
+    {76, 0, 5, 1355},
+    {30, 13, 7, 0},
+    {56, 17, 2, 0},
+    {8691, 2, 2, 1},
+    {7680, 14, 7, 0},
+    {23, 8, 0, 1418},
+    {34, 17, 0, 1383},
+    {33, 6, 0, 1365},
+    {13, 7, 5, 1363},
+    {103, 1, 2, 1},
+    {385, 19, 3, 1},
+    {20, 13, 0, 1370},
+    {128, 10, 5, 1367},
+    {12, 7, 2, 0},
+    {3, 4, 1, 1369},
+    {18, 13, 3, 1},
+    {295, 16, 0, 1380},
+    {25, 16, 0, 1374},
+    {22, 13, 2, 0},
+    {60, 10, 7, 0},
+    {437, 14, 5, 1375},
+    {810, 10, 2, 0},
+    {81, 1, 2, 0},
+    {532, 10, 2, 1},
+    {22, 13, 2, 0},
+    {69, 6, 3, 1},
+    {19, 15, 5, 1381},
+    {7507, 14, 2, 1},
+    {785, 0, 3, 1},
+    {635, 2, 0, 1405},
+    {-2, 5, 1, 1385},
+    {119, 0, 5, 1386},
+    {124, 0, 1, 1387},
+    {141, 2, 0, 1395},
+    {59, 6, 5, 1389},
+    {6, 4, 2, 1},
+    {119, 19, 1, 1391},
+    {5, 4, 2, 0},
+    {32, 13, 5, 1393},
+    {31, 18, 5, 1394},
+    {9, 5, 3, 1},
+    {45, 13, 0, 1402},
+    {3, 4, 0, 1399},
+    {19, 13, 5, 1398},
+    {48, 18, 7, 0},
+    {12, 3, 5, 1400},
+    {14, 8, 2, 1},
+    {26, 3, 3, 1},
+    {727, 10, 2, 1},
+    {62, 18, 2, 0},
+    {19, 7, 3, 1},
+    {6, 5, 0, 1407},
+    {1256, 0, 3, 1},
+    {80, 16, 0, 1411},
+    {80, 1, 2, 0},
+    {1448, 14, 1, 1410},
+    {116, 6, 3, 1},
+    {1860, 2, 0, 1414},
+    {126, 16, 2, 1},
+    {45, 17, 7, 0},
+    {135, 6, 2, 0},
+    {10, 5, 2, 1},
+    {17, 8, 1, 1417},
+    {515, 1, 3, 1},
+    {27, 17, 0, 1450},
+    {1, 4, 1, 1420},
+    {54, 6, 0, 1439},
+    {23, 7, 0, 1426},
+    {20, 5, 0, 1425},
+    {14, 5, 2, 1},
+    {13, 7, 7, 0},
+    {694, 0, 7, 0},
+    {4, 15, 1, 1427},
+    {154, 19, 0, 1433},
+    {86, 9, 5, 1429},
+    {49, 13, 0, 1432},
+    {29, 13, 2, 0},
+    {1742, 10, 3, 1},
+    {61, 13, 7, 0},
+    {76, 3, 0, 1438},
+    {12, 17, 1, 1435},
+    {116, 18, 2, 0},
+    {42, 3, 2, 1},
+    {1077, 2, 7, 0},
+    {3011, 2, 7, 0},
+    {132, 19, 0, 1444},
+    {103, 0, 5, 1441},
+    {10, 15, 1, 1442},
+    {4408, 14, 5, 1443},
+    {989, 1, 3, 1},
+    {3, 15, 0, 1446},
+    {151, 2, 7, 0},
+    {24, 8, 0, 1448},
+    {32, 15, 3, 1},
+    {34, 7, 5, 1449},
+    {183, 1, 3, 1},
+    {254, 16, 0, 1482},
+    {54, 13, 0, 1471},
+    {15, 15, 0, 1470},
+    {80, 19, 0, 1455},
+    {50, 9, 7, 0},
+    {595, 0, 0, 1466},
+    {129, 19, 0, 1462},
+    {158, 0, 0, 1460},
+    {39, 13, 5, 1459},
+    {11, 5, 3, 1},
+    {51, 13, 2, 1},
+    {7, 4, 3, 1},
+    {41, 13, 5, 1463},
+    {36, 18, 1, 1464},
+    {1469, 10, 2, 0},
+    {38, 7, 7, 0},
+    {25, 8, 1, 1467},
+    {21, 7, 5, 1468},
+    {79, 6, 2, 1},
+    {663, 19, 3, 1},
+    {229, 0, 3, 1},
+    {331, 0, 0, 1475},
+    {39, 8, 2, 1},
+    {149, 0, 5, 1474},
+    {38, 2, 7, 0},
+    {43, 8, 0, 1479},
+    {883, 10, 2, 0},
+    {54, 16, 2, 1},
+    {1055, 2, 3, 1},
+    {59, 7, 2, 0},
+    {886, 19, 5, 1481},
+    {56, 13, 3, 1},
+    {16, 5, 0, 1490},
+    {22, 3, 0, 1486},
+    {10, 7, 2, 1},
+    {2761, 2, 3, 1},
+    {27, 8, 2, 1},
+    {23, 7, 0, 1489},
+    {2076, 2, 7, 0},
+    {4161, 14, 3, 1},
+    {4065, 1, 0, 1494},
+    {4994, 14, 5, 1492},
+    {1233, 1, 2, 1},
+    {63, 13, 7, 0},
+    {114, 17, 2, 0},
+    {43, 17, 2, 1},
+    {7, 3, 3, 1},
+    // SCDetect6
+    {66, 19, 0, 1614},
+    {12, 5, 0, 1575},
+    {42, 0, 0, 1516},
+    {4, 8, 0, 1514},
+    {1, 12, 0, 1507},
+    {106, 17, 0, 1506},
+    {-2, 16, 2, 0},
+    {4, 0, 2, 0},
+    {104, 3, 3, 1},
+    {226, 6, 3, 1},
+    {2, 7, 2, 0},
+    {4, 4, 0, 1511},
+    {7, 16, 1, 1510},
+    {20, 6, 7, 0},
+    {2341, 14, 2, 0},
+    {613, 2, 1, 1513},
+    {2, 0, 3, 1},
+    {22, 6, 2, 0},
+    {742, 10, 3, 1},
+    {10, 8, 0, 1554},
+    {16, 4, 0, 1543},
+    {38, 18, 0, 1530},
+    {8, 11, 0, 1525},
+    {5, 1, 1, 1521},
+    {1, 13, 0, 1523},
+    {17, 18, 7, 0},
+    {1, 12, 2, 0},
+    {44, 10, 3, 1},
+    {5, 4, 2, 0},
+    {143, 0, 1, 1527},
+    {66, 17, 5, 1528},
+    {36, 9, 1, 1529},
+    {39, 1, 7, 0},
+    {6, 5, 0, 1537},
+    {230, 6, 0, 1535},
+    {17, 7, 1, 1533},
+    {46, 18, 2, 0},
+    {296, 1, 3, 1},
+    {5, 3, 1, 1536},
+    {126, 17, 7, 0},
+    {601, 2, 1, 1538},
+    {-26, 19, 0, 1541},
+    {-40, 19, 2, 1},
+    {458, 0, 3, 1},
+    {2, 3, 2, 0},
+    {24, 13, 3, 1},
+    {10, 13, 0, 1550},
+    {6, 9, 0, 1546},
+    {604, 14, 3, 1},
+    {6, 8, 0, 1549},
+    {22, 19, 1, 1548},
+    {2019, 10, 7, 0},
+    {3753, 2, 3, 1},
+    {57, 13, 0, 1553},
+    {499, 0, 1, 1552},
+    {6135, 14, 7, 0},
+    {3705, 14, 7, 0},
+    {52, 18, 0, 1564},
+    {236, 1, 0, 1563},
+    {41, 17, 1, 1557},
+    {42, 17, 5, 1558},
+    {155, 0, 0, 1561},
+    {-6, 19, 2, 0},
+    {16, 13, 3, 1},
+    {177, 10, 5, 1562},
+    {482, 10, 3, 1},
+    {19, 8, 7, 0},
+    {21, 8, 0, 1570},
+    {35, 13, 1, 1566},
+    {1075, 16, 2, 1},
+    {41, 2, 2, 0},
+    {13, 14, 1, 1569},
+    {23, 10, 7, 0},
+    {8, 5, 1, 1571},
+    {5, 12, 2, 0},
+    {57, 9, 5, 1573},
+    {50, 19, 2, 1},
+    {306, 0, 3, 1},
+    {25, 8, 0, 1596},
+    {13, 5, 0, 1579},
+    {370, 0, 1, 1578},
+    {125, 1, 3, 1},
+    {618, 1, 0, 1595},
+    {1132, 10, 0, 1593},
+    {115, 1, 0, 1588},
+    {140, 0, 0, 1586},
+    {24, 6, 5, 1584},
+    {27, 17, 1, 1585},
+    {783, 2, 7, 0},
+    {544, 0, 1, 1587},
+    {6, 1, 3, 1},
+    {13, 15, 0, 1591},
+    {149, 1, 2, 1},
+    {25, 7, 3, 1},
+    {4, 4, 2, 0},
+    {18, 7, 7, 0},
+    {381, 1, 1, 1594},
+    {42, 7, 3, 1},
+    {3, 3, 3, 1},
+    {389, 1, 0, 1605},
+    {22, 0, 5, 1598},
+    {20, 3, 0, 1602},
+    {16, 7, 1, 1600},
+    {56, 6, 2, 1},
+    {381, 14, 3, 1},
+    {2725, 14, 1, 1603},
+    {89, 0, 1, 1604},
+    {258, 1, 3, 1},
+    {111, 18, 0, 1609},
+    {82, 6, 5, 1607},
+    {5837, 14, 5, 1608},
+    {4505, 2, 3, 1},
+    {36, 13, 1, 1610},
+    {1752, 2, 0, 1612},
+    {502, 1, 7, 0},
+    {28, 17, 2, 1},
+    {13, 4, 7, 0},
+    {12, 8, 0, 1668},
+    {7, 8, 0, 1643},
+    {4, 5, 0, 1632},
+    {108, 3, 0, 1630},
+    {5, 4, 0, 1621},
+    {24, 18, 2, 0},
+    {42, 3, 3, 1},
+    {1444, 14, 0, 1629},
+    {65, 16, 0, 1628},
+    {13, 3, 2, 0},
+    {14, 7, 2, 1},
+    {39, 6, 2, 0},
+    {508, 2, 2, 0},
+    {-3, 8, 3, 1},
+    {111, 6, 7, 0},
+    {6689, 10, 3, 1},
+    {9, 10, 2, 0},
+    {99, 6, 3, 1},
+    {19, 4, 0, 1642},
+    {4, 14, 0, 1635},
+    {14, 7, 3, 1},
+    {208, 19, 0, 1638},
+    {122, 17, 1, 1637},
+    {471, 10, 3, 1},
+    {5, 5, 0, 1640},
+    {23, 10, 3, 1},
+    {612, 10, 1, 1641},
+    {1548, 2, 7, 0},
+    {198, 0, 3, 1},
+    {45, 18, 0, 1655},
+    {5, 3, 0, 1649},
+    {23, 1, 5, 1646},
+    {468, 2, 2, 1},
+    {10, 8, 2, 0},
+    {4, 15, 3, 1},
+    {5, 15, 2, 1},
+    {13, 13, 0, 1652},
+    {35, 2, 3, 1},
+    {17, 16, 2, 1},
+    {6, 7, 2, 0},
+    {16, 13, 7, 0},
+    {13, 13, 0, 1657},
+    {958, 14, 7, 0},
+    {694, 10, 0, 1666},
+    {5, 15, 0, 1661},
+    {391, 19, 1, 1660},
+    {16, 13, 7, 0},
+    {3, 12, 0, 1663},
+    {31, 16, 3, 1},
+    {8, 3, 2, 0},
+    {12, 7, 1, 1665},
+    {-4, 5, 3, 1},
+    {33, 15, 1, 1667},
+    {2231, 2, 7, 0},
+    {93, 19, 0, 1690},
+    {100, 0, 0, 1679},
+    {100, 9, 0, 1677},
+    {32, 13, 0, 1675},
+    {145, 1, 2, 1},
+    {4, 12, 2, 0},
+    {678, 10, 7, 0},
+    {8, 12, 5, 1676},
+    {136, 18, 7, 0},
+    {75, 0, 5, 1678},
+    {661, 10, 7, 0},
+    {27, 16, 1, 1680},
+    {61, 9, 0, 1685},
+    {89, 19, 2, 1},
+    {18, 8, 1, 1683},
+    {144, 0, 5, 1684},
+    {404, 10, 7, 0},
+    {3592, 10, 2, 1},
+    {411, 2, 5, 1687},
+    {225, 10, 5, 1688},
+    {107, 0, 2, 0},
+    {1368, 10, 7, 0},
+    {58, 16, 0, 1747},
+    {591, 10, 0, 1741},
+    {2, 16, 0, 1706},
+    {264, 10, 0, 1705},
+    {46, 13, 2, 0},
+    {43, 17, 0, 1701},
+    {11, 7, 0, 1698},
+    {119, 2, 7, 0},
+    {21, 7, 2, 1},
+    {169, 19, 2, 0},
+    {254, 0, 3, 1},
+    {3, 4, 2, 1},
+    {1, 15, 5, 1703},
+    {33, 10, 1, 1704},
+    {146, 10, 7, 0},
+    {-152, 16, 7, 0},
+    {14, 3, 0, 1713},
+    {5, 3, 5, 1708},
+    {71, 9, 2, 1},
+    {44, 18, 5, 1710},
+    {3, 4, 0, 1712},
+    {46, 9, 7, 0},
+    {46, 18, 3, 1},
+    {151, 2, 0, 1722},
+    {15, 8, 0, 1718},
+    {183, 0, 5, 1716},
+    {43, 3, 1, 1717},
+    {130, 14, 3, 1},
+    {42, 3, 5, 1719},
+    {46, 3, 0, 1721},
+    {2, 4, 7, 0},
+    {54, 6, 3, 1},
+    {92, 9, 0, 1731},
+    {12, 5, 0, 1727},
+    {27, 3, 2, 1},
+    {80, 9, 1, 1726},
+    {18, 3, 7, 0},
+    {47, 5, 2, 0},
+    {219, 19, 2, 1},
+    {39, 13, 5, 1730},
+    {43, 13, 3, 1},
+    {13, 5, 0, 1735},
+    {6, 4, 2, 1},
+    {271, 10, 2, 0},
+    {21, 13, 7, 0},
+    {10, 17, 0, 1738},
+    {823, 0, 2, 1},
+    {21, 13, 7, 0},
+    {39, 8, 2, 0},
+    {19, 5, 5, 1740},
+    {116, 18, 3, 1},
+    {803, 10, 2, 0},
+    {66, 18, 0, 1744},
+    {21, 8, 3, 1},
+    {1651, 14, 2, 1},
+    {985, 14, 2, 0},
+    {536, 19, 3, 1},
+    {12, 5, 0, 1766},
+    {1749, 14, 0, 1754},
+    {3, 4, 1, 1750},
+    {8, 17, 0, 1752},
+    {8, 5, 7, 0},
+    {105, 19, 2, 1},
+    {133, 0, 7, 0},
+    {58, 18, 0, 1757},
+    {3505, 14, 5, 1756},
+    {13, 7, 3, 1},
+    {69, 9, 0, 1765},
+    {6, 5, 1, 1759},
+    {10, 4, 5, 1760},
+    {34, 15, 2, 1},
+    {227, 0, 0, 1763},
+    {75, 18, 7, 0},
+    {39, 9, 1, 1764},
+    {14, 4, 3, 1},
+    {7378, 14, 3, 1},
+    {21, 3, 0, 1770},
+    {1206, 0, 5, 1768},
+    {4, 12, 2, 1},
+    {513, 2, 3, 1},
+    {3, 17, 0, 1774},
+    {261, 2, 5, 1772},
+    {41, 5, 1, 1773},
+    {56, 13, 3, 1},
+    {724, 2, 5, 1775},
+    {17, 5, 0, 1781},
+    {2290, 2, 0, 1779},
+    {29, 7, 5, 1778},
+    {2405, 10, 3, 1},
+    {34, 13, 5, 1780},
+    {116, 6, 3, 1},
+    {181, 16, 0, 1790},
+    {450, 19, 2, 1},
+    {415, 0, 0, 1789},
+    {7, 4, 2, 1},
+    {35, 8, 0, 1788},
+    {89, 17, 1, 1787},
+    {40, 13, 7, 0},
+    {5, 4, 3, 1},
+    {1589, 14, 7, 0},
+    {21, 17, 0, 1795},
+    {117, 19, 0, 1793},
+    {1867, 2, 3, 1},
+    {107, 9, 2, 1},
+    {302, 0, 7, 0},
+    {40, 7, 5, 1796},
+    {38, 8, 3, 1},
+    // SCDetect7
+    {16, 7, 0, 1938},
+    {65, 19, 0, 1854},
+    {6, 3, 0, 1825},
+    {21, 18, 0, 1808},
+    {15, 15, 2, 1},
+    {1155, 10, 2, 0},
+    {1151, 10, 2, 1},
+    {2, 15, 1, 1805},
+    {2, 11, 2, 0},
+    {652, 10, 5, 1807},
+    {5, 0, 7, 0},
+    {7, 8, 0, 1817},
+    {1477, 16, 0, 1816},
+    {4, 3, 1, 1811},
+    {43, 6, 2, 0},
+    {25, 18, 5, 1813},
+    {-6, 5, 2, 0},
+    {4, 15, 1, 1815},
+    {133, 10, 7, 0},
+    {1531, 16, 7, 0},
+    {70, 0, 0, 1821},
+    {14, 7, 1, 1819},
+    {189, 1, 2, 0},
+    {3434, 14, 7, 0},
+    {47, 18, 0, 1824},
+    {623, 14, 2, 0},
+    {8, 2, 3, 1},
+    {22, 17, 7, 0},
+    {247, 16, 0, 1847},
+    {125, 14, 0, 1838},
+    {24, 6, 0, 1829},
+    {3, 8, 7, 0},
+    {122, 14, 2, 1},
+    {-97, 16, 0, 1832},
+    {-11, 8, 3, 1},
+    {2, 1, 0, 1835},
+    {-22, 16, 2, 0},
+    {6, 13, 7, 0},
+    {8, 11, 1, 1836},
+    {-17, 19, 1, 1837},
+    {87, 2, 7, 0},
+    {175, 0, 0, 1843},
+    {10, 15, 1, 1840},
+    {54, 19, 1, 1841},
+    {2716, 14, 2, 0},
+    {192, 1, 7, 0},
+    {51, 3, 0, 1846},
+    {15, 8, 1, 1845},
+    {16, 8, 7, 0},
+    {55, 3, 7, 0},
+    {3613, 14, 0, 1853},
+    {7, 5, 0, 1851},
+    {78, 6, 2, 0},
+    {10, 4, 3, 1},
+    {61, 9, 5, 1852},
+    {366, 2, 7, 0},
+    {46, 18, 7, 0},
+    {1, 16, 0, 1876},
+    {94, 2, 0, 1874},
+    {7, 8, 0, 1864},
+    {397, 19, 0, 1860},
+    {-21, 5, 2, 0},
+    {94, 6, 7, 0},
+    {15, 1, 2, 1},
+    {127, 17, 1, 1862},
+    {611, 0, 5, 1863},
+    {1653, 0, 3, 1},
+    {94, 18, 0, 1872},
+    {21, 18, 1, 1866},
+    {8, 8, 1, 1867},
+    {38, 6, 5, 1868},
+    {119, 19, 1, 1869},
+    {34, 3, 0, 1871},
+    {40, 6, 3, 1},
+    {2, 2, 7, 0},
+    {233, 19, 1, 1873},
+    {18, 13, 7, 0},
+    {41, 3, 1, 1875},
+    {45, 3, 7, 0},
+    {1209, 10, 0, 1930},
+    {3, 5, 0, 1892},
+    {51, 18, 0, 1889},
+    {87, 16, 0, 1888},
+    {-2, 5, 1, 1881},
+    {1, 8, 0, 1883},
+    {4, 4, 3, 1},
+    {29, 6, 5, 1884},
+    {130, 2, 2, 0},
+    {2, 4, 1, 1886},
+    {10, 2, 1, 1887},
+    {96, 3, 7, 0},
+    {45, 15, 7, 0},
+    {15, 13, 2, 0},
+    {621, 14, 2, 0},
+    {11, 1, 3, 1},
+    {13, 8, 0, 1908},
+    {50, 18, 0, 1903},
+    {278, 2, 0, 1899},
+    {10, 3, 0, 1898},
+    {230, 2, 5, 1897},
+    {233, 2, 3, 1},
+    {224, 19, 3, 1},
+    {170, 10, 5, 1900},
+    {135, 0, 5, 1901},
+    {139, 19, 1, 1902},
+    {661, 14, 3, 1},
+    {99, 2, 0, 1905},
+    {4, 4, 3, 1},
+    {7, 4, 1, 1906},
+    {803, 2, 2, 0},
+    {31, 13, 7, 0},
+    {112, 9, 0, 1925},
+    {5, 5, 0, 1911},
+    {68, 6, 7, 0},
+    {180, 19, 0, 1924},
+    {43, 17, 0, 1916},
+    {30, 8, 2, 0},
+    {383, 10, 5, 1915},
+    {134, 16, 3, 1},
+    {15, 5, 2, 0},
+    {86, 16, 2, 1},
+    {3, 15, 5, 1919},
+    {14, 8, 1, 1920},
+    {87, 19, 0, 1922},
+    {898, 14, 3, 1},
+    {1459, 14, 5, 1923},
+    {661, 10, 3, 1},
+    {74, 3, 7, 0},
+    {121, 18, 0, 1927},
+    {1348, 14, 7, 0},
+    {6, 4, 1, 1928},
+    {155, 6, 2, 1},
+    {9, 4, 7, 0},
+    {249, 16, 1, 1931},
+    {1483, 10, 0, 1934},
+    {22, 15, 5, 1933},
+    {23, 13, 7, 0},
+    {21, 8, 0, 1936},
+    {19, 13, 7, 0},
+    {3, 3, 1, 1937},
+    {21, 3, 7, 0},
+    {65, 19, 0, 1994},
+    {19, 8, 0, 1970},
+    {61, 6, 0, 1953},
+    {25, 6, 0, 1944},
+    {1212, 14, 2, 1},
+    {28, 7, 7, 0},
+    {42, 17, 0, 1951},
+    {54, 6, 0, 1949},
+    {4, 15, 2, 0},
+    {57, 18, 2, 0},
+    {579, 10, 3, 1},
+    {2255, 14, 2, 0},
+    {20, 7, 7, 0},
+    {6, 3, 2, 1},
+    {47, 6, 7, 0},
+    {2381, 10, 2, 0},
+    {59, 13, 0, 1967},
+    {43, 19, 0, 1960},
+    {-2, 5, 2, 0},
+    {8, 4, 1, 1958},
+    {49, 13, 2, 1},
+    {92, 15, 3, 1},
+    {48, 9, 1, 1961},
+    {2322, 10, 2, 1},
+    {6, 4, 0, 1965},
+    {17, 3, 2, 0},
+    {590, 1, 7, 0},
+    {66, 0, 2, 0},
+    {32, 13, 3, 1},
+    {108, 18, 5, 1968},
+    {470, 1, 1, 1969},
+    {3672, 14, 7, 0},
+    {30, 8, 0, 1985},
+    {5423, 1, 2, 1},
+    {80, 1, 0, 1974},
+    {29, 6, 7, 0},
+    {1213, 1, 2, 0},
+    {103, 9, 2, 0},
+    {630, 2, 5, 1977},
+    {1387, 2, 0, 1979},
+    {-401, 19, 7, 0},
+    {22, 8, 0, 1981},
+    {10, 17, 7, 0},
+    {1464, 10, 0, 1984},
+    {2958, 14, 5, 1983},
+    {71, 9, 7, 0},
+    {15, 4, 3, 1},
+    {136, 6, 0, 1992},
+    {39, 13, 5, 1987},
+    {209, 1, 0, 1990},
+    {206, 2, 2, 0},
+    {253, 14, 3, 1},
+    {68, 0, 5, 1991},
+    {113, 0, 3, 1},
+    {6, 9, 5, 1993},
+    {58, 8, 3, 1},
+    {66, 16, 0, 2033},
+    {96, 19, 0, 1998},
+    {184, 18, 1, 1997},
+    {185, 18, 7, 0},
+    {691, 10, 0, 2029},
+    {14, 17, 0, 2003},
+    {77, 3, 0, 2002},
+    {19, 13, 7, 0},
+    {433, 0, 7, 0},
+    {24, 8, 0, 2018},
+    {36, 16, 0, 2014},
+    {5, 5, 1, 2006},
+    {17, 7, 5, 2007},
+    {7, 3, 5, 2008},
+    {53, 17, 0, 2012},
+    {138, 19, 1, 2010},
+    {404, 10, 2, 1},
+    {298, 14, 7, 0},
+    {481, 14, 2, 0},
+    {2, 4, 3, 1},
+    {298, 0, 0, 2016},
+    {938, 2, 7, 0},
+    {192, 19, 1, 2017},
+    {50, 13, 7, 0},
+    {82, 13, 2, 0},
+    {216, 14, 0, 2023},
+    {2, 4, 0, 2022},
+    {324, 0, 7, 0},
+    {22, 9, 3, 1},
+    {50, 17, 0, 2028},
+    {99, 9, 2, 1},
+    {28, 17, 0, 2027},
+    {28, 13, 7, 0},
+    {71, 9, 3, 1},
+    {73, 2, 3, 1},
+    {24, 3, 2, 0},
+    {53, 13, 2, 1},
+    {19, 8, 1, 2032},
+    {37, 17, 3, 1},
+    {22, 8, 0, 2051},
+    {63, 18, 0, 2037},
+    {146, 0, 2, 1},
+    {15, 15, 3, 1},
+    {174, 16, 0, 2040},
+    {740, 0, 1, 2039},
+    {296, 1, 3, 1},
+    {10, 5, 0, 2046},
+    {15, 4, 1, 2042},
+    {1541, 2, 5, 2043},
+    {8557, 2, 2, 1},
+    {22, 7, 1, 2045},
+    {2574, 10, 7, 0},
+    {3908, 14, 5, 2047},
+    {1276, 16, 0, 2050},
+    {27, 7, 1, 2049},
+    {51, 13, 7, 0},
+    {4743, 10, 7, 0},
+    {38, 8, 0, 2076},
+    {27, 17, 0, 2066},
+    {54, 13, 2, 0},
+    {151, 19, 0, 2061},
+    {20, 5, 0, 2058},
+    {5, 12, 2, 0},
+    {16, 17, 3, 1},
+    {1727, 14, 5, 2059},
+    {1180, 16, 1, 2060},
+    {10013, 14, 7, 0},
+    {30, 8, 2, 1},
+    {414, 16, 2, 1},
+    {874, 2, 5, 2064},
+    {48, 3, 1, 2065},
+    {195, 1, 3, 1},
+    {144, 0, 5, 2067},
+    {98, 19, 1, 2068},
+    {2204, 14, 5, 2069},
+    {20, 3, 5, 2070},
+    {1327, 1, 2, 1},
+    {73, 17, 0, 2075},
+    {41, 13, 2, 0},
+    {90, 9, 2, 1},
+    {4121, 14, 3, 1},
+    {2197, 10, 7, 0},
+    {125, 9, 2, 0},
+    {194, 16, 2, 1},
+    {47, 6, 2, 1},
+    {33, 7, 7, 0},
+    // SCDetect8
+    {7, 5, 0, 2202},
+    {56, 19, 0, 2135},
+    {24, 7, 0, 2128},
+    {248, 16, 0, 2119},
+    {56, 10, 0, 2104},
+    {5, 7, 0, 2092},
+    {128, 9, 2, 1},
+    {228, 6, 0, 2091},
+    {1, 17, 2, 0},
+    {1, 13, 1, 2090},
+    {1179, 0, 3, 1},
+    {38, 14, 3, 1},
+    {232, 0, 1, 2093},
+    {-16, 19, 0, 2098},
+    {747, 0, 0, 2097},
+    {25, 16, 1, 2096},
+    {126, 2, 7, 0},
+    {18, 13, 7, 0},
+    {227, 6, 2, 1},
+    {-96, 16, 0, 2101},
+    {15, 1, 3, 1},
+    {-9, 19, 2, 0},
+    {12, 13, 5, 2103},
+    {12, 7, 3, 1},
+    {67, 17, 0, 2114},
+    {18, 6, 0, 2108},
+    {7, 16, 1, 2107},
+    {882, 14, 3, 1},
+    {-9, 19, 2, 0},
+    {11, 7, 1, 2110},
+    {1136, 14, 2, 0},
+    {57, 18, 2, 0},
+    {4, 4, 1, 2113},
+    {110, 0, 3, 1},
+    {50, 18, 2, 0},
+    {12, 16, 1, 2116},
+    {5, 5, 2, 1},
+    {41, 13, 2, 1},
+    {-273, 19, 7, 0},
+    {9, 17, 0, 2124},
+    {2604, 10, 2, 0},
+    {21, 18, 5, 2122},
+    {4038, 14, 2, 0},
+    {3, 7, 3, 1},
+    {14, 15, 2, 0},
+    {1771, 10, 2, 0},
+    {63, 18, 2, 0},
+    {29, 13, 7, 0},
+    {111, 18, 2, 0},
+    {387, 1, 1, 2130},
+    {2454, 10, 2, 0},
+    {11, 8, 2, 0},
+    {10, 4, 1, 2133},
+    {3716, 14, 5, 2134},
+    {5712, 14, 3, 1},
+    {4, 5, 0, 2176},
+    {59, 17, 0, 2151},
+    {103, 3, 0, 2150},
+    {12, 1, 0, 2141},
+    {24, 18, 2, 0},
+    {46, 17, 3, 1},
+    {18, 8, 0, 2149},
+    {99, 10, 0, 2145},
+    {145, 14, 5, 2144},
+    {91, 10, 3, 1},
+    {1, 7, 0, 2147},
+    {920, 14, 3, 1},
+    {15, 1, 2, 0},
+    {87, 9, 3, 1},
+    {64, 6, 7, 0},
+    {2, 4, 3, 1},
+    {8, 8, 0, 2166},
+    {-36, 8, 0, 2154},
+    {431, 14, 7, 0},
+    {83, 17, 0, 2164},
+    {5, 3, 1, 2156},
+    {31, 18, 0, 2159},
+    {3, 15, 2, 1},
+    {-21, 16, 7, 0},
+    {5, 4, 1, 2160},
+    {48, 9, 1, 2161},
+    {48, 18, 5, 2162},
+    {124, 18, 1, 2163},
+    {56, 13, 7, 0},
+    {24, 18, 2, 0},
+    {1, 4, 3, 1},
+    {2, 9, 5, 2167},
+    {2894, 14, 2, 0},
+    {85, 16, 0, 2174},
+    {16, 13, 5, 2170},
+    {146, 2, 0, 2173},
+    {236, 19, 2, 1},
+    {4, 4, 3, 1},
+    {1442, 0, 3, 1},
+    {69, 13, 2, 0},
+    {20, 4, 7, 0},
+    {102, 2, 0, 2187},
+    {9, 8, 0, 2180},
+    {6, 2, 5, 2179},
+    {28, 18, 7, 0},
+    {64, 6, 0, 2184},
+    {135, 19, 2, 1},
+    {15, 13, 5, 2183},
+    {6, 5, 3, 1},
+    {7, 15, 2, 1},
+    {23, 13, 2, 0},
+    {42, 2, 3, 1},
+    {34, 7, 2, 1},
+    {8, 16, 1, 2189},
+    {1410, 14, 0, 2199},
+    {50, 16, 0, 2196},
+    {43, 18, 0, 2195},
+    {97, 0, 1, 2193},
+    {5, 15, 5, 2194},
+    {164, 10, 7, 0},
+    {120, 18, 3, 1},
+    {792, 2, 2, 0},
+    {8, 7, 2, 1},
+    {24, 13, 7, 0},
+    {40, 18, 5, 2200},
+    {534, 0, 1, 2201},
+    {52, 6, 3, 1},
+    {56, 0, 0, 2215},
+    {2138, 10, 0, 2213},
+    {27, 7, 2, 1},
+    {565, 16, 0, 2211},
+    {29, 6, 0, 2208},
+    {79, 14, 3, 1},
+    {70, 18, 2, 0},
+    {63, 18, 1, 2210},
+    {16, 8, 3, 1},
+    {35, 17, 2, 1},
+    {8, 5, 3, 1},
+    {33, 7, 1, 2214},
+    {4830, 2, 7, 0},
+    {30, 17, 0, 2283},
+    {99, 19, 0, 2246},
+    {10, 15, 0, 2231},
+    {3, 12, 0, 2225},
+    {1, 17, 5, 2220},
+    {104, 10, 0, 2224},
+    {89, 19, 2, 1},
+    {12, 17, 1, 2223},
+    {99, 10, 3, 1},
+    {488, 14, 3, 1},
+    {39, 6, 2, 0},
+    {40, 16, 1, 2227},
+    {37, 6, 2, 1},
+    {1054, 14, 5, 2229},
+    {26, 5, 1, 2230},
+    {1213, 10, 7, 0},
+    {2375, 14, 0, 2235},
+    {97, 6, 0, 2234},
+    {68, 0, 3, 1},
+    {26, 7, 3, 1},
+    {22, 15, 0, 2244},
+    {19, 8, 1, 2237},
+    {141, 0, 0, 2240},
+    {222, 16, 2, 0},
+    {742, 10, 7, 0},
+    {2152, 2, 2, 0},
+    {92, 3, 2, 0},
+    {1771, 2, 5, 2243},
+    {3012, 14, 7, 0},
+    {14, 5, 2, 1},
+    {19, 13, 7, 0},
+    {66, 16, 0, 2269},
+    {377, 2, 0, 2263},
+    {53, 1, 0, 2262},
+    {31, 1, 0, 2260},
+    {685, 14, 2, 0},
+    {353, 0, 0, 2256},
+    {20, 7, 0, 2255},
+    {94, 10, 5, 2254},
+    {126, 10, 3, 1},
+    {232, 0, 3, 1},
+    {28, 13, 0, 2258},
+    {3, 1, 3, 1},
+    {9, 17, 1, 2259},
+    {111, 14, 7, 0},
+    {30, 3, 2, 1},
+    {206, 2, 7, 0},
+    {1028, 0, 3, 1},
+    {71, 3, 2, 1},
+    {5, 15, 1, 2265},
+    {111, 18, 2, 1},
+    {31, 13, 2, 0},
+    {16, 5, 2, 1},
+    {20, 8, 3, 1},
+    {740, 16, 2, 1},
+    {990, 10, 0, 2276},
+    {2373, 2, 0, 2275},
+    {10, 5, 2, 1},
+    {715, 0, 2, 0},
+    {22, 7, 7, 0},
+    {394, 10, 7, 0},
+    {377, 19, 2, 1},
+    {30, 3, 5, 2278},
+    {104, 9, 1, 2279},
+    {836, 2, 1, 2280},
+    {433, 16, 2, 0},
+    {139, 0, 1, 2282},
+    {138, 1, 3, 1},
+    {16, 5, 0, 2340},
+    {12, 8, 0, 2292},
+    {74, 19, 1, 2286},
+    {16, 9, 1, 2287},
+    {55, 18, 0, 2289},
+    {11, 13, 3, 1},
+    {22, 7, 1, 2290},
+    {4, 4, 1, 2291},
+    {1366, 2, 7, 0},
+    {63, 19, 0, 2308},
+    {11, 5, 0, 2301},
+    {21, 13, 0, 2296},
+    {10, 7, 3, 1},
+    {699, 10, 2, 0},
+    {93, 6, 2, 0},
+    {4, 4, 5, 2299},
+    {475, 2, 1, 2300},
+    {62, 17, 3, 1},
+    {18, 16, 1, 2302},
+    {505, 10, 0, 2304},
+    {6, 15, 3, 1},
+    {69, 0, 5, 2305},
+    {63, 6, 1, 2306},
+    {493, 16, 2, 0},
+    {28, 7, 7, 0},
+    {25, 7, 0, 2337},
+    {93, 18, 0, 2331},
+    {43, 17, 0, 2318},
+    {4, 15, 5, 2312},
+    {732, 14, 0, 2314},
+    {3, 12, 7, 0},
+    {6, 4, 0, 2316},
+    {1013, 14, 7, 0},
+    {83, 19, 2, 1},
+    {63, 6, 7, 0},
+    {7, 3, 5, 2319},
+    {677, 10, 0, 2325},
+    {79, 3, 0, 2323},
+    {1, 16, 2, 1},
+    {8, 5, 3, 1},
+    {213, 14, 2, 1},
+    {45, 10, 7, 0},
+    {34, 13, 0, 2328},
+    {36, 18, 2, 1},
+    {33, 18, 7, 0},
+    {811, 10, 1, 2329},
+    {20, 4, 2, 1},
+    {35, 15, 3, 1},
+    {2, 16, 1, 2332},
+    {25, 8, 2, 1},
+    {19, 8, 1, 2334},
+    {4, 12, 5, 2335},
+    {20, 8, 5, 2336},
+    {2026, 16, 3, 1},
+    {7, 3, 5, 2338},
+    {15, 4, 1, 2339},
+    {31, 4, 7, 0},
+    {63, 16, 0, 2352},
+    {95, 19, 1, 2342},
+    {25, 5, 0, 2350},
+    {1, 16, 0, 2346},
+    {29, 3, 5, 2345},
+    {2319, 2, 3, 1},
+    {62, 16, 2, 0},
+    {754, 10, 2, 0},
+    {56, 6, 2, 1},
+    {43, 13, 7, 0},
+    {183, 6, 5, 2351},
+    {47, 3, 7, 0},
+    {36, 9, 0, 2363},
+    {35, 9, 0, 2362},
+    {1745, 14, 5, 2355},
+    {120, 19, 0, 2361},
+    {170, 0, 0, 2359},
+    {9, 15, 1, 2358},
+    {59, 13, 7, 0},
+    {195, 6, 1, 2360},
+    {1676, 2, 3, 1},
+    {82, 3, 7, 0},
+    {22, 7, 3, 1},
+    {95, 0, 0, 2368},
+    {245, 1, 0, 2366},
+    {68, 6, 7, 0},
+    {6363, 10, 5, 2367},
+    {32, 7, 3, 1},
+    {25, 8, 2, 1},
+    {44, 7, 2, 0},
+    {24, 8, 7, 0},
+    // SCDetect9
+    {14, 8, 0, 2494},
+    {54, 19, 0, 2427},
+    {24, 6, 0, 2388},
+    {115, 16, 2, 1},
+    {32, 3, 2, 1},
+    {5, 16, 0, 2384},
+    {-1, 8, 2, 0},
+    {2, 19, 0, 2382},
+    {2, 11, 1, 2380},
+    {-2, 5, 2, 0},
+    {-3, 5, 3, 1},
+    {10, 0, 5, 2383},
+    {30, 18, 3, 1},
+    {4, 17, 2, 0},
+    {7, 16, 2, 1},
+    {1, 7, 1, 2387},
+    {3, 4, 3, 1},
+    {5, 3, 0, 2398},
+    {44, 6, 0, 2395},
+    {10, 8, 0, 2393},
+    {9, 11, 1, 2392},
+    {311, 0, 3, 1},
+    {5, 5, 1, 2394},
+    {2320, 10, 7, 0},
+    {174, 18, 1, 2396},
+    {174, 6, 2, 0},
+    {814, 16, 3, 1},
+    {255, 16, 0, 2421},
+    {224, 0, 0, 2405},
+    {81, 14, 2, 0},
+    {61, 10, 0, 2404},
+    {227, 6, 1, 2403},
+    {1, 2, 7, 0},
+    {8, 2, 3, 1},
+    {4, 5, 0, 2413},
+    {7, 3, 0, 2411},
+    {1, 2, 5, 2408},
+    {4, 4, 1, 2409},
+    {8, 15, 2, 0},
+    {65, 18, 7, 0},
+    {62, 13, 1, 2412},
+    {3672, 14, 7, 0},
+    {114, 6, 2, 0},
+    {48, 17, 0, 2417},
+    {241, 0, 2, 0},
+    {233, 0, 3, 1},
+    {647, 14, 1, 2418},
+    {62, 16, 2, 0},
+    {14, 7, 2, 1},
+    {540, 2, 7, 0},
+    {47, 18, 0, 2425},
+    {2156, 2, 2, 1},
+    {5, 8, 2, 0},
+    {6622, 1, 7, 0},
+    {177, 10, 5, 2426},
+    {58, 13, 3, 1},
+    {7, 8, 0, 2456},
+    {38, 18, 0, 2444},
+    {63, 10, 0, 2434},
+    {1653, 0, 0, 2433},
+    {4, 15, 1, 2432},
+    {4, 7, 7, 0},
+    {1131, 19, 3, 1},
+    {5, 7, 0, 2438},
+    {40, 2, 5, 2436},
+    {574, 10, 1, 2437},
+    {992, 10, 7, 0},
+    {74, 19, 1, 2439},
+    {1, 4, 1, 2440},
+    {-6, 5, 5, 2441},
+    {34, 6, 0, 2443},
+    {72, 9, 7, 0},
+    {1099, 0, 3, 1},
+    {36, 7, 0, 2455},
+    {34, 13, 0, 2449},
+    {1, 14, 2, 0},
+    {-7, 5, 5, 2448},
+    {272, 0, 7, 0},
+    {1104, 14, 2, 0},
+    {18, 16, 0, 2453},
+    {76, 6, 2, 0},
+    {77, 1, 3, 1},
+    {-6, 5, 1, 2454},
+    {9, 3, 3, 1},
+    {2017, 14, 3, 1},
+    {825, 14, 0, 2478},
+    {50, 18, 0, 2472},
+    {10, 3, 0, 2466},
+    {740, 14, 0, 2465},
+    {5, 16, 2, 1},
+    {200, 0, 2, 1},
+    {5, 5, 2, 1},
+    {12, 13, 2, 0},
+    {65, 9, 7, 0},
+    {44, 18, 3, 1},
+    {214, 19, 0, 2470},
+    {20, 3, 0, 2469},
+    {458, 2, 3, 1},
+    {9, 4, 7, 0},
+    {23, 3, 5, 2471},
+    {10, 8, 3, 1},
+    {224, 18, 0, 2477},
+    {12, 4, 2, 1},
+    {65, 6, 2, 0},
+    {34, 17, 1, 2476},
+    {8, 3, 3, 1},
+    {20, 13, 7, 0},
+    {2557, 14, 2, 0},
+    {45, 16, 0, 2482},
+    {-82, 16, 2, 0},
+    {81, 6, 7, 0},
+    {27, 7, 2, 1},
+    {40, 17, 0, 2487},
+    {24, 17, 1, 2485},
+    {12, 8, 1, 2486},
+    {1391, 2, 7, 0},
+    {128, 19, 2, 1},
+    {71, 18, 0, 2493},
+    {10, 15, 5, 2490},
+    {1198, 14, 1, 2491},
+    {521, 1, 5, 2492},
+    {1428, 10, 7, 0},
+    {34, 3, 3, 1},
+    {65, 19, 0, 2543},
+    {25, 8, 0, 2526},
+    {153, 0, 0, 2513},
+    {4, 3, 0, 2505},
+    {36, 18, 0, 2500},
+    {1436, 14, 3, 1},
+    {59, 19, 0, 2504},
+    {2658, 14, 2, 0},
+    {13, 7, 1, 2503},
+    {158, 1, 7, 0},
+    {557, 10, 3, 1},
+    {7070, 2, 2, 1},
+    {53, 18, 0, 2510},
+    {1146, 2, 2, 1},
+    {169, 16, 2, 1},
+    {17, 5, 3, 1},
+    {-506, 19, 5, 2511},
+    {4218, 10, 1, 2512},
+    {4368, 10, 7, 0},
+    {8, 3, 0, 2515},
+    {42, 13, 7, 0},
+    {56, 3, 0, 2523},
+    {345, 1, 0, 2521},
+    {44, 18, 5, 2518},
+    {23, 8, 1, 2519},
+    {73, 1, 2, 0},
+    {425, 2, 3, 1},
+    {549, 1, 5, 2522},
+    {132, 6, 3, 1},
+    {32, 13, 1, 2524},
+    {8, 4, 2, 1},
+    {720, 0, 3, 1},
+    {47, 8, 2, 1},
+    {1682, 2, 0, 2538},
+    {76, 18, 0, 2534},
+    {127, 2, 1, 2530},
+    {948, 14, 0, 2532},
+    {2, 4, 3, 1},
+    {486, 10, 5, 2533},
+    {18, 4, 3, 1},
+    {57, 13, 0, 2537},
+    {124, 9, 1, 2536},
+    {120, 0, 7, 0},
+    {-2, 19, 7, 0},
+    {152, 0, 2, 1},
+    {3562, 10, 2, 0},
+    {18, 7, 1, 2541},
+    {809, 1, 2, 1},
+    {2145, 2, 7, 0},
+    {14, 15, 0, 2617},
+    {30, 17, 0, 2577},
+    {142, 19, 0, 2558},
+    {69, 18, 0, 2551},
+    {1, 4, 1, 2548},
+    {117, 0, 2, 1},
+    {322, 2, 1, 2550},
+    {1093, 10, 7, 0},
+    {99, 19, 1, 2552},
+    {30, 7, 2, 0},
+    {45, 13, 2, 1},
+    {73, 3, 2, 1},
+    {16, 17, 1, 2556},
+    {10, 15, 2, 1},
+    {89, 18, 7, 0},
+    {11, 7, 5, 2559},
+    {10, 17, 0, 2568},
+    {415, 19, 0, 2566},
+    {4, 4, 1, 2562},
+    {18, 7, 0, 2564},
+    {107, 6, 7, 0},
+    {2876, 14, 2, 1},
+    {190, 0, 7, 0},
+    {14, 1, 1, 2567},
+    {125, 6, 7, 0},
+    {9, 5, 1, 2569},
+    {1439, 0, 2, 0},
+    {20, 7, 5, 2571},
+    {103, 18, 0, 2575},
+    {7, 4, 1, 2573},
+    {1199, 2, 5, 2574},
+    {1280, 10, 3, 1},
+    {13, 15, 5, 2576},
+    {103, 9, 3, 1},
+    {7, 5, 0, 2585},
+    {43, 13, 0, 2583},
+    {541, 2, 2, 0},
+    {93, 19, 1, 2581},
+    {111, 6, 5, 2582},
+    {6, 4, 3, 1},
+    {26, 8, 1, 2584},
+    {3, 4, 3, 1},
+    {29, 7, 0, 2613},
+    {1, 16, 0, 2591},
+    {51, 17, 1, 2588},
+    {12, 4, 2, 0},
+    {34, 3, 5, 2590},
+    {124, 10, 3, 1},
+    {25, 8, 0, 2602},
+    {5, 4, 0, 2595},
+    {43, 10, 2, 1},
+    {328, 19, 7, 0},
+    {98, 16, 0, 2601},
+    {627, 14, 5, 2597},
+    {85, 19, 1, 2598},
+    {33, 13, 5, 2599},
+    {146, 19, 1, 2600},
+    {81, 18, 7, 0},
+    {24, 7, 7, 0},
+    {80, 19, 0, 2605},
+    {30, 13, 5, 2604},
+    {34, 9, 7, 0},
+    {46, 18, 0, 2609},
+    {46, 16, 2, 1},
+    {7, 3, 5, 2608},
+    {71, 17, 3, 1},
+    {10, 4, 5, 2610},
+    {91, 16, 1, 2611},
+    {52, 8, 5, 2612},
+    {1118, 14, 3, 1},
+    {64, 16, 2, 1},
+    {897, 14, 2, 0},
+    {27, 5, 1, 2616},
+    {17, 9, 3, 1},
+    {31, 17, 0, 2626},
+    {3198, 14, 0, 2620},
+    {3, 4, 3, 1},
+    {30, 15, 0, 2625},
+    {19, 4, 0, 2623},
+    {373, 1, 7, 0},
+    {4537, 14, 2, 1},
+    {32, 13, 7, 0},
+    {2, 17, 3, 1},
+    {218, 16, 0, 2630},
+    {2115, 14, 2, 0},
+    {26, 7, 1, 2629},
+    {149, 6, 7, 0},
+    {16, 7, 0, 2636},
+    {71, 6, 5, 2632},
+    {272, 0, 2, 1},
+    {10, 5, 0, 2635},
+    {75, 9, 3, 1},
+    {72, 17, 3, 1},
+    {76, 13, 0, 2648},
+    {113, 19, 0, 2643},
+    {128, 0, 0, 2641},
+    {16399, 14, 5, 2640},
+    {32, 7, 3, 1},
+    {25, 8, 1, 2642},
+    {28, 4, 7, 0},
+    {2296, 2, 5, 2644},
+    {2341, 2, 0, 2646},
+    {213, 0, 7, 0},
+    {126, 19, 2, 1},
+    {149, 0, 7, 0},
+    {4638, 2, 7, 0},
+    // SCDetectA
+    {53, 19, 0, 2752},
+    {12, 5, 0, 2721},
+    {54, 0, 0, 2671},
+    {20, 18, 0, 2659},
+    {5, 16, 0, 2656},
+    {2, 15, 1, 2655},
+    {9, 1, 3, 1},
+    {3, 15, 2, 1},
+    {2, 9, 2, 0},
+    {17, 6, 7, 0},
+    {158, 14, 0, 2667},
+    {5, 16, 0, 2665},
+    {124, 9, 2, 1},
+    {-443, 19, 2, 0},
+    {87, 17, 1, 2664},
+    {17, 2, 3, 1},
+    {30, 4, 2, 0},
+    {4, 4, 3, 1},
+    {260, 16, 1, 2668},
+    {261, 1, 5, 2669},
+    {44, 6, 2, 0},
+    {25, 15, 3, 1},
+    {9, 11, 0, 2685},
+    {17, 4, 0, 2682},
+    {1, 16, 0, 2678},
+    {5, 2, 2, 0},
+    {-21, 8, 2, 0},
+    {2, 11, 1, 2677},
+    {4, 2, 3, 1},
+    {36, 18, 2, 0},
+    {152, 0, 1, 2680},
+    {329, 14, 5, 2681},
+    {288, 2, 3, 1},
+    {4, 8, 1, 2683},
+    {14, 15, 1, 2684},
+    {6059, 14, 7, 0},
+    {155, 0, 0, 2699},
+    {17299, 1, 2, 1},
+    {87, 18, 2, 0},
+    {1181, 16, 0, 2698},
+    {80, 14, 0, 2691},
+    {44, 10, 3, 1},
+    {36, 19, 0, 2695},
+    {11, 8, 1, 2693},
+    {163, 10, 2, 0},
+    {230, 2, 3, 1},
+    {35, 18, 5, 2696},
+    {11, 5, 1, 2697},
+    {914, 2, 3, 1},
+    {20, 7, 3, 1},
+    {30, 7, 0, 2717},
+    {1290, 14, 0, 2713},
+    {66, 18, 2, 0},
+    {29, 9, 1, 2703},
+    {582, 10, 0, 2711},
+    {49, 17, 1, 2705},
+    {227, 14, 0, 2708},
+    {2, 4, 2, 1},
+    {23, 13, 7, 0},
+    {67, 9, 2, 1},
+    {120, 2, 2, 0},
+    {13, 7, 3, 1},
+    {38, 1, 1, 2712},
+    {11, 4, 7, 0},
+    {27, 8, 2, 1},
+    {-121, 19, 2, 0},
+    {46, 18, 2, 0},
+    {8, 4, 3, 1},
+    {1905, 10, 2, 0},
+    {366, 0, 2, 0},
+    {12, 4, 2, 1},
+    {819, 10, 7, 0},
+    {245, 1, 0, 2738},
+    {291, 2, 0, 2727},
+    {5, 15, 2, 1},
+    {-12, 16, 0, 2726},
+    {70, 18, 3, 1},
+    {3, 15, 3, 1},
+    {-70, 19, 0, 2731},
+    {602, 2, 1, 2729},
+    {36, 17, 2, 1},
+    {1058, 0, 3, 1},
+    {43, 5, 2, 1},
+    {60, 18, 0, 2735},
+    {5, 4, 2, 0},
+    {2, 4, 3, 1},
+    {12, 15, 1, 2736},
+    {1806, 2, 2, 0},
+    {206, 1, 3, 1},
+    {3054, 10, 0, 2749},
+    {5, 17, 5, 2740},
+    {27, 15, 0, 2748},
+    {91, 9, 2, 0},
+    {22, 5, 2, 1},
+    {564, 16, 2, 1},
+    {46, 19, 2, 1},
+    {1467, 14, 5, 2746},
+    {76, 9, 1, 2747},
+    {1534, 10, 7, 0},
+    {61, 3, 7, 0},
+    {7, 3, 1, 2750},
+    {45, 0, 2, 1},
+    {3654, 2, 7, 0},
+    {1, 16, 0, 2796},
+    {219, 19, 0, 2773},
+    {145, 2, 0, 2766},
+    {5, 4, 0, 2762},
+    {4, 7, 1, 2757},
+    {22, 7, 2, 1},
+    {24, 18, 5, 2759},
+    {9, 8, 1, 2760},
+    {38, 18, 5, 2761},
+    {117, 9, 3, 1},
+    {15, 7, 0, 2764},
+    {4, 5, 3, 1},
+    {52, 13, 2, 0},
+    {6, 10, 3, 1},
+    {821, 1, 0, 2770},
+    {34, 13, 1, 2768},
+    {35, 13, 2, 0},
+    {161, 10, 7, 0},
+    {93, 19, 1, 2771},
+    {4164, 14, 5, 2772},
+    {53, 4, 3, 1},
+    {-2, 16, 0, 2784},
+    {1805, 0, 2, 1},
+    {5, 4, 0, 2779},
+    {1, 9, 2, 0},
+    {38, 2, 1, 2778},
+    {324, 10, 7, 0},
+    {17, 7, 2, 0},
+    {100, 10, 5, 2781},
+    {10, 5, 2, 1},
+    {-3, 5, 2, 0},
+    {31, 13, 3, 1},
+    {328, 0, 0, 2786},
+    {300, 10, 7, 0},
+    {4, 5, 0, 2791},
+    {83, 3, 2, 1},
+    {797, 19, 1, 2789},
+    {56, 9, 2, 0},
+    {119, 17, 7, 0},
+    {132, 2, 2, 1},
+    {11, 7, 0, 2794},
+    {120, 18, 7, 0},
+    {8, 5, 1, 2795},
+    {79, 2, 7, 0},
+    {33, 17, 0, 2848},
+    {10, 5, 0, 2810},
+    {239, 14, 0, 2803},
+    {10, 8, 1, 2800},
+    {103, 6, 2, 0},
+    {12, 8, 2, 1},
+    {103, 10, 7, 0},
+    {3281, 16, 2, 1},
+    {10, 9, 5, 2805},
+    {1317, 19, 2, 1},
+    {83, 18, 2, 0},
+    {304, 2, 2, 0},
+    {252, 2, 1, 2809},
+    {14, 13, 3, 1},
+    {28, 8, 0, 2828},
+    {58, 18, 0, 2817},
+    {343, 2, 5, 2813},
+    {33, 6, 5, 2814},
+    {12, 7, 5, 2815},
+    {812, 0, 1, 2816},
+    {1202, 14, 7, 0},
+    {17, 17, 0, 2823},
+    {505, 19, 2, 1},
+    {92, 19, 1, 2820},
+    {30, 16, 1, 2821},
+    {41, 6, 5, 2822},
+    {13, 7, 7, 0},
+    {199, 10, 5, 2824},
+    {3354, 10, 2, 1},
+    {93, 19, 1, 2826},
+    {92, 18, 2, 0},
+    {3234, 14, 7, 0},
+    {124, 16, 0, 2838},
+    {26, 7, 0, 2834},
+    {119, 9, 2, 0},
+    {12, 5, 1, 2832},
+    {620, 10, 5, 2833},
+    {789, 10, 3, 1},
+    {107, 18, 1, 2835},
+    {2082, 14, 2, 0},
+    {26, 16, 2, 1},
+    {665, 14, 7, 0},
+    {40, 8, 0, 2846},
+    {58, 3, 2, 0},
+    {32, 5, 2, 0},
+    {19, 17, 5, 2842},
+    {42, 13, 2, 1},
+    {75, 18, 5, 2844},
+    {863, 10, 5, 2845},
+    {4864, 14, 3, 1},
+    {86, 18, 2, 1},
+    {11, 15, 3, 1},
+    {29, 9, 0, 2886},
+    {27, 3, 0, 2862},
+    {102, 16, 0, 2856},
+    {14, 8, 0, 2855},
+    {2, 15, 2, 0},
+    {12, 8, 1, 2854},
+    {17, 13, 7, 0},
+    {897, 2, 7, 0},
+    {165, 16, 0, 2858},
+    {4, 12, 7, 0},
+    {42, 18, 5, 2859},
+    {1728, 19, 2, 1},
+    {26, 9, 1, 2861},
+    {3799, 14, 3, 1},
+    {25, 7, 0, 2879},
+    {97, 19, 0, 2868},
+    {68, 18, 2, 1},
+    {106, 0, 2, 0},
+    {1205, 14, 5, 2867},
+    {16, 4, 3, 1},
+    {17, 8, 0, 2874},
+    {22, 7, 2, 1},
+    {362, 0, 0, 2872},
+    {12, 13, 3, 1},
+    {27, 13, 2, 0},
+    {23, 13, 3, 1},
+    {4411, 2, 2, 0},
+    {69, 17, 0, 2877},
+    {13, 15, 3, 1},
+    {7, 2, 2, 1},
+    {4, 2, 7, 0},
+    {12, 9, 0, 2882},
+    {312, 19, 1, 2881},
+    {533, 14, 3, 1},
+    {16, 5, 0, 2885},
+    {121, 18, 1, 2884},
+    {27, 7, 7, 0},
+    {70, 17, 3, 1},
+    {6, 5, 0, 2913},
+    {3, 12, 0, 2895},
+    {62, 6, 0, 2893},
+    {7, 8, 0, 2891},
+    {34, 6, 7, 0},
+    {52, 18, 5, 2892},
+    {3, 15, 7, 0},
+    {18, 16, 1, 2894},
+    {341, 14, 7, 0},
+    {34, 7, 2, 1},
+    {7, 8, 0, 2899},
+    {38, 18, 2, 0},
+    {74, 17, 7, 0},
+    {66, 17, 0, 2906},
+    {1438, 14, 2, 0},
+    {83, 1, 0, 2903},
+    {171, 10, 7, 0},
+    {7, 15, 1, 2904},
+    {422, 10, 2, 1},
+    {950, 2, 3, 1},
+    {498, 10, 0, 2909},
+    {46, 9, 5, 2908},
+    {15, 8, 3, 1},
+    {20, 7, 1, 2910},
+    {28, 15, 2, 1},
+    {2822, 14, 2, 0},
+    {1123, 2, 3, 1},
+    {25, 8, 0, 2937},
+    {594, 14, 5, 2915},
+    {31, 13, 0, 2923},
+    {375, 10, 0, 2921},
+    {84, 19, 0, 2919},
+    {292, 0, 3, 1},
+    {371, 10, 5, 2920},
+    {450, 2, 7, 0},
+    {13, 8, 2, 1},
+    {70, 18, 7, 0},
+    {9, 5, 0, 2927},
+    {90, 6, 2, 0},
+    {18, 7, 1, 2926},
+    {28, 15, 7, 0},
+    {39, 17, 0, 2930},
+    {40, 13, 2, 0},
+    {506, 10, 3, 1},
+    {180, 16, 0, 2935},
+    {84, 18, 5, 2932},
+    {678, 10, 5, 2933},
+    {131, 18, 1, 2934},
+    {813, 2, 3, 1},
+    {92, 19, 2, 1},
+    {16, 8, 3, 1},
+    {55, 19, 0, 2939},
+    {1339, 2, 7, 0},
+    {12, 5, 0, 2948},
+    {64, 17, 0, 2945},
+    {2363, 14, 0, 2944},
+    {47, 1, 2, 1},
+    {64, 9, 3, 1},
+    {95, 19, 7, 0},
+    {30, 9, 1, 2946},
+    {54, 13, 5, 2947},
+    {9, 4, 3, 1},
+    {38, 8, 0, 2960},
+    {21, 3, 0, 2953},
+    {41, 13, 5, 2951},
+    {77, 19, 2, 1},
+    {56, 18, 3, 1},
+    {52, 9, 5, 2954},
+    {113, 18, 0, 2958},
+    {86, 18, 2, 1},
+    {76, 9, 2, 1},
+    {19, 15, 3, 1},
+    {1058, 14, 5, 2959},
+    {33, 7, 3, 1},
+    {48, 18, 0, 2962},
+    {4, 4, 3, 1},
+    {9291, 2, 5, 2963},
+    {32, 7, 3, 1},
+    // SCDetectB
+    {56, 19, 0, 3072},
+    {27, 13, 0, 3016},
+    {9, 8, 0, 2997},
+    {3, 8, 0, 2989},
+    {87, 14, 0, 2980},
+    {4, 3, 0, 2975},
+    {-2, 5, 2, 0},
+    {1, 3, 1, 2972},
+    {25, 18, 2, 0},
+    {-3, 5, 1, 2974},
+    {2, 10, 3, 1},
+    {35, 1, 2, 1},
+    {226, 6, 2, 1},
+    {4, 0, 2, 0},
+    {3, 0, 1, 2979},
+    {5, 14, 7, 0},
+    {5, 16, 0, 2983},
+    {6, 5, 1, 2982},
+    {68, 10, 7, 0},
+    {2, 13, 0, 2985},
+    {20, 6, 7, 0},
+    {9, 17, 2, 0},
+    {33, 4, 2, 1},
+    {525, 2, 2, 0},
+    {414, 2, 3, 1},
+    {9, 9, 0, 2992},
+    {31, 18, 2, 0},
+    {6, 15, 3, 1},
+    {17, 17, 2, 0},
+    {44, 15, 0, 2996},
+    {379, 0, 1, 2995},
+    {117, 2, 3, 1},
+    {2386, 10, 3, 1},
+    {43, 6, 0, 3007},
+    {162, 14, 0, 3000},
+    {1, 4, 3, 1},
+    {15, 4, 2, 1},
+    {-459, 16, 5, 3002},
+    {44, 18, 2, 0},
+    {9, 11, 1, 3004},
+    {1, 17, 5, 3005},
+    {110, 1, 1, 3006},
+    {11, 15, 7, 0},
+    {48, 19, 0, 3014},
+    {20, 5, 2, 1},
+    {7, 3, 1, 3010},
+    {192, 10, 2, 0},
+    {2389, 2, 2, 1},
+    {3, 5, 2, 0},
+    {56, 18, 7, 0},
+    {6361, 14, 2, 1},
+    {148, 16, 3, 1},
+    {56, 16, 0, 3038},
+    {58, 13, 0, 3033},
+    {20, 5, 0, 3029},
+    {-7, 8, 0, 3027},
+    {103, 15, 2, 1},
+    {56, 6, 0, 3024},
+    {39, 9, 1, 3023},
+    {794, 2, 7, 0},
+    {48, 13, 1, 3025},
+    {37, 3, 1, 3026},
+    {11, 15, 3, 1},
+    {115, 2, 2, 0},
+    {114, 2, 3, 1},
+    {66, 18, 0, 3031},
+    {40, 13, 7, 0},
+    {3, 4, 2, 0},
+    {224, 10, 3, 1},
+    {12, 4, 0, 3036},
+    {21, 16, 1, 3035},
+    {24, 7, 3, 1},
+    {105, 18, 5, 3037},
+    {1778, 2, 7, 0},
+    {69, 6, 0, 3055},
+    {30, 7, 0, 3053},
+    {1428, 14, 0, 3043},
+    {6, 15, 1, 3042},
+    {158, 1, 7, 0},
+    {49, 19, 0, 3052},
+    {19722, 16, 2, 1},
+    {257, 16, 2, 0},
+    {2249, 14, 0, 3050},
+    {52, 9, 1, 3048},
+    {962, 2, 2, 1},
+    {508, 0, 3, 1},
+    {-5, 8, 2, 0},
+    {23, 15, 7, 0},
+    {1453, 2, 3, 1},
+    {35, 19, 2, 0},
+    {16, 6, 3, 1},
+    {7, 3, 0, 3058},
+    {120, 0, 1, 3057},
+    {8, 5, 3, 1},
+    {49, 13, 0, 3067},
+    {11, 5, 0, 3063},
+    {924, 16, 1, 3061},
+    {6789, 14, 2, 0},
+    {28, 4, 7, 0},
+    {86, 6, 0, 3065},
+    {3622, 10, 7, 0},
+    {106, 17, 1, 3066},
+    {970, 2, 7, 0},
+    {2266, 14, 1, 3068},
+    {30, 15, 2, 1},
+    {54, 13, 1, 3070},
+    {23, 15, 2, 0},
+    {144, 16, 3, 1},
+    {7, 4, 0, 3181},
+    {129, 19, 0, 3108},
+    {8, 8, 0, 3081},
+    {1, 5, 1, 3076},
+    {12, 16, 1, 3077},
+    {15, 1, 5, 3078},
+    {267, 0, 1, 3079},
+    {300, 0, 5, 3080},
+    {5, 3, 7, 0},
+    {126, 0, 0, 3095},
+    {54, 18, 0, 3088},
+    {202, 10, 5, 3084},
+    {52, 9, 0, 3086},
+    {203, 2, 3, 1},
+    {46, 16, 2, 0},
+    {416, 2, 3, 1},
+    {25, 8, 0, 3093},
+    {10, 15, 0, 3092},
+    {53, 9, 2, 0},
+    {22, 13, 3, 1},
+    {18, 7, 7, 0},
+    {41, 1, 2, 1},
+    {80, 0, 3, 1},
+    {9, 3, 0, 3100},
+    {10, 8, 1, 3097},
+    {96, 19, 0, 3099},
+    {5, 4, 3, 1},
+    {30, 8, 7, 0},
+    {25, 16, 0, 3105},
+    {-1, 5, 0, 3103},
+    {4, 4, 3, 1},
+    {13, 9, 2, 0},
+    {65, 19, 7, 0},
+    {5, 4, 2, 0},
+    {29, 17, 1, 3107},
+    {30, 7, 7, 0},
+    {12, 8, 0, 3135},
+    {2, 12, 0, 3128},
+    {7, 8, 0, 3120},
+    {-38, 5, 5, 3112},
+    {-1, 8, 0, 3115},
+    {6, 1, 1, 3114},
+    {125, 3, 3, 1},
+    {47, 1, 2, 1},
+    {22, 14, 2, 0},
+    {19, 14, 2, 1},
+    {126, 17, 1, 3119},
+    {8, 13, 3, 1},
+    {15, 13, 0, 3124},
+    {8, 13, 1, 3122},
+    {102, 14, 2, 1},
+    {22, 10, 7, 0},
+    {29, 10, 1, 3125},
+    {41, 9, 0, 3127},
+    {38, 1, 3, 1},
+    {13, 7, 7, 0},
+    {50, 18, 2, 0},
+    {13, 13, 1, 3130},
+    {190, 0, 5, 3131},
+    {4, 5, 0, 3134},
+    {47, 16, 1, 3133},
+    {89, 1, 7, 0},
+    {570, 0, 7, 0},
+    {43, 17, 0, 3162},
+    {689, 10, 0, 3159},
+    {9, 5, 0, 3141},
+    {84, 6, 2, 0},
+    {12, 7, 2, 0},
+    {540, 2, 7, 0},
+    {47, 18, 5, 3142},
+    {21, 17, 0, 3154},
+    {104, 9, 0, 3145},
+    {1737, 14, 3, 1},
+    {3, 16, 0, 3148},
+    {6, 17, 1, 3147},
+    {1, 15, 7, 0},
+    {105, 18, 0, 3152},
+    {583, 0, 2, 1},
+    {14, 17, 2, 1},
+    {247, 10, 7, 0},
+    {163, 3, 5, 3153},
+    {1, 2, 7, 0},
+    {100, 18, 2, 1},
+    {615, 2, 5, 3156},
+    {31, 17, 1, 3157},
+    {477, 0, 5, 3158},
+    {615, 10, 3, 1},
+    {1362, 2, 1, 3160},
+    {825, 10, 5, 3161},
+    {9, 15, 7, 0},
+    {474, 0, 0, 3169},
+    {211, 19, 2, 1},
+    {9, 5, 0, 3167},
+    {66, 6, 2, 0},
+    {1047, 14, 7, 0},
+    {283, 0, 5, 3168},
+    {468, 2, 7, 0},
+    {64, 6, 5, 3170},
+    {683, 19, 0, 3176},
+    {82, 2, 1, 3172},
+    {39, 13, 5, 3173},
+    {95, 18, 1, 3174},
+    {100, 18, 5, 3175},
+    {113, 18, 3, 1},
+    {118, 17, 2, 1},
+    {5, 4, 2, 1},
+    {-1, 5, 1, 3179},
+    {24, 7, 2, 0},
+    {28, 13, 3, 1},
+    {15, 8, 0, 3208},
+    {2038, 14, 0, 3201},
+    {7, 8, 0, 3192},
+    {46, 6, 0, 3186},
+    {1285, 14, 7, 0},
+    {27, 13, 1, 3187},
+    {28, 13, 5, 3188},
+    {168, 19, 2, 0},
+    {-82, 16, 5, 3190},
+    {42, 18, 5, 3191},
+    {46, 13, 3, 1},
+    {2, 3, 5, 3193},
+    {44, 17, 0, 3196},
+    {8, 5, 1, 3195},
+    {95, 1, 3, 1},
+    {47, 3, 2, 0},
+    {72, 17, 5, 3198},
+    {118, 6, 2, 0},
+    {216, 0, 2, 1},
+    {12, 7, 7, 0},
+    {39, 18, 0, 3203},
+    {13, 7, 7, 0},
+    {2023, 2, 2, 0},
+    {22, 7, 1, 3205},
+    {77, 17, 1, 3206},
+    {118, 16, 2, 1},
+    {3117, 14, 3, 1},
+    {30, 8, 0, 3244},
+    {69, 18, 0, 3219},
+    {34, 13, 0, 3213},
+    {22, 13, 2, 1},
+    {14, 5, 7, 0},
+    {606, 2, 5, 3214},
+    {773, 2, 0, 3216},
+    {10, 4, 7, 0},
+    {15, 7, 1, 3217},
+    {92, 6, 5, 3218},
+    {4527, 14, 7, 0},
+    {24, 17, 0, 3227},
+    {208, 16, 1, 3221},
+    {144, 0, 0, 3225},
+    {42, 6, 2, 0},
+    {1058, 2, 5, 3224},
+    {2960, 2, 3, 1},
+    {18, 15, 5, 3226},
+    {6511, 14, 3, 1},
+    {10, 5, 0, 3236},
+    {21, 8, 0, 3231},
+    {73, 18, 2, 0},
+    {2204, 14, 7, 0},
+    {107, 19, 1, 3232},
+    {101, 6, 5, 3233},
+    {34, 13, 5, 3234},
+    {23, 8, 1, 3235},
+    {8, 5, 7, 0},
+    {57, 3, 0, 3243},
+    {40, 9, 0, 3239},
+    {33, 9, 7, 0},
+    {14, 4, 2, 1},
+    {37, 17, 2, 1},
+    {15, 5, 2, 1},
+    {87, 18, 7, 0},
+    {2, 9, 7, 0},
+    {46, 6, 0, 3252},
+    {36, 3, 5, 3246},
+    {1262, 1, 2, 1},
+    {44, 6, 2, 0},
+    {123, 9, 2, 0},
+    {71, 13, 2, 0},
+    {159, 0, 2, 1},
+    {1432, 10, 7, 0},
+    {13, 4, 0, 3261},
+    {-1, 16, 1, 3254},
+    {81, 9, 5, 3255},
+    {785, 2, 5, 3256},
+    {12, 4, 0, 3259},
+    {74, 6, 5, 3258},
+    {21, 5, 7, 0},
+    {401, 1, 2, 0},
+    {813, 2, 3, 1},
+    {84, 3, 2, 0},
+    {43, 17, 2, 1},
+    {42, 17, 0, 3266},
+    {61, 13, 5, 3265},
+    {46, 8, 3, 1},
+    {53, 13, 7, 0},
+    // SCDetectC
+    {58, 19, 0, 3372},
+    {8, 5, 0, 3323},
+    {140, 0, 0, 3288},
+    {24, 7, 0, 3286},
+    {14, 9, 0, 3283},
+    {252, 1, 0, 3280},
+    {18, 18, 0, 3278},
+    {7, 16, 2, 1},
+    {1, 17, 1, 3276},
+    {646, 10, 2, 0},
+    {629, 10, 3, 1},
+    {229, 6, 1, 3279},
+    {5, 3, 3, 1},
+    {74, 6, 0, 3282},
+    {30, 15, 7, 0},
+    {2394, 1, 3, 1},
+    {128, 9, 2, 1},
+    {45, 15, 1, 3285},
+    {6, 7, 7, 0},
+    {99, 6, 2, 0},
+    {86, 9, 7, 0},
+    {-4, 16, 0, 3297},
+    {5, 3, 1, 3290},
+    {-6, 5, 1, 3291},
+    {24, 18, 5, 3292},
+    {29, 6, 5, 3293},
+    {14, 7, 1, 3294},
+    {116, 2, 5, 3295},
+    {-5, 5, 2, 0},
+    {2729, 14, 7, 0},
+    {62, 13, 0, 3320},
+    {66, 17, 0, 3310},
+    {62, 18, 2, 0},
+    {481, 10, 0, 3306},
+    {-21, 8, 0, 3304},
+    {1, 3, 1, 3303},
+    {11, 14, 7, 0},
+    {64, 17, 1, 3305},
+    {33, 6, 7, 0},
+    {333, 0, 0, 3309},
+    {244, 16, 1, 3308},
+    {963, 10, 3, 1},
+    {1184, 14, 7, 0},
+    {53, 18, 0, 3316},
+    {2, 1, 1, 3312},
+    {2, 5, 0, 3315},
+    {71, 17, 2, 0},
+    {6, 3, 3, 1},
+    {1, 16, 3, 1},
+    {78, 18, 2, 0},
+    {119, 17, 2, 1},
+    {74, 18, 1, 3319},
+    {58, 15, 3, 1},
+    {67, 13, 2, 0},
+    {1778, 2, 5, 3322},
+    {34, 7, 3, 1},
+    {13, 5, 0, 3347},
+    {79, 6, 0, 3341},
+    {15, 8, 0, 3333},
+    {52, 19, 0, 3332},
+    {37, 4, 2, 1},
+    {23, 15, 0, 3331},
+    {32, 6, 2, 0},
+    {68, 1, 3, 1},
+    {1718, 10, 7, 0},
+    {1528, 10, 7, 0},
+    {2, 3, 1, 3334},
+    {574, 2, 0, 3338},
+    {10, 5, 2, 0},
+    {4, 15, 2, 0},
+    {813, 14, 7, 0},
+    {28, 13, 0, 3340},
+    {259, 1, 3, 1},
+    {2553, 2, 7, 0},
+    {-28, 19, 0, 3345},
+    {20, 7, 2, 0},
+    {25, 1, 1, 3344},
+    {111, 18, 7, 0},
+    {1999, 14, 2, 0},
+    {1909, 14, 3, 1},
+    {28, 5, 0, 3367},
+    {583, 1, 0, 3361},
+    {30, 17, 0, 3352},
+    {5, 8, 2, 0},
+    {1156, 2, 7, 0},
+    {103, 6, 0, 3358},
+    {54, 18, 1, 3354},
+    {2, 4, 1, 3355},
+    {485, 1, 2, 0},
+    {47, 0, 2, 1},
+    {24, 19, 3, 1},
+    {55, 18, 5, 3359},
+    {58, 13, 1, 3360},
+    {13, 15, 3, 1},
+    {25, 4, 0, 3365},
+    {344, 16, 1, 3363},
+    {105, 18, 5, 3364},
+    {134, 18, 3, 1},
+    {11, 3, 1, 3366},
+    {53, 3, 7, 0},
+    {36, 0, 5, 3368},
+    {57, 7, 2, 1},
+    {-97, 19, 0, 3371},
+    {683, 10, 3, 1},
+    {186, 15, 3, 1},
+    {8, 4, 0, 3486},
+    {8, 11, 0, 3391},
+    {41, 18, 0, 3389},
+    {2, 5, 0, 3382},
+    {20, 3, 2, 1},
+    {5, 11, 1, 3378},
+    {73, 17, 2, 0},
+    {16, 3, 2, 1},
+    {29, 14, 2, 0},
+    {11, 14, 3, 1},
+    {8, 8, 0, 3385},
+    {36, 10, 1, 3384},
+    {2, 4, 7, 0},
+    {162, 10, 0, 3388},
+    {5, 7, 2, 1},
+    {1, 15, 7, 0},
+    {2, 3, 3, 1},
+    {30, 6, 5, 3390},
+    {3438, 0, 3, 1},
+    {10, 8, 0, 3408},
+    {40, 18, 0, 3400},
+    {24, 18, 5, 3394},
+    {7, 15, 0, 3398},
+    {8, 8, 2, 1},
+    {1169, 0, 1, 3397},
+    {1, 4, 3, 1},
+    {32, 18, 1, 3399},
+    {1554, 14, 7, 0},
+    {1, 17, 0, 3402},
+    {228, 18, 3, 1},
+    {5, 5, 0, 3406},
+    {95, 9, 1, 3404},
+    {171, 0, 2, 0},
+    {334, 2, 7, 0},
+    {7, 3, 2, 0},
+    {76, 6, 7, 0},
+    {34, 17, 0, 3444},
+    {23, 8, 0, 3427},
+    {23, 13, 0, 3420},
+    {819, 14, 0, 3418},
+    {83, 10, 5, 3413},
+    {27, 3, 2, 1},
+    {106, 19, 1, 3415},
+    {20, 13, 2, 1},
+    {3, 4, 2, 1},
+    {8, 7, 7, 0},
+    {545, 10, 2, 0},
+    {43, 18, 7, 0},
+    {28, 3, 2, 0},
+    {831, 19, 0, 3425},
+    {13, 5, 1, 3423},
+    {73, 18, 1, 3424},
+    {22, 17, 3, 1},
+    {20, 3, 5, 3426},
+    {20, 7, 7, 0},
+    {4, 4, 0, 3436},
+    {32, 7, 0, 3434},
+    {33, 8, 2, 1},
+    {21, 3, 5, 3431},
+    {16, 16, 1, 3432},
+    {454, 2, 2, 0},
+    {111, 6, 7, 0},
+    {959, 0, 1, 3435},
+    {11, 1, 3, 1},
+    {14, 15, 2, 1},
+    {1015, 14, 5, 3438},
+    {5, 15, 1, 3439},
+    {1017, 10, 2, 0},
+    {87, 19, 1, 3441},
+    {1495, 2, 5, 3442},
+    {59, 13, 2, 0},
+    {174, 0, 7, 0},
+    {24, 8, 0, 3474},
+    {84, 18, 0, 3471},
+    {49, 6, 0, 3451},
+    {5, 4, 0, 3449},
+    {11, 13, 3, 1},
+    {413, 2, 2, 1},
+    {47, 18, 3, 1},
+    {15, 8, 0, 3464},
+    {29, 2, 5, 3453},
+    {347, 2, 0, 3458},
+    {9, 1, 2, 0},
+    {1, 15, 1, 3456},
+    {46, 10, 5, 3457},
+    {113, 2, 3, 1},
+    {11, 8, 1, 3459},
+    {60, 6, 1, 3460},
+    {1363, 2, 2, 0},
+    {7, 5, 2, 1},
+    {17, 1, 1, 3463},
+    {14, 7, 7, 0},
+    {3, 16, 0, 3467},
+    {433, 19, 2, 0},
+    {15, 1, 3, 1},
+    {66, 6, 5, 3468},
+    {5, 5, 1, 3469},
+    {26, 10, 1, 3470},
+    {592, 0, 7, 0},
+    {9, 5, 1, 3472},
+    {19, 7, 2, 0},
+    {12, 8, 3, 1},
+    {49, 17, 0, 3480},
+    {90, 19, 0, 3477},
+    {328, 10, 3, 1},
+    {45, 17, 5, 3478},
+    {-10, 16, 1, 3479},
+    {2436, 14, 7, 0},
+    {21, 7, 5, 3481},
+    {22, 1, 0, 3484},
+    {87, 18, 2, 0},
+    {44, 18, 3, 1},
+    {62, 18, 2, 1},
+    {1147, 2, 7, 0},
+    {74, 16, 0, 3497},
+    {100, 19, 1, 3488},
+    {1080, 14, 0, 3494},
+    {117, 17, 2, 1},
+    {723, 10, 2, 1},
+    {300, 0, 2, 0},
+    {409, 2, 2, 1},
+    {15, 4, 3, 1},
+    {4, 5, 1, 3495},
+    {19, 4, 1, 3496},
+    {116, 18, 7, 0},
+    {22, 8, 0, 3520},
+    {1997, 14, 0, 3508},
+    {89, 9, 0, 3506},
+    {72, 18, 0, 3504},
+    {10, 4, 2, 1},
+    {41, 6, 2, 1},
+    {1644, 14, 3, 1},
+    {19, 15, 1, 3505},
+    {273, 10, 3, 1},
+    {18, 7, 2, 0},
+    {771, 14, 7, 0},
+    {36, 18, 5, 3509},
+    {13, 8, 0, 3512},
+    {27, 3, 1, 3511},
+    {817, 1, 3, 1},
+    {36, 3, 0, 3519},
+    {107, 18, 2, 0},
+    {7, 5, 1, 3515},
+    {11, 3, 5, 3516},
+    {30, 15, 2, 1},
+    {1053, 2, 5, 3518},
+    {46, 18, 7, 0},
+    {2215, 2, 7, 0},
+    {27, 17, 0, 3531},
+    {1211, 10, 0, 3525},
+    {12, 7, 1, 3523},
+    {5, 17, 2, 1},
+    {9, 4, 3, 1},
+    {19, 4, 0, 3530},
+    {105, 9, 1, 3527},
+    {9, 15, 1, 3528},
+    {5, 17, 2, 1},
+    {52, 3, 7, 0},
+    {26, 17, 7, 0},
+    {790, 10, 5, 3532},
+    {16, 5, 0, 3540},
+    {13, 3, 0, 3536},
+    {66, 19, 2, 1},
+    {1116, 2, 3, 1},
+    {775, 2, 0, 3538},
+    {4, 15, 7, 0},
+    {3280, 14, 5, 3539},
+    {17, 4, 3, 1},
+    {40, 7, 0, 3543},
+    {46, 18, 2, 1},
+    {127, 6, 7, 0},
+    {39, 8, 2, 1},
+    {5764, 10, 3, 1},
+    // SCDetectD
+    {60, 19, 0, 3648},
+    {6, 3, 0, 3579},
+    {314, 16, 0, 3571},
+    {120, 0, 0, 3557},
+    {2, 17, 0, 3554},
+    {18, 6, 2, 0},
+    {7, 1, 1, 3552},
+    {4, 4, 2, 1},
+    {653, 2, 7, 0},
+    {17, 8, 1, 3555},
+    {19, 13, 2, 0},
+    {13, 7, 3, 1},
+    {6, 5, 0, 3566},
+    {4, 3, 0, 3561},
+    {17, 16, 1, 3560},
+    {25, 1, 7, 0},
+    {61, 2, 0, 3563},
+    {2, 16, 3, 1},
+    {54, 19, 1, 3564},
+    {27, 13, 1, 3565},
+    {123, 1, 7, 0},
+    {13, 8, 0, 3569},
+    {2, 8, 2, 0},
+    {6, 15, 7, 0},
+    {186, 0, 5, 3570},
+    {13, 7, 7, 0},
+    {37, 18, 5, 3572},
+    {41, 4, 0, 3577},
+    {14, 5, 0, 3576},
+    {3349, 14, 2, 0},
+    {20, 15, 3, 1},
+    {2020, 10, 7, 0},
+    {6, 7, 5, 3578},
+    {24936, 14, 3, 1},
+    {199, 16, 0, 3625},
+    {14, 8, 0, 3607},
+    {231, 0, 0, 3586},
+    {1, 9, 0, 3584},
+    {217, 18, 3, 1},
+    {15690, 1, 1, 3585},
+    {1541, 2, 3, 1},
+    {27, 7, 0, 3600},
+    {6, 13, 0, 3589},
+    {2, 13, 3, 1},
+    {12, 16, 0, 3594},
+    {56, 10, 2, 0},
+    {32, 13, 1, 3592},
+    {18, 10, 1, 3593},
+    {104, 18, 7, 0},
+    {21, 9, 0, 3596},
+    {4, 12, 3, 1},
+    {40, 18, 5, 3597},
+    {13, 7, 2, 0},
+    {26, 16, 2, 0},
+    {413, 2, 3, 1},
+    {232, 0, 5, 3601},
+    {-215, 19, 5, 3602},
+    {62, 13, 0, 3605},
+    {12, 1, 2, 0},
+    {51, 3, 3, 1},
+    {63, 9, 5, 3606},
+    {1778, 2, 7, 0},
+    {95, 9, 0, 3624},
+    {1526, 2, 2, 0},
+    {133, 14, 5, 3610},
+    {12, 15, 0, 3622},
+    {228, 6, 2, 1},
+    {56, 19, 0, 3621},
+    {73, 6, 0, 3619},
+    {16, 1, 1, 3615},
+    {7, 3, 5, 3616},
+    {16, 5, 1, 3617},
+    {918, 14, 5, 3618},
+    {56, 13, 3, 1},
+    {2, 4, 2, 0},
+    {100, 18, 7, 0},
+    {179, 10, 3, 1},
+    {22, 8, 5, 3623},
+    {99, 18, 3, 1},
+    {1179, 0, 3, 1},
+    {12, 5, 0, 3636},
+    {25, 7, 0, 3632},
+    {77, 10, 5, 3628},
+    {44, 18, 0, 3630},
+    {10, 7, 7, 0},
+    {2258, 14, 2, 0},
+    {207, 0, 3, 1},
+    {-2, 5, 5, 3633},
+    {36, 13, 5, 3634},
+    {443, 1, 2, 0},
+    {48, 13, 3, 1},
+    {43, 5, 2, 1},
+    {576, 10, 0, 3640},
+    {61, 18, 2, 1},
+    {13, 13, 3, 1},
+    {5301, 1, 2, 1},
+    {262, 0, 0, 3647},
+    {104, 18, 0, 3645},
+    {120, 0, 2, 0},
+    {13, 5, 3, 1},
+    {185, 6, 2, 1},
+    {10, 4, 7, 0},
+    {35, 19, 7, 0},
+    {16, 7, 0, 3740},
+    {87, 18, 0, 3729},
+    {6, 11, 0, 3661},
+    {126, 19, 0, 3655},
+    {60, 17, 1, 3653},
+    {99, 19, 1, 3654},
+    {29, 6, 7, 0},
+    {1, 5, 0, 3658},
+    {9, 15, 2, 1},
+    {1621, 0, 3, 1},
+    {131, 10, 2, 0},
+    {1, 15, 2, 0},
+    {1, 3, 3, 1},
+    {1, 16, 0, 3679},
+    {40, 18, 0, 3670},
+    {6, 8, 0, 3667},
+    {-32, 5, 5, 3665},
+    {379, 2, 1, 3666},
+    {80, 17, 7, 0},
+    {1, 1, 5, 3668},
+    {3, 4, 1, 3669},
+    {241, 0, 3, 1},
+    {5, 5, 0, 3674},
+    {85, 2, 2, 0},
+    {3, 4, 1, 3673},
+    {14, 3, 7, 0},
+    {172, 10, 2, 0},
+    {128, 19, 1, 3676},
+    {25, 13, 2, 1},
+    {1, 15, 2, 0},
+    {154, 14, 7, 0},
+    {4, 5, 0, 3700},
+    {128, 10, 0, 3687},
+    {37, 18, 5, 3682},
+    {135, 2, 0, 3685},
+    {209, 19, 1, 3684},
+    {118, 10, 7, 0},
+    {7, 7, 2, 0},
+    {440, 14, 3, 1},
+    {39, 6, 0, 3690},
+    {1160, 2, 2, 1},
+    {29, 18, 7, 0},
+    {11, 8, 0, 3696},
+    {69, 6, 1, 3692},
+    {21, 13, 2, 0},
+    {262, 2, 2, 0},
+    {191, 10, 5, 3695},
+    {72, 18, 3, 1},
+    {245, 10, 5, 3697},
+    {269, 16, 2, 1},
+    {40, 18, 2, 0},
+    {10, 7, 3, 1},
+    {25, 17, 0, 3705},
+    {28, 6, 5, 3702},
+    {128, 2, 0, 3704},
+    {4, 16, 3, 1},
+    {13, 4, 3, 1},
+    {354, 14, 0, 3710},
+    {11, 9, 2, 1},
+    {22, 3, 1, 3708},
+    {28, 13, 5, 3709},
+    {6, 4, 3, 1},
+    {97, 16, 0, 3724},
+    {103, 1, 2, 0},
+    {11, 3, 0, 3721},
+    {8, 5, 0, 3720},
+    {95, 0, 1, 3715},
+    {57, 6, 0, 3719},
+    {8, 7, 2, 1},
+    {55, 17, 5, 3718},
+    {2, 15, 7, 0},
+    {1058, 14, 3, 1},
+    {64, 19, 3, 1},
+    {14, 8, 0, 3723},
+    {24, 16, 3, 1},
+    {28, 17, 3, 1},
+    {74, 17, 5, 3725},
+    {12, 8, 1, 3726},
+    {1789, 14, 5, 3727},
+    {13, 4, 2, 1},
+    {1056, 10, 7, 0},
+    {81, 6, 0, 3734},
+    {390, 10, 2, 0},
+    {3, 15, 2, 1},
+    {9, 5, 1, 3733},
+    {45, 6, 3, 1},
+    {21, 8, 1, 3735},
+    {12, 5, 2, 1},
+    {36, 13, 2, 0},
+    {6, 3, 1, 3738},
+    {12, 15, 2, 1},
+    {138, 10, 3, 1},
+    {25, 8, 0, 3797},
+    {41, 17, 0, 3757},
+    {19, 8, 0, 3747},
+    {13, 5, 0, 3745},
+    {6, 10, 7, 0},
+    {17, 17, 2, 1},
+    {50, 18, 7, 0},
+    {65, 18, 0, 3750},
+    {38, 6, 2, 1},
+    {56, 18, 7, 0},
+    {1962, 14, 1, 3751},
+    {1223, 10, 0, 3754},
+    {13, 5, 2, 1},
+    {541, 10, 3, 1},
+    {127, 18, 1, 3755},
+    {173, 18, 2, 1},
+    {23, 8, 7, 0},
+    {81, 6, 0, 3772},
+    {107, 1, 0, 3765},
+    {65, 9, 0, 3763},
+    {17, 7, 5, 3761},
+    {7, 3, 5, 3762},
+    {712, 10, 3, 1},
+    {385, 2, 2, 0},
+    {39, 13, 7, 0},
+    {8, 9, 1, 3766},
+    {120, 10, 0, 3768},
+    {656, 14, 7, 0},
+    {7, 4, 0, 3770},
+    {330, 10, 7, 0},
+    {1345, 10, 5, 3771},
+    {17, 7, 3, 1},
+    {86, 3, 0, 3794},
+    {4, 4, 1, 3774},
+    {206, 16, 0, 3785},
+    {97, 18, 0, 3783},
+    {18, 8, 0, 3782},
+    {3, 15, 5, 3778},
+    {34, 7, 2, 1},
+    {6, 5, 1, 3780},
+    {429, 10, 2, 0},
+    {48, 2, 3, 1},
+    {151, 6, 7, 0},
+    {-4, 8, 2, 0},
+    {119, 18, 3, 1},
+    {17, 8, 0, 3789},
+    {21, 7, 1, 3787},
+    {2277, 2, 5, 3788},
+    {7652, 1, 3, 1},
+    {2212, 1, 0, 3793},
+    {88, 18, 2, 1},
+    {59, 18, 5, 3792},
+    {24, 3, 7, 0},
+    {3961, 1, 3, 1},
+    {129, 19, 1, 3795},
+    {2, 16, 2, 1},
+    {454, 14, 7, 0},
+    {243, 16, 0, 3829},
+    {3, 4, 0, 3804},
+    {28, 17, 0, 3802},
+    {22, 7, 2, 0},
+    {31, 8, 3, 1},
+    {39, 8, 5, 3803},
+    {91, 10, 3, 1},
+    {778, 10, 0, 3818},
+    {101, 19, 0, 3809},
+    {87, 6, 2, 0},
+    {75, 16, 2, 1},
+    {41, 13, 7, 0},
+    {69, 9, 0, 3812},
+    {42, 7, 5, 3811},
+    {61, 13, 3, 1},
+    {32, 7, 0, 3815},
+    {152, 6, 5, 3814},
+    {664, 14, 7, 0},
+    {6, 15, 0, 3817},
+    {108, 18, 3, 1},
+    {37, 7, 3, 1},
+    {2617, 14, 2, 0},
+    {793, 10, 0, 3821},
+    {79, 6, 3, 1},
+    {7, 4, 0, 3824},
+    {62, 16, 2, 0},
+    {47, 13, 3, 1},
+    {8, 4, 0, 3827},
+    {171, 19, 2, 1},
+    {808, 10, 7, 0},
+    {25, 17, 2, 1},
+    {243, 19, 3, 1},
+    {1675, 2, 5, 3830},
+    {27, 17, 0, 3836},
+    {2872, 2, 2, 1},
+    {1044, 16, 2, 1},
+    {2992, 14, 5, 3834},
+    {122, 18, 2, 0},
+    {26, 7, 3, 1},
+    {6847, 10, 0, 3842},
+    {441, 16, 0, 3839},
+    {22, 15, 7, 0},
+    {18, 7, 2, 1},
+    {57, 17, 5, 3841},
+    {70, 18, 7, 0},
+    {75, 0, 2, 1},
+    {57, 4, 7, 0},
+    // SCDetectE
+    {72, 16, 0, 4009},
+    {98, 0, 0, 3864},
+    {9, 8, 0, 3856},
+    {31, 3, 0, 3854},
+    {2, 9, 2, 0},
+    {7, 1, 1, 3850},
+    {2, 17, 2, 0},
+    {1030, 2, 2, 0},
+    {1435, 14, 5, 3853},
+    {4, 4, 3, 1},
+    {3, 13, 2, 0},
+    {122, 18, 3, 1},
+    {311, 10, 0, 3862},
+    {64, 19, 0, 3859},
+    {24, 6, 7, 0},
+    {90, 0, 2, 0},
+    {7, 3, 5, 3861},
+    {33, 13, 3, 1},
+    {91, 0, 1, 3863},
+    {47, 16, 3, 1},
+    {3, 3, 0, 3881},
+    {5, 5, 0, 3878},
+    {7, 8, 0, 3873},
+    {3, 11, 2, 0},
+    {24, 6, 2, 0},
+    {3, 2, 1, 3870},
+    {3, 4, 2, 1},
+    {45, 9, 1, 3872},
+    {79, 2, 7, 0},
+    {20, 13, 2, 0},
+    {45, 6, 2, 0},
+    {48, 17, 0, 3877},
+    {197, 19, 3, 1},
+    {49, 9, 3, 1},
+    {793, 10, 2, 0},
+    {9, 15, 2, 0},
+    {8, 8, 3, 1},
+    {97, 19, 0, 3923},
+    {57, 3, 0, 3917},
+    {62, 13, 0, 3916},
+    {586, 10, 2, 0},
+    {4, 5, 0, 3902},
+    {74, 6, 0, 3898},
+    {175, 0, 1, 3888},
+    {-8, 8, 1, 3889},
+    {71, 6, 0, 3897},
+    {53, 17, 1, 3891},
+    {37, 18, 0, 3895},
+    {12, 16, 2, 1},
+    {33, 9, 1, 3894},
+    {1, 15, 3, 1},
+    {71, 1, 1, 3896},
+    {60, 9, 3, 1},
+    {12, 7, 3, 1},
+    {229, 6, 0, 3901},
+    {11, 8, 1, 3900},
+    {62, 10, 7, 0},
+    {-3, 5, 3, 1},
+    {24, 13, 0, 3913},
+    {6, 3, 0, 3909},
+    {-3, 19, 0, 3906},
+    {132, 0, 3, 1},
+    {5, 4, 2, 1},
+    {10, 7, 1, 3908},
+    {9, 1, 7, 0},
+    {-84, 16, 5, 3910},
+    {40, 18, 2, 0},
+    {12, 7, 2, 1},
+    {9, 5, 3, 1},
+    {43, 13, 1, 3914},
+    {45, 13, 2, 0},
+    {260, 10, 3, 1},
+    {1174, 10, 3, 1},
+    {3124, 14, 2, 1},
+    {879, 0, 2, 1},
+    {118, 6, 2, 0},
+    {90, 18, 2, 0},
+    {101, 17, 2, 0},
+    {73, 3, 7, 0},
+    {1, 16, 0, 3947},
+    {7, 8, 0, 3935},
+    {65, 3, 0, 3932},
+    {31, 18, 0, 3930},
+    {-4, 8, 1, 3928},
+    {24, 18, 1, 3929},
+    {427, 2, 7, 0},
+    {821, 1, 1, 3931},
+    {30, 7, 3, 1},
+    {9, 7, 0, 3934},
+    {3, 12, 7, 0},
+    {24, 18, 7, 0},
+    {185, 10, 0, 3944},
+    {84, 18, 0, 3943},
+    {11, 14, 1, 3938},
+    {19, 13, 5, 3939},
+    {90, 17, 0, 3941},
+    {12, 17, 7, 0},
+    {6, 4, 5, 3942},
+    {72, 2, 7, 0},
+    {14, 13, 7, 0},
+    {173, 1, 1, 3945},
+    {222, 1, 5, 3946},
+    {53, 4, 3, 1},
+    {13, 8, 0, 3972},
+    {175, 0, 0, 3955},
+    {881, 14, 0, 3954},
+    {83, 2, 0, 3952},
+    {65, 9, 3, 1},
+    {2, 4, 2, 1},
+    {8, 3, 7, 0},
+    {163, 0, 3, 1},
+    {50, 18, 0, 3966},
+    {31, 6, 5, 3957},
+    {7, 8, 0, 3961},
+    {334, 10, 1, 3959},
+    {10, 3, 1, 3960},
+    {5, 15, 3, 1},
+    {221, 0, 1, 3962},
+    {18, 2, 1, 3963},
+    {504, 0, 2, 0},
+    {35, 17, 2, 1},
+    {52, 2, 7, 0},
+    {5, 2, 5, 3967},
+    {5, 5, 1, 3968},
+    {6, 8, 0, 3970},
+    {37, 1, 3, 1},
+    {216, 10, 2, 0},
+    {213, 0, 7, 0},
+    {22, 3, 0, 3984},
+    {593, 14, 0, 3979},
+    {54, 6, 5, 3975},
+    {55, 6, 1, 3976},
+    {18, 8, 2, 1},
+    {75, 2, 1, 3978},
+    {197, 2, 7, 0},
+    {9, 3, 5, 3980},
+    {7, 5, 1, 3981},
+    {41, 17, 2, 1},
+    {7, 15, 2, 0},
+    {352, 10, 3, 1},
+    {621, 10, 0, 4005},
+    {47, 6, 0, 3990},
+    {4, 15, 1, 3987},
+    {524, 2, 0, 3989},
+    {6, 4, 7, 0},
+    {117, 9, 3, 1},
+    {116, 9, 0, 4001},
+    {49, 16, 2, 1},
+    {813, 14, 0, 3997},
+    {258, 0, 5, 3994},
+    {3, 9, 0, 3996},
+    {6, 5, 7, 0},
+    {12, 17, 3, 1},
+    {28, 8, 2, 1},
+    {30, 3, 1, 3999},
+    {56, 13, 2, 0},
+    {92, 9, 7, 0},
+    {92, 2, 0, 4003},
+    {17, 1, 3, 1},
+    {157, 18, 5, 4004},
+    {52, 1, 7, 0},
+    {95, 9, 1, 4006},
+    {114, 9, 2, 0},
+    {683, 10, 5, 4008},
+    {5, 4, 7, 0},
+    {66, 0, 0, 4032},
+    {13, 5, 0, 4021},
+    {24, 6, 0, 4013},
+    {12, 4, 3, 1},
+    {199, 10, 0, 4015},
+    {511, 1, 3, 1},
+    {55, 0, 1, 4016},
+    {7, 5, 0, 4019},
+    {5, 11, 2, 0},
+    {2121, 2, 7, 0},
+    {20, 13, 2, 0},
+    {2356, 2, 7, 0},
+    {2361, 10, 0, 4028},
+    {6, 19, 0, 4025},
+    {50, 9, 5, 4024},
+    {14, 0, 7, 0},
+    {21, 9, 1, 4026},
+    {221, 16, 2, 1},
+    {975, 10, 7, 0},
+    {23, 7, 0, 4031},
+    {55, 17, 1, 4030},
+    {40, 9, 7, 0},
+    {118, 18, 7, 0},
+    {17, 7, 0, 4066},
+    {18, 8, 0, 4052},
+    {43, 18, 0, 4039},
+    {12, 4, 2, 1},
+    {41, 17, 1, 4037},
+    {7, 15, 1, 4038},
+    {1032, 10, 7, 0},
+    {2026, 14, 0, 4046},
+    {77, 6, 2, 0},
+    {61, 19, 1, 4042},
+    {103, 16, 0, 4044},
+    {328, 2, 7, 0},
+    {12, 7, 2, 1},
+    {1109, 14, 7, 0},
+    {3703, 1, 0, 4051},
+    {1271, 2, 2, 0},
+    {15, 7, 1, 4049},
+    {80, 18, 1, 4050},
+    {1135, 2, 3, 1},
+    {12, 13, 7, 0},
+    {818, 10, 0, 4058},
+    {940, 14, 5, 4054},
+    {110, 0, 2, 1},
+    {337, 10, 1, 4056},
+    {12, 7, 2, 1},
+    {39, 18, 7, 0},
+    {13, 5, 0, 4065},
+    {399, 0, 2, 1},
+    {64, 19, 1, 4061},
+    {99, 19, 5, 4062},
+    {53, 18, 2, 0},
+    {4409, 14, 2, 1},
+    {13, 7, 3, 1},
+    {148, 1, 3, 1},
+    {33, 17, 0, 4096},
+    {1410, 14, 0, 4070},
+    {117, 9, 5, 4069},
+    {6, 17, 7, 0},
+    {14, 4, 0, 4090},
+    {2549, 14, 0, 4084},
+    {40, 8, 0, 4081},
+    {99, 9, 0, 4078},
+    {175, 1, 0, 4076},
+    {26, 7, 3, 1},
+    {1361, 2, 2, 1},
+    {1053, 2, 7, 0},
+    {111, 18, 1, 4079},
+    {27, 7, 1, 4080},
+    {61, 3, 3, 1},
+    {80, 0, 1, 4082},
+    {1537, 2, 5, 4083},
+    {637, 10, 7, 0},
+    {17, 8, 1, 4085},
+    {263, 1, 1, 4086},
+    {-26, 19, 1, 4087},
+    {34, 7, 2, 0},
+    {18, 8, 2, 1},
+    {30, 13, 7, 0},
+    {1854, 10, 5, 4091},
+    {659, 16, 0, 4094},
+    {533, 16, 1, 4093},
+    {30, 7, 7, 0},
+    {18, 8, 2, 1},
+    {24, 7, 3, 1},
+    {78, 18, 0, 4118},
+    {23, 8, 0, 4108},
+    {101, 17, 0, 4107},
+    {13, 8, 0, 4105},
+    {46, 13, 2, 1},
+    {549, 1, 2, 0},
+    {2069, 10, 2, 0},
+    {299, 1, 2, 1},
+    {63, 18, 7, 0},
+    {14, 5, 5, 4106},
+    {1318, 2, 3, 1},
+    {238, 1, 7, 0},
+    {123, 17, 0, 4117},
+    {787, 10, 5, 4110},
+    {11, 5, 0, 4112},
+    {22, 15, 7, 0},
+    {1384, 14, 1, 4113},
+    {871, 10, 0, 4115},
+    {853, 10, 7, 0},
+    {40, 7, 5, 4116},
+    {1893, 1, 3, 1},
+    {139, 6, 3, 1},
+    {9, 5, 0, 4127},
+    {25, 7, 0, 4121},
+    {514, 19, 3, 1},
+    {28, 7, 0, 4125},
+    {54, 13, 2, 1},
+    {3498, 2, 1, 4124},
+    {9206, 14, 7, 0},
+    {3832, 14, 2, 0},
+    {64, 13, 7, 0},
+    {22, 8, 0, 4135},
+    {4, 12, 5, 4129},
+    {42, 17, 1, 4130},
+    {40, 9, 0, 4133},
+    {1054, 2, 2, 0},
+    {546, 0, 7, 0},
+    {117, 18, 5, 4134},
+    {121, 6, 7, 0},
+    {93, 18, 2, 1},
+    {40, 8, 2, 1},
+    {1093, 0, 2, 0},
+    {198, 16, 2, 1},
+    {151, 16, 5, 4140},
+    {56, 9, 3, 1},
+    // SCDetectF
+    {69, 0, 0, 4180},
+    {7, 3, 0, 4158},
+    {50, 19, 0, 4155},
+    {20, 18, 0, 4149},
+    {35, 1, 2, 1},
+    {2, 15, 1, 4147},
+    {512, 10, 1, 4148},
+    {635, 2, 7, 0},
+    {10, 5, 0, 4152},
+    {33, 4, 1, 4151},
+    {4130, 14, 7, 0},
+    {1971, 10, 2, 0},
+    {19, 13, 5, 4154},
+    {15001, 14, 3, 1},
+    {13, 8, 1, 4156},
+    {55, 19, 2, 1},
+    {1997, 10, 7, 0},
+    {24, 7, 0, 4174},
+    {7030, 2, 0, 4173},
+    {9, 5, 0, 4165},
+    {34, 2, 2, 0},
+    {326, 1, 2, 1},
+    {175, 18, 1, 4164},
+    {226, 6, 3, 1},
+    {469, 10, 0, 4171},
+    {75, 18, 0, 4170},
+    {41, 6, 2, 1},
+    {20, 13, 5, 4169},
+    {173, 2, 7, 0},
+    {204, 18, 3, 1},
+    {15, 3, 2, 0},
+    {47, 19, 3, 1},
+    {9, 8, 3, 1},
+    {20, 5, 0, 4176},
+    {62, 0, 3, 1},
+    {6, 12, 5, 4177},
+    {20, 15, 1, 4178},
+    {119, 9, 5, 4179},
+    {4577, 10, 7, 0},
+    {30, 13, 0, 4297},
+    {10, 8, 0, 4231},
+    {5, 16, 0, 4205},
+    {123, 3, 0, 4203},
+    {5, 5, 0, 4196},
+    {283, 19, 0, 4192},
+    {25, 18, 2, 0},
+    {2, 11, 1, 4188},
+    {23, 6, 1, 4189},
+    {5, 17, 5, 4190},
+    {56, 17, 1, 4191},
+    {13, 10, 3, 1},
+    {284, 19, 5, 4193},
+    {4, 15, 1, 4194},
+    {99, 2, 2, 0},
+    {20, 18, 3, 1},
+    {59, 3, 2, 1},
+    {53, 18, 2, 0},
+    {56, 17, 0, 4202},
+    {-9, 8, 5, 4200},
+    {50, 10, 2, 0},
+    {12, 13, 7, 0},
+    {14, 7, 7, 0},
+    {16, 13, 5, 4204},
+    {1, 4, 3, 1},
+    {367, 14, 0, 4210},
+    {44, 6, 0, 4208},
+    {174, 2, 7, 0},
+    {7, 15, 1, 4209},
+    {131, 18, 7, 0},
+    {49, 6, 0, 4223},
+    {72, 9, 2, 0},
+    {3, 5, 0, 4217},
+    {1, 13, 5, 4214},
+    {15, 4, 2, 1},
+    {-8, 5, 2, 0},
+    {1202, 14, 7, 0},
+    {63, 17, 2, 1},
+    {8, 11, 0, 4220},
+    {660, 14, 3, 1},
+    {14, 7, 0, 4222},
+    {30, 6, 7, 0},
+    {578, 10, 7, 0},
+    {52, 19, 1, 4224},
+    {85, 3, 2, 1},
+    {2663, 16, 2, 1},
+    {83, 18, 2, 0},
+    {7, 5, 2, 1},
+    {7, 3, 2, 0},
+    {296, 2, 5, 4230},
+    {73, 17, 3, 1},
+    {65, 19, 0, 4250},
+    {22, 8, 0, 4247},
+    {55, 6, 0, 4245},
+    {10, 5, 2, 0},
+    {48, 17, 0, 4240},
+    {3082, 2, 2, 1},
+    {76, 9, 2, 0},
+    {7, 5, 1, 4239},
+    {470, 2, 3, 1},
+    {558, 2, 2, 1},
+    {56, 17, 0, 4243},
+    {2, 15, 7, 0},
+    {13, 8, 2, 1},
+    {216, 10, 7, 0},
+    {105, 17, 1, 4246},
+    {16, 9, 3, 1},
+    {524, 2, 1, 4248},
+    {182, 0, 5, 4249},
+    {758, 10, 3, 1},
+    {48, 18, 0, 4265},
+    {123, 19, 0, 4261},
+    {131, 16, 2, 1},
+    {15, 3, 0, 4259},
+    {4, 15, 0, 4257},
+    {7, 11, 1, 4256},
+    {16, 10, 3, 1},
+    {4, 3, 1, 4258},
+    {23, 13, 7, 0},
+    {256, 10, 1, 4260},
+    {4, 15, 7, 0},
+    {16, 18, 0, 4263},
+    {6, 7, 3, 1},
+    {919, 19, 5, 4264},
+    {1098, 10, 7, 0},
+    {6, 5, 0, 4271},
+    {4, 5, 0, 4268},
+    {2511, 0, 3, 1},
+    {75, 1, 2, 0},
+    {8, 7, 5, 4270},
+    {57, 6, 7, 0},
+    {20, 13, 0, 4277},
+    {29, 3, 2, 1},
+    {12, 3, 0, 4276},
+    {14, 7, 2, 1},
+    {90, 10, 7, 0},
+    {8, 7, 7, 0},
+    {24, 17, 0, 4289},
+    {23, 16, 0, 4281},
+    {22, 13, 2, 0},
+    {75, 10, 7, 0},
+    {117, 19, 0, 4285},
+    {10, 15, 1, 4283},
+    {42, 6, 2, 0},
+    {1974, 2, 7, 0},
+    {251, 10, 5, 4286},
+    {15, 7, 1, 4287},
+    {6, 15, 5, 4288},
+    {89, 1, 3, 1},
+    {15, 8, 0, 4292},
+    {63, 9, 1, 4291},
+    {95, 19, 3, 1},
+    {79, 19, 0, 4295},
+    {91, 0, 2, 0},
+    {24, 13, 3, 1},
+    {99, 17, 5, 4296},
+    {28, 13, 3, 1},
+    {7, 4, 0, 4362},
+    {23, 8, 0, 4334},
+    {9, 5, 0, 4321},
+    {41, 14, 0, 4304},
+    {4, 4, 2, 1},
+    {-85, 16, 5, 4303},
+    {1561, 19, 3, 1},
+    {66, 9, 2, 0},
+    {13, 8, 0, 4314},
+    {41, 17, 5, 4307},
+    {3, 4, 1, 4308},
+    {65, 19, 1, 4309},
+    {25, 9, 1, 4310},
+    {4, 15, 1, 4311},
+    {253, 10, 0, 4313},
+    {1545, 14, 7, 0},
+    {148, 6, 3, 1},
+    {19, 3, 0, 4317},
+    {64, 6, 2, 0},
+    {203, 10, 7, 0},
+    {2, 12, 0, 4319},
+    {53, 10, 7, 0},
+    {823, 14, 5, 4320},
+    {3, 4, 7, 0},
+    {108, 1, 0, 4332},
+    {1224, 0, 2, 1},
+    {304, 19, 0, 4331},
+    {33, 9, 1, 4325},
+    {62, 18, 0, 4328},
+    {11, 5, 5, 4327},
+    {-10, 16, 3, 1},
+    {10, 2, 5, 4329},
+    {17, 5, 1, 4330},
+    {61, 6, 3, 1},
+    {44, 6, 3, 1},
+    {548, 10, 5, 4333},
+    {1810, 2, 7, 0},
+    {41, 17, 0, 4349},
+    {2, 17, 1, 4336},
+    {26, 8, 1, 4337},
+    {77, 3, 2, 1},
+    {29, 7, 0, 4346},
+    {73, 19, 0, 4342},
+    {264, 14, 1, 4341},
+    {228, 10, 3, 1},
+    {116, 9, 2, 0},
+    {139, 18, 2, 0},
+    {70, 18, 2, 1},
+    {39, 13, 7, 0},
+    {52, 7, 2, 1},
+    {36, 3, 2, 0},
+    {16, 15, 3, 1},
+    {163, 6, 0, 4360},
+    {83, 13, 2, 0},
+    {81, 19, 0, 4355},
+    {400, 1, 2, 1},
+    {66, 17, 1, 4354},
+    {27, 7, 7, 0},
+    {1, 4, 1, 4356},
+    {39, 3, 5, 4357},
+    {201, 1, 2, 0},
+    {73, 17, 2, 1},
+    {3, 4, 3, 1},
+    {544, 14, 5, 4361},
+    {48, 8, 3, 1},
+    {18, 8, 0, 4387},
+    {23, 3, 0, 4374},
+    {153, 19, 0, 4370},
+    {15, 8, 0, 4368},
+    {1481, 14, 2, 0},
+    {1439, 14, 3, 1},
+    {8, 4, 5, 4369},
+    {33, 7, 3, 1},
+    {1, 3, 5, 4371},
+    {8, 8, 1, 4372},
+    {80, 6, 5, 4373},
+    {1977, 14, 7, 0},
+    {41, 18, 5, 4375},
+    {607, 1, 0, 4382},
+    {73, 10, 5, 4377},
+    {98, 16, 1, 4378},
+    {73, 9, 2, 0},
+    {18, 9, 0, 4381},
+    {2902, 14, 3, 1},
+    {18, 15, 7, 0},
+    {2189, 2, 0, 4386},
+    {3703, 14, 2, 0},
+    {247, 16, 5, 4385},
+    {752, 14, 3, 1},
+    {15, 8, 3, 1},
+    {27, 8, 0, 4411},
+    {102, 9, 0, 4408},
+    {6, 5, 0, 4391},
+    {418, 2, 7, 0},
+    {50, 13, 0, 4405},
+    {73, 19, 0, 4397},
+    {768, 10, 5, 4394},
+    {62, 6, 1, 4395},
+    {29, 3, 2, 0},
+    {53, 9, 3, 1},
+    {71, 6, 5, 4398},
+    {819, 10, 5, 4399},
+    {59, 18, 0, 4401},
+    {281, 1, 7, 0},
+    {4514, 2, 2, 1},
+    {41, 13, 2, 1},
+    {1351, 2, 1, 4404},
+    {643, 16, 3, 1},
+    {2762, 14, 1, 4406},
+    {1576, 2, 5, 4407},
+    {930, 10, 7, 0},
+    {139, 18, 1, 4409},
+    {6, 17, 2, 1},
+    {144, 2, 7, 0},
+    {61, 19, 0, 4417},
+    {112, 0, 1, 4413},
+    {115, 18, 5, 4414},
+    {48, 3, 2, 0},
+    {162, 18, 2, 0},
+    {143, 0, 3, 1},
+    {33, 8, 0, 4426},
+    {21, 3, 5, 4419},
+    {417, 1, 0, 4423},
+    {15, 17, 1, 4421},
+    {29, 7, 5, 4422},
+    {326, 19, 3, 1},
+    {36, 7, 2, 0},
+    {871, 16, 5, 4425},
+    {916, 16, 3, 1},
+    {105, 9, 0, 4436},
+    {132, 6, 0, 4430},
+    {40, 7, 5, 4429},
+    {25, 5, 3, 1},
+    {9511, 2, 0, 4435},
+    {84, 3, 0, 4434},
+    {1235, 0, 5, 4433},
+    {819, 2, 3, 1},
+    {41, 13, 3, 1},
+    {10400, 2, 3, 1},
+    {168, 18, 0, 4440},
+    {362, 0, 5, 4438},
+    {2014, 14, 5, 4439},
+    {6578, 2, 3, 1},
+    {10, 4, 7, 0},
+    // SCDetect10
+    {6, 5, 0, 4549},
+    {53, 19, 0, 4481},
+    {6, 3, 0, 4461},
+    {9, 17, 0, 4455},
+    {21, 18, 0, 4451},
+    {7, 1, 1, 4447},
+    {1346, 14, 5, 4448},
+    {9, 15, 2, 1},
+    {1, 7, 1, 4450},
+    {1014, 10, 7, 0},
+    {9, 14, 2, 0},
+    {4, 10, 1, 4453},
+    {841, 0, 1, 4454},
+    {23, 6, 3, 1},
+    {87, 14, 0, 4458},
+    {2, 1, 1, 4457},
+    {1, 16, 3, 1},
+    {-123, 19, 2, 0},
+    {-124, 19, 1, 4460},
+    {126, 0, 3, 1},
+    {229, 6, 2, 1},
+    {154, 3, 2, 1},
+    {53, 13, 0, 4478},
+    {224, 0, 0, 4470},
+    {24, 7, 0, 4468},
+    {13, 8, 1, 4467},
+    {21, 9, 7, 0},
+    {32, 15, 1, 4469},
+    {30, 4, 7, 0},
+    {-6, 5, 1, 4471},
+    {-96, 16, 0, 4474},
+    {228, 0, 5, 4473},
+    {133, 14, 7, 0},
+    {5, 16, 1, 4475},
+    {-210, 19, 2, 0},
+    {8, 7, 5, 4477},
+    {15, 7, 3, 1},
+    {74, 17, 2, 1},
+    {1585, 10, 1, 4480},
+    {1912, 10, 7, 0},
+    {8, 8, 0, 4514},
+    {47, 13, 0, 4509},
+    {31, 18, 0, 4493},
+    {2, 1, 0, 4488},
+    {4, 11, 1, 4486},
+    {5, 7, 2, 0},
+    {219, 19, 3, 1},
+    {12, 16, 2, 1},
+    {3, 7, 1, 4490},
+    {167, 0, 1, 4491},
+    {10, 3, 5, 4492},
+    {-9, 5, 7, 0},
+    {2302, 16, 2, 1},
+    {112, 3, 0, 4508},
+    {378, 10, 2, 0},
+    {41, 18, 0, 4504},
+    {718, 14, 0, 4503},
+    {1, 5, 1, 4499},
+    {9, 13, 1, 4500},
+    {149, 10, 2, 0},
+    {7, 2, 5, 4502},
+    {1, 4, 3, 1},
+    {625, 2, 7, 0},
+    {15, 7, 1, 4505},
+    {17, 7, 2, 0},
+    {44, 17, 2, 0},
+    {112, 6, 7, 0},
+    {14, 7, 7, 0},
+    {110, 1, 1, 4510},
+    {34, 7, 2, 1},
+    {1565, 14, 0, 4513},
+    {58, 9, 7, 0},
+    {20, 9, 7, 0},
+    {15, 13, 0, 4517},
+    {48, 6, 5, 4516},
+    {27, 10, 7, 0},
+    {42, 17, 0, 4522},
+    {120, 19, 1, 4519},
+    {8, 15, 1, 4520},
+    {11, 7, 5, 4521},
+    {152, 10, 7, 0},
+    {82, 6, 0, 4542},
+    {543, 14, 0, 4532},
+    {87, 17, 0, 4529},
+    {15, 7, 2, 0},
+    {6, 3, 2, 1},
+    {-2, 16, 1, 4528},
+    {278, 2, 7, 0},
+    {1, 9, 0, 4531},
+    {209, 19, 3, 1},
+    {8, 4, 3, 1},
+    {47, 1, 0, 4535},
+    {30, 13, 1, 4534},
+    {51, 18, 7, 0},
+    {25, 13, 0, 4538},
+    {452, 2, 1, 4537},
+    {2247, 14, 7, 0},
+    {467, 1, 2, 0},
+    {39, 13, 2, 0},
+    {11, 7, 1, 4541},
+    {105, 1, 3, 1},
+    {4, 14, 5, 4543},
+    {14, 3, 1, 4544},
+    {165, 6, 0, 4548},
+    {47, 13, 1, 4546},
+    {147, 1, 2, 1},
+    {1, 12, 7, 0},
+    {109, 18, 3, 1},
+    {21, 8, 0, 4616},
+    {46, 18, 0, 4564},
+    {10, 8, 0, 4556},
+    {4, 15, 0, 4555},
+    {64, 17, 1, 4554},
+    {23, 1, 7, 0},
+    {87, 17, 7, 0},
+    {61, 19, 0, 4561},
+    {813, 16, 2, 1},
+    {884, 2, 2, 0},
+    {7, 4, 2, 1},
+    {19, 3, 3, 1},
+    {210, 0, 5, 4562},
+    {58, 17, 2, 1},
+    {191, 19, 3, 1},
+    {74, 19, 0, 4588},
+    {14, 0, 1, 4566},
+    {24, 5, 0, 4587},
+    {24, 15, 0, 4580},
+    {185, 0, 0, 4574},
+    {25, 19, 1, 4570},
+    {124, 16, 1, 4571},
+    {1271, 10, 2, 0},
+    {42, 17, 1, 4573},
+    {9, 5, 3, 1},
+    {117, 18, 2, 0},
+    {12, 5, 0, 4578},
+    {37, 6, 2, 0},
+    {9, 5, 7, 0},
+    {104, 9, 2, 1},
+    {24, 13, 7, 0},
+    {3594, 14, 5, 4581},
+    {19, 19, 1, 4582},
+    {12, 8, 1, 4583},
+    {3439, 10, 0, 4585},
+    {1268, 1, 3, 1},
+    {11, 5, 1, 4586},
+    {96, 18, 3, 1},
+    {110, 6, 7, 0},
+    {125, 18, 0, 4612},
+    {24, 16, 0, 4601},
+    {9, 11, 5, 4591},
+    {332, 14, 0, 4596},
+    {11, 7, 5, 4593},
+    {14, 5, 2, 1},
+    {1, 12, 2, 0},
+    {52, 2, 3, 1},
+    {17, 8, 0, 4598},
+    {59, 13, 3, 1},
+    {15, 7, 0, 4600},
+    {30, 17, 3, 1},
+    {42, 17, 3, 1},
+    {1069, 14, 0, 4603},
+    {3, 9, 3, 1},
+    {44, 17, 0, 4609},
+    {68, 9, 5, 4605},
+    {68, 18, 0, 4608},
+    {2100, 14, 2, 0},
+    {61, 1, 3, 1},
+    {4166, 2, 3, 1},
+    {7, 9, 1, 4610},
+    {4363, 14, 5, 4611},
+    {953, 16, 3, 1},
+    {9, 14, 5, 4613},
+    {150, 18, 2, 0},
+    {9, 4, 1, 4615},
+    {1937, 10, 7, 0},
+    {63, 19, 0, 4642},
+    {16, 7, 0, 4621},
+    {10, 3, 1, 4619},
+    {14, 7, 1, 4620},
+    {30, 4, 7, 0},
+    {40, 5, 0, 4641},
+    {66, 18, 0, 4627},
+    {20, 3, 5, 4624},
+    {32, 6, 5, 4625},
+    {70, 10, 5, 4626},
+    {31, 8, 3, 1},
+    {91, 9, 0, 4638},
+    {40, 9, 0, 4632},
+    {56, 19, 0, 4631},
+    {85, 15, 3, 1},
+    {3397, 10, 7, 0},
+    {-16, 19, 0, 4634},
+    {23, 17, 3, 1},
+    {26, 8, 0, 4636},
+    {26, 13, 7, 0},
+    {2501, 10, 5, 4637},
+    {53, 17, 7, 0},
+    {267, 1, 1, 4639},
+    {571, 10, 5, 4640},
+    {126, 9, 3, 1},
+    {9, 15, 3, 1},
+    {12, 17, 0, 4655},
+    {46, 7, 2, 1},
+    {54, 6, 0, 4651},
+    {5, 16, 5, 4646},
+    {77, 1, 1, 4647},
+    {754, 10, 5, 4648},
+    {96, 19, 1, 4649},
+    {173, 18, 2, 1},
+    {53, 8, 3, 1},
+    {3, 16, 1, 4652},
+    {9, 5, 1, 4653},
+    {67, 3, 2, 1},
+    {54, 3, 7, 0},
+    {18, 3, 0, 4669},
+    {-2, 16, 1, 4657},
+    {73, 19, 0, 4663},
+    {71, 0, 5, 4659},
+    {11, 5, 0, 4662},
+    {650, 2, 2, 0},
+    {647, 14, 7, 0},
+    {9024, 2, 7, 0},
+    {1348, 14, 2, 1},
+    {1061, 2, 2, 0},
+    {43, 13, 5, 4666},
+    {45, 17, 0, 4668},
+    {461, 10, 3, 1},
+    {151, 6, 7, 0},
+    {28, 8, 0, 4688},
+    {35, 15, 2, 1},
+    {140, 6, 0, 4687},
+    {43, 9, 0, 4680},
+    {34, 13, 0, 4676},
+    {1676, 14, 5, 4675},
+    {12, 4, 3, 1},
+    {22, 15, 2, 0},
+    {101, 14, 1, 4678},
+    {84, 17, 2, 1},
+    {1548, 10, 3, 1},
+    {63, 18, 5, 4681},
+    {12, 5, 0, 4683},
+    {43, 13, 7, 0},
+    {105, 18, 2, 1},
+    {16, 15, 1, 4685},
+    {39, 17, 1, 4686},
+    {14, 4, 3, 1},
+    {136, 18, 3, 1},
+    {263, 1, 0, 4708},
+    {57, 6, 0, 4697},
+    {1037, 2, 0, 4695},
+    {70, 16, 2, 1},
+    {640, 2, 2, 0},
+    {44, 13, 5, 4694},
+    {92, 9, 7, 0},
+    {30, 7, 2, 0},
+    {29, 7, 3, 1},
+    {-10, 16, 1, 4698},
+    {680, 10, 0, 4703},
+    {40, 5, 0, 4702},
+    {37, 18, 2, 1},
+    {4, 15, 3, 1},
+    {26, 1, 3, 1},
+    {14, 15, 0, 4707},
+    {7, 15, 2, 1},
+    {90, 6, 2, 1},
+    {44, 17, 7, 0},
+    {27, 7, 7, 0},
+    {39, 7, 0, 4712},
+    {455, 19, 5, 4710},
+    {37, 17, 2, 1},
+    {1686, 2, 7, 0},
+    {171, 19, 2, 1},
+    {20, 5, 3, 1},
+    // SCDetect11
+    {5, 3, 0, 4784},
+    {70, 16, 0, 4747},
+    {6, 5, 0, 4740},
+    {54, 19, 0, 4728},
+    {1, 17, 0, 4724},
+    {7, 16, 0, 4723},
+    {2, 11, 1, 4721},
+    {2, 13, 2, 0},
+    {68, 9, 7, 0},
+    {23, 18, 7, 0},
+    {-9, 19, 2, 0},
+    {11, 7, 1, 4726},
+    {568, 14, 2, 0},
+    {60, 9, 3, 1},
+    {251, 10, 2, 0},
+    {5, 11, 0, 4732},
+    {272, 19, 1, 4731},
+    {356, 0, 7, 0},
+    {32, 6, 5, 4733},
+    {7, 8, 0, 4736},
+    {41, 17, 2, 0},
+    {25, 13, 3, 1},
+    {50, 6, 2, 0},
+    {-4, 16, 1, 4738},
+    {182, 10, 5, 4739},
+    {435, 14, 3, 1},
+    {11, 8, 1, 4741},
+    {62, 9, 0, 4746},
+    {73, 19, 0, 4745},
+    {25, 13, 1, 4744},
+    {160, 2, 7, 0},
+    {28, 2, 3, 1},
+    {1241, 2, 7, 0},
+    {21, 8, 0, 4771},
+    {54, 0, 0, 4754},
+    {20, 18, 5, 4750},
+    {535, 10, 0, 4752},
+    {11, 5, 3, 1},
+    {44, 6, 2, 0},
+    {813, 1, 3, 1},
+    {58, 19, 0, 4762},
+    {10, 13, 0, 4757},
+    {764, 16, 3, 1},
+    {46, 6, 2, 0},
+    {-64, 19, 0, 4760},
+    {110, 1, 3, 1},
+    {12, 4, 1, 4761},
+    {12, 15, 7, 0},
+    {78, 18, 0, 4768},
+    {43, 17, 0, 4765},
+    {34, 18, 7, 0},
+    {12, 15, 5, 4766},
+    {2533, 14, 5, 4767},
+    {3200, 14, 3, 1},
+    {17, 8, 1, 4769},
+    {12, 5, 2, 1},
+    {1485, 2, 7, 0},
+    {47, 0, 1, 4772},
+    {73, 19, 0, 4781},
+    {115, 6, 0, 4779},
+    {11, 5, 0, 4776},
+    {1039, 14, 7, 0},
+    {14, 7, 1, 4777},
+    {39, 8, 5, 4778},
+    {9756, 14, 7, 0},
+    {13, 5, 1, 4780},
+    {24, 7, 7, 0},
+    {8, 4, 2, 1},
+    {105, 18, 5, 4783},
+    {233, 1, 7, 0},
+    {65, 19, 0, 4849},
+    {25, 6, 0, 4790},
+    {3, 19, 2, 1},
+    {45, 18, 1, 4788},
+    {399, 2, 5, 4789},
+    {3093, 14, 3, 1},
+    {13, 8, 0, 4820},
+    {47, 13, 0, 4813},
+    {24, 7, 0, 4809},
+    {111, 14, 0, 4801},
+    {82, 17, 1, 4795},
+    {11, 2, 0, 4798},
+    {662, 0, 1, 4797},
+    {124, 18, 3, 1},
+    {20, 0, 5, 4799},
+    {4, 1, 1, 4800},
+    {51, 2, 7, 0},
+    {224, 0, 1, 4802},
+    {376, 10, 1, 4803},
+    {4, 12, 2, 0},
+    {63, 18, 2, 0},
+    {-9, 5, 1, 4806},
+    {5, 4, 0, 4808},
+    {378, 10, 7, 0},
+    {1351, 14, 7, 0},
+    {1303, 1, 0, 4812},
+    {64, 18, 2, 0},
+    {502, 10, 3, 1},
+    {8521, 14, 7, 0},
+    {3, 5, 2, 0},
+    {9, 15, 0, 4816},
+    {40, 14, 7, 0},
+    {258, 0, 1, 4817},
+    {3672, 14, 0, 4819},
+    {582, 0, 7, 0},
+    {1022, 1, 3, 1},
+    {9, 15, 0, 4830},
+    {95, 9, 2, 0},
+    {107, 0, 1, 4823},
+    {26, 7, 2, 0},
+    {-206, 19, 5, 4825},
+    {68, 17, 0, 4828},
+    {89, 9, 1, 4827},
+    {2, 4, 3, 1},
+    {50, 2, 1, 4829},
+    {827, 10, 7, 0},
+    {77, 18, 0, 4837},
+    {283, 16, 0, 4836},
+    {30, 17, 1, 4833},
+    {29, 9, 0, 4835},
+    {101, 3, 3, 1},
+    {10, 7, 3, 1},
+    {33, 4, 7, 0},
+    {222, 0, 0, 4844},
+    {108, 15, 2, 1},
+    {37, 8, 0, 4842},
+    {4333, 10, 1, 4841},
+    {3473, 2, 7, 0},
+    {21, 15, 1, 4843},
+    {4829, 2, 7, 0},
+    {289, 0, 5, 4845},
+    {401, 0, 2, 1},
+    {99, 18, 1, 4847},
+    {273, 1, 1, 4848},
+    {100, 9, 7, 0},
+    {7, 5, 0, 4907},
+    {8, 8, 0, 4872},
+    {44, 6, 0, 4859},
+    {11, 16, 0, 4857},
+    {16, 3, 1, 4854},
+    {19, 13, 2, 0},
+    {42, 6, 2, 1},
+    {13, 13, 7, 0},
+    {100, 19, 5, 4858},
+    {50, 9, 7, 0},
+    {58, 13, 0, 4871},
+    {123, 3, 0, 4869},
+    {-38, 16, 0, 4867},
+    {40, 13, 0, 4864},
+    {7, 8, 3, 1},
+    {926, 2, 2, 0},
+    {4, 4, 1, 4866},
+    {15, 7, 3, 1},
+    {-8, 5, 2, 0},
+    {3, 8, 3, 1},
+    {24, 18, 5, 4870},
+    {7, 4, 3, 1},
+    {1544, 2, 3, 1},
+    {211, 10, 0, 4889},
+    {157, 2, 0, 4887},
+    {34, 18, 0, 4878},
+    {7, 16, 5, 4876},
+    {19, 18, 1, 4877},
+    {11, 7, 7, 0},
+    {4, 4, 0, 4884},
+    {14, 3, 0, 4882},
+    {26, 10, 1, 4881},
+    {5, 7, 3, 1},
+    {390, 0, 1, 4883},
+    {4, 15, 3, 1},
+    {-5, 5, 1, 4885},
+    {672, 0, 5, 4886},
+    {37, 13, 7, 0},
+    {49, 6, 2, 0},
+    {27, 1, 3, 1},
+    {94, 19, 1, 4890},
+    {135, 0, 5, 4891},
+    {62, 18, 0, 4898},
+    {150, 1, 0, 4896},
+    {9, 3, 5, 4894},
+    {243, 10, 2, 0},
+    {38, 13, 7, 0},
+    {477, 10, 2, 1},
+    {11, 15, 7, 0},
+    {40, 15, 2, 1},
+    {458, 0, 0, 4903},
+    {7, 3, 2, 0},
+    {4, 5, 1, 4902},
+    {1703, 2, 7, 0},
+    {59, 13, 0, 4906},
+    {517, 19, 1, 4905},
+    {653, 0, 7, 0},
+    {1750, 2, 7, 0},
+    {20, 8, 0, 4934},
+    {47, 18, 0, 4911},
+    {104, 14, 2, 1},
+    {9, 8, 3, 1},
+    {129, 6, 2, 0},
+    {14, 8, 0, 4917},
+    {22, 3, 1, 4914},
+    {741, 10, 2, 0},
+    {56, 6, 1, 4916},
+    {37, 1, 3, 1},
+    {42, 17, 0, 4927},
+    {37, 3, 0, 4925},
+    {11, 7, 5, 4920},
+    {17, 17, 1, 4921},
+    {54, 6, 0, 4923},
+    {128, 19, 3, 1},
+    {104, 19, 2, 0},
+    {17, 8, 3, 1},
+    {406, 10, 2, 0},
+    {0, 16, 3, 1},
+    {3044, 2, 2, 1},
+    {557, 10, 0, 4931},
+    {37, 13, 5, 4930},
+    {16, 7, 3, 1},
+    {138, 0, 5, 4932},
+    {79, 18, 1, 4933},
+    {1781, 10, 7, 0},
+    {460, 1, 0, 4992},
+    {30, 17, 0, 4961},
+    {94, 18, 0, 4946},
+    {191, 0, 0, 4941},
+    {20, 5, 0, 4940},
+    {78, 19, 3, 1},
+    {41, 8, 3, 1},
+    {199, 19, 1, 4942},
+    {21, 17, 0, 4944},
+    {18, 7, 7, 0},
+    {1504, 0, 2, 0},
+    {908, 2, 7, 0},
+    {29, 16, 0, 4954},
+    {671, 14, 0, 4952},
+    {142, 18, 2, 0},
+    {13, 1, 2, 1},
+    {36, 13, 5, 4951},
+    {33, 2, 7, 0},
+    {78, 6, 1, 4953},
+    {1232, 2, 7, 0},
+    {102, 19, 0, 4956},
+    {37, 8, 3, 1},
+    {1702, 14, 5, 4957},
+    {7, 15, 1, 4958},
+    {2274, 14, 5, 4959},
+    {76, 3, 2, 1},
+    {41, 8, 3, 1},
+    {46, 13, 0, 4974},
+    {3430, 10, 2, 0},
+    {76, 0, 0, 4965},
+    {865, 14, 3, 1},
+    {6, 4, 0, 4972},
+    {1705, 2, 2, 0},
+    {129, 19, 0, 4970},
+    {91, 10, 1, 4969},
+    {41, 6, 3, 1},
+    {13, 9, 2, 1},
+    {24, 1, 3, 1},
+    {97, 0, 2, 1},
+    {1059, 10, 7, 0},
+    {7, 4, 0, 4982},
+    {42, 8, 2, 1},
+    {166, 0, 5, 4977},
+    {159, 19, 1, 4978},
+    {26, 8, 1, 4979},
+    {50, 17, 0, 4981},
+    {519, 10, 7, 0},
+    {137, 2, 3, 1},
+    {125, 19, 0, 4987},
+    {156, 1, 1, 4984},
+    {31, 8, 2, 1},
+    {29, 7, 2, 0},
+    {11, 15, 3, 1},
+    {29, 8, 0, 4990},
+    {897, 10, 2, 0},
+    {168, 2, 3, 1},
+    {5, 15, 2, 1},
+    {191, 2, 3, 1},
+    {42, 13, 0, 5005},
+    {24, 8, 0, 4997},
+    {24, 15, 0, 4996},
+    {46, 6, 3, 1},
+    {3157, 10, 3, 1},
+    {3210, 1, 0, 5004},
+    {229, 19, 0, 5001},
+    {41, 13, 5, 5000},
+    {36, 17, 3, 1},
+    {233, 19, 1, 5002},
+    {28, 8, 2, 1},
+    {38, 13, 7, 0},
+    {54, 3, 7, 0},
+    {458, 19, 0, 5008},
+    {17, 9, 2, 1},
+    {1571, 2, 3, 1},
+    {39, 17, 3, 1},
+    // SCDetect12
+    {14, 8, 0, 5137},
+    {52, 19, 0, 5060},
+    {837, 1, 0, 5052},
+    {200, 0, 0, 5032},
+    {1148, 2, 2, 0},
+    {24, 6, 0, 5024},
+    {5, 16, 0, 5019},
+    {6, 0, 2, 0},
+    {109, 3, 2, 1},
+    {3, 4, 3, 1},
+    {1207, 14, 0, 5022},
+    {10, 15, 2, 1},
+    {23, 3, 3, 1},
+    {17, 1, 2, 1},
+    {17, 18, 7, 0},
+    {31, 3, 0, 5029},
+    {9, 11, 1, 5026},
+    {1, 2, 5, 5027},
+    {48, 16, 1, 5028},
+    {705, 14, 7, 0},
+    {52, 10, 2, 0},
+    {30, 10, 2, 1},
+    {325, 1, 3, 1},
+    {1, 3, 1, 5033},
+    {41, 16, 0, 5048},
+    {1, 17, 0, 5039},
+    {24, 6, 2, 0},
+    {-25, 8, 1, 5037},
+    {2, 10, 2, 1},
+    {3, 13, 3, 1},
+    {2, 2, 0, 5043},
+    {53, 10, 2, 1},
+    {662, 0, 1, 5042},
+    {4, 7, 3, 1},
+    {16, 7, 1, 5044},
+    {29, 9, 1, 5045},
+    {-205, 19, 2, 0},
+    {76, 9, 2, 0},
+    {3, 15, 3, 1},
+    {51, 6, 0, 5051},
+    {855, 10, 2, 1},
+    {1438, 14, 7, 0},
+    {57, 13, 3, 1},
+    {47, 18, 0, 5054},
+    {1198, 2, 3, 1},
+    {140, 0, 0, 5057},
+    {24, 7, 1, 5056},
+    {2454, 10, 7, 0},
+    {24, 7, 1, 5058},
+    {2620, 2, 2, 0},
+    {1912, 10, 7, 0},
+    {7, 8, 0, 5090},
+    {5, 16, 0, 5073},
+    {51, 3, 0, 5072},
+    {6, 8, 0, 5071},
+    {101, 1, 0, 5068},
+    {81, 17, 1, 5066},
+    {24, 18, 2, 0},
+    {36, 10, 3, 1},
+    {156, 2, 5, 5069},
+    {-4, 16, 1, 5070},
+    {34, 13, 3, 1},
+    {27, 6, 7, 0},
+    {1, 2, 7, 0},
+    {160, 19, 0, 5081},
+    {28, 6, 5, 5075},
+    {423, 1, 1, 5076},
+    {763, 10, 0, 5079},
+    {143, 0, 2, 0},
+    {5269, 14, 7, 0},
+    {238, 0, 1, 5080},
+    {56, 18, 7, 0},
+    {31, 6, 5, 5082},
+    {33, 3, 0, 5086},
+    {72, 17, 1, 5084},
+    {44, 9, 1, 5085},
+    {8, 3, 3, 1},
+    {34, 13, 0, 5088},
+    {15, 7, 7, 0},
+    {54, 17, 2, 1},
+    {190, 10, 7, 0},
+    {15, 13, 0, 5102},
+    {7, 3, 0, 5096},
+    {65, 19, 0, 5094},
+    {85, 0, 7, 0},
+    {490, 14, 5, 5095},
+    {324, 10, 3, 1},
+    {3, 5, 1, 5097},
+    {2, 12, 0, 5100},
+    {15, 3, 2, 1},
+    {55, 10, 3, 1},
+    {11, 8, 1, 5101},
+    {264, 10, 7, 0},
+    {211, 10, 0, 5113},
+    {102, 2, 0, 5110},
+    {7, 1, 1, 5105},
+    {24, 7, 2, 0},
+    {8, 16, 2, 1},
+    {3, 4, 1, 5108},
+    {46, 6, 2, 1},
+    {159, 14, 7, 0},
+    {3, 4, 1, 5111},
+    {11, 7, 5, 5112},
+    {54, 9, 3, 1},
+    {38, 18, 0, 5116},
+    {447, 2, 2, 1},
+    {3, 15, 7, 0},
+    {347, 0, 0, 5128},
+    {12, 5, 0, 5125},
+    {69, 18, 2, 0},
+    {12, 8, 0, 5122},
+    {7, 3, 2, 0},
+    {66, 18, 3, 1},
+    {36, 17, 1, 5123},
+    {41, 9, 1, 5124},
+    {491, 14, 3, 1},
+    {170, 0, 5, 5126},
+    {3064, 2, 2, 1},
+    {505, 1, 3, 1},
+    {1674, 14, 0, 5134},
+    {77, 9, 2, 0},
+    {86, 19, 5, 5131},
+    {14, 7, 2, 0},
+    {231, 10, 1, 5133},
+    {87, 6, 7, 0},
+    {60, 17, 0, 5136},
+    {124, 1, 7, 0},
+    {1665, 2, 7, 0},
+    {37, 13, 0, 5216},
+    {52, 19, 0, 5160},
+    {33, 7, 2, 1},
+    {2, 3, 1, 5141},
+    {55, 15, 0, 5158},
+    {132, 0, 0, 5150},
+    {31, 6, 0, 5145},
+    {9, 4, 3, 1},
+    {80, 17, 0, 5148},
+    {213, 2, 2, 0},
+    {3, 15, 3, 1},
+    {18, 13, 2, 0},
+    {12, 3, 7, 0},
+    {31, 8, 2, 1},
+    {5, 3, 5, 5152},
+    {6, 12, 2, 1},
+    {-532, 19, 0, 5155},
+    {31, 13, 7, 0},
+    {188, 16, 0, 5157},
+    {8, 7, 7, 0},
+    {20, 7, 7, 0},
+    {37, 4, 5, 5159},
+    {75, 4, 3, 1},
+    {66, 18, 0, 5182},
+    {15, 3, 0, 5167},
+    {86, 16, 2, 1},
+    {12, 7, 2, 1},
+    {235, 2, 5, 5165},
+    {122, 0, 1, 5166},
+    {325, 10, 3, 1},
+    {22, 17, 0, 5171},
+    {34, 6, 2, 0},
+    {7, 4, 2, 1},
+    {51, 1, 7, 0},
+    {1921, 2, 0, 5181},
+    {63, 19, 0, 5175},
+    {797, 10, 2, 0},
+    {46, 17, 3, 1},
+    {23, 8, 2, 1},
+    {128, 1, 2, 1},
+    {5, 15, 5, 5178},
+    {45, 18, 2, 1},
+    {21, 10, 1, 5180},
+    {596, 10, 7, 0},
+    {4972, 14, 3, 1},
+    {22, 8, 0, 5202},
+    {94, 19, 0, 5189},
+    {42, 17, 1, 5185},
+    {31, 13, 0, 5188},
+    {64, 6, 1, 5187},
+    {233, 10, 3, 1},
+    {20, 7, 3, 1},
+    {12, 3, 5, 5190},
+    {775, 14, 0, 5195},
+    {4, 4, 0, 5194},
+    {11, 7, 5, 5193},
+    {61, 17, 3, 1},
+    {98, 19, 3, 1},
+    {183, 16, 0, 5200},
+    {19, 7, 1, 5197},
+    {35, 13, 2, 1},
+    {4, 15, 2, 0},
+    {32, 13, 7, 0},
+    {2473, 2, 5, 5201},
+    {29, 13, 7, 0},
+    {50, 6, 0, 5206},
+    {3, 17, 1, 5204},
+    {1394, 14, 5, 5205},
+    {2716, 10, 3, 1},
+    {135, 19, 0, 5215},
+    {143, 18, 0, 5212},
+    {237, 2, 0, 5210},
+    {124, 2, 7, 0},
+    {27, 17, 2, 1},
+    {67, 0, 3, 1},
+    {90, 9, 2, 0},
+    {75, 0, 2, 1},
+    {167, 18, 7, 0},
+    {4773, 2, 7, 0},
+    {29, 8, 0, 5247},
+    {148, 1, 0, 5224},
+    {26, 3, 2, 0},
+    {68, 16, 2, 1},
+    {91, 6, 2, 0},
+    {16, 5, 2, 1},
+    {87, 6, 1, 5223},
+    {53, 10, 7, 0},
+    {78, 9, 0, 5242},
+    {8, 5, 0, 5227},
+    {67, 18, 7, 0},
+    {301, 0, 0, 5234},
+    {27, 4, 0, 5231},
+    {38, 13, 2, 1},
+    {2526, 14, 7, 0},
+    {129, 6, 2, 0},
+    {4291, 14, 2, 1},
+    {156, 19, 3, 1},
+    {473, 0, 0, 5240},
+    {49, 9, 0, 5239},
+    {50, 7, 2, 1},
+    {45, 13, 2, 0},
+    {824, 10, 7, 0},
+    {33, 7, 7, 0},
+    {68, 9, 5, 5241},
+    {11, 3, 7, 0},
+    {354, 16, 0, 5245},
+    {91, 18, 2, 0},
+    {240, 0, 7, 0},
+    {2263, 2, 5, 5246},
+    {2172, 10, 3, 1},
+    {49, 19, 0, 5254},
+    {6, 15, 1, 5249},
+    {23, 7, 0, 5252},
+    {2301, 14, 2, 0},
+    {18, 3, 7, 0},
+    {39, 5, 5, 5253},
+    {122, 18, 7, 0},
+    {37, 1, 0, 5261},
+    {32, 7, 0, 5258},
+    {55, 18, 1, 5257},
+    {2, 4, 3, 1},
+    {974, 0, 2, 1},
+    {59, 9, 2, 0},
+    {64, 13, 3, 1},
+    {54, 6, 0, 5272},
+    {12, 17, 0, 5264},
+    {55, 8, 3, 1},
+    {60, 7, 2, 0},
+    {43, 17, 2, 1},
+    {42, 17, 2, 0},
+    {255, 1, 2, 1},
+    {1342, 2, 0, 5271},
+    {757, 0, 5, 5270},
+    {1086, 14, 7, 0},
+    {46, 13, 3, 1},
+    {132, 6, 0, 5282},
+    {75, 9, 0, 5277},
+    {218, 16, 2, 1},
+    {81, 19, 1, 5276},
+    {14, 15, 7, 0},
+    {38, 8, 2, 1},
+    {1736, 14, 5, 5279},
+    {117, 18, 0, 5281},
+    {7, 15, 3, 1},
+    {24, 4, 3, 1},
+    {156, 18, 2, 1},
+    {72, 9, 2, 0},
+    {53, 16, 1, 5285},
+    {6154, 14, 5, 5286},
+    {6832, 10, 2, 0},
+    {3561, 2, 2, 1},
+    {55, 13, 3, 1},
+    // SCDetect13
+    {7, 5, 0, 5427},
+    {71, 19, 0, 5352},
+    {24, 6, 0, 5304},
+    {2, 3, 0, 5302},
+    {204, 16, 2, 1},
+    {7, 16, 0, 5301},
+    {-21, 8, 0, 5298},
+    {24, 18, 1, 5297},
+    {10, 10, 7, 0},
+    {3, 4, 1, 5299},
+    {6, 0, 2, 0},
+    {2, 15, 3, 1},
+    {18, 18, 7, 0},
+    {1197, 14, 2, 1},
+    {1, 13, 7, 0},
+    {55, 0, 0, 5310},
+    {9, 3, 1, 5306},
+    {48, 10, 2, 0},
+    {-235, 19, 5, 5308},
+    {213, 18, 2, 1},
+    {39, 3, 3, 1},
+    {15, 3, 0, 5337},
+    {9, 8, 0, 5328},
+    {175, 0, 0, 5318},
+    {37, 15, 0, 5316},
+    {40, 13, 1, 5315},
+    {133, 6, 3, 1},
+    {2335, 2, 2, 0},
+    {3109, 14, 3, 1},
+    {30, 6, 0, 5322},
+    {28, 6, 1, 5320},
+    {3, 3, 1, 5321},
+    {14, 13, 7, 0},
+    {14, 7, 1, 5323},
+    {323, 1, 2, 0},
+    {-10, 19, 2, 0},
+    {216, 16, 2, 1},
+    {59, 18, 2, 0},
+    {388, 10, 3, 1},
+    {44, 18, 0, 5334},
+    {3, 5, 1, 5330},
+    {41, 17, 1, 5331},
+    {28, 13, 2, 0},
+    {128, 0, 5, 5333},
+    {6, 15, 3, 1},
+    {2369, 10, 1, 5335},
+    {82, 6, 2, 0},
+    {6502, 14, 3, 1},
+    {19, 4, 0, 5348},
+    {13, 8, 0, 5343},
+    {62, 18, 2, 0},
+    {26, 7, 2, 1},
+    {27, 13, 1, 5342},
+    {57, 9, 3, 1},
+    {307, 1, 2, 0},
+    {-1, 5, 5, 5345},
+    {87, 18, 0, 5347},
+    {47, 6, 3, 1},
+    {40, 19, 3, 1},
+    {41, 18, 5, 5349},
+    {43, 13, 1, 5350},
+    {1894, 10, 2, 0},
+    {111, 6, 7, 0},
+    {8, 8, 0, 5392},
+    {203, 19, 0, 5369},
+    {61, 13, 2, 1},
+    {10, 16, 0, 5359},
+    {7, 15, 1, 5357},
+    {3, 12, 2, 0},
+    {172, 1, 3, 1},
+    {6, 7, 0, 5362},
+    {735, 2, 2, 0},
+    {2, 4, 3, 1},
+    {7, 13, 5, 5363},
+    {115, 17, 0, 5367},
+    {-4, 8, 2, 0},
+    {-5, 8, 1, 5366},
+    {117, 18, 3, 1},
+    {2, 5, 1, 5368},
+    {28, 13, 7, 0},
+    {1070, 14, 2, 0},
+    {3, 8, 0, 5380},
+    {618, 10, 0, 5379},
+    {-44, 8, 0, 5374},
+    {10, 7, 7, 0},
+    {128, 9, 2, 1},
+    {438, 0, 2, 0},
+    {428, 0, 2, 1},
+    {381, 2, 1, 5378},
+    {15, 1, 7, 0},
+    {4, 15, 3, 1},
+    {266, 0, 0, 5383},
+    {229, 19, 5, 5382},
+    {9, 13, 7, 0},
+    {343, 19, 0, 5389},
+    {191, 2, 2, 0},
+    {4, 1, 0, 5388},
+    {6, 8, 1, 5387},
+    {69, 2, 7, 0},
+    {1, 5, 3, 1},
+    {55, 9, 2, 0},
+    {29, 3, 2, 1},
+    {3, 4, 3, 1},
+    {10, 7, 0, 5409},
+    {51, 18, 0, 5403},
+    {4, 16, 0, 5399},
+    {214, 19, 2, 1},
+    {70, 17, 2, 0},
+    {15, 13, 5, 5398},
+    {25, 2, 7, 0},
+    {5, 7, 1, 5400},
+    {18, 3, 5, 5401},
+    {19, 3, 2, 1},
+    {21, 13, 3, 1},
+    {285, 0, 0, 5406},
+    {6, 5, 1, 5405},
+    {53, 18, 7, 0},
+    {46, 1, 2, 1},
+    {76, 17, 1, 5408},
+    {20, 13, 3, 1},
+    {555, 10, 0, 5422},
+    {6, 4, 0, 5419},
+    {142, 19, 1, 5412},
+    {398, 14, 0, 5417},
+    {11, 1, 1, 5414},
+    {69, 6, 5, 5415},
+    {124, 17, 1, 5416},
+    {4, 15, 3, 1},
+    {249, 10, 2, 0},
+    {47, 13, 7, 0},
+    {2281, 14, 2, 0},
+    {146, 18, 5, 5421},
+    {19, 7, 7, 0},
+    {2727, 14, 2, 0},
+    {267, 0, 1, 5424},
+    {2432, 14, 2, 1},
+    {45, 13, 2, 0},
+    {10, 8, 3, 1},
+    {21, 8, 0, 5501},
+    {777, 10, 0, 5474},
+    {47, 18, 0, 5443},
+    {2, 16, 0, 5432},
+    {200, 19, 3, 1},
+    {56, 9, 0, 5435},
+    {151, 6, 2, 0},
+    {38, 17, 3, 1},
+    {251, 14, 5, 5436},
+    {560, 10, 0, 5442},
+    {3, 4, 0, 5439},
+    {83, 10, 7, 0},
+    {69, 9, 2, 1},
+    {386, 2, 2, 1},
+    {114, 0, 3, 1},
+    {9, 4, 3, 1},
+    {6, 4, 0, 5468},
+    {129, 6, 2, 0},
+    {10, 7, 0, 5448},
+    {84, 19, 2, 1},
+    {97, 10, 7, 0},
+    {15, 8, 0, 5459},
+    {31, 6, 0, 5451},
+    {237, 2, 7, 0},
+    {206, 10, 0, 5456},
+    {9, 3, 0, 5454},
+    {4, 15, 3, 1},
+    {15, 7, 1, 5455},
+    {114, 9, 3, 1},
+    {30, 7, 2, 1},
+    {13, 5, 1, 5458},
+    {1090, 14, 3, 1},
+    {151, 19, 0, 5465},
+    {28, 17, 0, 5463},
+    {12, 7, 5, 5462},
+    {28, 5, 3, 1},
+    {29, 13, 5, 5464},
+    {729, 14, 7, 0},
+    {88, 9, 5, 5466},
+    {296, 10, 2, 0},
+    {26, 13, 7, 0},
+    {46, 16, 0, 5470},
+    {401, 2, 7, 0},
+    {173, 1, 5, 5471},
+    {134, 18, 2, 1},
+    {321, 16, 2, 1},
+    {663, 14, 7, 0},
+    {14, 8, 0, 5482},
+    {87, 17, 0, 5480},
+    {55, 9, 2, 0},
+    {975, 16, 1, 5478},
+    {3, 3, 1, 5479},
+    {88, 6, 7, 0},
+    {38, 3, 1, 5481},
+    {17, 9, 3, 1},
+    {46, 0, 0, 5485},
+    {17265, 14, 1, 5484},
+    {9867, 2, 7, 0},
+    {141, 1, 0, 5487},
+    {1273, 0, 3, 1},
+    {702, 2, 5, 5488},
+    {122, 6, 2, 0},
+    {43, 17, 0, 5495},
+    {215, 1, 1, 5491},
+    {37, 13, 0, 5494},
+    {13, 5, 5, 5493},
+    {983, 10, 7, 0},
+    {42, 3, 3, 1},
+    {53, 19, 0, 5498},
+    {13392, 2, 2, 1},
+    {46, 17, 7, 0},
+    {1524, 10, 5, 5499},
+    {15, 8, 1, 5500},
+    {14, 4, 3, 1},
+    {15, 5, 0, 5543},
+    {51, 0, 0, 5506},
+    {13, 5, 1, 5504},
+    {10, 3, 1, 5505},
+    {45, 6, 7, 0},
+    {1869, 2, 0, 5535},
+    {50, 19, 0, 5514},
+    {58, 18, 0, 5510},
+    {600, 0, 3, 1},
+    {95, 6, 0, 5512},
+    {830, 10, 7, 0},
+    {130, 6, 2, 0},
+    {306, 10, 3, 1},
+    {117, 9, 0, 5534},
+    {69, 13, 0, 5533},
+    {37, 13, 0, 5524},
+    {12, 5, 2, 1},
+    {278, 2, 5, 5519},
+    {58, 17, 2, 1},
+    {67, 19, 0, 5522},
+    {3, 3, 7, 0},
+    {48, 18, 2, 1},
+    {821, 14, 3, 1},
+    {91, 19, 0, 5527},
+    {166, 0, 2, 1},
+    {9, 15, 3, 1},
+    {27, 7, 0, 5532},
+    {2207, 10, 2, 0},
+    {3045, 14, 0, 5531},
+    {10, 1, 3, 1},
+    {1575, 2, 3, 1},
+    {979, 2, 3, 1},
+    {341, 19, 3, 1},
+    {1716, 14, 3, 1},
+    {61, 19, 1, 5536},
+    {29, 13, 0, 5538},
+    {12, 4, 7, 0},
+    {15, 4, 0, 5540},
+    {21, 15, 3, 1},
+    {96, 6, 2, 1},
+    {18, 3, 5, 5542},
+    {47, 15, 3, 1},
+    {91, 9, 0, 5588},
+    {62, 19, 0, 5555},
+    {13, 15, 0, 5551},
+    {24, 8, 0, 5548},
+    {21, 7, 7, 0},
+    {17, 0, 5, 5549},
+    {54, 17, 2, 0},
+    {21, 7, 7, 0},
+    {2537, 10, 0, 5554},
+    {82, 17, 5, 5553},
+    {29, 3, 3, 1},
+    {11, 3, 3, 1},
+    {4, 4, 0, 5565},
+    {23, 16, 0, 5562},
+    {18, 5, 5, 5558},
+    {31, 17, 1, 5559},
+    {36, 3, 5, 5560},
+    {23, 7, 1, 5561},
+    {17, 9, 3, 1},
+    {47, 6, 1, 5563},
+    {44, 13, 5, 5564},
+    {51, 13, 3, 1},
+    {7, 9, 0, 5569},
+    {2127, 10, 2, 0},
+    {7, 15, 2, 1},
+    {34, 7, 7, 0},
+    {11, 4, 0, 5582},
+    {39, 17, 0, 5576},
+    {24, 3, 2, 1},
+    {266, 2, 1, 5573},
+    {624, 0, 2, 0},
+    {22, 8, 1, 5575},
+    {5, 4, 3, 1},
+    {46, 13, 5, 5577},
+    {121, 19, 0, 5579},
+    {697, 2, 7, 0},
+    {491, 0, 5, 5580},
+    {464, 19, 1, 5581},
+    {780, 14, 3, 1},
+    {1452, 14, 0, 5586},
+    {32, 8, 2, 1},
+    {734, 10, 2, 0},
+    {25, 3, 7, 0},
+    {10398, 16, 5, 5587},
+    {75, 0, 3, 1},
+    {26, 8, 0, 5595},
+    {4270, 14, 0, 5594},
+    {34, 10, 5, 5591},
+    {2, 17, 2, 0},
+    {117, 0, 1, 5593},
+    {949, 10, 3, 1},
+    {5284, 10, 7, 0},
+    {163, 16, 0, 5608},
+    {709, 10, 0, 5603},
+    {28, 7, 0, 5601},
+    {5, 4, 2, 1},
+    {25, 3, 2, 1},
+    {246, 2, 7, 0},
+    {7, 17, 5, 5602},
+    {62, 6, 3, 1},
+    {354, 19, 2, 1},
+    {1718, 10, 2, 1},
+    {21, 5, 2, 0},
+    {742, 2, 2, 0},
+    {40, 13, 3, 1},
+    {1650, 14, 5, 5609},
+    {40, 8, 0, 5617},
+    {150, 0, 0, 5614},
+    {87, 18, 5, 5612},
+    {12, 17, 1, 5613},
+    {115, 0, 7, 0},
+    {33, 8, 2, 1},
+    {2511, 10, 2, 1},
+    {138, 19, 3, 1},
+    {40, 5, 5, 5618},
+    {101, 3, 5, 5619},
+    {1861, 10, 3, 1},
+    // SCDetect14
+    {69, 16, 0, 5774},
+    {8, 8, 0, 5682},
+    {66, 17, 0, 5651},
+    {3, 8, 0, 5644},
+    {30, 7, 0, 5642},
+    {24, 6, 0, 5631},
+    {5, 16, 0, 5628},
+    {35, 18, 3, 1},
+    {2, 9, 2, 0},
+    {2, 19, 2, 0},
+    {2, 15, 3, 1},
+    {4, 3, 1, 5632},
+    {223, 0, 1, 5633},
+    {225, 0, 0, 5635},
+    {47, 17, 3, 1},
+    {129, 18, 2, 0},
+    {128, 18, 2, 1},
+    {4, 4, 1, 5638},
+    {47, 6, 2, 0},
+    {9, 11, 1, 5640},
+    {863, 10, 2, 0},
+    {732, 2, 7, 0},
+    {1239, 2, 1, 5643},
+    {272, 0, 7, 0},
+    {63, 3, 0, 5650},
+    {71, 10, 0, 5648},
+    {252, 0, 1, 5647},
+    {33, 18, 7, 0},
+    {10, 5, 1, 5649},
+    {48, 16, 3, 1},
+    {128, 9, 3, 1},
+    {974, 14, 0, 5675},
+    {38, 16, 0, 5673},
+    {26, 18, 0, 5657},
+    {3, 1, 2, 1},
+    {84, 3, 1, 5656},
+    {6, 2, 7, 0},
+    {59, 9, 2, 1},
+    {-1668, 16, 5, 5659},
+    {99, 19, 0, 5667},
+    {1, 9, 0, 5664},
+    {226, 6, 1, 5662},
+    {-13, 8, 1, 5663},
+    {226, 18, 7, 0},
+    {36, 18, 2, 0},
+    {17, 13, 1, 5666},
+    {36, 9, 3, 1},
+    {7, 8, 0, 5671},
+    {163, 3, 2, 1},
+    {53, 9, 1, 5670},
+    {572, 14, 3, 1},
+    {15, 13, 5, 5672},
+    {429, 2, 3, 1},
+    {415, 2, 5, 5674},
+    {38, 18, 7, 0},
+    {4, 5, 0, 5681},
+    {1443, 14, 2, 0},
+    {197, 1, 0, 5680},
+    {28, 18, 2, 0},
+    {11, 7, 7, 0},
+    {1428, 14, 3, 1},
+    {58, 13, 3, 1},
+    {84, 0, 0, 5691},
+    {6, 5, 1, 5684},
+    {58, 10, 0, 5687},
+    {2, 1, 2, 1},
+    {25, 13, 3, 1},
+    {16, 4, 2, 1},
+    {10, 5, 1, 5689},
+    {24, 6, 5, 5690},
+    {73, 19, 3, 1},
+    {741, 10, 0, 5771},
+    {86, 19, 0, 5713},
+    {62, 17, 0, 5699},
+    {118, 0, 2, 0},
+    {18, 3, 1, 5696},
+    {573, 14, 2, 0},
+    {411, 14, 1, 5698},
+    {388, 2, 7, 0},
+    {46, 3, 0, 5710},
+    {6, 3, 0, 5704},
+    {141, 10, 0, 5703},
+    {21, 13, 7, 0},
+    {227, 0, 7, 0},
+    {100, 18, 2, 0},
+    {173, 0, 0, 5707},
+    {53, 6, 7, 0},
+    {-1, 5, 5, 5708},
+    {925, 14, 2, 1},
+    {705, 2, 3, 1},
+    {113, 17, 1, 5711},
+    {7, 5, 5, 5712},
+    {179, 1, 3, 1},
+    {44, 18, 0, 5729},
+    {15, 3, 0, 5721},
+    {97, 9, 2, 0},
+    {276, 2, 0, 5719},
+    {96, 19, 2, 1},
+    {5, 1, 3, 1},
+    {353, 2, 2, 1},
+    {6, 7, 7, 0},
+    {18, 3, 0, 5723},
+    {273, 19, 3, 1},
+    {287, 19, 0, 5726},
+    {4, 5, 2, 1},
+    {9, 11, 7, 0},
+    {106, 6, 2, 0},
+    {-5, 16, 1, 5728},
+    {70, 17, 3, 1},
+    {5, 5, 0, 5732},
+    {37, 16, 1, 5731},
+    {90, 18, 3, 1},
+    {7, 3, 0, 5735},
+    {43, 17, 2, 1},
+    {32, 8, 7, 0},
+    {70, 13, 2, 1},
+    {16, 16, 0, 5756},
+    {3, 12, 0, 5753},
+    {49, 13, 2, 0},
+    {6, 17, 1, 5740},
+    {4, 16, 0, 5747},
+    {119, 2, 0, 5746},
+    {1, 1, 1, 5743},
+    {9, 5, 2, 1},
+    {15, 13, 5, 5745},
+    {22, 1, 3, 1},
+    {211, 14, 7, 0},
+    {260, 2, 0, 5751},
+    {3, 4, 5, 5749},
+    {266, 0, 5, 5750},
+    {24, 8, 3, 1},
+    {18, 13, 1, 5752},
+    {459, 14, 7, 0},
+    {4, 12, 2, 1},
+    {13, 7, 2, 0},
+    {624, 0, 3, 1},
+    {3, 12, 0, 5759},
+    {134, 19, 2, 1},
+    {22, 8, 7, 0},
+    {934, 14, 0, 5767},
+    {107, 3, 2, 0},
+    {8, 5, 1, 5762},
+    {32, 8, 2, 1},
+    {48, 6, 2, 1},
+    {67, 18, 1, 5765},
+    {16, 7, 5, 5766},
+    {753, 14, 7, 0},
+    {26, 7, 2, 0},
+    {49, 16, 2, 1},
+    {90, 9, 2, 0},
+    {21, 8, 3, 1},
+    {20, 5, 1, 5772},
+    {24, 3, 5, 5773},
+    {3004, 10, 3, 1},
+    {21, 8, 0, 5840},
+    {60, 18, 0, 5797},
+    {45, 0, 0, 5783},
+    {638, 16, 0, 5781},
+    {1155, 2, 2, 0},
+    {934, 2, 2, 1},
+    {14, 4, 3, 1},
+    {6, 7, 5, 5782},
+    {10, 5, 3, 1},
+    {516, 16, 0, 5795},
+    {10, 8, 0, 5788},
+    {229, 14, 5, 5786},
+    {37, 18, 2, 0},
+    {28, 13, 3, 1},
+    {14, 4, 2, 1},
+    {458, 2, 5, 5790},
+    {43, 19, 1, 5791},
+    {18, 3, 2, 0},
+    {6, 15, 1, 5793},
+    {65, 9, 5, 5794},
+    {764, 2, 7, 0},
+    {7396, 14, 5, 5796},
+    {17, 3, 7, 0},
+    {9, 5, 0, 5816},
+    {1833, 14, 0, 5807},
+    {25, 13, 1, 5800},
+    {4, 3, 0, 5804},
+    {541, 10, 2, 0},
+    {254, 1, 2, 1},
+    {171, 10, 3, 1},
+    {960, 0, 2, 1},
+    {68, 18, 2, 0},
+    {28, 13, 3, 1},
+    {55, 0, 1, 5808},
+    {1109, 16, 0, 5813},
+    {1260, 2, 2, 0},
+    {35, 13, 1, 5811},
+    {202, 16, 1, 5812},
+    {735, 1, 7, 0},
+    {3730, 10, 2, 0},
+    {68, 9, 2, 1},
+    {4691, 14, 7, 0},
+    {2, 3, 0, 5818},
+    {2786, 14, 7, 0},
+    {1542, 14, 5, 5819},
+    {75, 19, 0, 5831},
+    {29, 13, 0, 5823},
+    {4, 4, 2, 0},
+    {47, 9, 7, 0},
+    {57, 6, 1, 5824},
+    {118, 18, 0, 5829},
+    {39, 17, 0, 5827},
+    {59, 6, 7, 0},
+    {23, 7, 2, 1},
+    {5898, 14, 7, 0},
+    {35, 4, 1, 5830},
+    {5177, 10, 7, 0},
+    {784, 16, 0, 5839},
+    {769, 1, 2, 0},
+    {87, 18, 0, 5837},
+    {52, 6, 0, 5836},
+    {2181, 14, 7, 0},
+    {1518, 10, 7, 0},
+    {424, 1, 2, 1},
+    {85, 19, 7, 0},
+    {79, 19, 3, 1},
+    {78, 18, 0, 5860},
+    {32, 13, 0, 5850},
+    {23, 7, 2, 0},
+    {62, 19, 0, 5848},
+    {16, 15, 2, 1},
+    {104, 10, 5, 5846},
+    {15, 5, 1, 5847},
+    {1148, 10, 3, 1},
+    {22, 13, 1, 5849},
+    {2, 4, 3, 1},
+    {48, 18, 0, 5855},
+    {31, 15, 0, 5854},
+    {40, 13, 5, 5853},
+    {23, 3, 3, 1},
+    {12617, 2, 3, 1},
+    {10, 19, 0, 5857},
+    {1594, 2, 7, 0},
+    {27, 8, 2, 1},
+    {87, 6, 5, 5859},
+    {37, 13, 7, 0},
+    {13, 5, 0, 5872},
+    {107, 0, 1, 5862},
+    {29, 7, 2, 0},
+    {107, 19, 0, 5867},
+    {30, 13, 5, 5865},
+    {30, 8, 1, 5866},
+    {115, 18, 7, 0},
+    {214, 10, 0, 5870},
+    {64, 9, 1, 5869},
+    {8, 2, 3, 1},
+    {3089, 2, 5, 5871},
+    {3240, 10, 3, 1},
+    {57, 19, 0, 5883},
+    {56, 13, 0, 5881},
+    {104, 18, 0, 5876},
+    {275, 16, 3, 1},
+    {6215, 1, 0, 5880},
+    {8, 3, 2, 0},
+    {48, 17, 2, 0},
+    {126, 6, 3, 1},
+    {56, 4, 7, 0},
+    {96, 9, 5, 5882},
+    {984, 2, 7, 0},
+    {351, 16, 0, 5895},
+    {4, 17, 0, 5886},
+    {53, 13, 3, 1},
+    {95, 9, 0, 5891},
+    {3173, 14, 2, 0},
+    {413, 19, 5, 5889},
+    {53, 17, 2, 1},
+    {77, 9, 3, 1},
+    {97, 9, 1, 5892},
+    {158, 16, 2, 1},
+    {1534, 14, 5, 5894},
+    {213, 1, 3, 1},
+    {17, 5, 0, 5898},
+    {39, 17, 2, 1},
+    {2166, 2, 7, 0},
+    {125, 9, 0, 5901},
+    {10398, 16, 5, 5900},
+    {69, 4, 3, 1},
+    {844, 10, 7, 0},
+    // SCDetect15
+    {1116, 10, 0, 6126},
+    {65, 19, 0, 5981},
+    {64, 16, 0, 5959},
+    {5, 5, 0, 5930},
+    {2, 9, 0, 5916},
+    {5, 16, 0, 5913},
+    {11, 1, 0, 5911},
+    {229, 6, 1, 5910},
+    {3, 7, 3, 1},
+    {11, 0, 2, 0},
+    {3, 0, 3, 1},
+    {20, 18, 2, 0},
+    {687, 2, 5, 5915},
+    {1728, 14, 3, 1},
+    {18, 3, 0, 5925},
+    {145, 0, 1, 5918},
+    {51, 6, 2, 0},
+    {8, 8, 0, 5924},
+    {14, 7, 0, 5923},
+    {1538, 0, 1, 5922},
+    {137, 10, 7, 0},
+    {53, 17, 3, 1},
+    {79, 10, 7, 0},
+    {1, 12, 0, 5928},
+    {20, 3, 5, 5927},
+    {4, 13, 7, 0},
+    {116, 2, 2, 0},
+    {111, 2, 3, 1},
+    {993, 14, 0, 5956},
+    {47, 18, 0, 5938},
+    {826, 14, 0, 5937},
+    {5, 19, 2, 0},
+    {63, 1, 2, 1},
+    {-6, 8, 5, 5936},
+    {46, 17, 3, 1},
+    {6, 5, 3, 1},
+    {25, 6, 0, 5940},
+    {42, 13, 7, 0},
+    {18, 1, 0, 5947},
+    {46, 3, 0, 5945},
+    {8, 16, 1, 5943},
+    {40, 19, 1, 5944},
+    {31, 13, 7, 0},
+    {239, 14, 2, 0},
+    {32, 10, 3, 1},
+    {58, 13, 2, 1},
+    {54, 19, 0, 5955},
+    {18, 8, 1, 5950},
+    {60, 6, 1, 5951},
+    {11, 7, 1, 5952},
+    {921, 14, 2, 0},
+    {244, 10, 5, 5954},
+    {-1, 19, 3, 1},
+    {155, 2, 3, 1},
+    {108, 1, 1, 5957},
+    {1355, 14, 2, 0},
+    {1268, 14, 3, 1},
+    {1424, 14, 0, 5967},
+    {31, 13, 0, 5964},
+    {12, 4, 1, 5962},
+    {43, 0, 5, 5963},
+    {4, 3, 7, 0},
+    {93, 18, 2, 0},
+    {89, 17, 5, 5966},
+    {156, 2, 7, 0},
+    {13, 8, 0, 5971},
+    {1024, 2, 2, 0},
+    {6, 5, 1, 5970},
+    {6, 4, 3, 1},
+    {9, 5, 0, 5974},
+    {3, 4, 5, 5973},
+    {40, 6, 7, 0},
+    {1069, 2, 1, 5975},
+    {17, 3, 0, 5978},
+    {164, 1, 2, 1},
+    {692, 10, 7, 0},
+    {48, 13, 2, 1},
+    {53, 3, 1, 5980},
+    {1398, 2, 7, 0},
+    {10, 8, 0, 6027},
+    {41, 18, 0, 6009},
+    {2, 16, 0, 5997},
+    {105, 19, 1, 5985},
+    {4, 11, 1, 5986},
+    {48, 1, 2, 1},
+    {101, 2, 2, 0},
+    {62, 3, 0, 5996},
+    {91, 14, 0, 5994},
+    {8, 8, 2, 1},
+    {38, 17, 2, 0},
+    {405, 0, 1, 5993},
+    {9, 13, 3, 1},
+    {193, 14, 5, 5995},
+    {9, 7, 3, 1},
+    {9, 10, 7, 0},
+    {77, 17, 0, 6005},
+    {7, 8, 2, 1},
+    {59, 2, 1, 6000},
+    {6, 4, 0, 6004},
+    {38, 18, 2, 0},
+    {39, 9, 2, 1},
+    {371, 2, 3, 1},
+    {5, 8, 3, 1},
+    {3, 5, 0, 6008},
+    {9, 15, 1, 6007},
+    {18, 7, 3, 1},
+    {30, 18, 7, 0},
+    {11, 7, 0, 6015},
+    {132, 3, 2, 1},
+    {30, 17, 2, 0},
+    {9, 7, 1, 6013},
+    {104, 19, 2, 0},
+    {8, 3, 7, 0},
+    {57, 16, 0, 6023},
+    {42, 6, 0, 6018},
+    {2, 4, 3, 1},
+    {4, 2, 0, 6020},
+    {-2, 8, 3, 1},
+    {526, 10, 1, 6021},
+    {19, 7, 1, 6022},
+    {555, 10, 7, 0},
+    {106, 16, 2, 0},
+    {6, 8, 1, 6025},
+    {63, 18, 2, 1},
+    {575, 2, 7, 0},
+    {7, 4, 0, 6103},
+    {15, 3, 0, 6050},
+    {5, 5, 0, 6033},
+    {41, 18, 5, 6031},
+    {75, 9, 1, 6032},
+    {418, 10, 3, 1},
+    {230, 2, 0, 6039},
+    {-1, 16, 1, 6035},
+    {101, 9, 2, 0},
+    {3, 16, 2, 1},
+    {2, 12, 5, 6038},
+    {10, 3, 7, 0},
+    {73, 19, 0, 6041},
+    {24, 1, 7, 0},
+    {5, 3, 5, 6042},
+    {34, 16, 0, 6047},
+    {608, 14, 1, 6044},
+    {7, 5, 1, 6045},
+    {463, 10, 2, 0},
+    {17, 13, 3, 1},
+    {6, 5, 2, 1},
+    {193, 10, 5, 6049},
+    {366, 2, 7, 0},
+    {56, 17, 0, 6084},
+    {86, 18, 0, 6066},
+    {24, 8, 0, 6060},
+    {149, 14, 5, 6054},
+    {4, 4, 1, 6055},
+    {93, 9, 1, 6056},
+    {31, 6, 5, 6057},
+    {23, 13, 1, 6058},
+    {5, 4, 5, 6059},
+    {335, 10, 7, 0},
+    {33, 7, 2, 0},
+    {18, 3, 5, 6062},
+    {2, 4, 1, 6063},
+    {28, 8, 0, 6065},
+    {216, 10, 7, 0},
+    {32, 6, 3, 1},
+    {21, 16, 0, 6074},
+    {9, 5, 1, 6068},
+    {25, 1, 2, 0},
+    {19, 17, 2, 1},
+    {5, 1, 1, 6071},
+    {144, 18, 0, 6073},
+    {293, 10, 7, 0},
+    {10, 5, 7, 0},
+    {121, 9, 0, 6082},
+    {217, 1, 0, 6079},
+    {1010, 14, 5, 6077},
+    {53, 1, 1, 6078},
+    {26, 8, 3, 1},
+    {5, 4, 5, 6080},
+    {29, 17, 2, 0},
+    {361, 1, 7, 0},
+    {128, 9, 2, 1},
+    {59, 13, 3, 1},
+    {4, 16, 0, 6091},
+    {203, 6, 2, 0},
+    {1, 10, 5, 6087},
+    {16, 8, 1, 6088},
+    {24, 7, 2, 0},
+    {33, 14, 1, 6090},
+    {208, 10, 7, 0},
+    {17, 8, 0, 6096},
+    {24, 7, 2, 0},
+    {98, 17, 0, 6095},
+    {11, 8, 7, 0},
+    {20, 3, 3, 1},
+    {84, 18, 0, 6100},
+    {4, 4, 2, 1},
+    {41, 13, 5, 6099},
+    {63, 18, 3, 1},
+    {26, 8, 0, 6102},
+    {232, 10, 7, 0},
+    {121, 19, 3, 1},
+    {20, 8, 0, 6113},
+    {63, 18, 0, 6108},
+    {47, 17, 2, 1},
+    {100, 19, 2, 1},
+    {11, 4, 3, 1},
+    {95, 19, 1, 6109},
+    {148, 18, 2, 1},
+    {106, 19, 5, 6111},
+    {74, 6, 2, 0},
+    {17, 3, 7, 0},
+    {5, 17, 0, 6116},
+    {63, 13, 2, 1},
+    {139, 3, 3, 1},
+    {29, 8, 0, 6122},
+    {23, 7, 0, 6120},
+    {8, 4, 2, 1},
+    {80, 19, 3, 1},
+    {112, 16, 1, 6121},
+    {29, 9, 3, 1},
+    {646, 0, 5, 6123},
+    {69, 9, 5, 6124},
+    {133, 6, 2, 0},
+    {5, 15, 3, 1},
+    {12, 5, 0, 6163},
+    {69, 0, 0, 6137},
+    {44, 6, 0, 6133},
+    {649, 1, 0, 6132},
+    {3, 8, 1, 6131},
+    {25, 18, 7, 0},
+    {12, 7, 7, 0},
+    {37, 15, 1, 6134},
+    {3914, 14, 2, 0},
+    {9, 13, 5, 6136},
+    {3568, 14, 3, 1},
+    {253, 16, 0, 6144},
+    {31, 7, 0, 6143},
+    {9, 5, 1, 6140},
+    {52, 17, 1, 6141},
+    {203, 1, 5, 6142},
+    {2364, 14, 7, 0},
+    {111, 6, 7, 0},
+    {49, 18, 0, 6148},
+    {4226, 10, 2, 0},
+    {9, 11, 2, 1},
+    {2441, 10, 3, 1},
+    {424, 0, 0, 6162},
+    {37, 15, 0, 6156},
+    {21, 7, 0, 6153},
+    {51, 18, 2, 0},
+    {1511, 2, 7, 0},
+    {812, 16, 2, 1},
+    {79, 18, 2, 0},
+    {4402, 14, 7, 0},
+    {53, 19, 1, 6157},
+    {49, 13, 2, 0},
+    {7, 12, 0, 6161},
+    {14, 8, 2, 1},
+    {7881, 14, 7, 0},
+    {64, 15, 7, 0},
+    {5, 8, 3, 1},
+    {25, 8, 0, 6178},
+    {65, 19, 0, 6172},
+    {61, 15, 2, 1},
+    {61, 13, 2, 1},
+    {25, 5, 2, 1},
+    {408, 16, 1, 6169},
+    {46, 0, 0, 6171},
+    {2319, 2, 7, 0},
+    {75, 0, 7, 0},
+    {9051, 14, 2, 0},
+    {14, 3, 5, 6174},
+    {223, 19, 2, 1},
+    {16, 5, 1, 6176},
+    {81, 9, 5, 6177},
+    {2675, 10, 3, 1},
+    {27, 17, 0, 6189},
+    {27, 5, 0, 6184},
+    {8, 17, 1, 6181},
+    {2012, 2, 0, 6183},
+    {195, 16, 3, 1},
+    {77, 18, 7, 0},
+    {69, 13, 2, 0},
+    {1, 17, 0, 6187},
+    {35, 8, 7, 0},
+    {33, 5, 2, 1},
+    {2054, 10, 7, 0},
+    {55, 19, 0, 6193},
+    {47, 0, 1, 6191},
+    {57, 17, 5, 6192},
+    {1308, 2, 7, 0},
+    {131, 1, 1, 6194},
+    {6645, 14, 5, 6195},
+    {121, 17, 2, 0},
+    {75, 0, 2, 1},
+    {8537, 1, 7, 0},
+};
+
+const mfxU16 SCDetectForestRoots[21] = {
+    0,
+    303,
+    607,
+    892,
+    1187,
+    1497,
+    1797,
+    2080,
+    2371,
+    2649,
+    2964,
+    3267,
+    3545,
+    3844,
+    4141,
+    4441,
+    4714,
+    5009,
+    5289,
+    5620,
+    5902,
+};
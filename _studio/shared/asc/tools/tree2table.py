@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Converts decision trees exported as C if-cascades into flat node tables.
+
+Every function of the input file is one tree:
+
+    bool SCDetect1(mfxU32 MVDiff, mfxI32 diffTSC, ...) {
+        if (diffTSC < 7) {
+            if (MVDiff <= 93) return 1;
+            else if (MVDiff > 93) { ... }
+        }
+        ...
+        return 0;
+    }
+
+Conditions compare one parameter with an integer constant using <, <=, > or >=.
+Statements are if/else chains, blocks and "return <int>;", a branch which does
+not return falls through to the next statement as in C.
+
+Each tree becomes an array of 8 byte nodes in pre-order, see ASCTreeNode in
+asc/include/tree.h. A node sends features[feature] < threshold to the node that
+follows it and the rest to node "next". With --forest all trees are stored in
+one array, "next" indexes that array and the root of every tree is listed in
+<forest>Roots, so a batched evaluator can walk several trees with one base. Leaves are folded into their parent:
+TREE_LEFT_LEAF / TREE_RIGHT_LEAF flags mark a child that is a decision, the left
+decision is kept in the upper flag bits, the right one in "next". Comparisons
+decided by an earlier condition on the same path and splits with equal
+decisions on both sides are dropped.
+"""
+
+import argparse
+import re
+import sys
+
+TOKEN = re.compile(r'\s*(?:(/\*.*?\*/|//[^\n]*)|([A-Za-z_]\w*)|(-?\d+)|(<=|>=|==|<|>)|(.))', re.S)
+
+LEFT_LEAF = 1
+RIGHT_LEAF = 2
+LEAF_SHIFT = 2
+MAX_LEAF_VALUE = (0xff >> LEAF_SHIFT)
+
+
+def tokenize(text):
+    tokens = []
+    pos = 0
+    while pos < len(text):
+        m = TOKEN.match(text, pos)
+        if not m or m.end() == pos:
+            break
+        pos = m.end()
+        comment, ident, number, op, punct = m.groups()
+        if comment:
+            continue
+        if ident:
+            tokens.append(('id', ident))
+        elif number:
+            tokens.append(('num', int(number)))
+        elif op:
+            tokens.append(('op', op))
+        elif punct and not punct.isspace():
+            tokens.append(('p', punct))
+    return tokens
+
+
+class Parser:
+    def __init__(self, tokens):
+        self.tokens = tokens
+        self.pos = 0
+
+    def peek(self, offset=0):
+        i = self.pos + offset
+        return self.tokens[i] if i < len(self.tokens) else (None, None)
+
+    def take(self, kind=None, value=None):
+        tok = self.peek()
+        if tok[0] is None:
+            raise SyntaxError('unexpected end of file')
+        if (kind and tok[0] != kind) or (value is not None and tok[1] != value):
+            raise SyntaxError('expected %s %s, got %s at token %d' % (kind, value, tok, self.pos))
+        self.pos += 1
+        return tok[1]
+
+    def functions(self, match):
+        # <type> <name> ( <params> ) { <body> }, other functions are skipped
+        while self.peek()[0]:
+            if self.peek()[0] == 'id' and self.peek(1)[0] == 'id' and self.peek(2) == ('p', '('):
+                rtype = self.take('id')
+                name = self.take('id')
+                params = self.params()
+                if self.peek() == ('p', '{'):
+                    if match.fullmatch(name):
+                        yield rtype, name, params, self.block()
+                    else:
+                        self.skip_block()
+                    continue
+            self.pos += 1
+
+    def skip_block(self):
+        depth = 0
+        while True:
+            tok = self.take()
+            depth += (tok == '{') - (tok == '}')
+            if not depth:
+                return
+
+    def params(self):
+        self.take('p', '(')
+        params = []
+        while self.peek() != ('p', ')'):
+            ptype = self.take('id')
+            pname = self.take('id') if self.peek()[0] == 'id' else None
+            params.append((ptype, pname))
+            if self.peek() == ('p', ','):
+                self.take('p', ',')
+        self.take('p', ')')
+        return params
+
+    def block(self):
+        self.take('p', '{')
+        stmts = []
+        while self.peek() != ('p', '}'):
+            stmts.append(self.statement())
+        self.take('p', '}')
+        return ('block', stmts)
+
+    def statement(self):
+        tok = self.peek()
+        if tok == ('p', '{'):
+            return self.block()
+        if tok == ('p', ';'):
+            self.take()
+            return ('block', [])
+        if tok == ('id', 'return'):
+            self.take()
+            value = self.take('num')
+            self.take('p', ';')
+            return ('return', value)
+        if tok == ('id', 'if'):
+            self.take()
+            self.take('p', '(')
+            var = self.take('id')
+            op = self.take('op')
+            value = self.take('num')
+            self.take('p', ')')
+            then = self.statement()
+            other = ('block', [])
+            if self.peek() == ('id', 'else'):
+                self.take()
+                other = self.statement()
+            return ('if', var, op, value, then, other)
+        raise SyntaxError('unexpected %s at token %d' % (tok, self.pos))
+
+
+class Leaf:
+    def __init__(self, value):
+        self.value = value
+
+
+class Node:
+    def __init__(self, feature, threshold, less, greater):
+        self.feature = feature
+        self.threshold = threshold
+        self.less = less
+        self.greater = greater
+
+
+def split(feature, threshold, less, greater, bounds):
+    # feature < threshold goes to less, bounds are [lo, hi) known on the current path
+    lo, hi = bounds.get(feature, (None, None))
+    if lo is not None and lo >= threshold:
+        return greater(bounds)
+    if hi is not None and hi <= threshold:
+        return less(bounds)
+
+    lessBounds = dict(bounds)
+    lessBounds[feature] = (lo, threshold if hi is None else min(hi, threshold))
+    greaterBounds = dict(bounds)
+    greaterBounds[feature] = (threshold if lo is None else max(lo, threshold), hi)
+
+    return Node(feature, threshold, less(lessBounds), greater(greaterBounds))
+
+
+def compile_statements(stmts, features, cont, bounds):
+    if not stmts:
+        return cont(bounds)
+
+    stmt, rest = stmts[0], stmts[1:]
+    after = lambda b: compile_statements(rest, features, cont, b)
+
+    if stmt[0] == 'return':
+        return Leaf(stmt[1])
+    if stmt[0] == 'block':
+        return compile_statements(stmt[1] + rest, features, cont, bounds)
+
+    _, var, op, value, then, other = stmt
+    if var not in features:
+        raise ValueError('%s is not in the feature list' % var)
+
+    taken = lambda b: compile_statements([then], features, after, b)
+    skipped = lambda b: compile_statements([other], features, after, b)
+
+    # integer comparisons are turned to feature < threshold
+    if op == '<':
+        return split(features[var], value, taken, skipped, bounds)
+    if op == '>=':
+        return split(features[var], value, skipped, taken, bounds)
+    if op == '<=':
+        return split(features[var], value + 1, taken, skipped, bounds)
+    if op == '>':
+        return split(features[var], value + 1, skipped, taken, bounds)
+    raise ValueError('unsupported comparison %s' % op)
+
+
+def simplify(node, unsigned, boolean):
+    # runtime compares features as signed 32 bit with unsigned ones saturated,
+    # which is exact for non-negative thresholds. C compares unsigned
+    # parameters with negative constants as unsigned
+    if isinstance(node, Leaf):
+        return Leaf(int(node.value != 0)) if boolean else node
+    if node.feature in unsigned and node.threshold < 0:
+        raise ValueError('negative threshold %d on unsigned feature %d' % (node.threshold, node.feature))
+
+    node.less = simplify(node.less, unsigned, boolean)
+    node.greater = simplify(node.greater, unsigned, boolean)
+
+    # split which doesn't change the decision
+    if isinstance(node.less, Leaf) and isinstance(node.greater, Leaf) and node.less.value == node.greater.value:
+        return node.less
+    return node
+
+
+def flatten(root, base=0):
+    # "next" of the emitted nodes is offset by base, the index of the root
+    nodes = []
+
+    def leaf_value(leaf):
+        if not 0 <= leaf.value <= MAX_LEAF_VALUE:
+            raise ValueError('decision %d does not fit node flags' % leaf.value)
+        return leaf.value
+
+    def emit(node):
+        index = len(nodes)
+        entry = [node.threshold, node.feature, 0, 0]
+        nodes.append(entry)
+
+        if isinstance(node.less, Leaf):
+            entry[2] |= LEFT_LEAF | (leaf_value(node.less) << LEAF_SHIFT)
+        else:
+            emit(node.less)
+
+        if isinstance(node.greater, Leaf):
+            entry[2] |= RIGHT_LEAF
+            entry[3] = leaf_value(node.greater)
+        else:
+            entry[3] = base + len(nodes)
+            emit(node.greater)
+
+        return index
+
+    if isinstance(root, Leaf):
+        # constant tree, both children are the same decision
+        root = Node(0, 0, root, root)
+    emit(root)
+
+    if base + len(nodes) > 0xffff:
+        raise ValueError('%d nodes, node index does not fit 16 bit' % (base + len(nodes)))
+    for threshold, _, _, _ in nodes:
+        if not -2**31 <= threshold < 2**31:
+            raise ValueError('threshold %d does not fit 32 bit' % threshold)
+    return nodes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='C++ file with if-cascade trees')
+    parser.add_argument('output', help='generated C++ file')
+    parser.add_argument('--features', required=True,
+                        help='comma separated parameter names in the order of the runtime feature array')
+    parser.add_argument('--match', default='.*', help='regular expression for names of tree functions')
+    parser.add_argument('--forest', help='name of the single node array of all trees')
+    parser.add_argument('--suffix', default='Tree', help='appended to function names to name node arrays')
+    parser.add_argument('--node', default='ASCTreeNode', help='node type')
+    parser.add_argument('--include', action='append', default=[], help='header to include')
+    parser.add_argument('--namespace', help='namespace of generated arrays')
+    parser.add_argument('--guard', help='macro the generated code depends on')
+    parser.add_argument('--copyright', default='2025', help='copyright years')
+    args = parser.parse_args()
+
+    features = {name: index for index, name in enumerate(args.features.split(','))}
+
+    with open(args.input) as f:
+        trees = list(Parser(tokenize(f.read())).functions(re.compile(args.match)))
+
+    out = []
+    out.append('// Copyright (c) %s Intel Corporation' % args.copyright)
+    with open(__file__) as f:
+        license_lines = [l[1:].rstrip() for l in f.read().split('\n')[2:20]]
+    out += ['//' + l for l in license_lines]
+    out.append('')
+    out.append('// Generated by asc/tools/tree2table.py, do not edit.')
+    out.append('// Features: %s' % ', '.join(args.features.split(',')))
+    out.append('')
+    for header in args.include:
+        out.append('#include "%s"' % header)
+    out.append('')
+    if args.guard:
+        out.append('#if defined(%s)' % args.guard)
+        out.append('')
+    if args.namespace:
+        out.append('namespace %s {' % args.namespace)
+        out.append('')
+
+    names = []
+    roots = []
+    trees_out = []
+    total = 0
+    for rtype, name, params, body in trees:
+        unsigned = set()
+        for ptype, pname in params:
+            if pname and pname not in features:
+                raise ValueError('%s: parameter %s is not in the feature list' % (name, pname))
+            if pname and ptype.startswith('mfxU'):
+                unsigned.add(features[pname])
+
+        root = compile_statements([body], features, lambda b: Leaf(0), {})
+        root = simplify(root, unsigned, rtype == 'bool')
+        nodes = flatten(root, total if args.forest else 0)
+
+        names.append(name + args.suffix)
+        roots.append(total)
+        total += len(nodes)
+
+        if args.forest:
+            trees_out.append('    // %s' % name)
+        else:
+            trees_out.append('const %s %s[%d] = {' % (args.node, names[-1], len(nodes)))
+        for threshold, feature, flags, nxt in nodes:
+            trees_out.append('    {%d, %d, %d, %d},' % (threshold, feature, flags, nxt))
+        if not args.forest:
+            trees_out.append('};')
+            trees_out.append('')
+
+    if args.forest:
+        out.append('const %s %s[%d] = {' % (args.node, args.forest, total))
+        out += trees_out
+        out.append('};')
+        out.append('')
+        out.append('const mfxU16 %sRoots[%d] = {' % (args.forest, len(roots)))
+        out += ['    %d,' % root for root in roots]
+        out.append('};')
+        out.append('')
+    else:
+        out += trees_out
+
+    if args.namespace:
+        out.append('} // namespace %s' % args.namespace)
+        out.append('')
+    if args.guard:
+        out.append('#endif // %s' % args.guard)
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out).rstrip() + '\n')
+
+    sys.stderr.write('%s: %d trees, %d nodes\n' % (args.output, len(names), total))
+
+
+if __name__ == '__main__':
+    sys.setrecursionlimit(100000)
+    main()
@@ -28,9 +28,12 @@
 #include "mfx_trace.h"
 #include "mfxdefs.h"
 #include <algorithm>
+#include <atomic>
 #include "umc_mutex.h"
 #include "fast_copy_c_impl.h"
 #include "fast_copy_sse4_impl.h"
+#include "fast_copy_avx2_impl.h"
+#include "fast_copy_avx512_impl.h"
 
 enum
 {
@@ -43,23 +46,35 @@ typedef void(*t_copyVideoToSys)(const mfxU8* src, mfxU8* dst, int width);
 typedef void(*t_copyVideoToSysShift)(const mfxU16* src, mfxU16* dst, int width, int shift);	
 typedef void(*t_copySysToVideoShift)(const mfxU16* src, mfxU16* dst, int width, int shift);
 typedef void(*t_copySysVariantToVideo)(const mfxU8* src, int loffset, mfxU16* dst, int width);
+typedef void(*t_copyShiftRect)(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift);
 
 void copyVideoToSys(const mfxU8* src, mfxU8* dst, int width);
+void copyVideoToSysStream(const mfxU8* src, mfxU8* dst, int width);
 void copyVideoToSysShift(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysToVideoShift(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysVariantToVideo(const mfxU8* src, int loffset, mfxU16* dst, int width);
 
+// whole-rect versions, AVX2/AVX-512BW kernels loop over rows themselves and fence once per rect
+void copyVideoToSysShiftRect(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift);
+void copySysToVideoShiftRect(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift);
+
+// copies large frames by row bands on the shared copy thread pool, see fast_copy_multithreading.h
+// returns MFX_ERR_UNSUPPORTED or MFX_WRN_DEVICE_BUSY when the caller should copy by itself
+mfxStatus FastCopyByBands(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag, bool bStreaming);
+
 template<typename T>
-inline int mfxCopyRect(const T* pSrc, int srcStep, T* pDst, int dstStep, IppiSize roiSize, int flag)
+inline int mfxCopyRect(const T* pSrc, int srcStep, T* pDst, int dstStep, IppiSize roiSize, int flag, bool bStreaming = false)
 {
     if (!pDst || !pSrc || roiSize.width < 0 || roiSize.height < 0 || srcStep < 0 || dstStep < 0)
         return -1;
 
     if (flag & COPY_VIDEO_TO_SYS)
     {
+        t_copyVideoToSys copyRow = bStreaming ? copyVideoToSysStream : copyVideoToSys;
+
         for(int h = 0; h < roiSize.height; h++ )
         {
-            copyVideoToSys((const mfxU8*)pSrc, (mfxU8*)pDst, roiSize.width*sizeof(T));
+            copyRow((const mfxU8*)pSrc, (mfxU8*)pDst, roiSize.width*sizeof(T));
             pSrc = (T *)((mfxU8*)pSrc + srcStep);
             pDst = (T *)((mfxU8*)pDst + dstStep);
         }
@@ -75,6 +90,71 @@ inline int mfxCopyRect(const T* pSrc, int srcStep, T* pDst, int dstStep, IppiSiz
     return 0;
 }
 
+// Copy context of the calling thread. Copies are counted per NUMA node the thread runs on:
+// only copies on the same node share its last level cache, and sessions on different nodes
+// don't bounce one counter between them. Threads may migrate, so the node is looked up
+// again every NODE_REFRESH copies.
+class FastCopyContext
+{
+public:
+    static const mfxU32 MAX_NODES = 64;
+    static const mfxU32 NODE_REFRESH = 16;
+
+    static FastCopyContext & Get();
+
+    // in-flight copies on the node of the calling thread
+    std::atomic<mfxU32> & InFlight();
+
+    mfxU32 GetNode() const { return m_node; }
+
+    // true when copies of this size which can run at once together don't fit in the cache budget
+    static bool IsOverCacheBudget(mfxU32 inFlight, size_t bytes);
+
+private:
+    FastCopyContext();
+
+    static mfxU32 GetCurrentNode();
+    static size_t GetCacheBudget();
+
+    mfxU32 m_node;
+    mfxU32 m_copiesToRefresh;
+
+    // one cache line per node
+    struct alignas(64) NodeLoad
+    {
+        std::atomic<mfxU32> inFlight;
+    };
+
+    static NodeLoad m_nodes[MAX_NODES];
+};
+
+// Tracks the number of FastCopy::Copy calls running at the same time on the NUMA node.
+// Copies which overlap with others switch to non-temporal stores once their destinations
+// together outgrow the cache budget, so concurrent sessions don't evict each other's
+// working set from the shared cache.
+class FastCopyLoad
+{
+public:
+    explicit FastCopyLoad(size_t bytes)
+        : m_inFlight(FastCopyContext::Get().InFlight())
+        , m_active(m_inFlight.fetch_add(1, std::memory_order_relaxed) + 1)
+        , m_streaming(FastCopyContext::IsOverCacheBudget(m_active, bytes))
+    {}
+
+    ~FastCopyLoad()
+    {
+        m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool IsShared() const { return m_active > 1; }
+    bool IsStreaming() const { return m_streaming; }
+
+private:
+    std::atomic<mfxU32> & m_inFlight;
+    mfxU32 m_active;
+    bool   m_streaming;
+};
+
 class FastCopy
 {
 public:
@@ -88,13 +168,19 @@ public:
             return MFX_ERR_NULL_PTR;
         }
 
-        /* The purpose of mutex here is to make the Copy() atomic.
-         * Without it CPU utilization grows dramatically due to cache trashing.
+        /* Copies are not serialized: when several of them run at once and don't
+         * fit in the cache together the destination is written with streaming
+         * stores to avoid cache trashing.
          */
-        static UMC::Mutex mutex; // This is thread-safe since C++11
-        UMC::AutomaticUMCMutex guard(mutex);
+        FastCopyLoad load(size_t(roi.width) * roi.height);
+
+        // a single large copy is spread over the copy thread pool
+        if (!load.IsShared() && MFX_ERR_NONE == FastCopyByBands(pDst, dstPitch, pSrc, srcPitch, roi, flag, false))
+        {
+            return MFX_ERR_NONE;
+        }
 
-        mfxCopyRect<mfxU8>(pSrc, srcPitch, pDst, dstPitch, roi, flag);
+        mfxCopyRect<mfxU8>(pSrc, srcPitch, pDst, dstPitch, roi, flag, load.IsStreaming());
 
         return MFX_ERR_NONE;
     }
@@ -109,20 +195,10 @@ public:
 
         if (flag & COPY_VIDEO_TO_SYS)
         {
-            for (int h = 0; h < roi.height; h++)
-            {
-                copyVideoToSysShift( pSrc, pDst, roi.width, rshift);
-                pSrc = (mfxU16 *)((mfxU8*)pSrc + srcPitch);
-                pDst = (mfxU16 *)((mfxU8*)pDst + dstPitch);
-            }
+            copyVideoToSysShiftRect(pSrc, srcPitch, pDst, dstPitch, roi, rshift);
         }
         else {
-            for (int h = 0; h < roi.height; h++)
-            {
-                copySysToVideoShift( pSrc, pDst, roi.width, lshift);
-                pSrc = (mfxU16 *)((mfxU8*)pSrc + srcPitch);
-                pDst = (mfxU16 *)((mfxU8*)pDst + dstPitch);
-            }
+            copySysToVideoShiftRect(pSrc, srcPitch, pDst, dstPitch, roi, lshift);
         }
         return MFX_ERR_NONE;
     }
@@ -25,6 +25,7 @@
 #include <algorithm>
 
 void copyVideoToSys_C(const mfxU8* src, mfxU8* dst, int width);
+void copyVideoToSysStream_C(const mfxU8* src, mfxU8* dst, int width);
 void copyVideoToSysShift_C(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysToVideoShift_C(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysVariantToVideo_C(const mfxU8* src, int loffset, mfxU16* dst, int width);
@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __FAST_COPY_MULTITHREADING_H__
+#define __FAST_COPY_MULTITHREADING_H__
+
+#include "fast_copy.h"
+#include "umc_event.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+struct FC_TASK
+{
+    // pointers to source and destination
+    Ipp8u *pS;
+    Ipp8u *pD;
+
+    // pitches and band size
+    IppiSize roi;
+    Ipp32u srcPitch, dstPitch;
+    int flag;
+    bool bStreaming;
+
+    // event handles
+    UMC::Event EventStart;
+    UMC::Event EventEnd;
+};
+
+// Splits a frame copy into row bands and runs them on a persistent thread pool.
+// Only one copy is served at a time, concurrent callers are expected to copy by themselves.
+class FastCopyMultithreading
+{
+public:
+
+    // constructor
+    FastCopyMultithreading(void);
+
+    // destructor
+    virtual ~FastCopyMultithreading(void);
+
+    // initialize available functionality
+    mfxStatus Initialize(mfxU32 numThreads = 0);
+
+    // release object
+    mfxStatus Release(void);
+
+    // copy memory by row bands, MFX_WRN_DEVICE_BUSY if the pool is serving another copy
+    mfxStatus Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag, bool bStreaming = false);
+
+    // number of bands worth splitting the copy into, 1 means copy on the calling thread
+    mfxU32 GetNumBands(IppiSize roi) const;
+
+    // process-wide pool shared by all sessions
+    static FastCopyMultithreading & GetPool(void);
+
+protected:
+
+    // synchronize threads
+    mfxStatus Synchronize(mfxU32 numTasks);
+
+    mfxU32 CopyByThread(FC_TASK *task);
+
+    static void CopyBand(const FC_TASK &task);
+
+    std::atomic<bool> m_bCopyQuit;
+    std::mutex m_busy;
+
+    // handles
+    std::thread *m_pThreads;
+    Ipp32u m_numThreads;
+
+    FC_TASK *m_tasks;
+};
+
+#endif // __FAST_COPY_MULTITHREADING_H__
@@ -25,6 +25,7 @@
 #include <algorithm>
 
 void copyVideoToSys_SSE4(const mfxU8* src, mfxU8* dst, int width);
+void copyVideoToSysStream_SSE4(const mfxU8* src, mfxU8* dst, int width);
 void copyVideoToSysShift_SSE4(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysToVideoShift_SSE4(const mfxU16* src, mfxU16* dst, int width, int shift);
 void copySysVariantToVideo_SSE4(const mfxU8* src, int loffset, mfxU16* dst, int width);
@@ -33,6 +33,7 @@
 
 #include <memory>
 #include <deque>
+#include <unordered_map>
 #include <chrono>
 #include <limits>
 
@@ -511,6 +512,20 @@ class SurfaceCache
     : public mfxRefCountableImpl<mfxSurfacePoolInterface>
 {
 public:
+    // Pool usage counters, accumulated over cache lifetime
+    struct Stat
+    {
+        mfxU64 NumRequests     = 0; // GetSurface calls
+        mfxU64 NumHits         = 0; // requests served with cached surface
+        mfxU64 NumAllocations  = 0; // surfaces created by allocator
+        mfxU64 NumWaits        = 0; // requests which waited for free surface
+        mfxU64 NumWaitTimeouts = 0; // waits expired without free surface
+        mfxU64 WaitTimeUs      = 0; // total time spent in waits
+        mfxU64 NumTrimmed      = 0; // idle surfaces returned to allocator
+        mfxU32 NumCached       = 0; // current pool size
+        mfxU32 NumFree         = 0; // current number of free surfaces
+    };
+
     static SurfaceCache* Create(CommonCORE_VPL& core, mfxU16 type, const mfxFrameInfo& frame_info)
     {
         auto cache = new SurfaceCache(core, type, frame_info);
@@ -580,6 +595,19 @@ public:
         return m_time_to_wait;
     }
 
+    ~SurfaceCache()
+    {
+#if defined(MFX_TRACE_ENABLE)
+        const Stat stat = GetStat();
+
+        MFX_LTRACE_MSG_1(MFX_TRACE_LEVEL_INTERNAL,
+            "SurfaceCache stat: requests=%llu hits=%llu allocations=%llu waits=%llu wait_timeouts=%llu wait_time_us=%llu trimmed=%llu cached=%u free=%u",
+            (unsigned long long)stat.NumRequests, (unsigned long long)stat.NumHits, (unsigned long long)stat.NumAllocations,
+            (unsigned long long)stat.NumWaits, (unsigned long long)stat.NumWaitTimeouts, (unsigned long long)stat.WaitTimeUs,
+            (unsigned long long)stat.NumTrimmed, stat.NumCached, stat.NumFree);
+#endif
+    }
+
     mfxStatus GetSurface(mfxFrameSurface1*& output_surface, bool emulate_zero_refcount_base = false, mfxSurfaceHeader* import_surface = nullptr)
     {
         return GetSurface(output_surface, m_time_to_wait, emulate_zero_refcount_base, import_surface);
@@ -595,8 +623,13 @@ public:
             but that is not true for VPL memory, our new surfaces arrive with refcount equal to 1. So this trick
             is just allows us to emulate that zero refcount base, and leave mfx_UMC_FrameAllocator code as is.
         */
+        // Idle surfaces trimmed below will be deleted after mutex unlock
+        std::list<SurfaceHolder> idle_surfaces;
+
         std::unique_lock<std::mutex> lock(m_mutex);
 
+        ++m_stat.NumRequests;
+
         if (!import_surface)
         {
             // Try to export existing surface from cache first
@@ -604,6 +637,7 @@ public:
             output_surface = FreeSurfaceLookup(emulate_zero_refcount_base);
             if (output_surface)
             {
+                TrimIdleSurfaces(idle_surfaces);
                 return MFX_ERR_NONE;
             }
 
@@ -614,7 +648,7 @@ public:
                 MFX_CHECK(current_time_to_wait != 0ms, MFX_WRN_ALLOC_TIMEOUT_EXPIRED);
 
                 // Cannot allocate (no free slots) surface, but we can wait
-                bool wait_succeeded = m_cv_wait_free_surface.wait_for(lock, current_time_to_wait,
+                bool wait_succeeded = WaitFreeSurface(lock, current_time_to_wait,
                     [&output_surface, emulate_zero_refcount_base, this]()
                 {
                     output_surface = FreeSurfaceLookup(emulate_zero_refcount_base);
@@ -631,27 +665,27 @@ public:
         else if (m_cached_surfaces.size() + m_num_pending_insertion >= m_limit)
         {
             // We try to reallocate one of the existing free surfaces if cache limit reached, but user asks to import surface
-            auto it = std::find_if(std::begin(m_cached_surfaces), std::end(m_cached_surfaces), [](const SurfaceHolder& surface) { return !surface.m_in_use; });
-
-            if (it == std::end(m_cached_surfaces))
+            if (m_free_surfaces.empty())
             {
                 using namespace std::chrono;
 
                 MFX_CHECK(current_time_to_wait != 0ms, MFX_WRN_ALLOC_TIMEOUT_EXPIRED);
 
                 // Cannot allocate (no free slots) surface, but we can wait
-                bool wait_succeeded = m_cv_wait_free_surface.wait_for(lock, current_time_to_wait,
-                    [&it, this]()
+                bool wait_succeeded = WaitFreeSurface(lock, current_time_to_wait,
+                    [this]()
                     {
-                        it = std::find_if(std::begin(m_cached_surfaces), std::end(m_cached_surfaces), [](const SurfaceHolder& surface) { return !surface.m_in_use; });
-
-                        return it != std::end(m_cached_surfaces);
+                        return !m_free_surfaces.empty();
                     });
 
                 MFX_CHECK(wait_succeeded, MFX_WRN_ALLOC_TIMEOUT_EXPIRED);
-
-                m_cached_surfaces.erase(it);
             }
+
+            // Drop the least recently used one
+            auto it = m_free_surfaces.front();
+            m_free_surfaces.pop_front();
+            m_surface_index.erase(it->Data.MemId);
+            m_cached_surfaces.erase(it);
         }
 
         // Get the new one from allocator
@@ -666,6 +700,8 @@ public:
         lock.lock();
         m_cached_surfaces.emplace_back(*surf, *this);
         --m_num_pending_insertion;
+        ++m_stat.NumAllocations;
+        m_surface_index.emplace(surf->Data.MemId, std::prev(std::end(m_cached_surfaces)));
         m_cached_surfaces.back().m_in_use = true;
         // We can relax this in future if actually copy happened during import
         m_cached_surfaces.back().m_created_from_external_handle = !!import_surface;
@@ -686,9 +722,20 @@ public:
     {
         std::lock_guard<std::mutex> guard(m_mutex);
 
-        auto it = std::find_if(std::begin(m_cached_surfaces), std::end(m_cached_surfaces), [memid](const SurfaceHolder& surface) { return surface.Data.MemId == memid; });
+        auto it = m_surface_index.find(memid);
 
-        return it != std::end(m_cached_surfaces) ? &(*it) : nullptr;
+        return it != std::end(m_surface_index) ? &(*it->second) : nullptr;
+    }
+
+    Stat GetStat() const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+
+        Stat stat      = m_stat;
+        stat.NumCached = mfxU32(m_cached_surfaces.size());
+        stat.NumFree   = mfxU32(m_free_surfaces.size());
+
+        return stat;
     }
 
     mfxStatus SetupPolicy(const mfxExtAllocationHints& hints_buffer)
@@ -720,6 +767,21 @@ public:
             }
 
             m_cached_surfaces = std::move(preallocated_surfaces);
+
+            m_surface_index.clear();
+            m_free_surfaces.clear();
+
+            const auto now = std::chrono::steady_clock::now();
+
+            for (auto it = std::begin(m_cached_surfaces); it != std::end(m_cached_surfaces); ++it)
+            {
+                it->m_release_time = now;
+                m_surface_index.emplace(it->Data.MemId, it);
+                m_free_surfaces.push_back(it);
+            }
+
+            m_stat.NumAllocations += hints_buffer.NumberToPreAllocate;
+            m_num_preallocated     = hints_buffer.NumberToPreAllocate;
         }
 
         m_time_to_wait = std::chrono::milliseconds(hints_buffer.Wait);
@@ -796,22 +858,11 @@ public:
 
         std::unique_lock<std::mutex> lock(std::move(outer_lock));
 
-        auto should_remove_predicate =
-            [](const SurfaceHolder& surface_holder)
-        {
-            // Check if surface is still owned by somebody
-            return !surface_holder.m_in_use;
-        };
-
-        // splice_if
-        for (auto it = std::begin(m_cached_surfaces); it != std::end(m_cached_surfaces) && m_num_to_revoke;)
+        // Surfaces still owned by somebody are decommitted in MarkSurfaceFree
+        for (; !m_free_surfaces.empty() && m_num_to_revoke; --m_num_to_revoke)
         {
-            auto it_to_transfer = it++;
-            if (should_remove_predicate(*it_to_transfer))
-            {
-                surfaces_to_decommit.splice(std::end(surfaces_to_decommit), m_cached_surfaces, it_to_transfer);
-                --m_num_to_revoke;
-            }
+            DetachSurface(m_free_surfaces.front(), surfaces_to_decommit);
+            m_free_surfaces.pop_front();
         }
     }
 
@@ -840,8 +891,10 @@ public:
 
         std::unique_lock<std::mutex> lock(m_mutex);
 
-        auto p_holder = std::find_if(std::begin(m_cached_surfaces), std::end(m_cached_surfaces), [mid](const SurfaceHolder& surface) { return surface.Data.MemId == mid; });
-        MFX_CHECK(p_holder != std::end(m_cached_surfaces), MFX_ERR_NOT_FOUND);
+        auto it_index = m_surface_index.find(mid);
+        MFX_CHECK(it_index != std::end(m_surface_index), MFX_ERR_NOT_FOUND);
+
+        auto p_holder = it_index->second;
 
         // Mark as free
         p_holder->m_in_use = false;
@@ -853,7 +906,7 @@ public:
         // For imported surfaces we delete it immidiately, without returning to cache (since we don't control lifetime of HW handle)
         if (p_holder->m_created_from_external_handle)
         {
-            surface_to_delete.splice(std::end(surface_to_delete), m_cached_surfaces, p_holder);
+            DetachSurface(p_holder, surface_to_delete);
 
             return MFX_ERR_NONE;
         }
@@ -861,6 +914,15 @@ public:
         // Remove surfaces from pool if required or notify waiters about free surface
         if (!m_num_to_revoke)
         {
+            // Release time matters for idle trimming only, skip clock query otherwise
+            if (m_idle_timeout != std::chrono::milliseconds(0))
+            {
+                p_holder->m_release_time = std::chrono::steady_clock::now();
+            }
+            m_free_surfaces.push_back(p_holder);
+
+            TrimIdleSurfaces(surface_to_delete);
+
             // If no surfaces to decommit, notify some waiter
             lock.unlock();
             m_cv_wait_free_surface.notify_one();
@@ -868,7 +930,7 @@ public:
         }
 
         // Decommit current surface
-        surface_to_delete.splice(std::end(surface_to_delete), m_cached_surfaces, p_holder);
+        DetachSurface(p_holder, surface_to_delete);
         --m_num_to_revoke;
 
         return MFX_ERR_NONE;
@@ -888,17 +950,28 @@ private:
         mfxSurfacePoolInterface::GetAllocationPolicy = &SurfaceCache::GetAllocationPolicy_impl;
         mfxSurfacePoolInterface::GetMaximumPoolSize  = &SurfaceCache::GetMaximumPoolSize_impl;
         mfxSurfacePoolInterface::GetCurrentPoolSize  = &SurfaceCache::GetCurrentPoolSize_impl;
+
+        // Surfaces left free for longer than timeout are returned to allocator on next pool access.
+        // Zero disables trimming. Preallocated amount of surfaces is kept in pool anyway.
+        m_idle_timeout = std::chrono::milliseconds(mfx::GetEnv<mfxU32>("VPL_SURFACE_POOL_IDLE_TIMEOUT_MS", 0));
     }
 
+    class SurfaceHolder;
+    using holder_iterator = std::list<SurfaceHolder>::iterator;
+
     mfxFrameSurface1* FreeSurfaceLookup(bool emulate_zero_refcount_base = false)
     {
         // This function is called only from thread safe context, so no mutex acquiring here
 
-        auto it = std::find_if(std::begin(m_cached_surfaces), std::end(m_cached_surfaces), [](const SurfaceHolder& surface) { return !surface.m_in_use; });
-
-        if (it == std::end(m_cached_surfaces))
+        if (m_free_surfaces.empty())
             return nullptr;
 
+        // Most recently released surface is the hottest one
+        auto it = m_free_surfaces.back();
+        m_free_surfaces.pop_back();
+
+        ++m_stat.NumHits;
+
         it->m_in_use = true;
         if (emulate_zero_refcount_base)
         {
@@ -910,6 +983,51 @@ private:
         return &(*it);
     }
 
+    template <class Predicate>
+    bool WaitFreeSurface(std::unique_lock<std::mutex>& lock, std::chrono::milliseconds time_to_wait, Predicate pred)
+    {
+        using namespace std::chrono;
+
+        const auto start = steady_clock::now();
+
+        bool wait_succeeded = m_cv_wait_free_surface.wait_for(lock, time_to_wait, pred);
+
+        ++m_stat.NumWaits;
+        m_stat.NumWaitTimeouts += !wait_succeeded;
+        m_stat.WaitTimeUs      += duration_cast<microseconds>(steady_clock::now() - start).count();
+
+        return wait_succeeded;
+    }
+
+    // Moves surface out of pool to the list which is going to be deleted after mutex unlock.
+    // Surface must be already removed from free stack.
+    void DetachSurface(holder_iterator it, std::list<SurfaceHolder>& surfaces_to_delete)
+    {
+        m_surface_index.erase(it->Data.MemId);
+        surfaces_to_delete.splice(std::end(surfaces_to_delete), m_cached_surfaces, it);
+    }
+
+    void TrimIdleSurfaces(std::list<SurfaceHolder>& surfaces_to_delete)
+    {
+        using namespace std::chrono;
+
+        if (m_idle_timeout == 0ms || m_free_surfaces.empty())
+            return;
+
+        // Free stack is ordered by release time, so stale surfaces are at the bottom
+        const auto deadline = steady_clock::now() - m_idle_timeout;
+
+        while (!m_free_surfaces.empty()
+            && m_cached_surfaces.size() > m_num_preallocated
+            && m_free_surfaces.front()->m_release_time < deadline)
+        {
+            DetachSurface(m_free_surfaces.front(), surfaces_to_delete);
+            m_free_surfaces.pop_front();
+
+            ++m_stat.NumTrimmed;
+        }
+    }
+
     static mfxStatus skip_one_addref(mfxFrameSurface1* surface)
     {
         MFX_CHECK_NULL_PTR1(surface);
@@ -931,6 +1049,8 @@ private:
 #ifndef NDEBUG
         bool m_was_released = false;
 #endif
+        // Time of return to the pool, used by idle trimming
+        std::chrono::steady_clock::time_point m_release_time;
 
         SurfaceHolder(mfxFrameSurface1& surf, SurfaceCache& cache)
             : mfxFrameSurface1(surf)
@@ -1009,9 +1129,19 @@ private:
     // Counter of surfaces being constructed
     size_t                    m_num_pending_insertion = 0;
     size_t                    m_num_to_revoke         = 0;
+    size_t                    m_num_preallocated      = 0;
+
+    std::chrono::milliseconds m_idle_timeout = std::chrono::milliseconds(0);
 
     std::list<SurfaceHolder>  m_cached_surfaces;
     std::list<mfxU32>         m_requests;
+
+    // MemId -> surface, for O(1) lookup on release
+    std::unordered_map<mfxMemId, holder_iterator> m_surface_index;
+    // Free surfaces in order of release, back is the most recent one
+    std::deque<holder_iterator>                   m_free_surfaces;
+
+    Stat                      m_stat;
 };
 
 inline bool SupportsVPLFeatureSet(VideoCORE& core)
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __MFX_STRIPE_WORKERS_H__
+#define __MFX_STRIPE_WORKERS_H__
+
+#include "mfxdefs.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mfx
+{
+
+// Runs stripes of one frame on persistent threads, the calling thread processes stripe 0.
+// Up to GetNumStripes() stripes run at the same time, so such a stripe may wait for
+// the progress of another one. Stripes above that run on the calling thread after stripe 0.
+class StripeWorkers
+{
+public:
+    ~StripeWorkers()
+    {
+        Stop();
+    }
+
+    void Start(mfxU32 numThreads)
+    {
+        Stop();
+
+        m_quit = false;
+        for (mfxU32 i = 0; i < numThreads; ++i)
+            m_threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_start.notify_all();
+
+        for (auto& thread : m_threads)
+            thread.join();
+
+        m_threads.clear();
+
+        // new workers start from generation 0
+        m_generation = 0;
+        m_numStripes = 0;
+    }
+
+    mfxU32 GetNumStripes() const { return mfxU32(m_threads.size()) + 1; }
+
+    // calls job(stripe) for every stripe and returns when all of them are done
+    void Run(mfxU32 numStripes, const std::function<void(mfxU32)> &job)
+    {
+        // worker i takes stripe i + 1
+        const mfxU32 numParallel = std::min<mfxU32>(numStripes, GetNumStripes());
+
+        if (numParallel > 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = &job;
+                m_numStripes = numParallel;
+                m_pending = numParallel - 1;
+                ++m_generation;
+            }
+            m_start.notify_all();
+        }
+
+        job(0);
+
+        // stripes not covered by workers
+        for (mfxU32 stripe = std::max<mfxU32>(numParallel, 1); stripe < numStripes; ++stripe)
+            job(stripe);
+
+        if (numParallel > 1)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_pending == 0; });
+            m_job = nullptr;
+        }
+    }
+
+private:
+    void WorkerLoop(mfxU32 index)
+    {
+        mfxU64 generation = 0;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (;;)
+        {
+            m_start.wait(lock, [&] { return m_quit || m_generation != generation; });
+
+            if (m_quit)
+                return;
+
+            generation = m_generation;
+
+            if (index + 1 >= m_numStripes)
+                continue;
+
+            const std::function<void(mfxU32)> *job = m_job;
+
+            lock.unlock();
+            (*job)(index + 1);
+            lock.lock();
+
+            if (--m_pending == 0)
+                m_done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+
+    const std::function<void(mfxU32)> *m_job = nullptr;
+    mfxU32 m_numStripes = 0;
+    mfxU32 m_pending = 0;
+    mfxU64 m_generation = 0;
+    bool m_quit = false;
+};
+
+} // namespace mfx
+
+#endif // __MFX_STRIPE_WORKERS_H__
@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <memory> // unique_ptr
+#include <unordered_map>
 
 #include "mfx_common.h"
 #include "umc_memory_allocator.h"
@@ -155,6 +156,13 @@ protected:
         bool              isUsed;
     };
 
+    // Slots of m_extSurfaces which hold the same surface pointer
+    struct surf_slots
+    {
+        mfxU32 first; // the lowest one
+        mfxU32 count;
+    };
+
     virtual UMC::Status Free(UMC::FrameMemID mid);
 
     virtual mfxI32 AddSurface(mfxFrameSurface1 *surface);
@@ -216,6 +224,27 @@ protected:
     bool       m_isSWDecode;
     mfxU16     m_IOPattern;
 
+    // Lookup indexes over m_frameDataInternal and m_extSurfaces, all protected by m_guard
+    // MemId of internal frame -> the lowest index of frame with it
+    std::unordered_map<mfxMemId, mfxU32>              m_midIndex;
+    // MapIdx(MemId) of internal frame (i.e. MemId seen by application) -> the lowest index of frame with it
+    std::unordered_map<mfxMemId, mfxU32>              m_mappedMidIndex;
+    // Surface pointer -> slots of m_extSurfaces with it
+    std::unordered_map<mfxFrameSurface1*, surf_slots> m_extSurfaceIndex;
+    // Bit per internal frame which may be unlocked. Frames can be unlocked outside of allocator,
+    // so bits are hints verified on lookup
+    std::vector<mfxU64>                               m_freeSlotHints;
+
+    // Must be called after bulk changes of m_frameDataInternal or m_extSurfaces
+    void   RebuildIndexes();
+    void   IndexInternalFrame(mfxU32 index);
+    void   MarkFreeSlot(mfxU32 index);
+
+    // All changes of m_extSurfaces[].FrameSurface go through these to keep m_extSurfaceIndex actual
+    void   SetExtSurface(mfxU32 index, mfxFrameSurface1 *surf);
+    void   AddExtSurface(mfxFrameSurface1 *surf);
+    mfxI32 FindExtSurface(mfxFrameSurface1 *surf) const;
+
 private:
     mfxI32 FindFreeSurface();
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <stdint.h>
 #include <string>
 #include <map>
@@ -8,19 +9,29 @@
 #include <mutex>
 #include <fstream>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #define MFX_MAX_PERF_FILENAME_LEN 260
 #define MFX_MAX_PATH_LENGTH       256
+
 //For perf log
-typedef struct _Tick
+enum
+{
+    PERF_EVENT_ENTER = 0,
+    PERF_EVENT_EXIT,
+    PERF_EVENT_TASK_ID,   // async task id, goes to the next API/Routine level exit of the thread
+};
+
+// 16 bytes, kept in per-thread fixed-size chunks and formatted by the writer thread
+struct PerfEvent
 {
-    std::string tag;
-    int64_t timestamp;
-    int64_t freq;
-    std::string functionType;
-    std::string level;
-}Tick;
+    int64_t  timestamp;   // CLOCK_MONOTONIC, ns
+    uint32_t value;       // interned tag or async task id
+    uint8_t  type;
+    uint8_t  level;
+    uint16_t reserved;
+};
 
 class PerfUtility
 {
@@ -30,18 +41,56 @@ public:
     PerfUtility() = default;
     int32_t getPid();
     int32_t getTid();
+
+    // tags with static storage duration (literals, __FUNCTION__) are cached by address
+    uint32_t internTag(const char* tag);
+    uint32_t internTag(const std::string& tag);
+    static uint8_t getLevel(const char* level);
+
+    void addEvent(uint8_t type, uint8_t level, uint32_t value);
     void timeStampTick(const std::string &tag, const std::string &level, const std::string &flag, const std::vector<uint32_t> &taskIds);
     void savePerfData();
     static std::string perfFilePath;
+    static bool chromeTrace;   // Chrome trace event JSON instead of per-thread text files
     static std::atomic<double> timeStamp;
 
 private:
-    void printPerfTimeStamp(Tick* newTick, const std::vector<uint32_t>& taskIds);
+    struct Chunk;
+    struct ThreadBuffer;
+    struct ThreadState;
+    struct ThreadBufferHolder;
+
+    ThreadBuffer& getThreadBuffer();
+    bool submitChunk(std::unique_ptr<Chunk>&& chunk);
+    void writerThread();
+    void writeChunk(const Chunk& chunk);
+    void printPerfTimeStamp(const Chunk& chunk);
+    void printChromeTrace(const Chunk& chunk);
 
 private:
     static std::shared_ptr<PerfUtility> instance;
     static std::mutex perfMutex;
-    std::map<int32_t, std::string> log_buffer{};
+    static std::atomic<uint64_t> instanceCount;
+
+    const uint64_t m_instance = ++instanceCount;   // tells thread_local caches of earlier instances apart
+
+    std::mutex m_tagMutex;
+    std::map<std::string, uint32_t> m_tagIds;
+    std::vector<std::unique_ptr<const std::string>> m_tags;
+
+    std::mutex m_bufferMutex;   // thread buffer registration only
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+    std::mutex m_queueMutex;    // once per full chunk
+    std::condition_variable m_queueCv;
+    std::vector<std::unique_ptr<Chunk>> m_queue;
+    std::unique_ptr<std::thread> m_writer;
+    bool m_stop = false;
+
+    // owned by the writer thread
+    std::map<int32_t, std::unique_ptr<ThreadState>> m_state;
+    std::ofstream m_trace;
+    size_t m_traceEvents = 0;
 };
 
 
@@ -72,13 +121,14 @@ class AutoPerfUtility
 {
 public:
     static void SetTaskId(uint32_t id);
-    AutoPerfUtility(const std::string &tag, const std::string &level);
+    AutoPerfUtility(const char *tag, const char *level);
+    AutoPerfUtility(const std::string &tag, const char *level);
     ~AutoPerfUtility();
 
 private:
-    static std::mutex map_guard;
-    static std::map<uint64_t, std::vector<uint32_t>> tid2taskIds;
-    bool bPrintTaskIds = false;
-    std::string autotag = "intialized";
-    std::string autolevel = "intialized";
-};
\ No newline at end of file
+    void enter(uint32_t tag, const char *level);
+
+    bool     bEntered = false;
+    uint32_t tagId = 0;
+    uint8_t  levelId = 0;
+};
@@ -4,6 +4,9 @@
 #include <pthread.h>
 #include "unistd.h"
 #include <sys/stat.h> 
+#include <string.h>
+#include <time.h>
+#include <unordered_map>
 
 #include "mfx_utils_perf.h"
 
@@ -65,10 +68,54 @@ int32_t MfxSecureStringPrint(char* buffer, size_t bufSize, size_t length, const
 
 PerfUtility* g_perfutility = nullptr;
 std::string PerfUtility::perfFilePath = "Initialize";
+bool PerfUtility::chromeTrace = false;
 std::shared_ptr<PerfUtility> PerfUtility::instance = nullptr;
 std::mutex PerfUtility::perfMutex;
-std::mutex AutoPerfUtility::map_guard;
-std::map<uint64_t, std::vector<uint32_t>> AutoPerfUtility::tid2taskIds;
+std::atomic<uint64_t> PerfUtility::instanceCount{ 0 };
+
+enum
+{
+    PERF_LVL_OTHER = 0,
+    PERF_LVL_API,
+    PERF_LVL_DDI,
+    PERF_LVL_HW,
+    PERF_LVL_ROUTINE,
+    PERF_LVL_INTERNAL,
+};
+
+static const char* const PerfLevelName[] = { "", PERF_LEVEL_API, PERF_LEVEL_DDI, PERF_LEVEL_HW, PERF_LEVEL_ROUTINE, PERF_LEVEL_INTERNAL };
+
+static const size_t PERF_CHUNK_EVENTS = 4096;
+
+struct PerfUtility::Chunk
+{
+    int32_t   tid  = 0;
+    size_t    size = 0;
+    PerfEvent events[PERF_CHUNK_EVENTS];
+};
+
+// shared by PerfUtility and the owning thread, so either side can go first. The mutex is only
+// contended when savePerfData() collects the chunk or the thread exits
+struct PerfUtility::ThreadBuffer
+{
+    std::mutex                 mutex;
+    std::atomic<PerfUtility*>  owner{ nullptr };   // reset by savePerfData(), the buffer is stale then
+    int32_t                    tid = 0;
+    std::unique_ptr<Chunk>     chunk;
+};
+
+// async task ids waiting for the next API/Routine level exit of the thread
+struct PerfUtility::ThreadState
+{
+    std::vector<uint32_t> taskIds;
+};
+
+static int64_t PerfTimeNs()
+{
+    struct timespec t = {};
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return 1000000000LL * t.tv_sec + t.tv_nsec;
+}
 
 void AutoPerfUtility::SetTaskId(uint32_t id)
 {
@@ -77,66 +124,68 @@ void AutoPerfUtility::SetTaskId(uint32_t id)
         return;
     }
 
-    uint64_t tid = pthread_self();
-
-    decltype(tid2taskIds)::iterator it;
-    if ((it = tid2taskIds.find(tid)) == tid2taskIds.end())
+    try
+    {
+        g_perfutility->addEvent(PERF_EVENT_TASK_ID, PERF_LVL_OTHER, id);
+    }
+    catch (...)
     {
-        std::lock_guard<std::mutex> lg(map_guard);
-        tid2taskIds[tid] = {};
-        it = tid2taskIds.find(tid);
     }
-    it->second.push_back(id);
 }
 
-AutoPerfUtility::AutoPerfUtility(const std::string& tag, const std::string& level)
+AutoPerfUtility::AutoPerfUtility(const char* tag, const char* level)
 {
     if (!g_perfutility)
     {
         return;
     }
 
-    std::string flag = MFX_FLAG_ENTER;
     try
     {
-        g_perfutility->timeStampTick(tag, level, flag, std::vector<uint32_t>());
+        enter(g_perfutility->internTag(tag), level);
     }
-    catch(...)
+    catch (...)
     {
-        return;
-    }
-
-    autotag = tag;
-    autolevel = level;
-    if (level == PERF_LEVEL_API || level == PERF_LEVEL_ROUTINE)
-    {
-        bPrintTaskIds = true;
     }
 }
 
-AutoPerfUtility::~AutoPerfUtility()
+AutoPerfUtility::AutoPerfUtility(const std::string& tag, const char* level)
 {
     if (!g_perfutility)
     {
         return;
     }
 
-    std::string flag = MFX_FLAG_EXIT;
-    std::vector<uint32_t> ids;
-    uint64_t tid = pthread_self();
+    try
+    {
+        enter(g_perfutility->internTag(tag), level);
+    }
+    catch (...)
+    {
+    }
+}
+
+void AutoPerfUtility::enter(uint32_t tag, const char* level)
+{
+    tagId   = tag;
+    levelId = PerfUtility::getLevel(level);
+    g_perfutility->addEvent(PERF_EVENT_ENTER, levelId, tagId);
+    bEntered = true;
+}
 
-    if (bPrintTaskIds && tid2taskIds.find(tid) != tid2taskIds.end())
+AutoPerfUtility::~AutoPerfUtility()
+{
+    if (!g_perfutility || !bEntered)
     {
-        tid2taskIds[tid].swap(ids);
+        return;
     }
 
     try
     {
-        g_perfutility->timeStampTick(autotag, autolevel, flag, ids);
+        g_perfutility->addEvent(PERF_EVENT_EXIT, levelId, tagId);
     }
-    catch (std::bad_array_new_length&)
+    catch (...)
     {
-
     }
 }
 
@@ -153,16 +202,18 @@ PerfUtility* PerfUtility::getInstance()
 PerfUtility::~PerfUtility()
 {
     // save perf data here
-    if (instance)
+    if (g_perfutility == this)
+    {
+        g_perfutility = nullptr;
+    }
+
+    try
+    {
+        savePerfData();
+    }
+    catch (...)
     {
-        try
-        {
-            instance->savePerfData();
-        }
-        catch (...)
-        {
 
-        }
     }
 }
 
@@ -178,91 +229,436 @@ int32_t PerfUtility::getTid()
     return tid;
 }
 
-void PerfUtility::savePerfData()
+uint32_t PerfUtility::internTag(const char* tag)
 {
-    std::fstream pTimeStampFile;
-    int32_t pid = getPid();
+    static thread_local std::unordered_map<const void*, uint32_t> byAddress;
+    static thread_local uint64_t cached = 0;
+
+    if (cached != m_instance)
+    {
+        byAddress.clear();
+        cached = m_instance;
+    }
+
+    auto it = byAddress.find(tag);
+    if (it != byAddress.end())
+    {
+        return it->second;
+    }
+
+    uint32_t id = internTag(std::string(tag ? tag : ""));
+    byAddress.emplace(tag, id);
+    return id;
+}
+
+uint32_t PerfUtility::internTag(const std::string& tag)
+{
+    static thread_local std::unordered_map<std::string, uint32_t> byName;
+    static thread_local uint64_t cached = 0;
 
-        const char* const perf_log_path_fmt = "%s/perf_details_pid%d_tid%d.txt";
-    for (auto it : log_buffer)
+    if (cached != m_instance)
     {
-        char sDetailsFileName[MFX_MAX_PERF_FILENAME_LEN + 1] = { '\0' };
-        MFX_SecureStringPrint(sDetailsFileName, MFX_MAX_PATH_LENGTH + 1, MFX_MAX_PATH_LENGTH + 1,
-                              perf_log_path_fmt, perfFilePath.c_str(), pid, it.first);
+        byName.clear();
+        cached = m_instance;
+    }
 
-        if (access(perfFilePath.c_str(), 0) == -1)
+    auto it = byName.find(tag);
+    if (it != byName.end())
+    {
+        return it->second;
+    }
+
+    uint32_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_tagMutex);
+        auto global = m_tagIds.find(tag);
+        if (global == m_tagIds.end())
         {
-            int folder_exist_status = mkdir(perfFilePath.c_str(), S_IRWXU);
-            if (folder_exist_status == -1)
-            {
-                return;
-            }
+            m_tags.emplace_back(new std::string(tag));
+            global = m_tagIds.emplace(tag, uint32_t(m_tags.size() - 1)).first;
         }
-        pTimeStampFile.open(sDetailsFileName, std::ios::app);
-        if (pTimeStampFile.good() == false)
+        id = global->second;
+    }
+
+    byName.emplace(tag, id);
+    return id;
+}
+
+uint8_t PerfUtility::getLevel(const char* level)
+{
+    for (uint8_t i = PERF_LVL_API; i <= PERF_LVL_INTERNAL; i++)
+    {
+        if (level && !strcmp(level, PerfLevelName[i]))
+        {
+            return i;
+        }
+    }
+    return PERF_LVL_OTHER;
+}
+
+// hands the partial chunk over when the thread exits, savePerfData() collects it otherwise
+struct PerfUtility::ThreadBufferHolder
+{
+    std::shared_ptr<ThreadBuffer> buffer;
+
+    ~ThreadBufferHolder()
+    {
+        if (!buffer)
         {
-            pTimeStampFile.close();
             return;
         }
-        pTimeStampFile << it.second;
-        pTimeStampFile.close();
-        pTimeStampFile.clear();
+
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        PerfUtility* owner = buffer->owner.load();
+        if (owner && buffer->chunk && buffer->chunk->size)
+        {
+            owner->submitChunk(std::move(buffer->chunk));
+        }
+    }
+};
+
+PerfUtility::ThreadBuffer& PerfUtility::getThreadBuffer()
+{
+    static thread_local ThreadBufferHolder holder;
+
+    // a buffer of a destroyed instance is stale, even if the new one got the same address
+    if (!holder.buffer || holder.buffer->owner.load(std::memory_order_acquire) != this)
+    {
+        std::shared_ptr<ThreadBuffer> newBuffer = std::make_shared<ThreadBuffer>();
+        newBuffer->owner = this;
+        newBuffer->tid = getTid();
+        newBuffer->chunk.reset(new Chunk);
+        newBuffer->chunk->tid = newBuffer->tid;
+
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            m_buffers.emplace_back(newBuffer);
+        }
+        holder.buffer = std::move(newBuffer);
+    }
+
+    return *holder.buffer;
+}
+
+void PerfUtility::addEvent(uint8_t type, uint8_t level, uint32_t value)
+{
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    // a full chunk stays when savePerfData() has started, it's collected with the rest
+    if (!buffer.chunk || buffer.chunk->size == PERF_CHUNK_EVENTS)
+    {
+        return;
+    }
+
+    PerfEvent& event = buffer.chunk->events[buffer.chunk->size++];
+    event.timestamp = PerfTimeNs();
+    event.value     = value;
+    event.type      = type;
+    event.level     = level;
+    event.reserved  = 0;
+
+    if (buffer.chunk->size == PERF_CHUNK_EVENTS)
+    {
+        std::unique_ptr<Chunk> next(new Chunk);
+        next->tid = buffer.tid;
+        if (submitChunk(std::move(buffer.chunk)))
+        {
+            buffer.chunk = std::move(next);
+        }
+    }
+}
+
+// the chunk is left with the caller once savePerfData() has started
+bool PerfUtility::submitChunk(std::unique_ptr<Chunk>&& chunk)
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (m_stop)
+    {
+        return false;
+    }
+
+    if (!m_writer)
+    {
+        m_writer.reset(new std::thread(&PerfUtility::writerThread, this));
+    }
+
+    m_queue.emplace_back(std::move(chunk));
+    m_queueCv.notify_one();
+    return true;
+}
+
+void PerfUtility::writerThread()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    while (!m_stop)
+    {
+        m_queueCv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        chunks.swap(m_queue);
+
+        lock.unlock();
+        for (auto& chunk : chunks)
+        {
+            writeChunk(*chunk);
+        }
+        lock.lock();
     }
 }
 
 void PerfUtility::timeStampTick(const std::string &tag, const std::string &level, const std::string &flag, const std::vector<uint32_t>& taskIds)
 {
-    Tick newTick;
-    newTick.tag = tag;
-    int64_t _freq = 0;
-    QueryPerformanceFrequency(_freq);
-    newTick.freq = _freq / 1000;     // ms
-    QueryPerformanceCounter(newTick.timestamp);
-    newTick.functionType = flag;
-    newTick.level = level;
-    printPerfTimeStamp(&newTick, taskIds);
+    uint8_t levelId = getLevel(level.c_str());
+
+    for (auto id : taskIds)
+    {
+        addEvent(PERF_EVENT_TASK_ID, levelId, id);
+    }
+    addEvent(flag == MFX_FLAG_EXIT ? PERF_EVENT_EXIT : PERF_EVENT_ENTER, levelId, internTag(tag));
+}
+
+void PerfUtility::savePerfData()
+{
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    bool saved = false;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        saved = m_stop;
+        m_stop = true;
+        m_queueCv.notify_one();
+    }
+
+    if (m_writer)
+    {
+        m_writer->join();
+        m_writer.reset();
+    }
+
+    // chunks the writer didn't get to, then whatever the threads hold
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        chunks.swap(m_queue);
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        buffers.swap(m_buffers);
+    }
+
+    for (auto& buffer : buffers)
+    {
+        // a thread still logging keeps its buffer, later events are discarded
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        buffer->owner = nullptr;
+        if (buffer->chunk && buffer->chunk->size)
+        {
+            chunks.emplace_back(std::move(buffer->chunk));
+        }
+        buffer->chunk.reset();
+    }
+
+    // buffers registered after the first call are only released, the file is complete
+    if (saved)
+    {
+        return;
+    }
+
+    for (auto& chunk : chunks)
+    {
+        writeChunk(*chunk);
+    }
+
+    if (m_trace.is_open())
+    {
+        m_trace << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        m_trace.close();
+    }
+}
+
+void PerfUtility::writeChunk(const Chunk& chunk)
+{
+    if (access(perfFilePath.c_str(), 0) == -1)
+    {
+        int folder_exist_status = mkdir(perfFilePath.c_str(), S_IRWXU);
+        if (folder_exist_status == -1)
+        {
+            return;
+        }
+    }
+
+    auto& state = m_state[chunk.tid];
+    if (!state)
+    {
+        state.reset(new ThreadState);
+    }
+
+    if (chromeTrace)
+    {
+        printChromeTrace(chunk);
+    }
+    else
+    {
+        printPerfTimeStamp(chunk);
+    }
 }
 
-void PerfUtility::printPerfTimeStamp(Tick *newTick, const std::vector<uint32_t>& taskIds)
+void PerfUtility::printPerfTimeStamp(const Chunk& chunk)
 {
-    int32_t current_tid = getTid();
+    static const int64_t resolution = []()
+    {
+        int64_t freq = 0;
+        QueryPerformanceFrequency(freq);
+        return freq ? 1000000000LL / freq : 1;
+    }();
+    const int64_t freq = 1000000000LL / resolution / 1000;     // ms
 
-    std::map<int32_t, std::string>::iterator it;
+    ThreadState& state = *m_state[chunk.tid];
+    std::string log;
 
-    it = log_buffer.find(current_tid);
-    if (it == log_buffer.end()) 
+    for (size_t i = 0; i < chunk.size; i++)
     {
-        std::lock_guard<std::mutex> lock(perfMutex);
-        log_buffer[current_tid] = {};
-        it = log_buffer.find(current_tid);
+        const PerfEvent& event = chunk.events[i];
+
+        if (event.type == PERF_EVENT_TASK_ID)
+        {
+            state.taskIds.push_back(event.value);
+            continue;
+        }
+
+        if (event.level == PERF_LVL_DDI || event.level == PERF_LVL_HW)
+        {
+            log.append("    ");
+        }
+        else if (event.level == PERF_LVL_ROUTINE)
+        {
+            log.append("  ");
+        }
+        else if (event.level == PERF_LVL_INTERNAL)
+        {
+            log.append("   ");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_tagMutex);
+            log.append(*m_tags[event.value]);
+        }
+        log.append(event.type == PERF_EVENT_EXIT ? MFX_FLAG_EXIT : MFX_FLAG_ENTER);
+        log.append("\tTimeStamp: ");
+        log.append(std::to_string(event.timestamp / resolution));
+        log.append("\tFreq: ");
+        log.append(std::to_string(freq));
+        if (event.type == PERF_EVENT_EXIT
+            && (event.level == PERF_LVL_API || event.level == PERF_LVL_ROUTINE)
+            && !state.taskIds.empty())
+        {
+            log.append("\tAsync Task ID: ");
+            for (auto id : state.taskIds)
+            {
+                log.append(std::to_string(id));
+            }
+            state.taskIds.clear();
+        }
+        log.append("\n");
     }
 
-    if (newTick->level == PERF_LEVEL_DDI || newTick->level == PERF_LEVEL_HW)
+    char sDetailsFileName[MFX_MAX_PERF_FILENAME_LEN + 1] = { '\0' };
+    MFX_SecureStringPrint(sDetailsFileName, MFX_MAX_PATH_LENGTH + 1, MFX_MAX_PATH_LENGTH + 1,
+                          "%s/perf_details_pid%d_tid%d.txt", perfFilePath.c_str(), getPid(), chunk.tid);
+
+    std::fstream pTimeStampFile;
+    pTimeStampFile.open(sDetailsFileName, std::ios::app);
+    if (pTimeStampFile.good())
     {
-        it->second.append("    ");
+        pTimeStampFile << log;
     }
-    else if(newTick->level == PERF_LEVEL_ROUTINE)
+    pTimeStampFile.close();
+}
+
+static void AppendJsonString(std::string& out, const std::string& str)
+{
+    out.push_back('"');
+    for (char c : str)
     {
-        it->second.append("  ");
+        if (c == '"' || c == '\\')
+        {
+            out.push_back('\\');
+            out.push_back(c);
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            out.append(esc);
+        }
+        else
+        {
+            out.push_back(c);
+        }
     }
-    else if (newTick->level == PERF_LEVEL_INTERNAL)
+    out.push_back('"');
+}
+
+// Chrome trace event format, duration events per thread, loads in chrome://tracing and Perfetto
+void PerfUtility::printChromeTrace(const Chunk& chunk)
+{
+    if (!m_trace.is_open())
     {
-        log_buffer[current_tid].append("   ");
+        char sTraceFileName[MFX_MAX_PERF_FILENAME_LEN + 1] = { '\0' };
+        MFX_SecureStringPrint(sTraceFileName, MFX_MAX_PATH_LENGTH + 1, MFX_MAX_PATH_LENGTH + 1,
+                              "%s/perf_trace_pid%d.json", perfFilePath.c_str(), getPid());
+
+        m_trace.open(sTraceFileName, std::ios::out | std::ios::trunc);
+        if (!m_trace.good())
+        {
+            return;
+        }
+        m_trace << "{\"traceEvents\":[";
     }
-    
-    it->second.append(newTick->tag);
-    it->second.append(newTick->functionType);
-    it->second.append("\tTimeStamp: ");
-    it->second.append(std::to_string(newTick->timestamp));
-    it->second.append("\tFreq: ");
-    it->second.append(std::to_string(newTick->freq));
-    if (!taskIds.empty())
+
+    ThreadState& state = *m_state[chunk.tid];
+    const std::string process = ",\"pid\":" + std::to_string(getPid()) + ",\"tid\":" + std::to_string(chunk.tid);
+    std::string out;
+    char ts[32];
+
+    for (size_t i = 0; i < chunk.size; i++)
     {
-        it->second.append("\tAsync Task ID: ");
-        for (auto id : taskIds)
+        const PerfEvent& event = chunk.events[i];
+
+        if (event.type == PERF_EVENT_TASK_ID)
+        {
+            state.taskIds.push_back(event.value);
+            continue;
+        }
+
+        out.append(m_traceEvents++ ? ",\n{\"name\":" : "\n{\"name\":");
         {
-            it->second.append(std::to_string(id));
+            std::lock_guard<std::mutex> lock(m_tagMutex);
+            AppendJsonString(out, *m_tags[event.value]);
         }
+        out.append(",\"cat\":\"");
+        out.append(PerfLevelName[event.level]);
+        out.append(event.type == PERF_EVENT_EXIT ? "\",\"ph\":\"E\",\"ts\":" : "\",\"ph\":\"B\",\"ts\":");
+        snprintf(ts, sizeof(ts), "%lld.%03lld", (long long)(event.timestamp / 1000), (long long)(event.timestamp % 1000));
+        out.append(ts);
+        out.append(process);
+
+        if (event.type == PERF_EVENT_EXIT
+            && (event.level == PERF_LVL_API || event.level == PERF_LVL_ROUTINE)
+            && !state.taskIds.empty())
+        {
+            out.append(",\"args\":{\"taskIds\":[");
+            for (size_t j = 0; j < state.taskIds.size(); j++)
+            {
+                out.append(j ? "," : "");
+                out.append(std::to_string(state.taskIds[j]));
+            }
+            out.append("]}");
+            state.taskIds.clear();
+        }
+        out.append("}");
     }
-    it->second.append("\n");
-}
\ No newline at end of file
+
+    m_trace << out;
+}
@@ -263,6 +263,8 @@ mfxTraceU32 MFXTrace_GetRegistryParams(void)
                 }
                 else if (iter->first == "VPL PERF LOG" && stoi(iter->second))
                 {
+                    // 2 writes Chrome trace event JSON instead of the per-thread text logs
+                    PerfUtility::chromeTrace = stoi(iter->second) == 2;
                     g_perfutility = PerfUtility::getInstance();
                 }
                 else if (iter->first == "VPL PERF PATH")
@@ -19,24 +19,389 @@
 // SOFTWARE.
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/syscall.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <tuple>
+#include <cstddef>
+#include <cstring>
 
 #include "mfx_trace.h"
 
-extern "C"
-{
+/*
+ * VPL_EVENT_TRACE               enables event tracing, every event is written to trace_marker_raw
+ *                               by the calling thread
+ * VPL_EVENT_TRACE_FILE=<path>   events go through per-thread ring buffers to a binary file instead,
+ *                               mfx_trace/tools/event_trace2json.py converts it to Chrome-trace JSON
+ * VPL_EVENT_TRACE_BUFFERED      ring buffers for trace_marker_raw output, the flusher thread writes
+ *                               the events with their capture time and thread id appended
+ * VPL_EVENT_TRACE_DROP          with ring buffers, drop events when the ring is full instead of
+ *                               waiting for the flusher. Without it the wait is bounded by
+ *                               MFX_PERF_TRACE_RING_WAIT_MS, events that still don't fit are dropped
+ */
 
 static const int MFX_PERF_TRACE_BUFFER_SIZE = 3072;
+static const uint32_t MFX_PERF_TRACE_TAG = 0x494d5446; // "FTMI" in memory, IMTF (IntelMediaTraceEvent + 1) value
+static const uint32_t MFX_PERF_TRACE_RING_WAIT_MS = 100;
+
+// layout of the binary file written for VPL_EVENT_TRACE_FILE
+static const uint32_t MFX_PERF_TRACE_FILE_MAGIC   = 0x454c5056; // "VPLE"
+static const uint32_t MFX_PERF_TRACE_FILE_VERSION = 1;
+
+struct EventFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pid;
+    uint32_t reserved;
+    uint64_t dropped;     // events lost on a full ring or a failed write
+};
+
+// every record is followed by its payload and padded to 8 bytes
+struct EventRecord
+{
+    uint32_t tag;
+    uint32_t taskSize;    // task << 16 | payload size, same as the trace_marker_raw header
+    uint32_t opcode;
+    uint32_t tid;
+    uint64_t timestamp;   // CLOCK_MONOTONIC, ns
+};
+
+static_assert(sizeof(EventRecord) == 24, "EventRecord layout is a part of the file format");
+
+namespace
+{
+
+inline uint64_t EventTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline uint32_t EventRecordSize(uint64_t size)
+{
+    return uint32_t((sizeof(EventRecord) + size + 7) & ~7ull);
+}
+
+// single producer (owning thread) single consumer (flusher) byte ring
+struct EventRing
+{
+    static const uint32_t SIZE = 1 << 18;
+
+    std::atomic<uint64_t> head{ 0 };
+    std::atomic<uint64_t> tail{ 0 };
+    std::atomic<bool>     orphaned{ false };
+    uint32_t              tid = 0;
+    bool                  stalled = false;  // the last wait timed out, don't wait again until there's room
+    uint8_t               data[SIZE];
+
+    void Write(uint64_t pos, const void* src, size_t size)
+    {
+        size_t offset = size_t(pos & (SIZE - 1));
+        size_t part   = std::min<size_t>(size, SIZE - offset);
+
+        memcpy(data + offset, src, part);
+        memcpy(data, (const uint8_t*)src + part, size - part);
+    }
+
+    void Read(uint64_t pos, void* dst, size_t size) const
+    {
+        size_t offset = size_t(pos & (SIZE - 1));
+        size_t part   = std::min<size_t>(size, SIZE - offset);
+
+        memcpy(dst, data + offset, part);
+        memcpy((uint8_t*)dst + part, data, size - part);
+    }
+};
+
+// mmap'ed output file, grows by CHUNK
+class EventFile
+{
+public:
+    static const size_t CHUNK = 64 << 20;
+
+    bool Open(const char* path)
+    {
+        m_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_fd == -1)
+            return false;
+
+        EventFileHeader header = { MFX_PERF_TRACE_FILE_MAGIC, MFX_PERF_TRACE_FILE_VERSION, uint32_t(getpid()), 0, 0 };
+        return Write(&header, sizeof(header));
+    }
+
+    bool Write(const void* src, size_t size)
+    {
+        if (m_size + size > m_capacity && !Grow(m_size + size))
+            return false;
+
+        memcpy(m_data + m_size, src, size);
+        m_size += size;
+        return true;
+    }
+
+    void Close(uint64_t dropped)
+    {
+        if (m_data)
+        {
+            ((EventFileHeader*)m_data)->dropped = dropped;
+            munmap(m_data, m_capacity);
+        }
+        else if (m_fd != -1)
+        {
+            // the mapping is gone after a failed Grow()
+            std::ignore = pwrite(m_fd, &dropped, sizeof(dropped), offsetof(EventFileHeader, dropped));
+        }
+
+        if (m_fd != -1)
+        {
+            std::ignore = ftruncate(m_fd, m_size);
+            close(m_fd);
+        }
+
+        m_fd       = -1;
+        m_data     = nullptr;
+        m_size     = 0;
+        m_capacity = 0;
+    }
+
+private:
+    bool Grow(size_t size)
+    {
+        size_t capacity = (size + CHUNK - 1) / CHUNK * CHUNK;
+
+        if (m_data)
+            munmap(m_data, m_capacity);
+        m_data     = nullptr;
+        m_capacity = 0;
+
+        if (ftruncate(m_fd, capacity))
+            return false;
+
+        void* p = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (p == MAP_FAILED)
+            return false;
+
+        m_data     = (uint8_t*)p;
+        m_capacity = capacity;
+        return true;
+    }
+
+    int      m_fd       = -1;
+    uint8_t* m_data     = nullptr;
+    size_t   m_size     = 0;
+    size_t   m_capacity = 0;
+};
+
+} // namespace
+
 static char *perf_trace_var = nullptr;
 
 static struct PerfTraceCtx {
     int32_t ftrace_fd = -1;
     std::mutex perf_mutex;
     uint32_t count = 0;
+
+    // ring buffer backend
+    std::atomic<bool> buffered{ false };
+    bool drop = false;
+    std::atomic<uint64_t> dropped{ 0 };
+    EventFile file;
+    bool to_file = false;
+
+    std::mutex ring_mutex;              // guards rings, taken by the flusher and on thread attach/detach
+    std::list<std::unique_ptr<EventRing>> rings;
+    std::thread flusher;
+    std::condition_variable flush_cv;
+    std::mutex flush_mutex;
+    bool running = false;
 } perf_ctx;
 
+static uint32_t GetThreadId()
+{
+    static thread_local uint32_t tid = uint32_t(syscall(SYS_gettid));
+    return tid;
+}
+
+static void DrainRing(EventRing& ring)
+{
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    uint64_t head = ring.head.load(std::memory_order_acquire);
+
+    while (tail < head)
+    {
+        alignas(8) uint8_t buf[MFX_PERF_TRACE_BUFFER_SIZE + sizeof(EventRecord) + 8];
+        EventRecord& rec = *(EventRecord*)buf;
+
+        ring.Read(tail, &rec, sizeof(rec));
+        uint32_t size = rec.taskSize & 0xffff;
+        uint32_t recSize = EventRecordSize(size);
+        ring.Read(tail + sizeof(rec), buf + sizeof(rec), recSize - sizeof(rec));
+        tail += recSize;
+
+        if (perf_ctx.to_file)
+        {
+            if (!perf_ctx.file.Write(buf, recSize))
+                perf_ctx.dropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // one write per marker: legacy layout, then the capture time and thread id
+        uint8_t marker[MFX_PERF_TRACE_BUFFER_SIZE + 12];
+        uint32_t header[3] = { rec.tag, rec.taskSize, rec.opcode };
+        memcpy(marker, header, sizeof(header));
+        memcpy(marker + sizeof(header), buf + sizeof(rec), size);
+        memcpy(marker + sizeof(header) + size, &rec.timestamp, sizeof(rec.timestamp));
+        memcpy(marker + sizeof(header) + size + sizeof(rec.timestamp), &rec.tid, sizeof(rec.tid));
+        size_t markerSize = sizeof(header) + size + 12;
+        if (write(perf_ctx.ftrace_fd, marker, markerSize) != ssize_t(markerSize))
+            perf_ctx.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ring.tail.store(tail, std::memory_order_release);
+}
+
+static void DrainRings()
+{
+    std::lock_guard<std::mutex> lock(perf_ctx.ring_mutex);
+
+    for (auto it = perf_ctx.rings.begin(); it != perf_ctx.rings.end();)
+    {
+        bool orphaned = (*it)->orphaned.load(std::memory_order_acquire);
+        DrainRing(**it);
+        it = orphaned ? perf_ctx.rings.erase(it) : std::next(it);
+    }
+}
+
+static void FlushThread()
+{
+    std::unique_lock<std::mutex> lock(perf_ctx.flush_mutex);
+
+    while (perf_ctx.running)
+    {
+        perf_ctx.flush_cv.wait_for(lock, std::chrono::milliseconds(10));
+
+        lock.unlock();
+        DrainRings();
+        lock.lock();
+    }
+}
+
+// detaches the thread's ring on thread exit, the flusher frees it once drained
+struct EventRingHolder
+{
+    EventRing* ring = nullptr;
+
+    ~EventRingHolder()
+    {
+        if (!ring)
+            return;
+
+        std::lock_guard<std::mutex> lock(perf_ctx.ring_mutex);
+        ring->orphaned.store(true, std::memory_order_release);
+    }
+};
+
+static EventRing* GetThreadRing()
+{
+    static thread_local EventRingHolder holder;
+
+    if (!holder.ring)
+    {
+        std::unique_ptr<EventRing> ring(new EventRing);
+        ring->tid = GetThreadId();
+
+        std::lock_guard<std::mutex> lock(perf_ctx.ring_mutex);
+        perf_ctx.rings.emplace_back(std::move(ring));
+        holder.ring = perf_ctx.rings.back().get();
+    }
+
+    return holder.ring;
+}
+
+static mfxTraceU32 PushEvent(uint16_t task, uint8_t opcode, uint64_t size, const void *ptr)
+{
+    EventRing& ring = *GetThreadRing();
+    uint32_t recSize = EventRecordSize(size);
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    auto deadline = std::chrono::steady_clock::time_point::max();
+
+    while (head + recSize - ring.tail.load(std::memory_order_acquire) > EventRing::SIZE)
+    {
+        if (deadline == std::chrono::steady_clock::time_point::max())
+            deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(MFX_PERF_TRACE_RING_WAIT_MS);
+
+        // the flusher is stopped or stuck, don't block the caller on it
+        if (perf_ctx.drop || ring.stalled || !perf_ctx.buffered.load(std::memory_order_relaxed)
+            || std::chrono::steady_clock::now() > deadline)
+        {
+            ring.stalled = !perf_ctx.drop;
+            perf_ctx.dropped.fetch_add(1, std::memory_order_relaxed);
+            return 1;
+        }
+
+        perf_ctx.flush_cv.notify_one();
+        std::this_thread::yield();
+    }
+    ring.stalled = false;
+
+    EventRecord rec = { MFX_PERF_TRACE_TAG, (uint32_t)task << 16 | uint32_t(size), opcode, ring.tid, EventTimestamp() };
+    ring.Write(head, &rec, sizeof(rec));
+    if (ptr && size > 0)
+        ring.Write(head + sizeof(rec), ptr, size);
+
+    ring.head.store(head + recSize, std::memory_order_release);
+    return 0;
+}
+
+static bool StartBuffered()
+{
+    const char* path = getenv("VPL_EVENT_TRACE_FILE");
+    perf_ctx.to_file = path != nullptr;
+
+    if (!perf_ctx.to_file && !getenv("VPL_EVENT_TRACE_BUFFERED"))
+        return true;
+
+    if (perf_ctx.to_file && !perf_ctx.file.Open(path))
+        return false;
+
+    perf_ctx.drop    = getenv("VPL_EVENT_TRACE_DROP") != nullptr;
+    perf_ctx.dropped = 0;
+    perf_ctx.running = true;
+    perf_ctx.flusher = std::thread(FlushThread);
+    perf_ctx.buffered.store(true, std::memory_order_release);
+    return true;
+}
+
+static void StopBuffered()
+{
+    if (!perf_ctx.buffered.exchange(false))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(perf_ctx.flush_mutex);
+        perf_ctx.running = false;
+    }
+    perf_ctx.flush_cv.notify_one();
+    perf_ctx.flusher.join();
+
+    DrainRings();
+
+    if (perf_ctx.to_file)
+        perf_ctx.file.Close(perf_ctx.dropped);
+}
+
+extern "C"
+{
+
 mfxTraceU32 MFXTrace_EventInit()
 {
     perf_trace_var = getenv("VPL_EVENT_TRACE");
@@ -46,9 +411,14 @@ mfxTraceU32 MFXTrace_EventInit()
     }
 
     std::lock_guard <std::mutex> lock(perf_ctx.perf_mutex);
-    if (perf_ctx.ftrace_fd == -1) {
-        perf_ctx.ftrace_fd = open("/sys/kernel/debug/tracing/trace_marker_raw", O_WRONLY);
-        if (perf_ctx.ftrace_fd == -1) {
+    if (!perf_ctx.count) {
+        if (!getenv("VPL_EVENT_TRACE_FILE")) {
+            perf_ctx.ftrace_fd = open("/sys/kernel/debug/tracing/trace_marker_raw", O_WRONLY);
+            if (perf_ctx.ftrace_fd == -1) {
+                return 1;
+            }
+        }
+        if (!StartBuffered()) {
             return 1;
         }
     }
@@ -57,26 +427,25 @@ mfxTraceU32 MFXTrace_EventInit()
 }
 
 // It dumps traces to binary format (internal representation) for future offline processing
-mfxTraceU32 MFXTraceEvent(uint16_t task, uint8_t opcode, uint8_t level, uint64_t size, const void *ptr)
+mfxTraceU32 MFXTraceEvent(uint16_t task, uint8_t opcode, uint8_t /*level*/, uint64_t size, const void *ptr)
 {
+    size_t buf_len = sizeof(uint32_t) * 3;
+    if (buf_len + size >= MFX_PERF_TRACE_BUFFER_SIZE) {
+        return 1;
+    }
+
+    if (perf_ctx.buffered.load(std::memory_order_acquire)) {
+        return PushEvent(task, opcode, size, ptr);
+    }
+
     if (perf_ctx.ftrace_fd == -1) {
         return 0;
     }
-    uint64_t thread_id = syscall(SYS_gettid);
-    uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
+    // ftrace stamps the marker with time and thread itself, only the used part of the buffer is filled
     uint8_t trace_buf[MFX_PERF_TRACE_BUFFER_SIZE];
-    memset(trace_buf,0,MFX_PERF_TRACE_BUFFER_SIZE);
-    uint32_t *header = (uint32_t *)trace_buf;
-    const char *tag = "FTMI"; // IMTE + 1 = IMTF (IntelMediaTraceEvent + 1) value is used as ftrace raw marker tag
-    // It is reversed due to endianness
-    memcpy(&header[0], tag, sizeof(header[0]));
-    header[1] = (uint32_t)task << 16 | size;
-    header[2] = opcode;
-    size_t buf_len = sizeof(uint32_t) * 3;
-    if (buf_len + size >= MFX_PERF_TRACE_BUFFER_SIZE) {
-        return 1;
-    }
+    uint32_t header[3] = { MFX_PERF_TRACE_TAG, (uint32_t)task << 16 | uint32_t(size), opcode };
+    memcpy(trace_buf, header, sizeof(header));
 
     if (ptr && size > 0)
     {
@@ -84,8 +453,8 @@ mfxTraceU32 MFXTraceEvent(uint16_t task, uint8_t opcode, uint8_t level, uint64_t
         buf_len += size;
     }
 
-    size_t written_bytes = write(perf_ctx.ftrace_fd, trace_buf, buf_len);
-    if (written_bytes != buf_len) {
+    ssize_t written_bytes = write(perf_ctx.ftrace_fd, trace_buf, buf_len);
+    if (written_bytes != ssize_t(buf_len)) {
         return 1;
     }
     return 0;
@@ -94,9 +463,13 @@ mfxTraceU32 MFXTraceEvent(uint16_t task, uint8_t opcode, uint8_t level, uint64_t
 mfxTraceU32 MFXTrace_EventClose()
 {
     std::lock_guard <std::mutex> lock(perf_ctx.perf_mutex);
+    if (!perf_ctx.count) {
+        return 0;
+    }
     --perf_ctx.count;
     if (!perf_ctx.count) {
-        if (close(perf_ctx.ftrace_fd)) {
+        StopBuffered();
+        if (perf_ctx.ftrace_fd != -1 && close(perf_ctx.ftrace_fd)) {
             return 1;
         }
         perf_ctx.ftrace_fd = -1;
@@ -105,4 +478,3 @@ mfxTraceU32 MFXTrace_EventClose()
 }
 
 } // extern "C"
-
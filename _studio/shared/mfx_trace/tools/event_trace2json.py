@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Converts a VPL_EVENT_TRACE_FILE capture into Chrome-trace JSON.
+
+The output opens in chrome://tracing and ui.perfetto.dev. The file starts with
+
+    uint32 magic "VPLE", uint32 version, uint32 pid, uint32 reserved, uint64 dropped
+
+followed by records padded to 8 bytes, see EventRecord in mfx_trace_ir.cpp:
+
+    uint32 tag "FTMI", uint32 task << 16 | size, uint32 opcode, uint32 tid,
+    uint64 timestamp (CLOCK_MONOTONIC, ns), size bytes of payload
+
+EVENT_TYPE_START / EVENT_TYPE_END become duration events, the rest are instant
+events. Task names come from enum mfxTraceTaskType in mfx_trace.h.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+FILE_HEADER = struct.Struct('<4sIIIQ')
+RECORD = struct.Struct('<4sIIIQ')
+
+PHASE = {1: 'B', 2: 'E'}
+
+
+def task_names(header):
+    try:
+        with open(header) as f:
+            text = f.read()
+    except OSError:
+        return {}
+
+    m = re.search(r'enum\s+mfxTraceTaskType\s*\{(.*?)\}', text, re.S)
+    if not m:
+        return {}
+
+    names = {}
+    value = -1
+    for item in re.sub(r'//[^\n]*|/\*.*?\*/', '', m.group(1), flags=re.S).split(','):
+        item = item.strip()
+        if not item:
+            continue
+        name, _, init = item.partition('=')
+        value = int(init.strip(), 0) if init.strip() else value + 1
+        names[value] = name.strip()
+    return names
+
+
+def records(data):
+    pos = FILE_HEADER.size
+    while pos + RECORD.size <= len(data):
+        tag, task_size, opcode, tid, ts = RECORD.unpack_from(data, pos)
+        if tag != b'FTMI':
+            raise ValueError('bad record tag at offset %d' % pos)
+        size = task_size & 0xffff
+        payload = data[pos + RECORD.size:pos + RECORD.size + size]
+        yield task_size >> 16, opcode, tid, ts, payload
+        pos += (RECORD.size + size + 7) & ~7
+
+
+def main():
+    default_header = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'include', 'mfx_trace.h')
+
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('input', help='binary capture written for VPL_EVENT_TRACE_FILE')
+    ap.add_argument('-o', '--output', help='JSON file, stdout by default')
+    ap.add_argument('--header', default=default_header, help='mfx_trace.h to take task names from')
+    args = ap.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    if len(data) < FILE_HEADER.size:
+        sys.exit('%s: truncated file' % args.input)
+    magic, version, pid, _, dropped = FILE_HEADER.unpack_from(data)
+    if magic != b'VPLE' or version != 1:
+        sys.exit('%s: not a VPL event trace' % args.input)
+
+    names = task_names(args.header)
+    # rings are drained one thread at a time, the stable sort keeps B/E order within a thread
+    recs = sorted(records(data), key=lambda rec: rec[3])
+    start = recs[0][3] if recs else 0
+    events = []
+    for task, opcode, tid, ts, payload in recs:
+        event = {
+            'name': names.get(task, 'task_%d' % task),
+            'ph': PHASE.get(opcode, 'i'),
+            'ts': (ts - start) / 1000.0,
+            'pid': pid,
+            'tid': tid,
+        }
+        if event['ph'] == 'i':
+            event['s'] = 't'
+        if payload:
+            event['args'] = {'data': payload.hex()}
+        events.append(event)
+
+    out = {
+        'traceEvents': events,
+        'displayTimeUnit': 'ns',
+        'otherData': {'dropped': dropped},
+    }
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(out, f)
+    else:
+        json.dump(out, sys.stdout)
+
+    sys.stderr.write('%d events, %d dropped\n' % (len(events), dropped))
+
+
+if __name__ == '__main__':
+    main()
@@ -20,14 +20,90 @@
 
 #include "fast_copy.h"
 
+#include <thread>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
 #define FAFT_COPY_CPU_DISP_INIT_C(func)           (func ## _C)
 #define FAFT_COPY_CPU_DISP_INIT_SSE4(func)        (func ## _SSE4)
+#define FAFT_COPY_CPU_DISP_INIT_AVX2(func)        (func ## _AVX2)
+#define FAFT_COPY_CPU_DISP_INIT_AVX512(func)      (func ## _AVX512)
 #define FAFT_COPY_CPU_DISP_INIT_SSE4_C(func)      (m_SSE4_available ? FAFT_COPY_CPU_DISP_INIT_SSE4(func) : FAFT_COPY_CPU_DISP_INIT_C(func))
+#define FAFT_COPY_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(func) \
+    (m_AVX512_available ? FAFT_COPY_CPU_DISP_INIT_AVX512(func) : \
+     m_AVX2_available   ? FAFT_COPY_CPU_DISP_INIT_AVX2(func)   : \
+                          FAFT_COPY_CPU_DISP_INIT_SSE4_C(func))
 
 mfxI32 CpuFeature_SSE41() {
     return((__builtin_cpu_supports("sse4.1")));
 }
 
+mfxI32 CpuFeature_AVX2() {
+    return((__builtin_cpu_supports("avx2")));
+}
+
+mfxI32 CpuFeature_AVX512BW() {
+    return((__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")));
+}
+
+FastCopyContext::NodeLoad FastCopyContext::m_nodes[FastCopyContext::MAX_NODES] = {};
+
+FastCopyContext::FastCopyContext()
+    : m_node(GetCurrentNode())
+    , m_copiesToRefresh(NODE_REFRESH)
+{
+}
+
+FastCopyContext & FastCopyContext::Get()
+{
+    static thread_local FastCopyContext context;
+    return context;
+}
+
+mfxU32 FastCopyContext::GetCurrentNode()
+{
+    unsigned cpu = 0, node = 0;
+
+    // getcpu has no glibc wrapper before 2.29
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        return 0;
+
+    return node % MAX_NODES;
+}
+
+std::atomic<mfxU32> & FastCopyContext::InFlight()
+{
+    if (--m_copiesToRefresh == 0)
+    {
+        m_node = GetCurrentNode();
+        m_copiesToRefresh = NODE_REFRESH;
+    }
+
+    return m_nodes[m_node].inFlight;
+}
+
+// half of the last level cache, the other half is left to the sessions' own work
+size_t FastCopyContext::GetCacheBudget()
+{
+    long llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (llc <= 0)
+        llc = sysconf(_SC_LEVEL2_CACHE_SIZE);
+
+    return llc > 0 ? size_t(llc) / 2 : size_t(4) << 20;
+}
+
+bool FastCopyContext::IsOverCacheBudget(mfxU32 inFlight, size_t bytes)
+{
+    static const size_t budget = GetCacheBudget();
+    // copies beyond the number of CPUs wait for one, they don't share the cache at the same time
+    static const mfxU32 numCpus = std::max<mfxU32>(std::thread::hardware_concurrency(), 1);
+
+    const mfxU32 running = std::min(inFlight, numCpus);
+
+    return running > 1 && running * bytes > budget;
+}
+
 void copyVideoToSys(const mfxU8* src, mfxU8* dst, int width)
 {
     static const int m_SSE4_available = CpuFeature_SSE41();
@@ -37,6 +113,15 @@ void copyVideoToSys(const mfxU8* src, mfxU8* dst, int width)
     copyVideoToSys_impl(src, dst, width);
 }
 
+void copyVideoToSysStream(const mfxU8* src, mfxU8* dst, int width)
+{
+    static const int m_SSE4_available = CpuFeature_SSE41();
+
+    static const t_copyVideoToSys copyVideoToSysStream_impl = FAFT_COPY_CPU_DISP_INIT_SSE4_C(copyVideoToSysStream);
+
+    copyVideoToSysStream_impl(src, dst, width);
+}
+
 void copyVideoToSysShift(const mfxU16* src, mfxU16* dst, int width, int shift)
 {
     static const int m_SSE4_available = CpuFeature_SSE41();
@@ -55,6 +140,45 @@ void copySysToVideoShift(const mfxU16* src, mfxU16* dst, int width, int shift)
     copySysToVideoShift_impl(src, dst, width, shift);
 }
 
+// SSE4 and C have row kernels only
+template <t_copyVideoToSysShift copyRow>
+static void copyShiftRect(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    for (int h = 0; h < roi.height; h++)
+    {
+        copyRow(src, dst, roi.width, shift);
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+}
+
+static const t_copyShiftRect copyVideoToSysShiftRect_SSE4 = copyShiftRect<copyVideoToSysShift_SSE4>;
+static const t_copyShiftRect copyVideoToSysShiftRect_C    = copyShiftRect<copyVideoToSysShift_C>;
+static const t_copyShiftRect copySysToVideoShiftRect_SSE4 = copyShiftRect<copySysToVideoShift_SSE4>;
+static const t_copyShiftRect copySysToVideoShiftRect_C    = copyShiftRect<copySysToVideoShift_C>;
+
+void copyVideoToSysShiftRect(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    static const int m_SSE4_available   = CpuFeature_SSE41();
+    static const int m_AVX2_available   = CpuFeature_AVX2();
+    static const int m_AVX512_available = CpuFeature_AVX512BW();
+
+    static const t_copyShiftRect copyVideoToSysShiftRect_impl = FAFT_COPY_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(copyVideoToSysShiftRect);
+
+    copyVideoToSysShiftRect_impl(src, srcPitch, dst, dstPitch, roi, shift);
+}
+
+void copySysToVideoShiftRect(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    static const int m_SSE4_available   = CpuFeature_SSE41();
+    static const int m_AVX2_available   = CpuFeature_AVX2();
+    static const int m_AVX512_available = CpuFeature_AVX512BW();
+
+    static const t_copyShiftRect copySysToVideoShiftRect_impl = FAFT_COPY_CPU_DISP_INIT_AVX512_AVX2_SSE4_C(copySysToVideoShiftRect);
+
+    copySysToVideoShiftRect_impl(src, srcPitch, dst, dstPitch, roi, shift);
+}
+
 void copySysVariantToVideo(const mfxU8* src, int loffset, mfxU16* dst, int width)
 {
     static const int m_SSE4_available = CpuFeature_SSE41();
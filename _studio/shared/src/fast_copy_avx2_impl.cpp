@@ -0,0 +1,187 @@
+/*//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 Intel Corporation
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+*/
+#include "fast_copy_avx2_impl.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+// Loads are aligned to the source, stores go around the cache when the destination
+// shares that alignment. Shift amount is the same for the whole row.
+template <bool bStream>
+static inline void StoreRow(__m256i * dst, __m256i val)
+{
+    if (bStream)
+        _mm256_stream_si256(dst, val);
+    else
+        _mm256_storeu_si256(dst, val);
+}
+
+template <bool bStream>
+static void copyVideoToSysShiftBody_AVX2(const mfxU16* &src, mfxU16* &dst, int &width, __m128i shift)
+{
+    static const int item_size = 4 * sizeof(__m256i) / sizeof(mfxU16);
+
+    __m256i * src_reg = (__m256i *)src;
+    __m256i * dst_reg = (__m256i *)dst;
+
+    for (; width >= item_size; width -= item_size)
+    {
+        __m256i ymm0 = _mm256_stream_load_si256(src_reg);
+        __m256i ymm1 = _mm256_stream_load_si256(src_reg + 1);
+        __m256i ymm2 = _mm256_stream_load_si256(src_reg + 2);
+        __m256i ymm3 = _mm256_stream_load_si256(src_reg + 3);
+        StoreRow<bStream>(dst_reg,     _mm256_srl_epi16(ymm0, shift));
+        StoreRow<bStream>(dst_reg + 1, _mm256_srl_epi16(ymm1, shift));
+        StoreRow<bStream>(dst_reg + 2, _mm256_srl_epi16(ymm2, shift));
+        StoreRow<bStream>(dst_reg + 3, _mm256_srl_epi16(ymm3, shift));
+
+        src_reg += 4;
+        dst_reg += 4;
+    }
+
+    for (; width >= (int)(sizeof(__m256i) / sizeof(mfxU16)); width -= sizeof(__m256i) / sizeof(mfxU16))
+    {
+        StoreRow<bStream>(dst_reg, _mm256_srl_epi16(_mm256_stream_load_si256(src_reg), shift));
+        src_reg += 1;
+        dst_reg += 1;
+    }
+
+    src = (const mfxU16 *)src_reg;
+    dst = (mfxU16 *)dst_reg;
+}
+
+template <bool bStream>
+static void copySysToVideoShiftBody_AVX2(const mfxU16* &src, mfxU16* &dst, int &width, __m128i shift)
+{
+    static const int item_size = 4 * sizeof(__m256i) / sizeof(mfxU16);
+
+    __m256i * src_reg = (__m256i *)src;
+    __m256i * dst_reg = (__m256i *)dst;
+
+    for (; width >= item_size; width -= item_size)
+    {
+        __m256i ymm0 = _mm256_loadu_si256(src_reg);
+        __m256i ymm1 = _mm256_loadu_si256(src_reg + 1);
+        __m256i ymm2 = _mm256_loadu_si256(src_reg + 2);
+        __m256i ymm3 = _mm256_loadu_si256(src_reg + 3);
+        StoreRow<bStream>(dst_reg,     _mm256_sll_epi16(ymm0, shift));
+        StoreRow<bStream>(dst_reg + 1, _mm256_sll_epi16(ymm1, shift));
+        StoreRow<bStream>(dst_reg + 2, _mm256_sll_epi16(ymm2, shift));
+        StoreRow<bStream>(dst_reg + 3, _mm256_sll_epi16(ymm3, shift));
+
+        src_reg += 4;
+        dst_reg += 4;
+    }
+
+    for (; width >= (int)(sizeof(__m256i) / sizeof(mfxU16)); width -= sizeof(__m256i) / sizeof(mfxU16))
+    {
+        StoreRow<bStream>(dst_reg, _mm256_sll_epi16(_mm256_loadu_si256(src_reg), shift));
+        src_reg += 1;
+        dst_reg += 1;
+    }
+
+    src = (const mfxU16 *)src_reg;
+    dst = (mfxU16 *)dst_reg;
+}
+
+// Rows of a rect start at the same offset from the vector boundary when both pitches
+// are multiples of the vector size, then head length and store mode are found once.
+void copyVideoToSysShiftRect_AVX2(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    const bool bSamePhase = !(srcPitch & 0x1f) && !(dstPitch & 0x1f);
+    const __m128i xmm_shift = _mm_cvtsi32_si128(shift);
+    int align32 = 0;
+    bool bStream = false;
+
+    for (int h = 0; h < roi.height; h++)
+    {
+        if (!h || !bSamePhase)
+        {
+            // align source (video memory) for streaming loads
+            align32 = (int)(((0x20 - (reinterpret_cast<size_t>(src) & 0x1f)) & 0x1f) / sizeof(mfxU16));
+            align32 = std::min(align32, roi.width);
+            bStream = !(reinterpret_cast<size_t>(dst + align32) & 0x1f);
+        }
+
+        const mfxU16* s = src;
+        mfxU16* d = dst;
+        int width = roi.width - align32;
+
+        for (int i = 0; i < align32; i++)
+            *d++ = (*s++) >> shift;
+
+        if (bStream)
+            copyVideoToSysShiftBody_AVX2<true>(s, d, width, xmm_shift);
+        else
+            copyVideoToSysShiftBody_AVX2<false>(s, d, width, xmm_shift);
+
+        for (; width > 0; width--)
+            *d++ = (*s++) >> shift;
+
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+
+    _mm_sfence();
+}
+
+void copySysToVideoShiftRect_AVX2(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    const bool bSamePhase = !(dstPitch & 0x1f);
+    const __m128i xmm_shift = _mm_cvtsi32_si128(shift);
+    int align32 = 0;
+    bool bStream = false;
+
+    for (int h = 0; h < roi.height; h++)
+    {
+        if (!h || !bSamePhase)
+        {
+            // align destination (video memory) for streaming stores
+            align32 = (int)(((0x20 - (reinterpret_cast<size_t>(dst) & 0x1f)) & 0x1f) / sizeof(mfxU16));
+            align32 = std::min(align32, roi.width);
+            bStream = !(reinterpret_cast<size_t>(dst + align32) & 0x1f);
+        }
+
+        const mfxU16* s = src;
+        mfxU16* d = dst;
+        int width = roi.width - align32;
+
+        for (int i = 0; i < align32; i++)
+            *d++ = (*s++) << shift;
+
+        if (bStream)
+            copySysToVideoShiftBody_AVX2<true>(s, d, width, xmm_shift);
+        else
+            copySysToVideoShiftBody_AVX2<false>(s, d, width, xmm_shift);
+
+        for (; width > 0; width--)
+            *d++ = (*s++) << shift;
+
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+
+    _mm_sfence();
+}
+
+#endif // __AVX2__
@@ -0,0 +1,207 @@
+/*//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2025 Intel Corporation
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+*/
+#include "fast_copy_avx512_impl.h"
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+#include <immintrin.h>
+
+// Same scheme as the AVX2 kernels, the row tail is handled by masked loads/stores.
+template <bool bStream>
+static inline void StoreRow(__m512i * dst, __m512i val)
+{
+    if (bStream)
+        _mm512_stream_si512(dst, val);
+    else
+        _mm512_storeu_si512(dst, val);
+}
+
+static inline __mmask32 TailMask(int width)
+{
+    return (__mmask32)((1ull << width) - 1);
+}
+
+template <bool bStream>
+static void copyVideoToSysShiftBody_AVX512(const mfxU16* &src, mfxU16* &dst, int &width, __m128i shift)
+{
+    static const int item_size = 4 * sizeof(__m512i) / sizeof(mfxU16);
+
+    __m512i * src_reg = (__m512i *)src;
+    __m512i * dst_reg = (__m512i *)dst;
+
+    for (; width >= item_size; width -= item_size)
+    {
+        __m512i zmm0 = _mm512_stream_load_si512(src_reg);
+        __m512i zmm1 = _mm512_stream_load_si512(src_reg + 1);
+        __m512i zmm2 = _mm512_stream_load_si512(src_reg + 2);
+        __m512i zmm3 = _mm512_stream_load_si512(src_reg + 3);
+        StoreRow<bStream>(dst_reg,     _mm512_srl_epi16(zmm0, shift));
+        StoreRow<bStream>(dst_reg + 1, _mm512_srl_epi16(zmm1, shift));
+        StoreRow<bStream>(dst_reg + 2, _mm512_srl_epi16(zmm2, shift));
+        StoreRow<bStream>(dst_reg + 3, _mm512_srl_epi16(zmm3, shift));
+
+        src_reg += 4;
+        dst_reg += 4;
+    }
+
+    for (; width >= (int)(sizeof(__m512i) / sizeof(mfxU16)); width -= sizeof(__m512i) / sizeof(mfxU16))
+    {
+        StoreRow<bStream>(dst_reg, _mm512_srl_epi16(_mm512_stream_load_si512(src_reg), shift));
+        src_reg += 1;
+        dst_reg += 1;
+    }
+
+    src = (const mfxU16 *)src_reg;
+    dst = (mfxU16 *)dst_reg;
+}
+
+template <bool bStream>
+static void copySysToVideoShiftBody_AVX512(const mfxU16* &src, mfxU16* &dst, int &width, __m128i shift)
+{
+    static const int item_size = 4 * sizeof(__m512i) / sizeof(mfxU16);
+
+    __m512i * src_reg = (__m512i *)src;
+    __m512i * dst_reg = (__m512i *)dst;
+
+    for (; width >= item_size; width -= item_size)
+    {
+        __m512i zmm0 = _mm512_loadu_si512(src_reg);
+        __m512i zmm1 = _mm512_loadu_si512(src_reg + 1);
+        __m512i zmm2 = _mm512_loadu_si512(src_reg + 2);
+        __m512i zmm3 = _mm512_loadu_si512(src_reg + 3);
+        StoreRow<bStream>(dst_reg,     _mm512_sll_epi16(zmm0, shift));
+        StoreRow<bStream>(dst_reg + 1, _mm512_sll_epi16(zmm1, shift));
+        StoreRow<bStream>(dst_reg + 2, _mm512_sll_epi16(zmm2, shift));
+        StoreRow<bStream>(dst_reg + 3, _mm512_sll_epi16(zmm3, shift));
+
+        src_reg += 4;
+        dst_reg += 4;
+    }
+
+    for (; width >= (int)(sizeof(__m512i) / sizeof(mfxU16)); width -= sizeof(__m512i) / sizeof(mfxU16))
+    {
+        StoreRow<bStream>(dst_reg, _mm512_sll_epi16(_mm512_loadu_si512(src_reg), shift));
+        src_reg += 1;
+        dst_reg += 1;
+    }
+
+    src = (const mfxU16 *)src_reg;
+    dst = (mfxU16 *)dst_reg;
+}
+
+// Rows of a rect start at the same offset from the vector boundary when both pitches
+// are multiples of the vector size, then head length and store mode are found once.
+void copyVideoToSysShiftRect_AVX512(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    const bool bSamePhase = !(srcPitch & 0x3f) && !(dstPitch & 0x3f);
+    const __m128i xmm_shift = _mm_cvtsi32_si128(shift);
+    int align64 = 0;
+    bool bStream = false;
+
+    for (int h = 0; h < roi.height; h++)
+    {
+        if (!h || !bSamePhase)
+        {
+            // align source (video memory) for streaming loads
+            align64 = (int)(((0x40 - (reinterpret_cast<size_t>(src) & 0x3f)) & 0x3f) / sizeof(mfxU16));
+            align64 = std::min(align64, roi.width);
+            bStream = !(reinterpret_cast<size_t>(dst + align64) & 0x3f);
+        }
+
+        const mfxU16* s = src;
+        mfxU16* d = dst;
+        int width = roi.width - align64;
+
+        if (align64)
+        {
+            __m512i zmm0 = _mm512_maskz_loadu_epi16(TailMask(align64), s);
+            _mm512_mask_storeu_epi16(d, TailMask(align64), _mm512_srl_epi16(zmm0, xmm_shift));
+            s += align64;
+            d += align64;
+        }
+
+        if (bStream)
+            copyVideoToSysShiftBody_AVX512<true>(s, d, width, xmm_shift);
+        else
+            copyVideoToSysShiftBody_AVX512<false>(s, d, width, xmm_shift);
+
+        if (width > 0)
+        {
+            __m512i zmm0 = _mm512_maskz_loadu_epi16(TailMask(width), s);
+            _mm512_mask_storeu_epi16(d, TailMask(width), _mm512_srl_epi16(zmm0, xmm_shift));
+        }
+
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+
+    _mm_sfence();
+}
+
+void copySysToVideoShiftRect_AVX512(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    const bool bSamePhase = !(dstPitch & 0x3f);
+    const __m128i xmm_shift = _mm_cvtsi32_si128(shift);
+    int align64 = 0;
+    bool bStream = false;
+
+    for (int h = 0; h < roi.height; h++)
+    {
+        if (!h || !bSamePhase)
+        {
+            // align destination (video memory) for streaming stores
+            align64 = (int)(((0x40 - (reinterpret_cast<size_t>(dst) & 0x3f)) & 0x3f) / sizeof(mfxU16));
+            align64 = std::min(align64, roi.width);
+            bStream = !(reinterpret_cast<size_t>(dst + align64) & 0x3f);
+        }
+
+        const mfxU16* s = src;
+        mfxU16* d = dst;
+        int width = roi.width - align64;
+
+        if (align64)
+        {
+            __m512i zmm0 = _mm512_maskz_loadu_epi16(TailMask(align64), s);
+            _mm512_mask_storeu_epi16(d, TailMask(align64), _mm512_sll_epi16(zmm0, xmm_shift));
+            s += align64;
+            d += align64;
+        }
+
+        if (bStream)
+            copySysToVideoShiftBody_AVX512<true>(s, d, width, xmm_shift);
+        else
+            copySysToVideoShiftBody_AVX512<false>(s, d, width, xmm_shift);
+
+        if (width > 0)
+        {
+            __m512i zmm0 = _mm512_maskz_loadu_epi16(TailMask(width), s);
+            _mm512_mask_storeu_epi16(d, TailMask(width), _mm512_sll_epi16(zmm0, xmm_shift));
+        }
+
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+
+    _mm_sfence();
+}
+
+#endif // __AVX512F__ && __AVX512BW__
@@ -26,6 +26,11 @@ void copyVideoToSys_C(const mfxU8* src, mfxU8* dst, int width)
     std::copy(src, src + width, dst);
 }
 
+void copyVideoToSysStream_C(const mfxU8* src, mfxU8* dst, int width)
+{
+    std::copy(src, src + width, dst);
+}
+
 void copyVideoToSysShift_C(const mfxU16* src, mfxU16* dst, int width, int shift)
 {
     for (int i = 0; i < width; i++)
@@ -1,4 +1,4 @@
-// Copyright (c) 2009-2020 Intel Corporation
+// Copyright (c) 2009-2025 Intel Corporation
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -18,83 +18,72 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include "fast_copy.h"
+#include "fast_copy_multithreading.h"
 
-#include "umc_event.h"
-#include <thread>
-#include "libmfx_allocator.h"
+// minimal amount of bytes copied by one thread, smaller bands don't pay off the synchronization
+#define FC_MIN_BAND_SIZE (2 * 1024 * 1024)
+// upper limit of threads copying one frame, more threads saturate memory bandwidth anyway
+#define FC_MAX_THREADS 8
+#define FC_CACHE_LINE_SIZE 64
 
-struct FC_TASK
+static mfxU32 gcd(mfxU32 a, mfxU32 b)
 {
-    // pointers to source and destination
-    Ipp8u *pS;
-    Ipp8u *pD;
-
-    // size of chunk to copy
-    Ipp32u chunkSize;
-
-    // pitches and frame size
-    IppiSize roi;
-    Ipp32u srcPitch, dstPitch;
-    int flag;
-
-    // event handles
-    UMC::Event EventStart;
-    UMC::Event EventEnd;
-};
+    while (b)
+    {
+        mfxU32 t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
 
-class FastCopyMultithreading : public FastCopy
+// minimal number of rows which keeps both source and destination band starts cache line aligned
+static mfxU32 GetBandRowAlignment(mfxU32 srcPitch, mfxU32 dstPitch)
 {
-public:
-
-    // constructor
-    FastCopyMultithreading(void);
+    mfxU32 srcRows = FC_CACHE_LINE_SIZE / gcd(srcPitch, FC_CACHE_LINE_SIZE);
+    mfxU32 dstRows = FC_CACHE_LINE_SIZE / gcd(dstPitch, FC_CACHE_LINE_SIZE);
 
-    // destructor
-    virtual ~FastCopyMultithreading(void);
+    return srcRows / gcd(srcRows, dstRows) * dstRows;
+}
 
-    // initialize available functionality
-    mfxStatus Initialize(void);
-
-    // release object
-    mfxStatus Release(void);
-
-    // copy memory by streaming
-    mfxStatus Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag);
-
-protected:
+mfxStatus FastCopyByBands(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag, bool bStreaming)
+{
+    FastCopyMultithreading & pool = FastCopyMultithreading::GetPool();
 
-   // synchronize threads
-    mfxStatus Synchronize(void);
+    if (pool.GetNumBands(roi) < 2)
+        return MFX_ERR_UNSUPPORTED;
 
-    static mfxU32 __STDCALL CopyByThread(void *object);
-    static IppBool m_bCopyQuit;
+    return pool.Copy(pDst, dstPitch, pSrc, srcPitch, roi, flag, bStreaming);
+}
 
-    // handles
-    std::thread *m_pThreads;
-    Ipp32u m_numThreads;
+FastCopyMultithreading & FastCopyMultithreading::GetPool(void)
+{
+    // threads are started on the first large copy and live until the library is unloaded
+    static FastCopyMultithreading pool;
+    static std::once_flag initialized;
 
-    FC_TASK *m_tasks;
-};
+    std::call_once(initialized, [] { pool.Initialize(); });
 
-IppBool FastCopyMultithreading::m_bCopyQuit = ippFalse;
+    return pool;
+}
 
 FastCopyMultithreading::FastCopyMultithreading(void)
+    : m_bCopyQuit(false)
 {
     m_pThreads = NULL;
     m_tasks = NULL;
 
     m_numThreads = 0;
 
-} // FastCopy::FastCopy(void)
+} // FastCopyMultithreading::FastCopyMultithreading(void)
 
 FastCopyMultithreading::~FastCopyMultithreading(void)
 {
     Release();
 
-} // FastCopy::~FastCopy(void)
+} // FastCopyMultithreading::~FastCopyMultithreading(void)
 
-mfxStatus FastCopyMultithreading::Initialize(void)
+mfxStatus FastCopyMultithreading::Initialize(mfxU32 numThreads)
 {
     mfxStatus sts = MFX_ERR_NONE;
     mfxU32 i = 0;
@@ -102,18 +91,20 @@ mfxStatus FastCopyMultithreading::Initialize(void)
     // release object before allocation
     Release();
 
-    if (MFX_ERR_NONE == sts)
+    if (0 == numThreads)
     {
-        // streaming is on
-        m_numThreads = 1;
+        numThreads = std::min<mfxU32>(std::thread::hardware_concurrency(), FC_MAX_THREADS);
     }
-    if (MFX_ERR_NONE == sts)
-    {
-        m_pThreads = new std::thread[m_numThreads];
-        m_tasks = new FC_TASK[m_numThreads];
 
-        if (!m_pThreads || !m_tasks) sts = MFX_ERR_MEMORY_ALLOC;
-    }
+    // the calling thread copies the last band by itself
+    m_numThreads = std::max<mfxU32>(numThreads, 1);
+
+    if (m_numThreads < 2)
+        return MFX_ERR_NONE;
+
+    m_pThreads = new std::thread[m_numThreads - 1];
+    m_tasks = new FC_TASK[m_numThreads - 1];
+
     // initialize events
     for (i = 0; (MFX_ERR_NONE == sts) && (i < m_numThreads - 1); i += 1)
     {
@@ -129,15 +120,20 @@ mfxStatus FastCopyMultithreading::Initialize(void)
     // run threads
     for (i = 0; (MFX_ERR_NONE == sts) && (i < m_numThreads - 1); i += 1)
     {
-        m_pThreads[i] = std::thread([this, i]() { CopyByThread((void *)(m_tasks + i)); });
+        m_pThreads[i] = std::thread([this, i]() { CopyByThread(m_tasks + i); });
     }
 
-    return MFX_ERR_NONE;
-} // mfxStatus FastCopy::Initialize(void)
+    if (MFX_ERR_NONE != sts)
+    {
+        Release();
+    }
+
+    return sts;
+} // mfxStatus FastCopyMultithreading::Initialize(mfxU32 numThreads)
 
 mfxStatus FastCopyMultithreading::Release(void)
 {
-    m_bCopyQuit = ippTrue;
+    m_bCopyQuit = true;
 
     if ((m_numThreads > 1) && m_tasks && m_pThreads)
     {
@@ -164,68 +160,100 @@ mfxStatus FastCopyMultithreading::Release(void)
         m_tasks = NULL;
     }
 
-    m_bCopyQuit = ippFalse;
+    m_bCopyQuit = false;
 
     return MFX_ERR_NONE;
 
-} // mfxStatus FastCopy::Release(void)
+} // mfxStatus FastCopyMultithreading::Release(void)
+
+mfxU32 FastCopyMultithreading::GetNumBands(IppiSize roi) const
+{
+    if (roi.width <= 0 || roi.height <= 0)
+        return 1;
+
+    mfxU64 frameSize = (mfxU64)roi.width * roi.height;
+
+    return (mfxU32)std::max<mfxU64>(std::min<mfxU64>(frameSize / FC_MIN_BAND_SIZE, m_numThreads), 1);
 
-mfxStatus FastCopyMultithreading::Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag)
+} // mfxU32 FastCopyMultithreading::GetNumBands(IppiSize roi) const
+
+mfxStatus FastCopyMultithreading::Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag, bool bStreaming)
 {
     if (NULL == pDst || NULL == pSrc)
     {
         return MFX_ERR_NULL_PTR;
     }
 
-    mfxU32 partSize = roi.height / m_numThreads;
-    mfxU32 rest = roi.height % m_numThreads;
+    // don't queue behind another frame, the caller is better off copying by itself
+    std::unique_lock<std::mutex> busy(m_busy, std::try_to_lock);
+    if (!busy.owns_lock())
+    {
+        return MFX_WRN_DEVICE_BUSY;
+    }
 
-    roi.height = partSize;
+    mfxU32 numBands = GetNumBands(roi);
+    mfxU32 rowAlign = GetBandRowAlignment(srcPitch, dstPitch);
+
+    mfxU32 partSize = (roi.height + numBands - 1) / numBands;
+    partSize = (partSize + rowAlign - 1) / rowAlign * rowAlign;
+
+    // alignment may leave less bands to copy
+    numBands = (roi.height + partSize - 1) / partSize;
 
     // distribute tasks
-    for (mfxU32 i = 0; i < m_numThreads - 1; i += 1)
+    for (mfxU32 i = 0; i < numBands - 1; i += 1)
     {
-        m_tasks[i].pS = pSrc + i * (partSize * srcPitch);
-        m_tasks[i].pD = pDst + i * (partSize * dstPitch);
+        m_tasks[i].pS = pSrc + (size_t)i * partSize * srcPitch;
+        m_tasks[i].pD = pDst + (size_t)i * partSize * dstPitch;
         m_tasks[i].srcPitch = srcPitch;
         m_tasks[i].dstPitch = dstPitch;
-        m_tasks[i].roi = roi;
+        m_tasks[i].roi.width = roi.width;
+        m_tasks[i].roi.height = partSize;
         m_tasks[i].flag = flag;
+        m_tasks[i].bStreaming = bStreaming;
 
         m_tasks[i].EventStart.Set();
     }
 
-    if (rest != 0)
-    {
-        roi.height = rest;
-    }
+    // the last band is copied on the calling thread
+    FC_TASK last;
+    last.pS = pSrc + (size_t)(numBands - 1) * partSize * srcPitch;
+    last.pD = pDst + (size_t)(numBands - 1) * partSize * dstPitch;
+    last.srcPitch = srcPitch;
+    last.dstPitch = dstPitch;
+    last.roi.width = roi.width;
+    last.roi.height = roi.height - (numBands - 1) * partSize;
+    last.flag = flag;
+    last.bStreaming = bStreaming;
 
-    pSrc = pSrc + (m_numThreads - 1) * (partSize * srcPitch);
-    pDst = pDst + (m_numThreads - 1) * (partSize * dstPitch);
+    CopyBand(last);
 
-    FastCopy::Copy(pDst, dstPitch, pSrc, srcPitch, roi, flag);
+    return Synchronize(numBands - 1);
 
-    Synchronize();
+} // mfxStatus FastCopyMultithreading::Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi, int flag, bool bStreaming)
 
-    return MFX_ERR_NONE;
-
-} // mfxStatus FastCopy::Copy(mfxU8 *pDst, mfxU32 dstPitch, mfxU8 *pSrc, mfxU32 srcPitch, IppiSize roi)
-
-mfxStatus FastCopyMultithreading::Synchronize(void)
+mfxStatus FastCopyMultithreading::Synchronize(mfxU32 numTasks)
 {
-    for (mfxU32 i = 0; i < m_numThreads - 1; i += 1)
+    for (mfxU32 i = 0; i < numTasks; i += 1)
     {
         m_tasks[i].EventEnd.Wait();
     }
 
     return MFX_ERR_NONE;
 
-} // mfxStatus FastCopy::Synchronize(void)
+} // mfxStatus FastCopyMultithreading::Synchronize(mfxU32 numTasks)
+
+void FastCopyMultithreading::CopyBand(const FC_TASK &task)
+{
+    MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_INTERNAL, "FastCopy::CopyBand");
+
+    mfxCopyRect<mfxU8>(task.pS, task.srcPitch, task.pD, task.dstPitch, task.roi, task.flag, task.bStreaming);
+
+} // void FastCopyMultithreading::CopyBand(const FC_TASK &task)
 
 // thread function
-mfxU32 __STDCALL FastCopyMultithreading::CopyByThread(void *arg)
+mfxU32 FastCopyMultithreading::CopyByThread(FC_TASK *task)
 {
-    FC_TASK *task = (FC_TASK *)arg;
     MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_INTERNAL, "ThreadName=FastCopy");
 
     // wait to event
@@ -233,17 +261,7 @@ mfxU32 __STDCALL FastCopyMultithreading::CopyByThread(void *arg)
 
     while (!m_bCopyQuit)
     {
-        mfxU32 srcPitch = task->srcPitch;
-        mfxU32 dstPitch = task->dstPitch;
-        IppiSize roi = task->roi;
-
-        Ipp8u *pSrc = task->pS;
-        Ipp8u *pDst = task->pD;
-
-        {
-            MFX_AUTO_LTRACE(MFX_TRACE_LEVEL_INTERNAL, "FastCopy::Copy");
-            FastCopy::Copy(pDst, dstPitch, pSrc, srcPitch, roi, task->flag);
-        }
+        CopyBand(*task);
 
         // done copy
         task->EventEnd.Set();
@@ -254,4 +272,4 @@ mfxU32 __STDCALL FastCopyMultithreading::CopyByThread(void *arg)
 
     return 0;
 
-} // mfxU32 __stdcall FastCopyMultithreading::CopyByThread(void *arg)
+} // mfxU32 FastCopyMultithreading::CopyByThread(FC_TASK *task)
@@ -78,6 +78,64 @@ void copyVideoToSys_SSE4(const mfxU8* src, mfxU8* dst, int width)
     }
 }
 
+// same as copyVideoToSys_SSE4 but bypasses the cache on the destination side
+void copyVideoToSysStream_SSE4(const mfxU8* src, mfxU8* dst, int width)
+{
+    static const int item_size = 4*sizeof(__m128i);
+
+    // streaming stores need source and destination to share the alignment
+    if ((reinterpret_cast<size_t>(src) ^ reinterpret_cast<size_t>(dst)) & 0xf)
+    {
+        copyVideoToSys_SSE4(src, dst, width);
+        return;
+    }
+
+    int align16 = (0x10 - (reinterpret_cast<size_t>(src) & 0xf)) & 0xf;
+    align16 = std::min(align16, width);
+    for (int i = 0; i < align16; i++)
+        *dst++ = *src++;
+
+    int w = width - align16;
+    int width4 = w & (-item_size);
+
+    __m128i * src_reg = (__m128i *)src;
+    __m128i * dst_reg = (__m128i *)dst;
+
+    int i = 0;
+    for (; i < width4; i += item_size)
+    {
+        __m128i xmm0 = _mm_stream_load_si128(src_reg);
+        __m128i xmm1 = _mm_stream_load_si128(src_reg+1);
+        __m128i xmm2 = _mm_stream_load_si128(src_reg+2);
+        __m128i xmm3 = _mm_stream_load_si128(src_reg+3);
+        _mm_stream_si128(dst_reg, xmm0);
+        _mm_stream_si128(dst_reg+1, xmm1);
+        _mm_stream_si128(dst_reg+2, xmm2);
+        _mm_stream_si128(dst_reg+3, xmm3);
+
+        src_reg += 4;
+        dst_reg += 4;
+    }
+
+    size_t tail_data_sz = w & (item_size - 1);
+    for (; tail_data_sz >= sizeof(__m128i); tail_data_sz -= sizeof(__m128i))
+    {
+        __m128i xmm0 = _mm_stream_load_si128(src_reg);
+        _mm_stream_si128(dst_reg, xmm0);
+        src_reg += 1;
+        dst_reg += 1;
+    }
+
+    src = (const mfxU8 *)src_reg;
+    dst = (mfxU8 *)dst_reg;
+
+    for (; tail_data_sz > 0; tail_data_sz--)
+        *dst++ = *src++;
+
+    // make streaming stores visible to the consumer of the surface
+    _mm_sfence();
+}
+
 void copyVideoToSysShift_SSE4(const mfxU16* src, mfxU16* dst, int width, int shift)
 {
     static const int item_size = 4 * sizeof(__m128i);
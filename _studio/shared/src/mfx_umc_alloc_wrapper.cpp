@@ -370,6 +370,8 @@ UMC::Status mfx_UMC_FrameAllocator::InitMfx(UMC::FrameAllocatorParams *,
             // set correct width & height to planes
             frameData.Init(&m_info, (UMC::FrameMemID)i, this);
         }
+
+        RebuildIndexes();
     }
     else
     {
@@ -387,6 +389,7 @@ UMC::Status mfx_UMC_FrameAllocator::Close()
     Reset();
     m_frameDataInternal.Close();
     m_extSurfaces.clear();
+    RebuildIndexes();
     return UMC::UMC_OK;
 }
 
@@ -420,7 +423,7 @@ UMC::Status mfx_UMC_FrameAllocator::Reset()
             m_extSurfaces[i].isUsed = false;
         }
 
-        m_extSurfaces[i].FrameSurface = 0;
+        SetExtSurface(i, 0);
     }
 
     if (m_IsUseExternalFrames && m_isSWDecode)
@@ -429,6 +432,8 @@ UMC::Status mfx_UMC_FrameAllocator::Reset()
         m_frameDataInternal.Close();
     }
 
+    RebuildIndexes();
+
     return UMC::UMC_OK;
 }
 
@@ -733,6 +738,8 @@ UMC::Status mfx_UMC_FrameAllocator::Free(UMC::FrameMemID mid)
     if (sts < MFX_ERR_NONE)
         return UMC::UMC_ERR_FAILED;
 
+    MarkFreeSlot(index);
+
     if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
     {
         if (m_extSurfaces[index].FrameSurface)
@@ -787,8 +794,13 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
 
     if (m_externalFramesResponse && surf->Data.MemId)
     {
-        bool isFound = false;
-        for (mfxI32 i = 0; i < m_externalFramesResponse->NumFrameActual; i++)
+        // Surface is already known if it is in m_frameDataInternal, check it first to avoid response lookup.
+        // Frames added on the fly hold application MemId, frames from response hold MemId before MapIdx
+        bool isFound = m_pCore->IsSupportedDelayAlloc() &&
+            (m_midIndex.find(surf->Data.MemId) != std::end(m_midIndex) ||
+             m_mappedMidIndex.find(surf->Data.MemId) != std::end(m_mappedMidIndex));
+
+        for (mfxI32 i = 0; !isFound && i < m_externalFramesResponse->NumFrameActual; i++)
         {
             if (m_pCore->MapIdx(m_externalFramesResponse->mids[i]) == surf->Data.MemId)
             {
@@ -803,21 +815,13 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
         if (!isFound)
         {
             MFX_CHECK(m_pCore->IsSupportedDelayAlloc(), MFX_ERR_UNDEFINED_BEHAVIOR);
-            for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
-            {
-                auto& internal_surf = m_frameDataInternal.GetSurface(i);
-                if (internal_surf.Data.MemId == surf->Data.MemId)
-                {
-                    isFound = true;
-                    break;
-                }
-            }
         }
         // add the new APP surface on the fly
         if (m_pCore->IsSupportedDelayAlloc() && !isFound)
         {
             m_frameDataInternal.AddNewFrame(this, surf, &m_info);
-            m_extSurfaces.push_back(surf_descr(surf, false));
+            IndexInternalFrame(m_frameDataInternal.GetSize() - 1);
+            AddExtSurface(surf);
         }
     }
 
@@ -833,7 +837,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
             {
                 /* new surface */
                 m_curIndex = i;
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(m_curIndex, surf);
                 break;
             }
 
@@ -844,7 +848,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
             {
                 /* surfaces filled already */
                 m_curIndex = i;
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(m_curIndex, surf);
                 break;
             }
         }
@@ -859,7 +863,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
                 if (!m_extSurfaces[i].isUsed && (0 == m_frameDataInternal.GetSurface(i).Data.Locked))
                 {
                     m_curIndex = i;
-                    m_extSurfaces[m_curIndex].FrameSurface = surf;
+                    SetExtSurface(m_curIndex, surf);
                     break;
                 }
             }
@@ -872,7 +876,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
         if (m_curIndex != -1)
         {
             mfxFrameSurface1 &internalSurf = m_frameDataInternal.GetSurface(m_curIndex);
-            m_extSurfaces[m_curIndex].FrameSurface = surf;
+            SetExtSurface(m_curIndex, surf);
             if (internalSurf.Data.Locked) // surface was locked yet
             {
                 m_curIndex = -1;
@@ -885,7 +889,7 @@ mfxStatus mfx_UMC_FrameAllocator::SetCurrentMFXSurface(mfxFrameSurface1 *surf)
         {
             m_curIndex = AddSurface(surf);
             if (m_curIndex != -1)
-                m_extSurfaces[m_curIndex].FrameSurface = surf;
+                SetExtSurface(m_curIndex, surf);
         }
     }
 
@@ -903,20 +907,16 @@ mfxI32 mfx_UMC_FrameAllocator::AddSurface(mfxFrameSurface1 *surface)
 
     if (surface->Data.MemId && !m_isSWDecode)
     {
-        mfxU32 i;
-        for (i = 0; i < m_extSurfaces.size(); i++)
+        auto it = m_mappedMidIndex.find(surface->Data.MemId);
+        if (it != std::end(m_mappedMidIndex) && it->second < m_extSurfaces.size())
         {
-            if (surface->Data.MemId == m_pCore->MapIdx(m_frameDataInternal.GetSurface(i).Data.MemId))
-            {
-                m_extSurfaces[i].FrameSurface = surface;
-                index = i;
-                break;
-            }
+            SetExtSurface(it->second, surface);
+            index = (mfxI32)it->second;
         }
     }
     else
     {
-        m_extSurfaces.push_back(surf_descr(surface,false));
+        AddExtSurface(surface);
         index = (mfxI32)(m_extSurfaces.size() - 1);
     }
 
@@ -942,6 +942,7 @@ mfxI32 mfx_UMC_FrameAllocator::AddSurface(mfxFrameSurface1 *surface)
     if (m_IsUseExternalFrames && m_isSWDecode)
     {
         m_frameDataInternal.AddNewFrame(this, surface, &m_info);
+        IndexInternalFrame(m_frameDataInternal.GetSize() - 1);
     }
 
     return index;
@@ -958,22 +959,49 @@ mfxI32 mfx_UMC_FrameAllocator::FindSurface(mfxFrameSurface1 *surf)
 
     if (data->MemId && m_IsUseExternalFrames)
     {
-        mfxMemId sMemId;
-        for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
+        auto it = m_mappedMidIndex.find(data->MemId);
+        if (it != std::end(m_mappedMidIndex))
         {
-            mfxMemId memId = m_frameDataInternal.GetSurface(i).Data.MemId;
-            sMemId = m_pCore->MapIdx(memId);
-            if (sMemId == data->MemId)
+            return (mfxI32)it->second;
+        }
+    }
+
+    return FindExtSurface(surf);
+}
+
+mfxI32 mfx_UMC_FrameAllocator::FindFreeSurface()
+{
+    UMC::AutomaticUMCMutex guard(m_guard);
+
+    if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
+    {
+        return m_curIndex;
+    }
+
+    if (m_curIndex != -1)
+        return m_curIndex;
+
+    const mfxU32 size = m_frameDataInternal.GetSize();
+
+    for (mfxU32 word = 0; word < m_freeSlotHints.size(); word++)
+    {
+        for (mfxU64& bits = m_freeSlotHints[word]; bits; bits &= bits - 1)
+        {
+            mfxU32 i = word * 64 + __builtin_ctzll(bits);
+
+            if (i < size && !m_frameDataInternal.GetSurface(i).Data.Locked)
             {
                 return i;
             }
         }
     }
 
-    for (mfxU32 i = 0; i < m_extSurfaces.size(); i++)
+    // Hints are exhausted, but frame could be unlocked bypassing Free()
+    for (mfxU32 i = 0; i < size; i++)
     {
-        if (m_extSurfaces[i].FrameSurface == surf)
+        if (!m_frameDataInternal.GetSurface(i).Data.Locked)
         {
+            MarkFreeSlot(i);
             return i;
         }
     }
@@ -981,27 +1009,103 @@ mfxI32 mfx_UMC_FrameAllocator::FindSurface(mfxFrameSurface1 *surf)
     return -1;
 }
 
-mfxI32 mfx_UMC_FrameAllocator::FindFreeSurface()
+void mfx_UMC_FrameAllocator::RebuildIndexes()
 {
-    UMC::AutomaticUMCMutex guard(m_guard);
+    m_midIndex.clear();
+    m_mappedMidIndex.clear();
+    m_extSurfaceIndex.clear();
+    m_freeSlotHints.clear();
 
-    if ((m_IsUseExternalFrames) || (m_sfcVideoPostProcessing))
+    for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
     {
-        return m_curIndex;
+        IndexInternalFrame(i);
     }
 
-    if (m_curIndex != -1)
-        return m_curIndex;
+    for (mfxU32 i = 0; i < m_extSurfaces.size(); i++)
+    {
+        mfxFrameSurface1 *surf = m_extSurfaces[i].FrameSurface;
+        if (!surf)
+            continue;
 
-    for (mfxU32 i = 0; i < m_frameDataInternal.GetSize(); i++)
+        // Slots are visited in increasing order, so the first one is the lowest
+        auto it = m_extSurfaceIndex.emplace(surf, surf_slots{ i, 0 }).first;
+        it->second.count++;
+    }
+}
+
+void mfx_UMC_FrameAllocator::IndexInternalFrame(mfxU32 index)
+{
+    mfxMemId mid = m_frameDataInternal.GetSurface(index).Data.MemId;
+
+    if (mid)
     {
-        if (!m_frameDataInternal.GetSurface(i).Data.Locked)
+        // emplace doesn't overwrite, so the lowest index is kept for duplicated MemId
+        m_midIndex.emplace(mid, index);
+
+        // MapIdx correspondence is established at allocation and stays the same for frame lifetime
+        mfxMemId mapped_mid = m_pCore->MapIdx(mid);
+        if (mapped_mid)
+            m_mappedMidIndex.emplace(mapped_mid, index);
+    }
+
+    MarkFreeSlot(index);
+}
+
+void mfx_UMC_FrameAllocator::MarkFreeSlot(mfxU32 index)
+{
+    if (index / 64 >= m_freeSlotHints.size())
+        m_freeSlotHints.resize(index / 64 + 1, 0);
+
+    m_freeSlotHints[index / 64] |= mfxU64(1) << (index % 64);
+}
+
+void mfx_UMC_FrameAllocator::SetExtSurface(mfxU32 index, mfxFrameSurface1 *surf)
+{
+    mfxFrameSurface1 *prev = m_extSurfaces[index].FrameSurface;
+    if (prev == surf)
+        return;
+
+    m_extSurfaces[index].FrameSurface = surf;
+
+    if (prev)
+    {
+        auto it = m_extSurfaceIndex.find(prev);
+        assert(it != std::end(m_extSurfaceIndex));
+
+        if (!--it->second.count)
         {
-            return i;
+            m_extSurfaceIndex.erase(it);
+        }
+        else if (it->second.first == index)
+        {
+            // Rare case of surface held by several slots, look for the next one
+            mfxU32 i = index + 1;
+            while (m_extSurfaces[i].FrameSurface != prev)
+                i++;
+
+            it->second.first = i;
         }
     }
 
-    return -1;
+    if (surf)
+    {
+        auto it = m_extSurfaceIndex.emplace(surf, surf_slots{ index, 0 }).first;
+        it->second.first = std::min(it->second.first, index);
+        it->second.count++;
+    }
+}
+
+void mfx_UMC_FrameAllocator::AddExtSurface(mfxFrameSurface1 *surf)
+{
+    m_extSurfaces.push_back(surf_descr());
+    SetExtSurface(mfxU32(m_extSurfaces.size() - 1), surf);
+}
+
+mfxI32 mfx_UMC_FrameAllocator::FindExtSurface(mfxFrameSurface1 *surf) const
+{
+    auto it = m_extSurfaceIndex.find(surf);
+
+    return it != std::end(m_extSurfaceIndex) ? (mfxI32)it->second.first : -1;
 }
 
 bool mfx_UMC_FrameAllocator::HasFreeSurface()
@@ -1065,7 +1169,7 @@ mfxFrameSurface1 * mfx_UMC_FrameAllocator::GetSurface(UMC::FrameMemID index, mfx
         if (sts < MFX_ERR_NONE)
             return 0;
 
-        m_extSurfaces[index].FrameSurface = surface;
+        SetExtSurface(index, surface);
     }
 
     return surface;
@@ -1159,7 +1263,7 @@ mfxStatus mfx_UMC_FrameAllocator::PrepareToOutput(mfxFrameSurface1 *surface_work
             sts = temp_sts;
         }
 
-        m_extSurfaces[index].FrameSurface = 0;
+        SetExtSurface(index, 0);
     }
 
     return sts;
@@ -2370,7 +2474,7 @@ mfxStatus   mfx_UMC_FrameAllocator_D3D::PrepareToOutput(mfxFrameSurface1 *surfac
         if (!m_sfcVideoPostProcessing)
         {
             m_pCore->DecreaseReference(&surface_work->Data);
-            m_extSurfaces[index].FrameSurface = 0;
+            SetExtSurface(index, 0);
         }
     }
 
@@ -117,6 +117,8 @@ UMC::Status mfx_UMC_FrameAllocator_D3D_Converter::InitMfx(UMC::FrameAllocatorPar
             // set correct width & height to planes
             frameData.Init(&m_info, (UMC::FrameMemID)i, this);
         }
+
+        RebuildIndexes();
     }
 
     return UMC::UMC_OK;
@@ -267,7 +269,7 @@ mfxStatus mfx_UMC_FrameAllocator_D3D_Converter::CheckPreparingToOutput(mfxFrameS
         if (!m_IsUseExternalFrames)
         {
             m_pCore->DecreaseReference(&surface_work->Data);
-            m_extSurfaces[index].FrameSurface = 0;
+            SetExtSurface(index, 0);
         }
     }
     else
@@ -290,7 +292,7 @@ mfxStatus mfx_UMC_FrameAllocator_D3D_Converter::CheckPreparingToOutput(mfxFrameS
         if (!m_IsUseExternalFrames)
         {
             m_pCore->DecreaseReference(&surface_work->Data);
-            m_extSurfaces[indexTop].FrameSurface = 0;
+            SetExtSurface(indexTop, 0);
         }
     }
 
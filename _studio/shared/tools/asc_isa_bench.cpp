@@ -0,0 +1,270 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares the scene change detection kernels of the shared ASC and of the
+// adaptive encode ASC at every ISA level their dispatchers pick from, on the ASC
+// working layer (128x64) and on full frames.
+// Every result is checked bit-exact against the C path before it is timed.
+//
+//   asc_isa_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "asc_c_impl.h"
+#include "asc_sse4_impl.h"
+#include "asc_avx2_impl.h"
+#include "asc_avx512_impl.h"
+
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+#include "av1_asc_avx512_impl.h"
+
+// defined with the dispatcher in av1_asc.cpp
+namespace aenc {
+    void GainOffset_C(mfxU8** pSrc, mfxU8** pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff);
+    void RsCsCalc_4x4_C(mfxU8* pSrc, int srcPitch, int wblocks, int hblocks, mfxU16* pRs, mfxU16* pCs);
+    void RsCsCalc_4x4_SSE4(mfxU8* pSrc, int srcPitch, int wblocks, int hblocks, mfxU16* pRs, mfxU16* pCs);
+    void ImageDiffHistogram_C(mfxU8* pSrc, mfxU8* pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC);
+    void ImageDiffHistogram_SSE4(mfxU8* pSrc, mfxU8* pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC);
+    void ME_SAD_8x8_Block_Search_C(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU16 *bestSAD, int *bestX, int *bestY);
+    void ME_SAD_8x8_Block_Search_SSE4(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU16 *bestSAD, int *bestX, int *bestY);
+    mfxStatus Calc_RaCa_pic_C(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
+    mfxStatus Calc_RaCa_pic_SSE4(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
+}
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
+
+// same signatures in both ASC implementations
+typedef void(*t_RsCsCalc)(mfxU8* pSrc, int srcPitch, int wblocks, int hblocks, mfxU16* pRs, mfxU16* pCs);
+typedef void(*t_ImageDiffHistogram)(mfxU8* pSrc, mfxU8* pRef, mfxU32 pitch, mfxU32 width, mfxU32 height, mfxI32 histogram[5], mfxI64 *pSrcDC, mfxI64 *pRefDC);
+typedef void(*t_GainOffset)(mfxU8** pSrc, mfxU8** pDst, mfxU16 width, mfxU16 height, mfxU16 pitch, mfxI16 gainDiff);
+typedef void(*t_ME_SAD_8x8_Block_Search)(mfxU8 *pSrc, mfxU8 *pRef, int pitch, int xrange, int yrange, mfxU16 *bestSAD, int *bestX, int *bestY);
+typedef mfxStatus(*t_Calc_RaCa_pic)(mfxU8 *pPicY, mfxI32 width, mfxI32 height, mfxI32 pitch, mfxF64 &RsCs);
+
+struct Frame
+{
+    Frame(int width, int height)
+        : width(width)
+        , height(height)
+        , pitch((width + 63) & ~63)
+        , src(pitch * height + 64)
+        , ref(pitch * height + 64)
+        , dst(pitch * height + 64)
+        , rs((width / 4) * (height / 4))
+        , cs((width / 4) * (height / 4))
+    {}
+
+    int                width;
+    int                height;
+    int                pitch;
+    std::vector<mfxU8> src;
+    std::vector<mfxU8> ref;
+    std::vector<mfxU8> dst;
+    std::vector<mfxU16> rs;
+    std::vector<mfxU16> cs;
+};
+
+// when out is given a kernel leaves there what it computed, so that ISA levels
+// can be compared, timed runs pass nullptr and only call the kernel
+typedef void(*t_run)(Frame& frame, std::vector<mfxI64>* out);
+
+template <t_RsCsCalc RsCsCalc_4x4>
+static void RunRsCsCalc(Frame& f, std::vector<mfxI64>* out)
+{
+    RsCsCalc_4x4(f.src.data(), f.pitch, f.width / 4, f.height / 4, f.rs.data(), f.cs.data());
+
+    if (out)
+    {
+        out->assign(f.rs.begin(), f.rs.end());
+        out->insert(out->end(), f.cs.begin(), f.cs.end());
+    }
+}
+
+template <t_ImageDiffHistogram ImageDiffHistogram>
+static void RunImageDiffHistogram(Frame& f, std::vector<mfxI64>* out)
+{
+    mfxI32 histogram[5];
+    mfxI64 srcDC, refDC;
+
+    ImageDiffHistogram(f.src.data(), f.ref.data(), f.pitch, f.width, f.height, histogram, &srcDC, &refDC);
+
+    if (out)
+    {
+        out->assign(histogram, histogram + 5);
+        out->push_back(srcDC);
+        out->push_back(refDC);
+    }
+}
+
+template <t_GainOffset GainOffset>
+static void RunGainOffset(Frame& f, std::vector<mfxI64>* out)
+{
+    if (out)
+        out->clear();
+
+    // both directions of the correction, they saturate differently
+    for (mfxI16 gainDiff : { mfxI16(9), mfxI16(-9) })
+    {
+        mfxU8* ss = f.src.data();
+        mfxU8* dd = f.dst.data();
+        GainOffset(&ss, &dd, (mfxU16)f.width, (mfxU16)f.height, (mfxU16)f.pitch, gainDiff);
+
+        for (int i = 0; out && i < f.height; i++)
+            out->insert(out->end(), ss + i * f.pitch, ss + i * f.pitch + f.width);
+    }
+}
+
+template <t_ME_SAD_8x8_Block_Search ME_SAD_8x8_Block_Search>
+static void RunMESearch(Frame& f, std::vector<mfxI64>* out)
+{
+    if (out)
+        out->clear();
+
+    // +-8 window around every 8x8 block that has one, like ME_simple
+    for (int y = 8; y + 16 <= f.height; y += 8)
+    {
+        for (int x = 8; x + 16 <= f.width; x += 8)
+        {
+            mfxU16 bestSAD = 0xffff;
+            int bestX = 0, bestY = 0;
+            ME_SAD_8x8_Block_Search(&f.src[y * f.pitch + x], &f.ref[(y - 8) * f.pitch + x - 8], f.pitch, 16, 16, &bestSAD, &bestX, &bestY);
+
+            if (out)
+                out->insert(out->end(), { bestSAD, bestX, bestY });
+        }
+    }
+}
+
+template <t_Calc_RaCa_pic Calc_RaCa_pic>
+static void RunCalcRaCa(Frame& f, std::vector<mfxI64>* out)
+{
+    mfxF64 RsCs = 0;
+    Calc_RaCa_pic(f.src.data(), f.width, f.height, f.pitch, RsCs);
+
+    // bit-exact, not within a tolerance
+    if (out)
+    {
+        mfxI64 bits;
+        memcpy(&bits, &RsCs, sizeof(bits));
+        out->assign(1, bits);
+    }
+}
+
+enum { ISA_C, ISA_SSE4, ISA_AVX2, ISA_AVX512, ISA_NUM };
+
+static const char* const isaName[ISA_NUM] = { "C", "SSE4", "AVX2", "AVX-512BW" };
+
+struct Kernel
+{
+    const char* name;
+    t_run       run[ISA_NUM]; // nullptr where the dispatcher has no kernel for a level
+};
+
+int main(int argc, char** argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 100;
+
+    const bool available[ISA_NUM] =
+    {
+        true,
+        !!__builtin_cpu_supports("sse4.1"),
+        !!__builtin_cpu_supports("avx2"),
+        __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"),
+    };
+
+    const Kernel kernels[] =
+    {
+        { "RsCsCalc_4x4",            { RunRsCsCalc<RsCsCalc_4x4_C>, RunRsCsCalc<RsCsCalc_4x4_SSE4>, nullptr, RunRsCsCalc<RsCsCalc_4x4_AVX512> } },
+        { "ImageDiffHistogram",      { RunImageDiffHistogram<ImageDiffHistogram_C>, RunImageDiffHistogram<ImageDiffHistogram_SSE4>, nullptr, RunImageDiffHistogram<ImageDiffHistogram_AVX512> } },
+        { "GainOffset",              { RunGainOffset<GainOffset_C>, nullptr, nullptr, RunGainOffset<GainOffset_AVX512> } },
+        { "ME_SAD_8x8_Block_Search", { RunMESearch<ME_SAD_8x8_Block_Search_C>, RunMESearch<ME_SAD_8x8_Block_Search_SSE4>, RunMESearch<ME_SAD_8x8_Block_Search_AVX2>, RunMESearch<ME_SAD_8x8_Block_Search_AVX512> } },
+        { "Calc_RaCa_pic",           { RunCalcRaCa<Calc_RaCa_pic_C>, RunCalcRaCa<Calc_RaCa_pic_SSE4>, nullptr, RunCalcRaCa<Calc_RaCa_pic_AVX512> } },
+#if defined(MFX_ENABLE_ADAPTIVE_ENCODE)
+        { "aenc::GainOffset",              { RunGainOffset<aenc::GainOffset_C>, nullptr, nullptr, RunGainOffset<aenc::GainOffset_AVX512> } },
+        { "aenc::RsCsCalc_4x4",            { RunRsCsCalc<aenc::RsCsCalc_4x4_C>, RunRsCsCalc<aenc::RsCsCalc_4x4_SSE4>, nullptr, RunRsCsCalc<aenc::RsCsCalc_4x4_AVX512> } },
+        { "aenc::ImageDiffHistogram",      { RunImageDiffHistogram<aenc::ImageDiffHistogram_C>, RunImageDiffHistogram<aenc::ImageDiffHistogram_SSE4>, nullptr, RunImageDiffHistogram<aenc::ImageDiffHistogram_AVX512> } },
+        { "aenc::ME_SAD_8x8_Block_Search", { RunMESearch<aenc::ME_SAD_8x8_Block_Search_C>, RunMESearch<aenc::ME_SAD_8x8_Block_Search_SSE4>, nullptr, RunMESearch<aenc::ME_SAD_8x8_Block_Search_AVX512> } },
+        { "aenc::Calc_RaCa_pic",           { RunCalcRaCa<aenc::Calc_RaCa_pic_C>, RunCalcRaCa<aenc::Calc_RaCa_pic_SSE4>, nullptr, RunCalcRaCa<aenc::Calc_RaCa_pic_AVX512> } },
+#endif // MFX_ENABLE_ADAPTIVE_ENCODE
+    };
+
+    // ASC works on a downscaled layer, Calc_RaCa_pic gets full frames
+    const struct { int width, height; } sizes[] = { { ASC_SMALL_WIDTH, ASC_SMALL_HEIGHT }, { 1920, 1080 }, { 3840, 2160 } };
+
+    int mismatches = 0;
+
+    printf("%-10s %-32s %-10s %12s %8s\n", "size", "kernel", "isa", "us/call", "vs C");
+
+    for (auto& size : sizes)
+    {
+        Frame frame(size.width, size.height);
+
+        // reference is the source moved by a few pixels with some noise,
+        // so that the search and the histogram have something to find
+        srand(size.width);
+        for (size_t i = 0; i < frame.src.size(); i++)
+            frame.src[i] = (mfxU8)rand();
+        for (size_t i = 0; i < frame.ref.size(); i++)
+        {
+            size_t moved = i + 3 * frame.pitch + 5;
+            frame.ref[i] = (mfxU8)((moved < frame.src.size() ? frame.src[moved] : 0) + rand() % 5 - 2);
+        }
+
+        char sizeName[32];
+        snprintf(sizeName, sizeof(sizeName), "%dx%d", size.width, size.height);
+
+        for (auto& kernel : kernels)
+        {
+            std::vector<mfxI64> reference, result;
+            kernel.run[ISA_C](frame, &reference);
+
+            double timeC = 0;
+
+            for (int isa = 0; isa < ISA_NUM; isa++)
+            {
+                if (!kernel.run[isa] || !available[isa])
+                    continue;
+
+                kernel.run[isa](frame, &result);
+                if (result != reference)
+                {
+                    printf("%s %s: mismatch against C at %s\n", kernel.name, isaName[isa], sizeName);
+                    mismatches++;
+                    continue;
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < iterations; i++)
+                    kernel.run[isa](frame, nullptr);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                const double time = elapsed.count() / iterations;
+                if (isa == ISA_C)
+                    timeC = time;
+
+                printf("%-10s %-32s %-10s %12.2f %7.2fx\n", sizeName, kernel.name, isaName[isa], time * 1e6, timeC / time);
+            }
+        }
+    }
+
+    return mismatches ? 1 : 0;
+}
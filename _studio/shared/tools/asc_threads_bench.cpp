@@ -0,0 +1,157 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Times ASC scene change analysis per frame at 720p, 1080p and 2160p with 1, 2, 4
+// and 8 threads analysing one frame. The number of threads is set with ASC::SetNumThreads,
+// VPL_ASC_THREADS is read in debug builds only.
+// Every thread count is checked to give the same per-frame decisions as 1 thread
+// before it is timed. The clip pans over a texture and cuts to another one every
+// 30 frames.
+//
+//   asc_threads_bench [frames]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "mfxstructures.h"
+
+#include "asc.h"
+
+using namespace ns_asc;
+
+static const int panFrames = 30;
+static const int panStep = 2;
+
+struct Decision
+{
+    mfxU32 shot;
+    mfxI32 spatial;
+    mfxI32 temporal;
+    mfxU32 pdist;
+    bool   ltr;
+
+    bool operator==(const Decision& other) const
+    {
+        return shot == other.shot && spatial == other.spatial && temporal == other.temporal &&
+            pdist == other.pdist && ltr == other.ltr;
+    }
+};
+
+// luma canvas larger than the frame, frames are windows moving over it
+struct Scene
+{
+    Scene(int width, int height, int seed)
+        : pitch(width + panFrames * panStep)
+        , luma(size_t(pitch) * (height + panFrames * panStep))
+    {
+        srand(seed);
+        const int period = 17 + seed * 6;
+        for (size_t i = 0; i < luma.size(); i++)
+        {
+            const int x = int(i % pitch), y = int(i / pitch);
+            const int block = 16 << seed;
+            luma[i] = mfxU8(seed * 48 + (x * seed + y * (seed + 3)) % period * 64 / period + (x / block + y / block) % 2 * 96 + rand() % 16);
+        }
+    }
+
+    mfxU8* frame(int index) { return &luma[size_t(index % panFrames) * panStep * (pitch + 1)]; }
+
+    int                pitch;
+    std::vector<mfxU8> luma;
+};
+
+// analyses frames with the number of threads, returns seconds spent
+static double Analyse(int width, int height, std::vector<Scene>& scenes, int threads, int frames, std::vector<Decision>& decisions)
+{
+    ASC asc;
+    if (asc.Init(width, height, scenes[0].pitch, MFX_PICSTRUCT_PROGRESSIVE, false) != MFX_ERR_NONE ||
+        asc.SetNumThreads(threads) != MFX_ERR_NONE)
+    {
+        printf("ASC Init failed at %dx%d\n", width, height);
+        return -1;
+    }
+
+    decisions.clear();
+    std::chrono::duration<double> elapsed(0);
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        Scene& scene = scenes[frame / panFrames % scenes.size()];
+
+        auto start = std::chrono::steady_clock::now();
+        asc.PutFrameProgressive(scene.frame(frame), scene.pitch);
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        decisions.push_back({ asc.Get_frame_shot_Decision(), asc.Get_frame_Spatial_complexity(),
+            asc.Get_frame_Temporal_complexity(), asc.Get_PDist_advice(), asc.Get_LTR_advice() });
+    }
+
+    asc.Close();
+
+    return elapsed.count();
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 120;
+
+    const struct { int width, height; } sizes[] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    printf("%-10s %8s %12s %13s %8s\n", "size", "threads", "per frame", "frame rate", "cuts");
+
+    int failures = 0;
+
+    for (auto& size : sizes)
+    {
+        std::vector<Scene> scenes = { Scene(size.width, size.height, 1), Scene(size.width, size.height, 2) };
+
+        std::vector<Decision> reference, decisions;
+        Analyse(size.width, size.height, scenes, 1, frames, reference);
+
+        int cuts = 0;
+        for (auto& decision : reference)
+            cuts += decision.shot ? 1 : 0;
+
+        for (int threads : { 1, 2, 4, 8 })
+        {
+            const double seconds = Analyse(size.width, size.height, scenes, threads, frames, decisions);
+            if (seconds < 0)
+                return 1;
+
+            if (decisions != reference)
+            {
+                printf("%d threads: mismatch against 1 thread at %dx%d\n", threads, size.width, size.height);
+                failures++;
+                continue;
+            }
+
+            char sizeName[32];
+            snprintf(sizeName, sizeof(sizeName), "%dx%d", size.width, size.height);
+            printf("%-10s %8d %9.3f ms %9.1f fps %8d\n", sizeName, threads, seconds * 1e3 / frames, frames / seconds, cuts);
+        }
+    }
+
+    return failures ? 1 : 0;
+}
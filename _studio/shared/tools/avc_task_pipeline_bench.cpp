@@ -0,0 +1,251 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Moves DdiTasks of the AVC encoder through its host-side stages, from free through
+// reordering, lookahead and encoding back to free, at lookahead depths up to 100.
+// Runs the pipeline on std::list<DdiTask> stages with list walks for the lookahead
+// lookups, as ImplementationAvc did, and on DdiTaskPool/DdiTaskQueue with the frame
+// order index. Both have to give the same encoding order, references and lookahead
+// windows before they are timed. No driver calls, only the task bookkeeping.
+//
+//   avc_task_pipeline_bench [frames]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+#include "mfx_h264_encode_hw_utils.h"
+
+using namespace MfxHwH264Encode;
+
+static const mfxU32 gopRefDist = 4;
+static const mfxU32 asyncDepth = 4;
+
+// stages of ImplementationAvc a task goes through when lookahead is on
+template <class Queue>
+struct Stages
+{
+    template <class... Args>
+    explicit Stages(Args&... args)
+        : m_free(args...), m_incoming(args...), m_reordering(args...), m_lookaheadStarted(args...)
+        , m_lookaheadFinished(args...), m_histRun(args...), m_histWait(args...), m_encoding(args...)
+    {}
+
+    Queue m_free;
+    Queue m_incoming;
+    Queue m_reordering;
+    Queue m_lookaheadStarted;
+    Queue m_lookaheadFinished;
+    Queue m_histRun;
+    Queue m_histWait;
+    Queue m_encoding;
+};
+
+// ImplementationAvc before DdiTaskPool, tasks in std::list and lookups walking the lists
+struct ListPipeline : Stages<std::list<DdiTask>>
+{
+    typedef std::list<DdiTask>::iterator Iter;
+
+    explicit ListPipeline(mfxU32 numTasks) { m_free.resize(numTasks); }
+
+    void OnLookaheadSubmitted(Iter task) { m_lookaheadStarted.splice(m_lookaheadStarted.end(), m_reordering, task); }
+    void OnEncodingSubmitted(Iter task)  { m_encoding.splice(m_encoding.end(), m_lookaheadFinished, task); }
+
+    DdiTask* FindRef(mfxU32 frameOrder)
+    {
+        return find_if_ptr4(m_lookaheadFinished, m_lookaheadStarted, m_histRun, m_histWait, FindByFrameOrder(frameOrder));
+    }
+
+    Iter LookaheadWindow(DdiTask const& task, mfxU32 laDepth, mfxU32& numLaFrames)
+    {
+        Iter j = m_lookaheadFinished.begin();
+        numLaFrames = (mfxU32)m_lookaheadFinished.size();
+        while (j->m_encOrder != task.m_encOrder)
+            ++j, --numLaFrames;
+
+        numLaFrames = std::min<mfxU32>(laDepth, numLaFrames);
+        return j;
+    }
+
+    mfxU32 CountRefInReordering()
+    {
+        return (mfxU32)std::count_if(m_reordering.begin(), m_reordering.end(), [](DdiTask task_item) { return task_item.m_type[0] & MFX_FRAMETYPE_REF; });
+    }
+};
+
+// queues keep a pointer to the pool, so it is constructed before them
+struct TaskPool
+{
+    DdiTaskPool m_tasks;
+};
+
+// ImplementationAvc with DdiTaskPool, tasks in a fixed arena and lookups through the frame order index
+struct PoolPipeline : TaskPool, Stages<DdiTaskQueue>
+{
+    typedef DdiTaskIter Iter;
+
+    explicit PoolPipeline(mfxU32 numTasks) : Stages<DdiTaskQueue>(m_tasks) { m_tasks.Init(numTasks, m_free); }
+
+    void OnLookaheadSubmitted(Iter task)
+    {
+        m_lookaheadStarted.splice(m_lookaheadStarted.end(), m_reordering, task);
+        m_tasks.AddToIndex(*task);
+    }
+
+    void OnEncodingSubmitted(Iter task)
+    {
+        m_tasks.RemoveFromIndex(*task);
+        m_encoding.splice(m_encoding.end(), m_lookaheadFinished, task);
+    }
+
+    DdiTask* FindRef(mfxU32 frameOrder)
+    {
+        return m_tasks.FindByFrameOrder(frameOrder, { &m_lookaheadFinished, &m_lookaheadStarted, &m_histRun, &m_histWait });
+    }
+
+    Iter LookaheadWindow(DdiTask const& task, mfxU32 laDepth, mfxU32& numLaFrames)
+    {
+        Iter j = m_lookaheadFinished.iterator_to(task);
+        numLaFrames = 0;
+        for (Iter i = j; i != m_lookaheadFinished.end() && numLaFrames < laDepth; ++i)
+            numLaFrames++;
+        return j;
+    }
+
+    mfxU32 CountRefInReordering()
+    {
+        return (mfxU32)std::count_if(m_reordering.begin(), m_reordering.end(), [](DdiTask const& task_item) { return task_item.m_type[0] & MFX_FRAMETYPE_REF; });
+    }
+};
+
+static void Hash(mfxU64& hash, mfxU64 value)
+{
+    hash = (hash ^ value) * 0x100000001b3ull;
+}
+
+// submits frames and drains the pipeline, returns seconds spent and a hash of every decision
+template <class Pipeline>
+static double Run(mfxU32 laDepth, mfxU32 frames, mfxU64& hash)
+{
+    // enough tasks for every stage to be full, like GetTotalGreediness() + AsyncDepth
+    const mfxU32 numTasks = gopRefDist + laDepth + asyncDepth + 4;
+    Pipeline p(numTasks);
+
+    std::vector<VmeData*> vmeData;
+    mfxU32 encOrder = 0, lastAnchor = 0;
+    hash = 0xcbf29ce484222325ull;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (mfxU32 frameOrder = 0; frameOrder < frames || p.m_free.size() != numTasks; frameOrder++)
+    {
+        const bool flush = frameOrder >= frames;
+
+        if (!flush)
+        {
+            // anchors are P frames referenced by B frames in between
+            DdiTask& task = p.m_free.front();
+            task.m_frameOrder = frameOrder;
+            task.m_type[0] = task.m_type[1] = frameOrder % gopRefDist ? mfxU8(MFX_FRAMETYPE_B) : mfxU8(MFX_FRAMETYPE_P | MFX_FRAMETYPE_REF);
+            p.m_incoming.splice(p.m_incoming.end(), p.m_free, p.m_free.begin());
+            p.m_reordering.splice(p.m_reordering.end(), p.m_incoming, p.m_incoming.begin());
+        }
+
+        // B frames go after the anchor following them, the walk stops at the first anchor
+        if (!p.m_reordering.empty() && (flush || p.m_reordering.size() >= gopRefDist))
+        {
+            typename Pipeline::Iter task = p.m_reordering.begin();
+            while (task != p.m_reordering.end() && (task->m_type[0] & MFX_FRAMETYPE_B) && task->m_frameOrder > lastAnchor)
+                ++task;
+            if (task == p.m_reordering.end())
+                task = p.m_reordering.begin();
+            if (!(task->m_type[0] & MFX_FRAMETYPE_B))
+                lastAnchor = task->m_frameOrder;
+
+            task->m_encOrder = encOrder++;
+
+            // B frames refer to anchors around them, anchors to the previous one
+            const bool   isB    = !!(task->m_type[0] & MFX_FRAMETYPE_B);
+            const mfxU32 anchor = task->m_frameOrder / gopRefDist * gopRefDist;
+            DdiTask* fwd = isB ? p.FindRef(anchor) : (anchor ? p.FindRef(anchor - gopRefDist) : 0);
+            DdiTask* bwd = isB ? p.FindRef(anchor + gopRefDist) : 0;
+
+            Hash(hash, task->m_frameOrder);
+            Hash(hash, fwd ? fwd->m_encOrder : ~0u);
+            Hash(hash, bwd ? bwd->m_encOrder : ~0u);
+            Hash(hash, p.CountRefInReordering());
+
+            p.OnLookaheadSubmitted(task);
+            p.m_lookaheadFinished.splice(p.m_lookaheadFinished.end(), p.m_lookaheadStarted, p.m_lookaheadStarted.begin());
+        }
+
+        if (!p.m_lookaheadFinished.empty() && (flush || p.m_lookaheadFinished.size() > laDepth))
+        {
+            DdiTask& task = p.m_lookaheadFinished.front();
+
+            // BrcPreEnc takes VME data of the task and frames following it
+            mfxU32 numLaFrames = 0;
+            typename Pipeline::Iter j = p.LookaheadWindow(task, std::max<mfxU32>(laDepth, 1), numLaFrames);
+            vmeData.resize(numLaFrames);
+            for (size_t i = 0; i < vmeData.size(); ++i, ++j)
+            {
+                vmeData[i] = j->m_vmeData;
+                Hash(hash, j->m_frameOrder);
+            }
+
+            p.OnEncodingSubmitted(p.m_lookaheadFinished.begin());
+        }
+
+        if (!p.m_encoding.empty() && (flush || p.m_encoding.size() > asyncDepth))
+            p.m_free.splice(p.m_free.end(), p.m_encoding, p.m_encoding.begin());
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+int main(int argc, char** argv)
+{
+    const mfxU32 frames = argc > 1 ? atoi(argv[1]) : 20000;
+
+    printf("sizeof(DdiTask) %zu bytes, GopRefDist %u, AsyncDepth %u\n", sizeof(DdiTask), gopRefDist, asyncDepth);
+    printf("%-8s %14s %14s %9s\n", "LA depth", "std::list", "DdiTaskPool", "speedup");
+
+    for (mfxU32 laDepth : { 1, 10, 20, 40, 60, 100 })
+    {
+        mfxU64 listHash = 0, poolHash = 0;
+        const double listSeconds = Run<ListPipeline>(laDepth, frames, listHash);
+        const double poolSeconds = Run<PoolPipeline>(laDepth, frames, poolHash);
+
+        if (listHash != poolHash)
+        {
+            printf("LA depth %u: DdiTaskPool pipeline mismatch against std::list\n", laDepth);
+            return 1;
+        }
+
+        printf("%-8u %11.3f us %11.3f us %8.2fx\n", laDepth, listSeconds * 1e6 / frames, poolSeconds * 1e6 / frames, listSeconds / poolSeconds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Runs 1 to 32 sessions, each a thread copying its own NV12 frames from video-like
+// (64-byte pitch) to system memory, and reports aggregate GB/s. Copies go through
+// FastCopy::Copy, which counts in-flight copies per NUMA node and streams when they
+// overlap, and through the former process-wide mutex around the cached row copy.
+// Every destination is checked against its source after the run.
+//
+//   fast_copy_sessions_bench [frames per session] [width] [height]
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "fast_copy.h"
+
+struct Session
+{
+    Session(int width, int height)
+        : pitch((width + 63) & ~63)
+        , roi({ width, height * 3 / 2 })
+        , src(size_t(pitch) * roi.height + 64)
+        , dst(size_t(width) * roi.height)
+    {
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = mfxU8(rand());
+    }
+
+    mfxU8* video() { return (mfxU8*)(((size_t)src.data() + 63) & ~(size_t)63); }
+
+    bool Check()
+    {
+        for (int h = 0; h < roi.height; h++)
+        {
+            if (memcmp(video() + size_t(h) * pitch, &dst[size_t(h) * roi.width], roi.width))
+                return false;
+        }
+        return true;
+    }
+
+    int                pitch;
+    IppiSize           roi;
+    std::vector<mfxU8> src;
+    std::vector<mfxU8> dst;
+    mfxU32             node = 0;
+};
+
+// FastCopy::Copy before per-node contexts, every copy in the process behind one lock
+static mfxStatus CopyWithGlobalMutex(mfxU8* pDst, mfxU32 dstPitch, mfxU8* pSrc, mfxU32 srcPitch, IppiSize roi, int flag)
+{
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> guard(mutex);
+
+    mfxCopyRect<mfxU8>(pSrc, srcPitch, pDst, dstPitch, roi, flag);
+
+    return MFX_ERR_NONE;
+}
+
+typedef mfxStatus(*t_copy)(mfxU8* pDst, mfxU32 dstPitch, mfxU8* pSrc, mfxU32 srcPitch, IppiSize roi, int flag);
+
+// runs sessions at once, returns aggregate GB/s or -1 on a mismatch
+static double Run(std::vector<Session>& sessions, t_copy copy, int frames)
+{
+    std::atomic<bool> go(false);
+    std::vector<std::thread> threads;
+
+    for (auto& session : sessions)
+    {
+        memset(session.dst.data(), 0, session.dst.size());
+
+        threads.emplace_back([&]()
+        {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            for (int i = 0; i < frames; i++)
+                copy(session.dst.data(), session.roi.width, session.video(), session.pitch, session.roi, COPY_VIDEO_TO_SYS);
+
+            session.node = FastCopyContext::Get().GetNode();
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    for (auto& session : sessions)
+    {
+        if (!session.Check())
+            return -1;
+    }
+
+    return double(sessions[0].dst.size()) * frames * sessions.size() / elapsed.count() / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 60;
+    const int width  = argc > 2 ? atoi(argv[2]) : 1920;
+    const int height = argc > 3 ? atoi(argv[3]) : 1080;
+
+    printf("%u hardware threads, %dx%d NV12, %d frames per session\n", std::thread::hardware_concurrency(), width, height, frames);
+    printf("%-9s %14s %14s %6s\n", "sessions", "global mutex", "FastCopy", "nodes");
+
+    for (int numSessions : { 1, 2, 4, 8, 16, 32 })
+    {
+        srand(numSessions);
+        std::vector<Session> sessions(numSessions, Session(width, height));
+
+        const double mutexGbps = Run(sessions, CopyWithGlobalMutex, frames);
+        const double fastGbps  = Run(sessions, FastCopy::Copy, frames);
+
+        if (mutexGbps < 0 || fastGbps < 0)
+        {
+            printf("%d sessions: mismatch against source\n", numSessions);
+            return 1;
+        }
+
+        std::set<mfxU32> nodes;
+        for (auto& session : sessions)
+            nodes.insert(session.node);
+
+        printf("%-9d %9.2f GB/s %9.2f GB/s %6zu\n", numSessions, mutexGbps, fastGbps, nodes.size());
+    }
+
+    return 0;
+}
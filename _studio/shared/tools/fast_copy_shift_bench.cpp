@@ -0,0 +1,159 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares the 10/12-bit shift-copy kernels on P010 luma planes: C and SSE4 row
+// kernels called once per row against AVX2 and AVX-512BW rect kernels.
+// Every result is checked against the C path before it is timed.
+//
+//   fast_copy_shift_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "fast_copy_c_impl.h"
+#include "fast_copy_sse4_impl.h"
+#include "fast_copy_avx2_impl.h"
+#include "fast_copy_avx512_impl.h"
+
+typedef void(*t_copyShiftRow)(const mfxU16* src, mfxU16* dst, int width, int shift);
+typedef void(*t_copyShiftRect)(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift);
+
+template <t_copyShiftRow copyRow>
+static void copyRows(const mfxU16* src, int srcPitch, mfxU16* dst, int dstPitch, IppiSize roi, int shift)
+{
+    for (int h = 0; h < roi.height; h++)
+    {
+        copyRow(src, dst, roi.width, shift);
+        src = (const mfxU16 *)((const mfxU8*)src + srcPitch);
+        dst = (mfxU16 *)((mfxU8*)dst + dstPitch);
+    }
+}
+
+struct Kernel
+{
+    const char*     name;
+    t_copyShiftRect toSys;
+    t_copyShiftRect toVideo;
+    bool            available;
+};
+
+struct Plane
+{
+    Plane(int width, int height, int pitch)
+        : pitch(pitch)
+        , roi({ width, height })
+        , mem(pitch * height + 64)
+    {}
+
+    // pitch is in bytes, data is 64-byte aligned like video memory
+    mfxU16* data() { return (mfxU16*)(((size_t)mem.data() + 63) & ~(size_t)63); }
+
+    int                pitch;
+    IppiSize           roi;
+    std::vector<mfxU8> mem;
+};
+
+static bool Equal(Plane& a, Plane& b)
+{
+    for (int h = 0; h < a.roi.height; h++)
+    {
+        if (memcmp((mfxU8*)a.data() + h * a.pitch, (mfxU8*)b.data() + h * b.pitch, a.roi.width * sizeof(mfxU16)))
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 50;
+
+    const Kernel kernels[] =
+    {
+        { "C",         copyRows<copyVideoToSysShift_C>,    copyRows<copySysToVideoShift_C>,    true },
+        { "SSE4",      copyRows<copyVideoToSysShift_SSE4>, copyRows<copySysToVideoShift_SSE4>, !!__builtin_cpu_supports("sse4.1") },
+        { "AVX2",      copyVideoToSysShiftRect_AVX2,       copySysToVideoShiftRect_AVX2,       !!__builtin_cpu_supports("avx2") },
+        { "AVX-512BW", copyVideoToSysShiftRect_AVX512,     copySysToVideoShiftRect_AVX512,     __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") },
+    };
+
+    const struct { int width, height; } sizes[] = { { 1920, 1080 }, { 3840, 2160 }, { 7680, 4320 } };
+
+    printf("%-10s %-12s %12s %12s\n", "size", "kernel", "video->sys", "sys->video");
+
+    for (auto& size : sizes)
+    {
+        // video surfaces have pitch aligned to 64, system ones are packed
+        const int videoPitch = (size.width * sizeof(mfxU16) + 63) & ~63;
+        const int sysPitch   = size.width * sizeof(mfxU16);
+
+        Plane video(size.width, size.height, videoPitch), sys(size.width, size.height, sysPitch);
+        Plane refSys(size.width, size.height, sysPitch), refVideo(size.width, size.height, videoPitch);
+
+        srand(size.width);
+        for (size_t i = 0; i < video.mem.size(); i++)
+            video.mem[i] = (mfxU8)rand();
+        for (size_t i = 0; i < sys.mem.size(); i++)
+            sys.mem[i] = (mfxU8)rand() & 0x3;
+
+        kernels[0].toSys(video.data(), video.pitch, refSys.data(), refSys.pitch, video.roi, 6);
+        kernels[0].toVideo(sys.data(), sys.pitch, refVideo.data(), refVideo.pitch, sys.roi, 6);
+
+        const double bytes = 2.0 * size.width * size.height * sizeof(mfxU16);
+
+        for (auto& kernel : kernels)
+        {
+            if (!kernel.available)
+                continue;
+
+            Plane outSys(size.width, size.height, sysPitch), outVideo(size.width, size.height, videoPitch);
+            double gbps[2] = {};
+
+            for (int dir = 0; dir < 2; dir++)
+            {
+                Plane& src = dir ? sys : video;
+                Plane& dst = dir ? outVideo : outSys;
+                t_copyShiftRect copy = dir ? kernel.toVideo : kernel.toSys;
+
+                copy(src.data(), src.pitch, dst.data(), dst.pitch, src.roi, 6);
+                if (!Equal(dst, dir ? refVideo : refSys))
+                {
+                    printf("%s %s: mismatch against C at %dx%d\n", kernel.name, dir ? "sys->video" : "video->sys", size.width, size.height);
+                    gbps[dir] = -1;
+                    continue;
+                }
+
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < iterations; i++)
+                    copy(src.data(), src.pitch, dst.data(), dst.pitch, src.roi, 6);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                gbps[dir] = bytes * iterations / elapsed.count() / 1e9;
+            }
+
+            char sizeName[32];
+            snprintf(sizeName, sizeof(sizeName), "%dx%d", size.width, size.height);
+            printf("%-10s %-12s %9.2f GB/s %9.2f GB/s\n", sizeName, kernel.name, gbps[0], gbps[1]);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Times the perceptual prefilter per frame at 720p, 1080p and 2160p with the
+// 8-bit AVX2 and AVX-512BW kernels and the P010 kernels, splitting every frame
+// in 1, 2, 4 and 8 stripes on mfx::StripeWorkers like PercEncFilter does.
+// Every stripe count is checked against the whole frame output before it is timed.
+//
+//   perc_enc_prefilter_bench [frames]
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "mfx_perc_enc_vpp_avx2.h"
+#include "mfx_stripe_workers.h"
+
+using namespace PercEncPrefilter;
+
+struct Kernel
+{
+    const char* name;
+    bool        p010;
+    bool        avx2;
+    bool        available;
+};
+
+// kernels read a few samples left and right of the line, planes keep a margin around them
+template <typename T>
+struct Plane
+{
+    static constexpr int margin = 32;
+
+    Plane(int width, int height)
+        : stride(width + 2 * margin)
+        , samples(size_t(stride) * (height + 2))
+    {}
+
+    T* data() { return &samples[stride + margin]; }
+
+    int            stride;
+    std::vector<T> samples;
+};
+
+// VPP parameters of PercEncFilter
+static void SetParameters(Parameters::PerFrame& parametersFrame, std::array<Parameters::PerBlock, 2>& parametersBlock)
+{
+    parametersFrame.spatialSlope = 2;
+    parametersFrame.temporalSlope = 5;
+    parametersFrame.qpAdaptive = false;
+
+    parametersBlock[0].spatial = { 0.005909118892594739f, -0.02285621848581362f, 0.041140246241535394f };
+    parametersBlock[1].spatial = { 0.008541855174858726f, -0.04005541977955759f, 0.f };
+    parametersBlock[0].temporal = { 0.f, 0.f, 0.f };
+    parametersBlock[1].temporal = { 0.f, 0.f, 0.f };
+}
+
+// filters frames of a moving pattern, returns seconds spent and output of the last frame
+template <typename T>
+static double FilterFrames(int width, int height, const Kernel& kernel, int maxStripes, int frames, std::vector<T>& last)
+{
+    Parameters::PerFrame parametersFrame;
+    std::array<Parameters::PerBlock, 2> parametersBlock;
+    SetParameters(parametersFrame, parametersBlock);
+
+    // same split as PercEncFilter::Init
+    const int stripeHeight = ((height + maxStripes - 1) / maxStripes + 15) / 16 * 16;
+    const int numStripes   = (height + stripeHeight - 1) / stripeHeight;
+
+    Filter filter(parametersFrame, parametersBlock, width, numStripes);
+    if (kernel.avx2)
+    {
+        filter.calculateCoefficientsImpl = Filter::calculateCoefficientsAvx2;
+        filter.filterLineImpl            = Filter::filterLineAvx2;
+    }
+
+    mfx::StripeWorkers workers;
+    workers.Start(numStripes - 1);
+
+    const int shift = kernel.p010 ? 6 : 0;
+    const int bitDepth = kernel.p010 ? 10 : 8;
+    const Filter::SampleFormat format = { bitDepth, shift };
+
+    srand(width);
+    const int modulationStride = (width + 15) / 16;
+    std::vector<uint8_t> modulation(size_t(modulationStride) * ((height + 15) / 16));
+    for (auto& m : modulation)
+        m = uint8_t(rand());
+
+    Plane<T> input(width, height), output(width, height);
+    std::vector<T> previousOutput(size_t(width) * height);
+
+    std::chrono::duration<double> elapsed(0);
+
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int y = -1; y <= height; y++)
+            for (int x = -Plane<T>::margin; x < width + Plane<T>::margin; x++)
+                input.data()[y * input.stride + x] = T((((x + 3 * frame) * 7 + y * 5 + rand() % 9) & ((1 << bitDepth) - 1)) << shift);
+
+        auto start = std::chrono::steady_clock::now();
+
+        workers.Run(numStripes, [&](mfxU32 stripe)
+        {
+            const int yBegin = int(stripe) * stripeHeight;
+            const int yEnd = std::min(yBegin + stripeHeight, height);
+
+            if (sizeof(T) == 1)
+                filter.processStripe((const uint8_t*)input.data(), input.stride, modulation.data(), modulationStride,
+                                     (const uint8_t*)previousOutput.data(), width, (uint8_t*)output.data(), output.stride,
+                                     width, height, MAX_QP, int(stripe), yBegin, yEnd);
+            else
+                filter.processStripe((const uint16_t*)input.data(), input.stride, modulation.data(), modulationStride,
+                                     (const uint16_t*)previousOutput.data(), width, (uint16_t*)output.data(), output.stride,
+                                     width, height, MAX_QP, int(stripe), yBegin, yEnd, format);
+
+            for (int y = yBegin; y < yEnd; y++)
+                std::copy(&output.data()[y * output.stride], &output.data()[y * output.stride + width], &previousOutput[size_t(y) * width]);
+        });
+
+        filter.finishFrame();
+
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    last = previousOutput;
+
+    return elapsed.count();
+}
+
+template <typename T>
+static void Bench(int width, int height, const Kernel& kernel, int frames)
+{
+    std::vector<T> reference;
+    FilterFrames<T>(width, height, kernel, 1, 2, reference);
+
+    for (int stripes : { 1, 2, 4, 8 })
+    {
+        std::vector<T> out;
+        FilterFrames<T>(width, height, kernel, stripes, 2, out);
+        if (out != reference)
+        {
+            printf("%s: %d stripes mismatch against whole frame at %dx%d\n", kernel.name, stripes, width, height);
+            continue;
+        }
+
+        const double seconds = FilterFrames<T>(width, height, kernel, stripes, frames, out);
+
+        char sizeName[32];
+        snprintf(sizeName, sizeof(sizeName), "%dx%d", width, height);
+        printf("%-10s %-12s %8d %9.2f ms %9.1f fps\n", sizeName, kernel.name, stripes, seconds * 1e3 / frames, frames / seconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 20;
+
+    const bool haveAvx2   = !!__builtin_cpu_supports("avx2");
+    const bool haveAvx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+
+    // 16 bit samples have AVX2 kernels only
+    const Kernel kernels[] =
+    {
+        { "AVX2",      false, true,  haveAvx2 },
+        { "AVX-512BW", false, false, haveAvx2 && haveAvx512 },
+        { "P010 AVX2", true,  true,  haveAvx2 },
+    };
+
+    const struct { int width, height; } sizes[] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    printf("%-10s %-12s %8s %12s %13s\n", "size", "kernel", "stripes", "per frame", "frame rate");
+
+    for (auto& size : sizes)
+    {
+        for (auto& kernel : kernels)
+        {
+            if (!kernel.available)
+                continue;
+
+            if (kernel.p010)
+                Bench<uint16_t>(size.width, size.height, kernel, frames);
+            else
+                Bench<uint8_t>(size.width, size.height, kernel, frames);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Stresses mfx_UMC_FrameAllocator the way a decoder drives it from
+// DecodeFrameAsync: set the work surface, allocate a frame, reference it,
+// output it and release it, in random order over pools of up to a few hundred
+// surfaces. Runs with external video memory, delayed allocation, external
+// system memory and internal frames, over a core that counts MapIdx calls.
+// Surfaces handed out are checked against the ones the application gave.
+//
+//   umc_alloc_stress_bench [operations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "mfx_umc_alloc_wrapper.h"
+
+// Core that only keeps reference counters, MapIdx moves MemIds like an external allocator does
+class StressCore : public VideoCORE
+{
+public:
+    mfxStatus GetHandle(mfxHandleType, mfxHDL *) override { return MFX_ERR_NONE; }
+    mfxStatus SetHandle(mfxHandleType, mfxHDL) override { return MFX_ERR_NONE; }
+    mfxStatus SetBufferAllocator(mfxBufferAllocator *) override { return MFX_ERR_NONE; }
+    mfxStatus SetFrameAllocator(mfxFrameAllocator *) override { return MFX_ERR_NONE; }
+    mfxStatus AllocBuffer(mfxU32, mfxU16, mfxMemId *) override { return MFX_ERR_NONE; }
+    mfxStatus LockBuffer(mfxMemId, mfxU8 **) override { return MFX_ERR_NONE; }
+    mfxStatus UnlockBuffer(mfxMemId) override { return MFX_ERR_NONE; }
+    mfxStatus FreeBuffer(mfxMemId) override { return MFX_ERR_NONE; }
+    mfxStatus CheckHandle() override { return MFX_ERR_NONE; }
+    mfxStatus GetFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_NONE; }
+    mfxStatus AllocFrames(mfxFrameAllocRequest *, mfxFrameAllocResponse *, bool) override { return MFX_ERR_NONE; }
+    mfxStatus LockFrame(mfxMemId, mfxFrameData *) override { return MFX_ERR_NONE; }
+    mfxStatus UnlockFrame(mfxMemId, mfxFrameData *) override { return MFX_ERR_NONE; }
+    mfxStatus FreeFrames(mfxFrameAllocResponse *, bool) override { return MFX_ERR_NONE; }
+    mfxStatus LockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_NONE; }
+    mfxStatus GetExternalFrameHDL(mfxMemId, mfxHDL *, bool) override { return MFX_ERR_NONE; }
+    mfxStatus UnlockExternalFrame(mfxMemId, mfxFrameData *, bool) override { return MFX_ERR_NONE; }
+    void GetVA(mfxHDL *, mfxU16) override {}
+    mfxStatus CreateVA(mfxVideoParam *, mfxFrameAllocRequest *, mfxFrameAllocResponse *, UMC::FrameAllocator *) override { return MFX_ERR_NONE; }
+    mfxU32 GetAdapterNumber() override { return 0; }
+    void GetVideoProcessing(mfxHDL *) override {}
+    mfxStatus CreateVideoProcessing(mfxVideoParam *) override { return MFX_ERR_NONE; }
+    mfxU32 GetNumWorkingThreads() override { return 1; }
+    void INeedMoreThreadsInside(const void *) override {}
+    mfxStatus DoFastCopy(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_NONE; }
+    mfxStatus DoFastCopyExtended(mfxFrameSurface1 *, mfxFrameSurface1 *, mfxU32) override { return MFX_ERR_NONE; }
+    mfxStatus DoFastCopyWrapper(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16, mfxU32) override { return MFX_ERR_NONE; }
+    bool IsFastCopyEnabled() override { return false; }
+    mfxU16 GetHWDeviceId() override { return 0; }
+    bool SetCoreId(mfxU32) override { return false; }
+    mfxStatus CopyFrame(mfxFrameSurface1 *, mfxFrameSurface1 *) override { return MFX_ERR_NONE; }
+    mfxStatus CopyBuffer(mfxU8 *, mfxU32, mfxFrameSurface1 *) override { return MFX_ERR_NONE; }
+    mfxStatus CopyFrameEx(mfxFrameSurface1 *, mfxU16, mfxFrameSurface1 *, mfxU16) override { return MFX_ERR_NONE; }
+    mfxStatus IsGuidSupported(const GUID, mfxVideoParam *, bool) override { return MFX_ERR_NONE; }
+    void* QueryCoreInterface(const MFX_GUID &) override { return nullptr; }
+    mfxSession GetSession() override { return nullptr; }
+    mfxU16 GetAutoAsyncDepth() override { return 0; }
+    bool IsExternalFrameAllocator() const override { return true; }
+    eMFXPlatform GetPlatformType() override { return MFX_PLATFORM_HARDWARE; }
+    eMFXVAType GetVAType() const override { return MFX_HW_VAAPI; }
+
+    mfxMemId MapIdx(mfxMemId mid) override
+    {
+        m_mapCalls++;
+        return mid ? (mfxMemId)((size_t)mid ^ 0x100000) : nullptr;
+    }
+
+    mfxStatus IncreaseReference(mfxFrameData *ptr, bool) override
+    {
+        ptr->Locked++;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus DecreaseReference(mfxFrameData *ptr, bool) override
+    {
+        MFX_CHECK(ptr->Locked, MFX_ERR_MORE_DATA);
+        ptr->Locked--;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus IncreasePureReference(mfxU16 &locked) override
+    {
+        locked++;
+        return MFX_ERR_NONE;
+    }
+
+    mfxStatus DecreasePureReference(mfxU16 &locked) override
+    {
+        MFX_CHECK(locked, MFX_ERR_MORE_DATA);
+        locked--;
+        return MFX_ERR_NONE;
+    }
+
+    mfxU64 m_mapCalls = 0;
+};
+
+struct Mode
+{
+    const char* name;
+    bool        external;
+    bool        sw;
+    bool        delayed;
+};
+
+struct Result
+{
+    double ns;
+    double mapCalls;
+    int    errors;
+};
+
+static Result Run(const Mode& mode, int surfaces, int operations)
+{
+    StressCore core;
+
+    mfxVideoParam par = {};
+    par.IOPattern              = MFX_IOPATTERN_OUT_VIDEO_MEMORY;
+    par.mfx.FrameInfo.FourCC   = MFX_FOURCC_NV12;
+    par.mfx.FrameInfo.Width    = 64;
+    par.mfx.FrameInfo.Height   = 64;
+
+    mfxFrameAllocRequest request = {};
+    request.Info = par.mfx.FrameInfo;
+    request.Type = MFX_MEMTYPE_VIDEO_MEMORY_DECODER_TARGET;
+
+    std::vector<mfxMemId> mids(surfaces);
+    for (int i = 0; i < surfaces; i++)
+        mids[i] = (mfxMemId)(size_t)(0x1000 + i * 16);
+
+    // with delayed allocation the application pool shows up only through work surfaces
+    mfxFrameAllocResponse response = {};
+    response.mids           = mids.data();
+    response.NumFrameActual = mode.delayed ? 0 : mfxU16(surfaces);
+
+    mfxFrameAllocResponse initResponse = response;
+    initResponse.NumFrameActual = mfxU16(surfaces);
+
+    // a second set of application surfaces shares the MemIds of the first one,
+    // so that slots keep changing the surface pointer they hold
+    std::vector<mfxFrameSurface1> app(2 * surfaces);
+    for (size_t i = 0; i < app.size(); i++)
+    {
+        app[i] = {};
+        app[i].Info       = request.Info;
+        app[i].Data.MemId = mode.sw ? nullptr : core.MapIdx(mids[i % surfaces]);
+    }
+    const int pool = mode.sw ? surfaces : (int)app.size();
+
+    // declared after the surfaces, Close() releases references to them
+    mfx_UMC_FrameAllocator allocator;
+    if (allocator.InitMfx(0, &core, &par, &request, mode.delayed ? &response : &initResponse, mode.external, mode.sw) != UMC::UMC_OK)
+        return { 0, 0, 1 };
+    if (mode.external)
+        allocator.SetExternalFramesResponse(&response);
+
+    UMC::VideoDataInfo info;
+    info.Init(64, 64, UMC::NV12, 8);
+
+    std::vector<UMC::FrameMemID> held;
+    int errors = 0;
+
+    srand(surfaces);
+    core.m_mapCalls = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int op = 0; op < operations; op++)
+    {
+        const int action = rand() % 10;
+
+        if (action < 4)
+        {
+            // DecodeFrameAsync: work surface in, frame out
+            mfxFrameSurface1* work = &app[rand() % pool];
+            if (allocator.SetCurrentMFXSurface(work) != MFX_ERR_NONE)
+                continue;
+
+            UMC::FrameMemID mid = UMC::FRAME_MID_INVALID;
+            if (allocator.Alloc(&mid, &info, 0) != UMC::UMC_OK)
+                continue;
+
+            allocator.IncreaseReference(mid);
+            held.push_back(mid);
+
+            if (mode.external)
+            {
+                if (allocator.GetSurfaceByIndex(mid) != work || allocator.FindSurface(work) != mid)
+                    errors++;
+            }
+            else
+            {
+                mfxFrameSurface1* internal = allocator.GetInternalSurface(mid);
+                if (!internal || !internal->Data.Locked)
+                    errors++;
+
+                allocator.GetSurface(mid, work, &par);
+            }
+        }
+        else if (action < 8)
+        {
+            // frame is output or dropped
+            if (held.empty())
+                continue;
+
+            const size_t i = rand() % held.size();
+            const UMC::FrameMemID mid = held[i];
+            held[i] = held.back();
+            held.pop_back();
+
+            if (!mode.external && rand() % 2)
+            {
+                mfxFrameSurface1 out = {};
+                out.Data.Locked = 1;
+                allocator.PrepareToOutput(&out, mid, &par);
+            }
+            allocator.DecreaseReference(mid);
+        }
+        else if (action == 8)
+        {
+            // application locks and unlocks its surfaces behind the allocator
+            mfxFrameSurface1* surface = &app[rand() % app.size()];
+            surface->Data.Locked = (rand() % 4 == 0);
+        }
+        else if (rand() % 200 == 0)
+        {
+            allocator.Reset();
+            held.clear();
+            for (auto& surface : app)
+                surface.Data.Locked = 0;
+        }
+    }
+
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return { elapsed.count() / operations, double(core.m_mapCalls) / operations, errors };
+}
+
+int main(int argc, char** argv)
+{
+    const int operations = argc > 1 ? atoi(argv[1]) : 200000;
+
+    const Mode modes[] =
+    {
+        { "external",         true,  false, false },
+        { "external delayed", true,  false, true  },
+        { "external system",  true,  true,  false },
+        { "internal",         false, false, false },
+    };
+
+    int errors = 0;
+
+    printf("%-18s %8s %10s %14s\n", "mode", "surfaces", "ns/op", "MapIdx/op");
+
+    for (auto& mode : modes)
+    {
+        for (int surfaces : { 8, 64, 128, 300, 500 })
+        {
+            Result result = Run(mode, surfaces, operations);
+            printf("%-18s %8d %10.0f %14.2f\n", mode.name, surfaces, result.ns, result.mapCalls);
+
+            if (result.errors)
+                printf("%s with %d surfaces: %d frames don't match the work surface\n", mode.name, surfaces, result.errors);
+            errors += result.errors;
+        }
+    }
+
+    return errors ? 1 : 0;
+}
@@ -667,6 +667,13 @@ protected:
     bool m_ignoreLevelConstrain;
 
 private:
+    // SPS or MVC/SVC subset SPS the PPS refers to, [hash] is hash of NAL unit it was parsed from
+    UMC_H264_DECODER::H264SeqParamSet * GetRefSeqParamSet(uint32_t seq_parameter_set_id, uint64_t &hash);
+    // Hash of all SPS stored with the id, PPS parsed with them is reused until any of them changes
+    uint64_t GetSeqParamSetsHash(uint32_t seq_parameter_set_id) const;
+    // Activate stored PPS if NAL unit repeats it byte for byte
+    bool ReusePicParamSet(const uint8_t *raw, size_t rawSize);
+
     TaskSupplier & operator = (TaskSupplier &)
     {
         return *this;
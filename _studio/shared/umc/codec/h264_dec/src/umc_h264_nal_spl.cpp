@@ -26,6 +26,7 @@
 #include <vector>
 #include "umc_structures.h"
 #include "umc_h264_nal_spl.h"
+#include "umc_start_code_scanner.h"
 #include "mfx_utils_logging.h"
 
 namespace UMC
@@ -38,14 +39,13 @@ static int32_t FindStartCode(uint8_t * (&pb), size_t &nSize)
     if ((int32_t) nSize < 4)
         return -1;
 
-    // find start code
-    while ((4 <= nSize) && ((0 != pb[0]) ||
-                            (0 != pb[1]) ||
-                            (1 != pb[2])))
-    {
-        pb += 1;
-        nSize -= 1;
-    }
+    // find start code followed by at least one byte
+    size_t offset = FindStartCodePrefix(pb, nSize - 1);
+    if (offset == nSize - 1)
+        offset = nSize - 3;
+
+    pb += offset;
+    nSize -= offset;
 
     if (4 <= nSize)
         return ((pb[0] << 24) | (pb[1] << 16) | (pb[2] << 8) | (pb[3]));
@@ -282,79 +282,34 @@ private:
 
     int32_t FindStartCode(uint8_t * (&pb), size_t & size, int32_t & startCodeSize)
     {
-        uint32_t zeroCount = 0;
+        size_t offset = FindStartCodePrefix(pb, size);
 
-        int32_t i = 0;
-        for (; i < (int32_t)size - 2; )
+        if (offset < size)
         {
-            if (pb[1])
-            {
-                pb += 2;
-                i += 2;
-                continue;
-            }
-
-            zeroCount = 0;
-            if (!pb[0])
-                zeroCount++;
-
-            uint32_t j;
-            for (j = 1; j < (uint32_t)size - i; j++)
-            {
-                if (pb[j])
-                    break;
-            }
-
-            zeroCount = zeroCount ? j: j - 1;
-
-            pb += j;
-            i += j;
+            // one more leading zero makes 4-byte start code
+            startCodeSize = (offset && !pb[offset - 1]) ? 4 : 3;
+            offset += 3; // remove 0x01 symbol
 
-            if (i >= (int32_t)size)
+            if (offset < size)
             {
-                break;
+                pb += offset;
+                size -= offset;
+                return pb[0] & NAL_UNITTYPE_BITS;
             }
 
-            if (zeroCount >= 2 && pb[0] == 1)
-            {
-                startCodeSize = std::min(zeroCount + 1, 4u);
-                size -= i + 1;
-                pb++; // remove 0x01 symbol
-                zeroCount = 0;
-                if (size >= 1)
-                {
-                    return pb[0] & NAL_UNITTYPE_BITS;
-                }
-                else
-                {
-                    pb -= startCodeSize;
-                    size += startCodeSize;
-                    startCodeSize = 0;
-                    return -1;
-                }
-            }
-
-            zeroCount = 0;
+            pb += offset - startCodeSize;
+            size = startCodeSize;
+            startCodeSize = 0;
+            return -1;
         }
 
-        if (!zeroCount)
-        {
-            for (uint32_t k = 0; k < size - i; k++, pb++)
-            {
-                if (pb[0])
-                {
-                    zeroCount = 0;
-                    continue;
-                }
-
-                zeroCount++;
-            }
-        }
+        // keep trailing zeros, they can be the beginning of the next start code
+        uint32_t zeroCount = 0;
+        while (zeroCount < 3 && zeroCount < size && !pb[size - zeroCount - 1])
+            zeroCount++;
 
-        zeroCount = std::min(zeroCount, 3u);
-        pb -= zeroCount;
+        pb += size - zeroCount;
         size = zeroCount;
-        zeroCount = 0;
         startCodeSize = 0;
         return -1;
     }
@@ -460,162 +415,10 @@ NalUnit * NALUnitSplitter::GetNalUnits(MediaData * pSource)
     return &m_nalUnit;
 }
 
-/* temporal class definition */
-class H264DwordPointer_
-{
-public:
-    // Default constructor
-    H264DwordPointer_(void)
-    {
-        m_pDest = NULL;
-        m_nByteNum = 0;
-        m_iCur = 0;
-    }
-
-    H264DwordPointer_ operator = (void *pDest)
-    {
-        m_pDest = (uint32_t *) pDest;
-        m_nByteNum = 0;
-        m_iCur = 0;
-
-        return *this;
-    }
-
-    // Increment operator
-    H264DwordPointer_ &operator ++ (void)
-    {
-        if (4 == ++m_nByteNum)
-        {
-            *m_pDest = m_iCur;
-            m_pDest += 1;
-            m_nByteNum = 0;
-            m_iCur = 0;
-        }
-        else
-            m_iCur <<= 8;
-
-        return *this;
-    }
-
-    uint8_t operator = (uint8_t nByte)
-    {
-        m_iCur = (m_iCur & ~0x0ff) | ((uint32_t) nByte);
-
-        return nByte;
-    }
-
-protected:
-    uint32_t *m_pDest;                                            // (uint32_t *) pointer to destination buffer
-    uint32_t m_nByteNum;                                          // (uint32_t) number of current byte in dword
-    uint32_t m_iCur;                                              // (uint32_t) current dword
-};
-
-class H264SourcePointer_
-{
-public:
-    // Default constructor
-    H264SourcePointer_(void)
-    {
-        m_pSource = NULL;
-        m_nZeros = 0;
-        m_nRemovedBytes = 0;
-    }
-
-    H264SourcePointer_ &operator = (void *pSource)
-    {
-        m_pSource = (uint8_t *) pSource;
-
-        m_nZeros = 0;
-        m_nRemovedBytes = 0;
-
-        return *this;
-    }
-
-    H264SourcePointer_ &operator ++ (void)
-    {
-        uint8_t bCurByte = m_pSource[0];
-
-        if (0 == bCurByte)
-            m_nZeros += 1;
-        else
-        {
-            if ((3 == bCurByte) && (2 <= m_nZeros))
-                m_nRemovedBytes += 1;
-            m_nZeros = 0;
-        }
-
-        m_pSource += 1;
-
-        return *this;
-    }
-
-    bool IsPrevent(void)
-    {
-        if ((3 == m_pSource[0]) && (2 <= m_nZeros))
-            return true;
-        else
-            return false;
-    }
-
-    operator uint8_t (void)
-    {
-        return m_pSource[0];
-    }
-
-    uint32_t GetRemovedBytes(void)
-    {
-        return m_nRemovedBytes;
-    }
-
-protected:
-    uint8_t *m_pSource;                                           // (uint8_t *) pointer to destination buffer
-    uint32_t m_nZeros;                                            // (uint32_t) number of preceding zeros
-    uint32_t m_nRemovedBytes;                                     // (uint32_t) number of removed bytes
-};
-
 void SwapMemoryAndRemovePreventingBytes(void *pDestination, size_t &nDstSize, void *pSource, size_t nSrcSize)
 {
-    H264DwordPointer_ pDst;
-    H264SourcePointer_ pSrc;
-    size_t i;
-
-    // DwordPointer object is swapping written bytes
-    // H264SourcePointer_ removes preventing start-code bytes
-
-    // reset pointer(s)
-    pSrc = pSource;
-    pDst = pDestination;
-
-    // first two bytes
-    i = 0;
-    while (i < std::min(size_t(2), nSrcSize))
-    {
-        pDst = (uint8_t) pSrc;
-        ++pDst;
-        ++pSrc;
-        ++i;
-    }
-
-    // do swapping
-    while (i < (uint32_t) nSrcSize)
-    {
-        if (false == pSrc.IsPrevent())
-        {
-            pDst = (uint8_t) pSrc;
-            ++pDst;
-        }
-        ++pSrc;
-        ++i;
-    }
-
-    // write padding bytes
-    nDstSize = nSrcSize - pSrc.GetRemovedBytes();
-    while (nDstSize & 3)
-    {
-        pDst = (uint8_t) (DEFAULT_NU_TAIL_VALUE);
-        ++nDstSize;
-        ++pDst;
-    }
+    // preventing start-code bytes are removed and written bytes are swapped in a single pass
+    nDstSize = RemovePreventingBytesAndSwap((uint8_t *) pDestination, (const uint8_t *) pSource, nSrcSize, DEFAULT_NU_TAIL_VALUE, NULL);
 
 } // void SwapMemoryAndRemovePreventingBytes(void *pDst, size_t &nDstSize, void *pSrc, size_t nSrcSize)
 
@@ -2446,6 +2446,69 @@ Status TaskSupplier::DecodeSEI(NalUnit *nalUnit)
     return UMC_OK;
 }
 
+H264SeqParamSet * TaskSupplier::GetRefSeqParamSet(uint32_t seq_parameter_set_id, uint64_t &hash)
+{
+    H264SeqParamSet *refSps = m_Headers.m_SeqParams.GetHeader(seq_parameter_set_id);
+    hash = m_Headers.m_SeqParams.GetPayloadHash(seq_parameter_set_id);
+
+    if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
+    {
+        refSps = m_Headers.m_SeqParamsMvcExt.GetHeader(seq_parameter_set_id);
+        hash = m_Headers.m_SeqParamsMvcExt.GetPayloadHash(seq_parameter_set_id);
+
+        if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
+        {
+            refSps = m_Headers.m_SeqParamsSvcExt.GetHeader(seq_parameter_set_id);
+            hash = m_Headers.m_SeqParamsSvcExt.GetPayloadHash(seq_parameter_set_id);
+
+            if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
+                return 0;
+        }
+    }
+
+    return refSps;
+}
+
+uint64_t TaskSupplier::GetSeqParamSetsHash(uint32_t seq_parameter_set_id) const
+{
+    uint64_t const h0 = m_Headers.m_SeqParams.GetPayloadHash(seq_parameter_set_id);
+    uint64_t const h1 = m_Headers.m_SeqParamsMvcExt.GetPayloadHash(seq_parameter_set_id);
+    uint64_t const h2 = m_Headers.m_SeqParamsSvcExt.GetPayloadHash(seq_parameter_set_id);
+
+    return h0 ^ (h1 << 21 | h1 >> 43) ^ (h2 << 42 | h2 >> 22);
+}
+
+// Streams repeat PPS at every IDR or even every frame. Take the stored one if NAL unit
+// repeats it byte for byte and SPS it was parsed with are the same, state changes
+// are the same DecodeHeaders makes for a freshly parsed copy
+bool TaskSupplier::ReusePicParamSet(const uint8_t *raw, size_t rawSize)
+{
+    H264PicParamSet *pps = m_Headers.m_PicParams.FindHeader(raw, rawSize);
+    if (!pps)
+        return false;
+
+    uint64_t refSpsHash = 0;
+    H264SeqParamSet *refSps = GetRefSeqParamSet(pps->seq_parameter_set_id, refSpsHash);
+    if (!refSps || !refSpsHash ||
+        m_Headers.m_PicParams.GetDependency(pps->pic_parameter_set_id) != GetSeqParamSetsHash(pps->seq_parameter_set_id))
+        return false;
+
+    uint32_t prevActivePPS = m_Headers.m_PicParams.GetCurrentID();
+
+    pps->errorFlags = 0;
+    m_Headers.m_PicParams.SetCurrentID(pps->pic_parameter_set_id);
+
+    // in case of MVC restore previous active PPS
+    if ((H264VideoDecoderParams::H264_PROFILE_MULTIVIEW_HIGH == refSps->profile_idc) ||
+        (H264VideoDecoderParams::H264_PROFILE_STEREO_HIGH == refSps->profile_idc))
+    {
+        m_Headers.m_PicParams.SetCurrentID(prevActivePPS);
+    }
+
+    ErrorStatus::isPPSError = 0;
+    return true;
+}
+
 Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
 {
     ViewItem *view = GetViewCount() ? &GetViewByNumber(BASE_VIEW) : 0;
@@ -2455,6 +2518,12 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
 
     try
     {
+        const uint8_t *raw = (const uint8_t*)nalUnit->GetDataPointer();
+        size_t const rawSize = nalUnit->GetDataSize();
+
+        if (nalUnit->GetNalUnitType() == NAL_UT_PPS && ReusePicParamSet(raw, rawSize))
+            return UMC_OK;
+
         H264MemoryPiece mem;
         mem.SetData(nalUnit);
 
@@ -2516,7 +2585,7 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
                 DEBUG_PRINT((VM_STRING("debug headers SPS - %d, num_ref_frames - %d \n"), sps.seq_parameter_set_id, sps.num_ref_frames));
 
                 H264SeqParamSet * temp = m_Headers.m_SeqParams.GetHeader(sps.seq_parameter_set_id);
-                m_Headers.m_SeqParams.AddHeader(&sps);
+                m_Headers.m_SeqParams.AddHeader(&sps, raw, rawSize);
 
                 // Validate the incoming bitstream's image dimensions.
                 temp = m_Headers.m_SeqParams.GetHeader(sps.seq_parameter_set_id);
@@ -2582,19 +2651,12 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
                     return UMC_ERR_INVALID_STREAM;
                 }
 
-                H264SeqParamSet *refSps = m_Headers.m_SeqParams.GetHeader(pps.seq_parameter_set_id);
+                uint64_t refSpsHash = 0;
+                H264SeqParamSet *refSps = GetRefSeqParamSet(pps.seq_parameter_set_id, refSpsHash);
                 uint32_t prevActivePPS = m_Headers.m_PicParams.GetCurrentID();
 
-                if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
-                {
-                    refSps = m_Headers.m_SeqParamsMvcExt.GetHeader(pps.seq_parameter_set_id);
-                    if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
-                    {
-                        refSps = m_Headers.m_SeqParamsSvcExt.GetHeader(pps.seq_parameter_set_id);
-                        if (!refSps || refSps->seq_parameter_set_id >= MAX_NUM_SEQ_PARAM_SETS)
-                            return UMC_ERR_INVALID_STREAM;
-                    }
-                }
+                if (!refSps)
+                    return UMC_ERR_INVALID_STREAM;
 
                 // Get rest of pic param set
                 umcRes = bitStream.GetPictureParamSetPart2(&pps, refSps);
@@ -2607,7 +2669,8 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
                 }
 
                 DEBUG_PRINT((VM_STRING("debug headers PPS - %d - SPS - %d\n"), pps.pic_parameter_set_id, pps.seq_parameter_set_id));
-                m_Headers.m_PicParams.AddHeader(&pps);
+                // keep raw bytes only if SPS it depends on are known by their bytes too
+                m_Headers.m_PicParams.AddHeader(&pps, refSpsHash ? raw : nullptr, rawSize, GetSeqParamSetsHash(pps.seq_parameter_set_id));
 
                 //m_Headers.m_SeqParams.SetCurrentID(pps.seq_parameter_set_id);
                 // in case of MVC restore previous active PPS
@@ -2659,7 +2722,7 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
                         newResolution = true;
                     }
 
-                    m_Headers.m_SeqParamsSvcExt.AddHeader(&spsSvcExt);
+                    m_Headers.m_SeqParamsSvcExt.AddHeader(&spsSvcExt, raw, rawSize);
 
                     SVC_Extension::ChooseLevelIdc(&spsSvcExt, sps.level_idc, sps.level_idc);
 
@@ -2698,7 +2761,7 @@ Status TaskSupplier::DecodeHeaders(NalUnit *nalUnit)
                     }
 
                     DEBUG_PRINT((VM_STRING("debug headers SUBSET SPS MVC ext - %d \n"), sps.seq_parameter_set_id));
-                    m_Headers.m_SeqParamsMvcExt.AddHeader(&spsMvcExt);
+                    m_Headers.m_SeqParamsMvcExt.AddHeader(&spsMvcExt, raw, rawSize);
 
                     MVC_Extension::ChooseLevelIdc(&spsMvcExt, sps.level_idc, sps.level_idc);
 
@@ -49,13 +49,16 @@ public:
         Reset(false);
     }
 
-    T * AddHeader(T* hdr)
+    // [raw] is the NAL unit the header was parsed from, [dependency] is what else the parsing depended on.
+    // Later NAL units repeating [raw] are looked up with FindHeader() instead of being parsed again
+    T * AddHeader(T* hdr, const uint8_t *raw = nullptr, size_t rawSize = 0, uint64_t dependency = 0)
     {
         uint32_t id = hdr->GetID();
 
         if (id >= m_Header.size())
         {
             m_Header.resize(id + 1);
+            m_Raw.resize(id + 1);
         }
 
         m_currentID = id;
@@ -73,9 +76,35 @@ public:
         header->IncrementReference();
 
         m_Header[id] = header;
+        m_Raw[id].Set(raw, rawSize, dependency);
         return header;
     }
 
+    // Stored header parsed from exactly these NAL unit bytes
+    T * FindHeader(const uint8_t *raw, size_t rawSize)
+    {
+        uint64_t const hash = RawPayload::Hash(raw, rawSize);
+
+        for (uint32_t i = 0; i < m_Raw.size(); i++)
+        {
+            if (m_Header[i] && m_Raw[i].IsSame(hash, raw, rawSize))
+                return m_Header[i];
+        }
+
+        return 0;
+    }
+
+    // Hash of NAL unit bytes the header was parsed from, 0 if unknown
+    uint64_t GetPayloadHash(int32_t id) const
+    {
+        return (uint32_t)id < m_Raw.size() ? m_Raw[id].hash : 0;
+    }
+
+    uint64_t GetDependency(int32_t id) const
+    {
+        return (uint32_t)id < m_Raw.size() ? m_Raw[id].dependency : 0;
+    }
+
     T * GetHeader(int32_t id)
     {
         if ((uint32_t)id >= m_Header.size())
@@ -122,6 +151,7 @@ public:
         assert(m_Header[id] == hdr);
         m_Header[id]->DecrementReference();
         m_Header[id] = 0;
+        m_Raw[id].Set(0, 0, 0);
     }
 
     void Reset(bool isPartialReset = false)
@@ -134,6 +164,7 @@ public:
             }
 
             m_Header.clear();
+            m_Raw.clear();
             m_currentID = -1;
         }
     }
@@ -166,7 +197,41 @@ public:
     }
 
 private:
+
+    // NAL unit bytes (with emulation prevention) a stored header was parsed from
+    struct RawPayload
+    {
+        uint64_t             hash = 0;
+        uint64_t             dependency = 0;
+        std::vector<uint8_t> data;
+
+        // FNV-1a
+        static uint64_t Hash(const uint8_t *raw, size_t rawSize)
+        {
+            uint64_t h = 0xcbf29ce484222325ull;
+            for (size_t i = 0; i < rawSize; i++)
+                h = (h ^ raw[i]) * 0x100000001b3ull;
+            return h;
+        }
+
+        void Set(const uint8_t *raw, size_t rawSize, uint64_t dep)
+        {
+            hash       = raw ? Hash(raw, rawSize) : 0;
+            dependency = dep;
+            if (raw)
+                data.assign(raw, raw + rawSize);
+            else
+                data.clear();
+        }
+
+        bool IsSame(uint64_t h, const uint8_t *raw, size_t rawSize) const
+        {
+            return !data.empty() && hash == h && data.size() == rawSize && !memcmp(data.data(), raw, rawSize);
+        }
+    };
+
     std::vector<T*>           m_Header;
+    std::vector<RawPayload>   m_Raw;
     Heap_Objects             *m_pObjHeap;
 
     int32_t                    m_currentID;
@@ -482,11 +482,13 @@ protected:
 
 private:
     // Decode video parameters set NAL unit
-    UMC::Status xDecodeVPS(H265HeadersBitstream *);
+    UMC::Status xDecodeVPS(H265HeadersBitstream *, const uint8_t *raw, size_t rawSize);
     // Decode sequence parameters set NAL unit
-    UMC::Status xDecodeSPS(H265HeadersBitstream *);
+    UMC::Status xDecodeSPS(H265HeadersBitstream *, const uint8_t *raw, size_t rawSize);
     // Decode picture parameters set NAL unit
-    UMC::Status xDecodePPS(H265HeadersBitstream *);
+    UMC::Status xDecodePPS(H265HeadersBitstream *, const uint8_t *raw, size_t rawSize);
+    // Activate stored VPS/SPS/PPS if NAL unit repeats it byte for byte
+    bool xReuseHeader(const uint8_t *raw, size_t rawSize, UMC::Status &sts);
 
     TaskSupplier_H265 & operator = (TaskSupplier_H265 &)
     {
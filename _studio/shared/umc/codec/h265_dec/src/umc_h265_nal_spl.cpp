@@ -22,6 +22,7 @@
 #ifdef MFX_ENABLE_H265_VIDEO_DECODE
 
 #include "umc_h265_nal_spl.h"
+#include "umc_start_code_scanner.h"
 #include "mfx_common.h" //  for trace routines
 
 namespace UMC_HEVC_DECODER
@@ -43,14 +44,13 @@ static int32_t FindStartCode(const uint8_t *pb, size_t &nSize)
     if ((int32_t) nSize < 4)
         return -1;
 
-    // find start code
-    while ((4 <= nSize) && ((0 != pb[0]) ||
-                            (0 != pb[1]) ||
-                            (1 != pb[2])))
-    {
-        pb += 1;
-        nSize -= 1;
-    }
+    // find start code followed by at least one byte
+    size_t offset = UMC::FindStartCodePrefix(pb, nSize - 1);
+    if (offset == nSize - 1)
+        offset = nSize - 3;
+
+    pb += offset;
+    nSize -= offset;
 
     if (4 <= nSize)
         return ((pb[0] << 24) | (pb[1] << 16) | (pb[2] << 8) | (pb[3]));
@@ -293,79 +293,35 @@ private:
     double   m_pts;
 
     // Searches NAL unit start code, places input pointer to it and fills up size paramters
-    // ML: OPT: Replace with MaxL's fast start code search
     int32_t FindStartCode(uint8_t * (&pb), size_t & size, int32_t & startCodeSize)
     {
-        uint32_t zeroCount = 0;
+        size_t offset = UMC::FindStartCodePrefix(pb, size);
 
-        int32_t i = 0;
-        for (; i < (int32_t)size - 2; )
+        if (offset < size)
         {
-            if (pb[1])
-            {
-                pb += 2;
-                i += 2;
-                continue;
-            }
-
-            zeroCount = 0;
-            if (!pb[0])
-                zeroCount++;
-
-            uint32_t j;
-            for (j = 1; j < (uint32_t)size - i; j++)
-            {
-                if (pb[j])
-                    break;
-            }
-
-            zeroCount = zeroCount ? j: j - 1;
-
-            pb += j;
-            i += j;
-
-            if (i >= (int32_t)size)
-            {
-                break;
-            }
+            // one more leading zero makes 4-byte start code
+            startCodeSize = (offset && !pb[offset - 1]) ? 4 : 3;
+            offset += 3; // remove 0x01 symbol
 
-            if (zeroCount >= 2 && pb[0] == 1)
+            if (offset < size)
             {
-                startCodeSize = std::min(zeroCount + 1, 4u);
-                size -= i + 1;
-                pb++; // remove 0x01 symbol
-                if (size >= 1)
-                {
-                    return (pb[0] & NAL_UNITTYPE_BITS_H265) >> NAL_UNITTYPE_SHIFT_H265;
-                }
-                else
-                {
-                    pb -= startCodeSize;
-                    size += startCodeSize;
-                    startCodeSize = 0;
-                    return -1;
-                }
+                pb += offset;
+                size -= offset;
+                return (pb[0] & NAL_UNITTYPE_BITS_H265) >> NAL_UNITTYPE_SHIFT_H265;
             }
 
-            zeroCount = 0;
+            pb += offset - startCodeSize;
+            size = startCodeSize;
+            startCodeSize = 0;
+            return -1;
         }
 
-        if (!zeroCount)
-        {
-            for (uint32_t k = 0; k < size - i; k++, pb++)
-            {
-                if (pb[0])
-                {
-                    zeroCount = 0;
-                    continue;
-                }
-
-                zeroCount++;
-            }
-        }
+        // keep trailing zeros, they can be the beginning of the next start code
+        uint32_t zeroCount = 0;
+        while (zeroCount < 3 && zeroCount < size && !pb[size - zeroCount - 1])
+            zeroCount++;
 
-        zeroCount = std::min(zeroCount, 3u);
-        pb -= zeroCount;
+        pb += size - zeroCount;
         size = zeroCount;
         startCodeSize = zeroCount;
         return -1;
@@ -473,184 +429,11 @@ UMC::MediaDataEx * NALUnitSplitter_H265::GetNalUnits(UMC::MediaData * pSource)
     return out;
 }
 
-// Utility class for writing 32-bit little endian integers
-class H265DwordPointer_
-{
-public:
-    // Default constructor
-    H265DwordPointer_(void)
-    {
-        m_pDest = NULL;
-        m_iCur = 0;
-        m_nByteNum = 0;
-    }
-
-    H265DwordPointer_ operator = (void *pDest)
-    {
-        m_pDest = (uint32_t *) pDest;
-        m_nByteNum = 0;
-        m_iCur = 0;
-
-        return *this;
-    }
-
-    // Increment operator
-    H265DwordPointer_ &operator ++ (void)
-    {
-        if (4 == ++m_nByteNum)
-        {
-            *m_pDest = m_iCur;
-            m_pDest += 1;
-            m_nByteNum = 0;
-            m_iCur = 0;
-        }
-        else
-            m_iCur <<= 8;
-
-        return *this;
-    }
-
-    uint8_t operator = (uint8_t nByte)
-    {
-        m_iCur = (m_iCur & ~0x0ff) | ((uint32_t) nByte);
-
-        return nByte;
-    }
-
-protected:
-    uint32_t *m_pDest;                                            // (uint32_t *) pointer to destination buffer
-    uint32_t m_nByteNum;                                          // (uint32_t) number of current byte in dword
-    uint32_t m_iCur;                                              // (uint32_t) current dword
-};
-
-// Utility class for reading big endian bitstream
-class H265SourcePointer_
-{
-public:
-    // Default constructor
-    H265SourcePointer_(void)
-    {
-        m_nZeros = 0;
-        m_pSource = NULL;
-        m_nRemovedBytes = 0;
-    }
-
-    H265SourcePointer_ &operator = (void *pSource)
-    {
-        m_pSource = (uint8_t *) pSource;
-
-        m_nZeros = 0;
-        m_nRemovedBytes = 0;
-
-        return *this;
-    }
-
-    H265SourcePointer_ &operator ++ (void)
-    {
-        uint8_t bCurByte = m_pSource[0];
-
-        if (0 == bCurByte)
-            m_nZeros += 1;
-        else
-        {
-            if ((3 == bCurByte) && (2 <= m_nZeros))
-                m_nRemovedBytes += 1;
-            m_nZeros = 0;
-        }
-
-        m_pSource += 1;
-
-        return *this;
-    }
-
-    bool IsPrevent(void)
-    {
-        if ((3 == m_pSource[0]) && (2 <= m_nZeros))
-            return true;
-        else
-            return false;
-    }
-
-    operator uint8_t (void)
-    {
-        return m_pSource[0];
-    }
-
-    uint32_t GetRemovedBytes(void)
-    {
-        return m_nRemovedBytes;
-    }
-
-protected:
-    uint8_t *m_pSource;                                           // (uint8_t *) pointer to destination buffer
-    uint32_t m_nZeros;                                            // (uint32_t) number of preceding zeros
-    uint32_t m_nRemovedBytes;                                     // (uint32_t) number of removed bytes
-};
-
 // Change memory region to little endian for reading with 32-bit DWORDs and remove start code emulation prevention byteps
 void SwapMemoryAndRemovePreventingBytes_H265(void *pDestination, size_t &nDstSize, void *pSource, size_t nSrcSize, std::vector<uint32_t> *pRemovedOffsets)
 {
-    H265DwordPointer_ pDst;
-    H265SourcePointer_ pSrc;
-    size_t i;
-
-    // DwordPointer object is swapping written bytes
-    // H265SourcePointer_ removes preventing start-code bytes
-
-    // reset pointer(s)
-    pSrc = pSource;
-    pDst = pDestination;
-
-    // first two bytes
-    i = 0;
-    while (i < std::min(size_t(2), nSrcSize))
-    {
-        pDst = (uint8_t) pSrc;
-        ++pDst;
-        ++pSrc;
-        ++i;
-    }
-
-    // do swapping
-    if (NULL != pRemovedOffsets)
-    {
-        while (i < (uint32_t) nSrcSize)
-        {
-            if (false == pSrc.IsPrevent())
-            {
-                pDst = (uint8_t) pSrc;
-                ++pDst;
-            }
-            else
-                pRemovedOffsets->push_back(uint32_t(i));
-
-            ++pSrc;
-            ++i;
-        }
-    }
-    else
-    {
-        while (i < (uint32_t) nSrcSize)
-        {
-            if (false == pSrc.IsPrevent())
-            {
-                pDst = (uint8_t) pSrc;
-                ++pDst;
-            }
-
-            ++pSrc;
-            ++i;
-        }
-    }
-
-    // write padding bytes
-    nDstSize = nSrcSize - pSrc.GetRemovedBytes();
-    while (nDstSize & 3)
-    {
-        pDst = (uint8_t) (0);
-        ++nDstSize;
-        ++pDst;
-    }
+    // preventing start-code bytes are removed and written bytes are swapped in a single pass
+    nDstSize = UMC::RemovePreventingBytesAndSwap((uint8_t *) pDestination, (const uint8_t *) pSource, nSrcSize, 0, pRemovedOffsets);
 
 } // void SwapMemoryAndRemovePreventingBytes_H265(void *pDst, size_t &nDstSize, void *pSrc, size_t nSrcSize, , std::vector<uint32_t> *pRemovedOffsets)
 
@@ -1078,23 +1078,26 @@ UMC::Status TaskSupplier_H265::DecodeSEI(UMC::MediaDataEx *nalUnit)
 }
 
 // Decode video parameters set NAL unit
-UMC::Status TaskSupplier_H265::xDecodeVPS(H265HeadersBitstream *bs)
+UMC::Status TaskSupplier_H265::xDecodeVPS(H265HeadersBitstream *bs, const uint8_t *raw, size_t rawSize)
 {
     H265VideoParamSet vps;
 
     UMC::Status s = bs->GetVideoParamSet(&vps);
     if(s == UMC::UMC_OK)
-        m_Headers.m_VideoParams.AddHeader(&vps);
+        m_Headers.m_VideoParams.AddHeader(&vps, raw, rawSize);
 
     return s;
 }
 
 // Decode sequence parameters set NAL unit
-UMC::Status TaskSupplier_H265::xDecodeSPS(H265HeadersBitstream *bs)
+UMC::Status TaskSupplier_H265::xDecodeSPS(H265HeadersBitstream *bs, const uint8_t *raw, size_t rawSize)
 {
     H265SeqParamSet sps;
     sps.Reset();
 
+    // DPB size below depends on the previous HighestTid, it keys the stored SPS
+    uint32_t const prevHighestTid = HighestTid;
+
     UMC::Status s = bs->GetSequenceParamSet(&sps);
     if(s != UMC::UMC_OK)
         return s;
@@ -1150,7 +1153,7 @@ UMC::Status TaskSupplier_H265::xDecodeSPS(H265HeadersBitstream *bs)
         newResolution = true;
     }
 
-    m_Headers.m_SeqParams.AddHeader(&sps);
+    m_Headers.m_SeqParams.AddHeader(&sps, raw, rawSize, prevHighestTid);
 
     m_pNALSplitter->SetSuggestedSize(CalculateSuggestedSize(&sps));
 
@@ -1161,7 +1164,7 @@ UMC::Status TaskSupplier_H265::xDecodeSPS(H265HeadersBitstream *bs)
 }
 
 // Decode picture parameters set NAL unit
-UMC::Status TaskSupplier_H265::xDecodePPS(H265HeadersBitstream * bs)
+UMC::Status TaskSupplier_H265::xDecodePPS(H265HeadersBitstream * bs, const uint8_t *raw, size_t rawSize)
 {
     H265PicParamSet pps;
     pps.Reset();
@@ -1401,11 +1404,72 @@ UMC::Status TaskSupplier_H265::xDecodePPS(H265HeadersBitstream * bs)
         pps.tilesInfo[i].width = pps.column_width[tileX];
     }
 
-    m_Headers.m_PicParams.AddHeader(&pps);
+    // CTB address and tile tables are built from SPS, the stored PPS is reused only with the same SPS bytes
+    uint64_t const spsHash = m_Headers.m_SeqParams.GetPayloadHash(pps.pps_seq_parameter_set_id);
+    m_Headers.m_PicParams.AddHeader(&pps, spsHash ? raw : nullptr, rawSize, spsHash);
 
     return s;
 }
 
+// Activate stored VPS/SPS/PPS if NAL unit repeats it byte for byte.
+// The state changes are the same xDecodeXPS would make with a freshly parsed copy
+bool TaskSupplier_H265::xReuseHeader(const uint8_t *raw, size_t rawSize, UMC::Status &sts)
+{
+    if (rawSize < 2)
+        return false;
+
+    sts = UMC::UMC_OK;
+
+    switch ((NalUnitType)((raw[0] >> 1) & 0x3f))
+    {
+    case NAL_UT_VPS:
+        {
+            H265VideoParamSet *vps = m_Headers.m_VideoParams.FindHeader(raw, rawSize);
+            if (!vps)
+                return false;
+
+            m_Headers.m_VideoParams.SetCurrentID(vps->GetID());
+        }
+        return true;
+
+    case NAL_UT_SPS:
+        {
+            H265SeqParamSet *sps = m_Headers.m_SeqParams.FindHeader(raw, rawSize);
+            if (!sps || m_Headers.m_SeqParams.GetDependency(sps->GetID()) != HighestTid)
+                return false;
+
+            HighestTid = sps->sps_max_sub_layers - 1;
+
+            const H265SeqParamSet * old_sps = m_Headers.m_SeqParams.GetCurrentHeader();
+            if (IsNeedSPSInvalidate(old_sps, sps))
+            {
+                m_RecreateSurfaceFlag = IsNeedRecreateSurface(old_sps, sps);
+                sts = UMC::UMC_NTF_NEW_RESOLUTION;
+            }
+
+            sps->m_changed = false;
+            m_Headers.m_SeqParams.SetCurrentID(sps->GetID());
+
+            m_pNALSplitter->SetSuggestedSize(CalculateSuggestedSize(sps));
+        }
+        return true;
+
+    case NAL_UT_PPS:
+        {
+            H265PicParamSet *pps = m_Headers.m_PicParams.FindHeader(raw, rawSize);
+            if (!pps || m_Headers.m_PicParams.GetDependency(pps->GetID()) != m_Headers.m_SeqParams.GetPayloadHash(pps->pps_seq_parameter_set_id))
+                return false;
+
+            pps->m_changed = false;
+            m_Headers.m_PicParams.SetCurrentID(pps->GetID());
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 // Decode a bitstream header NAL unit
 UMC::Status TaskSupplier_H265::DecodeHeaders(UMC::MediaDataEx *nalUnit)
 {
@@ -1416,6 +1480,13 @@ UMC::Status TaskSupplier_H265::DecodeHeaders(UMC::MediaDataEx *nalUnit)
 
     try
     {
+        const uint8_t *raw = (const uint8_t*)nalUnit->GetDataPointer();
+        size_t const rawSize = nalUnit->GetDataSize();
+
+        // streams repeat parameter sets at every IRAP or even every frame
+        if (xReuseHeader(raw, rawSize, umcRes))
+            return umcRes;
+
         MemoryPiece mem;
         mem.SetData(nalUnit);
 
@@ -1438,13 +1509,13 @@ UMC::Status TaskSupplier_H265::DecodeHeaders(UMC::MediaDataEx *nalUnit)
         switch (nal_unit_type)
         {
         case NAL_UT_VPS:
-            umcRes = xDecodeVPS(&bitStream);
+            umcRes = xDecodeVPS(&bitStream, raw, rawSize);
             break;
         case NAL_UT_SPS:
-            umcRes = xDecodeSPS(&bitStream);
+            umcRes = xDecodeSPS(&bitStream, raw, rawSize);
             break;
         case NAL_UT_PPS:
-            umcRes = xDecodePPS(&bitStream);
+            umcRes = xDecodePPS(&bitStream, raw, rawSize);
             break;
         default:
             break;
@@ -309,9 +309,11 @@ namespace UMC_VVC_DECODER
         // Decode video parameters set NAL unit
         UMC::Status xDecodeVPS(VVCHeadersBitstream *);
         // Decode sequence parameters set NAL unit
-        UMC::Status xDecodeSPS(VVCHeadersBitstream *);
+        UMC::Status xDecodeSPS(VVCHeadersBitstream *, const uint8_t *raw, size_t rawSize);
         // Decode picture parameters set NAL unit
-        UMC::Status xDecodePPS(VVCHeadersBitstream *);
+        UMC::Status xDecodePPS(VVCHeadersBitstream *, const uint8_t *raw, size_t rawSize);
+        // Activate stored SPS/PPS if NAL unit repeats it byte for byte
+        bool xReuseHeader(const uint8_t *raw, size_t rawSize, UMC::Status &sts);
         // Decode picture header NAL unit
         UMC::Status xDecodePH(VVCHeadersBitstream *);
         // Decode adaption parameters set NAL unit
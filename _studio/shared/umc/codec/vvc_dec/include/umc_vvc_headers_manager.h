@@ -48,13 +48,16 @@ namespace UMC_VVC_DECODER
             Reset(false);
         }
 
-        T * AddHeader(T* hdr)
+        // [raw] is the NAL unit the header was parsed from,
+        // later NAL units repeating it are looked up with FindHeader() instead of being parsed again
+        T * AddHeader(T* hdr, const uint8_t *raw = nullptr, size_t rawSize = 0)
         {
             uint32_t id = hdr->GetID();
 
             if (id >= m_header.size())
             {
                 m_header.resize(id + 1, nullptr);
+                m_raw.resize(id + 1);
             }
 
             m_currentID = id;
@@ -72,9 +75,24 @@ namespace UMC_VVC_DECODER
             header->IncrementReference();
 
             m_header[id] = header;
+            m_raw[id].Set(raw, rawSize);
             return header;
         }
 
+        // Stored header parsed from exactly these NAL unit bytes
+        T * FindHeader(const uint8_t *raw, size_t rawSize)
+        {
+            uint64_t const hash = RawPayload::Hash(raw, rawSize);
+
+            for (uint32_t i = 0; i < m_raw.size(); i++)
+            {
+                if (m_header[i] && m_raw[i].IsSame(hash, raw, rawSize))
+                    return m_header[i];
+            }
+
+            return nullptr;
+        }
+
         T * GetHeader(int32_t id)
         {
             if ((uint32_t)id >= m_header.size())
@@ -126,6 +144,7 @@ namespace UMC_VVC_DECODER
             assert(m_header[id] == hdr);
             m_header[id]->DecrementReference();
             m_header[id] = 0;
+            m_raw[id].Set(nullptr, 0);
         }
 
         void Reset(bool isPartialReset = false)
@@ -138,6 +157,7 @@ namespace UMC_VVC_DECODER
                 }
 
                 m_header.clear();
+                m_raw.clear();
                 m_currentID = -1;
             }
         }
@@ -171,7 +191,38 @@ namespace UMC_VVC_DECODER
 
     private:
 
+        // NAL unit bytes (with emulation prevention) a stored header was parsed from
+        struct RawPayload
+        {
+            uint64_t             hash = 0;
+            std::vector<uint8_t> data;
+
+            // FNV-1a
+            static uint64_t Hash(const uint8_t *raw, size_t rawSize)
+            {
+                uint64_t h = 0xcbf29ce484222325ull;
+                for (size_t i = 0; i < rawSize; i++)
+                    h = (h ^ raw[i]) * 0x100000001b3ull;
+                return h;
+            }
+
+            void Set(const uint8_t *raw, size_t rawSize)
+            {
+                hash = raw ? Hash(raw, rawSize) : 0;
+                if (raw)
+                    data.assign(raw, raw + rawSize);
+                else
+                    data.clear();
+            }
+
+            bool IsSame(uint64_t h, const uint8_t *raw, size_t rawSize) const
+            {
+                return !data.empty() && hash == h && data.size() == rawSize && !memcmp(data.data(), raw, rawSize);
+            }
+        };
+
         std::vector<T*>           m_header;
+        std::vector<RawPayload>   m_raw;
         Heap_Objects              *m_objHeap;
         int32_t                   m_currentID;
     };
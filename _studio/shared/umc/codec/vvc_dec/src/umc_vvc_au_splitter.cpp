@@ -23,6 +23,7 @@
 
 #include "umc_media_data.h"
 #include "umc_vvc_au_splitter.h"
+#include "umc_start_code_scanner.h"
 
 namespace UMC_VVC_DECODER
 {
@@ -133,76 +134,33 @@ namespace UMC_VVC_DECODER
 
     int32_t StartCodeSearcher::FindStartCode(uint8_t *(&pBuf), size_t &size, int32_t &startCodeSize)
     {
-        uint32_t numZeroBytes = 0;
+        size_t offset = UMC::FindStartCodePrefix(pBuf, size);
 
-        int32_t i = 0;
-        for (; i < (int32_t)size - 2; )
+        if (offset < size)
         {
-            if (pBuf[1])
-            {
-                pBuf += 2;
-                i += 2;
-                continue;
-            }
-
-            numZeroBytes = 0;
-            if (!pBuf[0])
-                numZeroBytes++;
+            // one more leading zero makes 4-byte start code
+            startCodeSize = (offset && !pBuf[offset - 1]) ? 4 : 3;
+            offset += 3;    // remove 0x01 symbol
 
-            uint32_t j;
-            for (j = 1; j < (uint32_t)size - i; j++)
+            if (offset < size)
             {
-                if (pBuf[j])
-                    break;
-            }
-
-            numZeroBytes = numZeroBytes ? j: j - 1;
-
-            pBuf += j;
-            i += j;
-
-            if (i >= (int32_t)size)
-            {
-                break;
-            }
-
-            if (numZeroBytes >= 2 && pBuf[0] == 1)
-            {
-                startCodeSize = std::min(numZeroBytes + 1, 4u);
-                size -= i + 1;
-                pBuf++;    // remove 0x01 symbol
-                if (size >= 1)
-                {
-                    return (pBuf[1] >> NAL_UNITTYPE_SHIFT); // get nal_unit_type
-                }
-                else
-                {
-                    pBuf -= startCodeSize;
-                    size += startCodeSize;
-                    startCodeSize = 0;
-                    return -1;
-                }
+                pBuf += offset;
+                size -= offset;
+                return (pBuf[1] >> NAL_UNITTYPE_SHIFT); // get nal_unit_type
             }
 
-            numZeroBytes = 0;
+            pBuf += offset - startCodeSize;
+            size = startCodeSize;
+            startCodeSize = 0;
+            return -1;
         }
 
-        if (!numZeroBytes)
-        {
-            for (uint32_t k = 0; k < size - i; k++, pBuf++)
-            {
-                if (pBuf[0])
-                {
-                    numZeroBytes = 0;
-                    continue;
-                }
-
-                numZeroBytes++;
-            }
-        }
+        // keep trailing zeros, they can be the beginning of the next start code
+        uint32_t numZeroBytes = 0;
+        while (numZeroBytes < 3 && numZeroBytes < size && !pBuf[size - numZeroBytes - 1])
+            numZeroBytes++;
 
-        numZeroBytes = std::min(numZeroBytes, 3u);
-        pBuf -= numZeroBytes;
+        pBuf += size - numZeroBytes;
         size = numZeroBytes;
         startCodeSize = numZeroBytes;
         return -1;
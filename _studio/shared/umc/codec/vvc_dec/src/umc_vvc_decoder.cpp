@@ -1242,50 +1242,57 @@ namespace UMC_VVC_DECODER
 
         try
         {
-            MemoryPiece mem;
-            mem.SetData(nalUnit);
+            const uint8_t *raw = (const uint8_t*)nalUnit->GetDataPointer();
+            size_t const rawSize = nalUnit->GetDataSize();
 
-            MemoryPiece swappedMem;
+            // streams repeat parameter sets at every IRAP or even every frame
+            if (!xReuseHeader(raw, rawSize, sts))
+            {
+                MemoryPiece mem;
+                mem.SetData(nalUnit);
 
-            swappedMem.Allocate(nalUnit->GetDataSize() + DEFAULT_UNIT_TAIL_SIZE);
+                MemoryPiece swappedMem;
 
-            m_splitter->SwapMemory(&swappedMem, &mem, 0);
-            bitStream.Reset((uint8_t*)swappedMem.GetPointer(), (uint32_t)swappedMem.GetDataSize());
+                swappedMem.Allocate(nalUnit->GetDataSize() + DEFAULT_UNIT_TAIL_SIZE);
 
-            NalUnitType nal_unit_type;
-            uint32_t temporal_id = 0;
-            uint32_t nuh_layer_id = 0;
+                m_splitter->SwapMemory(&swappedMem, &mem, 0);
+                bitStream.Reset((uint8_t*)swappedMem.GetPointer(), (uint32_t)swappedMem.GetDataSize());
 
-            bitStream.GetNALUnitType(nal_unit_type, temporal_id, nuh_layer_id);
+                NalUnitType nal_unit_type;
+                uint32_t temporal_id = 0;
+                uint32_t nuh_layer_id = 0;
 
-            switch (nal_unit_type)
-            {
-            case NAL_UNIT_VPS:
-                sts = xDecodeVPS(&bitStream);
-                break;
-            case NAL_UNIT_SPS:
-                sts = xDecodeSPS(&bitStream);
-                break;
-            case NAL_UNIT_PPS:
-                sts = xDecodePPS(&bitStream);
-                break;
-            case NAL_UNIT_PREFIX_APS:
-            case NAL_UNIT_SUFFIX_APS:
-                sts = xDecodeAPS(&bitStream);
-                break;
-            case NAL_UNIT_PH:
-                if (sts != UMC::UMC_OK &&
-                    sts != UMC::UMC_ERR_NOT_ENOUGH_DATA)
+                bitStream.GetNALUnitType(nal_unit_type, temporal_id, nuh_layer_id);
+
+                switch (nal_unit_type)
                 {
-                    return sts;
+                case NAL_UNIT_VPS:
+                    sts = xDecodeVPS(&bitStream);
+                    break;
+                case NAL_UNIT_SPS:
+                    sts = xDecodeSPS(&bitStream, raw, rawSize);
+                    break;
+                case NAL_UNIT_PPS:
+                    sts = xDecodePPS(&bitStream, raw, rawSize);
+                    break;
+                case NAL_UNIT_PREFIX_APS:
+                case NAL_UNIT_SUFFIX_APS:
+                    sts = xDecodeAPS(&bitStream);
+                    break;
+                case NAL_UNIT_PH:
+                    if (sts != UMC::UMC_OK &&
+                        sts != UMC::UMC_ERR_NOT_ENOUGH_DATA)
+                    {
+                        return sts;
+                    }
+                    sts = xDecodePH(&bitStream);
+                    break;
+                case NAL_UNIT_OPI:
+                    sts = xDecodeOPI(&bitStream);
+                    break;
+                default:
+                    break;
                 }
-                sts = xDecodePH(&bitStream);
-                break;
-            case NAL_UNIT_OPI:
-                sts = xDecodeOPI(&bitStream);
-                break;
-            default:
-                break;
             }
         }
         catch (const vvc_exception& ex)
@@ -1342,7 +1349,7 @@ namespace UMC_VVC_DECODER
         return UMC::UMC_OK;
     }
 
-    UMC::Status VVCDecoder::xDecodeSPS(VVCHeadersBitstream *bs)
+    UMC::Status VVCDecoder::xDecodeSPS(VVCHeadersBitstream *bs, const uint8_t *raw, size_t rawSize)
     {
         VVCSeqParamSet sps = {};
         sps.m_changed = false;
@@ -1360,7 +1367,7 @@ namespace UMC_VVC_DECODER
             newResolution = true;
         }
 
-        m_currHeaders.m_seqParams.AddHeader(&sps);
+        m_currHeaders.m_seqParams.AddHeader(&sps, raw, rawSize);
 
         m_splitter->SetSuggestedSize(CalculateSuggestedSize(&sps));
 
@@ -1372,7 +1379,7 @@ namespace UMC_VVC_DECODER
         return UMC::UMC_OK;
     }
 
-    UMC::Status VVCDecoder::xDecodePPS(VVCHeadersBitstream *bs)
+    UMC::Status VVCDecoder::xDecodePPS(VVCHeadersBitstream *bs, const uint8_t *raw, size_t rawSize)
     {
         VVCPicParamSet pps = {};
         pps.pps_num_slices_in_pic = 1;
@@ -1403,11 +1410,58 @@ namespace UMC_VVC_DECODER
             }
             pPicParamSet->pps_sub_pics.clear();
         }
-        m_currHeaders.m_picParams.AddHeader(&pps);
+        m_currHeaders.m_picParams.AddHeader(&pps, raw, rawSize);
 
         return UMC::UMC_OK;
     }
 
+    // Activate stored SPS/PPS if NAL unit repeats it byte for byte.
+    // The state changes are the same xDecodeSPS/xDecodePPS make for a freshly parsed copy.
+    // VPS is always parsed, it takes target OLS index from decoder state
+    bool VVCDecoder::xReuseHeader(const uint8_t *raw, size_t rawSize, UMC::Status &sts)
+    {
+        if (rawSize < 2)
+            return false;
+
+        sts = UMC::UMC_OK;
+
+        switch ((NalUnitType)(raw[1] >> 3))
+        {
+        case NAL_UNIT_SPS:
+            {
+                VVCSeqParamSet* sps = m_currHeaders.m_seqParams.FindHeader(raw, rawSize);
+                if (!sps)
+                    return false;
+
+                const VVCSeqParamSet* old_sps = m_currHeaders.m_seqParams.GetCurrentHeader();
+                if (IsNeedSPSInvalidate(old_sps, sps))
+                {
+                    sts = UMC::UMC_NTF_NEW_RESOLUTION;
+                }
+
+                sps->m_changed = false;
+                m_currHeaders.m_seqParams.SetCurrentID(sps->GetID());
+
+                m_splitter->SetSuggestedSize(CalculateSuggestedSize(sps));
+            }
+            return true;
+
+        case NAL_UNIT_PPS:
+            {
+                VVCPicParamSet* pps = m_currHeaders.m_picParams.FindHeader(raw, rawSize);
+                if (!pps)
+                    return false;
+
+                pps->m_changed = false;
+                m_currHeaders.m_picParams.SetCurrentID(pps->GetID());
+            }
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
     UMC::Status VVCDecoder::xDecodePH(VVCHeadersBitstream *bs)
     {
         VVCPicHeader ph = {};
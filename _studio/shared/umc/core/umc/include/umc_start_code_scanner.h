@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef __UMC_START_CODE_SCANNER_H__
+#define __UMC_START_CODE_SCANNER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace UMC
+{
+
+// Returns offset of the first 00 00 01 sequence in the buffer or size if there is none
+size_t FindStartCodePrefix(const uint8_t *pb, size_t size);
+
+// Returns offset of the first 00 00 03 sequence in the buffer or size if there is none
+size_t FindEmulationPrevention(const uint8_t *pb, size_t size);
+
+// Copies NAL unit payload dropping emulation prevention bytes and swapping every dword to little endian,
+// last incomplete dword is padded with tailValue. Returns the padded destination size.
+// Source offsets of removed bytes are appended to pRemovedOffsets if it is not NULL
+size_t RemovePreventingBytesAndSwap(uint8_t *pDst, const uint8_t *pSrc, size_t srcSize, uint8_t tailValue, std::vector<uint32_t> *pRemovedOffsets);
+
+// Architecture specific implementations, pattern is 00 00 <third>
+size_t FindThreeBytePattern_C(const uint8_t *pb, size_t size, uint8_t third);
+size_t FindThreeBytePattern_SSE4(const uint8_t *pb, size_t size, uint8_t third);
+size_t FindThreeBytePattern_AVX2(const uint8_t *pb, size_t size, uint8_t third);
+
+// Writes source bytes to pDst starting at byte dstPos of dword swapped output
+void CopySwapDwords_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size);
+
+// Architecture specific implementations, copy source bytes as CopySwapDwords_C does up to
+// the first emulation prevention byte. Returns number of copied bytes
+size_t SwapDwordsUntilPrevention_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size);
+size_t SwapDwordsUntilPrevention_SSE4(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size);
+size_t SwapDwordsUntilPrevention_AVX2(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size);
+
+} // namespace UMC
+
+#endif // __UMC_START_CODE_SCANNER_H__
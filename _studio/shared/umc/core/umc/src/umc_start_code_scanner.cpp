@@ -0,0 +1,146 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "umc_start_code_scanner.h"
+
+#include <cstring>
+
+namespace UMC
+{
+
+typedef size_t (*t_findThreeBytePattern)(const uint8_t *pb, size_t size, uint8_t third);
+typedef size_t (*t_swapDwordsUntilPrevention)(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size);
+
+static t_findThreeBytePattern GetFindThreeBytePatternImpl()
+{
+    static const t_findThreeBytePattern findThreeBytePattern_impl =
+        __builtin_cpu_supports("avx2")   ? FindThreeBytePattern_AVX2 :
+        __builtin_cpu_supports("sse4.2") ? FindThreeBytePattern_SSE4 :
+                                           FindThreeBytePattern_C;
+
+    return findThreeBytePattern_impl;
+}
+
+static t_swapDwordsUntilPrevention GetSwapDwordsUntilPreventionImpl()
+{
+    static const t_swapDwordsUntilPrevention swapDwordsUntilPrevention_impl =
+        __builtin_cpu_supports("avx2")   ? SwapDwordsUntilPrevention_AVX2 :
+        __builtin_cpu_supports("sse4.2") ? SwapDwordsUntilPrevention_SSE4 :
+                                           SwapDwordsUntilPrevention_C;
+
+    return swapDwordsUntilPrevention_impl;
+}
+
+size_t FindThreeBytePattern_C(const uint8_t *pb, size_t size, uint8_t third)
+{
+    size_t i = 2;
+
+    while (i < size)
+    {
+        // pattern can't end before i + 3 unless pb[i] is either zero or the third byte
+        if (pb[i] && pb[i] != third)
+        {
+            i += 3;
+            continue;
+        }
+
+        if (pb[i] == third && !pb[i - 1] && !pb[i - 2])
+            return i - 2;
+
+        i += 1;
+    }
+
+    return size;
+
+} // size_t FindThreeBytePattern_C(const uint8_t *pb, size_t size, uint8_t third)
+
+void CopySwapDwords_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+{
+    // byte n of the output lands to (n ^ 3), i.e. every dword is byte reversed
+    for (; size && (dstPos & 3); size--)
+        pDst[(dstPos++) ^ 3] = *pSrc++;
+
+    for (; size >= 4; size -= 4, dstPos += 4, pSrc += 4)
+    {
+        uint32_t dword;
+        memcpy(&dword, pSrc, 4);
+        dword = __builtin_bswap32(dword);
+        memcpy(pDst + dstPos, &dword, 4);
+    }
+
+    for (; size; size--)
+        pDst[(dstPos++) ^ 3] = *pSrc++;
+
+} // void CopySwapDwords_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+
+size_t SwapDwordsUntilPrevention_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+{
+    size_t end = FindThreeBytePattern_C(pSrc, size, 3);
+    end = (end < size) ? end + 2 : size;
+
+    CopySwapDwords_C(pDst, dstPos, pSrc, end);
+    return end;
+
+} // size_t SwapDwordsUntilPrevention_C(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+
+size_t FindStartCodePrefix(const uint8_t *pb, size_t size)
+{
+    return GetFindThreeBytePatternImpl()(pb, size, 1);
+
+} // size_t FindStartCodePrefix(const uint8_t *pb, size_t size)
+
+size_t FindEmulationPrevention(const uint8_t *pb, size_t size)
+{
+    return GetFindThreeBytePatternImpl()(pb, size, 3);
+
+} // size_t FindEmulationPrevention(const uint8_t *pb, size_t size)
+
+size_t RemovePreventingBytesAndSwap(uint8_t *pDst, const uint8_t *pSrc, size_t srcSize, uint8_t tailValue, std::vector<uint32_t> *pRemovedOffsets)
+{
+    const t_swapDwordsUntilPrevention swapDwordsUntilPrevention = GetSwapDwordsUntilPreventionImpl();
+
+    size_t dstSize = 0;
+    size_t srcPos = 0;
+
+    while (srcPos < srcSize)
+    {
+        const size_t length = swapDwordsUntilPrevention(pDst, dstSize, pSrc + srcPos, srcSize - srcPos);
+        dstSize += length;
+        srcPos += length;
+
+        if (srcPos == srcSize)
+            break;
+
+        if (pRemovedOffsets)
+            pRemovedOffsets->push_back(uint32_t(srcPos));
+
+        // zeros of the next 00 00 03 sequence can't precede the removed byte
+        srcPos += 1;
+    }
+
+    // write padding bytes
+    for (; dstSize & 3; dstSize++)
+        pDst[dstSize ^ 3] = tailValue;
+
+    return dstSize;
+
+} // size_t RemovePreventingBytesAndSwap(uint8_t *pDst, const uint8_t *pSrc, size_t srcSize, uint8_t tailValue, std::vector<uint32_t> *pRemovedOffsets)
+
+} // namespace UMC
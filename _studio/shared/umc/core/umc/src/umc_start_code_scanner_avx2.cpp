@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Intel Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "umc_start_code_scanner.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace UMC
+{
+
+// One load per 32 bytes: zero and third byte masks are combined with zero bits
+// carried over from the previous block, so sequences crossing blocks are found too.
+size_t FindThreeBytePattern_AVX2(const uint8_t *pb, size_t size, uint8_t third)
+{
+    const __m256i vZero  = _mm256_setzero_si256();
+    const __m256i vThird = _mm256_set1_epi8((char)third);
+
+    // bit 0 - byte at offset -2 is zero, bit 1 - byte at offset -1 is zero
+    uint64_t carry = 0;
+    size_t offset = 0;
+
+    for (; offset + 32 <= size; offset += 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(pb + offset));
+
+        const uint64_t zeros  = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vZero));
+        const uint64_t thirds = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vThird));
+
+        const uint64_t prefix = (zeros << 2) | carry;
+        const uint64_t match  = thirds & prefix & (prefix >> 1);
+
+        if (match)
+            return offset + __builtin_ctzll(match) - 2;
+
+        carry = (zeros >> (32 - 2)) & 3;
+    }
+
+    if (offset < 2)
+        return FindThreeBytePattern_C(pb, size, third);
+
+    return offset - 2 + FindThreeBytePattern_C(pb + offset - 2, size - offset + 2, third);
+
+} // size_t FindThreeBytePattern_AVX2(const uint8_t *pb, size_t size, uint8_t third)
+
+// The same block is checked for 00 00 03 and, if there is none, stored swapped,
+// so the source is read only once.
+size_t SwapDwordsUntilPrevention_AVX2(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+{
+    const __m256i vZero  = _mm256_setzero_si256();
+    const __m256i vThird = _mm256_set1_epi8(3);
+    const __m256i vSwap  = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    // complete the dword left by the previous copy
+    size_t offset = 0;
+    for (; offset < size && ((dstPos + offset) & 3); offset++)
+    {
+        if (offset >= 2 && 3 == pSrc[offset] && !pSrc[offset - 1] && !pSrc[offset - 2])
+            return offset;
+
+        pDst[(dstPos + offset) ^ 3] = pSrc[offset];
+    }
+
+    // bit 0 - byte at offset -2 is zero, bit 1 - byte at offset -1 is zero
+    uint64_t carry = ((offset >= 2 && !pSrc[offset - 2]) ? 1 : 0) |
+                     ((offset >= 1 && !pSrc[offset - 1]) ? 2 : 0);
+
+    for (; offset + 32 <= size; offset += 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(pSrc + offset));
+
+        const uint64_t zeros  = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vZero));
+        const uint64_t thirds = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vThird));
+
+        const uint64_t prefix = (zeros << 2) | carry;
+        const uint64_t match  = thirds & prefix & (prefix >> 1);
+
+        if (match)
+        {
+            const size_t length = __builtin_ctzll(match);
+            CopySwapDwords_C(pDst, dstPos + offset, pSrc + offset, length);
+            return offset + length;
+        }
+
+        _mm256_storeu_si256((__m256i *)(pDst + dstPos + offset), _mm256_shuffle_epi8(v, vSwap));
+        carry = (zeros >> (32 - 2)) & 3;
+    }
+
+    // sequences ending before offset are already checked
+    const size_t start = (offset < 2) ? 0 : offset - 2;
+    size_t end = start + FindThreeBytePattern_C(pSrc + start, size - start, 3);
+    end = (end < size) ? end + 2 : size;
+
+    CopySwapDwords_C(pDst, dstPos + offset, pSrc + offset, end - offset);
+    return end;
+
+} // size_t SwapDwordsUntilPrevention_AVX2(uint8_t *pDst, size_t dstPos, const uint8_t *pSrc, size_t size)
+
+} // namespace UMC
+
+#endif // __AVX2__